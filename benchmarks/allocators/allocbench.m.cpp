@@ -0,0 +1,943 @@
+// allocbench.m.cpp                                                   -*-C++-*-
+
+// This program measures the allocators shipped in 'bdlma' and 'bslma' under
+// the access-pattern scenarios described in the ISO WG21 paper "On
+// Quantifying Memory-Allocation Strategies" (N4468, P0089R0, P0089R1):
+//
+//: o *churn*: a "system" (an allocator and the container it supplies) is
+//:   repeatedly created, populated, and destroyed;
+//:
+//: o *locality*: several containers are populated in an interleaved fashion
+//:   and then repeatedly traversed;
+//:
+//: o *diffusion*: a container undergoes a number of random erasures and
+//:   insertions before being repeatedly traversed;
+//:
+//: o *variation*: like churn, but the populated elements own blocks of
+//:   widely varying sizes;
+//:
+//: o *samethread*: several threads share one allocator, each repeatedly
+//:   allocating and freeing a window of fixed-size blocks;
+//:
+//: o *crossthread*: several producer threads share one allocator with as many
+//:   consumer threads, each producer allocating fixed-size blocks that are
+//:   handed, in batches, to its consumer, which frees them.
+//
+// Each of the first four scenarios is run for every applicable combination of
+// workload (a 'bsl::vector' or 'bsl::unordered_map' of elements, some of
+// which themselves allocate) and allocation strategy (an allocator, created
+// afresh for each system, and a teardown policy).  The teardown policy is
+// either 'destroy', in which the container is destroyed before its
+// allocator, or 'wink', in which the container's destructor is never run and
+// its memory is reclaimed wholesale by the destruction of a managed
+// allocator.  The two threaded scenarios are run only for the thread-safe
+// allocators, with the workload 'block64' (blocks of 64 bytes).
+//
+// Results are written as comma-separated values, one row per measurement,
+// having the columns:
+//..
+//  scenario,workload,allocator,teardown,elements,param,iterations,seconds,
+//  nsPerElement
+//..
+// where 'param' is the scenario-specific parameter (the number of containers
+// for locality, the number of random operations per element for diffusion,
+// the maximum element size for variation, the number of threads for
+// samethread, and the number of producer/consumer pairs for crossthread), and
+// 'nsPerElement' is the elapsed time divided by the number of elements
+// processed.  For the threaded scenarios, 'elements' is the number of blocks
+// allocated by each (producer) thread, and 'nsPerElement' is the elapsed wall
+// time divided by the total number of blocks allocated and freed.  Run with
+// '--help' for the available options.
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+#include <bdlma_threadcachingallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_mallocfreeallocator.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_deque.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+#include <new>
+
+using namespace BloombergLP;
+
+namespace {
+
+// ============================================================================
+//                          CONFIGURATION AND OUTPUT
+// ----------------------------------------------------------------------------
+
+enum Scenario {
+    e_CHURN,
+    e_LOCALITY,
+    e_DIFFUSION,
+    e_VARIATION,
+    e_SAME_THREAD,
+    e_CROSS_THREAD,
+
+    k_NUM_SCENARIOS
+};
+
+const char *const SCENARIO_NAMES[] = {
+    "churn", "locality", "diffusion", "variation", "samethread", "crossthread"
+};
+
+struct Config {
+    // This 'struct' holds the options of a benchmark run.
+
+    int         d_elements;      // elements per churned system
+    int         d_largeElements; // elements per traversed system
+    int         d_totalWork;     // elements processed per measurement
+    bool        d_scenarios[k_NUM_SCENARIOS];
+                                 // scenarios enabled, indexed by 'Scenario'
+    const char *d_allocator_p;   // if not 0, only run this allocator
+};
+
+class Reporter {
+    // This class writes measurements as rows of comma-separated values.
+
+    // DATA
+    bsl::ostream *d_stream_p;  // destination (held, not owned)
+
+  public:
+    // CREATORS
+    explicit Reporter(bsl::ostream *stream)
+    : d_stream_p(stream)
+    {
+        *d_stream_p << "scenario,workload,allocator,teardown,elements,param,"
+                       "iterations,seconds,nsPerElement\n";
+    }
+
+    // MANIPULATORS
+    void report(Scenario    scenario,
+                const char *workload,
+                const char *allocator,
+                const char *teardown,
+                int         elements,
+                int         param,
+                int         iterations,
+                double      seconds,
+                double      numProcessed)
+        // Write a row describing the specified measurement.
+    {
+        *d_stream_p << SCENARIO_NAMES[scenario] << ','
+                    << workload << ','
+                    << allocator << ','
+                    << teardown << ','
+                    << elements << ','
+                    << param << ','
+                    << iterations << ','
+                    << seconds << ','
+                    << seconds * 1e9 / numProcessed << '\n';
+        d_stream_p->flush();
+    }
+};
+
+class Random {
+    // This class provides a small, deterministic pseudo-random number
+    // generator (xorshift64).
+
+    // DATA
+    bsls::Types::Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit Random(bsls::Types::Uint64 seed = 0x9E3779B97F4A7C15ULL)
+    : d_state(seed)
+    {
+    }
+
+    // MANIPULATORS
+    unsigned int next(unsigned int range)
+        // Return a pseudo-random value in '[0 .. range)'.
+    {
+        d_state ^= d_state << 13;
+        d_state ^= d_state >> 7;
+        d_state ^= d_state << 17;
+        return static_cast<unsigned int>(d_state >> 32) % range;
+    }
+};
+
+// ============================================================================
+//                            ALLOCATION STRATEGIES
+// ----------------------------------------------------------------------------
+// Each strategy owns the allocator of one system.  'k_CAN_WINK' indicates
+// whether the allocator reclaims all its memory on destruction, so that the
+// destructor of a container using it may be skipped, and 'k_THREAD_SAFE'
+// whether the allocator may be shared by several threads.
+
+enum { k_ARENA_SIZE = 64 * 1024 };
+
+struct NewDeleteStrategy {
+    enum { k_CAN_WINK = 0, k_THREAD_SAFE = 1 };
+    static const char *name() { return "newdelete"; }
+    bslma::Allocator *allocator()
+    {
+        return &bslma::NewDeleteAllocator::singleton();
+    }
+};
+
+struct MallocStrategy {
+    enum { k_CAN_WINK = 0, k_THREAD_SAFE = 1 };
+    static const char *name() { return "malloc"; }
+    bslma::Allocator *allocator()
+    {
+        return &bslma::MallocFreeAllocator::singleton();
+    }
+};
+
+struct MultipoolStrategy {
+    enum { k_CAN_WINK = 1, k_THREAD_SAFE = 0 };
+    bdlma::MultipoolAllocator d_allocator;
+    static const char *name() { return "multipool"; }
+    bslma::Allocator *allocator() { return &d_allocator; }
+};
+
+struct ConcurrentMultipoolStrategy {
+    enum { k_CAN_WINK = 1, k_THREAD_SAFE = 1 };
+    bdlma::ConcurrentMultipoolAllocator d_allocator;
+    static const char *name() { return "concurrentmultipool"; }
+    bslma::Allocator *allocator() { return &d_allocator; }
+};
+
+struct ThreadCachingStrategy {
+    enum { k_CAN_WINK = 1, k_THREAD_SAFE = 1 };
+    bdlma::ThreadCachingAllocator d_allocator;
+    static const char *name() { return "threadcaching"; }
+    bslma::Allocator *allocator() { return &d_allocator; }
+};
+
+struct SequentialStrategy {
+    enum { k_CAN_WINK = 1, k_THREAD_SAFE = 0 };
+    bdlma::SequentialAllocator d_allocator;
+    static const char *name() { return "sequential"; }
+    bslma::Allocator *allocator() { return &d_allocator; }
+};
+
+struct BufferedSequentialStrategy {
+    enum { k_CAN_WINK = 1, k_THREAD_SAFE = 0 };
+    bsls::AlignedBuffer<k_ARENA_SIZE>  d_buffer;
+    bdlma::BufferedSequentialAllocator d_allocator;
+    BufferedSequentialStrategy()
+    : d_allocator(d_buffer.buffer(), k_ARENA_SIZE)
+    {
+    }
+    static const char *name() { return "bufferedsequential"; }
+    bslma::Allocator *allocator() { return &d_allocator; }
+};
+
+struct LocalSequentialStrategy {
+    enum { k_CAN_WINK = 1, k_THREAD_SAFE = 0 };
+    bdlma::LocalSequentialAllocator<k_ARENA_SIZE> d_allocator;
+    static const char *name() { return "localsequential"; }
+    bslma::Allocator *allocator() { return &d_allocator; }
+};
+
+// ============================================================================
+//                                 WORKLOADS
+// ----------------------------------------------------------------------------
+// Each workload names a container type and provides 'add', which inserts the
+// element having the specified 'key', and 'traverse', which visits every
+// element.  'param', where used, bounds the size of the memory owned by an
+// element.
+
+struct IntVectorWorkload {
+    typedef bsl::vector<int> Container;
+    static const char *name() { return "vector_int"; }
+    static void add(Container *c, int key, int, Random *)
+    {
+        c->push_back(key);
+    }
+    static bsls::Types::Int64 traverse(const Container& c)
+    {
+        bsls::Types::Int64 sum = 0;
+        for (Container::const_iterator it = c.begin(); it != c.end(); ++it) {
+            sum += *it;
+        }
+        return sum;
+    }
+};
+
+struct StringVectorWorkload {
+    typedef bsl::vector<bsl::string> Container;
+    static const char *name() { return "vector_string"; }
+    static void add(Container *c, int key, int param, Random *random)
+    {
+        // Strings longer than the short-string buffer allocate.
+
+        const int length = param ? 1 + static_cast<int>(random->next(param))
+                                 : 33;
+        c->push_back(bsl::string());
+        c->back().assign(length, static_cast<char>('a' + key % 26));
+    }
+    static bsls::Types::Int64 traverse(const Container& c)
+    {
+        bsls::Types::Int64 sum = 0;
+        for (Container::const_iterator it = c.begin(); it != c.end(); ++it) {
+            sum += (*it)[0];
+        }
+        return sum;
+    }
+};
+
+struct IntMapWorkload {
+    typedef bsl::unordered_map<int, int> Container;
+    static const char *name() { return "unordered_map_int_int"; }
+    static void add(Container *c, int key, int, Random *)
+    {
+        c->insert(bsl::make_pair(key, key));
+    }
+    static bsls::Types::Int64 traverse(const Container& c)
+    {
+        bsls::Types::Int64 sum = 0;
+        for (Container::const_iterator it = c.begin(); it != c.end(); ++it) {
+            sum += it->second;
+        }
+        return sum;
+    }
+};
+
+struct VectorMapWorkload {
+    typedef bsl::unordered_map<int, bsl::vector<char> > Container;
+    static const char *name() { return "unordered_map_int_vector_char"; }
+    static void add(Container *c, int key, int param, Random *random)
+    {
+        const int length = param ? 1 + static_cast<int>(random->next(param))
+                                 : 32;
+        (*c)[key].resize(length, static_cast<char>(key));
+    }
+    static bsls::Types::Int64 traverse(const Container& c)
+    {
+        bsls::Types::Int64 sum = 0;
+        for (Container::const_iterator it = c.begin(); it != c.end(); ++it) {
+            sum += it->second[0];
+        }
+        return sum;
+    }
+};
+
+// ============================================================================
+//                                 SCENARIOS
+// ----------------------------------------------------------------------------
+
+volatile bsls::Types::Int64 g_sink;  // defeats dead-code elimination
+
+template <class STRATEGY, class WORKLOAD>
+double runChurn(int elements, int param, int iterations, bool wink)
+    // Create, populate with the specified 'elements', and tear down a system
+    // of the specified 'STRATEGY' and 'WORKLOAD' the specified 'iterations'
+    // times, passing the specified 'param' to 'WORKLOAD::add', and return the
+    // elapsed time in seconds.  If the specified 'wink' is 'true', the
+    // container is not destroyed.
+{
+    typedef typename WORKLOAD::Container Container;
+
+    bsls::AlignedBuffer<sizeof(Container)> storage;
+    Random                                 random;
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < iterations; ++i) {
+        STRATEGY   strategy;
+        Container *container = new (storage.buffer())
+                                              Container(strategy.allocator());
+        for (int e = 0; e < elements; ++e) {
+            WORKLOAD::add(container, e, param, &random);
+        }
+        g_sink = g_sink + static_cast<bsls::Types::Int64>(container->size());
+        if (!wink) {
+            container->~Container();
+        }
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+template <class STRATEGY, class WORKLOAD>
+double runLocality(int elements, int numContainers, int passes)
+    // Populate the specified 'numContainers' containers of the specified
+    // 'WORKLOAD', each supplied by its own allocator of the specified
+    // 'STRATEGY', with a total of the specified 'elements' added round-robin,
+    // and return the time in seconds taken to traverse every container the
+    // specified 'passes' times.
+{
+    typedef typename WORKLOAD::Container Container;
+
+    bsl::vector<STRATEGY *>  strategies(numContainers);
+    bsl::vector<Container *> containers(numContainers);
+    for (int c = 0; c < numContainers; ++c) {
+        strategies[c] = new STRATEGY();
+        containers[c] = new Container(strategies[c]->allocator());
+    }
+
+    Random random;
+    for (int e = 0; e < elements; ++e) {
+        WORKLOAD::add(containers[e % numContainers], e, 0, &random);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int p = 0; p < passes; ++p) {
+        for (int c = 0; c < numContainers; ++c) {
+            g_sink = g_sink + WORKLOAD::traverse(*containers[c]);
+        }
+    }
+    timer.stop();
+
+    for (int c = 0; c < numContainers; ++c) {
+        delete containers[c];
+        delete strategies[c];
+    }
+    return timer.elapsedTime();
+}
+
+template <class STRATEGY>
+double runDiffusion(int elements, int opsPerElement, int passes)
+    // Populate an 'unordered_map<int, int>' supplied by an allocator of the
+    // specified 'STRATEGY' with the specified 'elements', perform
+    // 'opsPerElement * elements' random replacements of an element by a new
+    // one, and return the time in seconds taken to traverse the map the
+    // specified 'passes' times.
+{
+    typedef IntMapWorkload::Container Container;
+
+    STRATEGY  *strategy  = new STRATEGY();
+    Container *container = new Container(strategy->allocator());
+
+    bsl::vector<int> keys(elements);
+    for (int e = 0; e < elements; ++e) {
+        keys[e] = e;
+        container->insert(bsl::make_pair(e, e));
+    }
+
+    Random random;
+    int    nextKey = elements;
+    for (bsls::Types::Int64 op = 0;
+         op < static_cast<bsls::Types::Int64>(opsPerElement) * elements;
+         ++op) {
+        const int slot = static_cast<int>(random.next(elements));
+        container->erase(keys[slot]);
+        keys[slot] = nextKey;
+        container->insert(bsl::make_pair(nextKey, nextKey));
+        ++nextKey;
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int p = 0; p < passes; ++p) {
+        g_sink = g_sink + IntMapWorkload::traverse(*container);
+    }
+    timer.stop();
+
+    delete container;
+    delete strategy;
+    return timer.elapsedTime();
+}
+
+enum {
+    k_BLOCK_SIZE = 64,   // size of the blocks of the threaded scenarios
+    k_WINDOW     = 64,   // blocks allocated before being freed (samethread)
+    k_BATCH      = 256   // blocks handed over at a time (crossthread)
+};
+
+class BatchQueue {
+    // This class provides a thread-safe queue of batches of blocks, a null
+    // batch marking the end of the queue.
+
+    // DATA
+    bsl::deque<bsl::vector<void *> *> d_queue;      // queued batches
+    bslmt::Mutex                      d_mutex;      // protects 'd_queue'
+    bslmt::Condition                  d_condition;  // signaled on push
+
+  public:
+    // MANIPULATORS
+    void push(bsl::vector<void *> *batch)
+        // Append the specified 'batch' to this queue.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_queue.push_back(batch);
+        d_condition.signal();
+    }
+
+    bsl::vector<void *> *pop()
+        // Remove and return the batch at the front of this queue, blocking
+        // until one is available.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        while (d_queue.empty()) {
+            d_condition.wait(&d_mutex);
+        }
+        bsl::vector<void *> *batch = d_queue.front();
+        d_queue.pop_front();
+        return batch;
+    }
+};
+
+struct SameThreadWorker {
+    // This 'struct' defines a functor that repeatedly allocates, and then
+    // frees, a window of blocks.
+
+    bslma::Allocator *d_allocator_p;  // shared allocator
+    int               d_numBlocks;    // blocks to allocate
+    bslmt::Barrier   *d_start_p;      // waited on before starting
+
+    void operator()() const
+    {
+        void *blocks[k_WINDOW];
+
+        d_start_p->wait();
+        for (int n = 0; n < d_numBlocks; n += k_WINDOW) {
+            for (int i = 0; i < k_WINDOW; ++i) {
+                blocks[i] = d_allocator_p->allocate(k_BLOCK_SIZE);
+            }
+            for (int i = 0; i < k_WINDOW; ++i) {
+                d_allocator_p->deallocate(blocks[i]);
+            }
+        }
+    }
+};
+
+struct CrossThreadProducer {
+    // This 'struct' defines a functor that allocates batches of blocks and
+    // hands them to a consumer.
+
+    bslma::Allocator *d_allocator_p;  // shared allocator
+    BatchQueue       *d_queue_p;      // destination of batches
+    int               d_numBlocks;    // blocks to allocate
+    bslmt::Barrier   *d_start_p;      // waited on before starting
+
+    void operator()() const
+    {
+        d_start_p->wait();
+        for (int n = 0; n < d_numBlocks; n += k_BATCH) {
+            bsl::vector<void *> *batch = new bsl::vector<void *>(k_BATCH);
+            for (int i = 0; i < k_BATCH; ++i) {
+                (*batch)[i] = d_allocator_p->allocate(k_BLOCK_SIZE);
+            }
+            d_queue_p->push(batch);
+        }
+        d_queue_p->push(0);
+    }
+};
+
+struct CrossThreadConsumer {
+    // This 'struct' defines a functor that frees the blocks of every batch
+    // handed over by a producer.
+
+    bslma::Allocator *d_allocator_p;  // shared allocator
+    BatchQueue       *d_queue_p;      // source of batches
+
+    void operator()() const
+    {
+        while (bsl::vector<void *> *batch = d_queue_p->pop()) {
+            for (int i = 0; i < static_cast<int>(batch->size()); ++i) {
+                d_allocator_p->deallocate((*batch)[i]);
+            }
+            delete batch;
+        }
+    }
+};
+
+template <class STRATEGY>
+double runSameThread(int numBlocks, int numThreads)
+    // Run the specified 'numThreads' threads sharing an allocator of the
+    // specified 'STRATEGY', each allocating and freeing the specified
+    // 'numBlocks' blocks, and return the elapsed time in seconds.
+{
+    STRATEGY       strategy;
+    bslmt::Barrier start(numThreads + 1);
+
+    SameThreadWorker worker = { strategy.allocator(), numBlocks, &start };
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    for (int t = 0; t < numThreads; ++t) {
+        bslmt::ThreadUtil::create(&handles[t], worker);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    start.wait();
+    for (int t = 0; t < numThreads; ++t) {
+        bslmt::ThreadUtil::join(handles[t]);
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+template <class STRATEGY>
+double runCrossThread(int numBlocks, int numPairs)
+    // Run the specified 'numPairs' pairs of threads sharing an allocator of
+    // the specified 'STRATEGY', the producer of each pair allocating the
+    // specified 'numBlocks' blocks and the consumer freeing them, and return
+    // the elapsed time in seconds.
+{
+    STRATEGY                strategy;
+    bslmt::Barrier          start(numPairs + 1);
+    bsl::vector<BatchQueue> queues(numPairs);
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(2 * numPairs);
+    for (int p = 0; p < numPairs; ++p) {
+        CrossThreadProducer producer = { strategy.allocator(),
+                                         &queues[p],
+                                         numBlocks,
+                                         &start };
+        CrossThreadConsumer consumer = { strategy.allocator(), &queues[p] };
+
+        bslmt::ThreadUtil::create(&handles[2 * p],     producer);
+        bslmt::ThreadUtil::create(&handles[2 * p + 1], consumer);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    start.wait();
+    for (int t = 0; t < 2 * numPairs; ++t) {
+        bslmt::ThreadUtil::join(handles[t]);
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+// ============================================================================
+//                                  DRIVER
+// ----------------------------------------------------------------------------
+
+template <class STRATEGY>
+class StrategyRunner {
+    // This class runs every enabled scenario for the 'STRATEGY'.
+
+    const Config *d_config_p;
+    Reporter     *d_reporter_p;
+
+    int iterationsFor(int elements) const
+        // Return the number of iterations of a system of the specified
+        // 'elements' making up the configured total work.
+    {
+        const int n = d_config_p->d_totalWork / elements;
+        return n ? n : 1;
+    }
+
+    template <class WORKLOAD>
+    void churn(Scenario scenario, int param)
+    {
+        const int elements   = d_config_p->d_elements;
+        const int iterations = iterationsFor(elements);
+
+        double seconds = runChurn<STRATEGY, WORKLOAD>(elements,
+                                                      param,
+                                                      iterations,
+                                                      false);
+        d_reporter_p->report(scenario,
+                             WORKLOAD::name(),
+                             STRATEGY::name(),
+                             "destroy",
+                             elements,
+                             param,
+                             iterations,
+                             seconds,
+                             static_cast<double>(elements) * iterations);
+
+        if (STRATEGY::k_CAN_WINK) {
+            seconds = runChurn<STRATEGY, WORKLOAD>(elements,
+                                                   param,
+                                                   iterations,
+                                                   true);
+            d_reporter_p->report(scenario,
+                                 WORKLOAD::name(),
+                                 STRATEGY::name(),
+                                 "wink",
+                                 elements,
+                                 param,
+                                 iterations,
+                                 seconds,
+                                 static_cast<double>(elements) * iterations);
+        }
+    }
+
+    template <class WORKLOAD>
+    void locality(int numContainers)
+    {
+        const int elements = d_config_p->d_largeElements;
+        const int passes   = iterationsFor(elements);
+
+        const double seconds = runLocality<STRATEGY, WORKLOAD>(elements,
+                                                               numContainers,
+                                                               passes);
+        d_reporter_p->report(e_LOCALITY,
+                             WORKLOAD::name(),
+                             STRATEGY::name(),
+                             "destroy",
+                             elements,
+                             numContainers,
+                             passes,
+                             seconds,
+                             static_cast<double>(elements) * passes);
+    }
+
+    void diffusion(int opsPerElement)
+    {
+        const int elements = d_config_p->d_largeElements;
+        const int passes   = iterationsFor(elements);
+
+        const double seconds = runDiffusion<STRATEGY>(elements,
+                                                      opsPerElement,
+                                                      passes);
+        d_reporter_p->report(e_DIFFUSION,
+                             IntMapWorkload::name(),
+                             STRATEGY::name(),
+                             "destroy",
+                             elements,
+                             opsPerElement,
+                             passes,
+                             seconds,
+                             static_cast<double>(elements) * passes);
+    }
+
+    void threaded(Scenario scenario, int numThreads)
+    {
+        const int numBlocks = d_config_p->d_totalWork / numThreads;
+
+        const double seconds = e_SAME_THREAD == scenario
+                             ? runSameThread<STRATEGY>(numBlocks, numThreads)
+                             : runCrossThread<STRATEGY>(numBlocks, numThreads);
+        d_reporter_p->report(scenario,
+                             "block64",
+                             STRATEGY::name(),
+                             "destroy",
+                             numBlocks,
+                             numThreads,
+                             1,
+                             seconds,
+                             static_cast<double>(numBlocks) * numThreads);
+    }
+
+  public:
+    StrategyRunner(const Config *config, Reporter *reporter)
+    : d_config_p(config)
+    , d_reporter_p(reporter)
+    {
+    }
+
+    void run()
+        // Run every enabled scenario, unless the configuration selects
+        // another allocator.
+    {
+        if (d_config_p->d_allocator_p
+         && bsl::strcmp(d_config_p->d_allocator_p, STRATEGY::name())) {
+            return;                                                   // RETURN
+        }
+
+        if (d_config_p->d_scenarios[e_CHURN]) {
+            churn<IntVectorWorkload>(e_CHURN, 0);
+            churn<StringVectorWorkload>(e_CHURN, 0);
+            churn<IntMapWorkload>(e_CHURN, 0);
+            churn<VectorMapWorkload>(e_CHURN, 0);
+        }
+
+        if (d_config_p->d_scenarios[e_LOCALITY]) {
+            static const int NUM_CONTAINERS[] = { 1, 4, 16, 64 };
+            for (int i = 0; i < 4; ++i) {
+                locality<StringVectorWorkload>(NUM_CONTAINERS[i]);
+                locality<IntMapWorkload>(NUM_CONTAINERS[i]);
+            }
+        }
+
+        if (d_config_p->d_scenarios[e_DIFFUSION]) {
+            static const int OPS_PER_ELEMENT[] = { 0, 1, 4, 16 };
+            for (int i = 0; i < 4; ++i) {
+                diffusion(OPS_PER_ELEMENT[i]);
+            }
+        }
+
+        if (d_config_p->d_scenarios[e_VARIATION]) {
+            static const int MAX_SIZES[] = { 64, 512, 4096 };
+            for (int i = 0; i < 3; ++i) {
+                churn<StringVectorWorkload>(e_VARIATION, MAX_SIZES[i]);
+                churn<VectorMapWorkload>(e_VARIATION, MAX_SIZES[i]);
+            }
+        }
+
+        if (STRATEGY::k_THREAD_SAFE) {
+            static const int NUM_THREADS[] = { 1, 2, 4, 8 };
+            for (int s = e_SAME_THREAD; s <= e_CROSS_THREAD; ++s) {
+                if (!d_config_p->d_scenarios[s]) {
+                    continue;
+                }
+                for (int i = 0; i < 4; ++i) {
+                    threaded(static_cast<Scenario>(s), NUM_THREADS[i]);
+                }
+            }
+        }
+    }
+};
+
+template <class STRATEGY>
+void runStrategy(const Config& config, Reporter *reporter)
+    // Run the enabled scenarios for the 'STRATEGY'.
+{
+    StrategyRunner<STRATEGY>(&config, reporter).run();
+}
+
+void usage(const char *program)
+    // Print the usage of the specified 'program' to standard error.
+{
+    bsl::cerr
+        << "usage: " << program << " [options]\n"
+        << "  --scenario=NAME   run only NAME (churn, locality, diffusion,\n"
+        << "                    variation, samethread, crossthread); may\n"
+        << "                    be repeated\n"
+        << "  --allocator=NAME  run only the allocator NAME (newdelete,\n"
+        << "                    malloc, multipool, concurrentmultipool,\n"
+        << "                    threadcaching, sequential,\n"
+        << "                    bufferedsequential, localsequential)\n"
+        << "  --elements=N      elements per system for churn and\n"
+        << "                    variation (default 1000)\n"
+        << "  --large-elements=N\n"
+        << "                    elements per system for locality and\n"
+        << "                    diffusion (default 262144)\n"
+        << "  --work=N          elements processed per measurement, and\n"
+        << "                    blocks allocated per threaded measurement\n"
+        << "                    (default 4194304)\n"
+        << "  --output=FILE     write results to FILE instead of stdout\n";
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Config config;
+    config.d_elements      = 1000;
+    config.d_largeElements = 1 << 18;
+    config.d_totalWork     = 1 << 22;
+    config.d_allocator_p   = 0;
+
+    bool anyScenario = false;
+    for (int s = 0; s < k_NUM_SCENARIOS; ++s) {
+        config.d_scenarios[s] = false;
+    }
+
+    const char *output = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg   = argv[i];
+        const char *value = bsl::strchr(arg, '=');
+        if (!value) {
+            usage(argv[0]);
+            return 0 == bsl::strcmp(arg, "--help") ? 0 : 1;           // RETURN
+        }
+        ++value;
+
+        const bsl::string key(arg, value - 1);
+        if ("--scenario" == key) {
+            bool found = false;
+            for (int s = 0; s < k_NUM_SCENARIOS; ++s) {
+                if (0 == bsl::strcmp(value, SCENARIO_NAMES[s])) {
+                    config.d_scenarios[s] = true;
+                    found                 = true;
+                }
+            }
+            if (!found) {
+                usage(argv[0]);
+                return 1;                                             // RETURN
+            }
+            anyScenario = true;
+        }
+        else if ("--allocator" == key) {
+            config.d_allocator_p = value;
+        }
+        else if ("--elements" == key) {
+            config.d_elements = bsl::atoi(value);
+        }
+        else if ("--large-elements" == key) {
+            config.d_largeElements = bsl::atoi(value);
+        }
+        else if ("--work" == key) {
+            config.d_totalWork = bsl::atoi(value);
+        }
+        else if ("--output" == key) {
+            output = value;
+        }
+        else {
+            usage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+    }
+
+    if (config.d_elements      <= 0
+     || config.d_largeElements <= 0
+     || config.d_totalWork     <= 0) {
+        usage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    if (!anyScenario) {
+        for (int s = 0; s < k_NUM_SCENARIOS; ++s) {
+            config.d_scenarios[s] = true;
+        }
+    }
+
+    bsl::ofstream file;
+    if (output) {
+        file.open(output);
+        if (!file) {
+            bsl::cerr << "cannot open " << output << '\n';
+            return 1;                                                 // RETURN
+        }
+    }
+
+    Reporter reporter(output ? static_cast<bsl::ostream *>(&file)
+                             : &bsl::cout);
+
+    runStrategy<NewDeleteStrategy>(config, &reporter);
+    runStrategy<MallocStrategy>(config, &reporter);
+    runStrategy<MultipoolStrategy>(config, &reporter);
+    runStrategy<ConcurrentMultipoolStrategy>(config, &reporter);
+    runStrategy<ThreadCachingStrategy>(config, &reporter);
+    runStrategy<SequentialStrategy>(config, &reporter);
+    runStrategy<BufferedSequentialStrategy>(config, &reporter);
+    runStrategy<LocalSequentialStrategy>(config, &reporter);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -38,6 +38,14 @@ BSLS_IDENT("$Id: $")
 // Refer to the details of the JSON encoding format supported by this decoder
 // in the package documentation file (doc/baljsn.txt).
 //
+///Decoding from Contiguous Memory
+///-------------------------------
+// If the 'streambuf' supplied to 'decode' is a 'bdlsb::FixedMemInStreamBuf',
+// the JSON data is tokenized in place rather than being copied, a block at a
+// time, into an internal buffer (see 'baljsn_tokenizer').  Decoding JSON data
+// that is already held in memory is therefore most efficient when that memory
+// is supplied through a 'bdlsb::FixedMemInStreamBuf'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -246,9 +254,11 @@ class Decoder {
         // 'TYPE' shall be a 'bdeat'-compatible sequence, choice, or array
         // type, or a 'bdeat'-compatible dynamic type referring to one of those
         // types.  Return 0 on success, and a non-zero value otherwise.  Note
-        // that this operation internally buffers input from 'streambuf', and
-        // if decoding is successful, will attempt to update the input position
-        // of 'streambuf' to the last unprocessed byte.
+        // that this operation internally buffers input from 'streambuf',
+        // unless it is a 'bdlsb::FixedMemInStreamBuf' (see {Decoding from
+        // Contiguous Memory}), and if decoding is successful, will attempt to
+        // update the input position of 'streambuf' to the last unprocessed
+        // byte.
 
     template <class TYPE>
     int decode(bsl::istream&          stream,
@@ -4,7 +4,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_encoder_cpp,"$Id$ $CSID$")
 
-#include <bdlde_base64encoder.h>
+#include <bdlde_base64util.h>
 
 namespace BloombergLP {
 namespace baljsn {
@@ -19,30 +19,18 @@ int Encoder_EncodeImpl::encodeImp(const bsl::vector<char>&  value,
                                   bdlat_TypeCategory::Array)
 {
     bsl::string base64String;
-    bdlde::Base64Encoder encoder(0);
-    base64String.resize(
-       bdlde::Base64Encoder::encodedLength(static_cast<int>(value.size()), 0));
+    base64String.resize(bdlde::Base64Util::encodedLength(value.size(), 0));
 
     // Ensure length is a multiple of 4.
 
     BSLS_ASSERT(0 == (base64String.length() & 0x03));
 
-    int numOut;
-    int numIn;
-    int rc = encoder.convert(base64String.begin(),
-                             &numOut,
-                             &numIn,
-                             value.begin(),
-                             value.end());
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
-
-    rc = encoder.endConvert(base64String.begin() + numOut);
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
+    const bsl::size_t numOut = bdlde::Base64Util::encode(&base64String[0],
+                                                         value.data(),
+                                                         value.size(),
+                                                         0);
+    BSLS_ASSERT(base64String.length() == numOut);
+    (void)numOut;
 
     return encode(base64String, 0);
 }
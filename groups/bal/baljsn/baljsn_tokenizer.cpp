@@ -6,6 +6,8 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
 #include <bdlb_chartype.h>
 
+#include <bdlsb_fixedmeminstreambuf.h>
+
 #include <bsl_cstring.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
@@ -56,8 +58,33 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+inline
+bool isValueDelimiter(char character)
+    // Return 'true' if the specified 'character' ends a value that is not a
+    // string, i.e., if it is whitespace, one of the tokens "{}[]:,", or the
+    // null character, and 'false' otherwise.
+{
+    switch (character) {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\v':
+      case '\f':
+      case '\r':
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+      case '\0': {
+        return true;                                                  // RETURN
+      }
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
 
 }  // close unnamed namespace
 
@@ -68,19 +95,42 @@ namespace baljsn {
                               // ----------------
 
 // PRIVATE MANIPULATORS
+void Tokenizer::resetState()
+{
+    d_cursor     = 0;
+    d_valueBegin = 0;
+    d_valueEnd   = 0;
+    d_valueIter  = 0;
+    d_tokenType  = e_BEGIN;
+
+    d_contextStack.clear();
+    pushContext(e_OBJECT_CONTEXT);
+}
+
 int Tokenizer::reloadStringBuffer()
 {
+    if (d_isContiguous) {
+        // The entire input is already available.
+
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
     const int numRead =
                      static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[0],
                                                            k_MAX_STRING_SIZE));
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
+    synchronizeWithStringBuffer();
     return numRead;
 }
 
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (d_isContiguous) {
+        return -1;                                                    // RETURN
+    }
+
     const bsl::string::size_type currLength = d_stringBuffer.length();
     d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
@@ -88,11 +138,16 @@ int Tokenizer::expandBufferForLargeValue()
             static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
                                                   k_MAX_STRING_SIZE));
     d_stringBuffer.resize(currLength + numRead);
+    synchronizeWithStringBuffer();
     return numRead ? 0 : -1;
 }
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (d_isContiguous) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -105,6 +160,7 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
                                              k_MAX_STRING_SIZE - d_valueIter));
 
     d_stringBuffer.resize(d_valueIter + numRead);
+    synchronizeWithStringBuffer();
 
     return numRead;
 }
@@ -112,10 +168,12 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
+        while (d_cursor < d_length
+            && bdlb::CharType::isSpace(d_data_p[d_cursor])) {
+            ++d_cursor;
+        }
+
+        if (d_cursor < d_length) {
             break;
         }
 
@@ -129,25 +187,17 @@ int Tokenizer::skipWhitespace()
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        const void *quote = d_valueIter < d_length
+                            ? bsl::memchr(d_data_p + d_valueIter,
+                                          '"',
+                                          d_length - d_valueIter)
+                            : 0;
 
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
-            }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
-            }
-
-            ++d_valueIter;
-        }
-
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (!quote) {
+            d_valueIter = d_length;
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -177,9 +227,20 @@ int Tokenizer::extractStringValue()
             }
         }
         else {
-            if ('\\' == previousChar) {
+            d_valueIter = static_cast<const char *>(quote) - d_data_p;
+
+            // The quote is escaped if it is preceded by an odd number of
+            // backslashes.  Note that all of the characters of the value
+            // remain in the buffer.
+
+            bsl::size_t numBackslashes = 0;
+            while (d_valueIter - numBackslashes > d_valueBegin
+                && '\\' == d_data_p[d_valueIter - numBackslashes - 1]) {
+                ++numBackslashes;
+            }
+
+            if (numBackslashes % 2) {
                 ++d_valueIter;
-                previousChar = 0;
                 continue;
             }
             d_valueEnd = d_valueIter;
@@ -194,13 +255,12 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
+        while (d_valueIter < d_length
+            && !isValueDelimiter(d_data_p[d_valueIter])) {
             ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_length) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -220,7 +280,11 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
             else {
                 const int rc = expandBufferForLargeValue();
                 if (rc) {
-                    return rc;                                        // RETURN
+                    // The input ended, which, as for a value that did not
+                    // need the buffer to be expanded, terminates the value.
+
+                    d_valueEnd = d_valueIter;
+                    return 0;                                         // RETURN
                 }
             }
         }
@@ -239,7 +303,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_length) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -258,7 +322,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (d_data_p[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -570,14 +634,65 @@ int Tokenizer::advanceToNextToken()
     return 0;
 }
 
+void Tokenizer::reset(bsl::streambuf *streambuf)
+{
+    d_streambuf_p = streambuf;
+    d_stringBuffer.clear();
+    resetState();
+
+    bdlsb::FixedMemInStreamBuf *fixedStreamBuf =
+                       dynamic_cast<bdlsb::FixedMemInStreamBuf *>(streambuf);
+    if (fixedStreamBuf) {
+        // The input is contiguous: tokenize it in place, and consume it from
+        // the 'streambuf' up front, as 'resetStreamBufGetPointer' restores
+        // the position of the first unprocessed character.
+
+        d_inputOffset  = fixedStreamBuf->pubseekoff(0,
+                                                    bsl::ios_base::cur,
+                                                    bsl::ios_base::in);
+        d_data_p       = fixedStreamBuf->data() + d_inputOffset;
+        d_length       = fixedStreamBuf->length();
+        d_isContiguous = true;
+
+        fixedStreamBuf->pubseekoff(0, bsl::ios_base::end, bsl::ios_base::in);
+    }
+    else {
+        d_inputOffset  = 0;
+        d_isContiguous = false;
+        synchronizeWithStringBuffer();
+    }
+}
+
+void Tokenizer::reset(const bslstl::StringRef& input)
+{
+    d_streambuf_p = 0;
+    d_stringBuffer.clear();
+    resetState();
+
+    d_data_p       = input.data();
+    d_length       = input.length();
+    d_inputOffset  = 0;
+    d_isContiguous = true;
+}
+
 int Tokenizer::resetStreamBufGetPointer()
 {
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_isContiguous) {
+        if (!d_streambuf_p) {
+            return -1;                                                // RETURN
+        }
+
+        const bsl::streamoff newPos = d_streambuf_p->pubseekpos(
+                        static_cast<bsl::streamoff>(d_inputOffset + d_cursor),
+                        bsl::ios_base::in);
+        return newPos >= 0 ? 0 : -1;                                  // RETURN
+    }
+
+    if (d_cursor >= d_length) {
         return 0;                                                     // RETURN
     }
 
-    const int numExtraCharsRead = static_cast<int>(d_stringBuffer.size()
-                                                                   - d_cursor);
+    const int numExtraCharsRead = static_cast<int>(d_length - d_cursor);
     const bsl::streamoff newPos = d_streambuf_p->pubseekoff(-numExtraCharsRead,
                                                             bsl::ios_base::cur,
                                                             bsl::ios_base::in);
@@ -590,8 +705,7 @@ int Tokenizer::value(bslstl::StringRef *data) const
 {
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(d_data_p + d_valueBegin, d_data_p + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
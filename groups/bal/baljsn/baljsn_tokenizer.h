@@ -23,6 +23,26 @@ BSLS_IDENT("$Id: $")
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
 //
+///Tokenizing Contiguous Input
+///---------------------------
+// When reading from an arbitrary 'bsl::streambuf', the tokenizer copies the
+// data into an internal buffer, a block at a time, and the values it provides
+// refer to that buffer.  If, however, the JSON data is already held in
+// contiguous memory, the tokenizer can traverse it in place: the 'reset'
+// overload taking a 'bslstl::StringRef' tokenizes the referenced characters
+// directly, and 'reset' taking a 'bsl::streambuf' does the same if the
+// 'streambuf' is a 'bdlsb::FixedMemInStreamBuf' (tokenizing the characters
+// from its current input position to its end).  In either case no data is
+// copied, and the values provided by 'value' refer directly into the input,
+// and therefore remain valid for as long as the input does (rather than only
+// until the next call to 'advanceToNextToken').  Note that the tokenizer never
+// unescapes values; 'baljsn::ParserUtil' does so when converting them.
+//
+// When tokenizing a 'bdlsb::FixedMemInStreamBuf' in place, the input
+// position of the 'streambuf' is moved to its end by 'reset', as if the
+// tokenizer had read all of the data, and 'resetStreamBufGetPointer' moves it
+// back to the character following the last one processed.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -210,6 +230,32 @@ class Tokenizer {
                                                             // (held, not
                                                             // owned)
 
+    const char                          *d_data_p;          // characters
+                                                            // being tokenized:
+                                                            // those of
+                                                            // 'd_stringBuffer'
+                                                            // or, if
+                                                            // tokenizing in
+                                                            // place, the
+                                                            // entire input
+                                                            // (held, not
+                                                            // owned)
+
+    bsl::size_t                          d_length;          // number of
+                                                            // characters at
+                                                            // 'd_data_p'
+
+    bsls::Types::Int64                   d_inputOffset;     // position of
+                                                            // 'd_data_p' in
+                                                            // 'd_streambuf_p'
+                                                            // if
+                                                            // 'd_isContiguous'
+
+    bool                                 d_isContiguous;    // 'true' if
+                                                            // tokenizing
+                                                            // contiguous input
+                                                            // in place
+
     bsl::size_t                          d_cursor;          // current cursor
 
     bsl::size_t                          d_valueBegin;      // cursor for
@@ -239,6 +285,14 @@ class Tokenizer {
                                                             // values
 
     // PRIVATE MANIPULATORS
+    void resetState();
+        // Reset the state of this tokenizer, other than its input and its
+        // options, to that of a newly constructed tokenizer.
+
+    void synchronizeWithStringBuffer();
+        // Set the characters being tokenized to those held in the internal
+        // string buffer, 'd_stringBuffer'.
+
     int extractStringValue();
         // Extract the string value starting at the current data cursor and
         // update the value begin and end pointers to refer to the begin and
@@ -303,15 +357,28 @@ class Tokenizer {
     // MANIPULATORS
     void reset(bsl::streambuf *streambuf);
         // Reset this tokenizer to read data from the specified 'streambuf'.
-        // Note that the reader will not be on a valid node until
+        // If 'streambuf' is a 'bdlsb::FixedMemInStreamBuf', tokenize the
+        // characters from its current input position to its end in place and
+        // move its input position to its end (see {Tokenizing Contiguous
+        // Input}).  Note that the reader will not be on a valid node until
         // 'advanceToNextToken' is called.  Note that this function does not
         // change the value of the 'allowStandAloneValues' option.
 
+    void reset(const bslstl::StringRef& input);
+        // Reset this tokenizer to tokenize, in place, the characters of the
+        // specified 'input', which must remain valid until this tokenizer is
+        // reset or destroyed (see {Tokenizing Contiguous Input}).  Note that
+        // the reader will not be on a valid node until 'advanceToNextToken'
+        // is called.  Also note that 'resetStreamBufGetPointer' fails after
+        // this function is called, as no 'streambuf' is held.  Finally note
+        // that this function does not change the value of the
+        // 'allowStandAloneValues' option.
+
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
-        // non-zero value otherwise.  Note that each call to
-        // 'advanceToNextToken' invalidates the string references returned by
-        // the 'value' accessor for prior nodes.
+        // non-zero value otherwise.  Note that, unless the input is tokenized
+        // in place, each call to 'advanceToNextToken' invalidates the string
+        // references returned by the 'value' accessor for prior nodes.
 
     int resetStreamBufGetPointer();
         // Reset the get pointer of the 'streambuf' held by this object to
@@ -358,7 +425,8 @@ class Tokenizer {
         // Load into the specified 'data' the value of the specified token if
         // the current token's type is 'BAEJSN_ELEMENT_NAME' or
         // 'BAEJSN_ELEMENT_VALUE' or leave 'data' unmodified otherwise.  Return
-        // 0 on success and a non-zero value otherwise.
+        // 0 on success and a non-zero value otherwise.  Note that, if the
+        // input is tokenized in place, 'data' refers into the input.
 };
 
 // ============================================================================
@@ -366,6 +434,13 @@ class Tokenizer {
 // ============================================================================
 
 // PRIVATE MANIPULATORS
+inline
+void Tokenizer::synchronizeWithStringBuffer()
+{
+    d_data_p = d_stringBuffer.data();
+    d_length = d_stringBuffer.length();
+}
+
 inline
 Tokenizer::ContextType Tokenizer::popContext()
 {
@@ -399,6 +474,10 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_stackAllocator(d_stackBuffer.buffer(), k_STACKBUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
 , d_streambuf_p(0)
+, d_data_p(0)
+, d_length(0)
+, d_inputOffset(0)
+, d_isContiguous(false)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -409,6 +488,7 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_allowHeterogenousArrays(true)
 {
     d_stringBuffer.reserve(k_MAX_STRING_SIZE);
+    synchronizeWithStringBuffer();
     d_contextStack.clear();
     pushContext(e_OBJECT_CONTEXT);
 
@@ -420,21 +500,6 @@ Tokenizer::~Tokenizer()
 }
 
 // MANIPULATORS
-inline
-void Tokenizer::reset(bsl::streambuf *streambuf)
-{
-    d_streambuf_p = streambuf;
-    d_stringBuffer.clear();
-    d_cursor      = 0;
-    d_valueBegin  = 0;
-    d_valueEnd    = 0;
-    d_valueIter   = 0;
-    d_tokenType   = e_BEGIN;
-
-    d_contextStack.clear();
-    pushContext(e_OBJECT_CONTEXT);
-}
-
 inline
 void Tokenizer::setAllowStandAloneValues(bool value)
 {
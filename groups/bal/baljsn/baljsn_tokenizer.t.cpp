@@ -17,6 +17,8 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bdlsb_memoutstreambuf.h>            // for testing only
 #include <bdlsb_fixedmemoutstreambuf.h>       // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>        // for testing only
@@ -49,6 +51,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [ 9] void reset(bsl::streambuf &streamBuf);
+// [17] void reset(const bslstl::StringRef& input);
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
@@ -61,7 +64,9 @@ using bsl::endl;
 // [ 3] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [17] USAGE EXAMPLE
+// [17] CONCERN: CONTIGUOUS INPUT IS TOKENIZED IN PLACE
+// [18] USAGE EXAMPLE
+// [-1] PERFORMANCE: STREAMBUF VS. IN-PLACE TOKENIZING
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -175,6 +180,30 @@ void confirmStreamBufReset(bsl::streambuf     *sb,
     }
 }
 
+struct Token {
+    // This 'struct' describes a token produced by a 'baljsn::Tokenizer'.
+
+    Obj::TokenType    d_type;   // type of the token
+    bslstl::StringRef d_value;  // value, if the token has one, or empty
+};
+
+Obj::TokenType tokenizeAll(bsl::vector<Token> *tokens, Obj *tokenizer)
+{
+    // Advance the specified 'tokenizer' until 'advanceToNextToken' fails,
+    // appending each token produced to the specified 'tokens', and return the
+    // token type reported after the final (failed) call.  Note that the values
+    // loaded into 'tokens' refer to memory supplied by 'tokenizer' and, unless
+    // its input is tokenized in place, are invalidated by the next advance.
+
+    while (0 == tokenizer->advanceToNextToken()) {
+        Token token;
+        token.d_type = tokenizer->tokenType();
+        tokenizer->value(&token.d_value);
+        tokens->push_back(token);
+    }
+    return tokenizer->tokenType();
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -196,7 +225,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -318,6 +347,218 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONTIGUOUS INPUT IS TOKENIZED IN PLACE
+        //
+        // Concerns:
+        //: 1 Tokenizing an input in place, whether supplied as a
+        //:   'bslstl::StringRef' or as a 'bdlsb::FixedMemInStreamBuf',
+        //:   produces the same sequence of tokens and values as reading it
+        //:   through an arbitrary 'bsl::streambuf', for valid, invalid, and
+        //:   truncated input, and for values larger than the internal buffer.
+        //:
+        //: 2 Values produced when tokenizing in place refer into the input,
+        //:   and remain valid after subsequent calls to 'advanceToNextToken'.
+        //:
+        //: 3 A 'bdlsb::FixedMemInStreamBuf' is tokenized from its current
+        //:   input position, appears consumed until 'resetStreamBufGetPointer'
+        //:   is called, which then positions it after the last character
+        //:   processed, exactly as for any other 'streambuf'.
+        //:
+        //: 4 'resetStreamBufGetPointer' fails after 'reset' is supplied a
+        //:   'bslstl::StringRef'.
+        //:
+        //: 5 A tokenizer can be reset from one kind of input to another.
+        //
+        // Plan:
+        //: 1 Create a set of JSON documents, including ones having escaped
+        //:   characters, stand-alone values, and string and non-string values
+        //:   larger than the internal buffer, and add every prefix of each of
+        //:   them to the set.
+        //:
+        //: 2 For each input of P-1, tokenize it until 'advanceToNextToken'
+        //:   fails through an 'istringstream', through a
+        //:   'FixedMemInStreamBuf' (preceded by a prefix that is consumed
+        //:   before 'reset'), and as a 'StringRef', using the same tokenizer
+        //:   for all three.  Verify that the token types and values agree, and
+        //:   that the in-place values lie within the input.  (C-1..2, 5)
+        //:
+        //: 3 For the 'istringstream' and the 'FixedMemInStreamBuf', advance
+        //:   as many times as succeeded in P-2, call
+        //:   'resetStreamBufGetPointer', and verify that the characters
+        //:   remaining in the 'streambuf' are the same.  Verify that the
+        //:   'FixedMemInStreamBuf' has no characters available before the
+        //:   call, and that the call fails for a 'StringRef'.  (C-3..4)
+        //
+        // Testing:
+        //   void reset(const bslstl::StringRef& input);
+        //   CONCERN: CONTIGUOUS INPUT IS TOKENIZED IN PLACE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONTIGUOUS INPUT IS TOKENIZED IN PLACE"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        const bsl::string LARGE_STRING(20000, 'a');
+        const bsl::string LARGE_NUMBER(10000, '7');
+
+        bsl::string escapes;
+        for (int i = 0; i < 3000; ++i) {
+            escapes += "\\\"\\\\x";
+        }
+
+        const char *const DOCUMENTS[] = {
+            "{}",
+            WS "{" WS "}" WS,
+            "{\"a\":1,\"b\":[true,false,null],\"c\":{\"d\":\"e\"}}",
+            "{ \"name\" : \"a \\\"quoted\\\" \\\\ value\\\\\" ,"
+                                                        " \"n\" : -1.5e3 }",
+            "{\"a\":[[],{},[{\"b\":[1,\"2\",{}]}]]}  trailing",
+            "[1, 2, 3]",
+            "\"stand alone\"",
+            "{\"a\" 1}",
+            "{\"a\":}",
+            "{,}",
+            "{\"a\":1}}",
+        };
+        const int NUM_DOCUMENTS = sizeof DOCUMENTS / sizeof *DOCUMENTS;
+
+        bsl::vector<bsl::string> inputs;
+        for (int i = 0; i < NUM_DOCUMENTS; ++i) {
+            const bsl::string document(DOCUMENTS[i]);
+            for (bsl::size_t j = 0; j <= document.length(); ++j) {
+                inputs.push_back(document.substr(0, j));
+            }
+        }
+        inputs.push_back("{\"s\":\"" + LARGE_STRING + "\",\"t\":1}");
+        inputs.push_back("{\"n\":" + LARGE_NUMBER + "}");
+        inputs.push_back("{\"e\":\"" + escapes + "\"}");
+        inputs.push_back("{\"s\":\"" + LARGE_STRING);
+        inputs.push_back("[" + LARGE_NUMBER);
+        inputs.push_back(bsl::string(10000, ' ') + "{ \"a\" : 1 }   ");
+
+        const char PREFIX[] = "prefix";
+        const int  PREFIX_LENGTH = sizeof PREFIX - 1;
+
+        Obj mX;
+
+        for (bsl::size_t ti = 0; ti < inputs.size(); ++ti) {
+            const bsl::string& INPUT = inputs[ti];
+
+            if (veryVerbose) {
+                P_(ti) P(INPUT.substr(0, 60))
+            }
+
+            for (int allowStandAlone = 0; allowStandAlone < 2;
+                                                           ++allowStandAlone) {
+                mX.setAllowStandAloneValues(allowStandAlone);
+
+                // Read through an 'istringstream'.  The values are copied, as
+                // they are invalidated by subsequent advances.
+
+                bsl::istringstream iss(INPUT);
+                mX.reset(iss.rdbuf());
+
+                bsl::vector<Token>       expected;
+                bsl::vector<bsl::string> expectedValues;
+                while (0 == mX.advanceToNextToken()) {
+                    Token token;
+                    token.d_type = mX.tokenType();
+                    mX.value(&token.d_value);
+                    expected.push_back(token);
+                    expectedValues.push_back(token.d_value);
+                }
+                const Obj::TokenType EXP_FINAL = mX.tokenType();
+                const int            NUM_VALID = static_cast<int>(
+                                                              expected.size());
+
+                // The position of the 'streambuf' is unspecified after an
+                // error, so compare it after the last successful advance.
+
+                bsl::istringstream iss2(INPUT);
+                mX.reset(iss2.rdbuf());
+                for (int i = 0; i < NUM_VALID; ++i) {
+                    mX.advanceToNextToken();
+                }
+                ASSERTV(ti, 0 == mX.resetStreamBufGetPointer());
+                bsl::string expectedRest;
+                bsl::getline(iss2, expectedRest, '\0');
+
+                // Tokenize a 'FixedMemInStreamBuf' in place, from a non-zero
+                // input position.
+
+                const bsl::string          BUFFER = PREFIX + INPUT;
+                bdlsb::FixedMemInStreamBuf isb(BUFFER.data(), BUFFER.length());
+                for (int i = 0; i < PREFIX_LENGTH; ++i) {
+                    isb.sbumpc();
+                }
+                mX.reset(&isb);
+                ASSERTV(ti, 0 >= isb.in_avail());
+                for (int i = 0; i < NUM_VALID; ++i) {
+                    ASSERTV(ti, i, 0 == mX.advanceToNextToken());
+                }
+                ASSERTV(ti, 0 >= isb.in_avail());
+
+                ASSERTV(ti, 0 == mX.resetStreamBufGetPointer());
+                const bsl::size_t numRest = isb.length();
+                const bsl::string rest(BUFFER.data() + BUFFER.length()
+                                                                     - numRest,
+                                       numRest);
+                ASSERTV(ti, expectedRest, rest, expectedRest == rest);
+
+                isb.pubseekpos(PREFIX_LENGTH);
+                mX.reset(&isb);
+
+                bsl::vector<Token> fromStreamBuf;
+                ASSERTV(ti, EXP_FINAL == tokenizeAll(&fromStreamBuf, &mX));
+
+                // Tokenize a 'StringRef' in place.
+
+                mX.reset(bslstl::StringRef(INPUT));
+
+                bsl::vector<Token> fromStringRef;
+                ASSERTV(ti, EXP_FINAL == tokenizeAll(&fromStringRef, &mX));
+                ASSERTV(ti, 0 != mX.resetStreamBufGetPointer());
+
+                // Compare.  Note that all of the values must still be valid.
+
+                ASSERTV(ti, expected.size(), fromStreamBuf.size(),
+                        expected.size() == fromStreamBuf.size());
+                ASSERTV(ti, expected.size(), fromStringRef.size(),
+                        expected.size() == fromStringRef.size());
+                if (expected.size() != fromStreamBuf.size()
+                 || expected.size() != fromStringRef.size()) {
+                    continue;                                       // CONTINUE
+                }
+
+                for (bsl::size_t i = 0; i < expected.size(); ++i) {
+                    const Token& EXP = expected[i];
+                    const Token& SB  = fromStreamBuf[i];
+                    const Token& SR  = fromStringRef[i];
+
+                    ASSERTV(ti, i, EXP.d_type == SB.d_type);
+                    ASSERTV(ti, i, EXP.d_type == SR.d_type);
+                    ASSERTV(ti, i, expectedValues[i] == SB.d_value);
+                    ASSERTV(ti, i, expectedValues[i] == SR.d_value);
+
+                    if (!SR.d_value.isEmpty()) {
+                        ASSERTV(ti, i,
+                                INPUT.data() <= SR.d_value.data()
+                             && SR.d_value.data() + SR.d_value.length() <=
+                                              INPUT.data() + INPUT.length());
+                        ASSERTV(ti, i,
+                                BUFFER.data() + PREFIX_LENGTH <=
+                                                             SB.d_value.data()
+                             && SB.d_value.data() + SB.d_value.length() <=
+                                              BUFFER.data() + BUFFER.length());
+                    }
+                }
+            }
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // TESTING that arrays of heterogenous types are handled correctly
@@ -6814,6 +7055,78 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: STREAMBUF VS. IN-PLACE TOKENIZING
+        //
+        // Concerns:
+        //: 1 Tokenizing contiguous input in place is faster than reading it
+        //:   through an arbitrary 'streambuf'.
+        //
+        // Plan:
+        //: 1 Build a JSON document of several megabytes, and time tokenizing
+        //:   it through an 'istringstream', a 'FixedMemInStreamBuf', and a
+        //:   'StringRef'.  The number of iterations may be supplied as the
+        //:   second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: STREAMBUF VS. IN-PLACE TOKENIZING
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: STREAMBUF VS. IN-PLACE TOKENIZING" << endl
+             << "==============================================" << endl;
+
+        const int numIterations = argc > 2 ? atoi(argv[2]) : 20;
+
+        bsl::string input = "{\"records\":[";
+        for (int i = 0; i < 20000; ++i) {
+            if (i) {
+                input += ",";
+            }
+            input += "{\"id\":12345678,\"name\":\"Some \\\"quoted\\\" name\","
+                     "\"price\":1234.5678,\"flags\":[true,false,null],"
+                     "\"description\":\"" + bsl::string(100, 'd') + "\"}";
+        }
+        input += "]}";
+
+        const double megabytes = static_cast<double>(input.length())
+                               * numIterations / (1024.0 * 1024.0);
+
+        Obj mX;
+
+        for (int mode = 0; mode < 3; ++mode) {
+            static const char *const NAMES[] = {
+                "istringstream", "FixedMemInStreamBuf", "StringRef"
+            };
+
+            int numTokens = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < numIterations; ++i) {
+                bsl::istringstream         iss(input);
+                bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+                switch (mode) {
+                  case 0: mX.reset(iss.rdbuf());                 break;
+                  case 1: mX.reset(&isb);                        break;
+                  case 2: mX.reset(bslstl::StringRef(input));    break;
+                }
+
+                bslstl::StringRef value;
+                while (0 == mX.advanceToNextToken()) {
+                    mX.value(&value);
+                    ++numTokens;
+                }
+            }
+            timer.stop();
+
+            cout << NAMES[mode] << ": "
+                 << megabytes / timer.elapsedTime() << " MB/s ("
+                 << numTokens / numIterations << " tokens)" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -19,6 +19,8 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bslmt_threadattributes.h>
 
 #include <bsls_assert.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
@@ -34,6 +36,17 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 // thread is restarted, 'shutdownThread' clears the queue in order to simplify
 // the implementation.  Alternative designs are possible, but are not perceived
 // to be worth the added complexity.
+//
+// If batched publication is enabled, the record ring plays the role of the
+// queue, and 'stopThread' appends an end marker to it in place of the 'e_END'
+// record; 'shutdownThread' likewise clears the ring.  'd_recordQueue' is then
+// unused, but, being a member, must still be constructed (with a capacity of
+// 1).
+//
+// 'bdlcc::FixedQueue' provides no timed pop, so the publication thread waits
+// for a batch to fill (for up to 'maxBatchLatency') by polling the ring in
+// short sleeps.  The wait ends as soon as the batch is full, so the polling
+// occurs only when records arrive more slowly than they can be published.
 
 namespace BloombergLP {
 namespace ball {
@@ -42,11 +55,28 @@ namespace {
 
 enum {
     k_DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    k_FORCE_WARN_THRESHOLD     = 5000
+    k_FORCE_WARN_THRESHOLD     = 5000,
+    k_BATCH_POLL_INTERVAL      = 100,  // microseconds between attempts to
+                                       // fill a batch
+    k_SLOT_MESSAGE_CAPACITY    = 256   // initial message capacity of each
+                                       // slot of the record ring
 };
 
 static const char *const k_LOG_CATEGORY = "BALL.ASYNCFILEOBSERVER";
 
+static bool containsEndMarker(const int *slots, int numSlots)
+    // Return 'true' if any of the specified 'numSlots' leading values of the
+    // specified 'slots' array is 'AsyncFileObserver_RecordRing::k_END_MARKER',
+    // and 'false' otherwise.
+{
+    for (int i = 0; i < numSlots; ++i) {
+        if (AsyncFileObserver_RecordRing::k_END_MARKER == slots[i]) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
 static void populateWarnRecord(ball::Record *record,
                                int           lineNumber,
                                int           numDropped)
@@ -63,6 +93,123 @@ static void populateWarnRecord(ball::Record *record,
 
 }  // close unnamed namespace
 
+                    // ----------------------------------
+                    // class AsyncFileObserver_RecordRing
+                    // ----------------------------------
+
+// PUBLIC CONSTANTS
+const int AsyncFileObserver_RecordRing::k_END_MARKER;
+
+// CREATORS
+AsyncFileObserver_RecordRing::AsyncFileObserver_RecordRing(
+                                            int               numSlots,
+                                            bslma::Allocator *basicAllocator)
+: d_slots(basicAllocator)
+, d_freeSlots(numSlots, basicAllocator)
+, d_readySlots(numSlots + 1, basicAllocator)
+{
+    BSLS_ASSERT(0 < numSlots);
+
+    // Reserve, up front, the message storage of each slot, so that copying a
+    // record of typical size into a slot does not allocate.
+
+    d_slots.resize(numSlots);
+    for (int i = 0; i < numSlots; ++i) {
+        d_slots[i].fixedFields().messageStreamBuf().reserveCapacity(
+                                                      k_SLOT_MESSAGE_CAPACITY);
+        d_freeSlots.pushBack(i);
+    }
+}
+
+// MANIPULATORS
+void AsyncFileObserver_RecordRing::pushBack(const Record& record)
+{
+    const int slot = d_freeSlots.popFront();
+    d_slots[slot] = record;
+    d_readySlots.pushBack(slot);
+}
+
+int AsyncFileObserver_RecordRing::tryPushBack(const Record& record)
+{
+    int slot;
+    if (0 != d_freeSlots.tryPopFront(&slot)) {
+        return -1;                                                    // RETURN
+    }
+    d_slots[slot] = record;
+    d_readySlots.pushBack(slot);
+    return 0;
+}
+
+void AsyncFileObserver_RecordRing::pushEndMarker()
+{
+    d_readySlots.pushBack(k_END_MARKER);
+}
+
+int AsyncFileObserver_RecordRing::popFrontUpTo(int *slots, int maxNumSlots)
+{
+    BSLS_ASSERT(slots);
+    BSLS_ASSERT(0 < maxNumSlots);
+
+    return d_readySlots.popFrontUpTo(slots, maxNumSlots);
+}
+
+int AsyncFileObserver_RecordRing::tryPopFrontN(int *slots, int maxNumSlots)
+{
+    BSLS_ASSERT(slots);
+    BSLS_ASSERT(0 < maxNumSlots);
+
+    return d_readySlots.tryPopFrontN(slots, maxNumSlots);
+}
+
+void AsyncFileObserver_RecordRing::release(const int *slots, int numSlots)
+{
+    BSLS_ASSERT(slots || 0 == numSlots);
+    BSLS_ASSERT(0 <= numSlots);
+
+    // Return each run of slot indices between end markers with a single push.
+
+    int begin = 0;
+    while (begin < numSlots) {
+        if (k_END_MARKER == slots[begin]) {
+            ++begin;
+            continue;                                               // CONTINUE
+        }
+        int end = begin + 1;
+        while (end < numSlots && k_END_MARKER != slots[end]) {
+            ++end;
+        }
+        d_freeSlots.pushBackN(slots + begin, end - begin);
+        begin = end;
+    }
+}
+
+void AsyncFileObserver_RecordRing::removeAll()
+{
+    int slot;
+    while (0 == d_readySlots.tryPopFront(&slot)) {
+        release(&slot, 1);
+    }
+}
+
+// ACCESSORS
+int AsyncFileObserver_RecordRing::capacity() const
+{
+    return static_cast<int>(d_slots.size());
+}
+
+int AsyncFileObserver_RecordRing::length() const
+{
+    return d_readySlots.length();
+}
+
+const Record& AsyncFileObserver_RecordRing::record(int slot) const
+{
+    BSLS_ASSERT(0 <= slot);
+    BSLS_ASSERT(slot < capacity());
+
+    return d_slots[slot];
+}
+
                        // -----------------------
                        // class AsyncFileObserver
                        // -----------------------
@@ -79,6 +226,101 @@ void AsyncFileObserver::logDroppedMessageWarning(int numDropped)
     d_fileObserver.publish(d_droppedRecordWarning, context);
 }
 
+void AsyncFileObserver::publishBatchesThreadEntryPoint()
+{
+    BSLS_ASSERT(d_recordRing_mp);
+
+    AsyncFileObserver_RecordRing& ring = *d_recordRing_mp;
+
+    bool done = false;
+    d_droppedRecordWarning.fixedFields().setThreadID(
+                                          bslmt::ThreadUtil::selfIdAsUint64());
+
+    int *const slots = d_batchSlots.data();
+
+    while (!done) {
+        int numSlots = ring.popFrontUpTo(slots, d_maxBatchSize);
+
+        done = containsEndMarker(slots, numSlots);
+
+        // If the batch is not full, wait for up to 'd_maxBatchLatency' for
+        // more records, unless the end marker has already been received.
+
+        if (!done
+         && numSlots < d_maxBatchSize
+         && bsls::TimeInterval() < d_maxBatchLatency) {
+            const bsls::TimeInterval deadline =
+                      bsls::SystemTime::now(bsls::SystemClockType::e_MONOTONIC)
+                    + d_maxBatchLatency;
+
+            while (!done
+                && numSlots < d_maxBatchSize
+                && !d_shuttingDownFlag
+                && bsls::SystemTime::now(bsls::SystemClockType::e_MONOTONIC) <
+                                                                    deadline) {
+                const int numPopped = ring.tryPopFrontN(
+                                                    slots + numSlots,
+                                                    d_maxBatchSize - numSlots);
+                if (0 == numPopped) {
+                    bslmt::ThreadUtil::microSleep(k_BATCH_POLL_INTERVAL);
+                }
+                else {
+                    done = containsEndMarker(slots + numSlots, numPopped);
+                    numSlots += numPopped;
+                }
+            }
+        }
+
+        // Gather the records of the batch.  Records published concurrently
+        // with 'stopThread' may follow the end marker; they are published
+        // with the rest of the batch rather than left in the ring.
+
+        int numRecords = 0;
+        for (int i = 0; i < numSlots; ++i) {
+            if (AsyncFileObserver_RecordRing::k_END_MARKER != slots[i]) {
+                d_batchRecords[numRecords++] = &ring.record(slots[i]);
+            }
+        }
+
+        // Publish the batch only if the observer is not shutting down.
+
+        if (d_shuttingDownFlag) {
+            done = true;
+        }
+        else if (0 < numRecords) {
+            d_fileObserver.publishBatch(d_batchRecords.data(), numRecords);
+        }
+
+        ring.release(slots, numSlots);
+
+        publishDroppedRecordCountIfNecessary();
+    }
+}
+
+void AsyncFileObserver::publishDroppedRecordCountIfNecessary()
+{
+    // Publish the count of dropped records.  To avoid repeatedly publishing
+    // this information when the record queue is full, we publish the number of
+    // dropped records only when the queue becomes half empty or when a
+    // sufficient number of records have been dropped.  Finally, we publish the
+    // dropped record count if the observer is shutting down, so the
+    // information is not lost.
+
+    if (0 < d_dropCount.loadRelaxed()) {
+        const int capacity = d_recordRing_mp ? d_recordRing_mp->capacity()
+                                             : d_recordQueue.size();
+
+        if (recordQueueLength() <= capacity / 2
+        ||  d_dropCount.loadRelaxed() >= k_FORCE_WARN_THRESHOLD
+        ||  d_shuttingDownFlag) {
+            int numDropped = d_dropCount.swap(0);
+            BSLS_ASSERT(0 < numDropped); // No other thread should have
+                                         // cleared the count.
+            logDroppedMessageWarning(numDropped);
+        }
+    }
+}
+
 void AsyncFileObserver::publishThreadEntryPoint()
 {
     bool done = false;
@@ -100,23 +342,17 @@ void AsyncFileObserver::publishThreadEntryPoint()
                                    asyncRecord.d_context);
         }
 
-        // Publish the count of dropped records.  To avoid repeatedly
-        // publishing this information when the record queue is full, we
-        // publish the number of dropped records only when the queue becomes
-        // half empty or when a sufficient number of records have been dropped.
-        // Finally, we publish the dropped record count if the observer is
-        // shutting down, so the information is not lost.
-
-        if (0 < d_dropCount.loadRelaxed()) {
-            if (d_recordQueue.length() <= d_recordQueue.size() / 2
-            ||  d_dropCount.loadRelaxed() >= k_FORCE_WARN_THRESHOLD
-            ||  d_shuttingDownFlag) {
-                int numDropped = d_dropCount.swap(0);
-                BSLS_ASSERT(0 < numDropped); // No other thread should have
-                                             // cleared the count.
-                logDroppedMessageWarning(numDropped);
-            }
-        }
+        publishDroppedRecordCountIfNecessary();
+    }
+}
+
+void AsyncFileObserver::removeAllRecords()
+{
+    if (d_recordRing_mp) {
+        d_recordRing_mp->removeAll();
+    }
+    else {
+        d_recordQueue.removeAll();
     }
 }
 
@@ -134,17 +370,22 @@ int AsyncFileObserver::startThread()
 int AsyncFileObserver::stopThread()
 {
     if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
-        // Push an empty record with 'e_END' set in context.
+        if (d_recordRing_mp) {
+            d_recordRing_mp->pushEndMarker();
+        }
+        else {
+            // Push an empty record with 'e_END' set in context.
 
-        AsyncFileObserver_Record asyncRecord;
-        bsl::shared_ptr<const Record> record(
+            AsyncFileObserver_Record asyncRecord;
+            bsl::shared_ptr<const Record> record(
                                     new (*d_allocator_p) Record(d_allocator_p),
                                     d_allocator_p);
 
-        Context context(Transmission::e_END, 0, 1);
-        asyncRecord.d_record  = record;
-        asyncRecord.d_context = context;
-        d_recordQueue.pushBack(asyncRecord);
+            Context context(Transmission::e_END, 0, 1);
+            asyncRecord.d_record  = record;
+            asyncRecord.d_context = context;
+            d_recordQueue.pushBack(asyncRecord);
+        }
 
         int ret = bslmt::ThreadUtil::join(d_threadHandle);
         d_threadHandle = bslmt::ThreadUtil::invalidHandle();
@@ -166,7 +407,7 @@ int AsyncFileObserver::shutdownThread()
     // We clear the queue to remove the bogus log record appended by
     // 'stopThread'.
 
-    d_recordQueue.removeAll();
+    removeAllRecords();
     d_shuttingDownFlag = 0;
     return ret;
 }
@@ -177,11 +418,14 @@ void AsyncFileObserver::construct()
     d_shuttingDownFlag = 0;
     d_dropCount        = 0;
 
+    void (AsyncFileObserver::*entryPoint)() = d_recordRing_mp
+                       ? &AsyncFileObserver::publishBatchesThreadEntryPoint
+                       : &AsyncFileObserver::publishThreadEntryPoint;
+
     d_publishThreadEntryPoint = bsl::function<void()>(
-            bsl::allocator_arg_t(),
-            bsl::allocator<bsl::function<void()> >(d_allocator_p),
-            bdlf::MemFnUtil::memFn(&AsyncFileObserver::publishThreadEntryPoint,
-                                   this));
+                      bsl::allocator_arg_t(),
+                      bsl::allocator<bsl::function<void()> >(d_allocator_p),
+                      bdlf::MemFnUtil::memFn(entryPoint, this));
     d_droppedRecordWarning.fixedFields().setFileName(__FILE__);
     d_droppedRecordWarning.fixedFields().setCategory(k_LOG_CATEGORY);
     d_droppedRecordWarning.fixedFields().setSeverity(Severity::e_WARN);
@@ -193,6 +437,9 @@ void AsyncFileObserver::construct()
 AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 : d_fileObserver(Severity::e_WARN, basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_maxBatchSize(0)
+, d_batchSlots(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -205,6 +452,9 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_maxBatchSize(0)
+, d_batchSlots(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -218,6 +468,9 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_maxBatchSize(0)
+, d_batchSlots(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -232,6 +485,9 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
+, d_maxBatchSize(0)
+, d_batchSlots(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -248,6 +504,9 @@ AsyncFileObserver::AsyncFileObserver(
                              bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
+, d_maxBatchSize(0)
+, d_batchSlots(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
 , d_droppedRecordWarning(basicAllocator)
@@ -256,6 +515,36 @@ AsyncFileObserver::AsyncFileObserver(
     construct();
 }
 
+AsyncFileObserver::AsyncFileObserver(
+                Severity::Level            stdoutThreshold,
+                bool                       publishInLocalTime,
+                int                        maxRecordQueueSize,
+                Severity::Level            dropRecordsOnFullQueueThreshold,
+                int                        maxBatchSize,
+                const bsls::TimeInterval&  maxBatchLatency,
+                bslma::Allocator          *basicAllocator)
+: d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
+, d_recordQueue(1, basicAllocator)
+, d_maxBatchSize(maxBatchSize)
+, d_maxBatchLatency(maxBatchLatency)
+, d_batchSlots(maxBatchSize, 0, basicAllocator)
+, d_batchRecords(maxBatchSize, 0, basicAllocator)
+, d_shuttingDownFlag(0)
+, d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_droppedRecordWarning(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < maxRecordQueueSize);
+    BSLS_ASSERT(0 < maxBatchSize);
+    BSLS_ASSERT(bsls::TimeInterval() <= maxBatchLatency);
+
+    d_recordRing_mp.load(new (*d_allocator_p) AsyncFileObserver_RecordRing(
+                                                            maxRecordQueueSize,
+                                                            d_allocator_p),
+                         d_allocator_p);
+    construct();
+}
+
 AsyncFileObserver::~AsyncFileObserver()
 {
     stopPublicationThread();
@@ -267,6 +556,19 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
 {
     BSLS_ASSERT(record);
 
+    if (d_recordRing_mp) {
+        if (record->fixedFields().severity() >
+                                           d_dropRecordsOnFullQueueThreshold) {
+            if (0 != d_recordRing_mp->tryPushBack(*record)) {
+                d_dropCount.addRelaxed(1);
+            }
+        }
+        else {
+            d_recordRing_mp->pushBack(*record);
+        }
+        return;                                                       // RETURN
+    }
+
     AsyncFileObserver_Record asyncRecord;
 
     asyncRecord.d_record  = record;
@@ -290,7 +592,7 @@ void AsyncFileObserver::releaseRecords()
         startThread();
     }
     else {
-        d_recordQueue.removeAll();
+        removeAllRecords();
     }
 }
 
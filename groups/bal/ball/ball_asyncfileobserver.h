@@ -17,6 +17,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  ball::AsyncFileObserver: observer that outputs logs to a file and 'stdout'
+//  ball::AsyncFileObserver_RecordRing: preallocated records for batching
 //
 //@SEE_ALSO: ball_record, ball_context, ball_observer, ball_fileobserver
 //
@@ -58,6 +59,9 @@ BSLS_IDENT("$Id: $")
 //                         |              isPublicationThreadRunning
 //                         |              isPublishInLocalTimeEnabled
 //                         |              isStdoutLoggingPrefixEnabled
+//                         |              isBatchedPublicationEnabled
+//                         |              maxBatchLatency
+//                         |              maxBatchSize
 //                         |              recordQueueLength
 //                         |              rotationLifetime
 //                         |              rotationSize
@@ -97,6 +101,9 @@ BSLS_IDENT("$Id: $")
 // | Log Record Queue      | maxRecordQueueSize              |
 // |                       | dropRecordsOnFullQueueThreshold |
 // +-----------------------+---------------------------------+
+// | Batched Publication   | maxBatchSize                    |
+// |                       | maxBatchLatency                 |
+// +-----------------------+---------------------------------+
 //
 // +-------------+-----------------------------+------------------------------+
 // | Aspect      | Manipulators                | Accessors                    |
@@ -125,6 +132,10 @@ BSLS_IDENT("$Id: $")
 // | Thread      | stopPublicationThread       |                              |
 // | Management  | shutdownPublicationThread   |                              |
 // +-------------+-----------------------------+------------------------------+
+// | Batched     |                             | isBatchedPublicationEnabled  |
+// | Publication |                             | maxBatchSize                 |
+// |             |                             | maxBatchLatency              |
+// +-------------+-----------------------------+------------------------------+
 //..
 // In general, a 'ball::AsyncFileObserver' object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -164,6 +175,39 @@ BSLS_IDENT("$Id: $")
 // record count is reset to 0 after each such warning is published, so each
 // dropped record is counted only once.
 //
+///Batched Publication
+///-------------------
+// By default, the queue holds, for each record, a shared pointer to the record
+// supplied to 'publish', and the publication thread formats and writes each
+// record individually.  Under heavy load, the reference counting of the
+// shared pointers, and the system call made for each record, can limit the
+// rate at which records are published.  An async file observer constructed
+// with a 'maxBatchSize' (and 'maxBatchLatency') instead publishes records in
+// *batches*:
+//
+//: o The queue consists of 'maxRecordQueueSize' records, preallocated on
+//:   construction, into which 'publish' *copies* each record it receives, so
+//:   that no shared pointer is retained.  The storage of each queued record is
+//:   reused, so that (once each has held a record of typical size) copying a
+//:   record does not allocate memory.
+//:
+//: o The publication thread removes up to 'maxBatchSize' records at a time
+//:   from the queue.  If fewer records are available, it waits for up to
+//:   'maxBatchLatency' for more to arrive before publishing the batch.
+//:
+//: o The records of a batch are formatted into a single buffer that is
+//:   written to the log file with a single system call, and those that are to
+//:   be logged to 'stdout' are written there with a single 'fwrite' (see
+//:   'ball::FileObserver::publishBatch').  Note that the log file rotation
+//:   rules are evaluated once per batch (see {Log File Rotation}).
+//
+// Dropping and blocking on a full queue, as well as the periodic warning of
+// dropped records, are unaffected (see {Log Record Queue}).  Note that
+// 'maxBatchLatency' bounds the *additional* delay imposed on a record by
+// batching: a zero latency publishes whatever records are available as soon
+// as the publication thread is ready, which still forms large batches under
+// heavy load.
+//
 ///Log Record Formatting
 ///---------------------
 // By default, the output format of published log records (whether to 'stdout'
@@ -477,16 +521,19 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_datetimeinterval.h>
 
 #include <bslma_allocator.h>
+#include <bslma_managedptr.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bslmt_threadutil.h>
 
 #include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ball {
@@ -504,6 +551,105 @@ struct AsyncFileObserver_Record {
     Context                       d_context;  // context of log record
 };
 
+                     // ==================================
+                     // class AsyncFileObserver_RecordRing
+                     // ==================================
+
+class AsyncFileObserver_RecordRing {
+    // PRIVATE CLASS.  For use by the 'ball::AsyncFileObserver' implementation
+    // only.  This mechanism provides a fixed number of preallocated records
+    // ("slots") into which published records are copied, and a queue of the
+    // indices of the slots holding records awaiting publication.  A slot is
+    // acquired and filled by 'pushBack' or 'tryPushBack', removed from the
+    // queue (together with the following slots) by 'popFrontUpTo' or
+    // 'tryPopFrontN', and made available for reuse by 'release'.  The storage
+    // of each slot is retained across uses.  This class is thread-safe.
+
+    // DATA
+    bsl::vector<Record>    d_slots;       // preallocated records
+
+    bdlcc::FixedQueue<int> d_freeSlots;   // indices of unused slots
+
+    bdlcc::FixedQueue<int> d_readySlots;  // indices of slots awaiting
+                                          // publication, in order, and end
+                                          // markers
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncFileObserver_RecordRing(const AsyncFileObserver_RecordRing&);
+    AsyncFileObserver_RecordRing& operator=(
+                                          const AsyncFileObserver_RecordRing&);
+
+  public:
+    // PUBLIC CONSTANTS
+    static const int k_END_MARKER = -1;
+        // Value queued by 'pushEndMarker' in place of the index of a slot.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncFileObserver_RecordRing,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AsyncFileObserver_RecordRing(
+                                       int               numSlots,
+                                       bslma::Allocator *basicAllocator = 0);
+        // Create a record ring having the specified 'numSlots' preallocated
+        // records, all of them free.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless '0 < numSlots'.
+
+    // MANIPULATORS
+    void pushBack(const Record& record);
+        // Copy the specified 'record' into a free slot, blocking until one is
+        // available, and append the index of that slot to the queue.
+
+    int tryPushBack(const Record& record);
+        // Copy the specified 'record' into a free slot, if one is available,
+        // and append the index of that slot to the queue.  Return 0 on
+        // success, and a non-zero value, with no effect, if no slot is free.
+
+    void pushEndMarker();
+        // Append 'k_END_MARKER' to the queue.
+
+    int popFrontUpTo(int *slots, int maxNumSlots);
+        // Remove up to the specified 'maxNumSlots' values (slot indices or
+        // end markers) from the front of the queue, blocking until at least
+        // one is available, and load them, in order, into the specified
+        // 'slots' array.  Return the number of values removed.  The behavior
+        // is undefined unless '0 < maxNumSlots'.
+
+    int tryPopFrontN(int *slots, int maxNumSlots);
+        // Remove up to the specified 'maxNumSlots' values (slot indices or
+        // end markers) from the front of the queue without blocking, and load
+        // them, in order, into the specified 'slots' array.  Return the
+        // number of values removed, which is 0 if the queue is empty.  The
+        // behavior is undefined unless '0 < maxNumSlots'.
+
+    void release(const int *slots, int numSlots);
+        // Make the slots whose indices are among the specified 'numSlots'
+        // leading values of the specified 'slots' array available for reuse,
+        // ignoring any end marker among those values.  The behavior is
+        // undefined unless each slot was removed from the queue, and not
+        // released since.
+
+    void removeAll();
+        // Remove all values from the queue, releasing the slots they refer
+        // to.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the number of slots of this record ring.
+
+    int length() const;
+        // Return the number of values in the queue.
+
+    const Record& record(int slot) const;
+        // Return a reference providing non-modifiable access to the record
+        // held by the slot having the specified 'slot' index.  The behavior
+        // is undefined unless '0 <= slot < capacity()'.
+};
+
                           // =======================
                           // class AsyncFileObserver
                           // =======================
@@ -528,6 +674,33 @@ class AsyncFileObserver : public Observer {
                                    d_recordQueue;    // fixed-size queue of
                                                      // records processed by
                                                      // the publication thread
+                                                     // (unused, with minimal
+                                                     // capacity, if batched)
+
+    bslma::ManagedPtr<AsyncFileObserver_RecordRing>
+                                   d_recordRing_mp;  // ring of preallocated
+                                                     // records used instead of
+                                                     // 'd_recordQueue' if
+                                                     // batched, and null
+                                                     // otherwise
+
+    int                            d_maxBatchSize;   // maximum number of
+                                                     // records per batch, or 0
+                                                     // if not batched
+
+    bsls::TimeInterval             d_maxBatchLatency;
+                                                     // maximum time to wait
+                                                     // for a batch to fill
+
+    bsl::vector<int>               d_batchSlots;     // slots of the batch
+                                                     // being published (used
+                                                     // by the publication
+                                                     // thread)
+
+    bsl::vector<const Record *>    d_batchRecords;   // records of the batch
+                                                     // being published (used
+                                                     // by the publication
+                                                     // thread)
 
     bsls::AtomicInt                d_shuttingDownFlag;
                                                      // flag that indicates the
@@ -578,12 +751,31 @@ class AsyncFileObserver : public Observer {
         // is undefined if this method is invoked concurrently from multiple
         // threads, i.e., it is *not* thread-safe.
 
+    void publishBatchesThreadEntryPoint();
+        // Publish batches of records from the record ring, to the log file and
+        // 'stdout', until signaled to stop.  The behavior is undefined if this
+        // method is invoked concurrently from multiple threads, i.e., it is
+        // *not* thread-safe.  Note that this function is the entry point for
+        // the publication thread if batched publication is enabled.
+
+    void publishDroppedRecordCountIfNecessary();
+        // Publish the number of records dropped since it was last published,
+        // if any were dropped, and either the record queue is at most half
+        // full, the number is large, or the observer is shutting down.  The
+        // behavior is undefined if this method is invoked concurrently from
+        // multiple threads, i.e., it is *not* thread-safe.
+
     void publishThreadEntryPoint();
         // Publish records from the record queue, to the log file and 'stdout',
         // until signaled to stop.  The behavior is undefined if this method is
         // invoked concurrently from multiple threads, i.e., it is *not*
         // thread-safe.  Note that this function is the entry point for the
-        // publication thread.
+        // publication thread unless batched publication is enabled.
+
+    void removeAllRecords();
+        // Remove all records from the record queue (or, if batched, the record
+        // ring).  Note that this operation is not atomic with respect to
+        // concurrent calls to 'publish'.
 
     int shutdownThread();
         // Stop the publication thread and discard all currently queued log
@@ -695,6 +887,38 @@ class AsyncFileObserver : public Observer {
         // used.  Note that independent default record formats are in effect
         // for 'stdout' and file logging (see 'setLogFormat').
 
+    AsyncFileObserver(
+                 Severity::Level            stdoutThreshold,
+                 bool                       publishInLocalTime,
+                 int                        maxRecordQueueSize,
+                 Severity::Level            dropRecordsOnFullQueueThreshold,
+                 int                        maxBatchSize,
+                 const bsls::TimeInterval&  maxBatchLatency,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an async file observer that asynchronously publishes log
+        // records, in batches, to 'stdout' if their severity is at least as
+        // severe as the specified 'stdoutThreshold' level, and has file
+        // logging initially disabled.  The timestamp attribute of published
+        // records is written in local time if the specified
+        // 'publishInLocalTime' flag is 'true', and in UTC time otherwise.
+        // Records received by the 'publish' method are copied into one of the
+        // specified 'maxRecordQueueSize' records preallocated by this object,
+        // and published later by an independent publication thread, which
+        // removes up to the specified 'maxBatchSize' records at a time from
+        // the queue, waiting for up to the specified 'maxBatchLatency' for
+        // additional records if fewer are available, and writes them with a
+        // single system call (see {Batched Publication}).  Records received
+        // when the queue is full whose severity is below the specified
+        // 'dropRecordsOnFullQueueThreshold' are discarded; other records
+        // block the calling thread until space is available (see {Log Record
+        // Queue}).  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < maxRecordQueueSize', '0 < maxBatchSize', and
+        // 'bsls::TimeInterval() <= maxBatchLatency'.  Note that independent
+        // default record formats are in effect for 'stdout' and file logging
+        // (see 'setLogFormat').
+
     ~AsyncFileObserver();
         // Publish all records that were on the record queue upon entry if a
         // publication thread is running, stop the publication thread (if any),
@@ -909,6 +1133,10 @@ class AsyncFileObserver : public Observer {
         // Record Formatting} for details on the syntax of format
         // specifications.
 
+    bool isBatchedPublicationEnabled() const;
+        // Return 'true' if this async file observer publishes records in
+        // batches, and 'false' otherwise (see {Batched Publication}).
+
     bool isFileLoggingEnabled() const;
     bool isFileLoggingEnabled(bsl::string *result) const;
         // Return 'true' if file logging is enabled for this async file
@@ -955,6 +1183,16 @@ class AsyncFileObserver : public Observer {
         // !DEPRECATED!: Use 'bdlt::LocalTimeOffset' instead.
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+    bsls::TimeInterval maxBatchLatency() const;
+        // Return the maximum time for which the publication thread of this
+        // async file observer waits for additional records to fill a batch,
+        // or a zero time interval if batched publication is not enabled.
+
+    int maxBatchSize() const;
+        // Return the maximum number of records published by this async file
+        // observer in a single batch, or 0 if batched publication is not
+        // enabled.
+
     int recordQueueLength() const;
         // Return the number of log records currently on the record queue of
         // this async file observer.
@@ -1088,6 +1326,12 @@ void AsyncFileObserver::getLogFormat(const char **logFileFormat,
     d_fileObserver.getLogFormat(logFileFormat, stdoutFormat);
 }
 
+inline
+bool AsyncFileObserver::isBatchedPublicationEnabled() const
+{
+    return 0 != d_maxBatchSize;
+}
+
 inline
 bool AsyncFileObserver::isFileLoggingEnabled() const
 {
@@ -1132,10 +1376,23 @@ bdlt::DatetimeInterval AsyncFileObserver::localTimeOffset() const
 }
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+inline
+bsls::TimeInterval AsyncFileObserver::maxBatchLatency() const
+{
+    return d_maxBatchLatency;
+}
+
+inline
+int AsyncFileObserver::maxBatchSize() const
+{
+    return d_maxBatchSize;
+}
+
 inline
 int AsyncFileObserver::recordQueueLength() const
 {
-    return d_recordQueue.length();
+    return d_recordRing_mp ? d_recordRing_mp->length()
+                           : d_recordQueue.length();
 }
 
 inline
@@ -6,6 +6,8 @@
 #include <ball_loggermanagerconfiguration.h>
 #include <ball_streamobserver.h>
 
+#include <bdlf_bind.h>
+
 #include <bdls_filesystemutil.h>
 #include <bdls_pathutil.h>
 #include <bdls_processutil.h>
@@ -25,9 +27,12 @@
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
 
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
@@ -84,6 +89,7 @@ using bsl::flush;
 // [ X] AsyncFileObserver(ball::Severity::Level, bool, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity::Level, bool, int, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity, bool, int, Severity, Allocator *);
+// [12] AsyncFileObserver(Sev, bool, int, Sev, int, TimeInterval, Alloc*);
 // [ 2] ~AsyncFileObserver();
 //
 // MANIPULATORS
@@ -112,23 +118,27 @@ using bsl::flush;
 //
 // ACCESSORS
 // [ 1] void getLogFormat(const char** logF, const char** stdoutF) const;
+// [12] bool isBatchedPublicationEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
 // [ 3] bool isPublicationThreadRunning() const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
 // [ 1] bool isUserFieldsLoggingEnabled() const;
+// [12] bsls::TimeInterval maxBatchLatency() const;
+// [12] int maxBatchSize() const;
 // [11] int recordQueueLength() const;
 // [ 6] bdlt::DatetimeInterval rotationLifetime() const;
 // [ 6] int rotationSize() const;
 // [ 1] ball::Severity::Level stdoutThreshold() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [12] CONCERN: BATCHED PUBLICATION
 // [10] CONCERN: CONCURRENT PUBLICATION
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -441,6 +451,19 @@ void waitEmptyRecordQueue(
     bslmt::ThreadUtil::microSleep(1000, 0);
 }
 
+void publishRecords(ball::AsyncFileObserver             *observer,
+                    bsl::shared_ptr<const ball::Record>  record,
+                    int                                  numRecords)
+    // Publish the specified 'record' the specified 'numRecords' times to the
+    // specified 'observer'.
+{
+    ball::Context context;
+
+    for (int i = 0; i < numRecords; ++i) {
+        observer->publish(record, context);
+    }
+}
+
 class LogRotationCallbackTester {
     // This class can be used as a functor matching the signature of
     // 'ball::FileObserver2::OnFileRotationCallback'.  This class records every
@@ -623,7 +646,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -775,6 +798,449 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING BATCHED PUBLICATION
+        //
+        // Concerns:
+        //:  1 An async file observer constructed with a maximum batch size
+        //:    reports that batched publication is enabled, and returns the
+        //:    maximum batch size and latency it was constructed with; other
+        //:    async file observers report that it is disabled.
+        //:
+        //:  2 Records are copied on 'publish', so that modifying the
+        //:    published record afterwards does not affect the logged record.
+        //:
+        //:  3 Records are written to the log file in the order published,
+        //:    each exactly once, whether or not they fill a batch.
+        //:
+        //:  4 A batch that is not full is published once the maximum latency
+        //:    has elapsed.
+        //:
+        //:  5 Records whose severity is below the drop threshold are dropped
+        //:    when the queue is full, and the number of dropped records is
+        //:    published; other records are never dropped.
+        //:
+        //:  6 Once the queue has held records of a given size, 'publish' does
+        //:    not allocate memory.
+        //:
+        //:  7 'shutdownPublicationThread' and 'releaseRecords' discard queued
+        //:    records, and the publication thread may be stopped and
+        //:    restarted.
+        //:
+        //:  8 'recordQueueLength' returns the number of queued records.
+        //
+        // Plan:
+        //:  1 Create async file observers with and without batching, and
+        //:    verify the batching accessors.  (C-1)
+        //:
+        //:  2 Publish a sequence of records, each having a distinct message,
+        //:    reusing (and modifying) a single record object, before and
+        //:    after starting the publication thread, using a log format that
+        //:    writes only the message, and verify the contents of the log
+        //:    file.  (C-2..3, 8)
+        //:
+        //:  3 With a long maximum latency and a large maximum batch size,
+        //:    publish a single record and verify that it is written to the
+        //:    log file.  (C-4)
+        //:
+        //:  4 Publish more records than the queue can hold, without a
+        //:    publication thread, using a drop threshold that discards them,
+        //:    and verify the queue length, the drop warning, and the records
+        //:    written.  Repeat with blocking records published by several
+        //:    threads, and verify that no record is lost.  (C-5)
+        //:
+        //:  5 Fill the queue, remove the records, and verify that refilling
+        //:    the queue does not allocate from the object allocator.  (C-6)
+        //:
+        //:  6 Queue records and shut down, or release, the records, verify
+        //:    that the queue is empty and nothing was written, then stop and
+        //:    restart the publication thread between publications.  (C-7)
+        //
+        // Testing:
+        //   AsyncFileObserver(Sev, bool, int, Sev, int, TimeInterval, Alloc*);
+        //   bool isBatchedPublicationEnabled() const;
+        //   bsls::TimeInterval maxBatchLatency() const;
+        //   int maxBatchSize() const;
+        //   CONCERN: BATCHED PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BATCHED PUBLICATION"
+                          << "\n===========================" << endl;
+
+        const ball::Severity::Level ERROR = ball::Severity::e_ERROR;
+        const ball::Severity::Level FATAL = ball::Severity::e_FATAL;
+        const ball::Severity::Level OFF   = ball::Severity::e_OFF;
+        const ball::Severity::Level TRACE = ball::Severity::e_TRACE;
+
+        ball::Context context;
+
+        if (veryVerbose) cout << "\tTesting batching accessors." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(FATAL, false, 64, TRACE, 8, bsls::TimeInterval(0.5), &ta);
+            const Obj& X = mX;
+
+            ASSERT(true                    == X.isBatchedPublicationEnabled());
+            ASSERT(8                       == X.maxBatchSize());
+            ASSERT(bsls::TimeInterval(0.5) == X.maxBatchLatency());
+            ASSERT(0                       == X.recordQueueLength());
+            ASSERT(false                   == X.isPublicationThreadRunning());
+
+            Obj mY(FATAL, false, 64, TRACE, &ta);  const Obj& Y = mY;
+
+            ASSERT(false                == Y.isBatchedPublicationEnabled());
+            ASSERT(0                    == Y.maxBatchSize());
+            ASSERT(bsls::TimeInterval() == Y.maxBatchLatency());
+        }
+
+        if (veryVerbose) cout << "\tTesting record order and content." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_QUEUE_SIZE = 100, k_BATCH_SIZE = 7, k_NUM_RECORDS = 500 };
+
+            Obj        mX(FATAL,
+                          false,
+                          k_QUEUE_SIZE,
+                          TRACE,
+                          k_BATCH_SIZE,
+                          bsls::TimeInterval(0, 1000000),
+                          &ta);
+            const Obj& X = mX;
+
+            mX.setLogFormat("%m\n", "%m\n");
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ERROR);
+
+            bsl::string expected;
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                if (k_QUEUE_SIZE / 2 == i) {
+                    ASSERTV(X.recordQueueLength(),
+                            k_QUEUE_SIZE / 2 == X.recordQueueLength());
+
+                    ASSERT(0 == mX.startPublicationThread());
+                }
+
+                bsl::ostringstream oss;
+                oss << "record " << i;
+                record->fixedFields().setMessage(oss.str().c_str());
+
+                mX.publish(record, context);
+
+                expected += oss.str();
+                expected += '\n';
+            }
+
+            // The observer holds a copy of each record.
+
+            record->fixedFields().setMessage("modified");
+
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(0 == X.recordQueueLength());
+
+            mX.disableFileLogging();
+
+            ASSERTV(expected, readPartialFile(fileName, 0),
+                    expected == readPartialFile(fileName, 0));
+        }
+
+        if (veryVerbose) cout << "\tTesting maximum batch latency." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            bsl::shared_ptr<Obj> mX(new (ta) Obj(FATAL,
+                                                 false,
+                                                 1000,
+                                                 TRACE,
+                                                 1000,
+                                                 bsls::TimeInterval(0.05),
+                                                 &ta),
+                                    &ta);
+
+            mX->setLogFormat("%m\n", "%m\n");
+            ASSERT(0 == mX->enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX->startPublicationThread());
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ERROR);
+            record->fixedFields().setMessage("single");
+
+            mX->publish(record, context);
+
+            waitEmptyRecordQueue(mX);
+
+            // Allow (up to 5 seconds) for the record to be written.
+
+            bsls::Stopwatch timer;
+            timer.start();
+            while (0 == FsUtil::getFileSize(fileName)
+                && timer.elapsedTime() < 5) {
+                bslmt::ThreadUtil::microSleep(1000, 0);
+            }
+
+            ASSERTV(readPartialFile(fileName, 0),
+                    "single\n" == readPartialFile(fileName, 0));
+
+            ASSERT(0 == mX->shutdownPublicationThread());
+            mX->disableFileLogging();
+        }
+
+        if (veryVerbose) cout << "\tTesting dropping records." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_QUEUE_SIZE = 10, k_NUM_RECORDS = 25 };
+
+            // Records of any severity are dropped on a full queue.
+
+            Obj        mX(FATAL,
+                          false,
+                          k_QUEUE_SIZE,
+                          OFF,
+                          4,
+                          bsls::TimeInterval(),
+                          &ta);
+            const Obj& X = mX;
+
+            mX.setLogFormat("%m\n", "%m\n");
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ERROR);
+            record->fixedFields().setMessage("kept");
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERTV(X.recordQueueLength(),
+                    k_QUEUE_SIZE == X.recordQueueLength());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(0 == X.recordQueueLength());
+
+            mX.disableFileLogging();
+
+            // Every slot was returned after publication, so that the queue
+            // can again hold 'k_QUEUE_SIZE' records.
+
+            for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERTV(X.recordQueueLength(),
+                    k_QUEUE_SIZE == X.recordQueueLength());
+
+            mX.releaseRecords();
+
+            // Note that the warning is published once the queue is at most
+            // half full, and so may precede some of the queued records.
+
+            const bsl::string content = readPartialFile(fileName, 0);
+
+            int                    numKept = 0;
+            bsl::string::size_type pos     = 0;
+            while (bsl::string::npos != (pos = content.find("kept\n", pos))) {
+                ++numKept;
+                ++pos;
+            }
+
+            ASSERTV(content, numKept, k_QUEUE_SIZE == numKept);
+            ASSERTV(content,
+                    bsl::string::npos != content.find(
+                                                    "Dropped 15 log records"));
+        }
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 2000 };
+
+            // No record is dropped, as the drop threshold is 'e_TRACE'.
+
+            bsl::shared_ptr<Obj> mX(new (ta) Obj(FATAL,
+                                                 false,
+                                                 8,
+                                                 TRACE,
+                                                 3,
+                                                 bsls::TimeInterval(0.001),
+                                                 &ta),
+                                    &ta);
+
+            ASSERT(0 == mX->enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX->startPublicationThread());
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ERROR);
+            record->fixedFields().setMessage("blocking");
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                &handles[t],
+                                bdlf::BindUtil::bind(&publishRecords,
+                                                     mX.get(),
+                                                     record,
+                                                     k_NUM_RECORDS)));
+            }
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[t]));
+            }
+
+            ASSERT(0 == mX->stopPublicationThread());
+            mX->disableFileLogging();
+
+            ASSERTV(countLoggedRecords(fileName),
+                    k_NUM_THREADS * k_NUM_RECORDS ==
+                                                 countLoggedRecords(fileName));
+        }
+
+        if (veryVerbose) cout << "\tTesting allocation-free 'publish'."
+                              << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_QUEUE_SIZE = 16 };
+
+            Obj        mX(FATAL,
+                          false,
+                          k_QUEUE_SIZE,
+                          TRACE,
+                          4,
+                          bsls::TimeInterval(),
+                          &ta);
+            const Obj& X = mX;
+
+            bslma::TestAllocator         sa(veryVeryVeryVerbose);
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&sa, &sa);
+            record->fixedFields().setSeverity(ERROR);
+            record->fixedFields().setCategory("CATEGORY");
+            record->fixedFields().setFileName("file.cpp");
+
+            const bsl::string message(1000, 'x', &sa);
+            record->fixedFields().setMessage(message.c_str());
+
+            for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(k_QUEUE_SIZE == X.recordQueueLength());
+
+            mX.releaseRecords();
+            ASSERT(0 == X.recordQueueLength());
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(k_QUEUE_SIZE == X.recordQueueLength());
+
+            ASSERTV(numAllocations,   ta.numAllocations(),
+                    numAllocations == ta.numAllocations());
+        }
+
+        if (veryVerbose) cout << "\tTesting shutdown, release, and restart."
+                              << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_QUEUE_SIZE = 32 };
+
+            Obj        mX(FATAL,
+                          false,
+                          k_QUEUE_SIZE,
+                          TRACE,
+                          5,
+                          bsls::TimeInterval(0.001),
+                          &ta);
+            const Obj& X = mX;
+
+            mX.setLogFormat("%m\n", "%m\n");
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ERROR);
+            record->fixedFields().setMessage("discarded");
+
+            // Every slot must be returned each time the records are
+            // discarded, or the (blocking) 'publish' would hang.
+
+            for (int iteration = 0; iteration < 3; ++iteration) {
+                for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+                    mX.publish(record, context);
+                }
+                ASSERT(k_QUEUE_SIZE == X.recordQueueLength());
+
+                if (iteration % 2) {
+                    mX.releaseRecords();
+                }
+                else {
+                    ASSERT(0 == mX.shutdownPublicationThread());
+                }
+                ASSERT(0 == X.recordQueueLength());
+            }
+            ASSERT(0 == FsUtil::getFileSize(fileName));
+
+            record->fixedFields().setMessage("published");
+
+            for (int iteration = 0; iteration < 3; ++iteration) {
+                ASSERT(0 == mX.startPublicationThread());
+                ASSERT(true == X.isPublicationThreadRunning());
+
+                for (int i = 0; i < 3 * k_QUEUE_SIZE; ++i) {
+                    mX.publish(record, context);
+                }
+
+                ASSERT(0 == mX.stopPublicationThread());
+                ASSERT(false == X.isPublicationThreadRunning());
+                ASSERT(0 == X.recordQueueLength());
+            }
+
+            mX.disableFileLogging();
+
+            const bsl::string content = readPartialFile(fileName, 0);
+
+            bsl::string expected;
+            for (int i = 0; i < 3 * 3 * k_QUEUE_SIZE; ++i) {
+                expected += "published\n";
+            }
+            ASSERTV(content, expected == content);
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'recordQueueLength'
@@ -0,0 +1,292 @@
+// ball_binaryfileobserver.cpp                                        -*-C++-*-
+#include <ball_binaryfileobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_binaryfileobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_context.h>
+#include <ball_record.h>
+
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_log.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+
+#include <bsl_c_errno.h>
+#include <bsl_c_stdio.h>   // for 'snprintf'
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+void reportError(const char *format, const char *fileName)
+    // Report the failure of an operation on the log file having the specified
+    // 'fileName', described by the specified 'printf'-style 'format' having a
+    // '%s' conversion for 'fileName' followed by one for the system error
+    // message, using the 'bsls::Log' facility.
+{
+    char errorBuffer[512];
+
+    snprintf(errorBuffer,
+             sizeof errorBuffer,
+             format,
+             fileName,
+             bsl::strerror(errno));
+    bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                             __FILE__,
+                                             __LINE__,
+                                             errorBuffer);
+}
+
+bsl::string getRotatedFileName(const bsl::string& logFileName)
+    // Return the name to which the log file having the specified
+    // 'logFileName' is renamed on rotation (see {Log Files and Rotation}).
+{
+    const bdlt::Datetime now = bdlt::CurrentTime::utc();
+
+    char suffix[32];
+    snprintf(suffix,
+             sizeof suffix,
+             ".%04d%02d%02d_%02d%02d%02d",
+             now.year(),
+             now.month(),
+             now.day(),
+             now.hour(),
+             now.minute(),
+             now.second());
+
+    bsl::string name(logFileName);
+    name += suffix;
+
+    bsl::string candidate(name);
+    for (int i = 1; bdls::FilesystemUtil::exists(candidate); ++i) {
+        char number[16];
+        snprintf(number, sizeof number, ".%d", i);
+
+        candidate  = name;
+        candidate += number;
+    }
+    return candidate;
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class BinaryFileObserver
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+void BinaryFileObserver::closeLogFile()
+{
+    if (bdls::FilesystemUtil::k_INVALID_FD != d_fd) {
+        bdls::FilesystemUtil::close(d_fd);
+        d_fd = bdls::FilesystemUtil::k_INVALID_FD;
+    }
+}
+
+int BinaryFileObserver::openLogFile()
+{
+    BSLS_ASSERT(bdls::FilesystemUtil::k_INVALID_FD == d_fd);
+
+    d_fd = bdls::FilesystemUtil::open(d_logFileName,
+                                      bdls::FilesystemUtil::e_OPEN_OR_CREATE,
+                                      bdls::FilesystemUtil::e_APPEND_ONLY);
+
+    if (bdls::FilesystemUtil::k_INVALID_FD == d_fd) {
+        reportError("Cannot open log file %s: %s. "
+                    "File logging will be disabled!",
+                    d_logFileName.c_str());
+        return -1;                                                    // RETURN
+    }
+
+    d_logFileSize = bdls::FilesystemUtil::seek(
+                                     d_fd,
+                                     0,
+                                     bdls::FilesystemUtil::e_SEEK_FROM_END);
+    if (0 > d_logFileSize) {
+        d_logFileSize = 0;
+    }
+
+    d_buffer.clear();
+    d_encoder.encodeHeader(&d_buffer);
+
+    return writeBuffer();
+}
+
+int BinaryFileObserver::rotateFile()
+{
+    if (bdls::FilesystemUtil::k_INVALID_FD == d_fd) {
+        return 1;                                                     // RETURN
+    }
+
+    closeLogFile();
+
+    const bsl::string rotatedFileName = getRotatedFileName(d_logFileName);
+
+    if (0 != bdls::FilesystemUtil::move(d_logFileName, rotatedFileName)) {
+        reportError("Cannot rename log file %s: %s.", d_logFileName.c_str());
+    }
+
+    return 0 == openLogFile() ? 0 : -1;
+}
+
+int BinaryFileObserver::writeBuffer()
+{
+    BSLS_ASSERT(bdls::FilesystemUtil::k_INVALID_FD != d_fd);
+
+    const int length = static_cast<int>(d_buffer.size());
+
+    if (length != bdls::FilesystemUtil::write(d_fd, d_buffer.data(), length)) {
+        reportError("Cannot write to log file %s: %s. "
+                    "File logging will be disabled!",
+                    d_logFileName.c_str());
+        closeLogFile();
+        return -1;                                                    // RETURN
+    }
+
+    d_logFileSize += length;
+    return 0;
+}
+
+// CREATORS
+BinaryFileObserver::BinaryFileObserver(bslma::Allocator *basicAllocator)
+: d_fd(bdls::FilesystemUtil::k_INVALID_FD)
+, d_logFileName(basicAllocator)
+, d_logFileSize(0)
+, d_rotationSize(0)
+, d_encoder(basicAllocator)
+, d_buffer(basicAllocator)
+{
+}
+
+BinaryFileObserver::~BinaryFileObserver()
+{
+    closeLogFile();
+}
+
+// MANIPULATORS
+void BinaryFileObserver::disableFileLogging()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    closeLogFile();
+}
+
+void BinaryFileObserver::disableSizeRotation()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_rotationSize = 0;
+}
+
+int BinaryFileObserver::enableFileLogging(const char *fileName)
+{
+    BSLS_ASSERT(fileName);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (bdls::FilesystemUtil::k_INVALID_FD != d_fd) {
+        return 1;                                                     // RETURN
+    }
+
+    d_logFileName = fileName;
+
+    return 0 == openLogFile() ? 0 : -1;
+}
+
+void BinaryFileObserver::forceRotation()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    rotateFile();
+}
+
+void BinaryFileObserver::publish(const Record& record, const Context&)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (bdls::FilesystemUtil::k_INVALID_FD == d_fd) {
+        return;                                                       // RETURN
+    }
+
+    if (d_rotationSize
+     && d_logFileSize >
+                 static_cast<bsls::Types::Int64>(d_rotationSize) * 1024
+     && 0 != rotateFile()) {
+        return;                                                       // RETURN
+    }
+
+    d_buffer.clear();
+    d_encoder.encode(&d_buffer, record);
+
+    writeBuffer();
+}
+
+void BinaryFileObserver::rotateOnSize(int size)
+{
+    BSLS_ASSERT(0 < size);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_rotationSize = size;
+}
+
+// ACCESSORS
+bool BinaryFileObserver::isFileLoggingEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return bdls::FilesystemUtil::k_INVALID_FD != d_fd;
+}
+
+bool BinaryFileObserver::isFileLoggingEnabled(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (bdls::FilesystemUtil::k_INVALID_FD != d_fd) {
+        *result = d_logFileName;
+        return true;                                                  // RETURN
+    }
+    return false;
+}
+
+int BinaryFileObserver::rotationSize() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_rotationSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,337 @@
+// ball_binaryfileobserver.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_BINARYFILEOBSERVER
+#define INCLUDED_BALL_BINARYFILEOBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe observer that logs records in binary form.
+//
+//@CLASSES:
+//  ball::BinaryFileObserver: observer that writes records to a binary log file
+//
+//@SEE_ALSO: ball_binaryrecordcodec, ball_fileobserver2, ball_observer
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::BinaryFileObserver', that writes the log
+// records it receives to a file in the compact binary log format of
+// 'ball_binaryrecordcodec', rather than as text:
+//..
+//           ,------------------------.
+//          ( ball::BinaryFileObserver )
+//           `------------------------'
+//                       |              ctor
+//                       |              disableFileLogging
+//                       |              disableSizeRotation
+//                       |              enableFileLogging
+//                       |              forceRotation
+//                       |              rotateOnSize
+//                       |              isFileLoggingEnabled
+//                       |              rotationSize
+//                       V
+//               ,--------------.
+//              ( ball::Observer )
+//               `--------------'
+//                                      dtor
+//                                      publish
+//                                      releaseRecords
+//..
+// Publishing a record to a 'ball::BinaryFileObserver' encodes the record with
+// a 'ball::BinaryRecordEncoder', which is considerably cheaper than rendering
+// it to text (e.g., with a 'ball::RecordStringFormatter'), and writes fewer
+// bytes to the log file.  The log file can later be converted to text, in
+// any format, with 'ball::BinaryRecordUtil::convertToText', or its records
+// read with a 'ball::BinaryRecordDecoder'.
+//
+// Each record is written to the log file with a single system call, so that
+// a reader of the file (or a process examining it after a crash) sees only
+// complete records, with the possible exception of the last.
+//
+///Log Files and Rotation
+///----------------------
+// Logging to a file is enabled by 'enableFileLogging', which opens the named
+// file, creating it if it does not exist and appending to it otherwise, and
+// writes a header frame starting a new binary log (see {Binary Log Format} in
+// 'ball_binaryrecordcodec').  A file holding the logs of several runs can
+// therefore be read as one log.
+//
+// The log file can be rotated explicitly with 'forceRotation', or when its
+// size exceeds the limit configured with 'rotateOnSize'.  On rotation, the
+// log file is closed and renamed by appending to its name a '.' followed by
+// the UTC time of the rotation in the form 'YYYYMMDD_hhmmss' (and, if a file
+// with that name exists, a further '.' and the smallest positive integer
+// yielding an unused name), and a new log file, starting with a header
+// frame, is opened with the original name.
+//
+///Thread Safety
+///-------------
+// All methods of 'ball::BinaryFileObserver' are thread-safe, and can be
+// called concurrently by multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging in Binary Form and Reading the Log as Text
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service logs at a high rate, and that we want to reduce the
+// cost of doing so by deferring the formatting of its records until they are
+// read.
+//
+// First, we create a 'ball::BinaryFileObserver', enable logging to a file,
+// and rotate the file whenever it exceeds 64 megabytes:
+//..
+//  ball::BinaryFileObserver observer;
+//
+//  int rc = observer.enableFileLogging(fileName.c_str());
+//  assert(0 == rc);
+//
+//  observer.rotateOnSize(64 * 1024);
+//..
+// Then, we publish records to the observer, which would typically be
+// registered with the logger manager:
+//..
+//  ball::RecordAttributes attributes(bdlt::CurrentTime::utc(),
+//                                    bdls::ProcessUtil::getProcessId(),
+//                                    bslmt::ThreadUtil::selfIdAsUint64(),
+//                                    __FILE__,
+//                                    __LINE__,
+//                                    "EXAMPLE.CATEGORY",
+//                                    ball::Severity::e_INFO,
+//                                    "Request processed");
+//  ball::Record  record(attributes, ball::UserFields());
+//  ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+//
+//  for (int i = 0; i < 3; ++i) {
+//      observer.publish(record, context);
+//  }
+//
+//  observer.disableFileLogging();
+//..
+// Finally, we render the log file as text, with the format of our choice:
+//..
+//  bsl::filebuf input;
+//  input.open(fileName.c_str(), bsl::ios_base::in | bsl::ios_base::binary);
+//
+//  bsl::ostringstream text;
+//  int                numRecords;
+//
+//  rc = ball::BinaryRecordUtil::convertToText(
+//                                   text,
+//                                   &input,
+//                                   ball::RecordStringFormatter("%c: %m\n"),
+//                                   &numRecords);
+//  assert(0 == rc);
+//  assert(3 == numRecords);
+//  assert("EXAMPLE.CATEGORY: Request processed\n"
+//         "EXAMPLE.CATEGORY: Request processed\n"
+//         "EXAMPLE.CATEGORY: Request processed\n" == text.str());
+//..
+
+#include <balscm_version.h>
+
+#include <ball_binaryrecordcodec.h>
+#include <ball_observer.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+class Record;
+
+                          // ========================
+                          // class BinaryFileObserver
+                          // ========================
+
+class BinaryFileObserver : public Observer {
+    // This class implements the 'Observer' protocol.  The 'publish' method of
+    // this class writes the log records that it receives to a user-specified
+    // file in the binary log format of 'ball_binaryrecordcodec'.  This class
+    // is thread-safe; different threads can operate on an object
+    // concurrently.
+
+    // DATA
+    bdls::FilesystemUtil::FileDescriptor
+                          d_fd;            // log file descriptor, or
+                                           // 'k_INVALID_FD' if file logging is
+                                           // disabled
+
+    bsl::string           d_logFileName;   // name of the log file
+
+    bdls::FilesystemUtil::Offset
+                          d_logFileSize;   // size of the log file (in bytes)
+
+    int                   d_rotationSize;  // maximum log file size before
+                                           // rotation (in kilobytes), or 0
+
+    BinaryRecordEncoder   d_encoder;       // encoder of the current log
+
+    bsl::vector<char>     d_buffer;        // encoding of the record being
+                                           // written; capacity is reused
+
+    mutable bslmt::Mutex  d_mutex;         // serialize operations
+
+  private:
+    // NOT IMPLEMENTED
+    BinaryFileObserver(const BinaryFileObserver&);
+    BinaryFileObserver& operator=(const BinaryFileObserver&);
+
+    // PRIVATE MANIPULATORS
+    void closeLogFile();
+        // Close the log file if it is open.  The behavior is undefined unless
+        // the caller acquired the lock for this object.
+
+    int openLogFile();
+        // Open the log file named 'd_logFileName', creating it if necessary,
+        // and write a header frame to it.  Return 0 on success, and a
+        // non-zero value otherwise, in which case file logging is disabled.
+        // The behavior is undefined unless the caller acquired the lock for
+        // this object.
+
+    int rotateFile();
+        // Close the log file, rename it (see {Log Files and Rotation}), and
+        // open a new log file.  Return 0 on success, a positive value if file
+        // logging is not enabled, and a negative value otherwise.  The
+        // behavior is undefined unless the caller acquired the lock for this
+        // object.
+
+    int writeBuffer();
+        // Write 'd_buffer' to the log file, and report and disable file
+        // logging if the write fails.  Return 0 on success, and a non-zero
+        // value otherwise.  The behavior is undefined unless the caller
+        // acquired the lock for this object and file logging is enabled.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BinaryFileObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BinaryFileObserver(bslma::Allocator *basicAllocator = 0);
+        // Create a binary file observer with file logging initially disabled.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~BinaryFileObserver();
+        // Close the log file of this observer if file logging is enabled, and
+        // destroy this observer.
+
+    // MANIPULATORS
+    void disableFileLogging();
+        // Disable file logging for this observer, closing the log file.  This
+        // method has no effect if file logging is not enabled.  Note that
+        // records subsequently received through the 'publish' method will be
+        // dropped until file logging is reenabled.
+
+    void disableSizeRotation();
+        // Disable log file rotation based on log file size for this observer.
+        // This method has no effect if rotation-on-size is not enabled.
+
+    int enableFileLogging(const char *fileName);
+        // Enable logging of all records published to this observer to the
+        // file having the specified 'fileName', creating the file if it does
+        // not exist and appending to it otherwise, and start a new binary log
+        // in the file.  Return 0 on success, a positive value if file logging
+        // is already enabled (with no effect), and a negative value if the
+        // file cannot be opened or written.
+
+    void forceRotation();
+        // Rotate the log file of this observer (see {Log Files and
+        // Rotation}).  This method has no effect if file logging is not
+        // enabled.
+
+    void publish(const Record& record, const Context& context);
+        // Process the specified log 'record' having the specified publishing
+        // 'context' by encoding 'record' and writing it to the log file if
+        // file logging is enabled for this observer, first rotating the log
+        // file if rotation-on-size is enabled and the log file is larger than
+        // the configured size.  The method has no effect if file logging is
+        // not enabled, in which case 'record' is dropped.
+
+    void publish(const bsl::shared_ptr<const Record>& record,
+                 const Context&                       context);
+        // Process the record referenced by the specified 'record' shared
+        // pointer having the specified publishing 'context' as described for
+        // the 'publish' method taking a 'const Record&'.
+
+    void releaseRecords();
+        // Discard any shared references to 'Record' objects that were supplied
+        // to the 'publish' method, and are held by this observer.  Note that
+        // this observer holds no such references, so this method has no
+        // effect.
+
+    void rotateOnSize(int size);
+        // Set this observer to rotate its log file when the size of the file
+        // exceeds the specified 'size' (in kilobytes).  This rule replaces any
+        // rotation-on-size rule currently in effect.  The behavior is
+        // undefined unless '0 < size'.
+
+    // ACCESSORS
+    bool isFileLoggingEnabled() const;
+    bool isFileLoggingEnabled(bsl::string *result) const;
+        // Return 'true' if file logging is enabled for this observer, and
+        // 'false' otherwise.  Load the optionally specified 'result' with the
+        // name of the log file if file logging is enabled, and leave 'result'
+        // unmodified otherwise.
+
+    int rotationSize() const;
+        // Return the size (in kilobytes) of the log file that will trigger a
+        // file rotation by this observer if rotation-on-size is in effect,
+        // and 0 otherwise.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class BinaryFileObserver
+                          // ------------------------
+
+// MANIPULATORS
+inline
+void BinaryFileObserver::publish(const bsl::shared_ptr<const Record>& record,
+                                 const Context&                       context)
+{
+    publish(*record, context);
+}
+
+inline
+void BinaryFileObserver::releaseRecords()
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,824 @@
+// ball_binaryfileobserver.t.cpp                                      -*-C++-*-
+#include <ball_binaryfileobserver.h>
+
+#include <ball_binaryrecordcodec.h>
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+#include <ball_transmission.h>
+#include <ball_userfields.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bdls_processutil.h>
+
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe observer that writes the records
+// it receives to a file in the binary log format of 'ball_binaryrecordcodec'.
+// We verify that the records published while file logging is enabled, and
+// only those, can be decoded from the log file; that the log file is rotated
+// on demand and on size; and that concurrent publication yields a log file
+// holding every record intact.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] BinaryFileObserver(bslma::Allocator *basicAllocator = 0);
+// [ 1] ~BinaryFileObserver();
+//
+// MANIPULATORS
+// [ 2] void disableFileLogging();
+// [ 3] void disableSizeRotation();
+// [ 2] int enableFileLogging(const char *fileName);
+// [ 3] void forceRotation();
+// [ 2] void publish(const Record& record, const Context& context);
+// [ 2] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 2] void releaseRecords();
+// [ 3] void rotateOnSize(int size);
+//
+// ACCESSORS
+// [ 2] bool isFileLoggingEnabled() const;
+// [ 2] bool isFileLoggingEnabled(bsl::string *result) const;
+// [ 3] int rotationSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: CONCURRENT PUBLICATION
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef ball::BinaryFileObserver Obj;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "ball_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+ball::Record makeRecord(const char *category, const char *message, int line)
+    // Return a record having the specified 'category', 'message', and 'line',
+    // and the current time, process, and thread.
+{
+    ball::RecordAttributes attributes(bdlt::CurrentTime::utc(),
+                                      bdls::ProcessUtil::getProcessId(),
+                                      bslmt::ThreadUtil::selfIdAsUint64(),
+                                      __FILE__,
+                                      line,
+                                      category,
+                                      ball::Severity::e_INFO,
+                                      message);
+
+    return ball::Record(attributes, ball::UserFields());
+}
+
+int readLog(bsl::vector<ball::Record> *records, const bsl::string& fileName)
+    // Append to the specified 'records' the records of the binary log file
+    // having the specified 'fileName'.  Return 0 if the whole file is read
+    // successfully, and a non-zero value otherwise.
+{
+    bsl::filebuf input;
+    if (!input.open(fileName.c_str(),
+                    bsl::ios_base::in | bsl::ios_base::binary)) {
+        return -1;                                                    // RETURN
+    }
+
+    ball::BinaryRecordDecoder decoder;
+    ball::Record              record;
+    int                       rc;
+
+    while (0 == (rc = decoder.decode(&record, &input))) {
+        records->push_back(record);
+    }
+    return 0 < rc ? 0 : rc;
+}
+
+bsl::vector<bsl::string> findRotatedFiles(const bsl::string& fileName)
+    // Return the sorted names of the files to which the log file having the
+    // specified 'fileName' has been rotated.
+{
+    bsl::vector<bsl::string> result;
+    bdls::FilesystemUtil::findMatchingPaths(&result,
+                                            (fileName + ".*").c_str());
+    bsl::sort(result.begin(), result.end());
+    return result;
+}
+
+extern "C" void *publishRecords(void *arg)
+    // Publish, to the observer addressed by the specified 'arg', 1000 records
+    // whose message identify the publishing thread and their rank.
+{
+    Obj *observer = static_cast<Obj *>(arg);
+
+    const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    bsl::ostringstream prefix;
+    prefix << bslmt::ThreadUtil::selfIdAsUint64() << ':';
+
+    for (int i = 0; i < 1000; ++i) {
+        bsl::ostringstream message;
+        message << prefix.str() << i;
+
+        observer->publish(makeRecord("CONCURRENT", message.str().c_str(), i),
+                          context);
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        bsl::string        fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "example.binlog");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging in Binary Form and Reading the Log as Text
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service logs at a high rate, and that we want to reduce the
+// cost of doing so by deferring the formatting of its records until they are
+// read.
+//
+// First, we create a 'ball::BinaryFileObserver', enable logging to a file,
+// and rotate the file whenever it exceeds 64 megabytes:
+//..
+        ball::BinaryFileObserver observer;
+
+        int rc = observer.enableFileLogging(fileName.c_str());
+        ASSERT(0 == rc);
+
+        observer.rotateOnSize(64 * 1024);
+//..
+// Then, we publish records to the observer, which would typically be
+// registered with the logger manager:
+//..
+        ball::RecordAttributes attributes(bdlt::CurrentTime::utc(),
+                                          bdls::ProcessUtil::getProcessId(),
+                                          bslmt::ThreadUtil::selfIdAsUint64(),
+                                          __FILE__,
+                                          __LINE__,
+                                          "EXAMPLE.CATEGORY",
+                                          ball::Severity::e_INFO,
+                                          "Request processed");
+        ball::Record  record(attributes, ball::UserFields());
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        for (int i = 0; i < 3; ++i) {
+            observer.publish(record, context);
+        }
+
+        observer.disableFileLogging();
+//..
+// Finally, we render the log file as text, with the format of our choice:
+//..
+        bsl::filebuf input;
+        input.open(fileName.c_str(),
+                   bsl::ios_base::in | bsl::ios_base::binary);
+
+        bsl::ostringstream text;
+        int                numRecords;
+
+        rc = ball::BinaryRecordUtil::convertToText(
+                                     text,
+                                     &input,
+                                     ball::RecordStringFormatter("%c: %m\n"),
+                                     &numRecords);
+        ASSERT(0 == rc);
+        ASSERT(3 == numRecords);
+        ASSERT("EXAMPLE.CATEGORY: Request processed\n"
+               "EXAMPLE.CATEGORY: Request processed\n"
+               "EXAMPLE.CATEGORY: Request processed\n" == text.str());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT PUBLICATION
+        //
+        // Concerns:
+        //: 1 Records published concurrently by several threads are each
+        //:   written intact, in the order of publication for each thread.
+        //:
+        //: 2 Rotation on size during concurrent publication loses no record.
+        //
+        // Plan:
+        //: 1 Publish records from several threads to an observer rotating its
+        //:   log file on a small size, then decode every log file, and verify
+        //:   that every record is present exactly once, in order for each
+        //:   thread.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: CONCURRENT PUBLICATION"
+                          << "\n===============================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 1000 };
+
+        TempDirectoryGuard tempDirGuard;
+        bsl::string        fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "concurrent.binlog");
+
+        {
+            Obj mX;
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            mX.rotateOnSize(32);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      publishRecords,
+                                                      &mX));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+        }
+
+        bsl::vector<bsl::string> files = findRotatedFiles(fileName);
+        files.push_back(fileName);
+
+        if (veryVerbose) { P(files.size()); }
+
+        ASSERT(1 < files.size());
+
+        bsl::vector<ball::Record> records;
+        for (bsl::size_t i = 0; i < files.size(); ++i) {
+            ASSERTV(files[i], 0 == readLog(&records, files[i]));
+        }
+
+        ASSERTV(records.size(),
+                k_NUM_THREADS * k_NUM_RECORDS == records.size());
+
+        // Rotated files have a one-second resolution, so check the order of
+        // each thread's records within each file, and their total count.
+
+        bsl::vector<bsl::string> messages;
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            messages.push_back(records[i].fixedFields().messageRef());
+        }
+        bsl::sort(messages.begin(), messages.end());
+        ASSERT(messages.end() == bsl::adjacent_find(messages.begin(),
+                                                    messages.end()));
+
+        for (bsl::size_t i = 0; i < files.size(); ++i) {
+            bsl::vector<ball::Record> fileRecords;
+            readLog(&fileRecords, files[i]);
+
+            bsl::vector<bsls::Types::Uint64> threads;
+            bsl::vector<int>                 lastLine;
+
+            for (bsl::size_t j = 0; j < fileRecords.size(); ++j) {
+                const ball::RecordAttributes& attributes =
+                                                  fileRecords[j].fixedFields();
+
+                const bsl::size_t k = bsl::find(threads.begin(),
+                                                threads.end(),
+                                                attributes.threadID())
+                                    - threads.begin();
+                if (k == threads.size()) {
+                    threads.push_back(attributes.threadID());
+                    lastLine.push_back(-1);
+                }
+                ASSERTV(files[i], j, lastLine[k] < attributes.lineNumber());
+                lastLine[k] = attributes.lineNumber();
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING ROTATION
+        //
+        // Concerns:
+        //: 1 'forceRotation' renames the log file, and starts a new log file
+        //:   with the original name.
+        //:
+        //: 2 'forceRotation' has no effect if file logging is disabled.
+        //:
+        //: 3 The log file is rotated when its size exceeds the size set with
+        //:   'rotateOnSize', and not otherwise.
+        //:
+        //: 4 'rotationSize' reflects the rotation-on-size rule, which is
+        //:   disabled by 'disableSizeRotation'.
+        //:
+        //: 5 Each log file is a complete binary log.
+        //
+        // Plan:
+        //: 1 Rotate the log file explicitly, and verify the names and contents
+        //:   of the files.  (C-1, 5)
+        //:
+        //: 2 Call 'forceRotation' with file logging disabled.  (C-2)
+        //:
+        //: 3 Set a 1 kilobyte rotation size, publish records past it, and
+        //:   verify that a rotation happened, and that each file but the
+        //:   last is barely over the limit.  (C-3..5)
+        //
+        // Testing:
+        //   void disableSizeRotation();
+        //   void forceRotation();
+        //   void rotateOnSize(int size);
+        //   int rotationSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ROTATION"
+                          << "\n================" << endl;
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (veryVerbose) cout << "\tTesting 'forceRotation'." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+            bsl::string        fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "force.binlog");
+
+            Obj mX;
+
+            mX.forceRotation();
+            ASSERT(findRotatedFiles(fileName).empty());
+            ASSERT(!bdls::FilesystemUtil::exists(fileName));
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            mX.publish(makeRecord("BEFORE", "before", L_), context);
+            mX.forceRotation();
+            mX.publish(makeRecord("AFTER", "after", L_), context);
+            mX.forceRotation();
+
+            mX.disableFileLogging();
+
+            const bsl::vector<bsl::string> rotated =
+                                                   findRotatedFiles(fileName);
+            ASSERTV(rotated.size(), 2 == rotated.size());
+
+            if (2 == rotated.size()) {
+                if (veryVerbose) { P_(rotated[0]); P(rotated[1]); }
+
+                // The rotated file names differ only in their suffix, and the
+                // second one, if rotated within the same second, has the '.1'
+                // suffix appended.
+
+                bsl::vector<ball::Record> first, second, last;
+
+                int rc = readLog(&first,  rotated[0]);
+                ASSERT(0 == rc);
+                rc = readLog(&second, rotated[1]);
+                ASSERT(0 == rc);
+                rc = readLog(&last, fileName);
+                ASSERT(0 == rc);
+
+                ASSERTV(first.size(),  1 == first.size());
+                ASSERTV(second.size(), 1 == second.size());
+                ASSERTV(last.size(),   0 == last.size());
+
+                if (1 == first.size() && 1 == second.size()) {
+                    ASSERT("before" == first[0].fixedFields().messageRef());
+                    ASSERT("after"  == second[0].fixedFields().messageRef());
+                }
+
+                ASSERT(13 == bdls::FilesystemUtil::getFileSize(fileName));
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting 'rotateOnSize'." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+            bsl::string        fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "size.binlog");
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.rotationSize());
+
+            mX.rotateOnSize(1);
+            ASSERT(1 == X.rotationSize());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            const bsl::string message(100, 'x');
+
+            // Publish until a rotation happens.
+
+            int numPublished = 0;
+            while (findRotatedFiles(fileName).empty() && numPublished < 100) {
+                mX.publish(makeRecord("SIZE", message.c_str(), L_), context);
+                ++numPublished;
+            }
+
+            ASSERTV(numPublished, 5 < numPublished && numPublished < 100);
+
+            bsl::vector<bsl::string> rotated = findRotatedFiles(fileName);
+            ASSERT(1 == rotated.size());
+
+            if (1 == rotated.size()) {
+                const bdls::FilesystemUtil::Offset size =
+                                 bdls::FilesystemUtil::getFileSize(rotated[0]);
+
+                ASSERTV(size, 1024 < size && size < 1024 + 200);
+
+                bsl::vector<ball::Record> records;
+                ASSERT(0 == readLog(&records, rotated[0]));
+                ASSERT(0 == readLog(&records, fileName));
+
+                ASSERTV(records.size(),
+                        static_cast<bsl::size_t>(numPublished) ==
+                                                              records.size());
+            }
+
+            mX.disableSizeRotation();
+            ASSERT(0 == X.rotationSize());
+
+            for (int i = 0; i < 50; ++i) {
+                mX.publish(makeRecord("SIZE", message.c_str(), L_), context);
+            }
+            ASSERT(1 == findRotatedFiles(fileName).size());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PUBLICATION
+        //
+        // Concerns:
+        //: 1 Records published while file logging is enabled are written to
+        //:   the log file, and decoded to their published values.
+        //:
+        //: 2 Records published while file logging is disabled are dropped.
+        //:
+        //: 3 'enableFileLogging' fails if file logging is already enabled, or
+        //:   the file cannot be opened.
+        //:
+        //: 4 Enabling file logging to an existing file appends a new log,
+        //:   such that the file can be read as a whole.
+        //:
+        //: 5 'isFileLoggingEnabled' reflects the state of the observer, and
+        //:   loads the name of the log file.
+        //:
+        //: 6 Publishing through a shared pointer is equivalent to publishing
+        //:   a reference, and 'releaseRecords' has no effect.
+        //:
+        //: 7 All memory is supplied by the supplied allocator.
+        //
+        // Plan:
+        //: 1 Publish records, in between enabling and disabling file logging,
+        //:   and decode the log file.  (C-1..7)
+        //
+        // Testing:
+        //   void disableFileLogging();
+        //   int enableFileLogging(const char *fileName);
+        //   void publish(const Record& record, const Context& context);
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   void releaseRecords();
+        //   bool isFileLoggingEnabled() const;
+        //   bool isFileLoggingEnabled(bsl::string *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING PUBLICATION"
+                          << "\n===================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        TempDirectoryGuard tempDirGuard;
+        bsl::string        fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "publish.binlog");
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        bsl::vector<ball::Record> expected;
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsl::string name("unchanged");
+
+            ASSERT(!X.isFileLoggingEnabled());
+            ASSERT(!X.isFileLoggingEnabled(&name));
+            ASSERT("unchanged" == name);
+
+            mX.publish(makeRecord("DROPPED", "dropped", L_), context);
+
+            bsl::string badName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&badName, "missing");
+            bdls::PathUtil::appendRaw(&badName, "file.binlog");
+
+            ASSERT(0 > mX.enableFileLogging(badName.c_str()));
+            ASSERT(!X.isFileLoggingEnabled());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(1 == mX.enableFileLogging(fileName.c_str()));
+
+            ASSERT(X.isFileLoggingEnabled());
+            ASSERT(X.isFileLoggingEnabled(&name));
+            ASSERT(fileName == name);
+
+            for (int i = 0; i < 10; ++i) {
+                bsl::ostringstream message;
+                message << "message " << i;
+
+                ball::Record record = makeRecord(i % 2 ? "ODD" : "EVEN",
+                                                 message.str().c_str(),
+                                                 i);
+                record.customFields().appendInt64(i);
+
+                if (i % 3) {
+                    mX.publish(record, context);
+                }
+                else {
+                    mX.publish(bsl::make_shared<ball::Record>(record),
+                               context);
+                }
+                expected.push_back(record);
+            }
+
+            mX.releaseRecords();
+
+            mX.disableFileLogging();
+            ASSERT(!X.isFileLoggingEnabled());
+
+            mX.disableFileLogging();
+            mX.publish(makeRecord("DROPPED", "dropped", L_), context);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            bsl::vector<ball::Record> records;
+            ASSERT(0 == readLog(&records, fileName));
+            ASSERTV(records.size(), expected.size() == records.size());
+
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                ASSERTV(i, expected[i] == records[i]);
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting appending to a log." << endl;
+        {
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            const ball::Record record = makeRecord("APPENDED", "appended", 1);
+            mX.publish(record, context);
+            expected.push_back(record);
+        }
+
+        {
+            bsl::vector<ball::Record> records;
+            ASSERT(0 == readLog(&records, fileName));
+            ASSERTV(records.size(), expected.size() == records.size());
+
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                ASSERTV(i, expected[i] == records[i]);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an observer, enable file logging, publish a record, and
+        //:   decode the log file.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   BinaryFileObserver(bslma::Allocator *basicAllocator = 0);
+        //   ~BinaryFileObserver();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        bsl::string        fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "breathing.binlog");
+
+        const ball::Record record = makeRecord("BREATHING", "breathing", L_);
+
+        {
+            Obj mX;
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            mX.publish(record,
+                       ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+        }
+
+        bsl::vector<ball::Record> records;
+        ASSERT(0 == readLog(&records, fileName));
+        ASSERT(1 == records.size());
+        ASSERT(1 == records.size() && record == records[0]);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "."
+             << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,762 @@
+// ball_binaryrecordcodec.cpp                                         -*-C++-*-
+#include <ball_binaryrecordcodec.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_binaryrecordcodec_cpp,"$Id$ $CSID$")
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_userfields.h>
+#include <ball_userfieldtype.h>
+#include <ball_userfieldvalue.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace {
+
+// Implementation Note: the binary log format is documented in the component
+// header.  A record frame is encoded by sizing the output for the largest
+// possible encoding of the record, writing the primitive encodings through a
+// pointer with the helpers below, and trimming the output to the bytes
+// written, which avoids a bounds check per field.
+
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+enum FrameType {
+    // Frame types of the binary log format.
+
+    e_HEADER_FRAME = 1,
+    e_STRING_FRAME = 2,
+    e_RECORD_FRAME = 3
+};
+
+const char        k_MAGIC[]           = "ballbin1";
+const bsl::size_t k_MAGIC_LENGTH      = sizeof k_MAGIC - 1;
+const int         k_FRAME_HEADER_SIZE = 5;
+const bsl::size_t k_MAX_VARINT_SIZE   = 10;
+
+const Uint64 k_MAX_FRAME_LENGTH = 1u << 30;
+    // Largest frame payload accepted by the decoder, so that a corrupt
+    // length cannot cause an unbounded allocation.
+
+Int64 microsecondsFromOrigin(const bdlt::Datetime& datetime)
+    // Return the number of microseconds from 0001/01/01_00:00:00.000000 to
+    // the specified 'datetime'.
+{
+    return (datetime - bdlt::Datetime(1, 1, 1)).totalMicroseconds();
+}
+
+char *writeVarint(char *output, Uint64 value)
+    // Write to the specified 'output' the LEB128 encoding of the specified
+    // 'value', and return the address following the last byte written.  The
+    // behavior is undefined unless 'output' has room for 'k_MAX_VARINT_SIZE'
+    // bytes.
+{
+    while (value >= 0x80) {
+        *output++ = static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    *output++ = static_cast<char>(value);
+
+    return output;
+}
+
+char *writeZigzag(char *output, Int64 value)
+    // Write to the specified 'output' the zigzag encoding of the specified
+    // 'value', and return the address following the last byte written.  The
+    // behavior is undefined unless 'output' has room for 'k_MAX_VARINT_SIZE'
+    // bytes.
+{
+    return writeVarint(output,
+                       (static_cast<Uint64>(value) << 1)
+                                          ^ static_cast<Uint64>(value >> 63));
+}
+
+char *writeBytes(char *output, const char *data, bsl::size_t length)
+    // Write to the specified 'output' the specified 'length', as a 'varint',
+    // followed by the specified 'data' of 'length' bytes, and return the
+    // address following the last byte written.  The behavior is undefined
+    // unless 'output' has room for 'k_MAX_VARINT_SIZE + length' bytes.
+{
+    output = writeVarint(output, length);
+    bsl::memcpy(output, data, length);
+    return output + length;
+}
+
+bsl::size_t beginFrame(bsl::vector<char> *output, FrameType type)
+    // Append to the specified 'output' the header of a frame of the specified
+    // 'type' with a placeholder length, and return the position of the first
+    // byte of the payload.
+{
+    const char header[k_FRAME_HEADER_SIZE] = { static_cast<char>(type) };
+
+    output->insert(output->end(), header, header + k_FRAME_HEADER_SIZE);
+    return output->size();
+}
+
+void endFrame(bsl::vector<char> *output, bsl::size_t payloadPosition)
+    // Set the length of the frame of the specified 'output' whose payload
+    // starts at the specified 'payloadPosition' so that the payload extends
+    // to the end of 'output'.
+{
+    Uint64 length = output->size() - payloadPosition;
+
+    BSLS_ASSERT(length <= k_MAX_FRAME_LENGTH);
+
+    char *lengthBytes = output->data() + payloadPosition - 4;
+    for (int i = 0; i < 4; ++i, length >>= 8) {
+        lengthBytes[i] = static_cast<char>(length & 0xff);
+    }
+}
+
+                            // ===================
+                            // class PayloadReader
+                            // ===================
+
+class PayloadReader {
+    // This class reads the primitive encodings of the binary log format from
+    // a frame payload.  Reading past the end of the payload, or a malformed
+    // 'varint', puts the reader in an error state, after which every read
+    // yields 0.
+
+    // DATA
+    const char *d_current_p;  // next byte to read
+    const char *d_end_p;      // end of the payload
+    bool        d_isValid;    // 'false' once an error has occurred
+
+  public:
+    // CREATORS
+    PayloadReader(const char *data, bsl::size_t length)
+        // Create a reader of the specified 'data' of the specified 'length'.
+    : d_current_p(data)
+    , d_end_p(data + length)
+    , d_isValid(true)
+    {
+    }
+
+    // MANIPULATORS
+    Uint64 readVarint()
+        // Read and return a 'varint'.
+    {
+        Uint64 value = 0;
+
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (d_current_p == d_end_p) {
+                break;
+            }
+            const unsigned char byte = *d_current_p++;
+
+            value |= static_cast<Uint64>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return value;                                         // RETURN
+            }
+        }
+        d_isValid = false;
+        return 0;
+    }
+
+    Int64 readZigzag()
+        // Read and return a 'zigzag' encoded integer.
+    {
+        const Uint64 value = readVarint();
+
+        return static_cast<Int64>(value >> 1) ^ -static_cast<Int64>(value & 1);
+    }
+
+    int readInt()
+        // Read and return a 'zigzag' encoded integer that must be
+        // representable as an 'int'.
+    {
+        const Int64 value = readZigzag();
+
+        if (value < INT_MIN || INT_MAX < value) {
+            d_isValid = false;
+            return 0;                                                 // RETURN
+        }
+        return static_cast<int>(value);
+    }
+
+    unsigned char readByte()
+        // Read and return one byte.
+    {
+        if (d_current_p == d_end_p) {
+            d_isValid = false;
+            return 0;                                                 // RETURN
+        }
+        return *d_current_p++;
+    }
+
+    Uint64 readFixed64()
+        // Read and return an 8-byte little-endian integer.
+    {
+        if (d_end_p - d_current_p < 8) {
+            d_isValid = false;
+            return 0;                                                 // RETURN
+        }
+
+        Uint64 value = 0;
+        for (int i = 7; i >= 0; --i) {
+            value = (value << 8) | static_cast<unsigned char>(d_current_p[i]);
+        }
+        d_current_p += 8;
+        return value;
+    }
+
+    bslstl::StringRef readBytes()
+        // Read a 'varint' length followed by that many bytes, and return a
+        // reference to the bytes.
+    {
+        const Uint64 length = readVarint();
+
+        if (static_cast<Uint64>(d_end_p - d_current_p) < length) {
+            d_isValid = false;
+            return bslstl::StringRef();                               // RETURN
+        }
+
+        const char *data = d_current_p;
+        d_current_p += length;
+        return bslstl::StringRef(data, static_cast<bsl::size_t>(length));
+    }
+
+    int readDatetime(bdlt::Datetime *result)
+        // Read a 'zigzag' encoded number of microseconds from
+        // 0001/01/01_00:00:00.000000 and load the corresponding datetime into
+        // the specified 'result'.  Return 0 on success, and a non-zero value
+        // (with no effect on 'result') if the datetime is out of range.
+    {
+        return readTimestamp(result, 0);
+    }
+
+    int readTimestamp(bdlt::Datetime *result, Int64 *base)
+        // Read a 'zigzag' encoded number of microseconds from the datetime
+        // that is the specified '*base' microseconds from
+        // 0001/01/01_00:00:00.000000 (or from 0001/01/01_00:00:00.000000 if
+        // 'base' is 0), load the corresponding datetime into the specified
+        // 'result', and update '*base' (if 'base' is not 0).  Return 0 on
+        // success, and a non-zero value (with no effect on 'result' or
+        // '*base') if the datetime is out of range.
+    {
+        const Uint64 delta  = static_cast<Uint64>(readZigzag());
+        const Uint64 origin = base ? static_cast<Uint64>(*base) : 0;
+        const Int64  offset = static_cast<Int64>(origin + delta);
+
+        bdlt::Datetime datetime(1, 1, 1);
+
+        if (!d_isValid || 0 > offset
+         || 0 != datetime.addMicrosecondsIfValid(offset)) {
+            d_isValid = false;
+            return -1;                                                // RETURN
+        }
+
+        *result = datetime;
+        if (base) {
+            *base = offset;
+        }
+        return 0;
+    }
+
+    // ACCESSORS
+    bool isValid() const
+        // Return 'true' if no error has occurred, and 'false' otherwise.
+    {
+        return d_isValid;
+    }
+};
+
+int readStringReference(const bsl::string                    **result,
+                        bsl::string                           *scratch,
+                        PayloadReader                         *reader,
+                        const bsl::vector<bsl::string>&        strings)
+    // Read a string reference from the specified 'reader', and load into the
+    // specified 'result' the address of the string it refers to, which is
+    // either an element of the specified 'strings' or the specified
+    // 'scratch', into which a string written in place is copied.  Return 0 on
+    // success, and a non-zero value otherwise.
+{
+    const Uint64 reference = reader->readVarint();
+
+    if (0 == reference) {
+        const bslstl::StringRef string = reader->readBytes();
+
+        scratch->assign(string.data(), string.length());
+        *result = scratch;
+    }
+    else if (reference <= strings.size()) {
+        *result = &strings[static_cast<bsl::size_t>(reference - 1)];
+    }
+    else {
+        return -1;                                                    // RETURN
+    }
+    return reader->isValid() ? 0 : -1;
+}
+
+}  // close unnamed namespace
+
+namespace ball {
+
+                        // -------------------------
+                        // class BinaryRecordEncoder
+                        // -------------------------
+
+// PRIVATE MANIPULATORS
+Uint64 BinaryRecordEncoder::internString(bsl::vector<char>        *output,
+                                         LastString               *lastString,
+                                         const bslstl::StringRef&  string)
+{
+    if (lastString->d_reference && lastString->d_string == string) {
+        return lastString->d_reference;                               // RETURN
+    }
+
+    StringTable::const_iterator it = d_strings.find(string);
+    if (d_strings.end() != it) {
+        lastString->d_string    = it->first;
+        lastString->d_reference = it->second + 1;
+        return lastString->d_reference;                               // RETURN
+    }
+
+    const int number = static_cast<int>(d_strings.size());
+    if (number >= d_maxInternedStrings) {
+        return 0;                                                     // RETURN
+    }
+
+    d_stringStorage.emplace_back(string.data(), string.length());
+
+    const bslstl::StringRef interned(d_stringStorage.back());
+    d_strings.emplace(interned, number);
+
+    const bsl::size_t payloadPosition = beginFrame(output, e_STRING_FRAME);
+    output->insert(output->end(), string.begin(), string.end());
+    endFrame(output, payloadPosition);
+
+    lastString->d_string    = interned;
+    lastString->d_reference = number + 1;
+    return lastString->d_reference;
+}
+
+// CREATORS
+BinaryRecordEncoder::BinaryRecordEncoder(bslma::Allocator *basicAllocator)
+: d_stringStorage(basicAllocator)
+, d_strings(basicAllocator)
+, d_maxInternedStrings(k_DEFAULT_MAX_INTERNED_STRINGS)
+, d_lastTimestamp(0)
+, d_lastFileName()
+, d_lastCategory()
+{
+}
+
+BinaryRecordEncoder::BinaryRecordEncoder(int               maxInternedStrings,
+                                         bslma::Allocator *basicAllocator)
+: d_stringStorage(basicAllocator)
+, d_strings(basicAllocator)
+, d_maxInternedStrings(maxInternedStrings)
+, d_lastTimestamp(0)
+, d_lastFileName()
+, d_lastCategory()
+{
+    BSLS_ASSERT(0 <= maxInternedStrings);
+}
+
+// MANIPULATORS
+void BinaryRecordEncoder::encode(bsl::vector<char> *output,
+                                 const Record&      record)
+{
+    BSLS_ASSERT(output);
+
+    const RecordAttributes& fixedFields = record.fixedFields();
+
+    // The string frames interning the names must precede the record frame.
+
+    const bslstl::StringRef fileName(fixedFields.fileName());
+    const bslstl::StringRef category(fixedFields.category());
+
+    const Uint64 fileNameReference = internString(output,
+                                                  &d_lastFileName,
+                                                  fileName);
+    const Uint64 categoryReference = internString(output,
+                                                  &d_lastCategory,
+                                                  category);
+
+    const bslstl::StringRef message = fixedFields.messageRef();
+    const UserFields&       userFields = record.customFields();
+
+    // Compute an upper bound of the size of the record frame: the frame
+    // header, 9 'varint' fields, the strings written in place, and the user
+    // fields.
+
+    bsl::size_t maxSize = k_FRAME_HEADER_SIZE
+                        + 9 * k_MAX_VARINT_SIZE
+                        + message.length();
+
+    if (0 == fileNameReference) {
+        maxSize += k_MAX_VARINT_SIZE + fileName.length();
+    }
+    if (0 == categoryReference) {
+        maxSize += k_MAX_VARINT_SIZE + category.length();
+    }
+
+    for (int i = 0; i < userFields.length(); ++i) {
+        const UserFieldValue& value = userFields[i];
+
+        maxSize += 1 + 2 * k_MAX_VARINT_SIZE;
+        if (UserFieldType::e_STRING == value.type()) {
+            maxSize += value.theString().length();
+        }
+        else if (UserFieldType::e_CHAR_ARRAY == value.type()) {
+            maxSize += value.theCharArray().size();
+        }
+    }
+
+    const bsl::size_t framePosition = output->size();
+    output->resize(framePosition + maxSize);
+
+    char *const frame  = output->data() + framePosition;
+    char       *cursor = frame + k_FRAME_HEADER_SIZE;
+
+    const Int64 timestamp = microsecondsFromOrigin(fixedFields.timestamp());
+
+    cursor = writeZigzag(cursor, timestamp - d_lastTimestamp);
+    d_lastTimestamp = timestamp;
+
+    cursor = writeZigzag(cursor, fixedFields.processID());
+    cursor = writeVarint(cursor, fixedFields.threadID());
+
+    cursor = writeVarint(cursor, fileNameReference);
+    if (0 == fileNameReference) {
+        cursor = writeBytes(cursor, fileName.data(), fileName.length());
+    }
+
+    cursor = writeZigzag(cursor, fixedFields.lineNumber());
+
+    cursor = writeVarint(cursor, categoryReference);
+    if (0 == categoryReference) {
+        cursor = writeBytes(cursor, category.data(), category.length());
+    }
+
+    cursor = writeZigzag(cursor, fixedFields.severity());
+    cursor = writeBytes(cursor, message.data(), message.length());
+    cursor = writeVarint(cursor, userFields.length());
+
+    for (int i = 0; i < userFields.length(); ++i) {
+        const UserFieldValue& value = userFields[i];
+
+        *cursor++ = static_cast<char>(value.type());
+
+        switch (value.type()) {
+          case UserFieldType::e_VOID: {
+          } break;
+          case UserFieldType::e_INT64: {
+            cursor = writeZigzag(cursor, value.theInt64());
+          } break;
+          case UserFieldType::e_DOUBLE: {
+            Uint64 bits;
+            bsl::memcpy(&bits, &value.theDouble(), sizeof bits);
+
+            for (int j = 0; j < 8; ++j, bits >>= 8) {
+                *cursor++ = static_cast<char>(bits & 0xff);
+            }
+          } break;
+          case UserFieldType::e_STRING: {
+            const bsl::string& string = value.theString();
+            cursor = writeBytes(cursor, string.data(), string.length());
+          } break;
+          case UserFieldType::e_DATETIMETZ: {
+            const bdlt::DatetimeTz& datetimeTz = value.theDatetimeTz();
+            cursor = writeZigzag(
+                          cursor,
+                          microsecondsFromOrigin(datetimeTz.localDatetime()));
+            cursor = writeZigzag(cursor, datetimeTz.offset());
+          } break;
+          case UserFieldType::e_CHAR_ARRAY: {
+            const bsl::vector<char>& array = value.theCharArray();
+            cursor = writeBytes(cursor, array.data(), array.size());
+          } break;
+        }
+    }
+
+    BSLS_ASSERT(cursor <= frame + maxSize);
+
+    *frame = static_cast<char>(e_RECORD_FRAME);
+    output->resize(framePosition + (cursor - frame));
+    endFrame(output, framePosition + k_FRAME_HEADER_SIZE);
+}
+
+void BinaryRecordEncoder::encodeHeader(bsl::vector<char> *output)
+{
+    BSLS_ASSERT(output);
+
+    d_strings.clear();
+    d_stringStorage.clear();
+    d_lastTimestamp = 0;
+    d_lastFileName.d_reference = 0;
+    d_lastCategory.d_reference = 0;
+
+    const bsl::size_t payloadPosition = beginFrame(output, e_HEADER_FRAME);
+    output->insert(output->end(), k_MAGIC, k_MAGIC + k_MAGIC_LENGTH);
+    endFrame(output, payloadPosition);
+}
+
+                        // -------------------------
+                        // class BinaryRecordDecoder
+                        // -------------------------
+
+// PRIVATE MANIPULATORS
+int BinaryRecordDecoder::decodeRecordPayload(Record *record)
+{
+    PayloadReader reader(d_payload.data(), d_payload.size());
+
+    RecordAttributes& fixedFields = record->fixedFields();
+
+    bdlt::Datetime timestamp;
+    Int64          lastTimestamp = d_lastTimestamp;
+
+    if (0 != reader.readTimestamp(&timestamp, &lastTimestamp)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int    processID = reader.readInt();
+    const Uint64 threadID  = reader.readVarint();
+
+    bsl::string        fileNameScratch(d_allocator_p);
+    const bsl::string *fileName;
+    if (0 != readStringReference(&fileName,
+                                 &fileNameScratch,
+                                 &reader,
+                                 d_strings)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int lineNumber = reader.readInt();
+
+    bsl::string        categoryScratch(d_allocator_p);
+    const bsl::string *category;
+    if (0 != readStringReference(&category,
+                                 &categoryScratch,
+                                 &reader,
+                                 d_strings)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int               severity = reader.readInt();
+    const bslstl::StringRef message  = reader.readBytes();
+    const Uint64            numUserFields = reader.readVarint();
+
+    // Each user field takes at least one byte.
+
+    if (!reader.isValid() || numUserFields > d_payload.size()) {
+        return -1;                                                    // RETURN
+    }
+
+    fixedFields.setTimestamp(timestamp);
+    fixedFields.setProcessID(processID);
+    fixedFields.setThreadID(threadID);
+    fixedFields.setFileName(fileName->c_str());
+    fixedFields.setLineNumber(lineNumber);
+    fixedFields.setCategory(category->c_str());
+    fixedFields.setSeverity(severity);
+    fixedFields.clearMessage();
+    fixedFields.messageStreamBuf().sputn(
+                               message.data(),
+                               static_cast<bsl::streamsize>(message.length()));
+
+    UserFields& userFields = record->customFields();
+    userFields.removeAll();
+
+    for (Uint64 i = 0; i < numUserFields; ++i) {
+        switch (reader.readByte()) {
+          case UserFieldType::e_VOID: {
+            userFields.appendNull();
+          } break;
+          case UserFieldType::e_INT64: {
+            userFields.appendInt64(reader.readZigzag());
+          } break;
+          case UserFieldType::e_DOUBLE: {
+            const Uint64 bits = reader.readFixed64();
+
+            double value;
+            bsl::memcpy(&value, &bits, sizeof value);
+            userFields.appendDouble(value);
+          } break;
+          case UserFieldType::e_STRING: {
+            userFields.appendString(reader.readBytes());
+          } break;
+          case UserFieldType::e_DATETIMETZ: {
+            bdlt::Datetime localDatetime;
+            if (0 != reader.readDatetime(&localDatetime)) {
+                return -1;                                            // RETURN
+            }
+
+            const int offset = reader.readInt();
+            if (!bdlt::DatetimeTz::isValid(localDatetime, offset)) {
+                return -1;                                            // RETURN
+            }
+            userFields.appendDatetimeTz(
+                                    bdlt::DatetimeTz(localDatetime, offset));
+          } break;
+          case UserFieldType::e_CHAR_ARRAY: {
+            const bslstl::StringRef bytes = reader.readBytes();
+
+            userFields.appendCharArray(bsl::vector<char>(bytes.begin(),
+                                                         bytes.end(),
+                                                         d_allocator_p));
+          } break;
+          default: {
+            return -1;                                                // RETURN
+          }
+        }
+
+        if (!reader.isValid()) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    d_lastTimestamp = lastTimestamp;
+    return 0;
+}
+
+// CREATORS
+BinaryRecordDecoder::BinaryRecordDecoder(bslma::Allocator *basicAllocator)
+: d_strings(basicAllocator)
+, d_payload(basicAllocator)
+, d_lastTimestamp(0)
+, d_hasHeader(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+// MANIPULATORS
+int BinaryRecordDecoder::decode(Record *record, bsl::streambuf *input)
+{
+    BSLS_ASSERT(record);
+    BSLS_ASSERT(input);
+
+    while (true) {
+        char header[k_FRAME_HEADER_SIZE];
+
+        const bsl::streamsize headerLength = input->sgetn(
+                                                         header,
+                                                         k_FRAME_HEADER_SIZE);
+        if (0 == headerLength) {
+            return 1;                                                 // RETURN
+        }
+        if (k_FRAME_HEADER_SIZE != headerLength) {
+            return -1;                                                // RETURN
+        }
+
+        const int type = static_cast<unsigned char>(header[0]);
+
+        Uint64 length = 0;
+        for (int i = 4; i >= 1; --i) {
+            length = (length << 8) | static_cast<unsigned char>(header[i]);
+        }
+
+        if (!d_hasHeader && e_HEADER_FRAME != type) {
+            return -2;                                                // RETURN
+        }
+        if (k_MAX_FRAME_LENGTH < length) {
+            return -3;                                                // RETURN
+        }
+
+        d_payload.resize(static_cast<bsl::size_t>(length));
+        if (0 < length
+         && static_cast<bsl::streamsize>(length) !=
+                    input->sgetn(d_payload.data(),
+                                 static_cast<bsl::streamsize>(length))) {
+            return -4;                                                // RETURN
+        }
+
+        switch (type) {
+          case e_HEADER_FRAME: {
+            if (k_MAGIC_LENGTH != length
+             || 0 != bsl::memcmp(d_payload.data(), k_MAGIC, k_MAGIC_LENGTH)) {
+                return -5;                                            // RETURN
+            }
+            d_strings.clear();
+            d_lastTimestamp = 0;
+            d_hasHeader     = true;
+          } break;
+          case e_STRING_FRAME: {
+            d_strings.emplace_back(d_payload.data(), d_payload.size());
+          } break;
+          case e_RECORD_FRAME: {
+            return 0 == decodeRecordPayload(record) ? 0 : -6;         // RETURN
+          } break;
+          default: {
+            // Skip frames of unrecognized type.
+          } break;
+        }
+    }
+}
+
+void BinaryRecordDecoder::reset()
+{
+    d_strings.clear();
+    d_lastTimestamp = 0;
+    d_hasHeader     = false;
+}
+
+                          // -----------------------
+                          // struct BinaryRecordUtil
+                          // -----------------------
+
+// CLASS METHODS
+int BinaryRecordUtil::convertToText(bsl::ostream&          output,
+                                    bsl::streambuf        *input,
+                                    const RecordFormatter& formatter,
+                                    int                   *numRecords)
+{
+    BSLS_ASSERT(input);
+
+    BinaryRecordDecoder decoder;
+    Record              record;
+    int                 count = 0;
+    int                 rc;
+
+    while (0 == (rc = decoder.decode(&record, input))) {
+        formatter(output, record);
+        if (!output) {
+            rc = -1;
+            break;
+        }
+        ++count;
+    }
+
+    if (numRecords) {
+        *numRecords = count;
+    }
+
+    return 0 < rc ? 0 : rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
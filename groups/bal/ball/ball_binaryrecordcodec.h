@@ -0,0 +1,454 @@
+// ball_binaryrecordcodec.h                                           -*-C++-*-
+#ifndef INCLUDED_BALL_BINARYRECORDCODEC
+#define INCLUDED_BALL_BINARYRECORDCODEC
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a compact binary encoding of log records.
+//
+//@CLASSES:
+//  ball::BinaryRecordEncoder: encoder of log records to the binary log format
+//  ball::BinaryRecordDecoder: decoder of log records from the binary format
+//  ball::BinaryRecordUtil: namespace for converting binary logs to text
+//
+//@SEE_ALSO: ball_binaryfileobserver, ball_record, ball_recordstringformatter
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'ball::BinaryRecordEncoder', that encodes log records ('ball::Record'
+// objects) in a compact binary format, the *binary log format*, a mechanism,
+// 'ball::BinaryRecordDecoder', that reconstructs the log records from their
+// encoding, and a utility 'struct', 'ball::BinaryRecordUtil', that converts a
+// binary log to text using a formatting functor such as a
+// 'ball::RecordStringFormatter'.
+//
+// Rendering a record to text (formatting its timestamp, converting its
+// numeric fields to decimal, and so on) accounts for most of the cost of
+// publishing it.  Encoding a record in the binary log format costs a small
+// fraction of that, and produces fewer bytes: the category and file names,
+// which are repeated in most records, are written once per log and thereafter
+// referred to by number, and integers, including the timestamp (encoded as a
+// difference from the timestamp of the preceding record), are written in a
+// variable-length form.  A binary log can be converted to text, with any
+// format, when (and if) it is read.
+//
+///Binary Log Format
+///-----------------
+// A binary log is a sequence of *frames*.  Each frame consists of a one-byte
+// frame type, the length, in bytes, of the frame payload as an unsigned
+// 32-bit little-endian integer, and the payload:
+//..
+//  log     := header frame*
+//  frame   := type:uint8 length:uint32le payload:byte[length]
+//..
+// The frame types are:
+//..
+//  Type  Name     Payload
+//  ----  -------  -----------------------------------------------------------
+//   1    header   the 8 characters "ballbin1"
+//   2    string   the characters of a string to be interned
+//   3    record   a log record, as described below
+//..
+// A header frame starts each log, and resets the state of the decoder: the
+// interned strings, and the timestamp from which the next timestamp is
+// encoded.  A log may therefore be appended to another log (e.g., when a file
+// observer is restarted), and the result read as one log.  The payload of a
+// string frame is interned as the string having the next number (starting at
+// 0 following a header frame).  Frames of any other type, and any bytes
+// following the fields of a record payload, are skipped by the decoder, so
+// that the format can be extended compatibly.
+//
+// The payload of a record frame is composed of the following fields, in
+// order, where 'varint' denotes an unsigned integer written in the LEB128
+// form (7 bits per byte, least significant group first, with the high bit set
+// in all but the last byte), and 'zigzag' a signed integer 'n' mapped to the
+// unsigned integer '(n << 1) ^ (n >> 63)' and written as a 'varint':
+//..
+//  Field       Encoding
+//  ----------  ---------------------------------------------------------------
+//  timestamp   zigzag: microseconds from the timestamp of the preceding record
+//              of the log (or from 0001/01/01_00:00:00.000000 for the first)
+//  processID   zigzag
+//  threadID    varint
+//  fileName    string reference
+//  lineNumber  zigzag
+//  category    string reference
+//  severity    zigzag
+//  message     varint length followed by the characters of the message
+//  userFields  varint count followed by, for each user field, a one-byte
+//              'ball::UserFieldType::Enum' value and the value of the field:
+//                e_VOID       : nothing
+//                e_INT64      : zigzag
+//                e_DOUBLE     : 8 bytes, the IEEE-754 representation of the
+//                               value as a little-endian integer
+//                e_STRING     : varint length followed by the characters
+//                e_DATETIMETZ : zigzag microseconds from
+//                               0001/01/01_00:00:00.000000 of the local
+//                               datetime, followed by zigzag offset (minutes)
+//                e_CHAR_ARRAY : varint length followed by the bytes
+//..
+// A *string reference* is a 'varint', 'n'.  If 'n' is 0, it is followed by the
+// 'varint' length and the characters of the string; otherwise, it refers to
+// the interned string numbered 'n - 1'.  The encoder interns each category
+// and file name the first time it is encoded, up to a maximum number of
+// interned strings supplied at construction, beyond which further names are
+// written in place.
+//
+// Note that the default value of 'bdlt::Datetime' (0001/01/01_24:00:00.000000)
+// is encoded, and therefore decoded, as 0001/01/01_00:00:00.000000.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding, Decoding and Converting Records
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to store log records compactly now, and render them
+// as text later.
+//
+// First, we create a record to encode:
+//..
+//  ball::RecordAttributes attributes(
+//                          bdlt::Datetime(2026, 10, 17, 12, 34, 56, 789, 12),
+//                          1234,
+//                          5678,
+//                          "myfile.cpp",
+//                          42,
+//                          "MY.CATEGORY",
+//                          ball::Severity::e_WARN,
+//                          "Hello, binary log!");
+//  ball::Record record(attributes, ball::UserFields());
+//..
+// Then, we start a new log in a buffer, and encode the record twice:
+//..
+//  ball::BinaryRecordEncoder encoder;
+//  bsl::vector<char>         log;
+//
+//  encoder.encodeHeader(&log);
+//  encoder.encode(&log, record);
+//
+//  const bsl::size_t firstSize = log.size();
+//
+//  encoder.encode(&log, record);
+//..
+// Notice that the second encoding of the record is much smaller than the
+// first, as the category and file names have been interned:
+//..
+//  assert(log.size() - firstSize < firstSize - 13);
+//..
+// Next, we decode the records from the buffer:
+//..
+//  bdlsb::FixedMemInStreamBuf input(log.data(), log.size());
+//
+//  ball::BinaryRecordDecoder decoder;
+//  ball::Record              decoded;
+//
+//  assert(0 == decoder.decode(&decoded, &input));
+//  assert(record == decoded);
+//
+//  assert(0 == decoder.decode(&decoded, &input));
+//  assert(record == decoded);
+//
+//  assert(0 <  decoder.decode(&decoded, &input));    // end of the log
+//..
+// Finally, we convert the log to text with a 'ball::RecordStringFormatter':
+//..
+//  bdlsb::FixedMemInStreamBuf input2(log.data(), log.size());
+//  bsl::ostringstream         text;
+//
+//  ball::RecordStringFormatter formatter("%s %c %m\n");
+//
+//  assert(0 == ball::BinaryRecordUtil::convertToText(text,
+//                                                    &input2,
+//                                                    formatter));
+//  assert("WARN MY.CATEGORY Hello, binary log!\n"
+//         "WARN MY.CATEGORY Hello, binary log!\n" == text.str());
+//..
+
+#include <balscm_version.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_types.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_iosfwd.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Record;
+
+                        // =========================
+                        // class BinaryRecordEncoder
+                        // =========================
+
+class BinaryRecordEncoder {
+    // This mechanism encodes log records in the binary log format (see {Binary
+    // Log Format}).  An encoder holds the state of the log being produced:
+    // the interned strings and the timestamp of the last record encoded.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum { k_DEFAULT_MAX_INTERNED_STRINGS = 4096 };
+        // Default maximum number of strings interned by an encoder.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<bslstl::StringRef, int, bslh::Hash<> >
+                                                                   StringTable;
+
+    struct LastString {
+        // This 'struct' caches the interned string last used for a field, as
+        // consecutive records very often share their category and file name,
+        // and comparing with the cached string is much cheaper than a lookup
+        // in the string table.
+
+        bslstl::StringRef   d_string;     // interned string, if
+                                          // 'd_reference' is not 0
+
+        bsls::Types::Uint64 d_reference;  // string reference of 'd_string',
+                                          // or 0 if the cache is empty
+    };
+
+    // DATA
+    bsl::deque<bsl::string>
+                       d_stringStorage;       // interned strings, in order;
+                                              // a 'deque', so that the keys
+                                              // of 'd_strings' remain valid
+
+    StringTable        d_strings;             // numbers of the interned
+                                              // strings, keyed by references
+                                              // to 'd_stringStorage'
+
+    int                d_maxInternedStrings;  // maximum size of 'd_strings'
+
+    bsls::Types::Int64 d_lastTimestamp;       // timestamp of the last record
+                                              // encoded (in microseconds
+                                              // from 0001/01/01)
+
+    LastString         d_lastFileName;        // last interned file name
+
+    LastString         d_lastCategory;        // last interned category
+
+  private:
+    // NOT IMPLEMENTED
+    BinaryRecordEncoder(const BinaryRecordEncoder&);
+    BinaryRecordEncoder& operator=(const BinaryRecordEncoder&);
+
+    // PRIVATE MANIPULATORS
+    bsls::Types::Uint64 internString(bsl::vector<char>        *output,
+                                     LastString               *lastString,
+                                     const bslstl::StringRef&  string);
+        // Return the string reference (see {Binary Log Format}) for the
+        // specified 'string', first interning 'string', and appending to the
+        // specified 'output' the string frame doing so, if 'string' is not
+        // interned and fewer than 'maxInternedStrings' strings are interned.
+        // Use and update the specified 'lastString' cache of the field whose
+        // value is 'string'.  Note that a returned value of 0 indicates that
+        // 'string' is to be written in place.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BinaryRecordEncoder,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BinaryRecordEncoder(bslma::Allocator *basicAllocator = 0);
+    explicit BinaryRecordEncoder(int               maxInternedStrings,
+                                 bslma::Allocator *basicAllocator = 0);
+        // Create an encoder that interns at most 'maxInternedStrings' strings
+        // per log, or 'k_DEFAULT_MAX_INTERNED_STRINGS' if 'maxInternedStrings'
+        // is not specified.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 <= maxInternedStrings'.  Note that 'encodeHeader' must be called
+        // to start a log before 'encode' is called.
+
+    // ~BinaryRecordEncoder() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void encode(bsl::vector<char> *output, const Record& record);
+        // Append to the specified 'output' the encoding of the specified
+        // 'record', preceded by the string frames interning its category and
+        // file names if they were not previously interned (and fewer than
+        // 'maxInternedStrings' strings are interned).  The behavior is
+        // undefined unless 'encodeHeader' has been called.
+
+    void encodeHeader(bsl::vector<char> *output);
+        // Append to the specified 'output' a header frame, starting a new log,
+        // and reset the state of this encoder: forget the interned strings,
+        // and encode the timestamp of the next record from
+        // 0001/01/01_00:00:00.000000.
+
+    // ACCESSORS
+    int maxInternedStrings() const;
+        // Return the maximum number of strings that this encoder interns per
+        // log.
+
+    int numInternedStrings() const;
+        // Return the number of strings interned in the current log.
+};
+
+                        // =========================
+                        // class BinaryRecordDecoder
+                        // =========================
+
+class BinaryRecordDecoder {
+    // This mechanism decodes log records from the binary log format (see
+    // {Binary Log Format}).  A decoder holds the state of the log being read:
+    // the interned strings and the timestamp of the last record decoded.
+
+    // DATA
+    bsl::vector<bsl::string> d_strings;        // interned strings
+
+    bsl::vector<char>        d_payload;        // payload of the current frame
+
+    bsls::Types::Int64       d_lastTimestamp;  // timestamp of the last record
+                                               // decoded (in microseconds
+                                               // from 0001/01/01)
+
+    bool                     d_hasHeader;      // 'true' if a header frame has
+                                               // been read
+
+    bslma::Allocator        *d_allocator_p;    // memory allocator (held, not
+                                               // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    BinaryRecordDecoder(const BinaryRecordDecoder&);
+    BinaryRecordDecoder& operator=(const BinaryRecordDecoder&);
+
+    // PRIVATE MANIPULATORS
+    int decodeRecordPayload(Record *record);
+        // Load into the specified 'record' the record encoded by the payload
+        // of the current frame.  Return 0 on success, and a non-zero value if
+        // the payload is malformed.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BinaryRecordDecoder,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BinaryRecordDecoder(bslma::Allocator *basicAllocator = 0);
+        // Create a decoder expecting the start of a log.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.
+
+    // ~BinaryRecordDecoder() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int decode(Record *record, bsl::streambuf *input);
+        // Read frames from the specified 'input' up to, and including, the
+        // next record frame, and load into the specified 'record' the record
+        // it encodes.  Return 0 on success, a positive value, with no effect
+        // on 'record', if 'input' holds no further frame, and a negative
+        // value if the frames read from 'input' are malformed or truncated,
+        // or if the log does not start with a header frame, in which case the
+        // value of 'record' is valid but unspecified, and the position of
+        // 'input' is unspecified.
+
+    void reset();
+        // Reset this decoder to expect the start of a log.
+
+    // ACCESSORS
+    int numInternedStrings() const;
+        // Return the number of strings interned in the log being read.
+};
+
+                          // =======================
+                          // struct BinaryRecordUtil
+                          // =======================
+
+struct BinaryRecordUtil {
+    // This 'struct' provides a namespace for utility functions operating on
+    // logs in the binary log format.
+
+    // TYPES
+    typedef bsl::function<void(bsl::ostream&, const Record&)> RecordFormatter;
+        // 'RecordFormatter' is an alias for the type of the functor used to
+        // format log records to a stream (e.g., a
+        // 'ball::RecordStringFormatter').
+
+    // CLASS METHODS
+    static int convertToText(bsl::ostream&          output,
+                             bsl::streambuf        *input,
+                             const RecordFormatter& formatter,
+                             int                   *numRecords = 0);
+        // Decode the log records in the binary log format read from the
+        // specified 'input' until its end, and write each, in order, to the
+        // specified 'output' using the specified 'formatter'.  Optionally
+        // specify 'numRecords', into which the number of records written is
+        // loaded.  Return 0 on success, and a non-zero value if the binary
+        // log is malformed or truncated, or if 'output' fails, in which case
+        // the records preceding the error have been written.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // -------------------------
+                        // class BinaryRecordEncoder
+                        // -------------------------
+
+// ACCESSORS
+inline
+int BinaryRecordEncoder::maxInternedStrings() const
+{
+    return d_maxInternedStrings;
+}
+
+inline
+int BinaryRecordEncoder::numInternedStrings() const
+{
+    return static_cast<int>(d_strings.size());
+}
+
+                        // -------------------------
+                        // class BinaryRecordDecoder
+                        // -------------------------
+
+// ACCESSORS
+inline
+int BinaryRecordDecoder::numInternedStrings() const
+{
+    return static_cast<int>(d_strings.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1190 @@
+// ball_binaryrecordcodec.t.cpp                                       -*-C++-*-
+#include <ball_binaryrecordcodec.h>
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+#include <ball_userfieldtype.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides an encoder and a decoder of log records
+// in the binary log format, and a utility converting a binary log to text.
+// We verify that every field of a record, including extreme values and every
+// type of user field, survives an encoding followed by a decoding; that
+// category and file names are interned as specified; that malformed or
+// truncated input is rejected without undefined behavior; and that the
+// conversion to text matches formatting the original records.
+// ----------------------------------------------------------------------------
+// BinaryRecordEncoder
+// [ 2] BinaryRecordEncoder(bslma::Allocator *basicAllocator = 0);
+// [ 3] BinaryRecordEncoder(int maxInternedStrings, bslma::Allocator * = 0);
+// [ 2] void encode(bsl::vector<char> *output, const Record& record);
+// [ 2] void encodeHeader(bsl::vector<char> *output);
+// [ 3] int maxInternedStrings() const;
+// [ 3] int numInternedStrings() const;
+//
+// BinaryRecordDecoder
+// [ 2] BinaryRecordDecoder(bslma::Allocator *basicAllocator = 0);
+// [ 2] int decode(Record *record, bsl::streambuf *input);
+// [ 3] void reset();
+// [ 3] int numInternedStrings() const;
+//
+// BinaryRecordUtil
+// [ 5] int convertToText(ostream&, streambuf *, const RecordFormatter&, int*);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: MALFORMED AND TRUNCATED INPUT IS REJECTED
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: ENCODING VERSUS FORMATTING
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef ball::BinaryRecordEncoder Encoder;
+typedef ball::BinaryRecordDecoder Decoder;
+typedef ball::BinaryRecordUtil    Util;
+typedef bsls::Types::Int64        Int64;
+typedef bsls::Types::Uint64       Uint64;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+ball::Record makeRecord(const bdlt::Datetime&  timestamp,
+                        int                    processID,
+                        Uint64                 threadID,
+                        const char            *fileName,
+                        int                    lineNumber,
+                        const char            *category,
+                        int                    severity,
+                        const char            *message,
+                        bslma::Allocator      *basicAllocator = 0)
+    // Return a record having the specified 'timestamp', 'processID',
+    // 'threadID', 'fileName', 'lineNumber', 'category', 'severity', and
+    // 'message', and no user fields.  Optionally specify a 'basicAllocator'
+    // used to supply memory.
+{
+    ball::RecordAttributes attributes(timestamp,
+                                      processID,
+                                      threadID,
+                                      fileName,
+                                      lineNumber,
+                                      category,
+                                      severity,
+                                      message,
+                                      basicAllocator);
+
+    return ball::Record(attributes,
+                        ball::UserFields(basicAllocator),
+                        basicAllocator);
+}
+
+int decodeAll(bsl::vector<ball::Record> *records,
+              const bsl::vector<char>&   log)
+    // Decode the records of the specified 'log', appending them to the
+    // specified 'records'.  Return the (non-zero) value returned by
+    // 'Decoder::decode' that ended the decoding.
+{
+    bdlsb::FixedMemInStreamBuf input(log.data(), log.size());
+
+    Decoder      decoder;
+    ball::Record record;
+    int          rc;
+
+    while (0 == (rc = decoder.decode(&record, &input))) {
+        records->push_back(record);
+    }
+    return rc;
+}
+
+void appendFrame(bsl::vector<char> *log,
+                 int                type,
+                 const char        *payload,
+                 bsl::size_t        length)
+    // Append to the specified 'log' a frame of the specified 'type' having
+    // the specified 'payload' of the specified 'length'.
+{
+    log->push_back(static_cast<char>(type));
+    for (int i = 0; i < 4; ++i) {
+        log->push_back(static_cast<char>((length >> (8 * i)) & 0xff));
+    }
+    log->insert(log->end(), payload, payload + length);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Example 1: Encoding, Decoding and Converting Records
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to store log records compactly now, and render them
+// as text later.
+//
+// First, we create a record to encode:
+//..
+        ball::RecordAttributes attributes(
+                            bdlt::Datetime(2026, 10, 17, 12, 34, 56, 789, 12),
+                            1234,
+                            5678,
+                            "myfile.cpp",
+                            42,
+                            "MY.CATEGORY",
+                            ball::Severity::e_WARN,
+                            "Hello, binary log!");
+        ball::Record record(attributes, ball::UserFields());
+//..
+// Then, we start a new log in a buffer, and encode the record twice:
+//..
+        ball::BinaryRecordEncoder encoder;
+        bsl::vector<char>         log;
+
+        encoder.encodeHeader(&log);
+        encoder.encode(&log, record);
+
+        const bsl::size_t firstSize = log.size();
+
+        encoder.encode(&log, record);
+//..
+// Notice that the second encoding of the record is much smaller than the
+// first, as the category and file names have been interned:
+//..
+        ASSERT(log.size() - firstSize < firstSize - 13);
+//..
+// Next, we decode the records from the buffer:
+//..
+        bdlsb::FixedMemInStreamBuf input(log.data(), log.size());
+
+        ball::BinaryRecordDecoder decoder;
+        ball::Record              decoded;
+
+        ASSERT(0 == decoder.decode(&decoded, &input));
+        ASSERT(record == decoded);
+
+        ASSERT(0 == decoder.decode(&decoded, &input));
+        ASSERT(record == decoded);
+
+        ASSERT(0 <  decoder.decode(&decoded, &input));    // end of the log
+//..
+// Finally, we convert the log to text with a 'ball::RecordStringFormatter':
+//..
+        bdlsb::FixedMemInStreamBuf input2(log.data(), log.size());
+        bsl::ostringstream         text;
+
+        ball::RecordStringFormatter formatter("%s %c %m\n");
+
+        ASSERT(0 == ball::BinaryRecordUtil::convertToText(text,
+                                                          &input2,
+                                                          formatter));
+        ASSERT("WARN MY.CATEGORY Hello, binary log!\n"
+               "WARN MY.CATEGORY Hello, binary log!\n" == text.str());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'convertToText'
+        //
+        // Concerns:
+        //: 1 'convertToText' writes each record of the log, in order, as
+        //:   formatted by the supplied functor.
+        //:
+        //: 2 The number of records written is loaded into the optional
+        //:   'numRecords'.
+        //:
+        //: 3 A malformed log is reported, after the records preceding the
+        //:   error are written.
+        //
+        // Plan:
+        //: 1 Encode a sequence of records, convert the log to text with a
+        //:   'ball::RecordStringFormatter', and compare with formatting the
+        //:   records directly.  (C-1..2)
+        //:
+        //: 2 Truncate the log in the middle of its last record, and verify
+        //:   that a non-zero value is returned and the other records are
+        //:   written.  (C-3)
+        //
+        // Testing:
+        //   int convertToText(ostream&, streambuf *, const RecordFormatter&,
+        //                     int*);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'convertToText'"
+                          << "\n=======================" << endl;
+
+        enum { k_NUM_RECORDS = 50 };
+
+        const ball::RecordStringFormatter formatter(
+                                           "\n%d %p:%t %s %f:%l %c %m %u\n");
+
+        bsl::vector<char>  log;
+        bsl::ostringstream expected;
+        Encoder            encoder;
+
+        encoder.encodeHeader(&log);
+
+        bsl::size_t lastRecordPosition = 0;
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream message;
+            message << "message " << i;
+
+            ball::Record record = makeRecord(
+                     bdlt::Datetime(2026, 1, 1 + i % 28, i % 24, i, i, i, i),
+                     100 + i,
+                     1000 + i,
+                     i % 2 ? "odd.cpp" : "even.cpp",
+                     i,
+                     i % 3 ? "CATEGORY.A" : "CATEGORY.B",
+                     32 * (1 + i % 6),
+                     message.str().c_str());
+
+            record.customFields().appendInt64(i);
+            record.customFields().appendString("user");
+
+            lastRecordPosition = log.size();
+            encoder.encode(&log, record);
+            formatter(expected, record);
+        }
+
+        {
+            bdlsb::FixedMemInStreamBuf input(log.data(), log.size());
+            bsl::ostringstream         text;
+            int                        numRecords = -1;
+
+            ASSERT(0 == Util::convertToText(text,
+                                            &input,
+                                            formatter,
+                                            &numRecords));
+            ASSERTV(numRecords, k_NUM_RECORDS == numRecords);
+            ASSERTV(expected.str(), text.str(), expected.str() == text.str());
+
+            bdlsb::FixedMemInStreamBuf input2(log.data(), log.size());
+            bsl::ostringstream         text2;
+
+            ASSERT(0 == Util::convertToText(text2, &input2, formatter));
+            ASSERT(expected.str() == text2.str());
+        }
+
+        if (veryVerbose) cout << "\tTesting a truncated log." << endl;
+        {
+            bdlsb::FixedMemInStreamBuf input(log.data(), log.size() - 3);
+            bsl::ostringstream         text;
+            int                        numRecords = -1;
+
+            ASSERT(0 != Util::convertToText(text,
+                                            &input,
+                                            formatter,
+                                            &numRecords));
+            ASSERTV(numRecords, k_NUM_RECORDS - 1 == numRecords);
+
+            // Compare with the records preceding the last one.
+
+            bdlsb::FixedMemInStreamBuf input2(log.data(), lastRecordPosition);
+            bsl::ostringstream         text2;
+
+            ASSERT(0 == Util::convertToText(text2, &input2, formatter));
+            ASSERT(text2.str() == text.str());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: MALFORMED AND TRUNCATED INPUT IS REJECTED
+        //
+        // Concerns:
+        //: 1 An empty input is a log holding no record.
+        //:
+        //: 2 A log not starting with a valid header frame is rejected.
+        //:
+        //: 3 A log truncated at any byte is either read in full up to a frame
+        //:   boundary, or rejected; it is never misread.
+        //:
+        //: 4 A record frame referring to a string that is not interned, or
+        //:   holding a user field of unknown type, or fields extending past
+        //:   its payload, is rejected.
+        //:
+        //: 5 Frames of unknown type, and bytes following the fields of a
+        //:   record payload, are skipped.
+        //
+        // Plan:
+        //: 1 Decode an empty input.  (C-1)
+        //:
+        //: 2 Decode logs starting with a record frame, and with a header
+        //:   frame having a wrong magic or length.  (C-2)
+        //:
+        //: 3 Decode every prefix of a valid log, and verify that the records
+        //:   decoded are a prefix of the encoded records, and that decoding
+        //:   succeeds if, and only if, the prefix ends at a frame boundary.
+        //:   (C-3)
+        //:
+        //: 4 Decode hand-built record frames.  (C-4..5)
+        //
+        // Testing:
+        //   CONCERN: MALFORMED AND TRUNCATED INPUT IS REJECTED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: MALFORMED AND TRUNCATED INPUT IS "
+                             "REJECTED"
+                          << "\n==========================================="
+                             "========" << endl;
+
+        if (veryVerbose) cout << "\tTesting empty input." << endl;
+        {
+            bsl::vector<ball::Record> records;
+            bsl::vector<char>         log;
+
+            ASSERT(0 < decodeAll(&records, log));
+            ASSERT(records.empty());
+        }
+
+        if (veryVerbose) cout << "\tTesting the header." << endl;
+        {
+            const ball::Record record = makeRecord(bdlt::Datetime(2026, 1, 1),
+                                                   1,
+                                                   2,
+                                                   "file",
+                                                   3,
+                                                   "CAT",
+                                                   32,
+                                                   "message");
+
+            bsl::vector<char> valid;
+            Encoder           encoder;
+
+            encoder.encodeHeader(&valid);
+            encoder.encode(&valid, record);
+
+            const bsl::size_t headerLength = 13;
+
+            {
+                bsl::vector<ball::Record> records;
+
+                ASSERT(0 < decodeAll(&records, valid));
+                ASSERT(1 == records.size());
+            }
+            {
+                // No header.
+
+                bsl::vector<char> log(valid.begin() + headerLength,
+                                      valid.end());
+
+                bsl::vector<ball::Record> records;
+
+                ASSERT(0 > decodeAll(&records, log));
+                ASSERT(records.empty());
+            }
+            {
+                // Wrong magic.
+
+                bsl::vector<char> log(valid);
+                log[5] = 'B';
+
+                bsl::vector<ball::Record> records;
+
+                ASSERT(0 > decodeAll(&records, log));
+                ASSERT(records.empty());
+            }
+            {
+                // Wrong header length.
+
+                bsl::vector<char> log;
+                appendFrame(&log, 1, "ballbin1x", 9);
+                log.insert(log.end(), valid.begin() + headerLength,
+                           valid.end());
+
+                bsl::vector<ball::Record> records;
+
+                ASSERT(0 > decodeAll(&records, log));
+                ASSERT(records.empty());
+            }
+            {
+                // Excessive frame length.
+
+                bsl::vector<char> log(valid.begin(),
+                                      valid.begin() + headerLength);
+                const char frame[] = { 3, 0, 0, 0, 0x7f };
+                log.insert(log.end(), frame, frame + sizeof frame);
+
+                bsl::vector<ball::Record> records;
+
+                ASSERT(0 > decodeAll(&records, log));
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting truncated logs." << endl;
+        {
+            enum { k_NUM_RECORDS = 6 };
+
+            bsl::vector<ball::Record> expected;
+            bsl::vector<char>         log;
+            Encoder                   encoder;
+
+            encoder.encodeHeader(&log);
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                ball::Record record = makeRecord(
+                                      bdlt::Datetime(2026, 1, 1, 0, 0, i),
+                                      i,
+                                      i,
+                                      i % 2 ? "file1" : "file2",
+                                      i,
+                                      i < 3 ? "CAT1" : "CAT2",
+                                      32,
+                                      "truncated message");
+                record.customFields().appendDouble(i + 0.5);
+                record.customFields().appendDatetimeTz(bdlt::DatetimeTz(
+                                       bdlt::Datetime(2026, 1, 1), -60 * i));
+
+                encoder.encode(&log, record);
+                expected.push_back(record);
+            }
+
+            // Find the frame boundaries, including those of the frames of
+            // interned strings.
+
+            bsl::vector<bsl::size_t> boundaries;
+            for (bsl::size_t position = 0; position < log.size();) {
+                bsl::size_t length = 0;
+                for (int i = 0; i < 4; ++i) {
+                    const unsigned char byte = log[position + 1 + i];
+
+                    length |= static_cast<bsl::size_t>(byte) << (8 * i);
+                }
+                position += 5 + length;
+                boundaries.push_back(position);
+            }
+            ASSERT(log.size() == boundaries.back());
+
+            for (bsl::size_t length = 0; length <= log.size(); ++length) {
+                bsl::vector<char> prefix(log.begin(), log.begin() + length);
+
+                bsl::vector<ball::Record> records;
+                const int rc = decodeAll(&records, prefix);
+
+                const bool isBoundary = 0 == length
+                                     || boundaries.end() != bsl::find(
+                                                            boundaries.begin(),
+                                                            boundaries.end(),
+                                                            length);
+
+                if (veryVeryVerbose) { T_; T_; P_(length); P(rc); }
+
+                ASSERTV(length, rc, isBoundary == (0 < rc));
+                ASSERTV(length, records.size() <= expected.size());
+
+                if (length == log.size()) {
+                    ASSERT(expected.size() == records.size());
+                }
+
+                for (bsl::size_t i = 0; i < records.size(); ++i) {
+                    ASSERTV(length, i, expected[i] == records[i]);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting record frames." << endl;
+        {
+            bsl::vector<char> header;
+            appendFrame(&header, 1, "ballbin1", 8);
+
+            // Each payload starts with the fields of a minimal record, all
+            // zero: timestamp, processID, threadID, fileName (as a string
+            // reference '0' followed by a length '0'), lineNumber, category
+            // (likewise), severity, and message length, followed by the number
+            // of user fields, and the user fields.
+
+            struct {
+                int         d_line;
+                const char *d_payload;
+                int         d_length;
+                int         d_isValid;
+            } DATA[] = {
+                //LINE  PAYLOAD                                    LEN  VALID
+                //----  -----------------------------------------  ---  -----
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\0",                   11,   1 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\0trailing",           19,   1 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0",                     10,   0 },
+                { L_,   "\0\0\0\1\0\0\0\0\0\0",                     10,   0 },
+                { L_,   "\0\0\0\0\0\0\1\0\0\0",                     10,   0 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\1\0",                 12,   1 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\1\7",                 12,   0 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\1\1",                 12,   0 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\1\1\2",               13,   1 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\1\3\5ab",             15,   0 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\1\3\2ab",             15,   1 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\2\0",                 12,   0 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\5abc",                  13,   0 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\1\2\1\2\3\4\5\6\7",   19,   0 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\1\4\0\0",             14,   1 },
+                { L_,   "\0\0\0\0\0\0\0\0\0\0\1\4\0\xc0\x16",       15,   0 },
+                { L_,   "\x80\x80\x80\x80\x80\x80\x80\x80\x80\x80\x01"
+                        "\0\0\0\0\0\0\0\0\0\0",                     21,   0 },
+                { L_,   "\0\x80\x80\x80\x80\x20"
+                        "\0\0\0\0\0\0\0\0\0",                       15,   0 },
+                { L_,   "\1\0\0\0\0\0\0\0\0\0\0",                   11,   0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *PAYLOAD  = DATA[ti].d_payload;
+                const int   LENGTH   = DATA[ti].d_length;
+                const bool  IS_VALID = DATA[ti].d_isValid;
+
+                bsl::vector<char> log(header);
+                appendFrame(&log, 9, "unknown", 7);
+                appendFrame(&log, 3, PAYLOAD, LENGTH);
+
+                bsl::vector<ball::Record> records;
+                const int rc = decodeAll(&records, log);
+
+                if (veryVeryVerbose) { T_; T_; P_(LINE); P(rc); }
+
+                ASSERTV(LINE, rc, IS_VALID == (0 < rc));
+                ASSERTV(LINE, records.size(),
+                        (IS_VALID ? 1u : 0u) == records.size());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING INTERNING
+        //
+        // Concerns:
+        //: 1 Each distinct category and file name is interned once per log,
+        //:   and a repeated name is encoded as a reference.
+        //:
+        //: 2 At most 'maxInternedStrings' strings are interned; further names
+        //:   are written in place, and still decoded correctly.
+        //:
+        //: 3 'encodeHeader' resets the interned strings and the timestamp
+        //:   base, so that logs can be concatenated and read as one.
+        //:
+        //: 4 'reset' makes a decoder expect the start of a log.
+        //
+        // Plan:
+        //: 1 Encode records with repeated and distinct names, checking
+        //:   'numInternedStrings' and the encoded size.  (C-1)
+        //:
+        //: 2 Repeat with encoders constructed with 'maxInternedStrings' of 0,
+        //:   1 and 2, decoding and comparing the records.  (C-2)
+        //:
+        //: 3 Concatenate two logs, decode the result, and verify the decoder
+        //:   state.  (C-3)
+        //:
+        //: 4 Decode part of a log, call 'reset', and decode a new log.  (C-4)
+        //
+        // Testing:
+        //   BinaryRecordEncoder(int maxInternedStrings, bslma::Allocator *);
+        //   int maxInternedStrings() const;
+        //   int numInternedStrings() const;
+        //   void reset();
+        //   int numInternedStrings() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING INTERNING"
+                          << "\n=================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const ball::Record A = makeRecord(bdlt::Datetime(2026, 5, 5),
+                                          1, 1, "a.cpp", 1, "CAT.A", 32, "m");
+        const ball::Record B = makeRecord(bdlt::Datetime(2026, 5, 5),
+                                          1, 1, "b.cpp", 1, "CAT.A", 32, "m");
+        const ball::Record C = makeRecord(bdlt::Datetime(2026, 5, 5),
+                                          1, 1, "b.cpp", 1, "CAT.C", 32, "m");
+        const ball::Record Z = makeRecord(bdlt::Datetime(2026, 5, 5),
+                                          1, 1, "z.cpp", 1, "CAT.Z", 32, "m");
+
+        if (veryVerbose) cout << "\tTesting repeated names." << endl;
+        {
+            Encoder mX(&ta);  const Encoder& X = mX;
+
+            ASSERT(Encoder::k_DEFAULT_MAX_INTERNED_STRINGS ==
+                                                      X.maxInternedStrings());
+            ASSERT(0 == X.numInternedStrings());
+
+            bsl::vector<char> log;
+            mX.encodeHeader(&log);
+
+            // Encode 'Z' first, so that the timestamps of the records compared
+            // below are encoded as the same (null) delta.
+
+            mX.encode(&log, Z);
+            ASSERT(2 == X.numInternedStrings());
+
+            bsl::size_t size = log.size();
+            mX.encode(&log, A);
+            ASSERT(4 == X.numInternedStrings());
+
+            const bsl::size_t firstSize = log.size() - size;
+
+            size = log.size();
+            mX.encode(&log, A);
+            ASSERT(4 == X.numInternedStrings());
+
+            // The string frames of "a.cpp" and "CAT.A" are not repeated.
+
+            ASSERTV(firstSize, log.size() - size,
+                    firstSize - (5 + 5) - (5 + 5) == log.size() - size);
+
+            mX.encode(&log, B);
+            ASSERT(5 == X.numInternedStrings());
+
+            mX.encode(&log, C);
+            ASSERT(6 == X.numInternedStrings());
+
+            bsl::vector<ball::Record> records;
+            ASSERT(0 < decodeAll(&records, log));
+            ASSERT(5 == records.size());
+            ASSERT(Z == records[0]);
+            ASSERT(A == records[1]);
+            ASSERT(A == records[2]);
+            ASSERT(B == records[3]);
+            ASSERT(C == records[4]);
+
+            mX.encodeHeader(&log);
+            ASSERT(0 == X.numInternedStrings());
+        }
+
+        if (veryVerbose) cout << "\tTesting 'maxInternedStrings'." << endl;
+        for (int max = 0; max <= 2; ++max) {
+            Encoder mX(max, &ta);  const Encoder& X = mX;
+
+            ASSERT(max == X.maxInternedStrings());
+
+            bsl::vector<char> log;
+            mX.encodeHeader(&log);
+            mX.encode(&log, A);
+            mX.encode(&log, B);
+            mX.encode(&log, C);
+            mX.encode(&log, A);
+
+            ASSERTV(max, X.numInternedStrings(),
+                    max == X.numInternedStrings());
+
+            bsl::vector<ball::Record> records;
+            ASSERT(0 < decodeAll(&records, log));
+            ASSERT(4 == records.size());
+            ASSERT(A == records[0]);
+            ASSERT(B == records[1]);
+            ASSERT(C == records[2]);
+            ASSERT(A == records[3]);
+        }
+
+        if (veryVerbose) cout << "\tTesting concatenated logs." << endl;
+        {
+            const ball::Record D = makeRecord(bdlt::Datetime(2000, 1, 1),
+                                              1, 1, "d.cpp", 1, "D", 32, "d");
+
+            Encoder encoder1(&ta);
+            Encoder encoder2(&ta);
+
+            bsl::vector<char> log;
+            encoder1.encodeHeader(&log);
+            encoder1.encode(&log, A);
+            encoder1.encode(&log, B);
+
+            encoder2.encodeHeader(&log);
+            encoder2.encode(&log, D);
+            encoder2.encode(&log, A);
+
+            bdlsb::FixedMemInStreamBuf input(log.data(), log.size());
+
+            Decoder      mX(&ta);  const Decoder& X = mX;
+            ball::Record record;
+
+            ASSERT(0 == X.numInternedStrings());
+
+            ASSERT(0 == mX.decode(&record, &input));  ASSERT(A == record);
+            ASSERT(0 == mX.decode(&record, &input));  ASSERT(B == record);
+            ASSERT(3 == X.numInternedStrings());
+
+            ASSERT(0 == mX.decode(&record, &input));  ASSERT(D == record);
+            ASSERT(2 == X.numInternedStrings());
+
+            ASSERT(0 == mX.decode(&record, &input));  ASSERT(A == record);
+            ASSERT(4 == X.numInternedStrings());
+
+            ASSERT(0 <  mX.decode(&record, &input));  ASSERT(A == record);
+        }
+
+        if (veryVerbose) cout << "\tTesting 'reset'." << endl;
+        {
+            Encoder encoder(&ta);
+
+            bsl::vector<char> log;
+            encoder.encodeHeader(&log);
+            encoder.encode(&log, A);
+            encoder.encode(&log, B);
+
+            const bsl::size_t headerLength = 13;
+
+            bdlsb::FixedMemInStreamBuf input(log.data(), log.size());
+
+            Decoder      mX(&ta);  const Decoder& X = mX;
+            ball::Record record;
+
+            ASSERT(0 == mX.decode(&record, &input));  ASSERT(A == record);
+            ASSERT(2 == X.numInternedStrings());
+
+            mX.reset();
+            ASSERT(0 == X.numInternedStrings());
+
+            // A log is expected: the remaining frames are rejected.
+
+            ASSERT(0 >  mX.decode(&record, &input));
+
+            mX.reset();
+
+            bdlsb::FixedMemInStreamBuf input2(log.data(), log.size());
+            ASSERT(0 == mX.decode(&record, &input2));  ASSERT(A == record);
+
+            // Without 'reset', a log not starting with a header is read with
+            // the current state.
+
+            bsl::vector<char> tail(log.begin() + headerLength, log.end());
+            bdlsb::FixedMemInStreamBuf input3(tail.data(), tail.size());
+
+            mX.reset();
+            ASSERT(0 > mX.decode(&record, &input3));
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'encode' AND 'decode'
+        //
+        // Concerns:
+        //: 1 Every field of a record is decoded to its encoded value,
+        //:   including the extreme values of each field.
+        //:
+        //: 2 Every type of user field is decoded to its encoded value.
+        //:
+        //: 3 Timestamps are decoded correctly whether they increase or
+        //:   decrease from record to record.
+        //:
+        //: 4 A log holding only a header holds no record.
+        //:
+        //: 5 All memory is supplied by the supplied allocators.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, encode records having varied
+        //:   and extreme field values into one log, decode the log, and
+        //:   compare the decoded records with the originals.  (C-1..3, 5)
+        //:
+        //: 2 Decode a log holding only a header.  (C-4)
+        //
+        // Testing:
+        //   BinaryRecordEncoder(bslma::Allocator *basicAllocator = 0);
+        //   void encode(bsl::vector<char> *output, const Record& record);
+        //   void encodeHeader(bsl::vector<char> *output);
+        //   BinaryRecordDecoder(bslma::Allocator *basicAllocator = 0);
+        //   int decode(Record *record, bsl::streambuf *input);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'encode' AND 'decode'"
+                          << "\n=============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const bdlt::Datetime MIN_DT(1, 1, 1);
+        const bdlt::Datetime MAX_DT(9999, 12, 31, 23, 59, 59, 999, 999);
+
+        const Uint64 MAX_U64 = bsl::numeric_limits<Uint64>::max();
+
+        static const struct {
+            int         d_line;
+            int         d_year;       // timestamp: 0 for 'MIN_DT', -1 for
+                                      // 'MAX_DT'
+            int         d_microsecond;
+            int         d_processID;
+            Uint64      d_threadID;
+            const char *d_fileName;
+            int         d_lineNumber;
+            const char *d_category;
+            int         d_severity;
+            const char *d_message;
+        } DATA[] = {
+            //LN  YEAR  US   PID      TID      FILE     LINE     CAT      SEV
+            //--  ----  ---  -------  -------  -------  -------  -------  ---
+            //MESSAGE
+            //-------
+            { L_, 2026,  1,       1,       1, "f.cpp",      10,  "C",     32,
+              "message" },
+            { L_, 2026,  2,       1,       1, "f.cpp",      10,  "C",     32,
+              "" },
+            { L_, 2025,  0,       0,       0, "",            0,  "",       0,
+              "earlier timestamp" },
+            { L_,    0,  0, INT_MIN,       0, "g.cpp", INT_MIN,  "D", INT_MIN,
+              "minimum values" },
+            { L_,   -1,  0, INT_MAX, MAX_U64, "g.cpp", INT_MAX,  "D", INT_MAX,
+              "maximum values" },
+            { L_,    0,  0,      -1,       2, "h.cpp",      -1,  "E",     -1,
+              "back to the minimum timestamp" },
+            { L_, 2026,  3,   12345,   54321,
+              "/a/very/long/path/to/a/source/file/with/a/long/name.cpp",
+                                                     123456,
+                                                       "A.LONG.CATEGORY.NAME",
+                                                                         96,
+              "a message that is long enough to exercise multi-byte varint "
+              "lengths: 0123456789012345678901234567890123456789012345678901"
+              "23456789012345678901234567890123456789012345678901234567890" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bsl::vector<ball::Record> expected(&ta);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const bdlt::Datetime TIMESTAMP =
+                  0 == DATA[ti].d_year ? MIN_DT
+                : 0 >  DATA[ti].d_year ? MAX_DT
+                :     bdlt::Datetime(DATA[ti].d_year, 6, 15, 12, 30, 45, 500,
+                                     DATA[ti].d_microsecond);
+
+            ball::Record record = makeRecord(TIMESTAMP,
+                                             DATA[ti].d_processID,
+                                             DATA[ti].d_threadID,
+                                             DATA[ti].d_fileName,
+                                             DATA[ti].d_lineNumber,
+                                             DATA[ti].d_category,
+                                             DATA[ti].d_severity,
+                                             DATA[ti].d_message,
+                                             &ta);
+
+            ball::UserFields& fields = record.customFields();
+
+            switch (ti % 3) {
+              case 0: {
+                fields.appendNull();
+                fields.appendInt64(bsl::numeric_limits<Int64>::min());
+                fields.appendInt64(bsl::numeric_limits<Int64>::max());
+                fields.appendInt64(0);
+                fields.appendInt64(-ti);
+              } break;
+              case 1: {
+                fields.appendDouble(0.0);
+                fields.appendDouble(-1.5e300);
+                fields.appendDouble(bsl::numeric_limits<double>::infinity());
+                fields.appendDouble(bsl::numeric_limits<double>::min());
+                fields.appendString("");
+                fields.appendString(bsl::string(300, 's'));
+              } break;
+              case 2: {
+                fields.appendDatetimeTz(bdlt::DatetimeTz(MIN_DT, 0));
+                fields.appendDatetimeTz(bdlt::DatetimeTz(MAX_DT, 1439));
+                fields.appendDatetimeTz(bdlt::DatetimeTz(
+                                       bdlt::Datetime(2026, 3, 4, 5), -1439));
+
+                bsl::vector<char> bytes;
+                for (int i = 0; i < 256; ++i) {
+                    bytes.push_back(static_cast<char>(i));
+                }
+                fields.appendCharArray(bytes);
+                fields.appendCharArray(bsl::vector<char>());
+              } break;
+            }
+
+            expected.push_back(record);
+        }
+
+        {
+            bsl::vector<char> log(&ta);
+            Encoder           encoder(&ta);
+
+            encoder.encodeHeader(&log);
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                encoder.encode(&log, expected[ti]);
+            }
+
+            bdlsb::FixedMemInStreamBuf input(log.data(), log.size());
+
+            Decoder      decoder(&ta);
+            ball::Record record(&ta);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                ASSERTV(LINE, 0 == decoder.decode(&record, &input));
+                ASSERTV(LINE, expected[ti], record, expected[ti] == record);
+            }
+
+            ASSERT(0 < decoder.decode(&record, &input));
+            ASSERT(0 < decoder.decode(&record, &input));
+        }
+
+        if (veryVerbose) cout << "\tTesting a header only." << endl;
+        {
+            bsl::vector<char> log(&ta);
+            Encoder           encoder(&ta);
+
+            encoder.encodeHeader(&log);
+            ASSERTV(log.size(), 13 == log.size());
+
+            bsl::vector<ball::Record> records;
+            ASSERT(0 < decodeAll(&records, log));
+            ASSERT(records.empty());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode a record, and decode it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        const ball::Record record = makeRecord(
+                                  bdlt::Datetime(2026, 10, 17, 1, 2, 3, 4, 5),
+                                  100,
+                                  200,
+                                  "breathing.cpp",
+                                  300,
+                                  "BREATHING",
+                                  ball::Severity::e_ERROR,
+                                  "breathing test");
+
+        bsl::vector<char> log;
+        Encoder           encoder;
+
+        encoder.encodeHeader(&log);
+        encoder.encode(&log, record);
+
+        if (veryVerbose) { P(log.size()); }
+
+        bsl::vector<ball::Record> records;
+        ASSERT(0 < decodeAll(&records, log));
+        ASSERT(1 == records.size());
+        ASSERT(record == records[0]);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ENCODING VERSUS FORMATTING
+        //
+        // Concerns:
+        //: 1 Encoding a record is much cheaper, and produces fewer bytes, than
+        //:   formatting it with the default format of the file observers.
+        //
+        // Plan:
+        //: 1 Encode, and format with a 'ball::RecordStringFormatter', a
+        //:   number of typical records, and report the records per second
+        //:   and the bytes per record of each.  Optionally specify, as the
+        //:   second argument, the number of records.
+        //
+        // Testing:
+        //   PERFORMANCE: ENCODING VERSUS FORMATTING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: ENCODING VERSUS FORMATTING"
+                          << "\n======================================="
+                          << endl;
+
+        const int numRecords = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        bsl::vector<ball::Record> records;
+        for (int i = 0; i < 16; ++i) {
+            bsl::ostringstream message;
+            message << "Processed request " << i * 7919
+                    << " for client " << i << " in " << i * 13 << " us";
+
+            records.push_back(makeRecord(
+                        bdlt::Datetime(2026, 10, 17, 9, 30, i, i * 61, i * 7),
+                        4321,
+                        140000000 + i % 4,
+                        "/home/user/src/service/service_requesthandler.cpp",
+                        100 + i * 10,
+                        i % 2 ? "SERVICE.HANDLER" : "SERVICE.DISPATCHER",
+                        ball::Severity::e_INFO,
+                        message.str().c_str()));
+        }
+
+        {
+            Encoder           encoder;
+            bsl::vector<char> buffer;
+            bsl::size_t       numBytes = 0;
+
+            buffer.reserve(1024);
+            encoder.encodeHeader(&buffer);
+
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < numRecords; ++i) {
+                buffer.clear();
+                encoder.encode(&buffer, records[i % records.size()]);
+                numBytes += buffer.size();
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+            cout << "encode: "
+                 << numRecords / (elapsed / 1.0e9) << " records/sec, "
+                 << static_cast<double>(numBytes) / numRecords
+                 << " bytes/record" << endl;
+        }
+
+        {
+            const ball::RecordStringFormatter formatter(
+                                           "\n%d %p:%t %s %f:%l %c %m %u\n");
+
+            char        buffer[1024];
+            bsl::size_t numBytes = 0;
+
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < numRecords; ++i) {
+                numBytes += formatter.format(buffer,
+                                             sizeof buffer,
+                                             records[i % records.size()]);
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+            cout << "format: "
+                 << numRecords / (elapsed / 1.0e9) << " records/sec, "
+                 << static_cast<double>(numBytes) / numRecords
+                 << " bytes/record" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "."
+             << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -10,11 +10,42 @@ BSLS_IDENT_RCSID(ball_broadcastobserver_cpp,"$Id$ $CSID$")
 #include <ball_testobserver.h>          // for testing only
 #include <ball_transmission.h>          // for testing only
 
+#include <bslmt_threadutil.h>
 #include <bslmt_writelockguard.h>
 
 namespace BloombergLP {
 namespace ball {
 
+namespace {
+
+class PublisherGuard {
+    // This class implements a guard that decrements, on destruction, the
+    // counter of calls to 'publish' using one list of observers.
+
+    // DATA
+    bsls::AtomicInt *d_numPublishers_p;  // counter to decrement (held)
+
+    // NOT IMPLEMENTED
+    PublisherGuard(const PublisherGuard&);
+    PublisherGuard& operator=(const PublisherGuard&);
+
+  public:
+    // CREATORS
+    explicit PublisherGuard(bsls::AtomicInt *numPublishers)
+        // Create a guard for the specified 'numPublishers'.
+    : d_numPublishers_p(numPublishers)
+    {
+    }
+
+    ~PublisherGuard()
+        // Decrement the counter managed by this guard.
+    {
+        --*d_numPublishers_p;
+    }
+};
+
+}  // close unnamed namespace
+
                          // -----------------------
                          // class BroadcastObserver
                          // -----------------------
@@ -25,6 +56,37 @@ BroadcastObserver::~BroadcastObserver()
     deregisterAllObservers();
 }
 
+// PRIVATE MANIPULATORS
+void BroadcastObserver::updatePublishList()
+{
+    const unsigned int generation = d_generation.load();
+
+    // The list that is not current was last used by 'publish' before the
+    // previous update, which waited for all such uses to end.  A call to
+    // 'publish' that loads the old generation from here on announces itself
+    // on 'd_numPublishers' and then finds the generation changed, so it
+    // never reads that list.
+
+    ObserverList& nextList = publishList(generation + 1);
+
+    nextList.clear();
+    nextList.reserve(d_observers.size());
+    for (ObserverRegistry::const_iterator it = d_observers.cbegin();
+         it != d_observers.cend();
+         ++it) {
+        nextList.push_back(it->second.get());
+    }
+
+    d_generation.store(generation + 1);
+
+    bsls::AtomicInt& numPublishers = d_numPublishers[generation & 1];
+    while (0 != numPublishers.load()) {
+        bslmt::ThreadUtil::yield();
+    }
+
+    publishList(generation).clear();
+}
+
 // MANIPULATORS
 int BroadcastObserver::deregisterObserver(
                                          const bslstl::StringRef& observerName)
@@ -41,6 +103,8 @@ int BroadcastObserver::deregisterObserver(
 
     d_observers.erase(it);
 
+    updatePublishList();
+
     observer->releaseRecords();
 
     return 0;
@@ -50,12 +114,22 @@ void BroadcastObserver::deregisterAllObservers()
 {
     bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwMutex);
 
-    ObserverRegistry::iterator it = d_observers.begin();
+    if (d_observers.empty()) {
+        return;                                                       // RETURN
+    }
+
+    ObserverRegistry observers(d_observers.get_allocator());
 
-    while (it != d_observers.end()) {
+    observers.swap(d_observers);
+
+    updatePublishList();
+
+    ObserverRegistry::iterator it = observers.begin();
+
+    while (it != observers.end()) {
         bsl::shared_ptr<Observer> observer = it->second;
 
-        it = d_observers.erase(it);
+        it = observers.erase(it);
 
         observer->releaseRecords();
     }
@@ -78,13 +152,32 @@ bsl::shared_ptr<Observer> BroadcastObserver::findObserver(
 void BroadcastObserver::publish(const bsl::shared_ptr<const Record>& record,
                                 const Context&                       context)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwMutex);
+    // Announce this call on the counter of the current list of observers,
+    // retrying if the list was replaced before the announcement could be
+    // seen by 'updatePublishList'.
 
-    ObserverRegistry::const_iterator it  = d_observers.begin();
-    ObserverRegistry::const_iterator end = d_observers.end();
+    unsigned int generation = d_generation.load();
+
+    ++d_numPublishers[generation & 1];
+
+    while (generation != d_generation.load()) {
+        --d_numPublishers[generation & 1];
+        ++d_numPublishRetries;
+
+        generation = d_generation.load();
+
+        ++d_numPublishers[generation & 1];
+    }
+
+    PublisherGuard guard(&d_numPublishers[generation & 1]);
+
+    const ObserverList& observers = publishList(generation);
+
+    ObserverList::const_iterator it  = observers.begin();
+    ObserverList::const_iterator end = observers.end();
 
     for (; it != end; ++it) {
-        (it->second)->publish(record, context);
+        (*it)->publish(record, context);
     }
 }
 
@@ -94,7 +187,13 @@ int BroadcastObserver::registerObserver(
 {
     bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwMutex);
 
-    return !d_observers.emplace(observerName, observer).second;
+    if (!d_observers.emplace(observerName, observer).second) {
+        return 1;                                                     // RETURN
+    }
+
+    updatePublishList();
+
+    return 0;
 }
 
 void BroadcastObserver::releaseRecords()
@@ -24,6 +24,7 @@ BSLS_IDENT("$Id: $")
 //                            |             deregisterObserver
 //                            |             deregisterAllObservers
 //                            |             findObserver
+//                            |             numPublishRetries
 //                            |             numRegisteredObservers
 //                            |             visitObservers
 //                            V
@@ -49,6 +50,24 @@ BSLS_IDENT("$Id: $")
 // share the same instance, or may have their own instances (see
 // 'bsldoc_glossary').
 //
+///Publishing Without a Lock
+///-------------------------
+// The 'publish' method is called for every record that is logged, typically
+// from many threads at once, whereas observers are registered and
+// deregistered rarely.  'ball::BroadcastObserver' therefore keeps, in
+// addition to its registry, a copy of the list of registered observers that
+// is rebuilt each time the registry changes, and 'publish' forwards records
+// to the observers in that copy without acquiring any lock: it need only
+// announce itself on an atomic counter associated with the current copy.
+// Once the registry has been modified, 'registerObserver',
+// 'deregisterObserver', and 'deregisterAllObservers' wait until no call to
+// 'publish' is still using the previous copy, so that an observer that has
+// been deregistered receives no further records once 'deregisterObserver'
+// returns.  A call to 'publish' that coincides with such a change retries
+// against the new copy; the accessor 'numPublishRetries' reports the number
+// of these retries, and so measures the (rare) contention between publishing
+// threads and threads that reconfigure the observer.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -149,9 +168,13 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_readerwritermutex.h>
 #include <bslmt_readlockguard.h>
 
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 
 
 namespace BloombergLP {
@@ -180,16 +203,61 @@ class BroadcastObserver : public Observer {
         // by this observer.
 
   private:
+    // PRIVATE TYPES
+    typedef bsl::vector<Observer *> ObserverList;
+        // This 'typedef' is an alias for the type of the copies of the
+        // registry to which 'publish' forwards records.  Note that these
+        // copies do not share ownership of the observers: a deregistered
+        // observer is released only once no call to 'publish' can be using
+        // it (see 'updatePublishList').
+
     // DATA
     ObserverRegistry                 d_observers;  // observer registry
 
     mutable bslmt::ReaderWriterMutex d_rwMutex;    // protects concurrent
                                                    // access to 'd_observers'
 
+    ObserverList                     d_evenPublishList;
+                                                   // copy of the registry
+                                                   // used by 'publish' when
+                                                   // 'd_generation' is even
+
+    ObserverList                     d_oddPublishList;
+                                                   // copy of the registry
+                                                   // used by 'publish' when
+                                                   // 'd_generation' is odd
+
+    bsls::AtomicUint                 d_generation; // incremented on each
+                                                   // change to the registry
+
+    bsls::AtomicInt                  d_numPublishers[2];
+                                                   // number of calls to
+                                                   // 'publish' using the
+                                                   // even and the odd list
+
+    bsls::AtomicInt64                d_numPublishRetries;
+                                                   // number of calls to
+                                                   // 'publish' that retried
+                                                   // due to a concurrent
+                                                   // change to the registry
+
     // NOT IMPLEMENTED
     BroadcastObserver(const BroadcastObserver&);
     BroadcastObserver& operator=(const BroadcastObserver&);
 
+    // PRIVATE MANIPULATORS
+    void updatePublishList();
+        // Make the list of observers to which 'publish' forwards records a
+        // copy of the registry of this broadcast observer, and wait until no
+        // call to 'publish' is using the previous list.  The behavior is
+        // undefined unless the calling thread holds the write lock on
+        // 'd_rwMutex'.
+
+    ObserverList& publishList(unsigned int generation);
+        // Return a reference providing modifiable access to the copy of the
+        // registry used by 'publish' when 'd_generation' has the specified
+        // 'generation' value.
+
   public:
     // CREATORS
     explicit BroadcastObserver(bslma::Allocator *basicAllocator = 0);
@@ -252,7 +320,8 @@ class BroadcastObserver : public Observer {
                          const Context&                       context);
         // Process the specified log 'record' having the specified publishing
         // 'context' by forwarding 'record' and 'context' to each of the
-        // observers registered with this broadcast observer.
+        // observers registered with this broadcast observer.  Note that this
+        // method does not acquire a lock (see {Publishing Without a Lock}).
 
     int registerObserver(const bsl::shared_ptr<Observer>& observer,
                          const bslstl::StringRef&         observerName);
@@ -318,6 +387,11 @@ class BroadcastObserver : public Observer {
         return *result ? 0 : 1;
     }
 
+    bsls::Types::Int64 numPublishRetries() const;
+        // Return the number of times a call to 'publish' on this broadcast
+        // observer found the registry being changed concurrently and retried
+        // against the updated registry.
+
     int numRegisteredObservers() const;
         // Return the number of observers registered with this broadcast
         // observer.
@@ -347,7 +421,19 @@ class BroadcastObserver : public Observer {
 inline
 BroadcastObserver::BroadcastObserver(bslma::Allocator *basicAllocator)
 : d_observers(bslma::Default::allocator(basicAllocator))
+, d_evenPublishList(bslma::Default::allocator(basicAllocator))
+, d_oddPublishList(bslma::Default::allocator(basicAllocator))
+, d_generation(0)
+, d_numPublishRetries(0)
+{
+}
+
+// PRIVATE MANIPULATORS
+inline
+BroadcastObserver::ObserverList&
+BroadcastObserver::publishList(unsigned int generation)
 {
+    return generation & 1 ? d_oddPublishList : d_evenPublishList;
 }
 
 // MANIPULATORS
@@ -365,6 +451,12 @@ void BroadcastObserver::visitObservers(VISITOR& visitor)
 }
 
 // ACCESSORS
+inline
+bsls::Types::Int64 BroadcastObserver::numPublishRetries() const
+{
+    return d_numPublishRetries.loadRelaxed();
+}
+
 inline
 int BroadcastObserver::numRegisteredObservers() const
 {
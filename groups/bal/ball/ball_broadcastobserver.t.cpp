@@ -16,8 +16,11 @@
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bsls_annotation.h>
 #include <bsls_asserttest.h>
+#include <bsls_atomic.h>
 
 #include <bsl_cstdlib.h>     // atoi()
 #include <bsl_cstring.h>     // strlen(), memset(), memcpy(), memcmp()
@@ -25,6 +28,7 @@
 
 #include <bsl_new.h>         // placement 'new' syntax
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace ball;
@@ -53,12 +57,14 @@ using namespace bsl;
 // [ 8] void visitObservers(OBSERVER_VISITOR& visitor);
 // [ 4] shared_ptr<const Observer> findObserver(name) const;
 // [ 4] int findObserver(shared_ptr<const OBSERVER> *, name) const;
+// [ 9] bsls::Types::Int64 numPublishRetries() const;
 // [ 4] int numRegisteredObservers() const;
 // [ 8] void visitObservers(const OBSERVER_VISITOR& visitor) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 // [ 7] CONCERN: REGISTERED OBSERVERS LIFETIME
+// [ 9] CONCERN: PUBLISHING CONCURRENTLY WITH (DE)REGISTRATION
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -258,6 +264,81 @@ static bool isNthContext(const ball::Context& context, int nth)
 //                  GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
 
+namespace TEST_CASE_9 {
+
+class CountingObserver : public Observer {
+    // This class provides an observer that counts the records published to
+    // it, and in particular those published to it after it has been marked
+    // as deregistered.
+
+    // DATA
+    bsls::AtomicInt  d_numPublished;       // records published
+    bsls::AtomicInt  d_numPublishedLate;   // records published while marked
+    bsls::AtomicBool d_deregisteredFlag;   // 'true' if marked
+
+  public:
+    // CREATORS
+    CountingObserver()
+    : d_numPublished(0)
+    , d_numPublishedLate(0)
+    , d_deregisteredFlag(false)
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    void publish(const bsl::shared_ptr<const Record>&, const Context&)
+        // Count the published record.
+    {
+        ++d_numPublished;
+        if (d_deregisteredFlag) {
+            ++d_numPublishedLate;
+        }
+    }
+
+    void setDeregistered(bool value)
+        // Mark this observer as deregistered if the specified 'value' is
+        // 'true', and as registered otherwise.
+    {
+        d_deregisteredFlag = value;
+    }
+
+    // ACCESSORS
+    int numPublished() const
+        // Return the number of records published to this observer.
+    {
+        return d_numPublished;
+    }
+
+    int numPublishedLate() const
+        // Return the number of records published to this observer while it
+        // was marked as deregistered.
+    {
+        return d_numPublishedLate;
+    }
+};
+
+struct Publisher {
+    // This 'struct' defines a functor that publishes a record repeatedly to
+    // a broadcast observer.
+
+    Obj                                  *d_observer_p;   // destination
+    const bsl::shared_ptr<const Record>  *d_record_p;     // record published
+    int                                   d_numRecords;   // times published
+
+    void operator()() const
+    {
+        const Context context(Transmission::e_PASSTHROUGH, 0, 1);
+
+        for (int i = 0; i < d_numRecords; ++i) {
+            d_observer_p->publish(*d_record_p, context);
+        }
+    }
+};
+
+}  // close namespace TEST_CASE_9
+
 //=============================================================================
 //                                USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -339,7 +420,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -396,6 +477,117 @@ int main(int argc, char *argv[])
 
         ASSERT(myObserverPtr == anotherObserverPtr);
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCERN: PUBLISHING CONCURRENTLY WITH (DE)REGISTRATION
+        //
+        // Concerns:
+        //: 1 Records published by several threads reach every observer that
+        //:   remains registered throughout, while other observers are being
+        //:   registered and deregistered concurrently.
+        //:
+        //: 2 Once 'deregisterObserver' returns, the deregistered observer
+        //:   receives no further records.
+        //:
+        //: 3 'numPublishRetries' is 0 while the registry is not modified
+        //:   concurrently with 'publish', and otherwise grows by at most one
+        //:   per publishing thread for each modification of the registry.
+        //
+        // Plan:
+        //: 1 Register an observer, publish records from a single thread, and
+        //:   verify that 'numPublishRetries' is 0.  (C-3)
+        //:
+        //: 2 Start several threads that publish a fixed number of records,
+        //:   and meanwhile repeatedly register and deregister a second
+        //:   observer, marking it as deregistered each time
+        //:   'deregisterObserver' returns.  Verify that the first observer
+        //:   received every record, that the second observer received none
+        //:   while marked, and that 'numPublishRetries' is bounded by the
+        //:   number of publishing threads times the number of modifications
+        //:   of the registry.  (C-1..3)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numPublishRetries() const;
+        //   CONCERN: PUBLISHING CONCURRENTLY WITH (DE)REGISTRATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                 << "\nCONCERN: PUBLISHING CONCURRENTLY WITH (DE)REGISTRATION"
+                 << "\n======================================================"
+                 << endl;
+
+        using namespace TEST_CASE_9;
+
+        const int NUM_THREADS = 4;
+        const int NUM_RECORDS = 20000;
+
+        Obj mX;  const Obj& X = mX;
+
+        bsl::shared_ptr<CountingObserver> permanent(new CountingObserver());
+        bsl::shared_ptr<CountingObserver> transient(new CountingObserver());
+
+        ASSERT(0 == mX.registerObserver(permanent, "permanent"));
+
+        const bsl::shared_ptr<const Record> record(new Record());
+        const Context context(Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (verbose) cout << "	Without concurrent (de)registration." << endl;
+        {
+            for (int i = 0; i < 100; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERTV(permanent->numPublished(),
+                    100 == permanent->numPublished());
+            ASSERTV(X.numPublishRetries(), 0 == X.numPublishRetries());
+        }
+
+        if (verbose) cout << "	With concurrent (de)registration." << endl;
+        {
+            Publisher publisher = { &mX, &record, NUM_RECORDS };
+
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(NUM_THREADS);
+            for (int t = 0; t < NUM_THREADS; ++t) {
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                        &handles[t],
+                                        publisher,
+                                        bslma::Default::defaultAllocator()));
+            }
+
+            int numIterations = 0;
+            while (permanent->numPublished() <
+                                         100 + NUM_THREADS * NUM_RECORDS / 2
+                || numIterations < 100) {
+                transient->setDeregistered(false);
+                ASSERT(0 == mX.registerObserver(transient, "transient"));
+                bslmt::ThreadUtil::yield();
+                ASSERT(0 == mX.deregisterObserver("transient"));
+                transient->setDeregistered(true);
+                bslmt::ThreadUtil::yield();
+                ++numIterations;
+            }
+
+            for (int t = 0; t < NUM_THREADS; ++t) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[t]));
+            }
+
+            if (veryVerbose) {
+                P_(numIterations);
+                P_(transient->numPublished());
+                P(X.numPublishRetries());
+            }
+
+            ASSERTV(permanent->numPublished(),
+                    100 + NUM_THREADS * NUM_RECORDS ==
+                                                   permanent->numPublished());
+            ASSERTV(transient->numPublishedLate(),
+                    0 == transient->numPublishedLate());
+            ASSERTV(numIterations,
+                    X.numPublishRetries(),
+                    2 * numIterations * NUM_THREADS >= X.numPublishRetries());
+            ASSERT(1 == X.numRegisteredObservers());
+            ASSERT(1 == transient.use_count());
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING 'visitObservers' METHOD
@@ -11,8 +11,12 @@ BSLS_IDENT_RCSID(ball_fileobserver_cpp,"$Id$ $CSID$")
 #include <ball_record.h>
 #include <ball_streamobserver.h>              // for testing only
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bslmt_lockguard.h>
 
+#include <bsls_assert.h>
+
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>                      // for 'bsl::strcmp'
 #include <bsl_sstream.h>
@@ -236,6 +240,39 @@ void FileObserver::publish(const Record& record, const Context& context)
     d_fileObserver2.publish(record, context);
 }
 
+void FileObserver::publishBatch(const Record *const *records, int numRecords)
+{
+    BSLS_ASSERT(0 <= numRecords);
+    BSLS_ASSERT(records || 0 == numRecords);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    int i = 0;
+    while (i < numRecords
+        && records[i]->fixedFields().severity() > d_stdoutThreshold) {
+        ++i;
+    }
+
+    if (i < numRecords) {
+        bdlsb::MemOutStreamBuf stdoutStreamBuf(allocator());
+        bsl::ostream           stdoutStream(&stdoutStreamBuf);
+
+        for (; i < numRecords; ++i) {
+            if (records[i]->fixedFields().severity() <= d_stdoutThreshold) {
+                d_stdoutFormatter(stdoutStream, *records[i]);
+            }
+        }
+
+        bsl::fwrite(stdoutStreamBuf.data(),
+                    1,
+                    stdoutStreamBuf.length(),
+                    stdout);
+        bsl::fflush(stdout);
+    }
+
+    d_fileObserver2.publishBatch(records, numRecords);
+}
+
 void FileObserver::setLogFormat(const char *logFileFormat,
                                 const char *stdoutFormat)
 {
@@ -30,6 +30,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setOnFileRotationCallback
@@ -269,6 +270,14 @@ BSLS_IDENT("$Id: $")
 // in the filename.  In any case, logging resumes to a new, initially empty,
 // file.
 //
+///Publishing Records in Batches
+///-----------------------------
+// A client holding several records at once may supply them to 'publishBatch'
+// rather than to 'publish', one at a time.  The records that are to be logged
+// to 'stdout' are then written there with a single 'fwrite', and all of them
+// are written to the log file with a single system call (see
+// 'ball::FileObserver2::publishBatch').
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver' are thread-safe, and can be called
@@ -625,6 +634,17 @@ class FileObserver : public Observer {
         // 'record' is at least as severe as the value returned by
         // 'stdoutThreshold'.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log records addressed by the
+        // specified 'records' array, in order, by writing them to the current
+        // log file, with one system call, if file logging is enabled for this
+        // file observer, and writing those whose severity is at least as
+        // severe as the value returned by 'stdoutThreshold' to 'stdout' with
+        // one call to 'fwrite' (see {Publishing Records in Batches}).  The
+        // behavior is undefined unless '0 <= numRecords' and each of the
+        // first 'numRecords' elements of 'records' addresses a valid
+        // 'Record'.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
@@ -39,6 +39,7 @@
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdio.h>      // 'remove'
@@ -50,6 +51,7 @@
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdio.h>
 #include <bsl_c_stdlib.h>    // 'unsetenv'
@@ -111,6 +113,7 @@ using bsl::flush;
 // [ 1] void enableUserFieldsLogging();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [ 7] void publishBatch(const Record *const *records, int numRecords);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
 // [ 2] void rotateOnSize(int size);
@@ -136,7 +139,7 @@ using bsl::flush;
 // [ 6] CONCERN: 'FileObserver' can be created using 'allocate_shared'.
 // [ 5] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [ 4] CONCERN: ROTATION CALLBACK INVOCATION
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 
 // Note assert and debug macros all output to cerr instead of cout, unlike
 // most other test drivers.  This is necessary because test case 1 plays
@@ -687,7 +690,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -800,6 +803,126 @@ int main(int argc, char *argv[])
         observer->disableSizeRotation();
 //..
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes to 'stdout', in order, exactly those
+        //:   records of the batch whose severity is at least as severe as the
+        //:   'stdout' threshold, using the 'stdout' format.
+        //:
+        //: 2 'publishBatch' writes every record of the batch, in order, to the
+        //:   log file if file logging is enabled.
+        //:
+        //: 3 'publishBatch' has no effect for an empty batch.
+        //
+        // Plan:
+        //: 1 Redirect 'stdout' to a file, set distinct formats for 'stdout'
+        //:   and the log file, publish batches of records having various
+        //:   severities, including an empty batch, and verify the contents
+        //:   of both files.  (C-1..3)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, int numRecords);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string stdoutFileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&stdoutFileName, "stdoutLog");
+
+        bsl::string logFileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&logFileName, "fileLog");
+
+        enum { k_NUM_RECORDS = 30 };
+
+        const ball::Severity::Level LEVELS[] = {
+            ball::Severity::e_TRACE,
+            ball::Severity::e_ERROR,
+            ball::Severity::e_DEBUG,
+            ball::Severity::e_FATAL,
+            ball::Severity::e_INFO,
+            ball::Severity::e_WARN
+        };
+        const int NUM_LEVELS = sizeof LEVELS / sizeof *LEVELS;
+
+        bsl::vector<ball::Record>         records(&ta);
+        bsl::vector<const ball::Record *> recordPtrs(&ta);
+
+        bsl::string expectedStdout, expectedFile;
+
+        records.reserve(k_NUM_RECORDS);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            const ball::Severity::Level level = LEVELS[i % NUM_LEVELS];
+
+            bsl::ostringstream oss;
+            oss << "message " << i;
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        level,
+                                        oss.str().c_str());
+
+            records.push_back(ball::Record(attr, ball::UserFields()));
+
+            if (level <= ball::Severity::e_WARN) {
+                expectedStdout += "stdout " + oss.str() + "\n";
+            }
+            expectedFile += "file " + oss.str() + "\n";
+        }
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            recordPtrs.push_back(&records[i]);
+        }
+
+        {
+            const FILE *out = stdout;
+            ASSERT(out == freopen(stdoutFileName.c_str(), "w", stdout));
+            fflush(stdout);
+        }
+
+        {
+            Obj mX(ball::Severity::e_WARN, &ta);
+
+            mX.setLogFormat("file %m\n", "stdout %m\n");
+            ASSERT(0 == mX.enableFileLogging(logFileName.c_str()));
+
+            mX.publishBatch(recordPtrs.data(), 0);
+
+            // Publish batches of 1, 2, 3, ... records.
+
+            int i = 0;
+            for (int n = 1; i < k_NUM_RECORDS; ++n) {
+                const int numRecords = bsl::min(n, k_NUM_RECORDS - i);
+
+                mX.publishBatch(&recordPtrs[i], numRecords);
+                i += numRecords;
+            }
+
+            mX.disableFileLogging();
+        }
+
+        fflush(stdout);
+
+        bsl::string stdoutContent, fileContent;
+
+        readFileIntoString(__LINE__, stdoutFileName, stdoutContent);
+        readFileIntoString(__LINE__, logFileName,    fileContent);
+
+        ASSERTV(expectedStdout, stdoutContent,
+                expectedStdout == stdoutContent);
+        ASSERTV(expectedFile,   fileContent,
+                expectedFile   == fileContent);
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // CONSTRUCTOR, MAKE_SHARED, AND ALLOCATE_SHARED TEST
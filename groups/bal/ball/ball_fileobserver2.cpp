@@ -28,6 +28,7 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bdlt_time.h>
 
 #include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
 
 #include <bsls_assert.h>
 #include <bsls_log.h>
@@ -43,6 +44,7 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_utility.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_c_time.h>
@@ -420,6 +422,54 @@ void FileObserver2::logRecordDefault(bsl::ostream& stream,
     stream.flush();
 }
 
+void FileObserver2::formatPendingRecord(const Record& record)
+{
+    BSLS_ASSERT(d_isAsyncWritingEnabled);
+
+    while (d_isAsyncWritingEnabled
+        && d_pendingStreamBuf_p->length() >=
+                                static_cast<bsl::size_t>(d_asyncBufferSize)) {
+        d_writerIdleCondition.wait(&d_mutex);
+    }
+
+    // 'disableAsynchronousWriting' may have been called while waiting, in
+    // which case 'record' is written synchronously, after any records still
+    // pending.
+
+    if (!d_isAsyncWritingEnabled) {
+        writePendingRecords();
+
+        if (d_logStreamBuf.isOpened()) {
+            d_logFileFunctor(d_logOutStream, record);
+
+            if (!d_logOutStream) {
+                reportLogFileError();
+            }
+        }
+        return;                                                       // RETURN
+    }
+
+    d_logFileFunctor(*d_pendingStream_p, record);
+    d_writerCondition.signal();
+}
+
+void FileObserver2::reportLogFileError()
+{
+    char errorBuffer[256];
+
+    snprintf(errorBuffer,
+             sizeof errorBuffer,
+             "Error on file stream for %s: %s.",
+             d_logFileName.c_str(),
+             bsl::strerror(getErrorCode()));
+    bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                             __FILE__,
+                                             __LINE__,
+                                             errorBuffer);
+
+    d_logStreamBuf.clear();
+}
+
 int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 {
     BSLS_ASSERT(rotatedLogFileName);
@@ -543,6 +593,104 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
     return 1;
 }
 
+void FileObserver2::writePendingRecords()
+{
+    while (d_isWriterBusy) {
+        d_writerIdleCondition.wait(&d_mutex);
+    }
+
+    const int length = static_cast<int>(d_pendingStreamBuf_p->length());
+
+    if (0 < length) {
+        if (d_logStreamBuf.isOpened()) {
+            d_logOutStream.flush();
+            if (length != bdls::FilesystemUtil::write(
+                                              d_logStreamBuf.fileDescriptor(),
+                                              d_pendingStreamBuf_p->data(),
+                                              length)) {
+                reportLogFileError();
+            }
+        }
+        d_pendingStreamBuf_p->pubseekpos(0);
+        d_pendingStream_p->clear();
+
+        // Wake any publisher waiting for space in the pending buffer.
+
+        d_writerIdleCondition.broadcast();
+    }
+}
+
+void FileObserver2::writerThreadMain()
+{
+    d_mutex.lock();
+
+    while (true) {
+        while (0 == d_pendingStreamBuf_p->length()
+            && !d_isWriterStopRequested) {
+            d_writerCondition.wait(&d_mutex);
+        }
+
+        if (0 == d_pendingStreamBuf_p->length()) {
+            break;
+        }
+
+        // Take the pending records, letting publishers format subsequent
+        // records into the other buffer while these are written.
+
+        bsl::swap(d_pendingStreamBuf_p, d_writingStreamBuf_p);
+        bsl::swap(d_pendingStream_p,    d_writingStream_p);
+        d_isWriterBusy = true;
+
+        bsl::string rotatedFileName;
+        const int   rotationStatus = rotateIfNecessary(
+                                                    &rotatedFileName,
+                                                    bdlt::CurrentTime::utc());
+
+        if (d_logStreamBuf.isOpened()) {
+            // The log file cannot be closed or replaced while
+            // 'd_isWriterBusy' is 'true' (see 'writePendingRecords'), so it
+            // is written without holding 'd_mutex'.
+
+            d_logOutStream.flush();
+
+            const bdls::FilesystemUtil::FileDescriptor fd =
+                                               d_logStreamBuf.fileDescriptor();
+            const int length =
+                             static_cast<int>(d_writingStreamBuf_p->length());
+
+            d_mutex.unlock();
+            const int rc = bdls::FilesystemUtil::write(
+                                                 fd,
+                                                 d_writingStreamBuf_p->data(),
+                                                 length);
+            d_mutex.lock();
+
+            if (length != rc) {
+                reportLogFileError();
+            }
+        }
+
+        d_writingStreamBuf_p->pubseekpos(0);
+        d_writingStream_p->clear();
+        d_isWriterBusy = false;
+        d_writerIdleCondition.broadcast();
+
+        if (0 >= rotationStatus) {
+            d_mutex.unlock();
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+                if (d_onRotationCb) {
+                    d_onRotationCb(rotationStatus, rotatedFileName);
+                }
+            }
+            d_mutex.lock();
+        }
+    }
+
+    d_mutex.unlock();
+}
+
 // CREATORS
 FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
 : d_logStreamBuf(bdls::FilesystemUtil::k_INVALID_FD,
@@ -551,6 +699,7 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  false,
                  basicAllocator)
 , d_logOutStream(&d_logStreamBuf)
+, d_batchStreamBuf(basicAllocator)
 , d_logFilePattern(basicAllocator)
 , d_logFileName(basicAllocator)
 , d_logFileFunctor(
@@ -564,21 +713,64 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  bsl::allocator<FileObserver2::OnFileRotationCallback>(
                                                                basicAllocator))
 , d_rotationCbMutex()
+, d_asyncStreamBuf1(basicAllocator)
+, d_asyncStreamBuf2(basicAllocator)
+, d_asyncStream1(&d_asyncStreamBuf1)
+, d_asyncStream2(&d_asyncStreamBuf2)
+, d_pendingStreamBuf_p(&d_asyncStreamBuf1)
+, d_pendingStream_p(&d_asyncStream1)
+, d_writingStreamBuf_p(&d_asyncStreamBuf2)
+, d_writingStream_p(&d_asyncStream2)
+, d_asyncBufferSize(k_DEFAULT_ASYNC_BUFFER_SIZE)
+, d_isAsyncWritingEnabled(false)
+, d_isWriterStopRequested(false)
+, d_isWriterBusy(false)
+, d_writerThreadHandle(bslmt::ThreadUtil::invalidHandle())
 {
 }
 
 FileObserver2::~FileObserver2()
 {
+    disableAsynchronousWriting();
+
     if (d_logStreamBuf.isOpened()) {
         d_logStreamBuf.clear();
     }
 }
 
 // MANIPULATORS
+void FileObserver2::disableAsynchronousWriting()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (!d_isAsyncWritingEnabled) {
+            return;                                                   // RETURN
+        }
+
+        // The writer thread writes the pending records, if any, before
+        // exiting.  Publishers revert to writing synchronously (after calling
+        // 'writePendingRecords') as soon as the lock is released.
+
+        d_isAsyncWritingEnabled = false;
+        d_isWriterStopRequested = true;
+        d_writerCondition.signal();
+    }
+
+    bslmt::ThreadUtil::join(d_writerThreadHandle);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_writerThreadHandle    = bslmt::ThreadUtil::invalidHandle();
+    d_isWriterStopRequested = false;
+}
+
 void FileObserver2::disableFileLogging()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
+    writePendingRecords();
+
     if (d_logStreamBuf.isOpened()) {
         d_logStreamBuf.clear();
     }
@@ -610,6 +802,37 @@ void FileObserver2::disableTimeIntervalRotation()
     d_rotationInterval.setTotalSeconds(0);
 }
 
+int FileObserver2::enableAsynchronousWriting(int maxBufferSize)
+{
+    BSLS_ASSERT(0 < maxBufferSize);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // A concurrent 'disableAsynchronousWriting' may still be joining the
+    // previous writer thread.
+
+    if (d_isAsyncWritingEnabled || d_isWriterStopRequested) {
+        return 1;                                                     // RETURN
+    }
+
+    bslmt::ThreadAttributes attributes;
+    attributes.setThreadName("ball.fileobs");
+
+    if (0 != bslmt::ThreadUtil::create(
+                  &d_writerThreadHandle,
+                  attributes,
+                  bdlf::MemFnUtil::memFn(&FileObserver2::writerThreadMain,
+                                         this))) {
+        d_writerThreadHandle = bslmt::ThreadUtil::invalidHandle();
+        return -1;                                                    // RETURN
+    }
+
+    d_asyncBufferSize       = maxBufferSize;
+    d_isAsyncWritingEnabled = true;
+
+    return 0;
+}
+
 int FileObserver2::enableFileLogging(const char *logFilenamePattern)
 {
     BSLS_ASSERT(logFilenamePattern);
@@ -665,6 +888,7 @@ void FileObserver2::forceRotation()
     int         rotationStatus;
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        writePendingRecords();
         rotationStatus = rotateFile(&rotatedLogFileName);
     }
 
@@ -692,6 +916,17 @@ void FileObserver2::publish(const Record& record, const Context&)
 
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (d_isAsyncWritingEnabled) {
+            // Rotation is performed by the writer thread.
+
+            if (d_logStreamBuf.isOpened()) {
+                formatPendingRecord(record);
+            }
+            return;                                                   // RETURN
+        }
+
+        writePendingRecords();
         rotationStatus = rotateIfNecessary(&rotatedFileName,
                                            record.fixedFields().timestamp());
 
@@ -699,20 +934,70 @@ void FileObserver2::publish(const Record& record, const Context&)
             d_logFileFunctor(d_logOutStream, record);
 
             if (!d_logOutStream) {
-                char errorBuffer[256];
-
-                snprintf(errorBuffer,
-                         sizeof errorBuffer,
-                         "Error on file stream for %s: %s.",
-                         d_logFileName.c_str(),
-                         bsl::strerror(getErrorCode()));
-                bsls::Log::platformDefaultMessageHandler(
-                                                    bsls::LogSeverity::e_ERROR,
-                                                    __FILE__,
-                                                    __LINE__,
-                                                    errorBuffer);
-
-                d_logStreamBuf.clear();
+                reportLogFileError();
+            }
+        }
+    }
+
+    if (0 >= rotationStatus) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+        if (d_onRotationCb) {
+            d_onRotationCb(rotationStatus, rotatedFileName);
+        }
+    }
+}
+
+void FileObserver2::publishBatch(const Record *const *records, int numRecords)
+{
+    BSLS_ASSERT(0 <= numRecords);
+    BSLS_ASSERT(records || 0 == numRecords);
+
+    if (0 == numRecords) {
+        return;                                                       // RETURN
+    }
+
+    bsl::string rotatedFileName;
+    int         rotationStatus;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (d_isAsyncWritingEnabled) {
+            for (int i = 0; i < numRecords && d_logStreamBuf.isOpened(); ++i) {
+                formatPendingRecord(*records[i]);
+            }
+            return;                                                   // RETURN
+        }
+
+        writePendingRecords();
+        rotationStatus = rotateIfNecessary(
+                                      &rotatedFileName,
+                                      records[0]->fixedFields().timestamp());
+
+        if (d_logStreamBuf.isOpened()) {
+            // Format the whole batch into 'd_batchStreamBuf', whose capacity
+            // is retained across calls, then write it directly to the file
+            // descriptor, bypassing the (smaller) buffer of 'd_logStreamBuf',
+            // so that the batch is written with a single system call.
+
+            d_batchStreamBuf.pubseekpos(0);
+            bsl::ostream batchStream(&d_batchStreamBuf);
+
+            for (int i = 0; i < numRecords; ++i) {
+                d_logFileFunctor(batchStream, *records[i]);
+            }
+
+            const int length = static_cast<int>(d_batchStreamBuf.length());
+
+            d_logOutStream.flush();
+            if (!d_logOutStream
+             || !batchStream
+             || (0 < length && length != bdls::FilesystemUtil::write(
+                                              d_logStreamBuf.fileDescriptor(),
+                                              d_batchStreamBuf.data(),
+                                              length))) {
+                reportLogFileError();
             }
         }
     }
@@ -785,6 +1070,13 @@ void FileObserver2::setOnFileRotationCallback(
 }
 
 // ACCESSORS
+bool FileObserver2::isAsynchronousWritingEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_isAsyncWritingEnabled;
+}
+
 bool FileObserver2::isFileLoggingEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
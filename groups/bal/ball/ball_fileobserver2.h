@@ -30,6 +30,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableFileLogging
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
@@ -238,6 +239,39 @@ BSLS_IDENT("$Id: $")
 // in the filename.  In any case, logging resumes to a new, initially empty,
 // file.
 //
+///Publishing Records in Batches
+///-----------------------------
+// Each record supplied to 'publish' is formatted and written to the log file
+// individually, which requires a system call per record.  A client holding
+// several records at once (e.g., the publication thread of an asynchronous
+// observer) may instead supply them to 'publishBatch', which formats all of
+// them into an internal buffer and writes that buffer to the log file with a
+// single system call.  Note that the rotation rules (see {Log File Rotation})
+// are then evaluated once per batch, before it is written, based on the
+// timestamp of its first record, so that all of the records of a batch are
+// written to the same log file.
+//
+///Asynchronous Writing
+///--------------------
+// By default, 'publish' and 'publishBatch' write to the log file on the
+// calling thread, which therefore waits for each write to complete; a slow or
+// saturated disk stalls every thread that logs.  Following a successful call
+// to 'enableAsynchronousWriting', records are instead formatted into an
+// in-memory buffer and handed to a writer thread owned by the file observer,
+// which writes the accumulated records to the log file with a single system
+// call while publishers continue to fill a second buffer.  The rotation rules
+// (see {Log File Rotation}) are then evaluated by the writer thread, before
+// each write, based on the current time rather than on record timestamps;
+// the renaming of rotated log files and the invocation of the rotation
+// callback likewise take place on the writer thread, off the logging path.
+// Publishers wait for the writer thread only if the records awaiting writing
+// exceed the buffer size supplied to 'enableAsynchronousWriting'.
+//
+// Records published in this mode may not yet have been written to the log
+// file when 'publish' returns.  'disableAsynchronousWriting', the destructor,
+// and the methods that close or replace the log file ('disableFileLogging'
+// and 'forceRotation') first write all such records to the log file.
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver2' are thread-safe, and can be called
@@ -307,6 +341,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdls_fdstreambuf.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
@@ -315,7 +351,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_condition.h>
 #include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
@@ -341,6 +379,12 @@ class FileObserver2 : public Observer {
     // of rollback.  In no event is memory leaked.
 
   public:
+    // PUBLIC CONSTANTS
+    enum { k_DEFAULT_ASYNC_BUFFER_SIZE = 1024 * 1024 };
+        // Default maximum size, in bytes, of the formatted records awaiting
+        // writing before publishers wait for the writer thread (see
+        // 'enableAsynchronousWriting').
+
     // PUBLIC TYPES
     typedef bsl::function<void(bsl::ostream&, const Record&)> LogRecordFunctor;
         // 'LogRecordFunctor' is an alias for the type of the functor used for
@@ -369,6 +413,11 @@ class FileObserver2 : public Observer {
                                                        // file logging (refers
                                                        // to 'd_logStreamBuf')
 
+    bdlsb::MemOutStreamBuf d_batchStreamBuf;           // buffer into which
+                                                       // 'publishBatch'
+                                                       // formats records;
+                                                       // reused across calls
+
     bsl::string            d_logFilePattern;           // log filename pattern
 
     bsl::string            d_logFileName;              // current log filename
@@ -419,6 +468,69 @@ class FileObserver2 : public Observer {
                                                        // called with 'd_mutex'
                                                        // unlocked
 
+    bdlsb::MemOutStreamBuf d_asyncStreamBuf1;          // first of the two
+                                                       // buffers used for
+                                                       // asynchronous writing
+
+    bdlsb::MemOutStreamBuf d_asyncStreamBuf2;          // second of the two
+                                                       // buffers used for
+                                                       // asynchronous writing
+
+    bsl::ostream           d_asyncStream1;             // output stream
+                                                       // referring to
+                                                       // 'd_asyncStreamBuf1'
+
+    bsl::ostream           d_asyncStream2;             // output stream
+                                                       // referring to
+                                                       // 'd_asyncStreamBuf2'
+
+    bdlsb::MemOutStreamBuf *d_pendingStreamBuf_p;      // buffer into which
+                                                       // publishers format
+                                                       // records awaiting
+                                                       // writing
+
+    bsl::ostream           *d_pendingStream_p;         // output stream
+                                                       // referring to the
+                                                       // pending buffer
+
+    bdlsb::MemOutStreamBuf *d_writingStreamBuf_p;      // buffer owned by the
+                                                       // writer thread
+
+    bsl::ostream           *d_writingStream_p;         // output stream
+                                                       // referring to the
+                                                       // writing buffer
+
+    int                    d_asyncBufferSize;          // size (in bytes) of
+                                                       // pending records
+                                                       // beyond which
+                                                       // publishers wait
+
+    bool                   d_isAsyncWritingEnabled;    // 'true' if records
+                                                       // are written by the
+                                                       // writer thread
+
+    bool                   d_isWriterStopRequested;    // 'true' if the writer
+                                                       // thread must exit once
+                                                       // no records are
+                                                       // pending
+
+    bool                   d_isWriterBusy;             // 'true' while the
+                                                       // writer thread owns
+                                                       // the log file
+
+    bslmt::Condition       d_writerCondition;          // signaled when records
+                                                       // are pending or the
+                                                       // writer thread must
+                                                       // exit
+
+    bslmt::Condition       d_writerIdleCondition;      // signaled when the
+                                                       // writer thread
+                                                       // finishes a write
+
+    bslmt::ThreadUtil::Handle
+                           d_writerThreadHandle;       // handle of the writer
+                                                       // thread
+
   private:
     // NOT IMPLEMENTED
     FileObserver2(const FileObserver2&);
@@ -430,6 +542,18 @@ class FileObserver2 : public Observer {
         // Write the specified log 'record' to the specified output 'stream'
         // using the default record format of this file observer.
 
+    void formatPendingRecord(const Record& record);
+        // Format the specified 'record' into the buffer of records awaiting
+        // writing by the writer thread, first waiting for the writer thread
+        // if that buffer is full, and wake the writer thread.  The behavior
+        // is undefined unless asynchronous writing is enabled and the caller
+        // acquired the lock for this object.
+
+    void reportLogFileError();
+        // Report the failure of an operation on the log file, using the
+        // 'bsls::Log' facility, and close the log file.  The behavior is
+        // undefined unless the caller acquired the lock for this object.
+
     int rotateFile(bsl::string *rotatedLogFileName);
         // Perform a log file rotation by closing the current log file of this
         // file observer, renaming the closed log file if necessary, and
@@ -453,6 +577,21 @@ class FileObserver2 : public Observer {
         // and the 'rotateOnSize' methods, respectively.  The behavior is
         // undefined unless the caller acquired the lock for this object.
 
+    void writePendingRecords();
+        // Wait until the writer thread, if any, has finished writing to the
+        // log file, and then write, on the calling thread, any records that
+        // were formatted for asynchronous writing but not yet taken by the
+        // writer thread.  The behavior is undefined unless the caller
+        // acquired the lock for this object.  Note that this method must be
+        // called before any operation that writes to, closes, or replaces the
+        // log file.
+
+    void writerThreadMain();
+        // Repeatedly take the buffer of records awaiting writing, apply the
+        // rotation rules, and write the buffer to the log file, until
+        // 'disableAsynchronousWriting' is called and no records are pending.
+        // This method is the entry point of the writer thread.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FileObserver2, bslma::UsesBslmaAllocator);
@@ -469,10 +608,20 @@ class FileObserver2 : public Observer {
         // is in effect for file logging (see 'setLogFileFunctor').
 
     ~FileObserver2();
-        // Close the log file of this file observer if file logging is enabled,
-        // and destroy this file observer.
+        // Write any records awaiting asynchronous writing, stop the writer
+        // thread if asynchronous writing is enabled, close the log file of
+        // this file observer if file logging is enabled, and destroy this
+        // file observer.
 
     // MANIPULATORS
+    void disableAsynchronousWriting();
+        // Disable asynchronous writing for this file observer: write to the
+        // log file any records awaiting writing, and stop the writer thread.
+        // Records subsequently published are written to the log file on the
+        // publishing thread.  This method has no effect if asynchronous
+        // writing is not enabled.  The behavior is undefined if this method
+        // is called from the rotation callback.
+
     void disableFileLogging();
         // Disable file logging for this file observer.  This method has no
         // effect if file logging is not enabled.  Note that records
@@ -503,6 +652,20 @@ class FileObserver2 : public Observer {
         // enabled.  Note that this method also affects log filenames (see {Log
         // Filename Patterns}).
 
+    int enableAsynchronousWriting(
+                             int maxBufferSize = k_DEFAULT_ASYNC_BUFFER_SIZE);
+        // Enable asynchronous writing for this file observer: start a writer
+        // thread that writes the records published to this file observer to
+        // the log file, and rotates the log file, off the publishing threads
+        // (see {Asynchronous Writing}).  Optionally specify a
+        // 'maxBufferSize', in bytes, of the formatted records awaiting
+        // writing beyond which publishers wait for the writer thread.  If
+        // 'maxBufferSize' is not specified, 'k_DEFAULT_ASYNC_BUFFER_SIZE' is
+        // used.  Return 0 on success, a positive value if asynchronous
+        // writing is already enabled (with no effect), and a negative value
+        // if the writer thread could not be created.  The behavior is
+        // undefined unless '0 < maxBufferSize'.
+
     int enableFileLogging(const char *logFilenamePattern);
         // Enable logging of all records published to this file observer to a
         // file whose name is derived from the specified 'logFilenamePattern'.
@@ -555,7 +718,9 @@ class FileObserver2 : public Observer {
         // 'context' by writing 'record' and 'context' to the current log file
         // if file logging is enabled for this file observer.  The method has
         // no effect if file logging is not enabled, in which case 'record' is
-        // dropped.
+        // dropped.  Note that, if asynchronous writing is enabled, 'record'
+        // is formatted on the calling thread, but written to the log file by
+        // the writer thread (see {Asynchronous Writing}).
 
     void publish(const bsl::shared_ptr<const Record>& record,
                  const Context&                       context);
@@ -565,6 +730,21 @@ class FileObserver2 : public Observer {
         // enabled for this file observer.  The method has no effect if file
         // logging is not enabled, in which case 'record' is dropped.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log records addressed by the
+        // specified 'records' array by formatting them, in order, into a
+        // single buffer and writing that buffer to the current log file with
+        // one system call if file logging is enabled for this file observer.
+        // The rotation rules are evaluated once, before writing, using the
+        // timestamp of the first record (see {Publishing Records in
+        // Batches}).  The method has no effect if file logging is not
+        // enabled, in which case the records are dropped.  The behavior is
+        // undefined unless '0 <= numRecords' and each of the first
+        // 'numRecords' elements of 'records' addresses a valid 'Record'.
+        // Note that, if asynchronous writing is enabled, the records are
+        // formatted on the calling thread and written to the log file, along
+        // with any other pending records, by the writer thread.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
@@ -576,7 +756,8 @@ class FileObserver2 : public Observer {
         // the current log file, rename the log file if necessary, and open a
         // new log file.  This method has no effect if file logging is not
         // enabled.  See {Rotated File Naming} for details on filenames of
-        // rotated log files.
+        // rotated log files.  Note that any records awaiting asynchronous
+        // writing are written to the log file before it is closed.
 
     void rotateOnSize(int size);
         // Set this file observer to perform log file rotation when the size of
@@ -627,6 +808,10 @@ class FileObserver2 : public Observer {
         // write to the 'ball' log).
 
     // ACCESSORS
+    bool isAsynchronousWritingEnabled() const;
+        // Return 'true' if records published to this file observer are
+        // written to the log file by a writer thread, and 'false' otherwise.
+
     bool isFileLoggingEnabled() const;
     bool isFileLoggingEnabled(bsl::string *result) const;
         // Return 'true' if file logging is enabled for this file observer, and
@@ -41,8 +41,10 @@
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -52,6 +54,7 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -101,6 +104,9 @@ using bsl::flush;
 // [ 1] void enablePublishInLocalTime();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [14] void publishBatch(const Record *const *records, int numRecords);
+// [15] void disableAsynchronousWriting();
+// [15] int  enableAsynchronousWriting(int maxBufferSize);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnSize(int size);
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
@@ -110,13 +116,14 @@ using bsl::flush;
 // [ 5] void setOnFileRotationCallback(const OnFileRotationCallback&);
 //
 // ACCESSORS
+// [15] bool isAsynchronousWritingEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -692,6 +699,73 @@ void getDatetimeField(bsl::string        *result,
     *result = s.substr(0, s.find_first_of(' '));
 }
 
+class ConcurrentPublisher {
+    // This class provides a functor, suitable as a thread entry point, that
+    // publishes a sequence of records to a file observer, and measures the
+    // longest time spent in a single call to 'publish'.
+
+    // DATA
+    ball::FileObserver2             *d_observer_p;  // held, not owned
+    const bsl::vector<ball::Record> *d_records_p;   // held, not owned
+    int                              d_numRecords;  // number to publish
+    bsls::Types::Int64              *d_maxLatency_p;
+                                                    // longest 'publish' call,
+                                                    // in nanoseconds (held,
+                                                    // not owned)
+
+  public:
+    // CREATORS
+    ConcurrentPublisher(ball::FileObserver2             *observer,
+                        const bsl::vector<ball::Record> *records,
+                        int                              numRecords,
+                        bsls::Types::Int64              *maxLatency)
+        // Create a functor that publishes the specified 'numRecords' records
+        // from the specified 'records', cycling through them, to the
+        // specified 'observer', and loads into the specified 'maxLatency' the
+        // longest time, in nanoseconds, spent in a single call to 'publish'.
+    : d_observer_p(observer)
+    , d_records_p(records)
+    , d_numRecords(numRecords)
+    , d_maxLatency_p(maxLatency)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Publish the records supplied at construction.
+    {
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        bsls::Types::Int64 maxLatency = 0;
+
+        for (int i = 0; i < d_numRecords; ++i) {
+            const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+            d_observer_p->publish((*d_records_p)[i % d_records_p->size()],
+                                  context);
+
+            maxLatency = bsl::max(maxLatency,
+                                  bsls::TimeUtil::getTimer() - start);
+        }
+
+        *d_maxLatency_p = maxLatency;
+    }
+};
+
+int countLinesInMatchingFiles(const bsl::string& pattern)
+    // Return the total number of lines in the files whose names match the
+    // specified 'pattern'.
+{
+    bsl::vector<bsl::string> fileNames;
+    FsUtil::findMatchingPaths(&fileNames, pattern.c_str());
+
+    int numLines = 0;
+    for (bsl::size_t i = 0; i < fileNames.size(); ++i) {
+        numLines += getNumLines(fileNames[i].c_str());
+    }
+    return numLines;
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -712,7 +786,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -788,6 +862,495 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING ASYNCHRONOUS WRITING
+        //
+        // Concerns:
+        //: 1 'enableAsynchronousWriting' returns 0 and starts asynchronous
+        //:   writing, or returns a positive value, with no effect, if
+        //:   asynchronous writing is already enabled; asynchronous writing
+        //:   can be disabled and reenabled.
+        //:
+        //: 2 Records published, individually or in batches, with asynchronous
+        //:   writing enabled are written to the log file, in order, with the
+        //:   same content as when written synchronously, once asynchronous
+        //:   writing or file logging is disabled, or the observer destroyed.
+        //:
+        //: 3 No record is lost or interleaved when several threads publish
+        //:   concurrently, even when publishers must wait for the writer
+        //:   thread because the buffer is full.
+        //:
+        //: 4 'forceRotation' writes the pending records to the log file
+        //:   before rotating it.
+        //:
+        //: 5 The rotation rules are applied, and the rotation callback
+        //:   invoked, by the writer thread.
+        //
+        // Plan:
+        //: 1 Enable, reenable, disable and enable again asynchronous writing,
+        //:   verifying the return values and 'isAsynchronousWritingEnabled'.
+        //:   (C-1)
+        //:
+        //: 2 Publish a sequence of records to one observer synchronously and
+        //:   to others asynchronously, individually and in batches, end
+        //:   asynchronous writing in each of the ways listed in C-2, and
+        //:   compare the log files.  (C-2)
+        //:
+        //: 3 Publish records from several threads to an observer having a
+        //:   one-byte buffer, and verify the number of lines in the log file
+        //:   and that each record is intact.  (C-3)
+        //:
+        //: 4 Publish records asynchronously, call 'forceRotation', and
+        //:   verify that the rotated file holds all of the records.  (C-4)
+        //:
+        //: 5 Configure rotation on size, publish enough records to exceed it
+        //:   asynchronously, and verify that the rotation callback is
+        //:   invoked and that no record is lost.  (C-5)
+        //
+        // Testing:
+        //   void disableAsynchronousWriting();
+        //   int  enableAsynchronousWriting(int maxBufferSize);
+        //   bool isAsynchronousWritingEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ASYNCHRONOUS WRITING"
+                          << "\n============================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        enum { k_NUM_RECORDS = 200 };
+
+        bsl::vector<ball::Record>         records(&ta);
+        bsl::vector<const ball::Record *> recordPtrs(&ta);
+
+        records.reserve(k_NUM_RECORDS);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream oss;
+            oss << "async message " << i << bsl::string(i % 50, 'x');
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        32 * (1 + i % 6),
+                                        oss.str().c_str());
+
+            records.push_back(ball::Record(attr, ball::UserFields()));
+            recordPtrs.push_back(&records.back());
+        }
+
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (veryVerbose) cout << "\tTesting enabling and disabling." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isAsynchronousWritingEnabled());
+
+            mX.disableAsynchronousWriting();
+            ASSERT(false == X.isAsynchronousWritingEnabled());
+
+            ASSERT(0 == mX.enableAsynchronousWriting());
+            ASSERT(true == X.isAsynchronousWritingEnabled());
+
+            ASSERT(0 < mX.enableAsynchronousWriting(16));
+            ASSERT(true == X.isAsynchronousWritingEnabled());
+
+            mX.disableAsynchronousWriting();
+            ASSERT(false == X.isAsynchronousWritingEnabled());
+
+            ASSERT(0 == mX.enableAsynchronousWriting(16));
+            ASSERT(true == X.isAsynchronousWritingEnabled());
+
+            // Destroy 'mX' with asynchronous writing enabled.
+        }
+
+        if (veryVerbose) cout << "\tComparing with synchronous writing."
+                              << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string syncFileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&syncFileName, "syncLog");
+
+            Obj mS(&ta);
+
+            ASSERT(0 == mS.enableFileLogging(syncFileName.c_str()));
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mS.publish(records[i], context);
+            }
+            mS.disableFileLogging();
+
+            bsl::string expected;
+            ASSERT(2 * k_NUM_RECORDS == readFileIntoString(__LINE__,
+                                                           syncFileName,
+                                                           expected));
+
+            enum { e_DISABLE_ASYNC, e_DISABLE_FILE, e_DESTROY, e_NUM_ENDS };
+
+            for (int end = 0; end < e_NUM_ENDS; ++end) {
+            for (int useBatch = 0; useBatch < 2; ++useBatch) {
+                if (veryVeryVerbose) { T_; T_; P_(end); P(useBatch); }
+
+                bsl::ostringstream oss;
+                oss << "asyncLog" << end << useBatch;
+
+                bsl::string fileName(tempDirGuard.getTempDirName());
+                bdls::PathUtil::appendRaw(&fileName, oss.str().c_str());
+
+                {
+                    Obj mX(&ta);
+
+                    ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+                    ASSERT(0 == mX.enableAsynchronousWriting());
+
+                    if (useBatch) {
+                        int i = 0;
+                        for (int n = 1; i < k_NUM_RECORDS; ++n) {
+                            const int numRecords = bsl::min(n,
+                                                            k_NUM_RECORDS - i);
+
+                            mX.publishBatch(&recordPtrs[i], numRecords);
+                            i += numRecords;
+                        }
+                    }
+                    else {
+                        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                            mX.publish(records[i], context);
+                        }
+                    }
+
+                    if (e_DISABLE_ASYNC == end) {
+                        mX.disableAsynchronousWriting();
+                        ASSERT(false == mX.isAsynchronousWritingEnabled());
+                    }
+                    else if (e_DISABLE_FILE == end) {
+                        mX.disableFileLogging();
+                        ASSERT(true == mX.isAsynchronousWritingEnabled());
+
+                        // Records published while file logging is disabled
+                        // are dropped.
+
+                        mX.publish(records[0], context);
+                    }
+                }
+
+                bsl::string content;
+                ASSERTV(end, useBatch,
+                        2 * k_NUM_RECORDS == readFileIntoString(__LINE__,
+                                                                fileName,
+                                                                content));
+                ASSERTV(end, useBatch, expected == content);
+            }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting concurrent publishers." << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_PER_THREAD = 2000 };
+
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "concurrentLog");
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableAsynchronousWriting(1));
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            bsls::Types::Int64        maxLatencies[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &handles[i],
+                                    ConcurrentPublisher(&mX,
+                                                        &records,
+                                                        k_NUM_PER_THREAD,
+                                                        &maxLatencies[i])));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            mX.disableAsynchronousWriting();
+            mX.disableFileLogging();
+
+            bsl::string content;
+            ASSERTV(2 * k_NUM_THREADS * k_NUM_PER_THREAD ==
+                             readFileIntoString(__LINE__, fileName, content));
+
+            // Each record is written as an empty line followed by a line
+            // ending in its message.
+
+            bsl::vector<bsl::string> lines;
+            splitStringIntoLines(&lines, content.c_str());
+            ASSERTV(lines.size(),
+                    k_NUM_THREADS * k_NUM_PER_THREAD == lines.size());
+
+            for (bsl::size_t i = 0; i < lines.size(); ++i) {
+                const bsl::string& line = lines[i];
+                const bsl::size_t  pos  = line.find("async message ");
+
+                ASSERTV(i, line, bsl::string::npos != pos);
+                if (bsl::string::npos == pos) {
+                    continue;
+                }
+
+                const int n = bsl::atoi(line.c_str() + pos + 14);
+
+                ASSERTV(i, line, 0 <= n && n < k_NUM_RECORDS);
+                if (0 <= n && n < k_NUM_RECORDS) {
+                    ASSERTV(i, line,
+                            bsl::string::npos !=
+                              line.find(records[n].fixedFields().message()));
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting 'forceRotation'." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "forceLog");
+
+            Obj   mX(&ta);
+            RotCb cb(&ta);
+
+            mX.setOnFileRotationCallback(cb);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableAsynchronousWriting());
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mX.publish(records[i], context);
+            }
+
+            mX.forceRotation();
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+            ASSERTV(getNumLines(cb.rotatedFileName().c_str()),
+                    2 * k_NUM_RECORDS ==
+                                   getNumLines(cb.rotatedFileName().c_str()));
+
+            mX.disableFileLogging();
+        }
+
+        if (veryVerbose) cout << "\tTesting rotation on size." << endl;
+        {
+            enum { k_BATCH_SIZE = 20 };
+
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "sizeLog%p");
+
+            bsl::string filePattern(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&filePattern, "sizeLog*");
+
+            Obj   mX(&ta);
+            RotCb cb(&ta);
+
+            mX.setOnFileRotationCallback(cb);
+            mX.rotateOnSize(1);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableAsynchronousWriting());
+
+            // Publish each round as one batch, so that the writer thread
+            // writes it as one buffer (exceeding the rotation size), and
+            // sleep between rounds so that rotated file names differ.
+
+            for (int round = 0; round < 3; ++round) {
+                mX.publishBatch(recordPtrs.data(), k_BATCH_SIZE);
+                mX.disableAsynchronousWriting();
+
+                ASSERTV(round, cb.numInvocations(),
+                        round == cb.numInvocations());
+
+                ASSERT(0 == mX.enableAsynchronousWriting());
+                bslmt::ThreadUtil::microSleep(0, 1);
+            }
+
+            mX.disableFileLogging();
+
+            ASSERTV(cb.status(), 0 == cb.status());
+
+            const int numLines = countLinesInMatchingFiles(filePattern);
+            ASSERTV(numLines, 2 * 3 * k_BATCH_SIZE == numLines);
+        }
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes the same output to the log file as
+        //:   'publish' called for each record of the batch, in order.
+        //:
+        //: 2 'publishBatch' has no effect if file logging is disabled, or the
+        //:   batch is empty.
+        //:
+        //: 3 The rotation rules are evaluated once per batch, before the batch
+        //:   is written, and the rotation callback is invoked accordingly.
+        //
+        // Plan:
+        //: 1 Publish a sequence of records, having varying messages and
+        //:   severities, to one observer with 'publish', and to another, in
+        //:   batches of varying sizes, with 'publishBatch', and compare the
+        //:   log files.  (C-1)
+        //:
+        //: 2 Call 'publishBatch' with an empty batch, and with file logging
+        //:   disabled, and verify that nothing is written.  (C-2)
+        //:
+        //: 3 Configure rotation on size, publish a batch larger than the
+        //:   rotation size, and verify that no rotation occurred; then publish
+        //:   another batch, and verify that the rotation callback is invoked
+        //:   once and that the rotated file holds the whole first batch.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, int numRecords);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        enum { k_NUM_RECORDS = 100 };
+
+        bsl::vector<ball::Record>         records(&ta);
+        bsl::vector<const ball::Record *> recordPtrs(&ta);
+
+        records.reserve(k_NUM_RECORDS);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream oss;
+            oss << "batched message " << i << bsl::string(i, 'x');
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        32 * (1 + i % 6),
+                                        oss.str().c_str());
+
+            records.push_back(ball::Record(attr, ball::UserFields()));
+        }
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            recordPtrs.push_back(&records[i]);
+        }
+
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (veryVerbose) cout << "\tComparing with 'publish'." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string singleFileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&singleFileName, "singleLog");
+
+            bsl::string batchFileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&batchFileName, "batchLog");
+
+            Obj mX(&ta);  Obj mY(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(singleFileName.c_str()));
+            ASSERT(0 == mY.enableFileLogging(batchFileName.c_str()));
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mX.publish(records[i], context);
+            }
+
+            // Publish batches of 1, 2, 3, ... records.
+
+            int i = 0;
+            for (int n = 1; i < k_NUM_RECORDS; ++n) {
+                const int numRecords = bsl::min(n, k_NUM_RECORDS - i);
+
+                mY.publishBatch(&recordPtrs[i], numRecords);
+                i += numRecords;
+            }
+
+            mX.disableFileLogging();
+            mY.disableFileLogging();
+
+            bsl::string singleContent, batchContent;
+
+            ASSERT(2 * k_NUM_RECORDS == readFileIntoString(__LINE__,
+                                                           singleFileName,
+                                                           singleContent));
+            ASSERT(2 * k_NUM_RECORDS == readFileIntoString(__LINE__,
+                                                           batchFileName,
+                                                           batchContent));
+
+            ASSERTV(singleContent, batchContent,
+                    singleContent == batchContent);
+        }
+
+        if (veryVerbose) cout << "\tTesting empty batches and disabled "
+                                 "file logging." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "emptyLog");
+
+            Obj mX(&ta);
+
+            mX.publishBatch(recordPtrs.data(), k_NUM_RECORDS);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            mX.publishBatch(recordPtrs.data(), 0);
+            mX.publishBatch(0, 0);
+
+            ASSERT(0 == FsUtil::getFileSize(fileName));
+
+            mX.disableFileLogging();
+            mX.publishBatch(recordPtrs.data(), k_NUM_RECORDS);
+
+            ASSERT(0 == FsUtil::getFileSize(fileName));
+        }
+
+        if (veryVerbose) cout << "\tTesting rotation." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "rotLog");
+
+            Obj   mX(&ta);
+            RotCb cb(&ta);
+
+            mX.setOnFileRotationCallback(cb);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str(), true));
+
+            mX.rotateOnSize(1);
+
+            mX.publishBatch(recordPtrs.data(), k_NUM_RECORDS / 2);
+
+            ASSERTV(cb.numInvocations(), 0 == cb.numInvocations());
+
+            mX.publishBatch(recordPtrs.data() + k_NUM_RECORDS / 2, 1);
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+
+            ASSERTV(getNumLines(cb.rotatedFileName().c_str()),
+                    k_NUM_RECORDS ==
+                                   getNumLines(cb.rotatedFileName().c_str()));
+
+            mX.disableFileLogging();
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
@@ -3625,6 +4188,101 @@ int main(int argc, char *argv[])
         // Deregister here as we used local allocator for the observer.
         ASSERT(0 == manager.deregisterObserver("testObserver"));
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ASYNCHRONOUS WRITING
+        //
+        // Concern:
+        //: 1 With asynchronous writing enabled, publishing threads do not
+        //:   wait for the log file to be written.
+        //
+        // Plan:
+        //: 1 Publish records from several threads, with asynchronous writing
+        //:   disabled and then enabled, and report the elapsed time and the
+        //:   longest single call to 'publish' in each mode.  Optionally
+        //:   specify, as the second argument, the number of records
+        //:   published by each thread.
+        //
+        // Testing:
+        //   PERFORMANCE: ASYNCHRONOUS WRITING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: ASYNCHRONOUS WRITING"
+                          << "\n=================================" << endl;
+
+        enum { k_NUM_THREADS = 4 };
+
+        const int numPerThread = argc > 2 ? bsl::atoi(argv[2]) : 100000;
+
+        bsl::vector<ball::Record> records;
+        for (int i = 0; i < 16; ++i) {
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        ball::Severity::e_INFO,
+                                        bsl::string(40 + 8 * i, 'x').c_str());
+
+            records.push_back(ball::Record(attr, ball::UserFields()));
+        }
+
+        TempDirectoryGuard tempDirGuard;
+
+        for (int async = 0; async < 2; ++async) {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, async ? "async" : "sync");
+
+            Obj mX;
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            if (async) {
+                ASSERT(0 == mX.enableAsynchronousWriting());
+            }
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            bsls::Types::Int64        maxLatencies[k_NUM_THREADS];
+
+            const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &handles[i],
+                                    ConcurrentPublisher(&mX,
+                                                        &records,
+                                                        numPerThread,
+                                                        &maxLatencies[i])));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            const bsls::Types::Int64 publishTime =
+                                         bsls::TimeUtil::getTimer() - start;
+
+            mX.disableAsynchronousWriting();
+            mX.disableFileLogging();
+
+            const bsls::Types::Int64 totalTime =
+                                         bsls::TimeUtil::getTimer() - start;
+
+            bsls::Types::Int64 maxLatency = 0;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                maxLatency = bsl::max(maxLatency, maxLatencies[i]);
+            }
+
+            const double numRecords = static_cast<double>(k_NUM_THREADS)
+                                    * numPerThread;
+
+            cout << (async ? "asynchronous" : "synchronous ")
+                 << ": publish " << numRecords / publishTime * 1.0e9
+                 << " records/sec, written " << numRecords / totalTime * 1.0e9
+                 << " records/sec, longest 'publish' "
+                 << static_cast<double>(maxLatency) / 1000.0 << " us"
+                 << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -16,6 +16,15 @@ namespace ball {
                         // class FixedSizeRecordBuffer
                         // ---------------------------
 
+// PRIVATE MANIPULATORS
+void FixedSizeRecordBuffer::lockForPush()
+{
+    if (0 != d_mutex.tryLock()) {
+        ++d_numContendedPushes;
+        d_mutex.lock();
+    }
+}
+
 // CREATORS
 FixedSizeRecordBuffer::~FixedSizeRecordBuffer()
 {
@@ -49,7 +58,8 @@ void FixedSizeRecordBuffer::popFront()
 
 int FixedSizeRecordBuffer::pushBack(const bsl::shared_ptr<Record>& handle)
 {
-    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    lockForPush();
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex, 1);
 
     int size = handle->numAllocatedBytes() +
            static_cast<int>(
@@ -89,7 +99,8 @@ int FixedSizeRecordBuffer::pushBack(const bsl::shared_ptr<Record>& handle)
 
 int FixedSizeRecordBuffer::pushFront(const bsl::shared_ptr<Record>& handle)
 {
-    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex);
+    lockForPush();
+    bslmt::LockGuard<bslmt::RecursiveMutex> guard(&d_mutex, 1);
 
     int size = handle->numAllocatedBytes() +
            static_cast<int>(
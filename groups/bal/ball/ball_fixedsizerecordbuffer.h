@@ -38,6 +38,7 @@ BSLS_IDENT("$Id: $")
 //                                           length
 //                                           back
 //                                           front
+//                                           numContendedPushes
 //..
 // The thread-safe class 'ball::FixedSizeRecordBuffer' manages record handles
 // (specifically, the instances of 'bsl::shared_ptr<ball::Record>') in a
@@ -57,6 +58,13 @@ BSLS_IDENT("$Id: $")
 // record can not be accommodated in the buffer, it is silently (but otherwise
 // safely) discarded.
 //
+// A logger records each message that it logs at or above its record level by
+// calling 'pushBack' on its record buffer, so that a buffer shared by several
+// threads (as is the buffer of the default logger of 'ball::LoggerManager')
+// may be contended.  The accessor 'numContendedPushes' reports the number of
+// calls to 'pushBack' and 'pushFront' that had to wait for another thread to
+// release the buffer.
+//
 ///Usage
 ///-----
 // In the following example we demonstrate creation of a limited record buffer
@@ -137,6 +145,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
 #include <bsl_deque.h>
 #include <bsl_memory.h>
 
@@ -182,10 +193,19 @@ class FixedSizeRecordBuffer: public RecordBuffer {
     bsl::deque<bsl::shared_ptr<Record> >
                                   d_deque;       // deque of record handles
 
+    bsls::AtomicInt64             d_numContendedPushes;
+                                                 // number of pushes that
+                                                 // waited for 'd_mutex'
+
     // NOT IMPLEMENTED
     FixedSizeRecordBuffer(const FixedSizeRecordBuffer&);
     FixedSizeRecordBuffer& operator=(const FixedSizeRecordBuffer&);
 
+    // PRIVATE MANIPULATORS
+    void lockForPush();
+        // Lock 'd_mutex', first incrementing 'd_numContendedPushes' if it is
+        // locked by another thread.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FixedSizeRecordBuffer,
@@ -263,6 +283,11 @@ class FixedSizeRecordBuffer: public RecordBuffer {
 
     virtual int length() const;
         // Return the number of record handles in this record buffer.
+
+    bsls::Types::Int64 numContendedPushes() const;
+        // Return the number of calls to 'pushBack' and 'pushFront' on this
+        // record buffer that found it locked by another thread and waited
+        // for it to be released.
 };
 
 // ============================================================================
@@ -281,6 +306,7 @@ FixedSizeRecordBuffer::FixedSizeRecordBuffer(int               maxTotalSize,
 , d_currentTotalSize(0)
 , d_allocator(basicAllocator)
 , d_deque(&d_allocator)
+, d_numContendedPushes(0)
 {
 }
 
@@ -327,6 +353,12 @@ int FixedSizeRecordBuffer::length() const
     return static_cast<int>(d_deque.size());
 }
 
+inline
+bsls::Types::Int64 FixedSizeRecordBuffer::numContendedPushes() const
+{
+    return d_numContendedPushes.loadRelaxed();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
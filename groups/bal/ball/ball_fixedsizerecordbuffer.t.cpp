@@ -64,6 +64,9 @@ using namespace bsl;  // automatically added by script
 //     Testing that a thread gets exclusive access to the buffer between the
 //     calls to 'beginSequence' and 'endSequence'.  This is tested in [9]
 //     and [10].
+//
+//     Testing that 'numContendedPushes' counts the pushes that wait for
+//     another thread.  This is tested in [15].
 //-----------------------------------------------------------------------------
 // CREATORS
 // [ 1] ball::FixedSizeRecordBuffer();
@@ -82,13 +85,14 @@ using namespace bsl;  // automatically added by script
 // [ 6] int length() const;
 // [ 5] const bsl::shared_ptr<ball::Record>& back() const;
 // [11] const bsl::shared_ptr<ball::Record>& front() const;
+// [15] bsls::Types::Int64 numContendedPushes() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 7] TESTING 'PUSHBACK' CONSIDERING THE EFFECT OF 'MAX_TOTAL_SIZE' PARAMETER
 // [ 8] CONCURRENCY TEST FOR 'PUSHBACK', 'POPBACK', 'REMOVE_ALL' AND 'LENGTH'
 // [ 9] CONCURRENCY TEST-1 FOR 'BEGIN_SEQUENCE' AND 'END_SEQUENCE'
 // [14] STRESS TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 //=============================================================================
 //                        STANDARD BDE ASSERT TEST MACROS
 //-----------------------------------------------------------------------------
@@ -252,10 +256,10 @@ ball::Record *buildRecord(bdlt::Datetime    time,
     return r;
 }
 //=============================================================================
-//                         CASE 15 RELATED ENTITIES
+//                         CASE 16 RELATED ENTITIES
 //-----------------------------------------------------------------------------
 
-namespace TestCase15
+namespace TestCase16
 {
 enum {
     K              = 1024,
@@ -268,7 +272,7 @@ bslma::Allocator *basicAllocator = bslma::Default::defaultAllocator();
 ball::FixedSizeRecordBuffer recordBuffer(MAX_TOTAL_SIZE, basicAllocator);
 
 extern "C" {
-void *workerThread15(void *arg)
+void *workerThread16(void *arg)
 {
     int id = (int)(bsls::Types::IntPtr)arg; // thread id
     for(int i = 0; i < NUM_ITERATIONS; ++i){
@@ -298,6 +302,37 @@ void *workerThread15(void *arg)
 }
 } // extern "C"
 
+}  // close namespace TestCase16
+//-----------------------------------------------------------------------------
+namespace TestCase15
+{
+enum {
+    MAX_TOTAL_SIZE = 32 * 1024
+};
+
+struct Pusher {
+    // Arguments of 'pushThread'.
+
+    ball::FixedSizeRecordBuffer *d_buffer_p;   // buffer to push to
+    const Handle                *d_handle_p;   // handle to push
+    bool                         d_frontFlag;  // 'pushFront' if 'true'
+};
+
+extern "C" {
+void *pushThread(void *arg)
+{
+    const Pusher *pusher = (const Pusher *)arg;
+
+    if (pusher->d_frontFlag) {
+        pusher->d_buffer_p->pushFront(*pusher->d_handle_p);
+    }
+    else {
+        pusher->d_buffer_p->pushBack(*pusher->d_handle_p);
+    }
+    return NULL;
+}
+} // extern "C"
+
 }  // close namespace TestCase15
 //-----------------------------------------------------------------------------
 namespace TestCase14
@@ -512,7 +547,7 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:  // Zero is always the leading case.
 
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE:
         //
@@ -530,10 +565,73 @@ int main(int argc, char *argv[])
                           << "TESTING USAGE EXAMPLE" << endl
                           << "=====================" << endl;
 
+        using namespace TestCase16;
+
+        executeInParallel(NUM_THREADS, workerThread16);
+
+      } break;
+
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'numContendedPushes':
+        //
+        // Concerns:
+        //   That 'numContendedPushes' is 0 for a buffer used by a single
+        //   thread, and is incremented by each 'pushBack' and 'pushFront'
+        //   that finds the buffer locked by another thread.
+        //
+        // Plan:
+        //   Push records from the main thread and verify that the counter
+        //   remains 0.  Then lock the buffer with 'beginSequence', start a
+        //   thread that invokes 'pushBack' (respectively 'pushFront'), wait
+        //   for the counter to be incremented, unlock the buffer, and verify
+        //   that the record was pushed once the thread is joined.
+        //
+        // Testing:
+        //   bsls::Types::Int64 numContendedPushes() const;
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "TESTING 'numContendedPushes'" << endl
+                          << "============================" << endl;
+
         using namespace TestCase15;
 
-        executeInParallel(NUM_THREADS, workerThread15);
+        bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+        ball::FixedSizeRecordBuffer mX(MAX_TOTAL_SIZE, allocator);
+        const ball::FixedSizeRecordBuffer& X = mX;
+
+        ASSERT(0 == X.numContendedPushes());
+
+        Handle handle(new (*allocator) ball::Record(allocator),
+                      allocator,
+                      allocator);
+
+        mX.pushBack(handle);
+        mX.pushFront(handle);
+        ASSERT(2 == X.length());
+        ASSERT(0 == X.numContendedPushes());
+
+        for (int front = 0; front < 2; ++front) {
+            Pusher pusher = { &mX, &handle, 0 != front };
+
+            mX.beginSequence();
 
+            bslmt::ThreadUtil::Handle thread;
+            ASSERT(0 == bslmt::ThreadUtil::create(&thread,
+                                                  pushThread,
+                                                  &pusher));
+
+            while (front + 1 != X.numContendedPushes()) {
+                bslmt::ThreadUtil::yield();
+            }
+            LOOP_ASSERT(front, 2 + front == X.length());
+
+            mX.endSequence();
+
+            ASSERT(0 == bslmt::ThreadUtil::join(thread));
+            LOOP_ASSERT(front, 3 + front == X.length());
+            LOOP_ASSERT(front, front + 1 == X.numContendedPushes());
+        }
       } break;
 
       case 14: {
@@ -605,6 +605,8 @@ LoggerManager::LoggerManager(
 , d_defaultCategory_p(0)
 , d_scratchBufferSize(configuration.defaults().defaultLoggerBufferSize())
 , d_defaultLoggers(bslma::Default::globalAllocator(globalAllocator))
+, d_defaultLoggersGeneration(1)
+, d_numLoggerRegistryLookups(0)
 , d_logOrder(configuration.logOrder())
 , d_triggerMarkers(configuration.triggerMarkers())
 , d_allocator_p(bslma::Default::globalAllocator(globalAllocator))
@@ -632,6 +634,14 @@ void LoggerManager::constructObject(
     BSLS_ASSERT(0 == d_defaultCategory_p);
     BSLS_ASSERT(0 == d_recordBuffer_p);
 
+    // The per-thread logger cache keys are created without a destructor since
+    // the values they hold are not owned.
+
+    int rc = bslmt::ThreadUtil::createKey(&d_cachedLoggerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);
+    rc = bslmt::ThreadUtil::createKey(&d_cachedGenerationKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);
+
     d_publishAllCallback = bsl::function<void(Transmission::Cause)>(
       bsl::allocator_arg_t(),
       bsl::allocator<bsl::function<void(Transmission::Cause)> >(d_allocator_p),
@@ -659,6 +669,16 @@ void LoggerManager::constructObject(
                                    d_defaultThresholdLevels.triggerAllLevel());
 }
 
+void LoggerManager::invalidateCachedLoggers()
+{
+    // A generation of 0 is reserved to identify a thread that has no cached
+    // logger (the initial value of a thread-specific key).
+
+    if (0 == d_defaultLoggersGeneration.addRelaxed(1)) {
+        d_defaultLoggersGeneration.addRelaxed(1);
+    }
+}
+
 void LoggerManager::publishAllImp(Transmission::Cause cause)
 {
     bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_loggersLock);
@@ -990,6 +1010,8 @@ LoggerManager::LoggerManager(
 , d_defaultCategory_p(0)
 , d_scratchBufferSize(configuration.defaults().defaultLoggerBufferSize())
 , d_defaultLoggers(bslma::Default::globalAllocator(globalAllocator))
+, d_defaultLoggersGeneration(1)
+, d_numLoggerRegistryLookups(0)
 , d_logOrder(configuration.logOrder())
 , d_triggerMarkers(configuration.triggerMarkers())
 , d_allocator_p(bslma::Default::globalAllocator(globalAllocator))
@@ -1023,6 +1045,9 @@ LoggerManager::~LoggerManager()
     }
     d_recordBuffer_p->~RecordBuffer();
     d_allocator_p->deallocate(d_recordBuffer_p);
+
+    bslmt::ThreadUtil::deleteKey(d_cachedGenerationKey);
+    bslmt::ThreadUtil::deleteKey(d_cachedLoggerKey);
 }
 
 // MANIPULATORS
@@ -1168,6 +1193,7 @@ void LoggerManager::deallocateLogger(Logger *logger)
             ++itr;
         }
     }
+    invalidateCachedLoggers();
     d_defaultLoggersLock.unlock();
 
     logger->~Logger();
@@ -1176,13 +1202,45 @@ void LoggerManager::deallocateLogger(Logger *logger)
 
 Logger& LoggerManager::getLogger()
 {
-    // TBD: optimize it using thread local storage
+    // Each thread caches the registry entry for itself (0 if it uses the
+    // default logger) along with the generation of the registry at which that
+    // entry was loaded.  The registry is consulted only if the generation has
+    // changed since.  Note that the generation is read under the same lock as
+    // the registry, so that a concurrent change to the registry is reflected
+    // in the generation no later than in the entry.
+
+    typedef bsls::Types::IntPtr IntPtr;
+
+    const IntPtr generation = d_defaultLoggersGeneration.loadAcquire();
+    if (generation == reinterpret_cast<IntPtr>(
+                      bslmt::ThreadUtil::getSpecific(d_cachedGenerationKey))) {
+        Logger *logger = static_cast<Logger *>(
+                            bslmt::ThreadUtil::getSpecific(d_cachedLoggerKey));
+        return logger ? *logger : *d_logger_p;                        // RETURN
+    }
 
-    d_defaultLoggersLock.lockRead();
-    bsl::map<void *, Logger *>::iterator itr =
+    ++d_numLoggerRegistryLookups;
+
+    Logger *logger = 0;
+    IntPtr  loadedGeneration;
+    {
+        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(
+                                                        &d_defaultLoggersLock);
+
+        bsl::map<void *, Logger *>::const_iterator itr =
             d_defaultLoggers.find((void *)bslmt::ThreadUtil::selfIdAsUint64());
-    d_defaultLoggersLock.unlock();
-    return itr != d_defaultLoggers.end() ? *(itr->second) : *d_logger_p;
+        if (itr != d_defaultLoggers.end()) {
+            logger = itr->second;
+        }
+        loadedGeneration = d_defaultLoggersGeneration.loadRelaxed();
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_cachedLoggerKey, logger);
+    bslmt::ThreadUtil::setSpecific(
+                             d_cachedGenerationKey,
+                             reinterpret_cast<const void *>(loadedGeneration));
+
+    return logger ? *logger : *d_logger_p;
 }
 
 void LoggerManager::setLogger(Logger *logger)
@@ -1197,6 +1255,7 @@ void LoggerManager::setLogger(Logger *logger)
     else {
         d_defaultLoggers[id] = logger;
     }
+    invalidateCachedLoggers();
 }
 
                              // Category Management
@@ -1445,6 +1504,15 @@ const Category *LoggerManager::lookupCategory(const char *categoryName) const
                                                        d_nameFilter));
 }
 
+bsls::Types::Int64 LoggerManager::numContendedRecordBufferPushes() const
+{
+    // 'd_recordBuffer_p' is always created as a 'FixedSizeRecordBuffer' (see
+    // 'constructObject').
+
+    return static_cast<const FixedSizeRecordBuffer *>(d_recordBuffer_p)
+                                                      ->numContendedPushes();
+}
+
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
 const Observer *LoggerManager::observer() const
 {
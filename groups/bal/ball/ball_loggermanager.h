@@ -333,6 +333,32 @@ BSLS_IDENT("$Id: $")
 // have them share a common logger so that the trace-back log *does* include
 // all relevant records.
 //
+// Every logging call (including each use of the logging macros) obtains the
+// logger for the calling thread via the 'getLogger' method.  So that threads
+// logging at a high rate do not contend on the registry of per-thread
+// loggers, each thread caches the result of its most recent registry lookup
+// in thread-local storage, and 'getLogger' consults the registry (acquiring
+// a read lock) only when that cache is absent or has been invalidated by a
+// call to 'setLogger' or 'deallocateLogger' from any thread.  The accessor
+// 'numLoggerRegistryLookups' reports the number of times the registry has
+// been consulted, and may be compared against the total number of logging
+// calls to gauge the residual contention.
+//
+// Records are then published to the registered observers through a
+// 'ball::BroadcastObserver', which does so without acquiring a lock (see
+// 'ball_broadcastobserver'); 'numObserverPublishRetries' reports how often
+// publishing coincided with the registration or deregistration of an
+// observer.  A record whose severity is at least the record level of its
+// category is also stored in the record buffer of the logger, which *is*
+// guarded by a mutex; since the default record level is 'e_OFF', this lock
+// is taken only when record buffering is enabled, and
+// 'numContendedRecordBufferPushes' reports how often a thread had to wait
+// for it.  Note that the observers themselves may serialize publication: a
+// record published to an asynchronous observer (see
+// 'ball_asyncfileobserver') is handed off via a lock-free queue, whereas
+// other observers (such as 'ball::FileObserver') write each record while
+// holding a mutex of their own.
+//
 ///'bsls::Log' Logging Redirection
 ///-------------------------------
 // The 'ball::LoggerManager' singleton, on construction, redirects 'bsls::Log'
@@ -886,8 +912,11 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 #include <bslmt_readerwritermutex.h>
+#include <bslmt_threadutil.h>
 
+#include <bsls_atomic.h>
 #include <bsls_compilerfeatures.h>
+#include <bsls_types.h>
 
 #include <bsl_functional.h>
 #include <bsl_map.h>
@@ -1263,6 +1292,26 @@ class LoggerManager {
     bslmt::ReaderWriterMutex
                            d_defaultLoggersLock; // registry lock
 
+    bsls::AtomicInt        d_defaultLoggersGeneration;
+                                                 // incremented (skipping 0)
+                                                 // on each change to the
+                                                 // registry
+
+    bslmt::ThreadUtil::Key d_cachedLoggerKey;    // thread-local cached
+                                                 // registry entry (0 for the
+                                                 // default logger)
+
+    bslmt::ThreadUtil::Key d_cachedGenerationKey;
+                                                 // thread-local generation of
+                                                 // the registry at which
+                                                 // 'd_cachedLoggerKey' was
+                                                 // loaded (0 if never)
+
+    bsls::AtomicInt64      d_numLoggerRegistryLookups;
+                                                 // number of times
+                                                 // 'getLogger' consulted the
+                                                 // registry
+
     LoggerManagerConfiguration::LogOrder
                            d_logOrder;           // logging order
 
@@ -1309,6 +1358,12 @@ class LoggerManager {
         // 'configuration'.  The behavior is undefined if this method is
         // invoked more than once on this logger manager.
 
+    void invalidateCachedLoggers();
+        // Invalidate the logger cached by every thread for use by 'getLogger',
+        // so that each thread consults the registry of per-thread loggers on
+        // its next call to 'getLogger'.  The behavior is undefined unless the
+        // calling thread holds a write lock on 'd_defaultLoggersLock'.
+
     void publishAllImp(Transmission::Cause cause);
         // Transmit to the observers registered with this logger manager all
         // log records accumulated in the record buffers of all loggers managed
@@ -1850,6 +1905,27 @@ class LoggerManager {
         // Return the number of categories in the category registry of this
         // logger manager.
 
+    bsls::Types::Int64 numContendedRecordBufferPushes() const;
+        // Return the number of records that the default logger of this
+        // logger manager stored in its record buffer only after waiting for
+        // another thread to release that buffer.  Note that a record is
+        // stored only if its severity is at least as severe as the record
+        // level of its category, which is 'e_OFF' by default.
+
+    bsls::Types::Int64 numLoggerRegistryLookups() const;
+        // Return the number of times 'getLogger' has consulted the registry of
+        // per-thread loggers, acquiring the lock that guards it, because the
+        // logger cached by the calling thread was absent or had been
+        // invalidated.  Note that, in steady state, this number grows only
+        // when a thread calls 'getLogger' for the first time, or for the
+        // first time after any thread calls 'setLogger' or
+        // 'deallocateLogger', and not with the number of records logged.
+
+    bsls::Types::Int64 numObserverPublishRetries() const;
+        // Return the number of times the publication of a record to the
+        // observers registered with this logger manager was retried because
+        // an observer was concurrently registered or deregistered.
+
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
     const Observer *observer() const;
         // Return the address of the non-modifiable observer registered with
@@ -2317,6 +2393,18 @@ int LoggerManager::numCategories() const
     return d_categoryManager.length();
 }
 
+inline
+bsls::Types::Int64 LoggerManager::numLoggerRegistryLookups() const
+{
+    return d_numLoggerRegistryLookups.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 LoggerManager::numObserverPublishRetries() const
+{
+    return d_observer->numPublishRetries();
+}
+
 inline
 const RuleSet& LoggerManager::ruleSet() const
 {
@@ -40,6 +40,8 @@
 #include <bslmt_condition.h>
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
 #include <bslmt_threadutil.h>
 
 #include <bsls_atomic.h>
@@ -139,8 +141,8 @@ using namespace bdlf::PlaceHolders;
 // [18] ball::Logger *allocateLogger(*buffer, *observer);
 // [18] ball::Logger *allocateLogger(*buffer, int msgBufSize, *observer);
 // [18] void deallocateLogger(ball::Logger *logger);
-// [ *] ball::Logger& getLogger();
-// [18] void setLogger(ball::Logger *logger);
+// [44] ball::Logger& getLogger();
+// [44] void setLogger(ball::Logger *logger);
 // [13] Category *addCategory(const char *name, int, int, int, int);
 // [13] Category& defaultCategory();
 // [13] Category *lookupCategory(const char *name);
@@ -171,6 +173,9 @@ using namespace bdlf::PlaceHolders;
 // [ *] const Cat *lookupCategory(const char *name) const;
 // [13] int maxNumCategories() const;
 // [13] int numCategories() const;
+// [45] bsls::Types::Int64 numContendedRecordBufferPushes() const;
+// [44] bsls::Types::Int64 numLoggerRegistryLookups() const;
+// [45] bsls::Types::Int64 numObserverPublishRetries() const;
 // [NA] const Pop *userFieldsPopulatorCallback() const;
 //
 // 'ball::LoggerManagerScopedGuard' public interface:
@@ -220,6 +225,7 @@ using namespace bdlf::PlaceHolders;
 // [ 5] CONCERN: DEFAULT THRESHOLD LEVELS
 // [ 3] CONCERN: LOGGER MANAGER DEFAULTS
 // [-1] CONCERN: LEGACY OBSERVERS LIFETIME
+// [-3] CONCERN: 'getLogger' CONTENTION
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1571,6 +1577,167 @@ extern "C" {
 
 }  // close namespace BALL_LOGGERMANAGER_CONCURRENT_TESTS
 
+namespace BALL_LOGGERMANAGER_TEST_LOGGER_CACHE {
+
+enum {
+    k_NUM_THREADS = 4,          // number of threads
+    k_BUFFER_SIZE = 32 * 1024   // size of per-thread record buffers
+};
+
+bslmt::Barrier barrier(k_NUM_THREADS);
+
+ball::Logger *sharedLogger;  // logger installed, then deallocated, by thread 0
+
+bsls::AtomicInt numErrors(0);
+
+extern "C" {
+
+    void *workerThreadLoggerCache(void *arg)
+        // Thread for testing the invalidation of the loggers cached by
+        // 'getLogger'.  Thread 0 installs 'sharedLogger', odd numbered threads
+        // install a logger of their own, and the remaining threads use the
+        // default logger; all threads verify the result of 'getLogger' after
+        // each step taken by the other threads.
+    {
+        ball::LoggerManager& manager = Obj::singleton();
+
+        const int     id = static_cast<int>((bsls::Types::IntPtr)arg);
+        ball::Logger& defaultLogger = manager.getLogger();
+
+        ball::FixedSizeRecordBuffer buf(k_BUFFER_SIZE);
+
+        ball::Logger *expected = 0;
+        if (0 == id) {
+            expected = sharedLogger;
+        }
+        else if (1 == id % 2) {
+            expected = manager.allocateLogger(&buf);
+        }
+        else {
+            expected = &defaultLogger;
+        }
+
+        // Step 1: every thread installs (or not) its logger, and checks that
+        // a change by another thread does not disturb its cached logger.
+
+        if (expected != &defaultLogger) {
+            manager.setLogger(expected);
+        }
+        if (expected != &manager.getLogger()) {
+            ++numErrors;
+        }
+        barrier.wait();
+
+        for (int i = 0; i < 100; ++i) {
+            if (expected != &manager.getLogger()) {
+                ++numErrors;
+            }
+        }
+        barrier.wait();
+
+        // Step 2: thread 0 deallocates 'sharedLogger', after which thread 0
+        // must be given the default logger, and the other threads must be
+        // unaffected.
+
+        if (0 == id) {
+            manager.deallocateLogger(sharedLogger);
+            expected = &defaultLogger;
+        }
+        barrier.wait();
+
+        for (int i = 0; i < 100; ++i) {
+            if (expected != &manager.getLogger()) {
+                ++numErrors;
+            }
+        }
+        barrier.wait();
+
+        // Step 3: every thread restores the default logger.
+
+        manager.setLogger(0);
+        if (&defaultLogger != &manager.getLogger()) {
+            ++numErrors;
+        }
+        barrier.wait();
+
+        if (1 == id % 2) {
+            manager.deallocateLogger(expected);
+        }
+
+        return 0;
+    }
+
+    void *workerThreadGetLogger(void *arg)
+        // Thread for benchmarking 'getLogger': invoke 'getLogger' the number
+        // of times indicated by the specified 'arg'.
+    {
+        ball::LoggerManager& manager = Obj::singleton();
+        const int            numIterations =
+                                   static_cast<int>((bsls::Types::IntPtr)arg);
+
+        const ball::Logger *logger = &manager.getLogger();
+        for (int i = 0; i < numIterations; ++i) {
+            if (logger != &manager.getLogger()) {
+                ++numErrors;
+            }
+        }
+        return 0;
+    }
+
+}  // extern "C"
+
+bslmt::ReaderWriterMutex  registryLock;
+bsl::map<void *, Logger *> *registry_p;
+
+extern "C" {
+
+    void *workerThreadRegistryLookup(void *arg)
+        // Thread for benchmarking the lookup performed by 'getLogger' prior to
+        // the introduction of the per-thread cache: acquire a read lock and
+        // search a registry keyed on the thread id the number of times
+        // indicated by the specified 'arg'.
+    {
+        const int numIterations = static_cast<int>((bsls::Types::IntPtr)arg);
+
+        void *id = (void *)bslmt::ThreadUtil::selfIdAsUint64();
+        for (int i = 0; i < numIterations; ++i) {
+            bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(
+                                                                &registryLock);
+            if (registry_p->end() != registry_p->find(id)) {
+                ++numErrors;
+            }
+        }
+        return 0;
+    }
+
+}  // extern "C"
+
+double runInParallel(int                                numThreads,
+                     bslmt::ThreadUtil::ThreadFunction  func,
+                     int                                numIterations)
+    // Create the specified 'numThreads', each executing the specified 'func'
+    // with the specified 'numIterations' as argument, join them, and return
+    // the elapsed wall time in seconds.
+{
+    bsl::vector<bslmt::ThreadUtil::Handle> threads(numThreads);
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::create(&threads[i],
+                                  func,
+                                  (void *)(bsls::Types::IntPtr)numIterations);
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(threads[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close namespace BALL_LOGGERMANAGER_TEST_LOGGER_CACHE
+
 namespace BALL_LOGGERMANAGER_TEST_DEFAULTTHRESHOLDLEVELSCALLBACK {
 enum {
     k_NUM_THREADS = 4  // number of threads
@@ -1650,6 +1817,94 @@ class TestObserverVisitor {
 
 }  // close namespace TEST_CASE_OBSERVER_VISITOR
 
+namespace BALL_LOGGERMANAGER_TEST_CONTENTION_METRICS {
+
+class BlockingObserver : public ball::Observer {
+    // This class provides an observer that, when armed, blocks in 'publish'
+    // on the first record published by a trigger until it is released.
+
+    // DATA
+    bsls::AtomicBool d_armedFlag;    // 'true' if 'publish' should block
+    bsls::AtomicBool d_blockedFlag;  // 'true' once 'publish' has blocked
+
+  public:
+    // CREATORS
+    BlockingObserver()
+    : d_armedFlag(false)
+    , d_blockedFlag(false)
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    void publish(const bsl::shared_ptr<const ball::Record>&,
+                 const ball::Context&                       context)
+        // Block until 'release' is called if this observer is armed and the
+        // specified 'context' indicates a record published by a trigger.
+    {
+        if (ball::Transmission::e_TRIGGER == context.transmissionCause()
+         && d_armedFlag) {
+            d_blockedFlag = true;
+            while (d_armedFlag) {
+                bslmt::ThreadUtil::yield();
+            }
+        }
+    }
+
+    void arm()
+        // Make the next call to 'publish' for a triggered record block.
+    {
+        d_armedFlag = true;
+    }
+
+    void release()
+        // Release a call to 'publish' blocked by this observer, if any.
+    {
+        d_armedFlag = false;
+    }
+
+    // ACCESSORS
+    bool isBlocked() const
+        // Return 'true' if a call to 'publish' has blocked, and 'false'
+        // otherwise.
+    {
+        return d_blockedFlag;
+    }
+};
+
+void *toArg(int severity)
+    // Return the specified 'severity' as the argument of 'loggingThread'.
+{
+    const bsls::Types::IntPtr value = severity;
+
+    return reinterpret_cast<void *>(value);
+}
+
+extern "C" {
+
+    void *loggingThread(void *arg)
+        // Log one message having the severity specified by 'arg' to the
+        // "CONTENTION" category.
+    {
+        const int severity =
+                 static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(arg));
+
+        ball::LoggerManager& manager = Obj::singleton();
+        const ball::Category *category = manager.lookupCategory("CONTENTION");
+
+        manager.getLogger().logMessage(*category,
+                                       severity,
+                                       __FILE__,
+                                       __LINE__,
+                                       "message");
+        return 0;
+    }
+
+}  // extern "C"
+
+}  // close namespace BALL_LOGGERMANAGER_TEST_CONTENTION_METRICS
+
 // ============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1767,6 +2022,238 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 45: {
+        // --------------------------------------------------------------------
+        // TESTING CONTENTION METRICS
+        //
+        // Concerns:
+        //: 1 'numContendedRecordBufferPushes' and 'numObserverPublishRetries'
+        //:   are 0 when records are logged by a single thread.
+        //:
+        //: 2 'numContendedRecordBufferPushes' counts each record that the
+        //:   default logger stores in its record buffer only after waiting
+        //:   for another thread to release the buffer.
+        //
+        // Plan:
+        //: 1 Configure a logger manager that records every message, triggers
+        //:   on errors, and publishes nothing otherwise.  Log several
+        //:   messages from the main thread and verify that both metrics are
+        //:   0.  (C-1)
+        //:
+        //: 2 Log an error from a thread, and block the observer while the
+        //:   default logger publishes the contents of its record buffer (and
+        //:   so holds the buffer).  Log a message from a second thread and
+        //:   wait for 'numContendedRecordBufferPushes' to become 1, then
+        //:   release the observer and verify the metrics once both threads
+        //:   have been joined.  (C-2)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numContendedRecordBufferPushes() const;
+        //   bsls::Types::Int64 numObserverPublishRetries() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONTENTION METRICS" << endl
+                          << "==========================" << endl;
+
+        using namespace BALL_LOGGERMANAGER_TEST_CONTENTION_METRICS;
+
+        BlockingObserver                 observer;
+        ball::LoggerManagerConfiguration mLMC;
+
+        ASSERT(0 == mLMC.setDefaultThresholdLevelsIfValid(
+                                                     ball::Severity::e_TRACE,
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_ERROR,
+                                                     ball::Severity::e_OFF));
+        mLMC.setTriggerMarkers(ball::LoggerManagerConfiguration::e_NO_MARKERS);
+
+        ball::LoggerManagerScopedGuard lmg(&observer, mLMC);
+
+        Obj& mX = Obj::singleton();  const Obj& X = mX;
+
+        ASSERT(0 != mX.setCategory("CONTENTION"));
+
+        if (verbose) cout << "\tSingle thread." << endl;
+        {
+            for (int i = 0; i < 10; ++i) {
+                loggingThread(toArg(ball::Severity::e_INFO));
+            }
+            ASSERTV(X.numContendedRecordBufferPushes(),
+                    0 == X.numContendedRecordBufferPushes());
+            ASSERTV(X.numObserverPublishRetries(),
+                    0 == X.numObserverPublishRetries());
+        }
+
+        if (verbose) cout << "\tContended record buffer." << endl;
+        {
+            observer.arm();
+
+            bslmt::ThreadUtil::Handle triggering;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                           &triggering,
+                                           loggingThread,
+                                           toArg(ball::Severity::e_ERROR)));
+
+            while (!observer.isBlocked()) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            bslmt::ThreadUtil::Handle recording;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                            &recording,
+                                            loggingThread,
+                                            toArg(ball::Severity::e_INFO)));
+
+            while (0 == X.numContendedRecordBufferPushes()) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            observer.release();
+
+            ASSERT(0 == bslmt::ThreadUtil::join(triggering));
+            ASSERT(0 == bslmt::ThreadUtil::join(recording));
+
+            ASSERTV(X.numContendedRecordBufferPushes(),
+                    1 == X.numContendedRecordBufferPushes());
+            ASSERTV(X.numObserverPublishRetries(),
+                    0 == X.numObserverPublishRetries());
+        }
+      } break;
+      case 44: {
+        // --------------------------------------------------------------------
+        // TESTING 'getLogger' PER-THREAD CACHE
+        //
+        // Concerns:
+        //: 1 'getLogger' returns the default logger to a thread that has not
+        //:   installed a logger, and the logger installed by 'setLogger'
+        //:   otherwise.
+        //:
+        //: 2 Repeated calls to 'getLogger' consult the registry of per-thread
+        //:   loggers (as reported by 'numLoggerRegistryLookups') only once
+        //:   until the registry is changed.
+        //:
+        //: 3 'setLogger' and 'deallocateLogger', called by any thread, are
+        //:   reflected in the result of the next call to 'getLogger' by every
+        //:   thread.
+        //:
+        //: 4 A logger cached by a thread for a logger manager that has since
+        //:   been destroyed is not returned by a new logger manager.
+        //
+        // Plan:
+        //: 1 In the main thread, call 'getLogger' repeatedly, and verify the
+        //:   returned logger and the number of registry lookups.  Install and
+        //:   uninstall an allocated logger and repeat.  (C-1..2)
+        //:
+        //: 2 In several threads, some using the default logger and some
+        //:   installing loggers of their own, verify the result of
+        //:   'getLogger' after each change to the registry, including the
+        //:   deallocation of a logger installed by one thread.  (C-3)
+        //:
+        //: 3 Install a logger in the main thread, destroy the logger manager
+        //:   singleton, create a new one, and verify that 'getLogger' returns
+        //:   its default logger.  (C-4)
+        //
+        // Testing:
+        //   ball::Logger& getLogger();
+        //   void setLogger(ball::Logger *logger);
+        //   bsls::Types::Int64 numLoggerRegistryLookups() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'getLogger' PER-THREAD CACHE" << endl
+                          << "====================================" << endl;
+
+        using namespace BALL_LOGGERMANAGER_TEST_LOGGER_CACHE;
+
+        ball::TestObserver               testObserver(&cout);
+        ball::LoggerManagerConfiguration mLMC;
+
+        if (verbose) cout << "\tSingle thread." << endl;
+        {
+            ball::LoggerManagerScopedGuard lmg(&testObserver, mLMC);
+
+            Obj&       mX = Obj::singleton();
+            const Obj& X  = mX;
+
+            ASSERT(0 == X.numLoggerRegistryLookups());
+
+            Logger *defaultLogger = &mX.getLogger();
+            ASSERT(1 == X.numLoggerRegistryLookups());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, defaultLogger == &mX.getLogger());
+            }
+            ASSERT(1 == X.numLoggerRegistryLookups());
+
+            ball::FixedSizeRecordBuffer buf(k_BUFFER_SIZE);
+            Logger *logger = mX.allocateLogger(&buf);
+            ASSERT(1 == X.numLoggerRegistryLookups());
+
+            mX.setLogger(logger);
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, logger == &mX.getLogger());
+            }
+            ASSERT(2 == X.numLoggerRegistryLookups());
+
+            mX.setLogger(0);
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, defaultLogger == &mX.getLogger());
+            }
+            ASSERT(3 == X.numLoggerRegistryLookups());
+
+            mX.setLogger(logger);
+            ASSERT(logger == &mX.getLogger());
+            ASSERT(4 == X.numLoggerRegistryLookups());
+
+            mX.deallocateLogger(logger);
+            ASSERT(defaultLogger == &mX.getLogger());
+            ASSERT(5 == X.numLoggerRegistryLookups());
+        }
+
+        if (verbose) cout << "\tMultiple threads." << endl;
+        {
+            ball::LoggerManagerScopedGuard lmg(&testObserver, mLMC);
+
+            Obj& mX = Obj::singleton();
+
+            ball::FixedSizeRecordBuffer buf(k_BUFFER_SIZE);
+            sharedLogger = mX.allocateLogger(&buf);
+
+            numErrors = 0;
+            executeInParallel(k_NUM_THREADS, workerThreadLoggerCache);
+            ASSERTV(numErrors, 0 == numErrors);
+        }
+
+        if (verbose) cout << "\tNew logger manager." << endl;
+        {
+            ball::FixedSizeRecordBuffer buf(k_BUFFER_SIZE);
+            {
+                ball::LoggerManagerScopedGuard lmg(&testObserver, mLMC);
+
+                Obj& mX = Obj::singleton();
+                Logger *logger = mX.allocateLogger(&buf);
+                mX.setLogger(logger);
+                ASSERT(logger == &mX.getLogger());
+            }
+            {
+                ball::LoggerManagerScopedGuard lmg(&testObserver, mLMC);
+
+                Obj& mX = Obj::singleton();
+                ASSERT(0 == mX.numLoggerRegistryLookups());
+
+                Logger *defaultLogger = &mX.getLogger();
+                ASSERT(1 == mX.numLoggerRegistryLookups());
+
+                ball::FixedSizeRecordBuffer buf2(k_BUFFER_SIZE);
+                Logger *logger = mX.allocateLogger(&buf2);
+                mX.setLogger(logger);
+                ASSERT(logger == &mX.getLogger());
+                mX.setLogger(0);
+                ASSERT(defaultLogger == &mX.getLogger());
+            }
+        }
+      } break;
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       case 43: {
         // --------------------------------------------------------------------
@@ -6742,6 +7229,67 @@ int main(int argc, char *argv[])
         doPerformanceTest(mX, num_logs, verbose);
         if (verbose) cout << "-----------------------------\n\n" << endl;
 
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'getLogger' CONTENTION
+        //
+        // Concerns:
+        //: 1 'getLogger', called concurrently by several threads, does not
+        //:   contend on the registry of per-thread loggers.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, time a loop of calls to
+        //:   'getLogger' in each thread, and report the throughput and the
+        //:   number of registry lookups, together with the throughput of the
+        //:   equivalent loop of locked registry lookups that 'getLogger'
+        //:   performed on every call prior to the introduction of the
+        //:   per-thread cache.  The number of iterations per thread may be
+        //:   supplied as the second argument ('argv[2]').  (C-1)
+        //
+        // Testing:
+        //   CONCERN: 'getLogger' CONTENTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: 'getLogger' CONTENTION" << endl
+                          << "===============================" << endl;
+
+        using namespace BALL_LOGGERMANAGER_TEST_LOGGER_CACHE;
+
+        const int numIterations = verbose && atoi(argv[2]) > 0
+                                ? atoi(argv[2])
+                                : 1000000;
+
+        ball::LoggerManagerConfiguration mXC;
+        ball::LoggerManagerScopedGuard   lmGuard(mXC);
+
+        Obj& mX = Obj::singleton();
+
+        bsl::map<void *, Logger *> registry;
+        registry_p = &registry;
+
+        numErrors = 0;
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            const bsls::Types::Int64 lookups = mX.numLoggerRegistryLookups();
+
+            const double cached = runInParallel(numThreads,
+                                                workerThreadGetLogger,
+                                                numIterations);
+            const double locked = runInParallel(numThreads,
+                                                workerThreadRegistryLookup,
+                                                numIterations);
+
+            const double total = static_cast<double>(numThreads) *
+                                                                 numIterations;
+            cout << numThreads << " thread(s): "
+                 << "'getLogger' " << total / cached << " calls/sec ("
+                 << mX.numLoggerRegistryLookups() - lookups
+                 << " registry lookups), locked lookup "
+                 << total / locked << " calls/sec" << endl;
+        }
+        ASSERTV(numErrors, 0 == numErrors);
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -11,8 +11,17 @@
 ///--------------------
 // Using the insertion operator ('operator<<') with an 'ostream' introduces
 // significant performance overhead.  For this reason, the 'operator()' method
-// is implemented by writing the formatted string to a buffer before inserting
-// to a stream.
+// is implemented by writing the formatted string to a buffer (using 'format')
+// before inserting to a stream.
+//
+// The format specification is parsed (by 'parseFormat') whenever it is set
+// into a sequence of 'FieldOp' steps, so that formatting a record does not
+// re-interpret the specification.  Verbatim text, including interpolated
+// escape sequences and undefined conversion specifications, is collected in
+// 'd_literals', and consecutive runs of it are output by a single step.
+// Numeric fields are converted without 'snprintf', and the
+// 'DDMonYYYY_HH:MM:SS' part of the '%d' and '%D' conversions is cached per
+// second.
 
 #include <ball_recordstringformatter.h>
 
@@ -27,8 +36,7 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 
 #include <bdlb_print.h>
 
-#include <bdlma_bufferedsequentialallocator.h>
-
+#include <bdlt_date.h>
 #include <bdlt_datetime.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
@@ -36,86 +44,163 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bdlt_iso8601utilconfiguration.h>
 
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bslstl_stringref.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
-#include <bsl_cstring.h>   // for 'bsl::strcmp'
+#include <bsl_cstring.h>   // for 'bsl::memcpy', 'bsl::strcmp'
 #include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
 
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
+namespace BloombergLP {
 namespace {
 
 const char *const DEFAULT_FORMAT_SPEC = "\n%d %p:%t %s %f:%l %c %m %u\n";
 
-}  // close unnamed namespace
-
-namespace BloombergLP {
-
-// STATIC HELPER FUNCTIONS
-static void appendToString(bsl::string *result, int value)
-    // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
-{
-    char buffer[16];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+enum {
+    k_INITIAL_BUFFER_SIZE = 512  // size of the stack buffer used by
+                                 // 'operator()'
+};
+
+                            // ==================
+                            // class OutputBuffer
+                            // ==================
+
+class OutputBuffer {
+    // This class provides a mechanism to append characters to a buffer of
+    // fixed capacity.  Characters that do not fit in the buffer are discarded
+    // but counted, so that the length of the complete output is known.
+
+    // DATA
+    char        *d_buffer_p;  // buffer (held, not owned)
+    bsl::size_t  d_capacity;  // capacity of 'd_buffer_p'
+    bsl::size_t  d_length;    // number of characters appended
+
+  public:
+    // CREATORS
+    OutputBuffer(char *buffer, bsl::size_t capacity)
+        // Create an output buffer writing to the specified 'buffer' having the
+        // specified 'capacity'.
+    : d_buffer_p(buffer)
+    , d_capacity(capacity)
+    , d_length(0)
+    {
+    }
 
-    snprintf(buffer, sizeof buffer, "%d", value);
+    // MANIPULATORS
+    void append(char character)
+        // Append the specified 'character' to this buffer.
+    {
+        if (d_length < d_capacity) {
+            d_buffer_p[d_length] = character;
+        }
+        ++d_length;
+    }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    void append(const char *string, bsl::size_t length)
+        // Append the specified 'length' characters of the specified 'string'
+        // to this buffer.
+    {
+        if (d_length < d_capacity) {
+            const bsl::size_t available = d_capacity - d_length;
+            bsl::memcpy(d_buffer_p + d_length,
+                        string,
+                        length < available ? length : available);
+        }
+        d_length += length;
+    }
 
-    *result += buffer;
-}
+    void append(const bslstl::StringRef& string)
+        // Append the specified 'string' to this buffer.
+    {
+        append(string.data(), string.length());
+    }
 
-static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
-    // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
-{
-    char buffer[32];
+    void appendDecimal(bsls::Types::Uint64 value)
+        // Append the decimal representation of the specified 'value' to this
+        // buffer.
+    {
+        char  digits[20];
+        char *first = digits + sizeof digits;
+        do {
+            *--first = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value);
+        append(first, digits + sizeof digits - first);
+    }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    void appendDecimal(int value)
+        // Append the decimal representation of the specified 'value' to this
+        // buffer.
+    {
+        if (value < 0) {
+            append('-');
+            appendDecimal(static_cast<bsls::Types::Uint64>(
+                                 -static_cast<bsls::Types::Int64>(value)));
+        }
+        else {
+            appendDecimal(static_cast<bsls::Types::Uint64>(value));
+        }
+    }
 
-    snprintf(buffer, sizeof buffer, "%llu", value);
+    void appendHex(bsls::Types::Uint64 value)
+        // Append the upper-case hexadecimal representation of the specified
+        // 'value' to this buffer.
+    {
+        static const char k_HEX_DIGITS[] = "0123456789ABCDEF";
+
+        char  digits[16];
+        char *first = digits + sizeof digits;
+        do {
+            *--first = k_HEX_DIGITS[value & 0xf];
+            value >>= 4;
+        } while (value);
+        append(first, digits + sizeof digits - first);
+    }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    void appendPadded(int value, int numDigits)
+        // Append the decimal representation of the specified non-negative
+        // 'value', truncated or padded with leading zeros to the specified
+        // 'numDigits', to this buffer.
+    {
+        char digits[8];
+        for (int i = numDigits - 1; 0 <= i; --i) {
+            digits[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        append(digits, numDigits);
+    }
 
-    *result += buffer;
-}
+    // ACCESSORS
+    bsl::size_t length() const
+        // Return the number of characters appended to this buffer, including
+        // those that were discarded.
+    {
+        return d_length;
+    }
+};
 
-static void appendToStringAsHex(bsl::string *result, bsls::Types::Uint64 value)
-    // Convert the specified 'value' into hexadecimal and append it to the
-    // specified 'result'.
+inline
+void writePadded(char *result, int value, int numDigits)
+    // Write to the specified 'result' the decimal representation of the
+    // specified non-negative 'value', padded with leading zeros to the
+    // specified 'numDigits'.
 {
-    char buffer[32];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof(buffer), "%llX", value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    *result += buffer;
+    for (int i = numDigits - 1; 0 <= i; --i) {
+        result[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
 }
 
+}  // close unnamed namespace
+
 namespace ball {
 
                         // ---------------------------
@@ -130,18 +215,182 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 // appear in practice.  Real values are (always?) less than one day (plus or
 // minus).
 
+// PRIVATE MANIPULATORS
+void RecordStringFormatter::parseFormat()
+{
+    d_fieldOps.clear();
+    d_literals.clear();
+
+    const char *iter = d_formatSpec.data();
+    const char *end  = iter + d_formatSpec.length();
+
+    while (iter != end) {
+        char literal[2];
+        int  literalLength = 1;
+
+        switch (*iter) {
+          case '%': {
+            if (++iter == end) {
+                continue;
+            }
+            switch (*iter) {
+              case '%': {
+                literal[0] = '%';
+              } break;
+              case 'd':
+              case 'D':
+              case 'i':
+              case 'I':
+              case 'O':
+              case 'p':
+              case 't':
+              case 'T':
+              case 's':
+              case 'f':
+              case 'F':
+              case 'l':
+              case 'c':
+              case 'm':
+              case 'x':
+              case 'X':
+              case 'u': {
+                FieldOp op = { *iter, 0, 0 };
+                d_fieldOps.push_back(op);
+                literalLength = 0;
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                literal[0]    = '%';
+                literal[1]    = *iter;
+                literalLength = 2;
+              }
+            }
+            ++iter;
+          } break;
+          case '\\': {
+            if (++iter == end) {
+                continue;
+            }
+            switch (*iter) {
+              case 'n': {
+                literal[0] = '\n';
+              } break;
+              case 't': {
+                literal[0] = '\t';
+              } break;
+              case '\\': {
+                literal[0] = '\\';
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                literal[0]    = '\\';
+                literal[1]    = *iter;
+                literalLength = 2;
+              }
+            }
+            ++iter;
+          } break;
+          default: {
+            literal[0] = *iter;
+            ++iter;
+          }
+        }
+
+        if (0 == literalLength) {
+            continue;
+        }
+
+        // Extend the preceding step if it outputs verbatim text.
+
+        if (d_fieldOps.empty() || 0 != d_fieldOps.back().d_field) {
+            FieldOp op = { 0, static_cast<int>(d_literals.length()), 0 };
+            d_fieldOps.push_back(op);
+        }
+        d_fieldOps.back().d_length += literalLength;
+        d_literals.append(literal, literalLength);
+    }
+}
+
+// PRIVATE ACCESSORS
+void RecordStringFormatter::formatTimestamp(
+                                    char                  *result,
+                                    const bdlt::Datetime&  timestamp) const
+{
+    int hour, minute, second;
+    timestamp.getTime(&hour, &minute, &second);
+
+    const bsls::Types::Int64 key =
+                     (static_cast<bsls::Types::Int64>(timestamp.date() -
+                                                      bdlt::Date()) * 24 +
+                      hour) * 3600 + minute * 60 + second;
+
+    // The cache is only ever *tried*, so that concurrent callers never wait
+    // for one another.
+
+    if (0 == d_cacheLock.tryLock()) {
+        const bool isHit = key == d_cachedSecond;
+        if (isHit) {
+            bsl::memcpy(result, d_cachedTimestamp, k_CACHED_TIMESTAMP_LENGTH);
+        }
+        d_cacheLock.unlock();
+        if (isHit) {
+            return;                                                   // RETURN
+        }
+    }
+
+    static const char k_MONTHS[][4] = {
+        "",
+        "JAN", "FEB", "MAR", "APR",
+        "MAY", "JUN", "JUL", "AUG",
+        "SEP", "OCT", "NOV", "DEC"
+    };
+
+    int year, month, day;
+    timestamp.date().getYearMonthDay(&year, &month, &day);
+
+    // 'DDMonYYYY_HH:MM:SS'
+
+    writePadded(result, day, 2);
+    bsl::memcpy(result + 2, k_MONTHS[month], 3);
+    writePadded(result + 5, year, 4);
+    result[9] = '_';
+    writePadded(result + 10, hour, 2);
+    result[12] = ':';
+    writePadded(result + 13, minute, 2);
+    result[15] = ':';
+    writePadded(result + 16, second, 2);
+
+    if (0 == d_cacheLock.tryLock()) {
+        bsl::memcpy(d_cachedTimestamp, result, k_CACHED_TIMESTAMP_LENGTH);
+        d_cachedSecond = key;
+        d_cacheLock.unlock();
+    }
+}
+
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_fieldOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    parseFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_fieldOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    parseFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -149,7 +398,12 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_fieldOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    parseFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -163,7 +417,12 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_fieldOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    parseFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -172,7 +431,12 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_fieldOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    parseFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -187,7 +451,12 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_fieldOps(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    parseFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -195,6 +464,10 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_fieldOps(original.d_fieldOps, basicAllocator)
+, d_literals(original.d_literals, basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
 }
 
@@ -205,16 +478,46 @@ RecordStringFormatter& RecordStringFormatter::operator=(
     if (this != &rhs) {
         d_formatSpec      = rhs.d_formatSpec;
         d_timestampOffset = rhs.d_timestampOffset;
+        d_fieldOps        = rhs.d_fieldOps;
+        d_literals        = rhs.d_literals;
     }
 
     return *this;
 }
 
+void RecordStringFormatter::setFormat(const char *format)
+{
+    d_formatSpec = format;
+    parseFormat();
+}
+
 // ACCESSORS
 void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
+{
+    // Format the record to a buffer on the stack, and only if it does not fit
+    // format it again to a buffer of the required size.
+
+    char              fixedBuffer[k_INITIAL_BUFFER_SIZE];
+    const bsl::size_t length = format(fixedBuffer, sizeof fixedBuffer, record);
+
+    if (length <= sizeof fixedBuffer) {
+        stream.write(fixedBuffer, length);
+    }
+    else {
+        bsl::vector<char> buffer(length);
+        format(buffer.data(), length, record);
+        stream.write(buffer.data(), length);
+    }
+    stream.flush();
+}
 
+bsl::size_t RecordStringFormatter::format(char          *buffer,
+                                          bsl::size_t    length,
+                                          const Record&  record) const
 {
+    BSLS_ASSERT(buffer || 0 == length);
+
     const RecordAttributes& fixedFields = record.fixedFields();
     bdlt::DatetimeInterval  offset;
 
@@ -232,197 +535,143 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     bdlt::DatetimeTz timestamp(fixedFields.timestamp() + offset,
                                static_cast<int>(offset.totalMinutes()));
 
-    // Step through the format string, outputting the required elements.
-
-    const char* iter = d_formatSpec.data();
-    const char* end  = iter + d_formatSpec.length();
-
-    // Create a buffer on the stack for formatting the record.  Note that the
-    // size of the buffer should be slightly larger than the amount we reserve
-    // in order to ensure only a single allocation occurs.
+    OutputBuffer output(buffer, length);
 
-    const int BUFFER_SIZE        = 512;
-    const int STRING_RESERVATION = BUFFER_SIZE -
-                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+    // Execute the steps of the parsed format specification.
 
-    char fixedBuffer[BUFFER_SIZE];
-    bdlma::BufferedSequentialAllocator stringAllocator(fixedBuffer,
-                                                      BUFFER_SIZE);
-    bsl::string output(&stringAllocator);
-    output.reserve(STRING_RESERVATION);
+    typedef bsl::vector<FieldOp>::const_iterator Iterator;
 
-    while (iter != end) {
-        switch (*iter) {
-          case '%': {
-            if (++iter == end) {
-                break;
+    for (Iterator op = d_fieldOps.begin(); op != d_fieldOps.end(); ++op) {
+        switch (op->d_field) {
+          case 0: {
+            output.append(d_literals.data() + op->d_offset, op->d_length);
+          } break;
+          case 'd': BSLS_ANNOTATION_FALLTHROUGH;
+          case 'D': {
+            const bdlt::Datetime& localDatetime = timestamp.localDatetime();
+
+            char prefix[k_CACHED_TIMESTAMP_LENGTH];
+            formatTimestamp(prefix, localDatetime);
+            output.append(prefix, k_CACHED_TIMESTAMP_LENGTH);
+
+            output.append('.');
+            output.appendPadded(localDatetime.millisecond(), 3);
+            if ('D' == op->d_field) {
+                output.appendPadded(localDatetime.microsecond(), 3);
             }
-            switch (*iter) {
-              case '%': {
-                output += '%';
-              } break;
-              case 'd': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'D': {
-                const int fractionalSecondPrecision = 'd' == *iter ? 3 : 6;
-
-                char buffer[32];
-                timestamp.localDatetime().printToBuffer(
-                                                    buffer,
-                                                    sizeof buffer,
-                                                    fractionalSecondPrecision);
-
-                output += buffer;
-              } break;
-              case 'I': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'O': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'i': {
-                // Use ISO8601 "extended" format.
-
-                const int fractionalSecondPrecision = 'O' == *iter ? 6 : 3;
+          } break;
+          case 'I': BSLS_ANNOTATION_FALLTHROUGH;
+          case 'O': BSLS_ANNOTATION_FALLTHROUGH;
+          case 'i': {
+            // Use ISO8601 "extended" format.
 
-                bdlt::Iso8601UtilConfiguration config;
-                config.setFractionalSecondPrecision(fractionalSecondPrecision);
-                config.setUseZAbbreviationForUtc(true);
+            const int fractionalSecondPrecision = 'O' == op->d_field ? 6 : 3;
 
-                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+            bdlt::Iso8601UtilConfiguration config;
+            config.setFractionalSecondPrecision(fractionalSecondPrecision);
+            config.setUseZAbbreviationForUtc(true);
 
-                int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                                  timestamp,
-                                                                  config);
+            char isoBuffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
 
-                if ('i' == *iter) {
-                    // Remove milliseconds part.
+            int outputLength = bdlt::Iso8601Util::generateRaw(isoBuffer,
+                                                              timestamp,
+                                                              config);
 
-                    enum { k_DECIMAL_SIGN_OFFSET = 19,
-                           k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-                    bslstl::StringRef head(buffer, k_DECIMAL_SIGN_OFFSET);
+            if ('i' == op->d_field) {
+                // Remove milliseconds part.
 
-                    bslstl::StringRef tail(buffer + k_TZINFO_OFFSET,
-                                           outputLength - k_TZINFO_OFFSET);
+                enum { k_DECIMAL_SIGN_OFFSET = 19,
+                       k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
 
-                    output += head + tail;
-                }
-                else {
-                    output.append(buffer, outputLength);
-                }
-              } break;
-              case 'p': {
-                appendToString(&output, fixedFields.processID());
-              } break;
-              case 't': {
-                appendToString(&output, fixedFields.threadID());
-              } break;
-              case 'T': {
-                appendToStringAsHex(&output, fixedFields.threadID());
-              } break;
-              case 's': {
-                output += Severity::toAscii(
-                                 (Severity::Level)fixedFields.severity());
-              } break;
-              case 'f': {
-                output += fixedFields.fileName();
-              } break;
-              case 'F': {
-                const bsl::string& filename = fixedFields.fileName();
-                bsl::string::size_type rightmostSlashIndex =
+                output.append(isoBuffer, k_DECIMAL_SIGN_OFFSET);
+                output.append(isoBuffer + k_TZINFO_OFFSET,
+                              outputLength - k_TZINFO_OFFSET);
+            }
+            else {
+                output.append(isoBuffer, outputLength);
+            }
+          } break;
+          case 'p': {
+            output.appendDecimal(fixedFields.processID());
+          } break;
+          case 't': {
+            output.appendDecimal(fixedFields.threadID());
+          } break;
+          case 'T': {
+            output.appendHex(fixedFields.threadID());
+          } break;
+          case 's': {
+            const char *severity = Severity::toAscii(
+                                     (Severity::Level)fixedFields.severity());
+            output.append(severity, bsl::strlen(severity));
+          } break;
+          case 'f': {
+            output.append(fixedFields.fileName());
+          } break;
+          case 'F': {
+            const bsl::string& filename = fixedFields.fileName();
+            bsl::string::size_type rightmostSlashIndex =
 #ifdef BSLS_PLATFORM_OS_WINDOWS
-                    filename.rfind('\\');
+                filename.rfind('\\');
 #else
-                    filename.rfind('/');
+                filename.rfind('/');
 #endif
-                if (bsl::string::npos == rightmostSlashIndex) {
-                    output += filename;
-                }
-                else {
-                    output += filename.substr(rightmostSlashIndex + 1);
-                }
-              } break;
-              case 'l': {
-                appendToString(&output, fixedFields.lineNumber());
-              } break;
-              case 'c': {
-                output += fixedFields.category();
-              } break;
-              case 'm': {
-                bslstl::StringRef message = fixedFields.messageRef();
-                output.append(message.data(), message.length());
-              } break;
-              case 'x': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
+            if (bsl::string::npos == rightmostSlashIndex) {
+                output.append(filename);
+            }
+            else {
+                output.append(filename.data() + rightmostSlashIndex + 1,
+                              filename.length() - rightmostSlashIndex - 1);
+            }
+          } break;
+          case 'l': {
+            output.appendDecimal(fixedFields.lineNumber());
+          } break;
+          case 'c': {
+            output.append(fixedFields.category());
+          } break;
+          case 'm': {
+            output.append(fixedFields.messageRef());
+          } break;
+          case 'x': {
+            bsl::stringstream ss;
+            int messageLength = static_cast<int>(
                                       fixedFields.messageStreamBuf().length());
-                bdlb::Print::printString(ss,
-                                        fixedFields.message(),
-                                        length,
-                                        false);
-                output += ss.str();
-              } break;
-              case 'X': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
+            bdlb::Print::printString(ss,
+                                    fixedFields.message(),
+                                    messageLength,
+                                    false);
+            output.append(ss.str());
+          } break;
+          case 'X': {
+            bsl::stringstream ss;
+            int messageLength = static_cast<int>(
                                       fixedFields.messageStreamBuf().length());
-                bdlb::Print::singleLineHexDump(ss,
-                                              fixedFields.message(),
-                                              length);
-                output += ss.str();
-              } break;
-              case 'u': {
-                typedef ball::UserFields Values;
-                const Values& customFields = record.customFields();
-                const int numCustomFields  = customFields.length();
-
-                if (numCustomFields > 0) {
-                    bsl::stringstream ss;
-                    Values::ConstIterator it = customFields.begin();
-                    ss << *it;
-                    ++it;
-                    for (; it != customFields.end(); ++it) {
-                        ss << " " << *it;
-                    }
-                    output += ss.str();
-                }
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
-
-                output += '%';
-                output += *iter;
-              }
-            }
-            ++iter;
+            bdlb::Print::singleLineHexDump(ss,
+                                          fixedFields.message(),
+                                          messageLength);
+            output.append(ss.str());
           } break;
-          case '\\': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case 'n': {
-                output += '\n';
-              } break;
-              case 't': {
-                output += '\t';
-              } break;
-              case '\\': {
-                output += '\\';
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+          case 'u': {
+            typedef ball::UserFields Values;
+            const Values& customFields = record.customFields();
+            const int numCustomFields  = customFields.length();
 
-                output += '\\';
-                output += *iter;
-              }
+            if (numCustomFields > 0) {
+                bsl::stringstream ss;
+                Values::ConstIterator it = customFields.begin();
+                ss << *it;
+                ++it;
+                for (; it != customFields.end(); ++it) {
+                    ss << " " << *it;
+                }
+                output.append(ss.str());
             }
-            ++iter;
           } break;
-          default: {
-            output += *iter;
-            ++iter;
-          }
         }
     }
 
-    stream.write(output.c_str(), output.size());
-    stream.flush();
+    return output.length();
 }
 
 }  // close package namespace
@@ -40,6 +40,10 @@ BSLS_IDENT("$Id: $")
 // facilitates the logging of records in local time, if desired, in the event
 // that the timestamp attribute of records are in UTC.
 //
+// An overloaded 'format' accessor formats a record in the same way, but writes
+// the result to a caller-supplied buffer instead of a stream (see
+// {Formatting Into a Buffer}).
+//
 ///Record Format Specification
 ///---------------------------
 // The following table lists the 'printf'-style ('%'-prefixed) conversion
@@ -93,6 +97,26 @@ BSLS_IDENT("$Id: $")
 // 27AUG2007_16:09:46.161 2040:1 WARN subdir/process.cpp:542 FOO.BAR.BAZ <text>
 //..
 //
+///Formatting Into a Buffer
+///------------------------
+// The format specification is parsed once, when it is supplied (at
+// construction or by 'setFormat'), into a sequence of steps each of which
+// either outputs verbatim text or outputs one attribute of the record; the
+// formatting of a record merely executes those steps.  The
+// 'format(char *, bsl::size_t, const Record&)' accessor writes the result to
+// a buffer supplied by the caller and, in the manner of 'snprintf', returns
+// the length of the complete formatted record, which exceeds the length of
+// the buffer if the output was truncated; no null terminator is written.
+// Clients that format records at a high rate (e.g., observers writing
+// records to a file) may use this accessor to avoid the overhead of an
+// 'bsl::ostream'.
+//
+// In addition, the date and time (to the second) most recently rendered for
+// a '%d' or '%D' conversion specification is cached by the record formatter,
+// so that records logged within the same second reuse it.  The cache is not
+// part of the value of the record formatter, and concurrent calls to the
+// accessors of a record formatter remain safe.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use an instance of
@@ -126,9 +150,18 @@ BSLS_IDENT("$Id: $")
 //..
 //  6: Hello, World!
 //..
+// Finally, we format the same record to a buffer instead, and obtain the
+// length of the formatted record:
+//..
+//  char              buffer[64];
+//  const bsl::size_t length = formatter.format(buffer, sizeof buffer, record);
+//
+//  assert("\n6: Hello, World!\n" == bsl::string(buffer, length));
+//..
 
 #include <balscm_version.h>
 
+#include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
 #include <bslma_allocator.h>
@@ -136,8 +169,13 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -160,6 +198,24 @@ class RecordStringFormatter {
     // to a given stream.  The timestamp offset of the record formatter is
     // added to each timestamp that is output to the stream.
 
+    // PRIVATE TYPES
+    struct FieldOp {
+        // This 'struct' describes one step of a parsed format specification:
+        // either the output of a range of 'd_literals', or the output of one
+        // attribute of a record.
+
+        char d_field;   // conversion character (e.g., 'd', 'm'), or 0 to
+                        // output a range of 'd_literals'
+
+        int  d_offset;  // offset of the range in 'd_literals'
+
+        int  d_length;  // length of the range
+    };
+
+    enum {
+        k_CACHED_TIMESTAMP_LENGTH = 18  // length of 'DDMonYYYY_HH:MM:SS'
+    };
+
     // CLASS DATA
     static const int k_DISABLE_PUBLISH_IN_LOCALTIME;
                                               // Reserved offset (a value
@@ -181,6 +237,36 @@ class RecordStringFormatter {
     bsl::string            d_formatSpec;       // 'printf'-style format spec.
     bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
 
+    bsl::vector<FieldOp>   d_fieldOps;         // parsed 'd_formatSpec'
+
+    bsl::string            d_literals;         // verbatim text (with escape
+                                               // sequences interpolated) of
+                                               // 'd_formatSpec'
+
+    mutable bsls::SpinLock d_cacheLock;        // guards the cached timestamp
+
+    mutable bsls::Types::Int64
+                           d_cachedSecond;     // seconds since 0001/01/01 of
+                                               // 'd_cachedTimestamp', or -1
+
+    mutable char           d_cachedTimestamp[k_CACHED_TIMESTAMP_LENGTH];
+                                               // 'd_cachedSecond' rendered in
+                                               // 'DDMonYYYY_HH:MM:SS' format
+
+    // PRIVATE MANIPULATORS
+    void parseFormat();
+        // Load into 'd_fieldOps' and 'd_literals' the sequence of steps that
+        // output a record according to 'd_formatSpec'.
+
+    // PRIVATE ACCESSORS
+    void formatTimestamp(char                  *result,
+                         const bdlt::Datetime&  timestamp) const;
+        // Load into the specified 'result' the specified 'timestamp',
+        // truncated to the second, in 'DDMonYYYY_HH:MM:SS' format (without a
+        // null terminator), using the cached rendering if it applies.  The
+        // behavior is undefined unless 'result' refers to a buffer of at least
+        // 'k_CACHED_TIMESTAMP_LENGTH' characters.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecordStringFormatter,
@@ -284,7 +370,7 @@ class RecordStringFormatter {
 
     void setFormat(const char *format);
         // Set the format specification of this record formatter to the
-        // specified 'format'.
+        // specified 'format', and parse it for subsequent formatting.
 
     void setTimestampOffset(const bdlt::DatetimeInterval& offset);
         // Set the timestamp offset of this record formatter to the specified
@@ -299,6 +385,19 @@ class RecordStringFormatter {
         // 'stream'.  The timestamp offset of this record formatter is added to
         // each timestamp that is output to 'stream'.
 
+    bsl::size_t format(char          *buffer,
+                       bsl::size_t    length,
+                       const Record&  record) const;
+        // Format the specified 'record' according to the format specification
+        // of this record formatter, write at most the specified 'length'
+        // leading characters of the result to the specified 'buffer', and
+        // return the length of the complete result.  The timestamp offset of
+        // this record formatter is added to each timestamp that is output.
+        // The behavior is undefined unless 'buffer' refers to at least
+        // 'length' characters, or 0 == length.  Note that the result is
+        // identical to that output by 'operator()' and is truncated if the
+        // returned value exceeds 'length'; no null terminator is written.
+
     const char *format() const;
         // Return the format specification of this record formatter.
 
@@ -355,12 +454,6 @@ void RecordStringFormatter::enablePublishInLocalTime()
     d_timestampOffset.setTotalMilliseconds(k_ENABLE_PUBLISH_IN_LOCALTIME);
 }
 
-inline
-void RecordStringFormatter::setFormat(const char *format)
-{
-    d_formatSpec = format;
-}
-
 inline
 void RecordStringFormatter::setTimestampOffset(
                                           const bdlt::DatetimeInterval& offset)
@@ -21,6 +21,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_iostream.h>
@@ -29,6 +30,8 @@
 #include <bsl_string.h>
 #include <bsl_sstream.h>
 
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>                  // for 'strcmp'
 
@@ -82,6 +85,7 @@ using bsl::uppercase;
 // [13] bool isPublishInLocalTimeEnabled() const;
 // [ 2] const bdlt::DatetimeInterval& timestampOffset() const;
 // [11] void operator()(bsl::ostream&, const ball::Record&) const;
+// [14] bsl::size_t format(char *, size_t, const ball::Record&) const;
 // FREE OPERATORS
 // [ 6] bool operator==(const ball::RSF& lhs, const ball::RSF& rhs);
 // [ 6] bool operator!=(const ball::RSF& lhs, const ball::RSF& rhs);
@@ -89,6 +93,7 @@ using bsl::uppercase;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [-1] PERFORMANCE: 'operator()' AND 'format'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -263,6 +268,224 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'format'
+        //
+        // Concerns:
+        //: 1 'format' writes the same characters as 'operator()' for every
+        //:   conversion specification and escape sequence, and for undefined
+        //:   and incomplete ones.
+        //:
+        //: 2 'format' returns the length of the complete output, writes no
+        //:   more than the supplied number of characters, and writes exactly
+        //:   the leading characters of the complete output.
+        //:
+        //: 3 The parsed format specification follows 'setFormat', copy
+        //:   construction, and assignment.
+        //:
+        //: 4 Numeric fields are rendered correctly over their entire range.
+        //:
+        //: 5 The cached date and time is not reused for a timestamp in a
+        //:   different second.
+        //
+        // Plan:
+        //: 1 Using a table of format specifications and their expected
+        //:   output for a fixed record, verify the result of 'format' for
+        //:   buffers of every length up to and beyond that of the expected
+        //:   output, using a sentinel to detect overruns, and verify that
+        //:   'operator()' yields the same output.  Repeat for objects
+        //:   obtained by 'setFormat', copy construction, and assignment.
+        //:   (C-1..3)
+        //:
+        //: 2 Format extreme values of the numeric fields and compare against
+        //:   'snprintf'.  (C-4)
+        //:
+        //: 3 Format a sequence of timestamps that share, or do not share, the
+        //:   date, the time of day, or the second, and compare the '%d' and
+        //:   '%D' output against 'bdlt::Datetime::printToBuffer'.  Note that
+        //:   the default value, 24:00:00, is rendered as 00:00:00 since the
+        //:   timestamp offset is added to it.  (C-5)
+        //
+        // Testing:
+        //   bsl::size_t format(char *, size_t, const ball::Record&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'format'" << endl
+                          << "================" << endl;
+
+        ball::RecordAttributes fixedFields(
+                                   bdlt::Datetime(2007, 8, 27, 16, 9, 46,
+                                                  161, 324),
+                                   2040,
+                                   31,
+                                   "subdir/process.cpp",
+                                   542,
+                                   "FOO.BAR.BAZ",
+                                   ball::Severity::e_WARN,
+                                   "Hello, World!");
+        ball::Record mR(fixedFields, ball::UserFields());
+        const ball::Record& R = mR;
+
+        if (verbose) cout << "\nTesting format specifications." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_spec;      // format specification
+                const char *d_expected;  // expected output
+            } DATA[] = {
+                //LINE  SPEC                 EXPECTED
+                //----  -------------------  ------------------------------
+                { L_,   "",                  ""                             },
+                { L_,   "abc",               "abc"                          },
+                { L_,   "%",                 ""                             },
+                { L_,   "\\",                ""                             },
+                { L_,   "a%",                "a"                            },
+                { L_,   "a\\",               "a"                            },
+                { L_,   "%%",                "%"                            },
+                { L_,   "%z",                "%z"                           },
+                { L_,   "\\z",               "\\z"                          },
+                { L_,   "\\n\\t\\\\",        "\n\t\\"                       },
+                { L_,   "%d",                "27AUG2007_16:09:46.161"       },
+                { L_,   "%D",                "27AUG2007_16:09:46.161324"    },
+                { L_,   "%i",                "2007-08-27T16:09:46Z"         },
+                { L_,   "%I",                "2007-08-27T16:09:46.161Z"     },
+                { L_,   "%O",                "2007-08-27T16:09:46.161324Z"  },
+                { L_,   "%p:%t:%T",          "2040:31:1F"                   },
+                { L_,   "%s",                "WARN"                         },
+                { L_,   "%f:%l",             "subdir/process.cpp:542"       },
+                { L_,   "%F",                "process.cpp"                  },
+                { L_,   "%c",                "FOO.BAR.BAZ"                  },
+                { L_,   "%m",                "Hello, World!"                },
+                { L_,   "%X",                "48656C6C6F2C20576F726C6421"   },
+                { L_,   "%u",                ""                             },
+                { L_,   "<%m%%%z\\t%c>",     "<Hello, World!%%z\tFOO.BAR.BAZ>"
+                                                                            },
+                { L_,   "\n%d %p:%t %s %f:%l %c %m %u\n",
+                        "\n27AUG2007_16:09:46.161 2040:31 WARN "
+                        "subdir/process.cpp:542 FOO.BAR.BAZ Hello, World! \n"
+                                                                            },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            const char SENTINEL = '\xa5';
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE = DATA[ti].d_line;
+                const char        *SPEC = DATA[ti].d_spec;
+                const bsl::string  EXP(DATA[ti].d_expected);
+
+                Obj mX(SPEC);  const Obj& X = mX;
+
+                Obj mY("%m %d");  const Obj& Y = mY;
+                mY.setFormat(SPEC);
+
+                const Obj Z(X);
+
+                Obj mW;  const Obj& W = mW;
+                mW = X;
+
+                const Obj *OBJECTS[] = { &X, &Y, &Z, &W };
+
+                for (int oi = 0; oi < 4; ++oi) {
+                    const Obj& OBJ = *OBJECTS[oi];
+
+                    for (bsl::size_t len = 0; len <= EXP.length() + 2; ++len) {
+                        char buffer[128];
+                        bsl::memset(buffer, SENTINEL, sizeof buffer);
+
+                        const bsl::size_t rc = OBJ.format(buffer, len, R);
+                        ASSERTV(LINE, oi, len, rc, EXP.length() == rc);
+
+                        const bsl::size_t numWritten =
+                                             len < EXP.length() ? len : rc;
+                        ASSERTV(LINE, oi, len, EXP.substr(0, numWritten) ==
+                                        bsl::string(buffer, numWritten));
+                        for (bsl::size_t i = numWritten;
+                                                    i < sizeof buffer; ++i) {
+                            ASSERTV(LINE, oi, len, i, SENTINEL == buffer[i]);
+                        }
+                    }
+
+                    ASSERTV(LINE, oi, EXP.length() == OBJ.format(0, 0, R));
+
+                    ostringstream oss;
+                    OBJ(oss, R);
+                    ASSERTV(LINE, oi, oss.str(), EXP == oss.str());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting numeric fields." << endl;
+        {
+            const bsls::Types::Uint64 THREAD_IDS[] = {
+                0, 1, 9, 10, 0x123456789ABCDEFULL, 0xFFFFFFFFFFFFFFFFULL
+            };
+            const int INTS[] = { 0, 1, -1, 10, INT_MAX, INT_MIN };
+
+            Obj mX("%t %T");  const Obj& X = mX;
+            for (int i = 0; i < 6; ++i) {
+                mR.fixedFields().setThreadID(THREAD_IDS[i]);
+
+                char exp[64];
+                bsl::sprintf(exp, "%llu %llX", THREAD_IDS[i], THREAD_IDS[i]);
+
+                char buffer[64];
+                const bsl::size_t rc = X.format(buffer, sizeof buffer, R);
+                ASSERTV(i, exp, bsl::string(exp) == bsl::string(buffer, rc));
+            }
+
+            mX.setFormat("%p %l");
+            for (int i = 0; i < 6; ++i) {
+                mR.fixedFields().setProcessID(INTS[i]);
+                mR.fixedFields().setLineNumber(INTS[5 - i]);
+
+                char exp[64];
+                bsl::sprintf(exp, "%d %d", INTS[i], INTS[5 - i]);
+
+                char buffer[64];
+                const bsl::size_t rc = X.format(buffer, sizeof buffer, R);
+                ASSERTV(i, exp, bsl::string(exp) == bsl::string(buffer, rc));
+            }
+        }
+
+        if (verbose) cout << "\nTesting the cached timestamp." << endl;
+        {
+            const bdlt::Datetime TIMESTAMPS[] = {
+                bdlt::Datetime(2007, 8, 27, 16,  9, 46, 161, 324),
+                bdlt::Datetime(2007, 8, 27, 16,  9, 46, 999, 999),
+                bdlt::Datetime(2007, 8, 27, 16,  9, 47,   0,   0),
+                bdlt::Datetime(2007, 8, 28, 16,  9, 47,   0,   1),
+                bdlt::Datetime(2007, 8, 28, 16,  9, 46,   0,   0),
+                bdlt::Datetime(2007, 8, 28, 16, 10, 46,   0,   0),
+                bdlt::Datetime(1,    1,  1,  0,  0,  0,   0,   0),
+                bdlt::Datetime(),
+                bdlt::Datetime(1,    1,  1,  0,  0,  0,   0,   0),
+                bdlt::Datetime(9999, 12, 31, 23, 59, 59, 999, 999),
+                bdlt::Datetime(2007, 8, 27, 16,  9, 46, 161, 324),
+            };
+            const int NUM_TIMESTAMPS = static_cast<int>(
+                                     sizeof TIMESTAMPS / sizeof *TIMESTAMPS);
+
+            Obj mX("%d|%D");  const Obj& X = mX;
+            for (int i = 0; i < NUM_TIMESTAMPS; ++i) {
+                mR.fixedFields().setTimestamp(TIMESTAMPS[i]);
+
+                const bdlt::Datetime TIMESTAMP = TIMESTAMPS[i] +
+                                                   bdlt::DatetimeInterval(0);
+
+                char exp[64];
+                int  expLength = TIMESTAMP.printToBuffer(exp, 32, 3);
+                exp[expLength++] = '|';
+                TIMESTAMP.printToBuffer(exp + expLength, 32, 6);
+
+                char buffer[64];
+                const bsl::size_t rc = X.format(buffer, sizeof buffer, R);
+                ASSERTV(i, exp, bsl::string(exp) == bsl::string(buffer, rc));
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING: Records Show Calculated Local-Time Offset
@@ -504,6 +727,15 @@ int main(int argc, char *argv[])
         ostringstream oss;
         formatter(oss, record);
         if (veryVerbose) cout << oss.str();
+//..
+// Finally, we format the same record to a buffer instead, and obtain the
+// length of the formatted record:
+//..
+    char              buffer[64];
+    const bsl::size_t length = formatter.format(buffer, sizeof buffer, record);
+//
+    ASSERT("\n6: Hello, World!\n" == bsl::string(buffer, length));
+//..
 
       } break;
       case 11: {
@@ -1771,6 +2003,81 @@ int main(int argc, char *argv[])
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'operator()' AND 'format'
+        //
+        // Concerns:
+        //: 1 Formatting a record with the default format specification
+        //:   performs well both to a stream and to a buffer.
+        //
+        // Plan:
+        //: 1 Format a typical record, whose timestamp advances by 1ms on each
+        //:   iteration, a number of times (optionally supplied as the second
+        //:   argument, 'argv[2]'), using 'operator()' to an 'ostringstream'
+        //:   and using 'format' to a buffer, and report the number of records
+        //:   formatted per second.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'operator()' AND 'format'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: 'operator()' AND 'format'" << endl
+                          << "======================================" << endl;
+
+        const int numIterations = verbose && bsl::atoi(argv[2]) > 0
+                                ? bsl::atoi(argv[2])
+                                : 1000000;
+
+        ball::RecordAttributes fixedFields(bdlt::CurrentTime::utc(),
+                                           2040,
+                                           bslmt::ThreadUtil::selfIdAsUint64(),
+                                           "subdir/process.cpp",
+                                           542,
+                                           "FOO.BAR.BAZ",
+                                           ball::Severity::e_WARN,
+                                           MSG_200BYTE);
+        ball::Record mR(fixedFields, ball::UserFields());
+        const ball::Record& R = mR;
+
+        const bdlt::Datetime start = R.fixedFields().timestamp();
+
+        const Obj X;
+
+        bsls::Stopwatch timer;
+
+        ostringstream oss;
+        timer.start();
+        for (int i = 0; i < numIterations; ++i) {
+            bdlt::Datetime timestamp(start);
+            timestamp.addMilliseconds(i);
+            mR.fixedFields().setTimestamp(timestamp);
+
+            oss.str("");
+            X(oss, R);
+        }
+        timer.stop();
+        cout << "'operator()': "
+             << numIterations / timer.elapsedTime() << " records/sec" << endl;
+
+        char        buffer[512];
+        bsl::size_t total = 0;
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < numIterations; ++i) {
+            bdlt::Datetime timestamp(start);
+            timestamp.addMilliseconds(i);
+            mR.fixedFields().setTimestamp(timestamp);
+
+            total += X.format(buffer, sizeof buffer, R);
+        }
+        timer.stop();
+        cout << "'format':     "
+             << numIterations / timer.elapsedTime() << " records/sec" << endl;
+
+        ASSERT(0 < total);
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -18,6 +18,98 @@ namespace BloombergLP {
                               // class Collector
                               // ---------------
 
+namespace balm {
+
+// PRIVATE ACCESSORS
+void Collector::lockAllShards() const
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].d_lock.lock();
+    }
+}
+
+void Collector::unlockAllShards() const
+{
+    for (int i = k_NUM_SHARDS - 1; i >= 0; --i) {
+        d_shards[i].d_lock.unlock();
+    }
+}
+
+void Collector::mergeShards(MetricRecord *record) const
+{
+    record->metricId() = d_metricId;
+    record->count()    = 0;
+    record->total()    = 0.0;
+    record->min()      = MetricRecord::k_DEFAULT_MIN;
+    record->max()      = MetricRecord::k_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        const ShardData& data = d_shards[i].d_data;
+
+        record->count() += data.d_count;
+        record->total() += data.d_total;
+        record->min()   =  bsl::min(record->min(), data.d_min);
+        record->max()   =  bsl::max(record->max(), data.d_max);
+    }
+}
+
+// CREATORS
+Collector::Collector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_shards()
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        resetShardData(&d_shards[i].d_data);
+    }
+}
+
+// MANIPULATORS
+void Collector::reset()
+{
+    lockAllShards();
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        resetShardData(&d_shards[i].d_data);
+    }
+    unlockAllShards();
+}
+
+void Collector::loadAndReset(MetricRecord *record)
+{
+    lockAllShards();
+    mergeShards(record);
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        resetShardData(&d_shards[i].d_data);
+    }
+    unlockAllShards();
+}
+
+void Collector::setCountTotalMinMax(int    count,
+                                    double total,
+                                    double min,
+                                    double max)
+{
+    lockAllShards();
+    for (int i = 1; i < k_NUM_SHARDS; ++i) {
+        resetShardData(&d_shards[i].d_data);
+    }
+
+    ShardData& data = d_shards[0].d_data;
+    data.d_count = count;
+    data.d_total = total;
+    data.d_min   = min;
+    data.d_max   = max;
+    unlockAllShards();
+}
+
+// ACCESSORS
+void Collector::load(MetricRecord *record) const
+{
+    lockAllShards();
+    mergeShards(record);
+    unlockAllShards();
+}
+
+}  // close package namespace
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
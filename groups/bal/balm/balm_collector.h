@@ -45,6 +45,24 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // operations on a given instance can be safely invoked simultaneously from
 // multiple threads.
 //
+///Performance
+///-----------
+// A frequently updated metric may be updated by many threads at once.  So
+// that concurrent updates do not contend for a single lock, a
+// 'balm::Collector' aggregates values in a fixed number of shards, each
+// aligned to, and padded to fill, its own cache line, and protected by its own
+// spin lock.  'update' and 'accumulateCountTotalMinMax' aggregate into the
+// shard selected by the identifier of the calling thread, and so rarely
+// contend with another thread.  The operations that read or set the
+// aggregated values ('load', 'loadAndReset', 'reset', and
+// 'setCountTotalMinMax') acquire the lock of every shard, merging the shards
+// as they do so; they remain atomic with respect to updates, but are more
+// expensive than an update.  Note that these operations are typically
+// performed only once per publication interval.  Also note that the alignment
+// of a collector allocated from a 'bslma::Allocator' is limited to that
+// provided by the allocator, in which case the shards still occupy distinct
+// cache-line-sized slots, but adjacent shards may share a cache line.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::Collector', modifies its values, then
@@ -85,8 +103,15 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 #include <balm_metricrecord.h>
 #include <balm_metricid.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bslmf_assert.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_compilerfeatures.h>
+
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 
@@ -102,21 +127,93 @@ namespace balm {
 class Collector {
     // This class provides a mechanism for collecting and aggregating the
     // value of a metric over a period of time.  The collector contains a
-    // 'MetricRecord' object that holds the identity of the metric being
-    // collected, the number of times an event occurred, and the total,
-    // minimum, and maximum aggregates of the associated measurement value.
-    // The default value for the count is 0, the default value for the total
-    // is 0.0, the default minimum value is 'MetricRecord::k_DEFAULT_MIN', and
-    // the default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
+    // 'MetricId' object identifying the metric being collected, the number
+    // of times an event occurred, and the total, minimum, and maximum
+    // aggregates of the associated measurement value, which are held in
+    // per-thread shards (see {Performance}).  The default value for the count
+    // is 0, the default value for the total is 0.0, the default minimum value
+    // is 'MetricRecord::k_DEFAULT_MIN', and the default maximum value is
+    // 'MetricRecord::k_DEFAULT_MAX'.
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_SHARD_BITS = 4,                     // log2 of 'k_NUM_SHARDS'
+        k_NUM_SHARDS     = 1 << k_NUM_SHARD_BITS  // number of shards
+    };
+
+    // PRIVATE TYPES
+    struct ShardData {
+        // This 'struct' holds the aggregates of a shard.
+
+        int    d_count;  // aggregated count of events
+        double d_total;  // total of values across events
+        double d_min;    // minimum value across events
+        double d_max;    // maximum value across events
+    };
+
+    struct ShardLayout {
+        // This 'struct' has the layout of the data of a 'Shard', and is used
+        // only to compute the padding of 'Shard'.
+
+        bsls::SpinLock d_lock;
+        ShardData      d_data;
+    };
+
+    enum {
+        k_SHARD_PAD_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE
+                         - sizeof(ShardLayout)
+                                          % bslmt::Platform::e_CACHE_LINE_SIZE
+    };
+
+    struct Shard {
+        // This 'struct' holds the aggregates of a shard, and the lock
+        // protecting them, aligned and padded to occupy whole cache lines.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_ALIGNAS)
+        alignas(bslmt::Platform::e_CACHE_LINE_SIZE)
+#endif
+        bsls::SpinLock d_lock;                    // synchronizes access to
+                                                  // 'd_data'
+
+        ShardData      d_data;                    // aggregates
+
+        char           d_pad[k_SHARD_PAD_SIZE];   // padding to prevent the
+                                                  // data of different shards
+                                                  // from sharing a cache line
+    };
+
+    BSLMF_ASSERT(0 == sizeof(Shard) % bslmt::Platform::e_CACHE_LINE_SIZE);
 
     // DATA
-    MetricRecord         d_record;  // the recorded metric information
-    mutable bslmt::Mutex d_lock;    // record synchronization mechanism
+    MetricId      d_metricId;              // metric identifier
+    mutable Shard d_shards[k_NUM_SHARDS];  // per-thread aggregates
 
     // NOT IMPLEMENTED
     Collector(const Collector&);
     Collector& operator=(const Collector&);
 
+    // PRIVATE CLASS METHODS
+    static int shardIndex();
+        // Return the index of the shard into which the calling thread
+        // aggregates values.
+
+    static void resetShardData(ShardData *data);
+        // Reset the specified 'data' to its default state.
+
+    // PRIVATE ACCESSORS
+    void lockAllShards() const;
+        // Acquire the lock of every shard of this collector, in order.
+
+    void unlockAllShards() const;
+        // Release the lock of every shard of this collector.  The behavior is
+        // undefined unless the calling thread holds the lock of every shard.
+
+    void mergeShards(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, and the aggregates of all the shards of this collector.
+        // The behavior is undefined unless the calling thread holds the lock
+        // of every shard.
+
   public:
      // CREATORS
     Collector(const MetricId& metricId);
@@ -187,49 +284,44 @@ class Collector {
                               // class Collector
                               // ---------------
 
-// CREATORS
+// PRIVATE CLASS METHODS
 inline
-Collector::Collector(const MetricId& metricId)
-: d_record(metricId)
-, d_lock()
+int Collector::shardIndex()
 {
-}
+    // Thread identifiers are typically addresses sharing their low-order
+    // bits, so select the high-order bits of their Fibonacci hash.
 
-inline
-Collector::~Collector()
-{
+    return static_cast<int>(
+              (bslmt::ThreadUtil::selfIdAsUint64() * 0x9E3779B97F4A7C15ULL)
+                                                  >> (64 - k_NUM_SHARD_BITS));
 }
 
-// MANIPULATORS
 inline
-void Collector::reset()
+void Collector::resetShardData(ShardData *data)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
+    data->d_count = 0;
+    data->d_total = 0.0;
+    data->d_min   = MetricRecord::k_DEFAULT_MIN;
+    data->d_max   = MetricRecord::k_DEFAULT_MAX;
 }
 
+// CREATORS
 inline
-void Collector::loadAndReset(MetricRecord *record)
+Collector::~Collector()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record          = d_record;
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
 }
 
+// MANIPULATORS
 inline
 void Collector::update(double value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    ++d_record.count();
-    d_record.total() += value;
-    d_record.min()   =  bsl::min(d_record.min(), value);
-    d_record.max()   =  bsl::max(d_record.max(), value);
+    Shard& shard = d_shards[shardIndex()];
+
+    bsls::SpinLockGuard guard(&shard.d_lock);
+    ++shard.d_data.d_count;
+    shard.d_data.d_total += value;
+    shard.d_data.d_min   =  bsl::min(shard.d_data.d_min, value);
+    shard.d_data.d_max   =  bsl::max(shard.d_data.d_max, value);
 }
 
 inline
@@ -238,39 +330,22 @@ void Collector::accumulateCountTotalMinMax(int    count,
                                            double min,
                                            double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() += count;
-    d_record.total() += total;
-    d_record.min()   =  bsl::min(d_record.min(), min);
-    d_record.max()   =  bsl::max(d_record.max(), max);
-}
+    Shard& shard = d_shards[shardIndex()];
 
-inline
-void Collector::setCountTotalMinMax(int    count,
-                                    double total,
-                                    double min,
-                                    double max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = count;
-    d_record.total() = total;
-    d_record.min()   = min;
-    d_record.max()   = max;
+    bsls::SpinLockGuard guard(&shard.d_lock);
+    shard.d_data.d_count += count;
+    shard.d_data.d_total += total;
+    shard.d_data.d_min   =  bsl::min(shard.d_data.d_min, min);
+    shard.d_data.d_max   =  bsl::max(shard.d_data.d_max, max);
 }
 
 // ACCESSORS
 inline
 const MetricId& Collector::metricId() const
 {
-    return d_record.metricId();
+    return d_metricId;
 }
 
-inline
-void Collector::load(MetricRecord *record) const
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record = d_record;
-}
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -15,12 +15,18 @@
 #include <bslma_testallocator.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 #include <bdlmt_fixedthreadpool.h>
 
 #include <bdlf_bind.h>
 
+#include <bsls_atomic.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_functional.h>
@@ -28,6 +34,7 @@
 #include <bsl_limits.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #include <bslim_testutil.h>
 
@@ -68,6 +75,7 @@ using bsl::flush;
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
 // [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: CONCURRENT UPDATES
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -123,6 +131,7 @@ class ConcurrencyTest {
     // DATA
     bdlmt::FixedThreadPool  d_pool;
     bslmt::Barrier          d_barrier;
+    bsls::AtomicInt         d_numCollected;
     balm::Collector        *d_collector_p;
     bslma::Allocator       *d_allocator_p;
 
@@ -138,6 +147,7 @@ class ConcurrencyTest {
                     bslma::Allocator *basicAllocator)
     : d_pool(numThreads, 1000, basicAllocator)
     , d_barrier(numThreads)
+    , d_numCollected(0)
     , d_collector_p(collector)
     , d_allocator_p(basicAllocator)
     {
@@ -207,6 +217,107 @@ void ConcurrencyTest::execute()
         ASSERT(result == r1 || result == empty);
     }
     d_barrier.wait();
+
+    mX->reset();
+
+    // Test simultaneous updates and loadAndReset, verify that each update is
+    // collected exactly once, and in whole (i.e., its count and value are
+    // collected together).
+    d_barrier.wait();
+    for(int i = 0; i < 1000; ++i) {
+        mX->update(1.0);
+        if (0 == i % 100) {
+            balm::MetricRecord result;
+            mX->loadAndReset(&result);
+
+            ASSERT(result.count() == result.total());
+            d_numCollected += result.count();
+        }
+    }
+    d_barrier.wait();
+    {
+        balm::MetricRecord result;
+        mX->loadAndReset(&result);
+
+        ASSERT(result.count() == result.total());
+        d_numCollected += result.count();
+    }
+    d_barrier.wait();
+    ASSERT(1000 * d_pool.numThreads() == d_numCollected);
+}
+
+                          // ====================
+                          // class MutexCollector
+                          // ====================
+
+class MutexCollector {
+    // This class aggregates values as 'balm::Collector' did before it was
+    // sharded, under a single mutex, to serve as a baseline for measuring
+    // the performance of concurrent updates.
+
+    // DATA
+    balm::MetricRecord d_record;  // aggregated values
+    bslmt::Mutex       d_lock;    // synchronizes access to 'd_record'
+
+  public:
+    // CREATORS
+    explicit MutexCollector(const balm::MetricId& metricId)
+    : d_record(metricId)
+    {
+    }
+
+    // MANIPULATORS
+    void update(double value)
+        // Aggregate the specified 'value'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+        ++d_record.count();
+        d_record.total() += value;
+        d_record.min()   =  bsl::min(d_record.min(), value);
+        d_record.max()   =  bsl::max(d_record.max(), value);
+    }
+};
+
+template <class COLLECTOR>
+double measureUpdates(COLLECTOR *collector,
+                      int        numThreads,
+                      int        numUpdatesPerThread)
+    // Return the number of updates per second achieved by the specified
+    // 'numThreads' threads each applying the specified 'numUpdatesPerThread'
+    // updates to the specified 'collector'.
+{
+    struct Job {
+        static void run(COLLECTOR      *collector,
+                        int             numUpdates,
+                        bslmt::Barrier *barrier)
+        {
+            barrier->wait();
+            for (int i = 0; i < numUpdates; ++i) {
+                collector->update(static_cast<double>(i));
+            }
+        }
+    };
+
+    bslmt::Barrier barrier(numThreads + 1);
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::create(&handles[i],
+                                  bdlf::BindUtil::bind(&Job::run,
+                                                       collector,
+                                                       numUpdatesPerThread,
+                                                       &barrier));
+    }
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    barrier.wait();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    return static_cast<double>(numThreads) * numUpdatesPerThread
+                                                         / (elapsed / 1.0e9);
 }
 
 void ConcurrencyTest::runTest()
@@ -782,6 +893,52 @@ int main(int argc, char *argv[])
         ASSERT(Rec::k_DEFAULT_MAX == r1.max());
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONCURRENT UPDATES
+        //
+        // Concerns:
+        //: 1 Concurrent updates of a collector scale with the number of
+        //:   updating threads, unlike updates under a single mutex.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, measure the rate of updates
+        //:   of a 'balm::Collector' and of a collector aggregating under a
+        //:   single mutex.  Optionally specify, as the second argument, the
+        //:   number of updates per thread.
+        //
+        // Testing:
+        //   PERFORMANCE: CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PERFORMANCE: CONCURRENT UPDATES" << endl
+                                  << "===============================" << endl;
+
+        const int numUpdates = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        const int NUM_THREADS[] = { 1, 2, 4, 8, 16, 24 };
+        const int NUM_CASES     = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        for (int i = 0; i < NUM_CASES; ++i) {
+            Obj            sharded(METRIC_A);
+            MutexCollector locked(METRIC_A);
+
+            const double shardedRate = measureUpdates(&sharded,
+                                                      NUM_THREADS[i],
+                                                      numUpdates);
+            const double lockedRate  = measureUpdates(&locked,
+                                                      NUM_THREADS[i],
+                                                      numUpdates);
+
+            cout << NUM_THREADS[i] << " threads: sharded "
+                 << shardedRate << " updates/sec, single mutex "
+                 << lockedRate  << " updates/sec" << endl;
+
+            Rec record;
+            sharded.load(&record);
+            ASSERT(NUM_THREADS[i] * numUpdates == record.count());
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -13,12 +13,14 @@
 BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 
 #include <balm_metricid.h>
+#include <balm_publicationtype.h>
 
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslma_managedptr.h>
 #include <bsls_assert.h>
 
 #include <bsl_algorithm.h>   // for 'bsl::min' and 'bsl::max'
@@ -43,6 +45,25 @@ void combine(balm::MetricRecord *record, const balm::MetricRecord& value)
     record->max()      = bsl::max(record->max(), value.max());
 }
 
+struct Percentile {
+    // This 'struct' describes a percentile published for each histogram
+    // collector, and the suffix of the name of the derived metric under which
+    // it is published.
+
+    double      d_percent;  // percentile, in the range '[0.0, 100.0]'
+    const char *d_suffix;   // suffix of the derived metric's name
+};
+
+const Percentile k_PERCENTILES[] = {
+    { 50.0, ".p50"  },
+    { 99.0, ".p99"  },
+    { 99.9, ".p999" }
+};
+
+enum {
+    k_NUM_PERCENTILES = sizeof k_PERCENTILES / sizeof *k_PERCENTILES
+};
+
 }  // close unnamed namespace
 
 namespace balm {
@@ -256,13 +277,15 @@ CollectorRepository_Collectors<COLLECTOR>::metricId() const
 
 class CollectorRepository_MetricCollectors {
     // This implementation class provides a container mechanism for managing
-    // the 'Collector' and 'IntegerCollector' objects associated with a single
-    // metric.  The 'collector' and 'intCollector' methods are provided to
-    // access the individual containers for 'Collector' objects and
-    // 'IntegerCollector' objects, respectively.   The 'collectAndReset' method
-    // obtains the aggregate value of all the owned collectors and integer
-    // collectors, and then resets those collectors and integer collectors to
-    // their default state.
+    // the 'Collector', 'IntegerCollector', and (optional) 'HistogramCollector'
+    // objects associated with a single metric.  The 'collector' and
+    // 'intCollector' methods are provided to access the individual containers
+    // for 'Collector' objects and 'IntegerCollector' objects, respectively,
+    // and the 'histogramCollector' method provides access to the histogram
+    // collector, which is created by 'createHistogramCollector'.   The
+    // 'collectAndReset' method obtains the aggregate value of all the owned
+    // collectors, integer collectors, and histogram collector, and then
+    // resets those collectors to their default state.
 
     // PRIVATE TYPES
     typedef CollectorRepository_Collectors<Collector>
@@ -271,8 +294,31 @@ class CollectorRepository_MetricCollectors {
                                                         IntCollectors;
 
     // DATA
-    Collectors    d_collectors;     // collector objects
-    IntCollectors d_intCollectors;  // integer collector objects
+    Collectors                            d_collectors;
+                                               // collector objects
+
+    IntCollectors                         d_intCollectors;
+                                               // integer collector objects
+
+    bslma::ManagedPtr<HistogramCollector> d_histogram;
+                                               // histogram collector, if
+                                               // one has been created
+
+    MetricId                              d_percentileIds[k_NUM_PERCENTILES];
+                                               // ids of the derived
+                                               // percentile metrics
+
+    bslma::Allocator                     *d_allocator_p;
+                                               // allocator (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    void appendRecords(bsl::vector<MetricRecord> *records,
+                       MetricRecord              *record,
+                       const HistogramSnapshot&   snapshot);
+        // Combine the aggregates of the specified 'snapshot' into the
+        // specified 'record', and append 'record', followed by a record for
+        // each of the derived percentile metrics computed from 'snapshot', to
+        // the specified 'records'.
 
     // NOT IMPLEMENTED
     CollectorRepository_MetricCollectors(
@@ -306,21 +352,32 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the modifiable container of
         // 'IntegerCollector' objects.
 
-    void collectAndReset(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object; then
-        // reset those collectors to their default values.  Note that all
-        // collectors within this object record values for the same metric id,
-        // so they can be aggregated into a single record.
+    HistogramCollector *histogramCollector();
+        // Return the address of the modifiable histogram collector, or 0 if
+        // 'createHistogramCollector' has not been called.
 
-    void collect(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object.  Note
+    HistogramCollector *createHistogramCollector(MetricRegistry *registry);
+        // Return the address of the modifiable histogram collector, creating
+        // it, and registering the derived percentile metrics with the
+        // specified 'registry', if it has not already been created.
+
+    void collectAndReset(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' the aggregate value of all the
+        // records collected by the collectors owned by this object, followed
+        // by the derived percentile records if a histogram collector has been
+        // created; then reset those collectors to their default values.  Note
         // that all collectors within this object record values for the same
-        // metric id, so they can be aggregated into a single record.  Also
-        // note that because this operation does not reset the collectors,
-        // subsequent 'collect' invocations will effectively re-collect the
-        // current values.
+        // metric id, so they can be aggregated into a single record.
+
+    void collect(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' the aggregate value of all the
+        // records collected by the collectors owned by this object, followed
+        // by the derived percentile records if a histogram collector has been
+        // created.  Note that all collectors within this object record values
+        // for the same metric id, so they can be aggregated into a single
+        // record.  Also note that because this operation does not reset the
+        // collectors, subsequent 'collect' invocations will effectively
+        // re-collect the current values.
 
     // ACCESSORS
     const CollectorRepository_Collectors<Collector>& collectors() const;
@@ -349,6 +406,8 @@ CollectorRepository_MetricCollectors(const MetricId&   id,
                                      bslma::Allocator *basicAllocator)
 : d_collectors(id, basicAllocator)
 , d_intCollectors(id, basicAllocator)
+, d_histogram()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -358,6 +417,37 @@ CollectorRepository_MetricCollectors::
 {
 }
 
+// PRIVATE MANIPULATORS
+void CollectorRepository_MetricCollectors::appendRecords(
+                                       bsl::vector<MetricRecord> *records,
+                                       MetricRecord              *record,
+                                       const HistogramSnapshot&   snapshot)
+{
+    const int count = static_cast<int>(snapshot.count());
+
+    combine(record, MetricRecord(metricId(),
+                                 count,
+                                 snapshot.total(),
+                                 snapshot.min(),
+                                 snapshot.max()));
+    records->push_back(*record);
+
+    for (int i = 0; i < k_NUM_PERCENTILES; ++i) {
+        if (0 == count) {
+            records->push_back(MetricRecord(d_percentileIds[i]));
+        }
+        else {
+            const double value = snapshot.percentile(
+                                                  k_PERCENTILES[i].d_percent);
+            records->push_back(MetricRecord(d_percentileIds[i],
+                                            count,
+                                            value * count,
+                                            value,
+                                            value));
+        }
+    }
+}
+
 // MANIPULATORS
 inline
 CollectorRepository_Collectors<Collector>&
@@ -373,21 +463,74 @@ CollectorRepository_MetricCollectors::intCollectors()
     return d_intCollectors;
 }
 
+inline
+HistogramCollector *CollectorRepository_MetricCollectors::histogramCollector()
+{
+    return d_histogram.get();
+}
+
+HistogramCollector *
+CollectorRepository_MetricCollectors::createHistogramCollector(
+                                                      MetricRegistry *registry)
+{
+    if (d_histogram) {
+        return d_histogram.get();                                     // RETURN
+    }
+
+    const MetricId& id = metricId();
+    for (int i = 0; i < k_NUM_PERCENTILES; ++i) {
+        bsl::string name(id.metricName(), d_allocator_p);
+        name += k_PERCENTILES[i].d_suffix;
+
+        d_percentileIds[i] = registry->getId(id.categoryName(), name.c_str());
+        if (PublicationType::e_UNSPECIFIED ==
+             d_percentileIds[i].description()->preferredPublicationType()) {
+            registry->setPreferredPublicationType(d_percentileIds[i],
+                                                  PublicationType::e_MAX);
+        }
+    }
+
+    d_histogram.load(new (*d_allocator_p) HistogramCollector(id),
+                     d_allocator_p);
+    return d_histogram.get();
+}
+
 void CollectorRepository_MetricCollectors::collectAndReset(
-                                                          MetricRecord *record)
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collectAndReset(record);
+    MetricRecord record;
+    d_collectors.collectAndReset(&record);
     MetricRecord tempRecord;
     d_intCollectors.collectAndReset(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+
+    if (d_histogram) {
+        HistogramSnapshot snapshot(d_allocator_p);
+        d_histogram->loadAndReset(&snapshot);
+        appendRecords(records, &record, snapshot);
+    }
+    else {
+        records->push_back(record);
+    }
 }
 
-void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
+void CollectorRepository_MetricCollectors::collect(
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collect(record);
+    MetricRecord record;
+    d_collectors.collect(&record);
     MetricRecord tempRecord;
     d_intCollectors.collect(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+
+    if (d_histogram) {
+        HistogramSnapshot snapshot(d_allocator_p);
+        d_histogram->load(&snapshot);
+        appendRecords(records, &record, snapshot);
+    }
+    else {
+        records->push_back(record);
+    }
 }
 
 // ACCESSORS
@@ -463,9 +606,7 @@ void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collectAndReset(&record);
-            records->push_back(record);
+            (*metricIt)->collectAndReset(records);
         }
     }
 }
@@ -487,9 +628,7 @@ void CollectorRepository::collect(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collect(&record);
-            records->push_back(record);
+            (*metricIt)->collect(records);
         }
     }
 }
@@ -531,6 +670,27 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
     return getMetricCollectors(metricId).intCollectors().defaultCollector();
 }
 
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                      const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the histogram collector for
+    // 'metricId' already exists.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end() && it->second->histogramCollector()) {
+            return it->second->histogramCollector();                  // RETURN
+        }
+    }
+
+    // Use 'getMetricCollectors' to create the metrics collectors object, and
+    // then the histogram collector (if they have not been created since the
+    // read-lock was released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).createHistogramCollector(
+                                                                 d_registry_p);
+}
+
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                       const MetricId& metricId)
 {
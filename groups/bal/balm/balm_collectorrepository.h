@@ -18,7 +18,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::CollectorRepository: a repository for collectors
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_metricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_histogramcollector,
+//           balm_metricsmanager
 //
 //@DESCRIPTION: This component defines a class, 'balm::CollectorRepository',
 // that serves as a repository for 'balm::Collector' and
@@ -38,6 +39,24 @@ BSLS_IDENT("$Id: $")
 // collects and returns metric records from each of the collectors in the
 // repository.
 //
+///Histogram Collectors
+///--------------------
+// The 'getDefaultHistogramCollector' operation returns the
+// 'balm::HistogramCollector' for the supplied metric, which records the
+// distribution of the metric's values in addition to their count, total,
+// minimum, and maximum.  When a histogram collector is created for a metric,
+// the repository also registers three derived metrics, having the metric's
+// name suffixed by ".p50", ".p99", and ".p999" respectively, in the same
+// category.  The collection operations fold the count, total, minimum, and
+// maximum of the histogram collector into the record for the metric itself,
+// and then append a record for each derived metric, in which the minimum and
+// maximum are the median, 99th, and 99.9th percentile (respectively) of the
+// collected values, the count is the number of collected values, and the
+// total is the percentile times the count.  The preferred publication type of
+// the derived metrics is 'balm::PublicationType::e_MAX' (unless a preferred
+// publication type was already set), so that a publisher such as
+// 'balm::StreamPublisher' reports just the percentile for each of them.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -109,6 +128,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <balm_collector.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
@@ -261,6 +281,30 @@ class CollectorRepository {
         // repository, create one, add it to the repository, and return its
         // address.
 
+    HistogramCollector *getDefaultHistogramCollector(const char *category,
+                                                     const char *metricName);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified 'category' and 'metricName'.  If a histogram
+        // collector for the identified metric does not already exist in the
+        // repository, create one, add it to the repository, register the
+        // derived percentile metrics (see {Histogram Collectors}), and return
+        // its address.  In addition, if the identified metric has not already
+        // been registered, add the identified metric to the 'metricRegistry'
+        // supplied at construction.  The behavior is undefined unless
+        // 'category' and 'metricName' are null-terminated.  Note that this
+        // operation is logically equivalent to:
+        //..
+        //  getDefaultHistogramCollector(registry().getId(category,
+        //                                                metricName))
+        //..
+
+    HistogramCollector *getDefaultHistogramCollector(const MetricId& metricId);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified 'metricId'.  If a histogram collector for the
+        // identified metric does not already exist in the repository, create
+        // one, add it to the repository, register the derived percentile
+        // metrics (see {Histogram Collectors}), and return its address.
+
     bsl::shared_ptr<Collector> addCollector(const char *category,
                                             const char *metricName);
         // Return a shared pointer to a newly-created modifiable collector
@@ -366,6 +410,15 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                           metricName));
 }
 
+inline
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultHistogramCollector(d_registry_p->getId(category,
+                                                            metricName));
+}
+
 inline
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                         const char *category,
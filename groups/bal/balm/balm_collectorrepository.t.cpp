@@ -21,6 +21,7 @@
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cmath.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_functional.h>
@@ -61,6 +62,8 @@ using bsl::flush;
 // [ 3] getDefaultCollector(const MetricId&);
 // [ 6] getDefaultIntegerCollector(const StringRef&, const StringRef&);
 // [ 3] IntegerCollector *getDefaultIntegerCollector(const MetricId&);
+// [ 9] getDefaultHistogramCollector(const char *, const char *);
+// [ 9] HistogramCollector *getDefaultHistogramCollector(const MetricId&);
 // [ 5] addCollector(const StringRef&, const StringRef&);
 // [ 2] addCollector(const MetricId& metricId);
 // [ 5] addIntegerCollector(const StringRef&, const StringRef&);
@@ -74,7 +77,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -399,7 +402,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -476,6 +479,113 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAM COLLECTORS
+        //
+        // Concerns:
+        //: 1 'getDefaultHistogramCollector' returns the same collector for
+        //:   the same metric, whether it is identified by name or by id.
+        //:
+        //: 2 Creating a histogram collector registers the derived percentile
+        //:   metrics, having a preferred publication type of 'e_MAX' unless
+        //:   one was already set.
+        //:
+        //: 3 'collect' and 'collectAndReset' fold the values of the histogram
+        //:   collector into the record of the metric, and append a record
+        //:   for each derived percentile metric; 'collectAndReset' resets the
+        //:   histogram collector.
+        //:
+        //: 4 The records of an empty histogram collector have default
+        //:   values.
+        //
+        // Plan:
+        //: 1 Obtain a histogram collector by name and by id.  (C-1..2)
+        //:
+        //: 2 Record values to the histogram collector, and to a collector for
+        //:   the same metric, and verify the collected records.  (C-3..4)
+        //
+        // Testing:
+        //   getDefaultHistogramCollector(const char *, const char *);
+        //   HistogramCollector *getDefaultHistogramCollector(const MetricId&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING HISTOGRAM COLLECTORS" << endl
+                                  << "============================" << endl;
+
+        typedef balm::PublicationType Type;
+
+        Registry reg(Z);
+        Obj      mX(&reg, Z);
+
+        const Id P99_ID = reg.getId("A", "Latency.p99");
+        reg.setPreferredPublicationType(P99_ID, Type::e_AVG);
+
+        balm::HistogramCollector *histogram =
+                               mX.getDefaultHistogramCollector("A", "Latency");
+        const Id METRIC_ID = reg.getId("A", "Latency");
+
+        ASSERT(0         != histogram);
+        ASSERT(METRIC_ID == histogram->metricId());
+        ASSERT(histogram == mX.getDefaultHistogramCollector(METRIC_ID));
+
+        const Id P50_ID  = reg.findId("A", "Latency.p50");
+        const Id P999_ID = reg.findId("A", "Latency.p999");
+        ASSERT(P50_ID.isValid());
+        ASSERT(P999_ID.isValid());
+        ASSERT(Type::e_MAX ==
+                           P50_ID.description()->preferredPublicationType());
+        ASSERT(Type::e_AVG ==
+                           P99_ID.description()->preferredPublicationType());
+        ASSERT(Type::e_MAX ==
+                          P999_ID.description()->preferredPublicationType());
+
+        bsl::vector<Rec> records(Z);
+        mX.collect(&records, reg.getCategory("A"));
+        ASSERT(4 == records.size());
+        ASSERT(Rec(METRIC_ID) == records[0]);
+        ASSERT(Rec(P50_ID)    == records[1]);
+        ASSERT(Rec(P99_ID)    == records[2]);
+        ASSERT(Rec(P999_ID)   == records[3]);
+
+        for (int i = 1; i <= 1000; ++i) {
+            histogram->record(i);
+        }
+        mX.getDefaultCollector(METRIC_ID)->update(2000.0);
+
+        for (int reset = 0; reset < 2; ++reset) {
+            records.clear();
+            if (reset) {
+                mX.collectAndReset(&records, reg.getCategory("A"));
+            }
+            else {
+                mX.collect(&records, reg.getCategory("A"));
+            }
+
+            ASSERTV(reset, 4 == records.size());
+            ASSERTV(reset, Rec(METRIC_ID, 1001, 502500.0, 1.0, 2000.0) ==
+                                                                   records[0]);
+
+            const Id     IDS[]      = { P50_ID, P99_ID, P999_ID };
+            const double EXPECTED[] = { 500.0,  990.0,  999.0   };
+            for (int i = 0; i < 3; ++i) {
+                const Rec& record = records[i + 1];
+                ASSERTV(reset, i, IDS[i] == record.metricId());
+                ASSERTV(reset, i, 1000   == record.count());
+                ASSERTV(reset, i, record.min() == record.max());
+                ASSERTV(reset, i, record.min() * 1000 == record.total());
+                ASSERTV(reset, i, record.min(),
+                        bsl::fabs(record.min() - EXPECTED[i])
+                                                  <= EXPECTED[i] / 64.0);
+            }
+        }
+
+        records.clear();
+        mX.collect(&records, reg.getCategory("A"));
+        ASSERT(4 == records.size());
+        ASSERT(Rec(METRIC_ID) == records[0]);
+        ASSERT(Rec(P99_ID)    == records[2]);
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
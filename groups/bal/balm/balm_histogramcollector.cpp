@@ -0,0 +1,224 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                          // -----------------------
+                          // class HistogramSnapshot
+                          // -----------------------
+
+// CLASS METHODS
+double HistogramSnapshot::bucketLowerBound(int index)
+{
+    BSLS_ASSERT(1 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    // Invert 'bucketIndex': the least value of a bucket has the bucket's key
+    // as its exponent and leading mantissa bits, and no other bits set.
+
+    const bsls::Types::Uint64 key  = index - 1 + k_FIRST_KEY;
+    const bsls::Types::Uint64 bits = key
+                                    << (k_MANTISSA_BITS - k_SUB_BUCKET_BITS);
+
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+// CREATORS
+HistogramSnapshot::HistogramSnapshot(bslma::Allocator *basicAllocator)
+: d_buckets(k_NUM_BUCKETS, 0, basicAllocator)
+, d_count(0)
+, d_total(0.0)
+, d_min(MetricRecord::k_DEFAULT_MIN)
+, d_max(MetricRecord::k_DEFAULT_MAX)
+{
+}
+
+HistogramSnapshot::HistogramSnapshot(const HistogramSnapshot&  original,
+                                     bslma::Allocator         *basicAllocator)
+: d_buckets(original.d_buckets, basicAllocator)
+, d_count(original.d_count)
+, d_total(original.d_total)
+, d_min(original.d_min)
+, d_max(original.d_max)
+{
+}
+
+// MANIPULATORS
+HistogramSnapshot& HistogramSnapshot::operator=(const HistogramSnapshot& rhs)
+{
+    d_buckets = rhs.d_buckets;
+    d_count   = rhs.d_count;
+    d_total   = rhs.d_total;
+    d_min     = rhs.d_min;
+    d_max     = rhs.d_max;
+
+    return *this;
+}
+
+void HistogramSnapshot::merge(const HistogramSnapshot& other)
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i] += other.d_buckets[i];
+    }
+    d_count += other.d_count;
+    d_total += other.d_total;
+    d_min    = bsl::min(d_min, other.d_min);
+    d_max    = bsl::max(d_max, other.d_max);
+}
+
+void HistogramSnapshot::reset()
+{
+    bsl::fill(d_buckets.begin(), d_buckets.end(), 0);
+    d_count = 0;
+    d_total = 0.0;
+    d_min   = MetricRecord::k_DEFAULT_MIN;
+    d_max   = MetricRecord::k_DEFAULT_MAX;
+}
+
+// ACCESSORS
+double HistogramSnapshot::percentile(double percent) const
+{
+    BSLS_ASSERT(0.0 <= percent);
+    BSLS_ASSERT(percent <= 100.0);
+
+    if (0 == d_count) {
+        return 0.0;                                                   // RETURN
+    }
+
+    // The percentile is the value having the rank 'ceil(percent% * count)'
+    // (at least 1) in the ordered sequence of values.
+
+    const double       fraction = percent / 100.0;
+    bsls::Types::Int64 rank     = static_cast<bsls::Types::Int64>(
+                          bsl::ceil(fraction * static_cast<double>(d_count)));
+    rank = bsl::max(rank, static_cast<bsls::Types::Int64>(1));
+    rank = bsl::min(rank, d_count);
+
+    // Values of a snapshot loaded while values were being recorded may have
+    // been counted in a bucket before being reflected in the minimum or
+    // maximum (see {Thread Safety}); the estimate is limited to the range
+    // '[d_min, d_max]' only if that range is valid.
+
+    const bool hasRange = d_min <= d_max;
+
+    if (hasRange && 1 == rank) {
+        return d_min;                                                 // RETURN
+    }
+    if (hasRange && d_count == rank) {
+        return d_max;                                                 // RETURN
+    }
+
+    bsls::Types::Int64 seen = 0;
+    int                index = 0;
+    for (; index < k_NUM_BUCKETS - 1; ++index) {
+        seen += d_buckets[index];
+        if (seen >= rank) {
+            break;
+        }
+    }
+
+    double estimate;
+    if (0 == index) {
+        estimate = hasRange ? d_min : 0.0;
+    }
+    else if (k_NUM_BUCKETS - 1 == index) {
+        estimate = hasRange ? d_max : bucketLowerBound(index);
+    }
+    else {
+        estimate = (bucketLowerBound(index) + bucketLowerBound(index + 1))
+                 / 2.0;
+    }
+
+    if (hasRange) {
+        estimate = bsl::max(d_min, bsl::min(d_max, estimate));
+    }
+    return estimate;
+}
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_total(toBits(0.0))
+, d_min(toBits(MetricRecord::k_DEFAULT_MIN))
+, d_max(toBits(MetricRecord::k_DEFAULT_MAX))
+, d_buckets()
+{
+}
+
+// MANIPULATORS
+void HistogramCollector::loadAndReset(HistogramSnapshot *snapshot)
+{
+    BSLS_ASSERT(snapshot);
+
+    bsls::Types::Int64 count = 0;
+    for (int i = 0; i < HistogramSnapshot::k_NUM_BUCKETS; ++i) {
+        const bsls::Types::Int64 bucketCount = d_buckets[i].swap(0);
+        snapshot->d_buckets[i] = bucketCount;
+        count                 += bucketCount;
+    }
+    snapshot->d_count = count;
+    snapshot->d_total = toDouble(d_total.swap(toBits(0.0)));
+    snapshot->d_min   = toDouble(d_min.swap(
+                                      toBits(MetricRecord::k_DEFAULT_MIN)));
+    snapshot->d_max   = toDouble(d_max.swap(
+                                      toBits(MetricRecord::k_DEFAULT_MAX)));
+}
+
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < HistogramSnapshot::k_NUM_BUCKETS; ++i) {
+        d_buckets[i].storeRelaxed(0);
+    }
+    d_total = toBits(0.0);
+    d_min   = toBits(MetricRecord::k_DEFAULT_MIN);
+    d_max   = toBits(MetricRecord::k_DEFAULT_MAX);
+}
+
+// ACCESSORS
+void HistogramCollector::load(HistogramSnapshot *snapshot) const
+{
+    BSLS_ASSERT(snapshot);
+
+    bsls::Types::Int64 count = 0;
+    for (int i = 0; i < HistogramSnapshot::k_NUM_BUCKETS; ++i) {
+        const bsls::Types::Int64 bucketCount = d_buckets[i].loadRelaxed();
+        snapshot->d_buckets[i] = bucketCount;
+        count                 += bucketCount;
+    }
+    snapshot->d_count = count;
+    snapshot->d_total = toDouble(d_total.load());
+    snapshot->d_min   = toDouble(d_min.load());
+    snapshot->d_max   = toDouble(d_max.load());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,524 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free collector of the distribution of metric values.
+//
+//@CLASSES:
+//   balm::HistogramSnapshot: mergeable distribution of metric values
+//   balm::HistogramCollector: lock-free collector of a value distribution
+//
+//@SEE_ALSO: balm_collector, balm_collectorrepository, balm_metrics
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// for collecting the distribution of the values of a metric (e.g., request
+// latencies), and a class, 'balm::HistogramSnapshot', holding a point-in-time
+// copy of such a distribution from which percentiles (e.g., the median, or
+// the 99th percentile) can be computed.  Where a 'balm::Collector' aggregates
+// only the count, total, minimum, and maximum of the values it is supplied, a
+// 'balm::HistogramCollector' additionally counts the values falling into each
+// of a fixed set of buckets.
+//
+///Buckets
+///-------
+// Values are counted in log-linear buckets (in the manner of an HDR
+// histogram): each power-of-two interval '[2^e, 2^(e+1))', for
+// 'balm::HistogramSnapshot::k_MIN_EXPONENT <= e' and
+// 'e < balm::HistogramSnapshot::k_MAX_EXPONENT', is divided into
+// 'balm::HistogramSnapshot::k_NUM_SUB_BUCKETS' buckets of equal width.  The
+// width of a bucket is therefore proportional to the magnitude of the values
+// it holds, and a percentile computed from the buckets is within about 1.6% of
+// the value it estimates, whatever the scale of the recorded values (the
+// covered range, '[2^-30, 2^34)', spans from about a nanosecond to several
+// hundred years when the values are seconds).  Values that are less than the
+// covered range (including zero, negative values, and NaN) are counted in an
+// underflow bucket, and values that are greater are counted in an overflow
+// bucket; percentiles falling in those buckets are reported as the minimum
+// and maximum recorded value, respectively.
+//
+///Mergeable Snapshots
+///-------------------
+// A 'balm::HistogramSnapshot' is an ordinary (non-thread-safe) value, and
+// snapshots loaded from different collectors of the same metric (or from the
+// same collector at different times) can be combined using 'merge'.  The
+// buckets of the merged snapshot are the sums of the buckets of the merged
+// snapshots, so that percentiles computed from the merged snapshot are as
+// accurate as percentiles computed from any one of them.
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  'record' is lock-free: it increments
+// a single bucket, and updates the total, minimum, and maximum using atomic
+// compare-and-swap operations.  'load' and 'loadAndReset' read (and reset)
+// each bucket atomically, so that every recorded value is counted in exactly
+// one snapshot; however, a snapshot loaded while other threads are recording
+// is not an atomic view of the collector, and the total, minimum, and maximum
+// of a value that is being recorded concurrently may be reflected in the next
+// snapshot rather than the current one.
+//
+// 'balm::HistogramSnapshot' is *const* *thread-safe*, meaning that accessors
+// may be invoked concurrently from different threads, but it is not safe to
+// access or modify a 'balm::HistogramSnapshot' in one thread while another
+// thread modifies the same object.
+//
+///Usage
+///-----
+// The following example creates a 'balm::HistogramCollector', records a
+// series of values, and computes percentiles of the recorded values.
+//
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::HistogramCollector' object for 'myMetric' and use
+// the 'record' method to record 1000 latencies, in milliseconds, of which
+// the slowest 1% are an order of magnitude slower than the rest:
+//..
+//  balm::HistogramCollector collector(myMetric);
+//
+//  for (int i = 0; i < 990; ++i) {
+//      collector.record(10.0);
+//  }
+//  for (int i = 0; i < 10; ++i) {
+//      collector.record(100.0);
+//  }
+//..
+// Then, we load the distribution of the recorded values into a
+// 'balm::HistogramSnapshot', and reset the collector:
+//..
+//  balm::HistogramSnapshot snapshot;
+//  collector.loadAndReset(&snapshot);
+//
+//  assert(1000  == snapshot.count());
+//  assert(10.0  == snapshot.min());
+//  assert(100.0 == snapshot.max());
+//..
+// Finally, we compute the median and 99.9th percentile latencies, which are
+// estimated to within the width of a bucket:
+//..
+//  double p50  = snapshot.percentile(50.0);
+//  double p999 = snapshot.percentile(99.9);
+//
+//  assert(9.8  < p50  && p50  < 10.2);
+//  assert(98.0 < p999 && p999 < 102.0);
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+class HistogramCollector;
+
+                          // =======================
+                          // class HistogramSnapshot
+                          // =======================
+
+class HistogramSnapshot {
+    // This class provides a (non-thread-safe) value holding the distribution
+    // of a set of metric values: the number of values falling into each of a
+    // fixed set of log-linear buckets (see {Buckets}), and the count, total,
+    // minimum, and maximum of those values.  The default minimum value is
+    // 'MetricRecord::k_DEFAULT_MIN', and the default maximum value is
+    // 'MetricRecord::k_DEFAULT_MAX'.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_SUB_BUCKET_BITS = 5,                       // log2 of the number of
+                                                     // buckets per power of
+                                                     // two
+
+        k_NUM_SUB_BUCKETS = 1 << k_SUB_BUCKET_BITS,  // buckets per power of
+                                                     // two
+
+        k_MIN_EXPONENT    = -30,                     // exponent of the least
+                                                     // covered value
+
+        k_MAX_EXPONENT    = 34,                      // exponent of the least
+                                                     // overflowing value
+
+        k_NUM_BUCKETS     = (k_MAX_EXPONENT - k_MIN_EXPONENT)
+                          * k_NUM_SUB_BUCKETS + 2    // number of buckets,
+                                                     // including the underflow
+                                                     // and overflow buckets
+    };
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_MANTISSA_BITS   = 52,    // bits in the mantissa of a 'double'
+
+        k_EXPONENT_BIAS   = 1023,  // bias of the exponent of a 'double'
+
+        k_FIRST_KEY       = (k_EXPONENT_BIAS + k_MIN_EXPONENT)
+                                                          << k_SUB_BUCKET_BITS
+                                   // key (see 'bucketIndex') of the first
+                                   // covered bucket
+    };
+
+    // DATA
+    bsl::vector<bsls::Types::Int64> d_buckets;  // count of values per bucket
+
+    bsls::Types::Int64              d_count;    // number of values
+
+    double                          d_total;    // total of the values
+
+    double                          d_min;      // minimum value
+
+    double                          d_max;      // maximum value
+
+    // FRIENDS
+    friend class HistogramCollector;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(HistogramSnapshot,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int bucketIndex(double value);
+        // Return the index of the bucket counting the specified 'value'.
+        // Return 0 (the underflow bucket) if 'value' is less than
+        // '2^k_MIN_EXPONENT' or is NaN, and 'k_NUM_BUCKETS - 1' (the overflow
+        // bucket) if 'value' is at least '2^k_MAX_EXPONENT'.
+
+    static double bucketLowerBound(int index);
+        // Return the least value counted by the bucket having the specified
+        // 'index'.  The behavior is undefined unless
+        // '1 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    explicit HistogramSnapshot(bslma::Allocator *basicAllocator = 0);
+        // Create an empty snapshot, having a count of 0, a total of 0.0, a
+        // minimum of 'MetricRecord::k_DEFAULT_MIN', and a maximum of
+        // 'MetricRecord::k_DEFAULT_MAX'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    HistogramSnapshot(const HistogramSnapshot&  original,
+                      bslma::Allocator         *basicAllocator = 0);
+        // Create a snapshot having the same value as the specified
+        // 'original' snapshot.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~HistogramSnapshot() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    HistogramSnapshot& operator=(const HistogramSnapshot& rhs);
+        // Assign to this object the value of the specified 'rhs' snapshot,
+        // and return a reference providing modifiable access to this object.
+
+    void merge(const HistogramSnapshot& other);
+        // Add the values counted by the specified 'other' snapshot to this
+        // snapshot: add the count of each bucket of 'other' to the count of
+        // the corresponding bucket of this snapshot, add the count and total
+        // of 'other' to those of this snapshot, and set the minimum and
+        // maximum of this snapshot to the minimum and maximum of both
+        // snapshots.  Note that 'other' may be this snapshot.
+
+    void record(double value);
+        // Add the specified 'value' to this snapshot.  Note that this
+        // operation is *not* thread-safe; use a 'HistogramCollector' to
+        // record values from multiple threads.
+
+    void reset();
+        // Reset this snapshot to its default (empty) value.
+
+    // ACCESSORS
+    bsls::Types::Int64 bucketCount(int index) const;
+        // Return the number of values counted by the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    bsls::Types::Int64 count() const;
+        // Return the number of values in this snapshot.
+
+    double max() const;
+        // Return the maximum value in this snapshot, or
+        // 'MetricRecord::k_DEFAULT_MAX' if this snapshot is empty.
+
+    double min() const;
+        // Return the minimum value in this snapshot, or
+        // 'MetricRecord::k_DEFAULT_MIN' if this snapshot is empty.
+
+    double percentile(double percent) const;
+        // Return an estimate of the specified 'percent' percentile of the
+        // values in this snapshot (i.e., of the least value that is greater
+        // than or equal to 'percent'% of the values), or 0.0 if this snapshot
+        // is empty.  The estimate is the midpoint of the bucket holding the
+        // percentile, limited to the range '[min(), max()]', except that the
+        // percentile of the least (greatest) value is 'min()' ('max()').  The
+        // behavior is undefined unless '0.0 <= percent <= 100.0'.
+
+    double total() const;
+        // Return the total of the values in this snapshot.
+};
+
+                          // ========================
+                          // class HistogramCollector
+                          // ========================
+
+class HistogramCollector {
+    // This class provides a lock-free mechanism for collecting the
+    // distribution of the values of a metric over a period of time.  The
+    // collector contains a 'MetricId' object identifying the metric being
+    // collected, the number of values falling into each of the buckets
+    // described by 'HistogramSnapshot', and the total, minimum, and maximum
+    // of those values.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    MetricId            d_metricId;  // metric identifier
+
+    bsls::AtomicUint64  d_total;     // representation of the total
+
+    bsls::AtomicUint64  d_min;       // representation of the minimum
+
+    bsls::AtomicUint64  d_max;       // representation of the maximum
+
+    bsls::AtomicInt64   d_buckets[HistogramSnapshot::k_NUM_BUCKETS];
+                                     // count of values per bucket
+
+    // PRIVATE CLASS METHODS
+    static Uint64 toBits(double value);
+        // Return the object representation of the specified 'value'.
+
+    static double toDouble(Uint64 bits);
+        // Return the 'double' having the specified 'bits' as its object
+        // representation.
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+  public:
+    // CREATORS
+    explicit HistogramCollector(const MetricId& metricId);
+        // Create a histogram collector for the specified 'metricId', having
+        // no recorded values.
+
+    //! ~HistogramCollector() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void loadAndReset(HistogramSnapshot *snapshot);
+        // Load into the specified 'snapshot' the values recorded by this
+        // collector, and reset this collector to its default (empty) state.
+        // Every value recorded by this collector is loaded by exactly one
+        // invocation of 'loadAndReset' (see {Thread Safety}).
+
+    void record(double value);
+        // Record the specified 'value' to this collector.  This operation is
+        // lock-free.
+
+    void reset();
+        // Reset this collector to its default (empty) state.
+
+    // ACCESSORS
+    void load(HistogramSnapshot *snapshot) const;
+        // Load into the specified 'snapshot' the values recorded by this
+        // collector.
+
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HistogramSnapshot
+                          // -----------------------
+
+// CLASS METHODS
+inline
+int HistogramSnapshot::bucketIndex(double value)
+{
+    if (!(value > 0.0)) {
+        return 0;                                                     // RETURN
+    }
+
+    // For a positive 'double', the exponent and the leading bits of the
+    // mantissa, taken together, increase monotonically with the value; they
+    // form the key of the bucket holding the value.
+
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+
+    const bsls::Types::Int64 key = static_cast<bsls::Types::Int64>(
+                               bits >> (k_MANTISSA_BITS - k_SUB_BUCKET_BITS));
+    const bsls::Types::Int64 index = key - k_FIRST_KEY + 1;
+
+    if (index < 1) {
+        return 0;                                                     // RETURN
+    }
+    if (index >= k_NUM_BUCKETS - 1) {
+        return k_NUM_BUCKETS - 1;                                     // RETURN
+    }
+    return static_cast<int>(index);
+}
+
+// MANIPULATORS
+inline
+void HistogramSnapshot::record(double value)
+{
+    ++d_buckets[bucketIndex(value)];
+    ++d_count;
+    d_total += value;
+    d_min    = value < d_min ? value : d_min;
+    d_max    = value > d_max ? value : d_max;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 HistogramSnapshot::bucketCount(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_BUCKETS);
+
+    return d_buckets[index];
+}
+
+inline
+bsls::Types::Int64 HistogramSnapshot::count() const
+{
+    return d_count;
+}
+
+inline
+double HistogramSnapshot::max() const
+{
+    return d_max;
+}
+
+inline
+double HistogramSnapshot::min() const
+{
+    return d_min;
+}
+
+inline
+double HistogramSnapshot::total() const
+{
+    return d_total;
+}
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// PRIVATE CLASS METHODS
+inline
+bsls::Types::Uint64 HistogramCollector::toBits(double value)
+{
+    Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+inline
+double HistogramCollector::toDouble(Uint64 bits)
+{
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+// MANIPULATORS
+inline
+void HistogramCollector::record(double value)
+{
+    d_buckets[HistogramSnapshot::bucketIndex(value)].addRelaxed(1);
+
+    Uint64 expected = d_total.loadRelaxed();
+    for (;;) {
+        const Uint64 previous = d_total.testAndSwap(
+                                     expected,
+                                     toBits(toDouble(expected) + value));
+        if (previous == expected) {
+            break;
+        }
+        expected = previous;
+    }
+
+    // The minimum and maximum rarely change once a few values have been
+    // recorded, so they are first read, and written only if 'value' extends
+    // them.
+
+    expected = d_min.loadRelaxed();
+    while (value < toDouble(expected)) {
+        const Uint64 previous = d_min.testAndSwap(expected, toBits(value));
+        if (previous == expected) {
+            break;
+        }
+        expected = previous;
+    }
+
+    expected = d_max.loadRelaxed();
+    while (value > toDouble(expected)) {
+        const Uint64 previous = d_max.testAndSwap(expected, toBits(value));
+        if (previous == expected) {
+            break;
+        }
+        expected = previous;
+    }
+}
+
+// ACCESSORS
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
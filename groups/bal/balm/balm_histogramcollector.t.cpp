@@ -0,0 +1,859 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_collector.h>
+#include <balm_metricdescription.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_atomic.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
+
+#include <bslim_testutil.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::HistogramSnapshot' is a value holding the distribution of a set of
+// values in log-linear buckets, and 'balm::HistogramCollector' is a lock-free
+// mechanism recording values into such a distribution.  We verify that the
+// bucket mapping is monotonic and covers each value, that percentiles are
+// estimated within the documented relative error, that snapshots merge, and
+// that concurrently recorded values are each loaded exactly once.
+// ----------------------------------------------------------------------------
+// balm::HistogramSnapshot
+// CLASS METHODS
+// [ 2] static int bucketIndex(double value);
+// [ 2] static double bucketLowerBound(int index);
+//
+// CREATORS
+// [ 3] HistogramSnapshot(bslma::Allocator *basicAllocator = 0);
+// [ 3] HistogramSnapshot(const HistogramSnapshot&, bslma::Allocator * = 0);
+//
+// MANIPULATORS
+// [ 3] HistogramSnapshot& operator=(const HistogramSnapshot& rhs);
+// [ 3] void merge(const HistogramSnapshot& other);
+// [ 3] void record(double value);
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 3] bsls::Types::Int64 bucketCount(int index) const;
+// [ 3] bsls::Types::Int64 count() const;
+// [ 3] double max() const;
+// [ 3] double min() const;
+// [ 4] double percentile(double percent) const;
+// [ 3] double total() const;
+//
+// balm::HistogramCollector
+// CREATORS
+// [ 5] HistogramCollector(const MetricId& metricId);
+//
+// MANIPULATORS
+// [ 5] void loadAndReset(HistogramSnapshot *snapshot);
+// [ 5] void record(double value);
+// [ 5] void reset();
+//
+// ACCESSORS
+// [ 5] void load(HistogramSnapshot *snapshot) const;
+// [ 5] const MetricId& metricId() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCURRENCY TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: CONCURRENT RECORDING
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::HistogramSnapshot  Snapshot;
+typedef balm::MetricRecord       Rec;
+typedef balm::MetricId           Id;
+typedef balm::MetricDescription  Desc;
+typedef bsls::Types::Int64       Int64;
+
+const int NUM_BUCKETS = Snapshot::k_NUM_BUCKETS;
+
+const double MAX_RELATIVE_ERROR = 1.0 / (2 * Snapshot::k_NUM_SUB_BUCKETS);
+    // Maximum relative error of a percentile estimated by the midpoint of
+    // the bucket holding it.
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool isWithin(double estimate, double expected, double relativeError)
+    // Return 'true' if the specified 'estimate' differs from the specified
+    // 'expected' value by no more than the specified 'relativeError' of
+    // 'expected', and 'false' otherwise.
+{
+    return bsl::fabs(estimate - expected) <= relativeError * expected;
+}
+
+void recordValues(Obj               *collector,
+                  int                numValues,
+                  bslmt::Barrier    *barrier,
+                  bsls::AtomicInt64 *numCollected)
+    // Wait on the specified 'barrier', then record the specified 'numValues'
+    // values of 1.0 to the specified 'collector', loading and resetting the
+    // collector periodically and adding the number of values loaded to the
+    // specified 'numCollected'.
+{
+    barrier->wait();
+    for (int i = 0; i < numValues; ++i) {
+        collector->record(1.0);
+        if (0 == i % 100) {
+            Snapshot snapshot;
+            collector->loadAndReset(&snapshot);
+
+            Int64 bucketTotal = 0;
+            for (int j = 0; j < NUM_BUCKETS; ++j) {
+                bucketTotal += snapshot.bucketCount(j);
+            }
+            ASSERT(bucketTotal == snapshot.count());
+            const int index = Snapshot::bucketIndex(1.0);
+            ASSERT(snapshot.count() == snapshot.bucketCount(index));
+            *numCollected += snapshot.count();
+        }
+    }
+}
+
+template <class COLLECTOR>
+struct RecordFunction;
+    // This 'struct' provides a function recording a value to a collector of
+    // the (template parameter) type 'COLLECTOR'.
+
+template <>
+struct RecordFunction<Obj> {
+    static void record(Obj *collector, double value)
+        // Record the specified 'value' to the specified 'collector'.
+    {
+        collector->record(value);
+    }
+};
+
+template <>
+struct RecordFunction<balm::Collector> {
+    static void record(balm::Collector *collector, double value)
+        // Update the specified 'collector' by the specified 'value'.
+    {
+        collector->update(value);
+    }
+};
+
+template <class COLLECTOR>
+void recordJob(COLLECTOR *collector, int numValues, bslmt::Barrier *barrier)
+    // Wait on the specified 'barrier', then record the specified 'numValues'
+    // values to the specified 'collector'.
+{
+    barrier->wait();
+    for (int i = 0; i < numValues; ++i) {
+        RecordFunction<COLLECTOR>::record(collector, 1.0 + (i & 1023));
+    }
+}
+
+template <class COLLECTOR>
+double measureRecords(COLLECTOR *collector,
+                      int        numThreads,
+                      int        numValuesPerThread)
+    // Return the number of values per second recorded by the specified
+    // 'numThreads' threads each recording the specified 'numValuesPerThread'
+    // values to the specified 'collector'.
+{
+    bslmt::Barrier barrier(numThreads + 1);
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::create(&handles[i],
+                                  bdlf::BindUtil::bind(&recordJob<COLLECTOR>,
+                                                       collector,
+                                                       numValuesPerThread,
+                                                       &barrier));
+    }
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    barrier.wait();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    return static_cast<double>(numThreads) * numValuesPerThread
+                                                         / (elapsed / 1.0e9);
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int          verbose = argc > 2;
+    int      veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    const double INF = bsl::numeric_limits<double>::infinity();
+    const double NaN = bsl::numeric_limits<double>::quiet_NaN();
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+    Desc desc_B(&cat_A, "B"); const Desc *DESC_B = &desc_B;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+    Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+        balm::Category           myCategory("MyCategory");
+        balm::MetricDescription  description(&myCategory, "RequestLatency");
+        balm::MetricId           myMetric(&description);
+
+        balm::HistogramCollector collector(myMetric);
+
+        for (int i = 0; i < 990; ++i) {
+            collector.record(10.0);
+        }
+        for (int i = 0; i < 10; ++i) {
+            collector.record(100.0);
+        }
+
+        balm::HistogramSnapshot snapshot;
+        collector.loadAndReset(&snapshot);
+
+        ASSERT(1000  == snapshot.count());
+        ASSERT(10.0  == snapshot.min());
+        ASSERT(100.0 == snapshot.max());
+
+        double p50  = snapshot.percentile(50.0);
+        double p999 = snapshot.percentile(99.9);
+
+        ASSERT(9.8  < p50  && p50  < 10.2);
+        ASSERT(98.0 < p999 && p999 < 102.0);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Values recorded concurrently from multiple threads, while other
+        //:   threads load and reset the collector, are each loaded exactly
+        //:   once, and the count of a loaded snapshot is the sum of its
+        //:   buckets.
+        //
+        // Plan:
+        //: 1 Have several threads each record 1000 values of 1.0 to a single
+        //:   collector, loading and resetting the collector every 100
+        //:   values; after the threads are joined, load and reset the
+        //:   collector once more, and verify that the sum of the loaded
+        //:   counts is the number of recorded values.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY TEST" << endl
+                                  << "================" << endl;
+
+        const int NUM_THREADS = 10;
+        const int NUM_VALUES  = 1000;
+
+        Obj               mX(METRIC_A);
+        bsls::AtomicInt64 numCollected(0);
+        bslmt::Barrier    barrier(NUM_THREADS);
+
+        bsl::vector<bslmt::ThreadUtil::Handle> handles(NUM_THREADS);
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                        &handles[i],
+                                        bdlf::BindUtil::bind(&recordValues,
+                                                             &mX,
+                                                             NUM_VALUES,
+                                                             &barrier,
+                                                             &numCollected)));
+        }
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        Snapshot snapshot;
+        mX.loadAndReset(&snapshot);
+        numCollected += snapshot.count();
+
+        ASSERTV(numCollected.load(),
+                NUM_THREADS * NUM_VALUES == numCollected.load());
+
+        mX.load(&snapshot);
+        ASSERT(0 == snapshot.count());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAMCOLLECTOR
+        //
+        // Concerns:
+        //: 1 A collector is created empty, for the supplied metric.
+        //:
+        //: 2 'load' loads the same value as 'HistogramSnapshot::record'
+        //:   applied to the same values, and does not reset the collector.
+        //:
+        //: 3 'loadAndReset' loads the same value, and resets the collector.
+        //:
+        //: 4 'reset' resets the collector.
+        //
+        // Plan:
+        //: 1 Record a table of values to a collector and to a snapshot, and
+        //:   compare the loaded snapshots with the recorded snapshot.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   HistogramCollector(const MetricId& metricId);
+        //   void loadAndReset(HistogramSnapshot *snapshot);
+        //   void record(double value);
+        //   void reset();
+        //   void load(HistogramSnapshot *snapshot) const;
+        //   const MetricId& metricId() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING HISTOGRAMCOLLECTOR" << endl
+                                  << "==========================" << endl;
+
+        const double VALUES[] = { 0.0, -1.0, 1.0e-12, 0.5, 1.0, 1.0, 3.25,
+                                  1000.0, 1.0e6, 1.0e20, 7.0 };
+        const int    NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+        Obj mY(METRIC_B); const Obj& Y = mY;
+
+        ASSERT(METRIC_A == X.metricId());
+        ASSERT(METRIC_B == Y.metricId());
+
+        Snapshot empty, expected, result;
+
+        X.load(&result);
+        ASSERT(0                              == result.count());
+        ASSERT(0.0                            == result.total());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MIN == result.min());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MAX == result.max());
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.record(VALUES[i]);
+            expected.record(VALUES[i]);
+
+            X.load(&result);
+            ASSERTV(i, expected.count() == result.count());
+            ASSERTV(i, expected.total() == result.total());
+            ASSERTV(i, expected.min()   == result.min());
+            ASSERTV(i, expected.max()   == result.max());
+            for (int j = 0; j < NUM_BUCKETS; ++j) {
+                ASSERTV(i, j,
+                        expected.bucketCount(j) == result.bucketCount(j));
+            }
+        }
+
+        mX.loadAndReset(&result);
+        ASSERT(NUM_VALUES       == result.count());
+        ASSERT(expected.total() == result.total());
+        ASSERT(-1.0             == result.min());
+        ASSERT(1.0e20           == result.max());
+        ASSERT(2 == result.bucketCount(Snapshot::bucketIndex(1.0)));
+
+        X.load(&result);
+        ASSERT(0                                 == result.count());
+        ASSERT(0.0                               == result.total());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MIN == result.min());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MAX == result.max());
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.record(VALUES[i]);
+        }
+        mX.reset();
+        X.load(&result);
+        ASSERT(0                                 == result.count());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MIN == result.min());
+        for (int j = 0; j < NUM_BUCKETS; ++j) {
+            ASSERTV(j, 0 == result.bucketCount(j));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING PERCENTILE
+        //
+        // Concerns:
+        //: 1 A percentile is estimated within 'MAX_RELATIVE_ERROR' of the
+        //:   exact percentile, for values of any magnitude in the covered
+        //:   range.
+        //:
+        //: 2 The 0th and 100th percentiles are the minimum and maximum.
+        //:
+        //: 3 Percentiles falling in the underflow and overflow buckets are
+        //:   reported as the minimum and maximum, respectively.
+        //:
+        //: 4 The percentile of an empty snapshot is 0.
+        //
+        // Plan:
+        //: 1 For several scales, record the values '1..1000' times the scale
+        //:   and compare the estimated percentiles with the exact ones.
+        //:   (C-1..2)
+        //:
+        //: 2 Record values below and above the covered range, and verify the
+        //:   percentiles falling in the underflow and overflow buckets.
+        //:   (C-3)
+        //:
+        //: 3 Verify the percentile of an empty snapshot.  (C-4)
+        //
+        // Testing:
+        //   double percentile(double percent) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING PERCENTILE" << endl
+                                  << "==================" << endl;
+
+        {
+            const double SCALES[] = { 1.0e-6, 1.0e-3, 1.0, 1.0e3, 1.0e6 };
+            const int    NUM_SCALES = sizeof SCALES / sizeof *SCALES;
+
+            const double PERCENTS[] = { 1.0, 10.0, 50.0, 90.0, 99.0, 99.9 };
+            const int    NUM_PERCENTS = sizeof PERCENTS / sizeof *PERCENTS;
+
+            for (int i = 0; i < NUM_SCALES; ++i) {
+                const double SCALE = SCALES[i];
+
+                Snapshot mX; const Snapshot& X = mX;
+                for (int v = 1; v <= 1000; ++v) {
+                    mX.record(v * SCALE);
+                }
+
+                for (int j = 0; j < NUM_PERCENTS; ++j) {
+                    const double PERCENT  = PERCENTS[j];
+                    const double EXPECTED = bsl::ceil(PERCENT * 10.0) * SCALE;
+                    const double estimate = X.percentile(PERCENT);
+
+                    if (veryVerbose) {
+                        P_(SCALE); P_(PERCENT); P_(EXPECTED); P(estimate);
+                    }
+                    ASSERTV(SCALE, PERCENT, EXPECTED, estimate,
+                            isWithin(estimate, EXPECTED, MAX_RELATIVE_ERROR));
+                }
+
+                ASSERTV(SCALE, X.min() == X.percentile(0.0));
+                ASSERTV(SCALE, X.max() == X.percentile(100.0));
+            }
+        }
+        {
+            Snapshot mX; const Snapshot& X = mX;
+            mX.record(-5.0);
+            mX.record(1.0);
+            mX.record(1.0);
+            mX.record(1.0e30);
+
+            ASSERT(-5.0   == X.percentile(10.0));
+            ASSERT(1.0    <= X.percentile(50.0));
+            ASSERT(1.0e30 == X.percentile(99.0));
+        }
+        {
+            Snapshot mX; const Snapshot& X = mX;
+            ASSERT(0.0 == X.percentile(0.0));
+            ASSERT(0.0 == X.percentile(50.0));
+            ASSERT(0.0 == X.percentile(100.0));
+
+            mX.record(3.0);
+            ASSERT(3.0 == X.percentile(0.0));
+            ASSERT(3.0 == X.percentile(50.0));
+            ASSERT(3.0 == X.percentile(100.0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAMSNAPSHOT
+        //
+        // Concerns:
+        //: 1 A default-constructed snapshot is empty.
+        //:
+        //: 2 'record' counts a value in its bucket, and updates the count,
+        //:   total, minimum, and maximum.
+        //:
+        //: 3 'merge' adds the buckets, counts, and totals, and combines the
+        //:   minimums and maximums, of two snapshots.
+        //:
+        //: 4 The copy constructor and assignment copy the value, assignment
+        //:   returns a reference to the assigned object, and self-assignment
+        //:   leaves the value unchanged.
+        //:
+        //: 5 'reset' empties the snapshot.
+        //:
+        //: 6 Memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Record values to two snapshots, merge them, and verify the
+        //:   merged value against a snapshot recording all of the values.
+        //:   (C-1..6)
+        //
+        // Testing:
+        //   HistogramSnapshot(bslma::Allocator *basicAllocator = 0);
+        //   HistogramSnapshot(const HistogramSnapshot&, bslma::Allocator *);
+        //   HistogramSnapshot& operator=(const HistogramSnapshot& rhs);
+        //   void merge(const HistogramSnapshot& other);
+        //   void record(double value);
+        //   void reset();
+        //   bsls::Types::Int64 bucketCount(int index) const;
+        //   bsls::Types::Int64 count() const;
+        //   double max() const;
+        //   double min() const;
+        //   double total() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING HISTOGRAMSNAPSHOT" << endl
+                                  << "=========================" << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::TestAllocator         oa("object",  veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Snapshot mA(&oa); const Snapshot& A = mA;
+        Snapshot mB(&oa); const Snapshot& B = mB;
+        Snapshot mC(&oa); const Snapshot& C = mC;
+
+        ASSERT(0 == da.numBlocksInUse());
+        ASSERT(0 <  oa.numBlocksInUse());
+
+        ASSERT(0                                 == A.count());
+        ASSERT(0.0                               == A.total());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MIN == A.min());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MAX == A.max());
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            ASSERTV(i, 0 == A.bucketCount(i));
+        }
+
+        mA.record(1.0);
+        mA.record(2.0);
+        mA.record(2.0);
+        mB.record(0.5);
+        mB.record(64.0);
+
+        ASSERT(3   == A.count());
+        ASSERT(5.0 == A.total());
+        ASSERT(1.0 == A.min());
+        ASSERT(2.0 == A.max());
+        ASSERT(1   == A.bucketCount(Snapshot::bucketIndex(1.0)));
+        ASSERT(2   == A.bucketCount(Snapshot::bucketIndex(2.0)));
+
+        mC.record(1.0);
+        mC.record(2.0);
+        mC.record(2.0);
+        mC.record(0.5);
+        mC.record(64.0);
+
+        Snapshot mD(A, &oa); const Snapshot& D = mD;
+        ASSERT(A.count() == D.count());
+        ASSERT(2 == D.bucketCount(Snapshot::bucketIndex(2.0)));
+
+        mD.merge(B);
+        ASSERT(C.count() == D.count());
+        ASSERT(C.total() == D.total());
+        ASSERT(C.min()   == D.min());
+        ASSERT(C.max()   == D.max());
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            ASSERTV(i, C.bucketCount(i) == D.bucketCount(i));
+        }
+
+        mD.merge(D);
+        ASSERT(2 * C.count() == D.count());
+        ASSERT(4 == D.bucketCount(Snapshot::bucketIndex(2.0)));
+
+        Snapshot *mR = &(mD = C);
+        ASSERT(&mD       == mR);
+        ASSERT(C.count() == D.count());
+        ASSERT(C.total() == D.total());
+        ASSERT(C.min()   == D.min());
+        ASSERT(C.max()   == D.max());
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            ASSERTV(i, C.bucketCount(i) == D.bucketCount(i));
+        }
+
+        mR = &(mD = D);
+        ASSERT(&mD       == mR);
+        ASSERT(C.count() == D.count());
+        ASSERT(C.total() == D.total());
+        ASSERT(2 == D.bucketCount(Snapshot::bucketIndex(2.0)));
+
+        mD.reset();
+        ASSERT(0                                 == D.count());
+        ASSERT(0.0                               == D.total());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MIN == D.min());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MAX == D.max());
+        ASSERT(0 == D.bucketCount(Snapshot::bucketIndex(2.0)));
+
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BUCKETS
+        //
+        // Concerns:
+        //: 1 'bucketIndex' is monotonically non-decreasing in the value.
+        //:
+        //: 2 A covered value lies in '[bucketLowerBound(i),
+        //:   bucketLowerBound(i + 1))', where 'i' is its bucket index.
+        //:
+        //: 3 The width of a bucket is '1 / k_NUM_SUB_BUCKETS' of the power of
+        //:   two it divides.
+        //:
+        //: 4 Zero, negative values, NaN, and values less than
+        //:   '2^k_MIN_EXPONENT' are counted in the underflow bucket, and
+        //:   values of at least '2^k_MAX_EXPONENT' (including infinity) are
+        //:   counted in the overflow bucket.
+        //
+        // Plan:
+        //: 1 Iterate over a geometric sequence of values spanning the covered
+        //:   range, and verify the bucket of each value.  (C-1..2)
+        //:
+        //: 2 Verify the bounds of each bucket.  (C-3)
+        //:
+        //: 3 Verify the buckets of out-of-range values.  (C-4)
+        //
+        // Testing:
+        //   static int bucketIndex(double value);
+        //   static double bucketLowerBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING BUCKETS" << endl
+                                  << "===============" << endl;
+
+        const double MIN_VALUE = bsl::ldexp(1.0, Snapshot::k_MIN_EXPONENT);
+        const double MAX_VALUE = bsl::ldexp(1.0, Snapshot::k_MAX_EXPONENT);
+
+        ASSERT(MIN_VALUE == Snapshot::bucketLowerBound(1));
+        ASSERT(MAX_VALUE == Snapshot::bucketLowerBound(NUM_BUCKETS - 1));
+
+        {
+            int previous = 0;
+            for (double value = MIN_VALUE; value < MAX_VALUE;
+                                                            value *= 1.0137) {
+                const int index = Snapshot::bucketIndex(value);
+
+                ASSERTV(value, index, previous <= index);
+                ASSERTV(value, index, 1 <= index);
+                ASSERTV(value, index, index < NUM_BUCKETS - 1);
+                ASSERTV(value, index,
+                        Snapshot::bucketLowerBound(index) <= value);
+                ASSERTV(value, index,
+                        value < Snapshot::bucketLowerBound(index + 1));
+                previous = index;
+            }
+        }
+        for (int i = 1; i < NUM_BUCKETS - 1; ++i) {
+            const double lower = Snapshot::bucketLowerBound(i);
+            const double upper = Snapshot::bucketLowerBound(i + 1);
+
+            int exponent;
+            bsl::frexp(lower, &exponent);
+            const double width = bsl::ldexp(1.0, exponent - 1)
+                                               / Snapshot::k_NUM_SUB_BUCKETS;
+
+            ASSERTV(i, lower < upper);
+            ASSERTV(i, width == upper - lower);
+            ASSERTV(i, i == Snapshot::bucketIndex(lower));
+        }
+
+        ASSERT(0 == Snapshot::bucketIndex(0.0));
+        ASSERT(0 == Snapshot::bucketIndex(-0.0));
+        ASSERT(0 == Snapshot::bucketIndex(-1.0));
+        ASSERT(0 == Snapshot::bucketIndex(-INF));
+        ASSERT(0 == Snapshot::bucketIndex(NaN));
+        ASSERT(0 == Snapshot::bucketIndex(MIN_VALUE / 2.0));
+        ASSERT(0 == Snapshot::bucketIndex(
+                                   bsl::numeric_limits<double>::denorm_min()));
+        ASSERT(1 == Snapshot::bucketIndex(MIN_VALUE));
+        ASSERT(NUM_BUCKETS - 2 == Snapshot::bucketIndex(MAX_VALUE * 0.9999));
+        ASSERT(NUM_BUCKETS - 1 == Snapshot::bucketIndex(MAX_VALUE));
+        ASSERT(NUM_BUCKETS - 1 == Snapshot::bucketIndex(1.0e300));
+        ASSERT(NUM_BUCKETS - 1 == Snapshot::bucketIndex(INF));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST:
+        //   Developers' Sandbox.
+        //
+        // Plan:
+        //   Perform ad-hoc test of the primary modifiers and accessors.
+        //
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+        ASSERT(METRIC_A == X.metricId());
+
+        for (int i = 1; i <= 100; ++i) {
+            mX.record(i);
+        }
+
+        Snapshot snapshot;
+        X.load(&snapshot);
+        ASSERT(100    == snapshot.count());
+        ASSERT(5050.0 == snapshot.total());
+        ASSERT(1.0    == snapshot.min());
+        ASSERT(100.0  == snapshot.max());
+        ASSERT(isWithin(snapshot.percentile(50.0), 50.0, MAX_RELATIVE_ERROR));
+        ASSERT(isWithin(snapshot.percentile(99.0), 99.0, MAX_RELATIVE_ERROR));
+
+        mX.loadAndReset(&snapshot);
+        ASSERT(100 == snapshot.count());
+
+        X.load(&snapshot);
+        ASSERT(0 == snapshot.count());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONCURRENT RECORDING
+        //
+        // Concerns:
+        //: 1 Recording a value to a 'balm::HistogramCollector' is not
+        //:   substantially more expensive than updating a 'balm::Collector'.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, measure the rate of values
+        //:   recorded to a 'balm::HistogramCollector' and to a
+        //:   'balm::Collector'.  Optionally specify, as the second argument,
+        //:   the number of values per thread.
+        //
+        // Testing:
+        //   PERFORMANCE: CONCURRENT RECORDING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PERFORMANCE: CONCURRENT RECORDING"
+                          << endl << "================================="
+                          << endl;
+
+        const int numValues = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        const int NUM_THREADS[] = { 1, 2, 4, 8, 16 };
+        const int NUM_CASES     = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        for (int i = 0; i < NUM_CASES; ++i) {
+            Obj             histogram(METRIC_A);
+            balm::Collector collector(METRIC_B);
+
+            const double histogramRate = measureRecords(&histogram,
+                                                        NUM_THREADS[i],
+                                                        numValues);
+            const double collectorRate = measureRecords(&collector,
+                                                        NUM_THREADS[i],
+                                                        numValues);
+
+            cout << NUM_THREADS[i] << " threads: histogram "
+                 << histogramRate << " values/sec, collector "
+                 << collectorRate << " values/sec" << endl;
+
+            Snapshot snapshot;
+            histogram.load(&snapshot);
+            ASSERT(NUM_THREADS[i] * numValues == snapshot.count());
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,6 +14,7 @@ BSLS_IDENT_RCSID(balm_integercollector_cpp,"$Id$ $CSID$")
 
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 
 namespace BloombergLP {
@@ -31,54 +32,38 @@ const int balm::IntegerCollector::DEFAULT_MAX = INT_MIN;
 #endif
 
 namespace balm {
-// MANIPULATORS
-void IntegerCollector::loadAndReset(MetricRecord *records)
+
+// PRIVATE ACCESSORS
+void IntegerCollector::lockAllShards() const
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-
-        d_count = 0;
-        d_total = 0;
-        d_min   = k_DEFAULT_MIN;
-        d_max   = k_DEFAULT_MAX;
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].d_lock.lock();
     }
-    // Perform the conversion to double values outside of the lock.
-    records->metricId() = d_metricId;
-    records->count()    = count;
-    records->total()    = static_cast<double>(total);
-    records->min()      = (k_DEFAULT_MIN == min)
-                        ? MetricRecord::k_DEFAULT_MIN
-                        : min;
-    records->max()      = (k_DEFAULT_MAX == max)
-                        ? MetricRecord::k_DEFAULT_MAX
-                        : max;
 }
 
-// ACCESSORS
-void IntegerCollector::load(MetricRecord *record) const
+void IntegerCollector::unlockAllShards() const
+{
+    for (int i = k_NUM_SHARDS - 1; i >= 0; --i) {
+        d_shards[i].d_lock.unlock();
+    }
+}
+
+void IntegerCollector::mergeShards(MetricRecord *record) const
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
+    int                count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        const ShardData& data = d_shards[i].d_data;
+
+        count += data.d_count;
+        total += data.d_total;
+        min   =  bsl::min(min, data.d_min);
+        max   =  bsl::max(max, data.d_max);
     }
 
-    // Perform the conversion to double values outside of the lock.
     record->metricId() = d_metricId;
     record->count()    = count;
     record->total()    = static_cast<double>(total);
@@ -90,6 +75,62 @@ void IntegerCollector::load(MetricRecord *record) const
                        : max;
 }
 
+// CREATORS
+IntegerCollector::IntegerCollector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_shards()
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        resetShardData(&d_shards[i].d_data);
+    }
+}
+
+// MANIPULATORS
+void IntegerCollector::reset()
+{
+    lockAllShards();
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        resetShardData(&d_shards[i].d_data);
+    }
+    unlockAllShards();
+}
+
+void IntegerCollector::loadAndReset(MetricRecord *records)
+{
+    lockAllShards();
+    mergeShards(records);
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        resetShardData(&d_shards[i].d_data);
+    }
+    unlockAllShards();
+}
+
+void IntegerCollector::setCountTotalMinMax(int count,
+                                           int total,
+                                           int min,
+                                           int max)
+{
+    lockAllShards();
+    for (int i = 1; i < k_NUM_SHARDS; ++i) {
+        resetShardData(&d_shards[i].d_data);
+    }
+
+    ShardData& data = d_shards[0].d_data;
+    data.d_count = count;
+    data.d_total = total;
+    data.d_min   = min;
+    data.d_max   = max;
+    unlockAllShards();
+}
+
+// ACCESSORS
+void IntegerCollector::load(MetricRecord *record) const
+{
+    lockAllShards();
+    mergeShards(record);
+    unlockAllShards();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
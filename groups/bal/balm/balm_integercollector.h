@@ -44,6 +44,17 @@ BSLS_IDENT("$Id: $")
 // non-creator operations on a given instance can be safely invoked
 // simultaneously from multiple threads.
 //
+///Performance
+///-----------
+// As does 'balm::Collector', a 'balm::IntegerCollector' aggregates values in
+// a fixed number of cache-line-aligned and cache-line-sized shards, each
+// protected by its own spin lock, so that threads concurrently updating a
+// metric rarely contend.  'update' and 'accumulateCountTotalMinMax' aggregate
+// into the shard selected by the identifier of the calling thread; 'load',
+// 'loadAndReset', 'reset', and 'setCountTotalMinMax' acquire the lock of
+// every shard, and remain atomic with respect to updates.  The alignment
+// caveat described in 'balm_collector' applies.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::IntegerCollector', modifies its
@@ -86,9 +97,14 @@ BSLS_IDENT("$Id: $")
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bslmf_assert.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_compilerfeatures.h>
 
+#include <bsls_spinlock.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -103,23 +119,92 @@ class IntegerCollector {
     // value of an integer metric over a period of time.  The collector
     // contains a 'MetricId' object identifying the metric being collected,
     // the number of times an event occurred, and the total, minimum, and
-    // maximum aggregates of the associated measurement value.  The default
-    // value for the count is 0, the default value for the total is 0, the
-    // default value for the minimum is 'k_DEFAULT_MIN', and the default value
-    // for the maximum is 'k_DEFAULT_MAX'.
+    // maximum aggregates of the associated measurement value, which are held
+    // in per-thread shards (see {Performance}).  The default value for the
+    // count is 0, the default value for the total is 0, the default value for
+    // the minimum is 'k_DEFAULT_MIN', and the default value for the maximum
+    // is 'k_DEFAULT_MAX'.
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_SHARD_BITS = 4,                     // log2 of 'k_NUM_SHARDS'
+        k_NUM_SHARDS     = 1 << k_NUM_SHARD_BITS  // number of shards
+    };
+
+    // PRIVATE TYPES
+    struct ShardData {
+        // This 'struct' holds the aggregates of a shard.
+
+        int                d_count;  // aggregated count of events
+        bsls::Types::Int64 d_total;  // total of values across events
+        int                d_min;    // minimum value across events
+        int                d_max;    // maximum value across events
+    };
+
+    struct ShardLayout {
+        // This 'struct' has the layout of the data of a 'Shard', and is used
+        // only to compute the padding of 'Shard'.
+
+        bsls::SpinLock d_lock;
+        ShardData      d_data;
+    };
+
+    enum {
+        k_SHARD_PAD_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE
+                         - sizeof(ShardLayout)
+                                          % bslmt::Platform::e_CACHE_LINE_SIZE
+    };
+
+    struct Shard {
+        // This 'struct' holds the aggregates of a shard, and the lock
+        // protecting them, aligned and padded to occupy whole cache lines.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_ALIGNAS)
+        alignas(bslmt::Platform::e_CACHE_LINE_SIZE)
+#endif
+        bsls::SpinLock d_lock;                    // synchronizes access to
+                                                  // 'd_data'
+
+        ShardData      d_data;                    // aggregates
+
+        char           d_pad[k_SHARD_PAD_SIZE];   // padding to prevent the
+                                                  // data of different shards
+                                                  // from sharing a cache line
+    };
+
+    BSLMF_ASSERT(0 == sizeof(Shard) % bslmt::Platform::e_CACHE_LINE_SIZE);
 
     // DATA
-    MetricId             d_metricId;  // metric identifier
-    int                  d_count;     // aggregated count of events
-    bsls::Types::Int64   d_total;     // total of values across events
-    int                  d_min;       // minimum value across events
-    int                  d_max;       // maximum value across events
-    mutable bslmt::Mutex d_mutex;     // synchronizes access to data
+    MetricId      d_metricId;              // metric identifier
+    mutable Shard d_shards[k_NUM_SHARDS];  // per-thread aggregates
 
     // NOT IMPLEMENTED
     IntegerCollector(const IntegerCollector&);
     IntegerCollector& operator=(const IntegerCollector&);
 
+    // PRIVATE CLASS METHODS
+    static int shardIndex();
+        // Return the index of the shard into which the calling thread
+        // aggregates values.
+
+    static void resetShardData(ShardData *data);
+        // Reset the specified 'data' to its default state.
+
+    // PRIVATE ACCESSORS
+    void lockAllShards() const;
+        // Acquire the lock of every shard of this collector, in order.
+
+    void unlockAllShards() const;
+        // Release the lock of every shard of this collector.  The behavior is
+        // undefined unless the calling thread holds the lock of every shard.
+
+    void mergeShards(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, and the aggregates of all the shards of this collector,
+        // converting default minimum and maximum values as described for
+        // 'load'.  The behavior is undefined unless the calling thread holds
+        // the lock of every shard.
+
   public:
     // PUBLIC CONSTANTS
     static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
@@ -205,42 +290,44 @@ class IntegerCollector {
                            // class IntegerCollector
                            // ----------------------
 
-// CREATORS
+// PRIVATE CLASS METHODS
 inline
-IntegerCollector::IntegerCollector(const MetricId& metricId)
-: d_metricId(metricId)
-, d_count(0)
-, d_total(0)
-, d_min(k_DEFAULT_MIN)
-, d_max(k_DEFAULT_MAX)
-, d_mutex()
+int IntegerCollector::shardIndex()
 {
+    // Thread identifiers are typically addresses sharing their low-order
+    // bits, so select the high-order bits of their Fibonacci hash.
+
+    return static_cast<int>(
+              (bslmt::ThreadUtil::selfIdAsUint64() * 0x9E3779B97F4A7C15ULL)
+                                                  >> (64 - k_NUM_SHARD_BITS));
 }
 
 inline
-IntegerCollector::~IntegerCollector()
+void IntegerCollector::resetShardData(ShardData *data)
 {
+    data->d_count = 0;
+    data->d_total = 0;
+    data->d_min   = k_DEFAULT_MIN;
+    data->d_max   = k_DEFAULT_MAX;
 }
 
-// MANIPULATORS
+// CREATORS
 inline
-void IntegerCollector::reset()
+IntegerCollector::~IntegerCollector()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = 0;
-    d_total = 0;
-    d_min   = k_DEFAULT_MIN;
-    d_max   = k_DEFAULT_MAX;
 }
 
+// MANIPULATORS
 inline
 void IntegerCollector::update(int value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    ++d_count;
-    d_total += value;
-    d_min = bsl::min(value, d_min);
-    d_max = bsl::max(value, d_max);
+    Shard& shard = d_shards[shardIndex()];
+
+    bsls::SpinLockGuard guard(&shard.d_lock);
+    ++shard.d_data.d_count;
+    shard.d_data.d_total += value;
+    shard.d_data.d_min = bsl::min(value, shard.d_data.d_min);
+    shard.d_data.d_max = bsl::max(value, shard.d_data.d_max);
 }
 
 inline
@@ -249,24 +336,13 @@ void IntegerCollector::accumulateCountTotalMinMax(int count,
                                                   int min,
                                                   int max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count += count;
-    d_total += total;
-    d_min   = bsl::min(min, d_min);
-    d_max   = bsl::max(max, d_max);
-}
+    Shard& shard = d_shards[shardIndex()];
 
-inline
-void IntegerCollector::setCountTotalMinMax(int count,
-                                           int total,
-                                           int min,
-                                           int max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = count;
-    d_total = total;
-    d_min   = min;
-    d_max   = max;
+    bsls::SpinLockGuard guard(&shard.d_lock);
+    shard.d_data.d_count += count;
+    shard.d_data.d_total += total;
+    shard.d_data.d_min   = bsl::min(min, shard.d_data.d_min);
+    shard.d_data.d_max   = bsl::max(max, shard.d_data.d_max);
 }
 
 // ACCESSORS
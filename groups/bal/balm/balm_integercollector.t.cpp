@@ -17,6 +17,7 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_atomic.h>
 #include <bsls_types.h>
 
 #include <bsl_functional.h>
@@ -119,6 +120,7 @@ class ConcurrencyTest {
     // DATA
     bdlmt::FixedThreadPool  d_pool;
     bslmt::Barrier          d_barrier;
+    bsls::AtomicInt         d_numCollected;
     balm::IntegerCollector *d_collector_p;
     bslma::Allocator       *d_allocator_p;
 
@@ -134,6 +136,7 @@ class ConcurrencyTest {
                     bslma::Allocator      *basicAllocator)
     : d_pool(numThreads, 1000, basicAllocator)
     , d_barrier(numThreads)
+    , d_numCollected(0)
     , d_collector_p(collector)
     , d_allocator_p(basicAllocator)
     {
@@ -204,6 +207,33 @@ void ConcurrencyTest::execute()
         ASSERT(result == r1 || result == empty);
     }
     d_barrier.wait();
+
+    mX->reset();
+
+    // Test simultaneous updates and loadAndReset, verify that each update is
+    // collected exactly once, and in whole (i.e., its count and value are
+    // collected together).
+    d_barrier.wait();
+    for(int i = 0; i < 1000; ++i) {
+        mX->update(1);
+        if (0 == i % 100) {
+            balm::MetricRecord result;
+            mX->loadAndReset(&result);
+
+            ASSERT(result.count() == result.total());
+            d_numCollected += result.count();
+        }
+    }
+    d_barrier.wait();
+    {
+        balm::MetricRecord result;
+        mX->loadAndReset(&result);
+
+        ASSERT(result.count() == result.total());
+        d_numCollected += result.count();
+    }
+    d_barrier.wait();
+    ASSERT(1000 * d_pool.numThreads() == d_numCollected);
 }
 
 void ConcurrencyTest::runTest()
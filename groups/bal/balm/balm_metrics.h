@@ -92,6 +92,11 @@ BSLS_IDENT("$Id: $")
 //       lookup on 'CATEGORY' and 'METRIC' on each invocation, so those values
 //       need *not* be runtime constants.
 //
+//   BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE)
+//       Record 'VALUE' to the distribution of the identified metric, from
+//       which the median, 99th, and 99.9th percentiles are published.
+//       'CATEGORY' and 'METRIC' must be *runtime* *constants*.
+//
 //   BALM_METRICS_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
 //   BALM_METRICS_TIME_BLOCK_SECONDS(CATEGORY, METRIC)
 //   BALM_METRICS_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
@@ -102,6 +107,12 @@ BSLS_IDENT("$Id: $")
 //       of the enclosing lexical scope.  'CATEGORY' and 'METRIC' must
 //       be *runtime* *constants*.
 //
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+//       Record the elapsed (wall) time, in the indicated units, from the
+//       instantiation point of the macro to the end of the enclosing lexical
+//       scope to the distribution of the identified metric.  'CATEGORY' and
+//       'METRIC' must be *runtime* *constants*.
+//
 //   BALM_METRICS_DYNAMIC_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
 //   BALM_METRICS_DYNAMIC_TIME_BLOCK_SECONDS(CATEGORY, METRIC)
 //   BALM_METRICS_DYNAMIC_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
@@ -277,6 +288,28 @@ BSLS_IDENT("$Id: $")
 //       The behavior of this macro is logically equivalent to
 //       'BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, 1)'.
 //..
+// The following macro records a value to the distribution of a metric's
+// values, collected by a 'balm::HistogramCollector'.  In addition to the
+// count, total, minimum, and maximum of the values, the median, 99th, and
+// 99.9th percentile of the values are published, as the metrics named
+// 'METRIC' suffixed by ".p50", ".p99", and ".p999" respectively (see
+// 'balm_collectorrepository'):
+//..
+//   BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE)
+//       Record the specified 'VALUE' to the distribution of the metric
+//       identified by the specified 'CATEGORY' and 'METRIC' names.
+//       'CATEGORY' and 'METRIC' must be null-terminated strings of a type
+//       convertible to 'const char *', while 'VALUE' is assumed to be of a
+//       type convertible to 'double'.  This macro maintains a (function-scope
+//       static) cache containing the identity of the metric being updated.
+//       This cache is initialized using the 'CATEGORY' and 'METRIC' specified
+//       on the *first* application of this macro at a particular
+//       instantiation point; subsequent applications use that cached
+//       information, which in practice means that 'CATEGORY' and 'METRIC'
+//       must be *runtime* *constants*.  If the default metrics manager has
+//       not been initialized, or the identified 'CATEGORY' is disabled, this
+//       macro has no effect.
+//..
 // The following macro, 'BALM_METRICS_IF_CATEGORY_ENABLED', allows clients to
 // (efficiently) determine if a (*runtime* *constant*) category is enabled:
 //..
@@ -342,6 +375,12 @@ BSLS_IDENT("$Id: $")
 //       'BALM_METRICS_TIME_BLOCK' called with
 //       'balm::StopwatchScopedGuard::k_NANOSECONDS'.
 //
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+//       The behavior of this macro is identical to that of
+//       'BALM_METRICS_TIME_BLOCK', except that the elapsed time is recorded
+//       to the distribution of the identified metric (as if by
+//       'BALM_METRICS_HISTOGRAM') rather than used to update the metric.
+//
 //   BALM_METRICS_DYNAMIC_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
 //       Update the indicated metric, identified by the specified 'CATEGORY'
 //       and 'METRIC' names, by the elapsed (wall) time, in the specified
@@ -505,6 +544,7 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricregistry.h>
@@ -996,6 +1036,26 @@ do {                                                                          \
 #define BALM_METRICS_DYNAMIC_INCREMENT(CATEGORY, METRIC)                      \
     BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, 1)
 
+                        // ======================
+                        // BALM_METRICS_HISTOGRAM
+                        // ======================
+
+#define BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE) do {                  \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::HistogramCollector *histogram = 0;                            \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       histogram = Helper::getHistogramCollector(CATEGORY, METRIC);           \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       histogram->record(VALUE);                                              \
+   }                                                                          \
+ } while (0)
+
                         // =======================
                         // BALM_METRICS_TIME_BLOCK
                         // =======================
@@ -1013,6 +1073,13 @@ do {                                                                          \
                                   TIME_UNITS,                                 \
                                   BALM_METRICS_UNIQUE_NAME(_bAlM_CoLlEcToR))
 
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)       \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK_IMP(                                      \
+                                  (CATEGORY),                                 \
+                                  (METRIC),                                   \
+                                  TIME_UNITS,                                 \
+                                  BALM_METRICS_UNIQUE_NAME(_bAlM_HiStOgRaM))
+
 #define BALM_METRICS_TIME_BLOCK_SECONDS(CATEGORY, METRIC)                     \
   BALM_METRICS_TIME_BLOCK((CATEGORY),                                         \
                           (METRIC),                                           \
@@ -1120,6 +1187,35 @@ do {                                                                          \
         VARIABLE_NAME = repository.getDefaultCollector((CATEGORY),            \
                                                        (METRIC));             \
     }                                                                         \
+    BloombergLP::balm::StopwatchScopedGuard                                   \
+         BALM_METRICS_UNIQUE_NAME(__bAlM_gUaRd)(VARIABLE_NAME, TIME_UNITS);
+
+// Declare a static pointer to a 'balm::HistogramCollector' with the specified
+// 'VARIABLE_NAME' and an initial value of 0.  If the default metrics manager
+// is available and the declared pointer variable (named 'VARIABLE_NAME') is 0,
+// assign to 'VARIABLE_NAME' the address of a histogram collector for the
+// specified 'CATEGORY' and 'METRIC'.  Finally, declare a
+// 'balm::StopwatchScopedGuard' object with a unique variable name and supply
+// its constructor the histogram collector address held in 'VARIABLE_NAME' and
+// the specified 'TIME_UNITS'.
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_IMP(CATEGORY,                       \
+                                              METRIC,                         \
+                                              TIME_UNITS,                     \
+                                              VARIABLE_NAME)                  \
+    static BloombergLP::balm::HistogramCollector *VARIABLE_NAME = 0;          \
+    if (BloombergLP::balm::DefaultMetricsManager::instance()) {               \
+       using namespace BloombergLP;                                           \
+       if (0 == VARIABLE_NAME) {                                              \
+           balm::CollectorRepository& repository =                            \
+              balm::DefaultMetricsManager::instance()->collectorRepository(); \
+           VARIABLE_NAME = repository.getDefaultHistogramCollector(           \
+                                                                 (CATEGORY),  \
+                                                                 (METRIC));   \
+       }                                                                      \
+    }                                                                         \
+    else {                                                                    \
+       VARIABLE_NAME = 0;                                                     \
+    }                                                                         \
     BloombergLP::balm::StopwatchScopedGuard                                   \
          BALM_METRICS_UNIQUE_NAME(__bAlM_gUaRd)(VARIABLE_NAME, TIME_UNITS);
 
@@ -1202,6 +1298,13 @@ struct Metrics_Helper {
         // The behavior is undefined unless the 'balm' metrics manager
         // singleton is valid.
 
+    static HistogramCollector *getHistogramCollector(const char *category,
+                                                     const char *metric);
+        // Return the address of the histogram collector for the metric
+        // identified by the specified 'category' and 'metric' names.  The
+        // behavior is undefined unless the 'balm' metrics manager singleton
+        // is valid.
+
     static void setPublicationType(const MetricId&        id,
                                    PublicationType::Value type);
         // Set the publication type for the metric identified by the specified
@@ -1256,6 +1359,17 @@ IntegerCollector *Metrics_Helper::getIntegerCollector(const char *category,
                                                                      metric);
 }
 
+inline
+HistogramCollector *Metrics_Helper::getHistogramCollector(
+                                                          const char *category,
+                                                          const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultHistogramCollector(
+                                                                      category,
+                                                                      metric);
+}
+
 inline
 void Metrics_Helper::setPublicationType(const MetricId&        id,
                                         PublicationType::Value type)
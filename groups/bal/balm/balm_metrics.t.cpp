@@ -88,6 +88,8 @@ using bsl::flush;
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+// [19] BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE)
+// [19] BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] CONCURRENCY TEST: STANDARD MACROS
@@ -101,7 +103,7 @@ using bsl::flush;
 //                                             const char *file,
 //                                             int         line);
 // [18] WARNING LOG TEST: ALL MACROS
-// [19] USAGE EXAMPLE
+// [20] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -1385,7 +1387,7 @@ int main(int argc, char *argv[])
     Corp::bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1443,6 +1445,96 @@ int main(int argc, char *argv[])
 
     }
     } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING: HISTOGRAM MACROS
+        //
+        // Concerns:
+        //: 1 'BALM_METRICS_HISTOGRAM' records the supplied value to the
+        //:   default histogram collector of the identified metric.
+        //:
+        //: 2 'BALM_METRICS_HISTOGRAM_TIME_BLOCK' records the elapsed time of
+        //:   the enclosing block to the default histogram collector of the
+        //:   identified metric.
+        //:
+        //: 3 Neither macro records a value if the category is disabled, or
+        //:   there is no default metrics manager.
+        //
+        // Plan:
+        //: 1 Invoke the macros with and without a default metrics manager,
+        //:   and with the category enabled and disabled, and compare a
+        //:   snapshot of the histogram collector against the expected
+        //:   values.  (C-1..3)
+        //
+        // Testing:
+        //   BALM_METRICS_HISTOGRAM(CATEGORY, METRIC, VALUE)
+        //   BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: HISTOGRAM MACROS" << endl
+                          << "=========================" << endl;
+
+        // Without a default metrics manager the macros have no effect.
+
+        for (int i = 0; i < 2; ++i) {
+            BALM_METRICS_HISTOGRAM("A", "Value", 1.0);
+            BALM_METRICS_HISTOGRAM_TIME_BLOCK("A",
+                                              "Time",
+                                              BALM::StopwatchScopedGuard::
+                                                               k_MICROSECONDS);
+        }
+
+        BALM::DefaultMetricsManagerScopedGuard guard(Z);
+        BALM::MetricsManager     *manager    =
+                                       BALM::DefaultMetricsManager::instance();
+        BALM::CollectorRepository& repository = manager->collectorRepository();
+        BALM::MetricRegistry&      registry   = manager->metricRegistry();
+
+        BALM::HistogramCollector *valueHistogram =
+                         repository.getDefaultHistogramCollector("A", "Value");
+        BALM::HistogramCollector *timeHistogram  =
+                          repository.getDefaultHistogramCollector("A", "Time");
+        BALM::HistogramSnapshot   snapshot(Z);
+
+        if (veryVerbose) cout << "\tVerify values are recorded" << endl;
+
+        for (int i = 1; i <= 10; ++i) {
+            BALM_METRICS_HISTOGRAM("A", "Value", i);
+            BALM_METRICS_HISTOGRAM_TIME_BLOCK("A",
+                                              "Time",
+                                              BALM::StopwatchScopedGuard::
+                                                               k_MICROSECONDS);
+        }
+
+        valueHistogram->loadAndReset(&snapshot);
+        ASSERT(10   == snapshot.count());
+        ASSERT(55.0 == snapshot.total());
+        ASSERT(1.0  == snapshot.min());
+        ASSERT(10.0 == snapshot.max());
+
+        timeHistogram->loadAndReset(&snapshot);
+        ASSERT(10  == snapshot.count());
+        ASSERT(0.0 <= snapshot.min());
+        ASSERT(snapshot.min() <= snapshot.max());
+
+        if (veryVerbose) cout << "\tVerify disabled categories" << endl;
+
+        registry.setCategoryEnabled(registry.getCategory("A"), false);
+
+        for (int i = 1; i <= 10; ++i) {
+            BALM_METRICS_HISTOGRAM("A", "Value", i);
+            BALM_METRICS_HISTOGRAM_TIME_BLOCK("A",
+                                              "Time",
+                                              BALM::StopwatchScopedGuard::
+                                                               k_MICROSECONDS);
+        }
+
+        valueHistogram->loadAndReset(&snapshot);
+        ASSERT(0 == snapshot.count());
+        timeHistogram->loadAndReset(&snapshot);
+        ASSERT(0 == snapshot.count());
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // Testing:
@@ -27,7 +27,10 @@ BSLS_IDENT("$Id: $")
 // units to report values in (by default, values are reported in seconds).  The
 // guard measures the elapsed time between its construction and destruction,
 // and on destruction records that elapsed time, in the indicated time units,
-// to the supplied metric.
+// to the supplied metric.  A guard may alternatively be supplied a
+// 'balm::HistogramCollector', in which case the elapsed time is recorded to
+// the distribution of the metric's values, from which percentiles of the
+// elapsed time (e.g., the 99th percentile latency) are published.
 //
 ///Alternative Systems for Telemetry
 ///---------------------------------
@@ -159,6 +162,7 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
 #include <balm_metric.h>
 #include <balm_metricsmanager.h>
 
@@ -180,15 +184,16 @@ class StopwatchScopedGuard {
     // report the elapsed time; by default a guard will report time in seconds.
     // The supplied time units determine the scale of the double value reported
     // by this guard, but does *not* affect the precision of the elapsed time
-    // measurement.  Each instance of this class delegates to a 'Collector' for
-    // the metric.  This 'Collector' is initialized on construction based on
-    // the constructor arguments.  If this scoped guard is not initialized with
-    // an active metric, or if the supplied metric becomes inactive before the
-    // scoped guard is destroyed, then 'isActive()' will return 'false' and no
-    // metric values will be recorded.  Note that if the metric supplied at
-    // construction is not active when the scoped guard is constructed, the
-    // scoped guard will not become active or record metric values regardless
-    // of the future state of that supplied metric.
+    // measurement.  Each instance of this class delegates to a 'Collector' (or
+    // a 'HistogramCollector') for the metric.  This collector is initialized
+    // on construction based on the constructor arguments.  If this scoped
+    // guard is not initialized with an active metric, or if the supplied
+    // metric becomes inactive before the scoped guard is destroyed, then
+    // 'isActive()' will return 'false' and no metric values will be recorded.
+    // Note that if the metric supplied at construction is not active when the
+    // scoped guard is constructed, the scoped guard will not become active or
+    // record metric values regardless of the future state of that supplied
+    // metric.
 
   public:
     // PUBLIC TYPES
@@ -213,12 +218,19 @@ class StopwatchScopedGuard {
 
   private:
     // DATA
-    bsls::Stopwatch d_stopwatch;    // stopwatch
+    bsls::Stopwatch     d_stopwatch;    // stopwatch
 
-    Units           d_timeUnits;    // time units to record elapsed time in
+    Units               d_timeUnits;    // time units to record elapsed time
+                                        // in
 
-    Collector *d_collector_p;  // metric collector (held, not owned); may
-                                    // be 0, but cannot be invalid
+    Collector          *d_collector_p;  // metric collector (held, not
+                                        // owned); may be 0, but cannot be
+                                        // invalid
+
+    HistogramCollector *d_histogram_p;  // histogram collector (held, not
+                                        // owned); may be 0, but cannot be
+                                        // invalid; 0 unless 'd_collector_p'
+                                        // is 0
 
     // NOT IMPLEMENTED
     StopwatchScopedGuard(const StopwatchScopedGuard&);
@@ -250,6 +262,20 @@ class StopwatchScopedGuard {
         // this guard, but does *not* affect the precision of the elapsed time
         // measurement.
 
+    explicit StopwatchScopedGuard(HistogramCollector *histogram,
+                                  Units               timeUnits = k_SECONDS);
+        // Initialize this scoped guard to record elapsed time to the
+        // distribution collected by the specified 'histogram'.  Optionally
+        // specify the 'timeUnits' in which to report elapsed time.  If
+        // 'histogram' is 0 or
+        // 'histogram->metricId().category()->enabled() == false', this object
+        // will be inactive (i.e., will not record any values).  The
+        // behavior is undefined unless
+        // 'histogram == 0 || histogram->metricId().isValid()'.  Note that
+        // 'timeUnits' indicates the scale of the double value reported by
+        // this guard, but does *not* affect the precision of the elapsed time
+        // measurement.
+
     StopwatchScopedGuard(const MetricId&  metricId,
                          MetricsManager  *manager = 0);
     StopwatchScopedGuard(const MetricId&  metricId,
@@ -324,6 +350,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(Metric *metric,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(metric->isActive() ? metric->collector() : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
@@ -338,18 +365,35 @@ StopwatchScopedGuard::StopwatchScopedGuard(Collector *collector,
 , d_collector_p((collector && collector->metricId().category()->enabled())
                 ? collector
                 : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
     }
 }
 
+inline
+StopwatchScopedGuard::StopwatchScopedGuard(HistogramCollector *histogram,
+                                           Units               timeUnits)
+: d_stopwatch()
+, d_timeUnits(timeUnits)
+, d_collector_p(0)
+, d_histogram_p((histogram && histogram->metricId().category()->enabled())
+                ? histogram
+                : 0)
+{
+    if (d_histogram_p) {
+        d_stopwatch.start();
+    }
+}
+
 inline
 StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
                                            MetricsManager  *manager)
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -367,6 +411,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -384,6 +429,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
 
@@ -404,6 +450,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
     d_collector_p = (collector && collector->metricId().category()->enabled())
@@ -417,7 +464,13 @@ inline
 StopwatchScopedGuard::~StopwatchScopedGuard()
 {
     if (isActive()) {
-        d_collector_p->update(d_stopwatch.elapsedTime() * d_timeUnits);
+        const double elapsedTime = d_stopwatch.elapsedTime() * d_timeUnits;
+        if (d_collector_p) {
+            d_collector_p->update(elapsedTime);
+        }
+        else {
+            d_histogram_p->record(elapsedTime);
+        }
     }
 }
 
@@ -425,8 +478,11 @@ StopwatchScopedGuard::~StopwatchScopedGuard()
 inline
 bool StopwatchScopedGuard::isActive() const
 {
-    return 0 != d_collector_p
-        && d_collector_p->metricId().category()->enabled();
+    if (d_collector_p) {
+        return d_collector_p->metricId().category()->enabled();       // RETURN
+    }
+    return 0 != d_histogram_p
+        && d_histogram_p->metricId().category()->enabled();
 }
 
 }  // close package namespace
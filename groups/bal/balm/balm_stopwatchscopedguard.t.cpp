@@ -56,6 +56,7 @@ using bsl::flush;
 // CREATORS
 // [ 4]  explicit balm::StopwatchScopedGuard(balm::Metric *metric);
 // [ 3]  explicit balm::StopwatchScopedGuard(balm::Collector *collector);
+// [ 7]  balm::StopwatchScopedGuard(balm::HistogramCollector *, Units);
 // [ 4]  balm::StopwatchScopedGuard(const balm::MetricId&  ,
 //                                 balm::MetricsManager  * = 0);
 // [ 4]  balm::StopwatchScopedGuard(const char * ,
@@ -69,7 +70,8 @@ using bsl::flush;
 // [ 2] 'TestPublisher'                             (helper classes)
 // [ 3] TESTING REPORTED TIME UNITS
 // [ 6] ELAPSED TIME VALUE
-// [ 7] USAGE
+// [ 7] TESTING HISTOGRAM COLLECTORS
+// [ 8] USAGE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -436,7 +438,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -511,6 +513,81 @@ int main(int argc, char *argv[])
     }
         ASSERT(0 == balm::DefaultMetricsManager::instance());
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAM COLLECTORS:
+        //
+        // Concerns:
+        //   That the stop watch scoped guard records the elapsed time of a
+        //   block of code to the distribution of the supplied histogram
+        //   collector, in the supplied time units, if the category of the
+        //   histogram's metric is enabled.
+        //
+        // Plan:
+        //
+        // Testing:
+        //   balm::StopwatchScopedGuard(balm::HistogramCollector *, Units);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING HISTOGRAM COLLECTORS\n"
+                          << "============================\n";
+
+        {
+            if (veryVerbose) cout << "\tTest with null histogram" << endl;
+            balm::HistogramCollector *histogram = 0;
+            Obj mX(histogram); const Obj& MX = mX;
+
+            ASSERT(!MX.isActive());
+        }
+        {
+            if (veryVerbose) cout << "\tTest with valid histogram" << endl;
+
+            MetricsManager             manager(Z);
+            balm::HistogramCollector  *histogram =
+                          manager.collectorRepository().
+                                        getDefaultHistogramCollector("A", "A");
+            balm::HistogramSnapshot    snapshot(Z);
+
+            {
+                Obj mX(histogram, Obj::k_MICROSECONDS);  const Obj& MX = mX;
+                ASSERT(MX.isActive());
+
+                histogram->load(&snapshot);
+                ASSERT(0 == snapshot.count());
+
+                bslmt::ThreadUtil::microSleep(5000, 0);
+            }
+
+            histogram->load(&snapshot);
+            ASSERT(1 == snapshot.count());
+            LOOP_ASSERT(snapshot.total(), 5000.0 <= snapshot.total());
+            LOOP_ASSERT(snapshot.total(), 1.0e6  >  snapshot.total());
+            ASSERT(snapshot.total() == snapshot.min());
+            ASSERT(snapshot.total() == snapshot.max());
+        }
+        {
+            if (veryVerbose) cout << "\tTest with disabled category" << endl;
+
+            MetricsManager             manager(Z);
+            balm::HistogramCollector  *histogram =
+                          manager.collectorRepository().
+                                        getDefaultHistogramCollector("A", "A");
+            balm::HistogramSnapshot    snapshot(Z);
+
+            manager.setCategoryEnabled(histogram->metricId().category(),
+                                       false);
+            {
+                Obj mX(histogram);  const Obj& MX = mX;
+                ASSERT(!MX.isActive());
+            }
+            histogram->load(&snapshot);
+            ASSERT(0 == snapshot.count());
+        }
+
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+        ASSERT(0 == testAlloc.numBytesInUse());
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING ELAPSED TIME VALUE:
@@ -13,18 +13,19 @@
 BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 
 #include <bdlb_print.h>
-#include <bdlde_base64encoder.h>
+#include <bdlde_base64util.h>
 #include <bdldfp_decimalutil.h>
 
 #include <bsla_fallthrough.h>
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cfloat.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>
-#include <bsl_iterator.h>
 
 namespace BloombergLP {
 
@@ -33,30 +34,32 @@ namespace u {
 
 // HELPER FUNCTIONS
 
-template <class INPUT_ITERATOR>
 bsl::ostream& encodeBase64(bsl::ostream&  stream,
-                           INPUT_ITERATOR begin,
-                           INPUT_ITERATOR end)
-    // Write the base64 encoding of the character sequence defined by the
-    // specified 'begin' and 'end' iterators into the specified 'stream' and
-    // return 'stream'.  Each instantiation of this private function is called
-    // only once (by the functions below) and can thus be inlined without
-    // causing code bloat.
+                           const char    *data,
+                           bsl::size_t    dataLength)
+    // Write the base64 encoding of the specified 'data' buffer of the
+    // specified 'dataLength' into the specified 'stream' and return 'stream'.
 {
-    bdlde::Base64Encoder base64Encoder(0);  // 0 means do not insert CRLF
+    // Encode the data in chunks of a multiple of 3 bytes, so that the
+    // encodings of the chunks (without CRLF) concatenate to the encoding of
+    // the entire data, and no padding appears before the last chunk.
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    enum { k_CHUNK_LENGTH = 3 * 1024 };
 
-        int status = base64Encoder.convert(outputIterator, begin, end);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
-    }
+    char buffer[k_CHUNK_LENGTH / 3 * 4];
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    while (dataLength) {
+        const bsl::size_t length = bsl::min<bsl::size_t>(dataLength,
+                                                         k_CHUNK_LENGTH);
+
+        const bsl::size_t numOut = bdlde::Base64Util::encode(buffer,
+                                                             data,
+                                                             length,
+                                                             0);
+        stream.write(buffer, numOut);
 
-        int status = base64Encoder.endConvert(outputIterator);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
+        data       += length;
+        dataLength -= length;
     }
 
     return stream;
@@ -797,7 +800,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream, object.data(), object.length());
 }
 
 bsl::ostream&
@@ -807,7 +810,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream, object.data(), object.length());
 }
 
 bsl::ostream&
@@ -817,7 +820,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&              stream,
                                 bdlat_TypeCategory::Array)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream, object.data(), object.size());
 }
 
 // HEX FUNCTIONS
@@ -974,6 +974,128 @@ void swapBitsInWords(uint64_t *word1,
     *word2 |= bits1 << index2;
 }
 
+                   // for 'findNth[01]At{Max,Min}Index'
+
+static inline
+int findNth1AtMinIndexRaw(uint64_t value, size_t nth)
+    // Return the index of the specified 'nth' least-significant 1 bit in the
+    // specified 'value'.  The behavior is undefined unless
+    // '0 < nth <= BitUtil::numBitsSet(value)'.  Note that this function
+    // performs a binary search using population counts, so its cost does not
+    // depend on 'nth'.
+{
+    BSLS_ASSERT(0 < nth);
+    BSLS_ASSERT(nth <= static_cast<size_t>(BitUtil::numBitsSet(value)));
+
+    int ret = 0;
+    for (int width = k_BITS_PER_UINT64 / 2; width; width /= 2) {
+        const size_t numLow = BitUtil::numBitsSet(value & lt64Raw(width));
+        if (numLow < nth) {
+            nth   -= numLow;
+            value >>= width;
+            ret   += width;
+        }
+    }
+    return ret;
+}
+
+static
+size_t findNthAtMinIndex(const uint64_t *bitString,
+                         uint64_t        flip,
+                         size_t          nth,
+                         size_t          begin,
+                         size_t          end)
+    // Return the index of the specified 'nth' least-significant bit having
+    // the value 1 in the specified 'bitString' XOR-ed with the specified
+    // 'flip' in the specified range '[begin .. end)', if such a bit exists,
+    // and 'bdlb::BitStringUtil::k_INVALID_INDEX' otherwise.  The behavior is
+    // undefined unless '0 < nth', 'begin <= end', 'end' is less than or equal
+    // to the length of 'bitString', and 'flip' is either 0 or '~0ULL'.
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(0 < nth);
+    BSLS_ASSERT(begin <= end);
+
+    if (begin == end) {
+        return bdlb::BitStringUtil::k_INVALID_INDEX;                  // RETURN
+    }
+
+    const size_t beginWord =       begin  / k_BITS_PER_UINT64;
+    const int    beginIdx  =   u32(begin) % k_BITS_PER_UINT64;
+    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
+    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
+
+    uint64_t     value     = (bitString[beginWord] ^ flip) &
+                                                           ge64Raw(beginIdx);
+
+    for (size_t ii = beginWord; true; value = bitString[++ii] ^ flip) {
+        if (ii == lastWord) {
+            value &= BitMaskUtil::lt64(endPos);
+        }
+
+        const size_t numSet = BitUtil::numBitsSet(value);
+        if (nth <= numSet) {
+            return ii * k_BITS_PER_UINT64 + findNth1AtMinIndexRaw(value, nth);
+                                                                      // RETURN
+        }
+
+        if (ii == lastWord) {
+            return bdlb::BitStringUtil::k_INVALID_INDEX;              // RETURN
+        }
+
+        nth -= numSet;
+    }
+}
+
+static
+size_t findNthAtMaxIndex(const uint64_t *bitString,
+                         uint64_t        flip,
+                         size_t          nth,
+                         size_t          begin,
+                         size_t          end)
+    // Return the index of the specified 'nth' most-significant bit having the
+    // value 1 in the specified 'bitString' XOR-ed with the specified 'flip' in
+    // the specified range '[begin .. end)', if such a bit exists, and
+    // 'bdlb::BitStringUtil::k_INVALID_INDEX' otherwise.  The behavior is
+    // undefined unless '0 < nth', 'begin <= end', 'end' is less than or equal
+    // to the length of 'bitString', and 'flip' is either 0 or '~0ULL'.
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(0 < nth);
+    BSLS_ASSERT(begin <= end);
+
+    if (begin == end) {
+        return bdlb::BitStringUtil::k_INVALID_INDEX;                  // RETURN
+    }
+
+    const size_t beginWord =       begin  / k_BITS_PER_UINT64;
+    const int    beginIdx  =   u32(begin) % k_BITS_PER_UINT64;
+    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
+    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
+
+    uint64_t     value     = (bitString[lastWord] ^ flip) &
+                                                    BitMaskUtil::lt64(endPos);
+
+    for (size_t ii = lastWord; true; value = bitString[--ii] ^ flip) {
+        if (ii == beginWord) {
+            value &= ge64Raw(beginIdx);
+        }
+
+        const size_t numSet = BitUtil::numBitsSet(value);
+        if (nth <= numSet) {
+            return ii * k_BITS_PER_UINT64 +
+                               findNth1AtMinIndexRaw(value, numSet - nth + 1);
+                                                                      // RETURN
+        }
+
+        if (ii == beginWord) {
+            return bdlb::BitStringUtil::k_INVALID_INDEX;              // RETURN
+        }
+
+        nth -= numSet;
+    }
+}
+
                         // for 'print'
 
 static
@@ -1995,6 +2117,54 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString,
            : k_INVALID_INDEX;
 }
 
+size_t BitStringUtil::findNth0AtMaxIndex(const uint64_t *bitString,
+                                         size_t          nth,
+                                         size_t          begin,
+                                         size_t          end)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(0 < nth);
+    BSLS_ASSERT(begin <= end);
+
+    return findNthAtMaxIndex(bitString, ~0ULL, nth, begin, end);
+}
+
+size_t BitStringUtil::findNth0AtMinIndex(const uint64_t *bitString,
+                                         size_t          nth,
+                                         size_t          begin,
+                                         size_t          end)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(0 < nth);
+    BSLS_ASSERT(begin <= end);
+
+    return findNthAtMinIndex(bitString, ~0ULL, nth, begin, end);
+}
+
+size_t BitStringUtil::findNth1AtMaxIndex(const uint64_t *bitString,
+                                         size_t          nth,
+                                         size_t          begin,
+                                         size_t          end)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(0 < nth);
+    BSLS_ASSERT(begin <= end);
+
+    return findNthAtMaxIndex(bitString, 0, nth, begin, end);
+}
+
+size_t BitStringUtil::findNth1AtMinIndex(const uint64_t *bitString,
+                                         size_t          nth,
+                                         size_t          begin,
+                                         size_t          end)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(0 < nth);
+    BSLS_ASSERT(begin <= end);
+
+    return findNthAtMinIndex(bitString, 0, nth, begin, end);
+}
+
 bool BitStringUtil::isAny0(const uint64_t *bitString,
                            size_t          index,
                            size_t          numBits)
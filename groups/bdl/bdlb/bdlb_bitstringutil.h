@@ -195,6 +195,14 @@ BSLS_IDENT("$Id: $")
 // +--------------------------------------------------------------------------+
 // | find1AtMinIndex | Locate the lowest-order 1 bit in a range.              |
 // +--------------------------------------------------------------------------+
+// | findNth0AtMaxIndex | Locate the n'th highest-order 0 bit in a range.     |
+// +--------------------------------------------------------------------------+
+// | findNth0AtMinIndex | Locate the n'th lowest-order 0 bit in a range.      |
+// +--------------------------------------------------------------------------+
+// | findNth1AtMaxIndex | Locate the n'th highest-order 1 bit in a range.     |
+// +--------------------------------------------------------------------------+
+// | findNth1AtMinIndex | Locate the n'th lowest-order 1 bit in a range.      |
+// +--------------------------------------------------------------------------+
 //
 //
 //                                     Count
@@ -721,6 +729,58 @@ struct BitStringUtil {
         // unless 'begin <= end' and 'end' is less than or equal to the length
         // of 'bitString'.
 
+    static bsl::size_t findNth0AtMaxIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          nth,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end);
+        // Return the index of the specified 'nth' 0 bit, counting in
+        // descending order of index from the most-significant 0 bit, in the
+        // specified 'bitString' in the specified range '[begin .. end)', if
+        // such a bit exists, and 'k_INVALID_INDEX' otherwise.  The behavior
+        // is undefined unless '0 < nth', 'begin <= end', and 'end' is less
+        // than or equal to the length of 'bitString'.  Note that
+        // 'findNth0AtMaxIndex(bitString, 1, begin, end)' returns the same
+        // value as 'find0AtMaxIndex(bitString, begin, end)'.
+
+    static bsl::size_t findNth0AtMinIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          nth,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end);
+        // Return the index of the specified 'nth' 0 bit, counting in
+        // ascending order of index from the least-significant 0 bit, in the
+        // specified 'bitString' in the specified range '[begin .. end)', if
+        // such a bit exists, and 'k_INVALID_INDEX' otherwise.  The behavior
+        // is undefined unless '0 < nth', 'begin <= end', and 'end' is less
+        // than or equal to the length of 'bitString'.  Note that
+        // 'findNth0AtMinIndex(bitString, 1, begin, end)' returns the same
+        // value as 'find0AtMinIndex(bitString, begin, end)'.
+
+    static bsl::size_t findNth1AtMaxIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          nth,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end);
+        // Return the index of the specified 'nth' 1 bit, counting in
+        // descending order of index from the most-significant 1 bit, in the
+        // specified 'bitString' in the specified range '[begin .. end)', if
+        // such a bit exists, and 'k_INVALID_INDEX' otherwise.  The behavior
+        // is undefined unless '0 < nth', 'begin <= end', and 'end' is less
+        // than or equal to the length of 'bitString'.  Note that
+        // 'findNth1AtMaxIndex(bitString, 1, begin, end)' returns the same
+        // value as 'find1AtMaxIndex(bitString, begin, end)'.
+
+    static bsl::size_t findNth1AtMinIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          nth,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end);
+        // Return the index of the specified 'nth' 1 bit, counting in
+        // ascending order of index from the least-significant 1 bit, in the
+        // specified 'bitString' in the specified range '[begin .. end)', if
+        // such a bit exists, and 'k_INVALID_INDEX' otherwise.  The behavior
+        // is undefined unless '0 < nth', 'begin <= end', and 'end' is less
+        // than or equal to the length of 'bitString'.  Note that
+        // 'findNth1AtMinIndex(bitString, 1, begin, end)' returns the same
+        // value as 'find1AtMinIndex(bitString, begin, end)'.
+
                                 // Count
 
     static bool isAny0(const bsl::uint64_t *bitString,
@@ -75,13 +75,17 @@ using bsl::flush;
 // [20] St find1AtMaxIndex(U64 *bitString, St begin, St end);
 // [22] St find1AtMinIndex(const uint64_t *bitString, St length);
 // [22] St find1AtMinIndex(U64 *bitString, St begin, St end);
+// [23] St findNth0AtMaxIndex(U64 *bitString, St nth, St begin, St end);
+// [23] St findNth0AtMinIndex(U64 *bitString, St nth, St begin, St end);
+// [23] St findNth1AtMaxIndex(U64 *bitString, St nth, St begin, St end);
+// [23] St findNth1AtMinIndex(U64 *bitString, St nth, St begin, St end);
 // [ 6] bool isAny0(const uint64_t *bitString, St index, St numBits);
 // [ 6] bool isAny1(const uint64_t *bitString, St index, St numBits);
 // [13] St num0(const uint64_t *bitString, St index, St numBits);
 // [13] St num1(const uint64_t *bitString, St index, St numBits);
 // [12] OS& print(OS& stream, U64 *bs, St nb, int lvl, int spl);
 // ----------------------------------------------------------------------------
-// [23] USAGE EXAMPLE
+// [24] USAGE EXAMPLE
 // [ 1] void populateBitString(U64 *bitString, St idx, char *ascii);
 // [ 1] void populateBitStringHex(U64 *bitString, St idx, char *ascii);
 // ----------------------------------------------------------------------------
@@ -944,6 +948,56 @@ size_t findAtMinOracle(uint64_t *bitString,
     return k_INVALID_INDEX;
 }
 
+size_t findNthAtMinOracle(uint64_t *bitString,
+                          size_t    nth,
+                          size_t    begin,
+                          size_t    end,
+                          bool      value)
+    // Return the index of the specified 'nth' lowest-order bit that matches
+    // the specified 'value' in the bit string starting at the specified
+    // 'begin' index and ending before the specified 'end' index in the
+    // specified 'bitString'.  The behavior is undefined unless '0 < nth' and
+    // 'begin <= end'.  Note that this function provides an inefficient but
+    // reliable way of implementing the 'findNth*AtMinIndex' functions for
+    // testing.
+{
+    ASSERT(0 < nth);
+    ASSERT(begin <= end);
+
+    for (size_t ii = begin; ii < end; ++ii) {
+        if (Util::bit(bitString, ii) == value && 0 == --nth) {
+            return ii;                                                // RETURN
+        }
+    }
+
+    return k_INVALID_INDEX;
+}
+
+size_t findNthAtMaxOracle(uint64_t *bitString,
+                          size_t    nth,
+                          size_t    begin,
+                          size_t    end,
+                          bool      value)
+    // Return the index of the specified 'nth' highest-order bit that matches
+    // the specified 'value' in the bit string starting at the specified
+    // 'begin' index and ending before the specified 'end' index in the
+    // specified 'bitString'.  The behavior is undefined unless '0 < nth' and
+    // 'begin <= end'.  Note that this function provides an inefficient but
+    // reliable way of implementing the 'findNth*AtMaxIndex' functions for
+    // testing.
+{
+    ASSERT(0 < nth);
+    ASSERT(begin <= end);
+
+    for (size_t ii = end; ii > begin; --ii) {
+        if (Util::bit(bitString, ii - 1) == value && 0 == --nth) {
+            return ii - 1;                                            // RETURN
+        }
+    }
+
+    return k_INVALID_INDEX;
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -961,7 +1015,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1111,6 +1165,146 @@ int main(int argc, char *argv[])
     ASSERT(false == isOffMay28);
 //..
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING 'findNth[01]At{Max,Min}Index' METHODS
+        //   Ensure the methods return the expected value.
+        //
+        // Concerns:
+        //: 1 That the 'findNth[01]At{Max,Min}Index' functions correctly return
+        //:   the index of the 'nth' bit having the appropriate value in a
+        //:   range, counting from the appropriate end of the range, or -1 if
+        //:   the range has fewer than 'nth' such bits.
+        //:
+        //: 2 That the functions work for ranges beginning and ending at any
+        //:   position within a word, and spanning any number of words.
+        //:
+        //: 3 That 'findNth[01]At{Max,Min}Index' with '1 == nth' returns the
+        //:   same value as the corresponding 'find[01]At{Max,Min}Index'.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Iterate over different test arrays with 'setUpArray'.
+        //:   o Iterate over ranges '[begin .. end)' with 'begin' and 'end'
+        //:     taken from 'IDX_TABLE'.
+        //:     1 For every 'nth' from 1 to one more than the number of bits in
+        //:       the range, compare the results of each function with those of
+        //:       'findNthAtMinOracle' and 'findNthAtMaxOracle'.  (C-1..2)
+        //:
+        //:     2 For '1 == nth', compare the results with those of the
+        //:       'find[01]At{Max,Min}Index' functions.  (C-3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-4)
+        //
+        // Testing:
+        //   St findNth0AtMaxIndex(U64 *bitString, St nth, St begin, St end);
+        //   St findNth0AtMinIndex(U64 *bitString, St nth, St begin, St end);
+        //   St findNth1AtMaxIndex(U64 *bitString, St nth, St begin, St end);
+        //   St findNth1AtMinIndex(U64 *bitString, St nth, St begin, St end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                     << "TESTING 'findNth[01]At{Max,Min}Index' METHODS\n"
+                     << "=============================================\n";
+
+        const size_t NUM_BITS = SET_UP_ARRAY_DIM * k_BITS_PER_UINT64;
+
+        uint64_t bits[SET_UP_ARRAY_DIM], control[SET_UP_ARRAY_DIM];
+
+        for (int ii = 0; ii < 150; ) {
+            setUpArray(control, &ii, true);
+            wordCpy(bits, control, sizeof(bits));
+
+            if (veryVerbose) {
+                P_(ii);    P(pHex(bits, NUM_BITS));
+            }
+
+            for (int bi = 0; bi < NUM_IDX_TABLE; ++bi) {
+                const size_t BEGIN = IDX_TABLE[bi];
+
+                for (int ei = bi; ei < NUM_IDX_TABLE; ++ei) {
+                    const size_t END = IDX_TABLE[ei];
+
+                    // Test every 'nth' near the beginning of the range, and
+                    // near the numbers of 0 and 1 bits in the range,
+                    // sparsely elsewhere.
+
+                    const size_t LEN  = END - BEGIN;
+                    const size_t NUM0 = Util::num0(bits, BEGIN, LEN);
+                    const size_t NUM1 = LEN - NUM0;
+
+                    for (size_t nth = 1; nth <= LEN + 1; ++nth) {
+                        const bool TESTED =
+                                  nth <= 8
+                               || 0 == nth % 8
+                               || (NUM0 <= nth + 1 && nth <= NUM0 + 1)
+                               || (NUM1 <= nth + 1 && nth <= NUM1 + 1);
+                        if (!TESTED) {
+                            continue;
+                        }
+
+                        ASSERTV(ii, BEGIN, END, nth,
+                                findNthAtMinOracle(bits, nth, BEGIN, END, 0)
+                           == Util::findNth0AtMinIndex(bits, nth, BEGIN, END));
+                        ASSERTV(ii, BEGIN, END, nth,
+                                findNthAtMinOracle(bits, nth, BEGIN, END, 1)
+                           == Util::findNth1AtMinIndex(bits, nth, BEGIN, END));
+                        ASSERTV(ii, BEGIN, END, nth,
+                                findNthAtMaxOracle(bits, nth, BEGIN, END, 0)
+                           == Util::findNth0AtMaxIndex(bits, nth, BEGIN, END));
+                        ASSERTV(ii, BEGIN, END, nth,
+                                findNthAtMaxOracle(bits, nth, BEGIN, END, 1)
+                           == Util::findNth1AtMaxIndex(bits, nth, BEGIN, END));
+                    }
+
+                    ASSERTV(ii, BEGIN, END,
+                            Util::find0AtMinIndex(bits, BEGIN, END) ==
+                                Util::findNth0AtMinIndex(bits, 1, BEGIN, END));
+                    ASSERTV(ii, BEGIN, END,
+                            Util::find1AtMinIndex(bits, BEGIN, END) ==
+                                Util::findNth1AtMinIndex(bits, 1, BEGIN, END));
+                    ASSERTV(ii, BEGIN, END,
+                            Util::find0AtMaxIndex(bits, BEGIN, END) ==
+                                Util::findNth0AtMaxIndex(bits, 1, BEGIN, END));
+                    ASSERTV(ii, BEGIN, END,
+                            Util::find1AtMaxIndex(bits, BEGIN, END) ==
+                                Util::findNth1AtMaxIndex(bits, 1, BEGIN, END));
+                }
+            }
+
+            ASSERT(0 == wordCmp(bits, control, sizeof(bits)));
+        }
+
+        {
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_PASS(Util::findNth0AtMinIndex(bits, 1,  0,   0));
+            ASSERT_PASS(Util::findNth0AtMinIndex(bits, 5, 10, 100));
+            ASSERT_FAIL(Util::findNth0AtMinIndex(bits, 0, 10, 100));
+            ASSERT_FAIL(Util::findNth0AtMinIndex(bits, 1, 10,   9));
+            ASSERT_FAIL(Util::findNth0AtMinIndex(   0, 1,  0,   0));
+
+            ASSERT_PASS(Util::findNth0AtMaxIndex(bits, 1,  0,   0));
+            ASSERT_PASS(Util::findNth0AtMaxIndex(bits, 5, 10, 100));
+            ASSERT_FAIL(Util::findNth0AtMaxIndex(bits, 0, 10, 100));
+            ASSERT_FAIL(Util::findNth0AtMaxIndex(bits, 1, 10,   9));
+            ASSERT_FAIL(Util::findNth0AtMaxIndex(   0, 1,  0,   0));
+
+            ASSERT_PASS(Util::findNth1AtMinIndex(bits, 1,  0,   0));
+            ASSERT_PASS(Util::findNth1AtMinIndex(bits, 5, 10, 100));
+            ASSERT_FAIL(Util::findNth1AtMinIndex(bits, 0, 10, 100));
+            ASSERT_FAIL(Util::findNth1AtMinIndex(bits, 1, 10,   9));
+            ASSERT_FAIL(Util::findNth1AtMinIndex(   0, 1,  0,   0));
+
+            ASSERT_PASS(Util::findNth1AtMaxIndex(bits, 1,  0,   0));
+            ASSERT_PASS(Util::findNth1AtMaxIndex(bits, 5, 10, 100));
+            ASSERT_FAIL(Util::findNth1AtMaxIndex(bits, 0, 10, 100));
+            ASSERT_FAIL(Util::findNth1AtMaxIndex(bits, 1, 10,   9));
+            ASSERT_FAIL(Util::findNth1AtMaxIndex(   0, 1,  0,   0));
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING 'find1AtMinIndex' METHODS
@@ -18,6 +18,20 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This 'struct' provides a variety of utilities for 'bdlbb::Blob'
 // objects, 'bdlbb::BlobUtil', such as I/O functions, comparison functions, and
 // streaming functions.
+//
+///Scatter/Gather I/O
+///-------------------
+// 'bdlbb::BlobUtil::loadDataIovecs' and 'bdlbb::BlobUtil::loadCapacityIovecs'
+// describe regions of a blob as an array of I/O vectors referring directly to
+// the blob's buffers, suitable for passing to scatter/gather system calls such
+// as POSIX 'writev' and 'readv', so that the data of a blob can be written
+// (or data can be read into the unused capacity of a blob) without first
+// copying it to or from a contiguous buffer.  The I/O vector type is a
+// template parameter that must provide the 'iov_base' and 'iov_len' members of
+// the POSIX 'struct iovec'.  After a successful read into the capacity of a
+// blob, the length of the blob should be increased by the number of bytes
+// read.  See 'bdls::FilesystemUtil::readv' and 'bdls::FilesystemUtil::writev'
+// for functions that perform such I/O on a file descriptor.
 
 #include <bdlscm_version.h>
 
@@ -45,6 +59,25 @@ struct BlobUtil {
     // This 'struct' is a namespace for a collection of static methods used
     // for manipulating and accessing 'Blob' objects.
 
+  private:
+    // PRIVATE CLASS METHODS
+    template <class IOVEC>
+    static int loadIovecs(IOVEC       *vectors,
+                          int          maxNumVectors,
+                          const Blob&  blob,
+                          int          bufferIndex,
+                          int          bufferOffset,
+                          int          length);
+        // Load into the specified 'vectors' array, having the specified
+        // 'maxNumVectors' elements, descriptions of the (at most)
+        // 'maxNumVectors' non-empty regions of the specified 'blob' that
+        // together cover the specified 'length' bytes starting at the
+        // specified 'bufferOffset' in the buffer at the specified
+        // 'bufferIndex', and return the number of elements loaded.  The
+        // behavior is undefined unless the range to be covered lies within
+        // the buffers of 'blob'.
+
+  public:
     // CLASS METHODS
     static void append(Blob *dest, const Blob& source, int offset, int length);
         // Append the specified 'length' bytes from the specified 'offset' in
@@ -186,6 +219,46 @@ struct BlobUtil {
         // bytes of the specified 'source' starting at the specified 'offset',
         // and return a reference to the modifiable 'stream'.
 
+    template <class IOVEC>
+    static int loadCapacityIovecs(IOVEC       *vectors,
+                                  int          maxNumVectors,
+                                  const Blob&  blob,
+                                  int          length);
+        // Load into the specified 'vectors' array, having the specified
+        // 'maxNumVectors' elements, I/O vectors describing the first
+        // specified 'length' bytes of the unused capacity of the specified
+        // 'blob' (i.e., the bytes starting at position 'blob.length()'), and
+        // return the number of elements loaded.  If more than 'maxNumVectors'
+        // regions are needed, only the first 'maxNumVectors' regions are
+        // loaded.  Each region lies within a single buffer of 'blob' and no
+        // empty region is loaded.  'IOVEC' must provide the 'iov_base' and
+        // 'iov_len' members of the POSIX 'struct iovec'.  The behavior is
+        // undefined unless '0 <= maxNumVectors', 'vectors' has room for
+        // 'maxNumVectors' elements, '0 <= length', and
+        // 'length <= blob.totalSize() - blob.length()'.  Note that the loaded
+        // vectors are invalidated by any change to the buffers of 'blob', and
+        // that the length of 'blob' is not modified.
+
+    template <class IOVEC>
+    static int loadDataIovecs(IOVEC       *vectors,
+                              int          maxNumVectors,
+                              const Blob&  source,
+                              int          offset,
+                              int          length);
+        // Load into the specified 'vectors' array, having the specified
+        // 'maxNumVectors' elements, I/O vectors describing the specified
+        // 'length' bytes of data starting at the specified 'offset' in the
+        // specified 'source', and return the number of elements loaded.  If
+        // more than 'maxNumVectors' regions are needed, only the first
+        // 'maxNumVectors' regions are loaded.  Each region lies within a
+        // single buffer of 'source' and no empty region is loaded.  'IOVEC'
+        // must provide the 'iov_base' and 'iov_len' members of the POSIX
+        // 'struct iovec'.  The behavior is undefined unless
+        // '0 <= maxNumVectors', 'vectors' has room for 'maxNumVectors'
+        // elements, '0 <= offset', '0 <= length', and
+        // 'offset <= source.length() - length'.  Note that the loaded vectors
+        // are invalidated by any change to the buffers of 'source'.
+
     template <class STREAM>
     static STREAM& read(STREAM& stream, Blob *dest, int numBytes);
         // Read the specified 'numBytes' from the specified 'stream' and load
@@ -291,6 +364,38 @@ bsl::ostream& operator<<(bsl::ostream& stream, const BlobUtilHexDumper& rhs);
                               // struct BlobUtil
                               // ---------------
 
+// PRIVATE CLASS METHODS
+template <class IOVEC>
+int BlobUtil::loadIovecs(IOVEC       *vectors,
+                         int          maxNumVectors,
+                         const Blob&  blob,
+                         int          bufferIndex,
+                         int          bufferOffset,
+                         int          length)
+{
+    int numVectors = 0;
+
+    while (0 < length && numVectors < maxNumVectors) {
+        BSLS_ASSERT(bufferIndex < blob.numBuffers());
+
+        const BlobBuffer& buffer = blob.buffer(bufferIndex);
+        const int         size   = bsl::min(buffer.size() - bufferOffset,
+                                            length);
+
+        if (0 < size) {
+            vectors[numVectors].iov_base = buffer.data() + bufferOffset;
+            vectors[numVectors].iov_len  = size;
+            ++numVectors;
+            length -= size;
+        }
+
+        bufferOffset = 0;
+        ++bufferIndex;
+    }
+
+    return numVectors;
+}
+
 // CLASS METHODS
 inline
 void BlobUtil::append(Blob *dest, const Blob& source, int offset)
@@ -375,6 +480,57 @@ bsl::ostream& BlobUtil::hexDump(bsl::ostream& stream, const Blob& source)
     return hexDump(stream, source, 0, source.length());
 }
 
+template <class IOVEC>
+int BlobUtil::loadCapacityIovecs(IOVEC       *vectors,
+                                 int          maxNumVectors,
+                                 const Blob&  blob,
+                                 int          length)
+{
+    BSLS_ASSERT(0 <= maxNumVectors);
+    BSLS_ASSERT(vectors || 0 == maxNumVectors);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(length <= blob.totalSize() - blob.length());
+
+    // The unused capacity starts after the data in the last data buffer, or
+    // at the first buffer if 'blob' is empty.
+
+    const int numDataBuffers = blob.numDataBuffers();
+
+    return loadIovecs(vectors,
+                      maxNumVectors,
+                      blob,
+                      numDataBuffers ? numDataBuffers - 1 : 0,
+                      numDataBuffers ? blob.lastDataBufferLength() : 0,
+                      length);
+}
+
+template <class IOVEC>
+int BlobUtil::loadDataIovecs(IOVEC       *vectors,
+                             int          maxNumVectors,
+                             const Blob&  source,
+                             int          offset,
+                             int          length)
+{
+    BSLS_ASSERT(0 <= maxNumVectors);
+    BSLS_ASSERT(vectors || 0 == maxNumVectors);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= source.length() - length);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::pair<int, int> place = findBufferIndexAndOffset(source, offset);
+
+    return loadIovecs(vectors,
+                      maxNumVectors,
+                      source,
+                      place.first,
+                      place.second,
+                      length);
+}
+
 template <class STREAM>
 STREAM& BlobUtil::read(STREAM& stream, Blob *dest, int numBytes)
 {
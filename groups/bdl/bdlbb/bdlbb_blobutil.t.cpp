@@ -51,6 +51,8 @@ using namespace bsl;  // automatically added by script
 // [ 3] Testing HexDump
 // [ 2] Testing compare
 // [ 1] Testing "write special cases"
+// [12] int loadCapacityIovecs(IOVEC *, int, const Blob&, int);
+// [12] int loadDataIovecs(IOVEC *, int, const Blob&, int, int);
 //-----------------------------------------------------------------------------
 // [11] CONCERN: append doesn't do excessive 'reserveBufferCapacity'.
 //-----------------------------------------------------------------------------
@@ -334,6 +336,56 @@ static bool bad_jk(int j, int k, bdlbb::Blob& blob)
     return (j < 0 || k < 0 || j + k > blob.totalSize());
 }
 
+struct IoVec {
+    // This 'struct' provides the members of the POSIX 'struct iovec' used by
+    // the I/O vector functions of 'bdlbb::BlobUtil', so that they can be
+    // tested on every platform.
+
+    void        *iov_base;
+    bsl::size_t  iov_len;
+};
+
+void appendBuffer(bdlbb::Blob *blob, int size, bslma::Allocator *allocator)
+    // Append to the specified 'blob' a buffer of the specified 'size' whose
+    // memory is supplied by the specified 'allocator'.
+{
+    bsl::shared_ptr<char> shptr(
+                         static_cast<char *>(allocator->allocate(size + 1)),
+                         allocator);
+    blob->appendBuffer(bdlbb::BlobBuffer(shptr, size));
+}
+
+bool vectorsAreValid(const IoVec       *vectors,
+                     int                numVectors,
+                     const bdlbb::Blob& blob)
+    // Return 'true' if each of the specified 'numVectors' elements of the
+    // specified 'vectors' array describes a non-empty region lying within a
+    // single buffer of the specified 'blob', and 'false' otherwise.
+{
+    for (int i = 0; i < numVectors; ++i) {
+        const char *begin = static_cast<const char *>(vectors[i].iov_base);
+        const char *end   = begin + vectors[i].iov_len;
+
+        if (0 == vectors[i].iov_len) {
+            return false;                                             // RETURN
+        }
+
+        bool found = false;
+        for (int j = 0; j < blob.numBuffers(); ++j) {
+            const char *data = blob.buffer(j).data();
+
+            if (data <= begin && end <= data + blob.buffer(j).size()) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -351,6 +403,236 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING I/O VECTOR FUNCTIONS
+        //
+        // Concerns:
+        //: 1 'loadDataIovecs' describes exactly the requested range of data,
+        //:   in order, referring directly to the buffers of the blob.
+        //:
+        //: 2 'loadCapacityIovecs' describes exactly the requested number of
+        //:   bytes following the data of the blob, so that, once the length
+        //:   of the blob is increased, the bytes written through the vectors
+        //:   become the data of the blob.
+        //:
+        //: 3 No empty vector is loaded, even for blobs having empty buffers or
+        //:   completely filled data buffers, and a request for 0 bytes loads
+        //:   no vector.
+        //:
+        //: 4 If 'maxNumVectors' is insufficient, the loaded vectors describe
+        //:   a prefix of the requested range.
+        //:
+        //: 5 The length and the buffers of the blob are not modified.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a blob having buffers of various sizes, including empty
+        //:   buffers, and fill it with known data.  For every valid offset
+        //:   and length, and for several values of 'maxNumVectors', load data
+        //:   vectors and verify that each is non-empty and lies in a buffer
+        //:   of the blob, and that their concatenation is the expected
+        //:   (prefix of the) data.  (C-1, 3..5)
+        //:
+        //: 2 For every blob length and every valid number of bytes, load
+        //:   capacity vectors, write a known pattern through them, increase
+        //:   the length of the blob, and verify the data of the blob.
+        //:   (C-2..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-6)
+        //
+        // Testing:
+        //   int loadCapacityIovecs(IOVEC *, int, const Blob&, int);
+        //   int loadDataIovecs(IOVEC *, int, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING I/O VECTOR FUNCTIONS"
+                          << "\n============================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        const int SIZES[]   = { 3, 0, 5, 1, 0, 0, 7, 4 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        enum { k_MAX_VECTORS = 16 };
+
+        {
+            bdlbb::Blob blob(&ta);
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                appendBuffer(&blob, SIZES[i], &ta);
+            }
+
+            const int         TOTAL = blob.totalSize();
+            const bsl::string DATA  = g(TOTAL);
+
+            copyStringToBlob(&blob, DATA);
+            ASSERT(TOTAL == blob.length());
+
+            if (verbose) cout << "\nTesting 'loadDataIovecs'." << endl;
+
+            for (int offset = 0; offset <= TOTAL; ++offset) {
+                for (int length = 0; offset + length <= TOTAL; ++length) {
+                    for (int max = 0; max <= k_MAX_VECTORS; ++max) {
+                        IoVec vectors[k_MAX_VECTORS];
+
+                        const int n = Util::loadDataIovecs(vectors,
+                                                           max,
+                                                           blob,
+                                                           offset,
+                                                           length);
+
+                        ASSERTV(offset, length, max, n, 0 <= n && n <= max);
+                        ASSERTV(offset, length, max,
+                                vectorsAreValid(vectors, n, blob));
+                        ASSERTV(offset, length, max, n,
+                                0 != length || 0 == n);
+
+                        bsl::string result;
+                        for (int i = 0; i < n; ++i) {
+                            const char *base = static_cast<const char *>(
+                                                          vectors[i].iov_base);
+
+                            result.append(base, vectors[i].iov_len);
+                        }
+
+                        ASSERTV(offset, length, max,
+                                result.size() <= static_cast<size_t>(length));
+                        ASSERTV(offset, length, max, result,
+                                DATA.substr(offset, result.size()) == result);
+
+                        if (k_MAX_VECTORS == max) {
+                            ASSERTV(offset, length,
+                                    static_cast<size_t>(length) ==
+                                                                result.size());
+                        }
+                        else if (n < max) {
+                            ASSERTV(offset, length, max,
+                                    static_cast<size_t>(length) ==
+                                                                result.size());
+                        }
+                    }
+                }
+            }
+            ASSERT(TOTAL     == blob.length());
+            ASSERT(NUM_SIZES == blob.numBuffers());
+        }
+
+        if (verbose) cout << "\nTesting 'loadCapacityIovecs'." << endl;
+        {
+            const int TOTAL = 20;  // sum of 'SIZES'
+
+            for (int length = 0; length <= TOTAL; ++length) {
+                for (int numBytes = 0; length + numBytes <= TOTAL;
+                                                                 ++numBytes) {
+                    bdlbb::Blob blob(&ta);
+
+                    for (int i = 0; i < NUM_SIZES; ++i) {
+                        appendBuffer(&blob, SIZES[i], &ta);
+                    }
+                    ASSERT(TOTAL == blob.totalSize());
+
+                    const bsl::string DATA = g(length);
+                    copyStringToBlob(&blob, DATA);
+
+                    IoVec vectors[k_MAX_VECTORS];
+
+                    const int n = Util::loadCapacityIovecs(vectors,
+                                                           k_MAX_VECTORS,
+                                                           blob,
+                                                           numBytes);
+
+                    ASSERTV(length, numBytes, n, 0 <= n);
+                    ASSERTV(length, numBytes, n, 0 != numBytes || 0 == n);
+                    ASSERTV(length, numBytes,
+                            vectorsAreValid(vectors, n, blob));
+                    ASSERTV(length, numBytes, length == blob.length());
+                    ASSERTV(length, numBytes, NUM_SIZES == blob.numBuffers());
+
+                    int covered = 0;
+                    for (int i = 0; i < n; ++i) {
+                        char *base = static_cast<char *>(vectors[i].iov_base);
+                        for (bsl::size_t j = 0; j < vectors[i].iov_len; ++j) {
+                            base[j] = static_cast<char>('0' + covered % 10);
+                            ++covered;
+                        }
+                    }
+                    ASSERTV(length, numBytes, covered, numBytes == covered);
+
+                    blob.setLength(length + numBytes);
+
+                    bsl::string result;
+                    copyBlobToString(&result, blob);
+
+                    bsl::string expected(DATA);
+                    for (int i = 0; i < numBytes; ++i) {
+                        expected.push_back(static_cast<char>('0' + i % 10));
+                    }
+
+                    ASSERTV(length, numBytes, result, expected,
+                            expected == result);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting maximum number of vectors." << endl;
+        {
+            bdlbb::Blob blob(&ta);
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                appendBuffer(&blob, SIZES[i], &ta);
+            }
+
+            IoVec vectors[k_MAX_VECTORS];
+
+            ASSERT(0 == Util::loadCapacityIovecs(vectors, 0, blob, 20));
+            ASSERT(1 == Util::loadCapacityIovecs(vectors, 1, blob, 20));
+            ASSERT(3 == vectors[0].iov_len);
+            ASSERT(2 == Util::loadCapacityIovecs(vectors, 2, blob, 20));
+            ASSERT(5 == vectors[1].iov_len);
+            ASSERT(5 == Util::loadCapacityIovecs(vectors,
+                                                 k_MAX_VECTORS,
+                                                 blob,
+                                                 20));
+
+            blob.setLength(3);  // fills the first buffer exactly
+
+            ASSERT(1 == Util::loadCapacityIovecs(vectors, 1, blob, 2));
+            ASSERT(blob.buffer(2).data() == vectors[0].iov_base);
+            ASSERT(2 == vectors[0].iov_len);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::Blob blob(&ta);
+
+            appendBuffer(&blob, 8, &ta);
+            blob.setLength(4);
+
+            IoVec vectors[k_MAX_VECTORS];
+
+            ASSERT_PASS(Util::loadDataIovecs(vectors, 1, blob, 0, 4));
+            ASSERT_PASS(Util::loadDataIovecs(vectors, 1, blob, 4, 0));
+            ASSERT_PASS(Util::loadDataIovecs((IoVec *)0, 0, blob, 0, 4));
+            ASSERT_FAIL(Util::loadDataIovecs((IoVec *)0, 1, blob, 0, 4));
+            ASSERT_FAIL(Util::loadDataIovecs(vectors, -1, blob, 0, 4));
+            ASSERT_FAIL(Util::loadDataIovecs(vectors, 1, blob, -1, 4));
+            ASSERT_FAIL(Util::loadDataIovecs(vectors, 1, blob, 0, -1));
+            ASSERT_FAIL(Util::loadDataIovecs(vectors, 1, blob, 1, 4));
+
+            ASSERT_PASS(Util::loadCapacityIovecs(vectors, 1, blob, 4));
+            ASSERT_PASS(Util::loadCapacityIovecs(vectors, 1, blob, 0));
+            ASSERT_FAIL(Util::loadCapacityIovecs((IoVec *)0, 1, blob, 4));
+            ASSERT_FAIL(Util::loadCapacityIovecs(vectors, -1, blob, 4));
+            ASSERT_FAIL(Util::loadCapacityIovecs(vectors, 1, blob, -1));
+            ASSERT_FAIL(Util::loadCapacityIovecs(vectors, 1, blob, 5));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING FIX TO DRQS 144543867
@@ -34,6 +34,7 @@
 #include <bsl_iostream.h>
 #include <bsl_string.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 #include <bsl_new.h>         // placement syntax
 
 #include <bsl_cctype.h>      // isspace, tolower
@@ -133,6 +134,10 @@ using bsl::uint64_t;
 // [28] size_t find0AtMinIndex(size_t begin, size_t end) const;
 // [27] size_t find1AtMaxIndex(size_t begin, size_t end) const;
 // [28] size_t find1AtMinIndex(size_t begin, size_t end) const;
+// [31] size_t findNth0AtMaxIndex(size_t nth, size_t begin, size_t end) const;
+// [31] size_t findNth0AtMinIndex(size_t nth, size_t begin, size_t end) const;
+// [31] size_t findNth1AtMaxIndex(size_t nth, size_t begin, size_t end) const;
+// [31] size_t findNth1AtMinIndex(size_t nth, size_t begin, size_t end) const;
 // [ 4] bool isAny0() const;
 // [ 4] bool isAny1() const;
 // [ 4] bool isEmpty() const;
@@ -156,7 +161,7 @@ using bsl::uint64_t;
 // [ 5] ostream& operator<<(ostream&, const BitArray&);
 // [ 8] void swap(BitArray& lhs, BitArray& rhs);
 //-----------------------------------------------------------------------------
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // [ 3] BitArray gDispatch(const char *spec);
 // [ 3] BitArray& gg(BitArray* object, const char *spec);
 // [ 3] BitArray& ggDispatch(BitArray* object, const char *spec);
@@ -1237,6 +1242,98 @@ void testAssignBits()
         }
 }
 
+static
+void testFindNth()
+    // Test the 'findNth[01]At{Max,Min}Index' methods.  See documentation in
+    // case 31 of the main 'switch' statement.
+{
+    const size_t LENGTHS[] = { 0, 1, 63, 64, 65, 147, 272, k_INVALID_INDEX };
+
+    size_t length;
+    for (size_t li = 0; k_INVALID_INDEX != (length = LENGTHS[li]); ++li) {
+        for (int ti = 0; ti < 4; ++ti) {
+            const bsl::string& SPEC = randSpec(length);
+            const Obj&         X = gDispatch(SPEC.c_str());
+            ASSERT(X.length() == length);
+
+            for (size_t begin = 0; begin <= length;
+                                                    incSizeT(&begin, length)) {
+                for (size_t end = begin; end <= length;
+                                                      incSizeT(&end, length)) {
+                    // Collect the positions of the 0 and 1 bits in the range.
+
+                    bsl::vector<size_t> pos0, pos1;
+                    for (size_t ii = begin; ii < end; ++ii) {
+                        (X[ii] ? pos1 : pos0).push_back(ii);
+                    }
+
+                    for (size_t nth = 1; nth <= end - begin + 1; ++nth) {
+                        const size_t EXP0_MIN = nth <= pos0.size()
+                                              ? pos0[nth - 1]
+                                              : k_INVALID_INDEX;
+                        const size_t EXP0_MAX = nth <= pos0.size()
+                                              ? pos0[pos0.size() - nth]
+                                              : k_INVALID_INDEX;
+                        const size_t EXP1_MIN = nth <= pos1.size()
+                                              ? pos1[nth - 1]
+                                              : k_INVALID_INDEX;
+                        const size_t EXP1_MAX = nth <= pos1.size()
+                                              ? pos1[pos1.size() - nth]
+                                              : k_INVALID_INDEX;
+
+                        ASSERTV(SPEC, begin, end, nth,
+                                EXP0_MIN == X.findNth0AtMinIndex(nth,
+                                                                 begin,
+                                                                 end));
+                        ASSERTV(SPEC, begin, end, nth,
+                                EXP0_MAX == X.findNth0AtMaxIndex(nth,
+                                                                 begin,
+                                                                 end));
+                        ASSERTV(SPEC, begin, end, nth,
+                                EXP1_MIN == X.findNth1AtMinIndex(nth,
+                                                                 begin,
+                                                                 end));
+                        ASSERTV(SPEC, begin, end, nth,
+                                EXP1_MAX == X.findNth1AtMaxIndex(nth,
+                                                                 begin,
+                                                                 end));
+
+                        if (length == end) {
+                            ASSERT(EXP0_MIN == X.findNth0AtMinIndex(nth,
+                                                                    begin));
+                            ASSERT(EXP1_MAX == X.findNth1AtMaxIndex(nth,
+                                                                    begin));
+
+                            if (0 == begin) {
+                                ASSERT(EXP0_MAX == X.findNth0AtMaxIndex(nth));
+                                ASSERT(EXP1_MIN == X.findNth1AtMinIndex(nth));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    {
+        Obj mX;    const Obj& X = ggDispatch(&mX, "xwa");
+
+        bsls::AssertTestHandlerGuard guard;
+
+        size_t len = X.length();
+
+        ASSERT_PASS(X.findNth0AtMinIndex(1));
+        ASSERT_PASS(X.findNth0AtMaxIndex(1, 0, len));
+        ASSERT_PASS(X.findNth1AtMinIndex(3, len / 2, len / 2));
+        ASSERT_PASS(X.findNth1AtMaxIndex(1, len, len));
+
+        ASSERT_FAIL(X.findNth0AtMinIndex(0));
+        ASSERT_FAIL(X.findNth0AtMaxIndex(1, len / 2, len / 2 - 1));
+        ASSERT_FAIL(X.findNth1AtMinIndex(1, 0, len + 1));
+        ASSERT_FAIL(X.findNth1AtMaxIndex(0, 0, len));
+    }
+}
+
 static
 void testFind1AtMinIndex()
     // Test all overloads of the 'find1AtMinIndex' methods.  See documentation
@@ -1416,7 +1513,7 @@ int main(int argc, char *argv[])
     strcat(LONG_SPEC_9, LONG_SPEC_1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1437,6 +1534,39 @@ int main(int argc, char *argv[])
 
         testUsage();
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING 'findNth[01]At{Max,Min}Index'
+        //
+        // Concerns:
+        //: 1 That the functions return the index of the 'nth' bit having the
+        //:   appropriate value in the range, counting from the appropriate end
+        //:   of the range, or 'k_INVALID_INDEX' if there is no such bit.
+        //:
+        //: 2 That the default arguments designate the whole array.
+        //:
+        //: 3 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a sequence of lengths, generate random specs, and for ranges
+        //:   of the resulting objects, compare the results of the functions,
+        //:   for every 'nth' up to one more than the length of the range,
+        //:   with the positions of bits found by walking the range.  (C-1..2)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   size_t findNth0AtMaxIndex(size_t nth, size_t begin, size_t end);
+        //   size_t findNth0AtMinIndex(size_t nth, size_t begin, size_t end);
+        //   size_t findNth1AtMaxIndex(size_t nth, size_t begin, size_t end);
+        //   size_t findNth1AtMinIndex(size_t nth, size_t begin, size_t end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'findNth[01]At{Max,Min}Index'\n"
+                               "=====================================\n";
+
+        testFindNth();
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING RANGE-BASED NUM0, NUM1
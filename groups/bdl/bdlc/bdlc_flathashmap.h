@@ -0,0 +1,896 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered map container.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressed unordered map container
+//
+//@SEE_ALSO: bdlc_flathashtable, bdlc_flathashset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashMap', an unordered associative container of key-value pairs
+// having unique keys, implemented as an open-addressed hash table in the
+// style of Abseil's 'flat_hash_map' (see 'bdlc_flathashtable').
+//
+// 'bsl::unordered_map' (implemented by 'bslstl::HashTable') allocates a node
+// for each element and chains the nodes of each bucket, so that an insertion
+// allocates memory and a lookup follows one or more pointers.
+// 'bdlc::FlatHashMap' instead stores its elements directly in a contiguous
+// array of slots, with a parallel array of one-byte "control" values holding
+// 7 bits of the hash value of each element; a lookup compares the control
+// bytes of 16 slots at a time (using SSE2 instructions where available), and
+// compares keys only for the slots whose control bytes match.  Insertions
+// allocate memory only when the table grows.
+//
+// The interface of 'bdlc::FlatHashMap' is a subset of that of
+// 'bsl::unordered_map', with the following notable differences:
+//
+//: o The 'value_type' is 'bsl::pair<KEY, VALUE>' (i.e., the key is not
+//:   'const'); modifying the key of an element through an iterator or
+//:   reference results in undefined behavior.
+//:
+//: o Inserting an element, or reserving capacity, may rehash the map, which
+//:   invalidates *all* iterators, pointers, and references to the elements of
+//:   the map.  Erasing an element invalidates only iterators, pointers, and
+//:   references to the erased element.
+//:
+//: o There are no bucket interfaces, and the maximum load factor is fixed
+//:   (at 0.875).
+//:
+//: o The map uses 'bslma::Allocator *' to supply memory.  A map created by
+//:   copy construction does not propagate the allocator of the original map,
+//:   while a map created by move construction without a specified allocator
+//:   does.  Assignment never changes the allocator of a map, and 'swap' of
+//:   maps using different allocators exchanges copies of their values.
+//
+// The keys and values of a 'bdlc::FlatHashMap' must be copy-constructible
+// and move-constructible, and 'VALUE' must be default-constructible to use
+// 'operator[]'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the number of occurrences of each word in a
+// document.  The number of distinct words is large, and each is looked up
+// often, so we use a 'bdlc::FlatHashMap' to hold the counts.
+//
+// First, we define the words of our document:
+//..
+//  const char *WORDS[] = { "the", "quick", "brown", "fox", "jumps", "over",
+//                          "the", "lazy", "dog", "the", "end" };
+//  const bsl::size_t NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//..
+// Then, we create a map from each word to its count, reserving capacity for
+// the number of words so that the map is not rehashed while it is populated:
+//..
+//  bdlc::FlatHashMap<bsl::string, int> counts;
+//  counts.reserve(NUM_WORDS);
+//..
+// Next, we count the words using 'operator[]', which inserts an element
+// having a count of 0 the first time a word is seen:
+//..
+//  for (bsl::size_t i = 0; i < NUM_WORDS; ++i) {
+//      ++counts[WORDS[i]];
+//  }
+//..
+// Finally, we verify the counts of a few of the words:
+//..
+//  assert(9 == counts.size());
+//  assert(3 == counts["the"]);
+//  assert(1 == counts["fox"]);
+//  assert(counts.contains("dog"));
+//  assert(!counts.contains("cat"));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_review.h>
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ===========================
+                        // struct FlatHashMap_EntryUtil
+                        // ===========================
+
+template <class KEY, class VALUE, class ENTRY>
+struct FlatHashMap_EntryUtil {
+    // This component-private 'struct' provides the operations required by
+    // 'FlatHashTable' on the entries of a 'FlatHashMap'.
+
+    // CLASS METHODS
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Create at the specified 'entry' address an entry having the
+        // specified 'key' and a default-constructed value, using the
+        // specified 'allocator' to supply memory.
+
+    static const KEY& key(const ENTRY& entry);
+        // Return a 'const' reference to the key of the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashMap
+                            // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template provides an open-addressed unordered map having
+    // unique keys of the (template parameter) type 'KEY', mapped to values
+    // of the (template parameter) type 'VALUE'.  See {Description}.
+
+    // PRIVATE TYPES
+    typedef bsl::pair<KEY, VALUE>                               EntryType;
+    typedef FlatHashMap_EntryUtil<KEY, VALUE, EntryType>        EntryUtil;
+    typedef FlatHashTable<KEY, EntryType, EntryUtil, HASH, EQUAL>
+                                                                ImplType;
+    typedef bslmf::MovableRefUtil                               MoveUtil;
+
+    // DATA
+    ImplType d_impl;  // underlying hash table
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                   key_type;
+    typedef VALUE                                 mapped_type;
+    typedef EntryType                             value_type;
+    typedef bsl::size_t                           size_type;
+    typedef HASH                                  hasher;
+    typedef EQUAL                                 key_equal;
+    typedef value_type&                           reference;
+    typedef const value_type&                     const_reference;
+    typedef typename ImplType::iterator           iterator;
+    typedef typename ImplType::const_iterator     const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashMap();
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    explicit FlatHashMap(bsl::size_t capacity);
+    FlatHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty map.  Optionally specify a 'capacity' indicating
+        // the number of elements the map can hold without being rehashed.  If
+        // 'capacity' is not specified, the map has no capacity (and allocates
+        // no memory).  Optionally specify a 'hash' functor used to hash keys;
+        // if 'hash' is not specified, a default-constructed 'HASH' is used.
+        // Optionally specify an 'equal' functor used to compare keys; if
+        // 'equal' is not specified, a default-constructed 'EQUAL' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a map holding the elements of the specified range
+        // '[first, last)', ignoring any element whose key is the same as that
+        // of an earlier element of the range.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '[first, last)' is a valid range of objects
+        // convertible to 'value_type'.
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a map having the same value, capacity, and functors as the
+        // specified 'original' map.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap> original);
+        // Create a map having the same value, capacity, functors, and
+        // allocator as the specified 'original' map, leaving 'original'
+        // empty and having no capacity.  No memory is allocated.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a map having the same value, capacity, and functors as the
+        // specified 'original' map, using the specified 'basicAllocator' to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  If 'original' uses the same allocator
+        // as this map, its storage is moved, and 'original' is left empty and
+        // having no capacity; otherwise the elements of 'original' are
+        // copied, and 'original' is unchanged.
+
+    //! ~FlatHashMap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashMap& operator=(const FlatHashMap& rhs);
+        // Assign to this map the value, capacity, and functors of the
+        // specified 'rhs' map, and return a reference providing modifiable
+        // access to this map.  If an exception is thrown, this map is
+        // unchanged.
+
+    FlatHashMap& operator=(bslmf::MovableRef<FlatHashMap> rhs);
+        // Assign to this map the value, capacity, and functors of the
+        // specified 'rhs' map, and return a reference providing modifiable
+        // access to this map.  If 'rhs' uses the same allocator as this map,
+        // its storage is moved, and 'rhs' is left empty and having no
+        // capacity; otherwise the elements of 'rhs' are copied, and 'rhs' is
+        // unchanged.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the value mapped
+        // to the specified 'key', first inserting an element having 'key' and
+        // a default-constructed value if this map has no element having
+        // 'key'.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the value mapped
+        // to the specified 'key'.  Throw 'bsl::out_of_range' if this map has
+        // no element having 'key'.
+
+    iterator begin();
+        // Return an iterator referring to the first element of this map, or
+        // the past-the-end iterator if this map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this map.
+
+    void clear();
+        // Remove all elements from this map.  Note that the capacity of this
+        // map is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key' from this map, if
+        // such an element exists.  Return the number of elements removed (0
+        // or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove the element referred to by the specified 'position' from
+        // this map, and return an iterator referring to the element following
+        // it, or the past-the-end iterator if there is no such element.  The
+        // behavior is undefined unless 'position' refers to an element of
+        // this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements of the specified range '[first, last)' from this
+        // map, and return 'last' as an 'iterator'.  The behavior is undefined
+        // unless '[first, last)' is a valid range of elements of this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element having the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this map if the map has
+        // no element having the key of 'value'.  Return a pair holding an
+        // iterator referring to the element having that key, and 'true' if
+        // 'value' was inserted, or 'false' otherwise.
+
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value', moved into the map, if the map has no
+        // element having the key of 'value'.  Return a pair holding an
+        // iterator referring to the element having that key, and 'true' if
+        // 'value' was inserted, or 'false' otherwise.  If 'value' is not
+        // inserted, it is unchanged.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map each element of the specified range
+        // '[first, last)' whose key is not the same as that of an element of
+        // this map or an earlier element of the range.  The behavior is
+        // undefined unless '[first, last)' is a valid range of objects
+        // convertible to 'value_type'.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Rehash this map into storage having at least the specified
+        // 'minimumCapacity' slots, and able to hold 'size()' elements without
+        // being rehashed.  If an exception is thrown, this map is left empty.
+
+    void reserve(bsl::size_t numEntries);
+        // Rehash this map, if necessary, so that it can hold the specified
+        // 'numEntries' elements without being rehashed.  If an exception is
+        // thrown, this map is left empty.
+
+    void reset();
+        // Remove all elements from this map and release its storage.
+
+    void swap(FlatHashMap& other);
+        // Exchange the value, capacity, and functors of this map with those
+        // of the specified 'other' map.  This method provides the no-throw
+        // exception-safety guarantee if the functors have no-throw swap
+        // operations.  The behavior is undefined unless this map uses the
+        // same allocator as 'other'.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a 'const' reference to the value mapped to the specified
+        // 'key'.  Throw 'bsl::out_of_range' if this map has no element having
+        // 'key'.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this map, or
+        // the past-the-end iterator if this map is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this map.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map has an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this map having the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map has no elements, and 'false' otherwise.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this map.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element having the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this map.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this map.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements to the capacity of this
+        // map, or 0 if the map has no capacity.
+
+    float max_load_factor() const;
+        // Return the ratio of slots in use or erased to the capacity of this
+        // map at which the map is rehashed (i.e., 0.875).
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps have the same
+    // value, and 'false' otherwise.  Two maps have the same value if they have
+    // the same number of elements, and for each element of 'lhs' there is an
+    // element of 'rhs' having the same key and value.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' maps.  If the maps use
+    // the same allocator this method provides the no-throw exception-safety
+    // guarantee if the functors have no-throw swap operations; otherwise each
+    // map is assigned a copy of the other's value.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // struct FlatHashMap_EntryUtil
+                        // ---------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE, class ENTRY>
+inline
+void FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::constructFromKey(
+                                                  ENTRY            *entry,
+                                                  bslma::Allocator *allocator,
+                                                  const KEY&        key)
+{
+    // The value is created using 'allocator', so that moving it into the
+    // entry does not copy it.
+
+    bsls::ObjectBuffer<VALUE> value;
+    bslma::ConstructionUtil::construct(value.address(), allocator);
+    bslma::DestructorGuard<VALUE> guard(value.address());
+
+    bslma::ConstructionUtil::construct(
+                                 entry,
+                                 allocator,
+                                 key,
+                                 bslmf::MovableRefUtil::move(value.object()));
+}
+
+template <class KEY, class VALUE, class ENTRY>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::key(const ENTRY& entry)
+{
+    return entry.first;
+}
+
+                            // -----------------
+                            // class FlatHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                            const FlatHashMap&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                       bslmf::MovableRef<FlatHashMap> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                               bslmf::MovableRef<FlatHashMap>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const FlatHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                            bslmf::MovableRef<FlatHashMap> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    return d_impl.insertKey(key).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                                "FlatHashMap<...>::at(key_type): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    return d_impl.erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    // Erasing an element does not move any other element, so 'last' remains
+    // valid.
+
+    while (first != last) {
+        first = d_impl.erase(first);
+    }
+    return iterator(last.imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                           bslmf::MovableRef<value_type> value)
+{
+    return d_impl.insert(MoveUtil::move(MoveUtil::access(value)));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+const VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                                "FlatHashMap<...>::at(key_type): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hasher();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.keyEqual();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.loadFactor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.maxLoadFactor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1115 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a container adapting 'bdlc::FlatHashTable',
+// which is tested thoroughly in its own component.  The methods of this
+// component forward to those of the table, so we verify that each method is
+// correctly forwarded, that the map-specific methods ('operator[]', 'at', and
+// the range 'erase') behave as specified, and that the map behaves as its
+// oracle ('bsl::map') for random sequences of operations.
+//
+// Negative test cases measure the performance of the map relative to
+// 'bsl::unordered_map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap();
+// [ 2] explicit FlatHashMap(bslma::Allocator *basicAllocator);
+// [ 4] explicit FlatHashMap(size_t capacity);
+// [ 4] FlatHashMap(size_t capacity, bslma::Allocator *basicAllocator);
+// [ 4] FlatHashMap(size_t, const HASH&, bslma::Allocator * = 0);
+// [ 4] FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+// [ 4] FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+// [ 4] FlatHashMap(const FlatHashMap&, bslma::Allocator * = 0);
+// [ 4] FlatHashMap(MovableRef<FlatHashMap>);
+// [ 4] FlatHashMap(MovableRef<FlatHashMap>, bslma::Allocator *);
+//
+// MANIPULATORS
+// [ 4] FlatHashMap& operator=(const FlatHashMap&);
+// [ 4] FlatHashMap& operator=(MovableRef<FlatHashMap>);
+// [ 3] VALUE& operator[](const KEY&);
+// [ 3] VALUE& at(const KEY&);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] void clear();
+// [ 2] size_t erase(const KEY&);
+// [ 5] iterator erase(const_iterator);
+// [ 5] iterator erase(iterator);
+// [ 5] iterator erase(const_iterator, const_iterator);
+// [ 2] iterator find(const KEY&);
+// [ 2] pair<iterator, bool> insert(const value_type&);
+// [ 4] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 4] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 2] void rehash(size_t);
+// [ 2] void reserve(size_t);
+// [ 2] void reset();
+// [ 4] void swap(FlatHashMap&);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY&) const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 4] HASH hash_function() const;
+// [ 4] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const FlatHashMap&, const FlatHashMap&);
+// [ 6] bool operator!=(const FlatHashMap&, const FlatHashMap&);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatHashMap&, FlatHashMap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: INSERT, FIND, AND ERASE
+// [-2] PERFORMANCE: FIND AT VARIOUS LOAD FACTORS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bdlc::FlatHashMap<int, int>                 IntMap;
+typedef bdlc::FlatHashMap<bsl::string, bsl::string> StringMap;
+
+struct ModuloHash {
+    // This hash functor hashes an 'int' modulo its configured divisor.
+
+    int d_divisor;
+
+    explicit ModuloHash(int divisor = 1000) : d_divisor(divisor)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key % d_divisor);
+    }
+};
+
+struct ModuloEqual {
+    // This functor compares two 'int' keys for equality modulo its configured
+    // divisor.
+
+    int d_divisor;
+
+    explicit ModuloEqual(int divisor = 1000) : d_divisor(divisor)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs % d_divisor == rhs % d_divisor;
+    }
+};
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *seed)
+    // Return the next value of the pseudo-random sequence having the
+    // specified 'seed', and update 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (*seed >> 16) & 0x7FFF;
+}
+
+static bool matchesOracle(const IntMap& map, const bsl::map<int, int>& oracle)
+    // Return 'true' if the specified 'map' has the same elements as the
+    // specified 'oracle', and 'false' otherwise.
+{
+    if (map.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t count = 0;
+    for (IntMap::const_iterator it = map.cbegin(); it != map.cend(); ++it) {
+        bsl::map<int, int>::const_iterator oit = oracle.find(it->first);
+        if (oit == oracle.end() || oit->second != it->second) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+    return count == oracle.size();
+}
+
+static int benchmarkKey(bsl::size_t index)
+    // Return the key of the specified 'index' for the benchmarks.  Distinct
+    // indices (less than 2^31) yield distinct keys.
+{
+    return static_cast<int>((index * 2654435761u) & 0x7FFFFFFF);
+}
+
+template <class MAP>
+static void benchmarkOperations(double      *insertTime,
+                                double      *findTime,
+                                double      *eraseTime,
+                                bsl::size_t  numElements,
+                                bsl::size_t  numIterations)
+    // Load into the specified 'insertTime', 'findTime', and 'eraseTime' the
+    // average time, in nanoseconds, per element of inserting, finding, and
+    // erasing the specified 'numElements' elements in a map of the (template
+    // parameter) type 'MAP', measured over the specified 'numIterations'.
+    // The elements are found and erased in a different order than they are
+    // inserted, so that the measurements do not favor a map whose memory
+    // layout follows the insertion order.  The behavior is undefined unless
+    // 'numElements' is a power of two.
+{
+    bsls::Stopwatch insertTimer;
+    bsls::Stopwatch findTimer;
+    bsls::Stopwatch eraseTimer;
+
+    bsl::size_t found = 0;
+    for (bsl::size_t iteration = 0; iteration < numIterations; ++iteration) {
+        MAP map;
+
+        insertTimer.start();
+        for (bsl::size_t i = 0; i < numElements; ++i) {
+            map.insert(typename MAP::value_type(benchmarkKey(i),
+                                                static_cast<int>(i)));
+        }
+        insertTimer.stop();
+
+        findTimer.start();
+        for (bsl::size_t i = 0; i < numElements; ++i) {
+            const bsl::size_t j = (i * 40503) & (numElements - 1);
+
+            found += map.find(benchmarkKey(j)) != map.end();
+            found += map.find(benchmarkKey(j + numElements)) != map.end();
+        }
+        findTimer.stop();
+
+        eraseTimer.start();
+        for (bsl::size_t i = 0; i < numElements; ++i) {
+            map.erase(benchmarkKey((i * 40503) & (numElements - 1)));
+        }
+        eraseTimer.stop();
+    }
+    ASSERTV(found, numElements * numIterations == found);
+
+    const double SCALE = 1e9
+                       / static_cast<double>(numElements * numIterations);
+
+    *insertTime = insertTimer.accumulatedWallTime() * SCALE;
+    *findTime   = findTimer.accumulatedWallTime()   * SCALE / 2;
+    *eraseTime  = eraseTimer.accumulatedWallTime()  * SCALE;
+}
+
+template <class MAP>
+static double benchmarkFind(MAP *map, bsl::size_t numElements)
+    // Insert the specified 'numElements' elements into the specified 'map',
+    // and return the average time, in nanoseconds, of a successful or
+    // unsuccessful 'find' of a pseudo-randomly chosen key.
+{
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        map->insert(typename MAP::value_type(benchmarkKey(i),
+                                             static_cast<int>(i)));
+    }
+
+    const bsl::size_t NUM_FINDS = 1 << 22;
+
+    bsls::Stopwatch timer;
+    bsl::size_t     found = 0;
+
+    timer.start();
+    for (bsl::size_t i = 0; i < NUM_FINDS; ++i) {
+        const bsl::size_t j = (i * 2654435761u) % (2 * numElements);
+
+        found += map->find(benchmarkKey(j)) != map->end();
+    }
+    timer.stop();
+
+    ASSERTV(found, 0 < found);
+
+    return timer.accumulatedWallTime() * 1e9 / NUM_FINDS;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the number of occurrences of each word in a
+// document.  The number of distinct words is large, and each is looked up
+// often, so we use a 'bdlc::FlatHashMap' to hold the counts.
+//
+// First, we define the words of our document:
+//..
+    const char *WORDS[] = { "the", "quick", "brown", "fox", "jumps", "over",
+                            "the", "lazy", "dog", "the", "end" };
+    const bsl::size_t NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//..
+// Then, we create a map from each word to its count, reserving capacity for
+// the number of words so that the map is not rehashed while it is populated:
+//..
+    bdlc::FlatHashMap<bsl::string, int> counts;
+    counts.reserve(NUM_WORDS);
+//..
+// Next, we count the words using 'operator[]', which inserts an element
+// having a count of 0 the first time a word is seen:
+//..
+    for (bsl::size_t i = 0; i < NUM_WORDS; ++i) {
+        ++counts[WORDS[i]];
+    }
+//..
+// Finally, we verify the counts of a few of the words:
+//..
+    ASSERT(9 == counts.size());
+    ASSERT(3 == counts["the"]);
+    ASSERT(1 == counts["fox"]);
+    ASSERT(counts.contains("dog"));
+    ASSERT(!counts.contains("cat"));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EQUALITY-COMPARISON OPERATORS
+        //
+        // Concerns:
+        //: 1 Two maps are equal if, and only if, they have the same number of
+        //:   elements, and each element of one has an equal element in the
+        //:   other.
+        //:
+        //: 2 Equality does not depend on capacity or insertion order.
+        //
+        // Plan:
+        //: 1 Compare maps built in different orders and having different
+        //:   capacities, and maps differing in a key or in a value.  (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const FlatHashMap&, const FlatHashMap&);
+        //   bool operator!=(const FlatHashMap&, const FlatHashMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EQUALITY-COMPARISON OPERATORS" << endl
+                          << "=============================" << endl;
+
+        bslma::TestAllocator ta("map", veryVeryVeryVerbose);
+
+        IntMap mX(&ta);        const IntMap& X = mX;
+        IntMap mY(1000, &ta);  const IntMap& Y = mY;
+
+        ASSERT(X == Y);
+        ASSERT(!(X != Y));
+
+        for (int i = 0; i < 100; ++i) {
+            mX[i] = i * i;
+        }
+        for (int i = 99; i >= 0; --i) {
+            mY[i] = i * i;
+        }
+        ASSERT(X == Y);
+        ASSERT(!(X != Y));
+        ASSERT(X.capacity() != Y.capacity());
+
+        mY[50] = 0;
+        ASSERT(X != Y);
+        ASSERT(!(X == Y));
+
+        mY[50] = 2500;
+        ASSERT(X == Y);
+
+        mY.erase(99);
+        mY[100] = 99 * 99;
+        ASSERT(X != Y);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERASING BY POSITION
+        //
+        // Concerns:
+        //: 1 Erasing an element by iterator returns an iterator to the next
+        //:   element, and does not invalidate iterators to other elements.
+        //:
+        //: 2 Erasing a range erases exactly the elements of the range, and
+        //:   returns 'last'.
+        //
+        // Plan:
+        //: 1 Erase elements selected during iteration, and verify the
+        //:   elements remaining.  (C-1)
+        //:
+        //: 2 Erase ranges of elements, and verify the elements remaining.
+        //:   (C-2)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERASING BY POSITION" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("map", veryVeryVeryVerbose);
+
+        IntMap mX(&ta);  const IntMap& X = mX;
+        for (int i = 0; i < 300; ++i) {
+            mX[i] = i;
+        }
+
+        for (IntMap::iterator it = mX.begin(); it != mX.end();) {
+            if (0 == it->first % 3) {
+                it = mX.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        ASSERT(200 == X.size());
+        for (int i = 0; i < 300; ++i) {
+            ASSERTV(i, (0 != i % 3) == X.contains(i));
+        }
+
+        IntMap::const_iterator first = X.begin();
+        IntMap::const_iterator last  = first;
+        bsl::vector<int>       erased;
+        for (int i = 0; i < 50; ++i, ++last) {
+            erased.push_back(last->first);
+        }
+
+        IntMap::iterator result = mX.erase(first, last);
+        ASSERT(last == result);
+        ASSERT(150  == X.size());
+        for (bsl::size_t i = 0; i < erased.size(); ++i) {
+            ASSERTV(i, !X.contains(erased[i]));
+        }
+
+        result = mX.erase(X.begin(), X.begin());
+        ASSERT(X.begin() == result);
+        ASSERT(150 == X.size());
+
+        result = mX.erase(X.begin(), X.end());
+        ASSERT(X.end() == result);
+        ASSERT(X.empty());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map having the specified capacity,
+        //:   functors, elements, and allocator.
+        //:
+        //: 2 Copy, move, assignment, and swap forward to the table, and
+        //:   propagate the allocator as documented.
+        //:
+        //: 3 'insert' of a movable element and of a range forward to the
+        //:   table.
+        //
+        // Plan:
+        //: 1 Create maps using each constructor, and verify their state.
+        //:   (C-1)
+        //:
+        //: 2 Copy, move, assign, and swap maps using the same and different
+        //:   allocators, and verify their values and allocators.  (C-2)
+        //:
+        //: 3 Insert a movable element and a range, and verify the elements.
+        //:   (C-3)
+        //
+        // Testing:
+        //   explicit FlatHashMap(size_t capacity);
+        //   FlatHashMap(size_t capacity, bslma::Allocator *basicAllocator);
+        //   FlatHashMap(size_t, const HASH&, bslma::Allocator * = 0);
+        //   FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+        //   FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+        //   FlatHashMap(const FlatHashMap&, bslma::Allocator * = 0);
+        //   FlatHashMap(MovableRef<FlatHashMap>);
+        //   FlatHashMap(MovableRef<FlatHashMap>, bslma::Allocator *);
+        //   FlatHashMap& operator=(const FlatHashMap&);
+        //   FlatHashMap& operator=(MovableRef<FlatHashMap>);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void swap(FlatHashMap&);
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   void swap(FlatHashMap&, FlatHashMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, ASSIGNMENT, AND SWAP" << endl
+                          << "==============================" << endl;
+
+        typedef bslmf::MovableRefUtil                           MoveUtil;
+        typedef bdlc::FlatHashMap<int, int, ModuloHash, ModuloEqual>
+                                                                ModuloMap;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         ta("a", veryVeryVeryVerbose);
+        bslma::TestAllocator         tb("b", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const char *LONG = "a string long enough to allocate memory";
+
+        if (verbose) cout << "\tCapacity and functor constructors." << endl;
+        {
+            const IntMap X(100);
+            ASSERT(128 == X.capacity());
+            ASSERT(&da == X.allocator());
+
+            const IntMap Y(100, &ta);
+            ASSERT(128 == Y.capacity());
+            ASSERT(&ta == Y.allocator());
+
+            const ModuloMap Z(10, ModuloHash(7), &ta);
+            ASSERT(16  == Z.capacity());
+            ASSERT(7   == Z.hash_function().d_divisor);
+            ASSERT(&ta == Z.allocator());
+
+            ModuloMap mW(0, ModuloHash(5), ModuloEqual(5), &tb);
+            const ModuloMap& W = mW;
+            ASSERT(0   == W.capacity());
+            ASSERT(5   == W.hash_function().d_divisor);
+            ASSERT(5   == W.key_eq().d_divisor);
+            ASSERT(&tb == W.allocator());
+
+            mW[1] = 1;
+            ASSERT(W.contains(6));
+            ASSERT(1 == W.at(11));
+        }
+
+        if (verbose) cout << "\tRange constructor and insert." << endl;
+        {
+            bsl::vector<bsl::pair<int, int> > values;
+            for (int i = 0; i < 100; ++i) {
+                values.push_back(bsl::make_pair(i % 60, i));
+            }
+
+            const IntMap X(values.begin(), values.end(), &ta);
+            ASSERT(60  == X.size());
+            ASSERT(&ta == X.allocator());
+            for (int i = 0; i < 60; ++i) {
+                ASSERTV(i, i == X.at(i));
+            }
+
+            IntMap mY(&ta);  const IntMap& Y = mY;
+            mY[0] = -1;
+            mY.insert(values.begin(), values.end());
+            ASSERT(60 == Y.size());
+            ASSERT(-1 == Y.at(0));
+            ASSERT(1  == Y.at(1));
+        }
+
+        StringMap mX(&ta);  const StringMap& X = mX;
+        for (int i = 0; i < 50; ++i) {
+            mX[bsl::string(LONG) + static_cast<char>('A' + i)] = LONG;
+        }
+
+        if (verbose) cout << "\tCopy and move construction." << endl;
+        {
+            const StringMap Y(X, &tb);
+            ASSERT(X   == Y);
+            ASSERT(&tb == Y.allocator());
+
+            StringMap mZ(X, &ta);  const StringMap& Z = mZ;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            StringMap mW(MoveUtil::move(mZ));  const StringMap& W = mW;
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(X   == W);
+            ASSERT(&ta == W.allocator());
+            ASSERT(Z.empty());
+
+            const StringMap V(MoveUtil::move(mW), &tb);
+            ASSERT(X   == V);
+            ASSERT(X   == W);
+            ASSERT(&tb == V.allocator());
+        }
+        ASSERT(0 == tb.numBytesInUse());
+
+        if (verbose) cout << "\tAssignment and swap." << endl;
+        {
+            StringMap mY(&tb);  const StringMap& Y = mY;
+            mY["key"] = "value";
+
+            mY = X;
+            ASSERT(X   == Y);
+            ASSERT(&tb == Y.allocator());
+
+            StringMap mZ(&tb);  const StringMap& Z = mZ;
+            mZ = MoveUtil::move(mY);
+            ASSERT(X == Z);
+
+            StringMap mW(&ta);  const StringMap& W = mW;
+            mW["key"] = "value";
+
+            swap(mW, mZ);
+            ASSERT(X   == W);
+            ASSERT(1   == Z.size());
+            ASSERT(&ta == W.allocator());
+            ASSERT(&tb == Z.allocator());
+
+            StringMap mV(&ta);  const StringMap& V = mV;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            mV.swap(mW);
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(X == V);
+            ASSERT(W.empty());
+        }
+
+        if (verbose) cout << "\tInserting a movable element." << endl;
+        {
+            StringMap::value_type value(bsl::string("new key", &ta),
+                                        bsl::string(LONG, &ta));
+
+            bsl::pair<StringMap::iterator, bool> result =
+                                              mX.insert(MoveUtil::move(value));
+            ASSERT(result.second);
+            ASSERT("new key" == result.first->first);
+            ASSERT(LONG      == result.first->second);
+            ASSERT(51        == X.size());
+        }
+        ASSERT(0 == da.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the value of the element
+        //:   having the key, inserting an element having a default-constructed
+        //:   value if none exists.
+        //:
+        //: 2 'at' returns a reference to the value of the element having the
+        //:   key, and throws 'bsl::out_of_range' if none exists, leaving the
+        //:   map unchanged.
+        //:
+        //: 3 A value inserted by 'operator[]' uses the allocator of the map.
+        //
+        // Plan:
+        //: 1 Access elements of a map using 'operator[]' and 'at', and verify
+        //:   the results.  (C-1..3)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY&);
+        //   VALUE& at(const KEY&);
+        //   const VALUE& at(const KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ELEMENT ACCESS" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         ta("map", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        StringMap mX(&ta);  const StringMap& X = mX;
+
+        const bsl::string KEY("a key long enough to allocate memory", &ta);
+
+        bsl::string& value = mX[KEY];
+        ASSERT(1   == X.size());
+        ASSERT(""  == value);
+        ASSERT(&ta == value.get_allocator().mechanism());
+
+        value = "a value long enough to allocate memory";
+        ASSERT(value == mX[KEY]);
+        ASSERT(value == mX.at(KEY));
+        ASSERT(value == X.at(KEY));
+        ASSERT(1     == X.size());
+
+        mX.at(KEY) = "changed";
+        ASSERT("changed" == X.at(KEY));
+
+        const bsl::string OTHER("another key long enough to allocate", &ta);
+
+        bool caught = false;
+        try {
+            mX.at(OTHER);
+        }
+        catch (const bsl::out_of_range&) {
+            caught = true;
+        }
+        ASSERT(caught);
+        ASSERT(1 == X.size());
+
+        caught = false;
+        try {
+            X.at(OTHER);
+        }
+        catch (const bsl::out_of_range&) {
+            caught = true;
+        }
+        ASSERT(caught);
+
+        ASSERT(0 == da.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The manipulators and accessors forward to the table, so that the
+        //:   map behaves as its oracle for any sequence of operations.
+        //:
+        //: 2 The capacity methods forward to the table.
+        //:
+        //: 3 All memory is supplied by the map's allocator.
+        //
+        // Plan:
+        //: 1 Apply a random sequence of insertions, erasures, and lookups to a
+        //:   map and to an oracle ('bsl::map'), verifying they agree.  (C-1)
+        //:
+        //: 2 Invoke each capacity method, and verify the capacity.  (C-2)
+        //:
+        //: 3 Use a test allocator, and verify the default allocator is not
+        //:   used.  (C-3)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   explicit FlatHashMap(bslma::Allocator *basicAllocator);
+        //   iterator begin();
+        //   iterator end();
+        //   void clear();
+        //   size_t erase(const KEY&);
+        //   iterator find(const KEY&);
+        //   pair<iterator, bool> insert(const value_type&);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_iterator find(const KEY&) const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                        << "========================================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         ta("map", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            const IntMap X;
+            ASSERT(&da == X.allocator());
+            ASSERT(0   == X.capacity());
+            ASSERT(0   == da.numAllocations());
+        }
+
+        if (verbose) cout << "\tRandom operations." << endl;
+        {
+            IntMap mX(&ta);  const IntMap& X = mX;
+            ASSERT(&ta == X.allocator());
+
+            bslma::TestAllocator oa("oracle", veryVeryVeryVerbose);
+
+            bsl::map<int, int> oracle(&oa);
+            unsigned int       seed = 1;
+
+            for (int i = 0; i < 50000; ++i) {
+                const int key = static_cast<int>(nextRandom(&seed) % 2000);
+                const int op  = static_cast<int>(nextRandom(&seed) % 4);
+
+                switch (op) {
+                  case 0:
+                  case 1: {
+                    const bool EXP = oracle.insert(bsl::make_pair(key, i))
+                                                                       .second;
+                    const bsl::pair<IntMap::iterator, bool> RESULT =
+                                          mX.insert(bsl::make_pair(key, i));
+                    ASSERTV(i, EXP == RESULT.second);
+                    ASSERTV(i, key == RESULT.first->first);
+                    ASSERTV(i, oracle[key] == RESULT.first->second);
+                  } break;
+                  case 2: {
+                    ASSERTV(i, oracle.erase(key) == mX.erase(key));
+                  } break;
+                  default: {
+                    IntMap::iterator it = mX.find(key);
+                    ASSERTV(i, (it != mX.end()) == (0 != oracle.count(key)));
+                    if (it != mX.end()) {
+                        it->second = -i;
+                        oracle[key] = -i;
+                    }
+                  }
+                }
+
+                ASSERTV(i, oracle.size()     == X.size());
+                ASSERTV(i, oracle.count(key) == X.count(key));
+                ASSERTV(i, oracle.empty()    == X.empty());
+                ASSERTV(i, (0 != oracle.count(key)) == X.contains(key));
+
+                if (0 == i % 1000) {
+                    ASSERTV(i, matchesOracle(X, oracle));
+                }
+            }
+            ASSERT(matchesOracle(X, oracle));
+
+            bsl::size_t count = 0;
+            for (IntMap::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ++count;
+            }
+            ASSERT(oracle.size() == count);
+        }
+
+        if (verbose) cout << "\tCapacity." << endl;
+        {
+            IntMap mX(&ta);  const IntMap& X = mX;
+
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0.0f   == X.load_factor());
+
+            mX.reserve(100);
+            ASSERT(128 == X.capacity());
+
+            for (int i = 0; i < 100; ++i) {
+                mX[i] = i;
+            }
+            ASSERT(128 == X.capacity());
+            ASSERT(100.0f / 128.0f == X.load_factor());
+
+            mX.rehash(1024);
+            ASSERT(1024 == X.capacity());
+            ASSERT(100  == X.size());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(1024 == X.capacity());
+            ASSERT(X.cbegin() == X.cend());
+
+            mX.reset();
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBytesInUse());
+        }
+        ASSERT(0 == da.numAllocations());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, modify, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("map", veryVeryVeryVerbose);
+        {
+            StringMap mX(&ta);  const StringMap& X = mX;
+
+            ASSERT(X.empty());
+
+            mX["one"] = "1";
+            mX["two"] = "2";
+            ASSERT(mX.insert(bsl::make_pair(bsl::string("three"),
+                                            bsl::string("3"))).second);
+            ASSERT(!mX.insert(bsl::make_pair(bsl::string("one"),
+                                             bsl::string("uno"))).second);
+
+            ASSERT(3   == X.size());
+            ASSERT("1" == X.at("one"));
+            ASSERT("2" == X.find("two")->second);
+            ASSERT(X.end() == X.find("four"));
+
+            ASSERT(1 == mX.erase("two"));
+            ASSERT(!X.contains("two"));
+            ASSERT(2 == X.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: INSERT, FIND, AND ERASE
+        //
+        // Concerns:
+        //: 1 Inserting, finding, and erasing elements is faster than using
+        //:   'bsl::unordered_map', at all sizes.
+        //
+        // Plan:
+        //: 1 For a range of sizes, time inserting, finding (with equal
+        //:   numbers of successful and unsuccessful searches), and erasing
+        //:   elements of each map, repeating each measurement so that the
+        //:   same total number of operations is timed for each size, and
+        //:   report the average time per operation.
+        //
+        // Testing:
+        //   PERFORMANCE: INSERT, FIND, AND ERASE
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: INSERT, FIND, AND ERASE" << endl
+             << "====================================" << endl;
+
+        typedef bdlc::FlatHashMap<int, int>   FlatMap;
+        typedef bsl::unordered_map<int, int>  NodeMap;
+
+        const bsl::size_t SIZES[]   = { 16, 1024, 65536, 1024 * 1024 };
+        const int         NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+        const bsl::size_t TOTAL     = 4 * 1024 * 1024;
+
+        cout << "times in ns/operation" << endl
+             << setw(10) << "size"
+             << setw(12) << "flat ins" << setw(12) << "node ins"
+             << setw(12) << "flat find" << setw(12) << "node find"
+             << setw(12) << "flat erase" << setw(12) << "node erase"
+             << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const bsl::size_t SIZE       = SIZES[ti];
+            const bsl::size_t ITERATIONS = TOTAL / SIZE;
+
+            double flatInsert, flatFind, flatErase;
+            double nodeInsert, nodeFind, nodeErase;
+
+            benchmarkOperations<FlatMap>(&flatInsert,
+                                         &flatFind,
+                                         &flatErase,
+                                         SIZE,
+                                         ITERATIONS);
+            benchmarkOperations<NodeMap>(&nodeInsert,
+                                         &nodeFind,
+                                         &nodeErase,
+                                         SIZE,
+                                         ITERATIONS);
+
+            cout << fixed << setprecision(1)
+                 << setw(10) << SIZE
+                 << setw(12) << flatInsert << setw(12) << nodeInsert
+                 << setw(12) << flatFind   << setw(12) << nodeFind
+                 << setw(12) << flatErase  << setw(12) << nodeErase
+                 << endl;
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FIND AT VARIOUS LOAD FACTORS
+        //
+        // Concerns:
+        //: 1 The time to find an element does not degrade significantly as
+        //:   the map approaches its maximum load factor.
+        //
+        // Plan:
+        //: 1 Fill maps having a fixed capacity of 2^20 slots to various load
+        //:   factors up to the maximum, and time an equal number of
+        //:   successful and unsuccessful searches, comparing with a
+        //:   'bsl::unordered_map' holding the same elements.
+        //
+        // Testing:
+        //   PERFORMANCE: FIND AT VARIOUS LOAD FACTORS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: FIND AT VARIOUS LOAD FACTORS" << endl
+             << "=========================================" << endl;
+
+        typedef bdlc::FlatHashMap<int, int>   FlatMap;
+        typedef bsl::unordered_map<int, int>  NodeMap;
+
+        const bsl::size_t CAPACITY       = 1024 * 1024;
+        const double      LOAD_FACTORS[] = { 0.25, 0.5, 0.75, 0.875 };
+        const int         NUM_LOAD_FACTORS =
+                                   sizeof LOAD_FACTORS / sizeof *LOAD_FACTORS;
+
+        cout << "times in ns/find" << endl
+             << setw(12) << "load factor"
+             << setw(12) << "elements"
+             << setw(12) << "flat find"
+             << setw(12) << "node find"
+             << endl;
+
+        for (int ti = 0; ti < NUM_LOAD_FACTORS; ++ti) {
+            const bsl::size_t NUM_ELEMENTS = static_cast<bsl::size_t>(
+                                     LOAD_FACTORS[ti] * (double)CAPACITY);
+
+            FlatMap flatMap;
+            flatMap.rehash(CAPACITY);
+
+            NodeMap nodeMap;
+            nodeMap.reserve(NUM_ELEMENTS);
+
+            const double flatFind = benchmarkFind(&flatMap, NUM_ELEMENTS);
+            const double nodeFind = benchmarkFind(&nodeMap, NUM_ELEMENTS);
+
+            ASSERTV(ti, CAPACITY == flatMap.capacity());
+
+            cout << fixed << setprecision(3)
+                 << setw(12) << flatMap.load_factor()
+                 << setw(12) << NUM_ELEMENTS
+                 << setprecision(1)
+                 << setw(12) << flatFind
+                 << setw(12) << nodeFind
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
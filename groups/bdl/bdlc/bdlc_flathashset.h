@@ -0,0 +1,759 @@
+// bdlc_flathashset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHSET
+#define INCLUDED_BDLC_FLATHASHSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered set container.
+//
+//@CLASSES:
+//  bdlc::FlatHashSet: open-addressed unordered set container
+//
+//@SEE_ALSO: bdlc_flathashtable, bdlc_flathashmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashSet', an unordered associative container of unique keys,
+// implemented as an open-addressed hash table in the style of Abseil's
+// 'flat_hash_set' (see 'bdlc_flathashtable').  The elements of the set are
+// stored directly in a contiguous array of slots, rather than in a node per
+// element as for 'bsl::unordered_set', so that insertions allocate memory
+// only when the table grows, and lookups do not follow pointers.
+//
+// The interface of 'bdlc::FlatHashSet' is a subset of that of
+// 'bsl::unordered_set', with the following notable differences:
+//
+//: o Inserting an element, or reserving capacity, may rehash the set, which
+//:   invalidates *all* iterators, pointers, and references to the elements of
+//:   the set.  Erasing an element invalidates only iterators, pointers, and
+//:   references to the erased element.
+//:
+//: o There are no bucket interfaces, and the maximum load factor is fixed
+//:   (at 0.875).
+//:
+//: o The set uses 'bslma::Allocator *' to supply memory.  A set created by
+//:   copy construction does not propagate the allocator of the original set,
+//:   while a set created by move construction without a specified allocator
+//:   does.  Assignment never changes the allocator of a set, and 'swap' of
+//:   sets using different allocators exchanges copies of their values.
+//
+// See 'bdlc_flathashmap' for a comparison with 'bsl::unordered_map' that
+// applies equally to this component.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+/// - - - - - - - - - - - - - - -
+// Suppose we want to process a sequence of request identifiers, ignoring any
+// identifier that has already been processed.
+//
+// First, we define the identifiers:
+//..
+//  const int IDS[] = { 17, 3, 17, 42, 3, 8, 42, 17 };
+//  const bsl::size_t NUM_IDS = sizeof IDS / sizeof *IDS;
+//..
+// Then, we create a set to hold the identifiers already processed:
+//..
+//  bdlc::FlatHashSet<int> processed;
+//..
+// Next, we process each identifier that is successfully inserted into the
+// set (here, processing simply counts the identifiers):
+//..
+//  int numProcessed = 0;
+//  for (bsl::size_t i = 0; i < NUM_IDS; ++i) {
+//      if (processed.insert(IDS[i]).second) {
+//          ++numProcessed;
+//      }
+//  }
+//..
+// Finally, we verify that each distinct identifier was processed once:
+//..
+//  assert(4 == numProcessed);
+//  assert(4 == processed.size());
+//  assert(processed.contains(42));
+//  assert(!processed.contains(5));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ===========================
+                        // struct FlatHashSet_EntryUtil
+                        // ===========================
+
+template <class ENTRY>
+struct FlatHashSet_EntryUtil {
+    // This component-private 'struct' provides the operations required by
+    // 'FlatHashTable' on the entries of a 'FlatHashSet'.
+
+    // CLASS METHODS
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const ENTRY&      key);
+        // Create at the specified 'entry' address a copy of the specified
+        // 'key', using the specified 'allocator' to supply memory.
+
+    static const ENTRY& key(const ENTRY& entry);
+        // Return the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashSet
+                            // =================
+
+template <class KEY,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashSet {
+    // This class template provides an open-addressed unordered set of unique
+    // keys of the (template parameter) type 'KEY'.  See {Description}.
+
+    // PRIVATE TYPES
+    typedef FlatHashSet_EntryUtil<KEY>                        EntryUtil;
+    typedef FlatHashTable<KEY, KEY, EntryUtil, HASH, EQUAL>   ImplType;
+    typedef bslmf::MovableRefUtil                             MoveUtil;
+
+    // DATA
+    ImplType d_impl;  // underlying hash table
+
+    // FRIENDS
+    template <class K, class H, class E>
+    friend bool operator==(const FlatHashSet<K, H, E>&,
+                           const FlatHashSet<K, H, E>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                   key_type;
+    typedef KEY                                   value_type;
+    typedef bsl::size_t                           size_type;
+    typedef HASH                                  hasher;
+    typedef EQUAL                                 key_equal;
+    typedef const value_type&                     reference;
+    typedef const value_type&                     const_reference;
+    typedef typename ImplType::const_iterator     iterator;
+    typedef typename ImplType::const_iterator     const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashSet, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashSet();
+    explicit FlatHashSet(bslma::Allocator *basicAllocator);
+    explicit FlatHashSet(bsl::size_t capacity);
+    FlatHashSet(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty set.  Optionally specify a 'capacity' indicating
+        // the number of elements the set can hold without being rehashed.  If
+        // 'capacity' is not specified, the set has no capacity (and allocates
+        // no memory).  Optionally specify a 'hash' functor used to hash keys;
+        // if 'hash' is not specified, a default-constructed 'HASH' is used.
+        // Optionally specify an 'equal' functor used to compare keys; if
+        // 'equal' is not specified, a default-constructed 'EQUAL' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a set holding the distinct elements of the specified range
+        // '[first, last)'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '[first, last)' is a valid range of objects convertible to 'KEY'.
+
+    FlatHashSet(const FlatHashSet&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a set having the same value, capacity, and functors as the
+        // specified 'original' set.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    FlatHashSet(bslmf::MovableRef<FlatHashSet> original);
+        // Create a set having the same value, capacity, functors, and
+        // allocator as the specified 'original' set, leaving 'original'
+        // empty and having no capacity.  No memory is allocated.
+
+    FlatHashSet(bslmf::MovableRef<FlatHashSet>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a set having the same value, capacity, and functors as the
+        // specified 'original' set, using the specified 'basicAllocator' to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  If 'original' uses the same allocator
+        // as this set, its storage is moved, and 'original' is left empty and
+        // having no capacity; otherwise the elements of 'original' are
+        // copied, and 'original' is unchanged.
+
+    //! ~FlatHashSet() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashSet& operator=(const FlatHashSet& rhs);
+        // Assign to this set the value, capacity, and functors of the
+        // specified 'rhs' set, and return a reference providing modifiable
+        // access to this set.  If an exception is thrown, this set is
+        // unchanged.
+
+    FlatHashSet& operator=(bslmf::MovableRef<FlatHashSet> rhs);
+        // Assign to this set the value, capacity, and functors of the
+        // specified 'rhs' set, and return a reference providing modifiable
+        // access to this set.  If 'rhs' uses the same allocator as this set,
+        // its storage is moved, and 'rhs' is left empty and having no
+        // capacity; otherwise the elements of 'rhs' are copied, and 'rhs' is
+        // unchanged.
+
+    void clear();
+        // Remove all elements from this set.  Note that the capacity of this
+        // set is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the specified 'key' from this set, if it is an element of
+        // the set.  Return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the element referred to by the specified 'position' from
+        // this set, and return an iterator referring to the element following
+        // it, or the past-the-end iterator if there is no such element.  The
+        // behavior is undefined unless 'position' refers to an element of
+        // this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements of the specified range '[first, last)' from this
+        // set, and return 'last'.  The behavior is undefined unless
+        // '[first, last)' is a valid range of elements of this set.
+
+    bsl::pair<iterator, bool> insert(const KEY& key);
+        // Insert a copy of the specified 'key' into this set if it is not
+        // already an element of the set.  Return a pair holding an iterator
+        // referring to the element equal to 'key', and 'true' if 'key' was
+        // inserted, or 'false' otherwise.
+
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<KEY> key);
+        // Insert the specified 'key', moved into the set, if it is not
+        // already an element of the set.  Return a pair holding an iterator
+        // referring to the element equal to 'key', and 'true' if 'key' was
+        // inserted, or 'false' otherwise.  If 'key' is not inserted, it is
+        // unchanged.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set each element of the specified range
+        // '[first, last)' that is not already an element of this set.  The
+        // behavior is undefined unless '[first, last)' is a valid range of
+        // objects convertible to 'KEY'.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Rehash this set into storage having at least the specified
+        // 'minimumCapacity' slots, and able to hold 'size()' elements without
+        // being rehashed.  If an exception is thrown, this set is left empty.
+
+    void reserve(bsl::size_t numEntries);
+        // Rehash this set, if necessary, so that it can hold the specified
+        // 'numEntries' elements without being rehashed.  If an exception is
+        // thrown, this set is left empty.
+
+    void reset();
+        // Remove all elements from this set and release its storage.
+
+    void swap(FlatHashSet& other);
+        // Exchange the value, capacity, and functors of this set with those
+        // of the specified 'other' set.  This method provides the no-throw
+        // exception-safety guarantee if the functors have no-throw swap
+        // operations.  The behavior is undefined unless this set uses the
+        // same allocator as 'other'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this set, or
+        // the past-the-end iterator if this set is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this set.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if the specified 'key' is an element of this set, and
+        // 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this set equal to the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this set has no elements, and 'false' otherwise.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this set.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element equal to the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this set.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this set.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements to the capacity of this
+        // set, or 0 if the set has no capacity.
+
+    float max_load_factor() const;
+        // Return the ratio of slots in use or erased to the capacity of this
+        // set at which the set is rehashed (i.e., 0.875).
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+bool operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets have the same
+    // value, and 'false' otherwise.  Two sets have the same value if they have
+    // the same number of elements, and each element of 'lhs' is an element of
+    // 'rhs'.
+
+template <class KEY, class HASH, class EQUAL>
+bool operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void swap(FlatHashSet<KEY, HASH, EQUAL>& a, FlatHashSet<KEY, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' sets.  If the sets use
+    // the same allocator this method provides the no-throw exception-safety
+    // guarantee if the functors have no-throw swap operations; otherwise each
+    // set is assigned a copy of the other's value.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // struct FlatHashSet_EntryUtil
+                        // ---------------------------
+
+// CLASS METHODS
+template <class ENTRY>
+inline
+void FlatHashSet_EntryUtil<ENTRY>::constructFromKey(
+                                                  ENTRY            *entry,
+                                                  bslma::Allocator *allocator,
+                                                  const ENTRY&      key)
+{
+    bslma::ConstructionUtil::construct(entry, allocator, key);
+}
+
+template <class ENTRY>
+inline
+const ENTRY& FlatHashSet_EntryUtil<ENTRY>::key(const ENTRY& entry)
+{
+    return entry;
+}
+
+                            // -----------------
+                            // class FlatHashSet
+                            // -----------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                            const FlatHashSet&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                       bslmf::MovableRef<FlatHashSet> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                               bslmf::MovableRef<FlatHashSet>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(const FlatHashSet& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(bslmf::MovableRef<FlatHashSet> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL>
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator first, const_iterator last)
+{
+    // Erasing an element does not move any other element, so 'last' remains
+    // valid.
+
+    while (first != last) {
+        first = d_impl.erase(first);
+    }
+    return last;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& key)
+{
+    return d_impl.insert(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(bslmf::MovableRef<KEY> key)
+{
+    return d_impl.insert(MoveUtil::move(MoveUtil::access(key)));
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void FlatHashSet<KEY, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::swap(FlatHashSet& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hasher();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+EQUAL FlatHashSet<KEY, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.keyEqual();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.loadFactor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.maxLoadFactor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashSet<KEY, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void bdlc::swap(FlatHashSet<KEY, HASH, EQUAL>& a,
+                FlatHashSet<KEY, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashSet<KEY, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashSet<KEY, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
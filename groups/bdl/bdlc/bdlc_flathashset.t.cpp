@@ -0,0 +1,693 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a container adapting 'bdlc::FlatHashTable',
+// which is tested thoroughly in its own component.  The methods of this
+// component forward to those of the table, so we verify that each method is
+// correctly forwarded, and that the set behaves as its oracle ('bsl::set')
+// for random sequences of operations.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashSet();
+// [ 2] explicit FlatHashSet(bslma::Allocator *basicAllocator);
+// [ 3] explicit FlatHashSet(size_t capacity);
+// [ 3] FlatHashSet(size_t capacity, bslma::Allocator *basicAllocator);
+// [ 3] FlatHashSet(size_t, const HASH&, bslma::Allocator * = 0);
+// [ 3] FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+// [ 3] FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+// [ 3] FlatHashSet(const FlatHashSet&, bslma::Allocator * = 0);
+// [ 3] FlatHashSet(MovableRef<FlatHashSet>);
+// [ 3] FlatHashSet(MovableRef<FlatHashSet>, bslma::Allocator *);
+//
+// MANIPULATORS
+// [ 3] FlatHashSet& operator=(const FlatHashSet&);
+// [ 3] FlatHashSet& operator=(MovableRef<FlatHashSet>);
+// [ 2] void clear();
+// [ 2] size_t erase(const KEY&);
+// [ 2] iterator erase(const_iterator);
+// [ 2] iterator erase(const_iterator, const_iterator);
+// [ 2] pair<iterator, bool> insert(const KEY&);
+// [ 3] pair<iterator, bool> insert(MovableRef<KEY>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 2] void rehash(size_t);
+// [ 2] void reserve(size_t);
+// [ 2] void reset();
+// [ 3] void swap(FlatHashSet&);
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 3] HASH hash_function() const;
+// [ 3] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const FlatHashSet&, const FlatHashSet&);
+// [ 3] bool operator!=(const FlatHashSet&, const FlatHashSet&);
+//
+// FREE FUNCTIONS
+// [ 3] void swap(FlatHashSet&, FlatHashSet&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bdlc::FlatHashSet<int>         IntSet;
+typedef bdlc::FlatHashSet<bsl::string> StringSet;
+
+struct ModuloHash {
+    // This hash functor hashes an 'int' modulo its configured divisor.
+
+    int d_divisor;
+
+    explicit ModuloHash(int divisor = 1000) : d_divisor(divisor)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key % d_divisor);
+    }
+};
+
+struct ModuloEqual {
+    // This functor compares two 'int' keys for equality modulo its configured
+    // divisor.
+
+    int d_divisor;
+
+    explicit ModuloEqual(int divisor = 1000) : d_divisor(divisor)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs % d_divisor == rhs % d_divisor;
+    }
+};
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *seed)
+    // Return the next value of the pseudo-random sequence having the
+    // specified 'seed', and update 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (*seed >> 16) & 0x7FFF;
+}
+
+static bool matchesOracle(const IntSet& set, const bsl::set<int>& oracle)
+    // Return 'true' if the specified 'set' has the same elements as the
+    // specified 'oracle', and 'false' otherwise.
+{
+    if (set.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t count = 0;
+    for (IntSet::const_iterator it = set.cbegin(); it != set.cend(); ++it) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+    return count == oracle.size();
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+/// - - - - - - - - - - - - - - -
+// Suppose we want to process a sequence of request identifiers, ignoring any
+// identifier that has already been processed.
+//
+// First, we define the identifiers:
+//..
+    const int IDS[] = { 17, 3, 17, 42, 3, 8, 42, 17 };
+    const bsl::size_t NUM_IDS = sizeof IDS / sizeof *IDS;
+//..
+// Then, we create a set to hold the identifiers already processed:
+//..
+    bdlc::FlatHashSet<int> processed;
+//..
+// Next, we process each identifier that is successfully inserted into the
+// set (here, processing simply counts the identifiers):
+//..
+    int numProcessed = 0;
+    for (bsl::size_t i = 0; i < NUM_IDS; ++i) {
+        if (processed.insert(IDS[i]).second) {
+            ++numProcessed;
+        }
+    }
+//..
+// Finally, we verify that each distinct identifier was processed once:
+//..
+    ASSERT(4 == numProcessed);
+    ASSERT(4 == processed.size());
+    ASSERT(processed.contains(42));
+    ASSERT(!processed.contains(5));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Each constructor creates a set having the specified capacity,
+        //:   functors, elements, and allocator.
+        //:
+        //: 2 Copy, move, assignment, and swap forward to the table, and
+        //:   propagate the allocator as documented.
+        //:
+        //: 3 'insert' of a movable key and of a range forward to the table.
+        //:
+        //: 4 Two sets are equal if, and only if, they have the same elements.
+        //
+        // Plan:
+        //: 1 Create sets using each constructor, and verify their state.
+        //:   (C-1)
+        //:
+        //: 2 Copy, move, assign, and swap sets using the same and different
+        //:   allocators, and verify their values and allocators.  (C-2)
+        //:
+        //: 3 Insert a movable key and a range, and verify the elements.
+        //:   (C-3)
+        //:
+        //: 4 Compare sets built in different orders, and sets differing in
+        //:   one element.  (C-4)
+        //
+        // Testing:
+        //   explicit FlatHashSet(size_t capacity);
+        //   FlatHashSet(size_t capacity, bslma::Allocator *basicAllocator);
+        //   FlatHashSet(size_t, const HASH&, bslma::Allocator * = 0);
+        //   FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+        //   FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+        //   FlatHashSet(const FlatHashSet&, bslma::Allocator * = 0);
+        //   FlatHashSet(MovableRef<FlatHashSet>);
+        //   FlatHashSet(MovableRef<FlatHashSet>, bslma::Allocator *);
+        //   FlatHashSet& operator=(const FlatHashSet&);
+        //   FlatHashSet& operator=(MovableRef<FlatHashSet>);
+        //   pair<iterator, bool> insert(MovableRef<KEY>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void swap(FlatHashSet&);
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   bool operator==(const FlatHashSet&, const FlatHashSet&);
+        //   bool operator!=(const FlatHashSet&, const FlatHashSet&);
+        //   void swap(FlatHashSet&, FlatHashSet&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "CREATORS, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                        << "========================================" << endl;
+
+        typedef bslmf::MovableRefUtil                        MoveUtil;
+        typedef bdlc::FlatHashSet<int, ModuloHash, ModuloEqual>
+                                                             ModuloSet;
+
+        bslma::TestAllocator ta("a", veryVeryVeryVerbose);
+        bslma::TestAllocator tb("b", veryVeryVeryVerbose);
+
+        const char *LONG = "a string long enough to allocate memory";
+
+        if (verbose) cout << "\tCapacity and functor constructors." << endl;
+        {
+            const IntSet X(100);
+            ASSERT(128 == X.capacity());
+            ASSERT(&da == X.allocator());
+
+            const IntSet Y(100, &ta);
+            ASSERT(128 == Y.capacity());
+            ASSERT(&ta == Y.allocator());
+
+            const ModuloSet Z(10, ModuloHash(7), &ta);
+            ASSERT(16  == Z.capacity());
+            ASSERT(7   == Z.hash_function().d_divisor);
+
+            ModuloSet mW(0, ModuloHash(5), ModuloEqual(5), &tb);
+            const ModuloSet& W = mW;
+            ASSERT(5   == W.key_eq().d_divisor);
+            ASSERT(&tb == W.allocator());
+
+            ASSERT(mW.insert(1).second);
+            ASSERT(!mW.insert(6).second);
+            ASSERT(W.contains(11));
+            ASSERT(1 == *W.find(16));
+        }
+
+        if (verbose) cout << "\tRange constructor and insert." << endl;
+        {
+            bsl::vector<int> values;
+            for (int i = 0; i < 100; ++i) {
+                values.push_back(i % 60);
+            }
+
+            const IntSet X(values.begin(), values.end(), &ta);
+            ASSERT(60  == X.size());
+            ASSERT(&ta == X.allocator());
+
+            IntSet mY(&ta);  const IntSet& Y = mY;
+            mY.insert(1000);
+            mY.insert(values.begin(), values.end());
+            ASSERT(61 == Y.size());
+            ASSERT(X  != Y);
+
+            mY.erase(1000);
+            ASSERT(X  == Y);
+        }
+
+        StringSet mX(&ta);  const StringSet& X = mX;
+        for (int i = 0; i < 50; ++i) {
+            mX.insert(bsl::string(LONG) + static_cast<char>('A' + i));
+        }
+
+        if (verbose) cout << "\tCopy and move construction." << endl;
+        {
+            const StringSet Y(X, &tb);
+            ASSERT(X   == Y);
+            ASSERT(&tb == Y.allocator());
+
+            StringSet mZ(X, &ta);  const StringSet& Z = mZ;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            StringSet mW(MoveUtil::move(mZ));  const StringSet& W = mW;
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(X   == W);
+            ASSERT(&ta == W.allocator());
+            ASSERT(Z.empty());
+
+            const StringSet V(MoveUtil::move(mW), &tb);
+            ASSERT(X   == V);
+            ASSERT(X   == W);
+            ASSERT(&tb == V.allocator());
+        }
+        ASSERT(0 == tb.numBytesInUse());
+
+        if (verbose) cout << "\tAssignment and swap." << endl;
+        {
+            StringSet mY(&tb);  const StringSet& Y = mY;
+            mY.insert("key");
+
+            mY = X;
+            ASSERT(X   == Y);
+            ASSERT(&tb == Y.allocator());
+
+            StringSet mZ(&tb);  const StringSet& Z = mZ;
+            mZ = MoveUtil::move(mY);
+            ASSERT(X == Z);
+
+            StringSet mW(&ta);  const StringSet& W = mW;
+            mW.insert("key");
+
+            swap(mW, mZ);
+            ASSERT(X   == W);
+            ASSERT(1   == Z.size());
+            ASSERT(&ta == W.allocator());
+            ASSERT(&tb == Z.allocator());
+
+            StringSet mV(&ta);  const StringSet& V = mV;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            mV.swap(mW);
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(X == V);
+            ASSERT(W.empty());
+        }
+
+        if (verbose) cout << "\tInserting a movable key." << endl;
+        {
+            bsl::string key(LONG, &ta);
+
+            ASSERT(mX.insert(MoveUtil::move(key)).second);
+            ASSERT(X.contains(LONG));
+            ASSERT(51 == X.size());
+        }
+        ASSERT(0 == da.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The manipulators and accessors forward to the table, so that the
+        //:   set behaves as its oracle for any sequence of operations.
+        //:
+        //: 2 Erasing by position, and erasing a range, erase exactly the
+        //:   specified elements.
+        //:
+        //: 3 The capacity methods forward to the table.
+        //:
+        //: 4 All memory is supplied by the set's allocator.
+        //
+        // Plan:
+        //: 1 Apply a random sequence of insertions, erasures, and lookups to a
+        //:   set and to an oracle ('bsl::set'), verifying they agree.  (C-1)
+        //:
+        //: 2 Erase elements by position and by range, and verify the elements
+        //:   remaining.  (C-2)
+        //:
+        //: 3 Invoke each capacity method, and verify the capacity.  (C-3)
+        //:
+        //: 4 Use a test allocator, and verify the default allocator is not
+        //:   used.  (C-4)
+        //
+        // Testing:
+        //   FlatHashSet();
+        //   explicit FlatHashSet(bslma::Allocator *basicAllocator);
+        //   void clear();
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   pair<iterator, bool> insert(const KEY&);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_iterator find(const KEY&) const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                        << "========================================" << endl;
+
+        bslma::TestAllocator ta("set", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("oracle", veryVeryVeryVerbose);
+
+        {
+            const IntSet X;
+            ASSERT(&da == X.allocator());
+            ASSERT(0   == X.capacity());
+            ASSERT(0   == da.numAllocations());
+        }
+
+        if (verbose) cout << "\tRandom operations." << endl;
+        {
+            IntSet mX(&ta);  const IntSet& X = mX;
+            ASSERT(&ta == X.allocator());
+
+            bsl::set<int> oracle(&oa);
+            unsigned int  seed = 1;
+
+            for (int i = 0; i < 50000; ++i) {
+                const int key = static_cast<int>(nextRandom(&seed) % 2000);
+                const int op  = static_cast<int>(nextRandom(&seed) % 3);
+
+                if (op < 2) {
+                    const bool EXP = oracle.insert(key).second;
+
+                    const bsl::pair<IntSet::iterator, bool> RESULT =
+                                                                mX.insert(key);
+                    ASSERTV(i, EXP == RESULT.second);
+                    ASSERTV(i, key == *RESULT.first);
+                }
+                else {
+                    ASSERTV(i, oracle.erase(key) == mX.erase(key));
+                    ASSERTV(i, X.end() == X.find(key));
+                }
+
+                ASSERTV(i, oracle.size()     == X.size());
+                ASSERTV(i, oracle.count(key) == X.count(key));
+                ASSERTV(i, oracle.empty()    == X.empty());
+                ASSERTV(i, (0 != oracle.count(key)) == X.contains(key));
+
+                if (0 == i % 1000) {
+                    ASSERTV(i, matchesOracle(X, oracle));
+                }
+            }
+            ASSERT(matchesOracle(X, oracle));
+        }
+
+        if (verbose) cout << "\tErasing by position." << endl;
+        {
+            IntSet mX(&ta);  const IntSet& X = mX;
+            for (int i = 0; i < 300; ++i) {
+                mX.insert(i);
+            }
+
+            for (IntSet::const_iterator it = X.begin(); it != X.end();) {
+                if (0 == *it % 3) {
+                    it = mX.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERT(200 == X.size());
+            for (int i = 0; i < 300; ++i) {
+                ASSERTV(i, (0 != i % 3) == X.contains(i));
+            }
+
+            IntSet::const_iterator last = X.begin();
+            for (int i = 0; i < 50; ++i) {
+                ++last;
+            }
+            ASSERT(last == mX.erase(X.begin(), last));
+            ASSERT(150  == X.size());
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+        }
+
+        if (verbose) cout << "\tCapacity." << endl;
+        {
+            IntSet mX(&ta);  const IntSet& X = mX;
+
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0.0f   == X.load_factor());
+
+            mX.reserve(100);
+            ASSERT(128 == X.capacity());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(128 == X.capacity());
+            ASSERT(100.0f / 128.0f == X.load_factor());
+
+            mX.rehash(1024);
+            ASSERT(1024 == X.capacity());
+            ASSERT(100  == X.size());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(1024 == X.capacity());
+            ASSERT(X.cbegin() == X.cend());
+
+            mX.reset();
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBytesInUse());
+        }
+        ASSERT(0 == da.numAllocations());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("set", veryVeryVeryVerbose);
+        {
+            StringSet mX(&ta);  const StringSet& X = mX;
+
+            ASSERT(X.empty());
+
+            ASSERT(mX.insert("one").second);
+            ASSERT(mX.insert("two").second);
+            ASSERT(!mX.insert("one").second);
+
+            ASSERT(2     == X.size());
+            ASSERT("two" == *X.find("two"));
+            ASSERT(X.end() == X.find("three"));
+
+            ASSERT(1 == mX.erase("two"));
+            ASSERT(!X.contains("two"));
+            ASSERT(1 == X.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1496 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table like Abseil 'flat_hash_map'.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressed hash table
+//  bdlc::FlatHashTable_IteratorImp: iterator implementation for the table
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlc::FlatHashTable', implementing an open-addressed hash table of entries
+// stored directly in a single contiguous array of slots (i.e., without a node
+// per entry), in the style of the "Swiss table" design of Abseil's
+// 'flat_hash_map'.  This class is the implementation of 'bdlc::FlatHashMap'
+// and 'bdlc::FlatHashSet', and is not intended for direct use.
+//
+///Implementation
+///--------------
+// The slots of a table are divided into groups of 16, and each slot has a
+// corresponding control byte (see 'bdlc_flathashtable_groupcontrol').  The
+// hash value of a key is mixed, then split into two parts: bits '[7, 64)'
+// select the group at which the search for the key starts, and bits '[0, 7)'
+// are stored in the control byte of the slot holding the key's entry.  A
+// search examines the control bytes of a whole group at once, compares keys
+// only for the slots whose control bytes match, and proceeds to the next
+// group of a quadratic probe sequence only if the group contains no empty
+// slot.
+//
+// Erasing an entry marks its slot as erased (a "tombstone") unless its group
+// contains an empty slot, in which case no search could have probed past the
+// group and the slot is marked empty.  The table is rehashed when the number
+// of slots in use or erased would exceed 7/8 of the capacity: into a table of
+// the same capacity if at least half of those slots are erased, and into a
+// table of twice the capacity otherwise.
+//
+///Requirements on 'ENTRY_UTIL'
+///----------------------------
+// The (template parameter) type 'ENTRY_UTIL' must provide the following
+// static member functions:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return a 'const' reference to the key of the specified 'entry'.
+//
+//  static void constructFromKey(ENTRY            *entry,
+//                               bslma::Allocator *allocator,
+//                               const KEY&        key);
+//      // Create at the specified 'entry' address an entry having the
+//      // specified 'key', and a default value for any other part of the
+//      // entry, using the specified 'allocator' to supply memory.
+//..
+//
+///Iterator and Reference Invalidation
+///-----------------------------------
+// Inserting an entry, or reserving capacity, may rehash the table, which
+// invalidates all iterators, pointers, and references to entries of the
+// table.  Erasing an entry invalidates only iterators, pointers, and
+// references to the erased entry.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bdlc_flathashmap' and
+// 'bdlc_flathashset' and is *not* intended for direct client use.  It is
+// subject to change without notice.  As such, a usage example is not provided.
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bslstl_forwarditerator.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ===============================
+                     // class FlatHashTable_IteratorImp
+                     // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class provides the implementation of a forward iterator over the
+    // entries of a 'FlatHashTable', suitable for adaptation by
+    // 'bslstl::ForwardIterator'.
+
+    // DATA
+    ENTRY              *d_entry_p;    // current slot
+    const bsl::uint8_t *d_control_p;  // control byte of the current slot
+    bsl::size_t         d_remaining;  // number of slots from the current
+                                      // slot to the end of the table (0 for
+                                      // an end iterator)
+
+    // FRIENDS
+    template <class OTHER_ENTRY>
+    friend bool operator==(const FlatHashTable_IteratorImp<OTHER_ENTRY>&,
+                           const FlatHashTable_IteratorImp<OTHER_ENTRY>&);
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create a default iterator implementation that does not refer to any
+        // entry.
+
+    FlatHashTable_IteratorImp(ENTRY              *entry,
+                              const bsl::uint8_t *control,
+                              bsl::size_t         remaining);
+        // Create an iterator implementation referring to the slot at the
+        // specified 'entry' address, having the specified 'control' byte, and
+        // the specified 'remaining' number of slots (including 'entry') to the
+        // end of the table.  If 'remaining' is 0, create an end iterator.  The
+        // behavior is undefined unless '0 == remaining' or '*control'
+        // indicates a slot that is in use.
+
+    //! FlatHashTable_IteratorImp(const FlatHashTable_IteratorImp&) = default;
+    //! ~FlatHashTable_IteratorImp() = default;
+
+    // MANIPULATORS
+    //! FlatHashTable_IteratorImp& operator=(
+    //!                         const FlatHashTable_IteratorImp&) = default;
+
+    void operator++();
+        // Advance this iterator to the next slot in use, or to the end of the
+        // table if there is no such slot.  The behavior is undefined unless
+        // this iterator refers to an entry.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this iterator.  The
+        // behavior is undefined unless this iterator refers to an entry.
+
+    const bsl::uint8_t *control() const;
+        // Return the address of the control byte of the slot referred to by
+        // this iterator.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same slot, and 'false' otherwise.
+
+                            // ===================
+                            // class FlatHashTable
+                            // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template implements an open-addressed hash table of 'ENTRY'
+    // objects, each having a unique 'KEY' (as determined by 'EQUAL') obtained
+    // from the entry by 'ENTRY_UTIL::key'.  See {Implementation}.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl   GroupControl;
+    typedef GroupControl::BitMask        BitMask;
+    typedef bsls::Types::Uint64          Uint64;
+    typedef bslmf::MovableRefUtil        MoveUtil;
+
+    enum {
+        k_GROUP_SIZE  = GroupControl::k_SIZE,
+        k_HASH_BITS   = 7,                          // bits kept in a control
+        k_HASH_MASK   = (1 << k_HASH_BITS) - 1
+    };
+
+    // DATA
+    ENTRY            *d_entries_p;     // array of 'd_capacity' slots
+    bsl::uint8_t     *d_controls_p;    // array of 'd_capacity' control bytes
+    bsl::size_t       d_size;          // number of slots in use
+    bsl::size_t       d_numErased;     // number of slots marked erased
+    bsl::size_t       d_capacity;      // 0, or a power of two at least
+                                       // 'k_GROUP_SIZE'
+    HASH              d_hasher;        // hash functor
+    EQUAL             d_equal;         // key-equality functor
+    bslma::Allocator *d_allocator_p;   // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t maxLoad(bsl::size_t capacity);
+        // Return the number of slots, of a table having the specified
+        // 'capacity', that may be in use or erased before the table is
+        // rehashed.
+
+    static bsl::size_t minimumCapacity(bsl::size_t numEntries);
+        // Return the least capacity of a table able to hold the specified
+        // 'numEntries' without being rehashed.
+
+    static Uint64 mix(bsl::size_t hash);
+        // Return the specified 'hash' having its bits mixed, so that the bits
+        // used to select a group and the bits stored in a control byte depend
+        // on all bits of 'hash'.
+
+    // PRIVATE MANIPULATORS
+    void allocate(bsl::size_t capacity);
+        // Allocate the slots and control bytes for a table having the
+        // specified 'capacity', and mark all the slots empty, without
+        // releasing the current storage.
+
+    void copyEntries(const FlatHashTable& original);
+        // Copy the entries and control bytes of the specified 'original'
+        // table, having the same capacity as this table, into the
+        // corresponding slots of this table.  If an exception is thrown, this
+        // table is left having no entries.  The behavior is undefined unless
+        // this table has no entries.
+
+    void destroyEntries();
+        // Destroy the entries of this table without changing its control
+        // bytes.
+
+    void eraseSlot(bsl::size_t index);
+        // Destroy the entry of the slot at the specified 'index' and mark the
+        // slot empty or erased.  The behavior is undefined unless the slot at
+        // 'index' is in use.
+
+    template <class SOURCE>
+    bsl::pair<bsl::size_t, bool> insertEntry(const KEY&    key,
+                                             const SOURCE& source);
+        // Find the slot of the entry having the specified 'key' or, if there
+        // is no such entry, insert an entry into the table by invoking
+        // 'source.construct' with the slot's address and the allocator of
+        // this table (see 'FlatHashTable_CopyInserter',
+        // 'FlatHashTable_MoveInserter', and 'FlatHashTable_KeyInserter').
+        // Return a pair holding the index of the slot and 'true' if an entry
+        // was inserted, and 'false' otherwise.
+
+    void prepareForInsert();
+        // Rehash this table if inserting an entry into a slot that is empty
+        // could exceed the maximum load.
+
+    void rehashRaw(bsl::size_t capacity);
+        // Move the entries of this table into new storage having the
+        // specified 'capacity'.  If an exception is thrown, this table is
+        // left having no entries.  The behavior is undefined unless
+        // 'capacity' is a power of two, at least 'k_GROUP_SIZE', and is able
+        // to hold 'size()' entries.
+
+    void releaseStorage();
+        // Deallocate the storage of this table, leaving it having no capacity.
+        // The behavior is undefined unless the table has no entries, or its
+        // entries were destroyed.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findAvailable(Uint64 hash) const;
+        // Return the index of the first slot that is not in use on the probe
+        // sequence of the specified (mixed) 'hash'.  The behavior is undefined
+        // unless this table has a slot that is not in use.
+
+    bsl::size_t findKey(const KEY& key, Uint64 hash) const;
+        // Return the index of the slot holding the entry having the specified
+        // 'key' of the specified (mixed) 'hash', or 'd_capacity' if there is
+        // no such entry.
+
+    Uint64 hashOf(const KEY& key) const;
+        // Return the mixed hash value of the specified 'key'.
+
+    FlatHashTable_IteratorImp<ENTRY> impAt(bsl::size_t index) const;
+        // Return an iterator implementation referring to the slot at the
+        // specified 'index'.  The behavior is undefined unless the slot at
+        // 'index' is in use.
+
+  public:
+    // PUBLIC TYPES
+    typedef FlatHashTable_IteratorImp<ENTRY>                   IteratorImp;
+    typedef bslstl::ForwardIterator<ENTRY, IteratorImp>        iterator;
+    typedef bslstl::ForwardIterator<const ENTRY, IteratorImp>  const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table able to hold at least the specified
+        // 'capacity' entries without being rehashed, using the specified
+        // 'hash' and 'equal' functors.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, capacity, and functors as the
+        // specified 'original' table.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable> original);
+        // Create a table having the same value, capacity, functors, and
+        // allocator as the specified 'original' table, leaving 'original'
+        // having no entries and no capacity.  No memory is allocated.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable>  original,
+                  bslma::Allocator                 *basicAllocator);
+        // Create a table having the same value, capacity, and functors as the
+        // specified 'original' table, using the specified 'basicAllocator' to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  If 'original' uses the same allocator
+        // as this table, its storage is moved, and 'original' is left having
+        // no entries and no capacity; otherwise the entries of 'original' are
+        // copied, and 'original' is unchanged.
+
+    ~FlatHashTable();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this table the value, capacity, and functors of the
+        // specified 'rhs' table, and return a reference providing modifiable
+        // access to this table.  If an exception is thrown, this table is
+        // unchanged.
+
+    FlatHashTable& operator=(bslmf::MovableRef<FlatHashTable> rhs);
+        // Assign to this table the value, capacity, and functors of the
+        // specified 'rhs' table, and return a reference providing modifiable
+        // access to this table.  If 'rhs' uses the same allocator as this
+        // table, its storage is moved, and 'rhs' is left having no entries
+        // and no capacity; otherwise the entries of 'rhs' are copied, and
+        // 'rhs' is unchanged.
+
+    iterator begin();
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this table.
+
+    void clear();
+        // Remove all entries from this table.  Note that the capacity of this
+        // table is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the entry having the specified 'key' from this table, if
+        // such an entry exists.  Return the number of entries removed (0 or
+        // 1).
+
+    iterator erase(const_iterator position);
+        // Remove the entry referred to by the specified 'position' from this
+        // table, and return an iterator referring to the entry following it,
+        // or the past-the-end iterator if there is no such entry.  The
+        // behavior is undefined unless 'position' refers to an entry of this
+        // table.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the past-the-end iterator if there is no such entry.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+        // Insert a copy of the specified 'entry' into this table if the table
+        // has no entry having the same key.  Return a pair holding an
+        // iterator referring to the entry having that key, and 'true' if the
+        // entry was inserted, or 'false' otherwise.
+
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry', moved into the table, if the table
+        // has no entry having the same key.  Return a pair holding an
+        // iterator referring to the entry having that key, and 'true' if the
+        // entry was inserted, or 'false' otherwise.  If 'entry' is not
+        // inserted, it is unchanged.
+
+    bsl::pair<iterator, bool> insertKey(const KEY& key);
+        // Insert an entry having the specified 'key' and a default value for
+        // the rest of the entry (see 'ENTRY_UTIL::constructFromKey') into
+        // this table if the table has no entry having 'key'.  Return a pair
+        // holding an iterator referring to the entry having 'key', and 'true'
+        // if the entry was inserted, or 'false' otherwise.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Rehash this table into storage having at least the specified
+        // 'minimumCapacity' slots, and able to hold 'size()' entries without
+        // being rehashed.  If an exception is thrown, this table is left
+        // having no entries.  Note that this method removes all erased slots
+        // and may reduce the capacity of this table.
+
+    void reserve(bsl::size_t numEntries);
+        // Rehash this table, if necessary, so that it can hold the specified
+        // 'numEntries' without being rehashed.  If an exception is thrown,
+        // this table is left having no entries.
+
+    void reset();
+        // Remove all entries from this table and release its storage.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, capacity, and functors of this table with
+        // those of the specified 'other' table.  This method provides the
+        // no-throw exception-safety guarantee if the functors have no-throw
+        // swap operations.  The behavior is undefined unless this table uses
+        // the same allocator as 'other'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table has an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this table.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the past-the-end iterator if there is no such entry.
+
+    const HASH& hasher() const;
+        // Return a reference to the hash functor of this table.
+
+    const EQUAL& keyEqual() const;
+        // Return a reference to the key-equality functor of this table.
+
+    float loadFactor() const;
+        // Return the ratio of the number of entries to the capacity of this
+        // table, or 0 if the table has no capacity.
+
+    float maxLoadFactor() const;
+        // Return the maximum ratio of slots in use or erased to the capacity
+        // of this table before the table is rehashed (i.e., 0.875).
+
+    bsl::size_t size() const;
+        // Return the number of entries in this table.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries, and for each entry of 'lhs' there is
+    // an entry of 'rhs' having the same key that compares equal using
+    // 'ENTRY::operator=='.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' tables.  If the
+    // tables use the same allocator this method provides the no-throw
+    // exception-safety guarantee if the functors have no-throw swap
+    // operations; otherwise each table is assigned a copy of the other's
+    // value.
+
+                    // =================================
+                    // class FlatHashTable_CopyInserter
+                    // =================================
+
+template <class ENTRY>
+class FlatHashTable_CopyInserter {
+    // This component-private class constructs an entry of a 'FlatHashTable'
+    // by copying a source entry.
+
+    // DATA
+    const ENTRY& d_source;  // entry to copy
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_CopyInserter(const ENTRY& source);
+        // Create an inserter for a copy of the specified 'source' entry.
+
+    // ACCESSORS
+    void construct(ENTRY *entry, bslma::Allocator *allocator) const;
+        // Create at the specified 'entry' address a copy of the source entry
+        // of this inserter, using the specified 'allocator' to supply memory.
+};
+
+                    // =================================
+                    // class FlatHashTable_MoveInserter
+                    // =================================
+
+template <class ENTRY>
+class FlatHashTable_MoveInserter {
+    // This component-private class constructs an entry of a 'FlatHashTable'
+    // by moving from a source entry.
+
+    // DATA
+    ENTRY& d_source;  // entry to move from
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_MoveInserter(ENTRY& source);
+        // Create an inserter for an entry moved from the specified 'source'
+        // entry.
+
+    // ACCESSORS
+    void construct(ENTRY *entry, bslma::Allocator *allocator) const;
+        // Create at the specified 'entry' address an entry moved from the
+        // source entry of this inserter, using the specified 'allocator' to
+        // supply memory.
+};
+
+                     // ===============================
+                     // class FlatHashTable_KeyInserter
+                     // ===============================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL>
+class FlatHashTable_KeyInserter {
+    // This component-private class constructs an entry of a 'FlatHashTable'
+    // from a key, using 'ENTRY_UTIL::constructFromKey'.
+
+    // DATA
+    const KEY& d_key;  // key of the entry
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_KeyInserter(const KEY& key);
+        // Create an inserter for an entry having the specified 'key'.
+
+    // ACCESSORS
+    void construct(ENTRY *entry, bslma::Allocator *allocator) const;
+        // Create at the specified 'entry' address an entry having the key of
+        // this inserter, using the specified 'allocator' to supply memory.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                     // -------------------------------
+                     // class FlatHashTable_IteratorImp
+                     // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entry_p(0)
+, d_control_p(0)
+, d_remaining(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                             ENTRY              *entry,
+                                             const bsl::uint8_t *control,
+                                             bsl::size_t         remaining)
+: d_entry_p(entry)
+, d_control_p(control)
+, d_remaining(remaining)
+{
+    BSLS_ASSERT_SAFE(0 == remaining || 0 == (*control & 0x80));
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(0 < d_remaining);
+
+    do {
+        ++d_entry_p;
+        ++d_control_p;
+        --d_remaining;
+    } while (d_remaining && (*d_control_p & 0x80));
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(0 < d_remaining);
+
+    return *d_entry_p;
+}
+
+template <class ENTRY>
+inline
+const bsl::uint8_t *FlatHashTable_IteratorImp<ENTRY>::control() const
+{
+    return d_control_p;
+}
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.d_entry_p == rhs.d_entry_p;
+}
+
+                    // ---------------------------------
+                    // class FlatHashTable_CopyInserter
+                    // ---------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_CopyInserter<ENTRY>::FlatHashTable_CopyInserter(
+                                                           const ENTRY& source)
+: d_source(source)
+{
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+void FlatHashTable_CopyInserter<ENTRY>::construct(
+                                            ENTRY            *entry,
+                                            bslma::Allocator *allocator) const
+{
+    bslma::ConstructionUtil::construct(entry, allocator, d_source);
+}
+
+                    // ---------------------------------
+                    // class FlatHashTable_MoveInserter
+                    // ---------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_MoveInserter<ENTRY>::FlatHashTable_MoveInserter(ENTRY& source)
+: d_source(source)
+{
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+void FlatHashTable_MoveInserter<ENTRY>::construct(
+                                            ENTRY            *entry,
+                                            bslma::Allocator *allocator) const
+{
+    bslma::ConstructionUtil::construct(entry,
+                                       allocator,
+                                       bslmf::MovableRefUtil::move(d_source));
+}
+
+                     // -------------------------------
+                     // class FlatHashTable_KeyInserter
+                     // -------------------------------
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL>
+inline
+FlatHashTable_KeyInserter<KEY, ENTRY, ENTRY_UTIL>::FlatHashTable_KeyInserter(
+                                                                const KEY& key)
+: d_key(key)
+{
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL>
+inline
+void FlatHashTable_KeyInserter<KEY, ENTRY, ENTRY_UTIL>::construct(
+                                            ENTRY            *entry,
+                                            bslma::Allocator *allocator) const
+{
+    ENTRY_UTIL::constructFromKey(entry, allocator, d_key);
+}
+
+                            // -------------------
+                            // class FlatHashTable
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::maxLoad(
+                                                          bsl::size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::minimumCapacity(
+                                                        bsl::size_t numEntries)
+{
+    bsl::size_t capacity = k_GROUP_SIZE;
+    while (maxLoad(capacity) < numEntries) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::Uint64
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::mix(bsl::size_t hash)
+{
+    // Multiplying by an odd constant (derived from the golden ratio) makes
+    // the high bits depend on all bits of 'hash', and folding the high half
+    // onto the low half does the same for the low bits.  Note that many
+    // hash functions for integral types (e.g., 'bsl::hash<int>') are the
+    // identity function.
+
+    Uint64 value = static_cast<Uint64>(hash) * 0x9E3779B97F4A7C15ULL;
+    return value ^ (value >> 32);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocate(
+                                                          bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(k_GROUP_SIZE <= capacity);
+    BSLS_ASSERT_SAFE(0 == (capacity & (capacity - 1)));
+
+    // The slots and control bytes share a single allocation, the slots first
+    // (so that they are maximally aligned).
+
+    char *memory = static_cast<char *>(
+                 d_allocator_p->allocate(capacity * (sizeof(ENTRY) + 1)));
+
+    d_entries_p  = reinterpret_cast<ENTRY *>(memory);
+    d_controls_p = reinterpret_cast<bsl::uint8_t *>(
+                                            memory + capacity * sizeof(ENTRY));
+    d_capacity   = capacity;
+    d_numErased  = 0;
+
+    bsl::memset(d_controls_p, GroupControl::k_EMPTY, capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::copyEntries(
+                                                 const FlatHashTable& original)
+{
+    BSLS_ASSERT_SAFE(0 == d_size);
+    BSLS_ASSERT_SAFE(d_capacity == original.d_capacity);
+
+    // The entries are copied into the same slots as in 'original' (the hash
+    // functor being a copy of that of 'original'), preserving the erased
+    // slots so that no probe sequence is shortened.
+
+    bsl::size_t i = 0;
+    BSLS_TRY {
+        for (; i < d_capacity; ++i) {
+            if (0 == (original.d_controls_p[i] & 0x80)) {
+                bslma::ConstructionUtil::construct(d_entries_p + i,
+                                                   d_allocator_p,
+                                                   original.d_entries_p[i]);
+            }
+        }
+    }
+    BSLS_CATCH(...) {
+        for (bsl::size_t j = 0; j < i; ++j) {
+            if (0 == (original.d_controls_p[j] & 0x80)) {
+                bslma::DestructionUtil::destroy(d_entries_p + j);
+            }
+        }
+        BSLS_RETHROW;
+    }
+
+    bsl::memcpy(d_controls_p, original.d_controls_p, d_capacity);
+    d_size      = original.d_size;
+    d_numErased = original.d_numErased;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::destroyEntries()
+{
+    if (d_size) {
+        for (bsl::size_t i = 0; i < d_capacity; ++i) {
+            if (0 == (d_controls_p[i] & 0x80)) {
+                bslma::DestructionUtil::destroy(d_entries_p + i);
+            }
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::eraseSlot(
+                                                             bsl::size_t index)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(0 == (d_controls_p[index] & 0x80));
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    const GroupControl group(d_controls_p + (index & ~(k_GROUP_SIZE - 1)));
+    if (group.containsEmpty()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+        ++d_numErased;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class SOURCE>
+bsl::pair<bsl::size_t, bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insertEntry(
+                                                         const KEY&    key,
+                                                         const SOURCE& source)
+{
+    const Uint64 hash  = hashOf(key);
+    bsl::size_t  index = findKey(key, hash);
+    if (index != d_capacity) {
+        return bsl::pair<bsl::size_t, bool>(index, false);            // RETURN
+    }
+
+    prepareForInsert();
+
+    index = findAvailable(hash);
+    source.construct(d_entries_p + index, d_allocator_p);
+
+    if (GroupControl::k_ERASED == d_controls_p[index]) {
+        --d_numErased;
+    }
+    d_controls_p[index] = static_cast<bsl::uint8_t>(hash & k_HASH_MASK);
+    ++d_size;
+
+    return bsl::pair<bsl::size_t, bool>(index, true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::prepareForInsert()
+{
+    if (d_size + d_numErased < maxLoad(d_capacity)) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == d_capacity) {
+        allocate(k_GROUP_SIZE);
+    }
+    else if (d_numErased >= d_size) {
+        rehashRaw(d_capacity);
+    }
+    else {
+        rehashRaw(d_capacity * 2);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
+                                                          bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(d_size <= maxLoad(capacity));
+
+    ENTRY        *oldEntries  = d_entries_p;
+    bsl::uint8_t *oldControls = d_controls_p;
+    bsl::size_t   oldCapacity = d_capacity;
+
+    allocate(capacity);
+
+    bsl::size_t i = 0;
+    BSLS_TRY {
+        for (; i < oldCapacity; ++i) {
+            if (0 == (oldControls[i] & 0x80)) {
+                const Uint64      hash  = hashOf(
+                                             ENTRY_UTIL::key(oldEntries[i]));
+                const bsl::size_t index = findAvailable(hash);
+
+                bslma::ConstructionUtil::destructiveMove(d_entries_p + index,
+                                                         d_allocator_p,
+                                                         oldEntries + i);
+                d_controls_p[index] =
+                                 static_cast<bsl::uint8_t>(hash & k_HASH_MASK);
+            }
+        }
+    }
+    BSLS_CATCH(...) {
+        // Destroy the entries already moved, and those not yet moved
+        // (including the one whose move failed, which 'destructiveMove' leaves
+        // in a valid state), and release both arrays.
+
+        for (bsl::size_t j = i; j < oldCapacity; ++j) {
+            if (0 == (oldControls[j] & 0x80)) {
+                bslma::DestructionUtil::destroy(oldEntries + j);
+            }
+        }
+        destroyEntries();
+        d_allocator_p->deallocate(d_entries_p);
+        if (oldEntries) {
+            d_allocator_p->deallocate(oldEntries);
+        }
+        d_entries_p  = 0;
+        d_controls_p = 0;
+        d_capacity   = 0;
+        d_size       = 0;
+        d_numErased  = 0;
+        BSLS_RETHROW;
+    }
+
+    if (oldEntries) {
+        d_allocator_p->deallocate(oldEntries);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::releaseStorage()
+{
+    if (d_entries_p) {
+        d_allocator_p->deallocate(d_entries_p);
+    }
+    d_entries_p  = 0;
+    d_controls_p = 0;
+    d_capacity   = 0;
+    d_size       = 0;
+    d_numErased  = 0;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                                             Uint64 hash) const
+{
+    BSLS_ASSERT_SAFE(d_size < d_capacity);
+
+    const bsl::size_t groupMask = d_capacity / k_GROUP_SIZE - 1;
+    bsl::size_t       group     =
+                     static_cast<bsl::size_t>(hash >> k_HASH_BITS) & groupMask;
+
+    for (bsl::size_t step = 1;; ++step) {
+        const GroupControl control(d_controls_p + group * k_GROUP_SIZE);
+        const BitMask      available = control.available();
+        if (available) {
+            return group * k_GROUP_SIZE                               // RETURN
+                 + bdlb::BitUtil::numTrailingUnsetBits(available);
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
+                                                        const KEY& key,
+                                                        Uint64     hash) const
+{
+    if (0 == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::uint8_t h2        = static_cast<bsl::uint8_t>(hash
+                                                                & k_HASH_MASK);
+    const bsl::size_t  groupMask = d_capacity / k_GROUP_SIZE - 1;
+    bsl::size_t        group     =
+                     static_cast<bsl::size_t>(hash >> k_HASH_BITS) & groupMask;
+
+    // The probe sequence visits every group (the step increasing by one per
+    // group, and the number of groups being a power of two), and the table
+    // always has an empty slot, so the loop terminates.
+
+    for (bsl::size_t step = 1;; ++step) {
+        const bsl::size_t  base = group * k_GROUP_SIZE;
+        const GroupControl control(d_controls_p + base);
+
+        for (BitMask candidates = control.match(h2);
+             candidates;
+             candidates &= candidates - 1) {
+            const bsl::size_t index = base
+                             + bdlb::BitUtil::numTrailingUnsetBits(candidates);
+            if (d_equal(key, ENTRY_UTIL::key(d_entries_p[index]))) {
+                return index;                                         // RETURN
+            }
+        }
+        if (control.containsEmpty()) {
+            return d_capacity;                                        // RETURN
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::Uint64
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hashOf(
+                                                          const KEY& key) const
+{
+    return mix(d_hasher(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+FlatHashTable_IteratorImp<ENTRY>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::impAt(
+                                                       bsl::size_t index) const
+{
+    return FlatHashTable_IteratorImp<ENTRY>(d_entries_p + index,
+                                            d_controls_p + index,
+                                            d_capacity - index);
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        allocate(minimumCapacity(capacity));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                          const FlatHashTable&  original,
+                                          bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (original.d_capacity) {
+        allocate(original.d_capacity);
+        BSLS_TRY {
+            copyEntries(original);
+        }
+        BSLS_CATCH(...) {
+            releaseStorage();
+            BSLS_RETHROW;
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                     bslmf::MovableRef<FlatHashTable> original)
+: d_entries_p(MoveUtil::access(original).d_entries_p)
+, d_controls_p(MoveUtil::access(original).d_controls_p)
+, d_size(MoveUtil::access(original).d_size)
+, d_numErased(MoveUtil::access(original).d_numErased)
+, d_capacity(MoveUtil::access(original).d_capacity)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    FlatHashTable& lvalue = original;
+
+    lvalue.d_entries_p  = 0;
+    lvalue.d_controls_p = 0;
+    lvalue.d_size       = 0;
+    lvalue.d_numErased  = 0;
+    lvalue.d_capacity   = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                             bslmf::MovableRef<FlatHashTable>  original,
+                             bslma::Allocator                 *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    FlatHashTable& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        d_entries_p  = lvalue.d_entries_p;
+        d_controls_p = lvalue.d_controls_p;
+        d_size       = lvalue.d_size;
+        d_numErased  = lvalue.d_numErased;
+        d_capacity   = lvalue.d_capacity;
+
+        lvalue.d_entries_p  = 0;
+        lvalue.d_controls_p = 0;
+        lvalue.d_size       = 0;
+        lvalue.d_numErased  = 0;
+        lvalue.d_capacity   = 0;
+    }
+    else if (lvalue.d_capacity) {
+        allocate(lvalue.d_capacity);
+        BSLS_TRY {
+            copyEntries(lvalue);
+        }
+        BSLS_CATCH(...) {
+            releaseStorage();
+            BSLS_RETHROW;
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    destroyEntries();
+    releaseStorage();
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator_p);
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                          bslmf::MovableRef<FlatHashTable> rhs)
+{
+    FlatHashTable& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatHashTable other(MoveUtil::move(lvalue), d_allocator_p);
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    for (bsl::size_t i = 0; d_size && i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & 0x80)) {
+            return iterator(impAt(i));                                // RETURN
+        }
+    }
+    return end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator(IteratorImp(d_entries_p + d_capacity,
+                                d_controls_p + d_capacity,
+                                0));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    destroyEntries();
+    if (d_capacity) {
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+    }
+    d_size      = 0;
+    d_numErased = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t index = findKey(key, hashOf(key));
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+    eraseSlot(index);
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    IteratorImp       imp   = position.imp();
+    const bsl::size_t index = imp.control() - d_controls_p;
+
+    ++imp;
+    eraseSlot(index);
+    return iterator(imp);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    const bsl::size_t index = findKey(key, hashOf(key));
+    if (index == d_capacity) {
+        return end();                                                 // RETURN
+    }
+    return iterator(impAt(index));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+         bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    FlatHashTable_CopyInserter<ENTRY> inserter(entry);
+
+    const bsl::pair<bsl::size_t, bool> result =
+                                 insertEntry(ENTRY_UTIL::key(entry), inserter);
+
+    return bsl::pair<iterator, bool>(iterator(impAt(result.first)),
+                                     result.second);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+         bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                                bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY& lvalue = entry;
+
+    FlatHashTable_MoveInserter<ENTRY> inserter(lvalue);
+
+    const bsl::pair<bsl::size_t, bool> result =
+                                insertEntry(ENTRY_UTIL::key(lvalue), inserter);
+
+    return bsl::pair<iterator, bool>(iterator(impAt(result.first)),
+                                     result.second);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+         bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insertKey(const KEY& key)
+{
+    FlatHashTable_KeyInserter<KEY, ENTRY, ENTRY_UTIL> inserter(key);
+
+    const bsl::pair<bsl::size_t, bool> result = insertEntry(key, inserter);
+
+    return bsl::pair<iterator, bool>(iterator(impAt(result.first)),
+                                     result.second);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   bsl::size_t minimumCapacity)
+{
+    bsl::size_t capacity = FlatHashTable::minimumCapacity(d_size);
+    while (capacity < minimumCapacity) {
+        capacity *= 2;
+    }
+
+    if (0 == d_size && 0 == minimumCapacity) {
+        reset();
+    }
+    else {
+        rehashRaw(capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    if (maxLoad(d_capacity) < numEntries) {
+        rehashRaw(minimumCapacity(numEntries));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
+{
+    destroyEntries();
+    releaseStorage();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    bslalg::SwapUtil::swap(&d_hasher,       &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,        &other.d_equal);
+    bslalg::SwapUtil::swap(&d_entries_p,    &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p,   &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,         &other.d_size);
+    bslalg::SwapUtil::swap(&d_numErased,    &other.d_numErased);
+    bslalg::SwapUtil::swap(&d_capacity,     &other.d_capacity);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_cast<FlatHashTable *>(this)->begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity()
+                                                                          const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                          const KEY& key) const
+{
+    return d_capacity != findKey(key, hashOf(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_cast<FlatHashTable *>(this)->end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    return const_cast<FlatHashTable *>(this)->find(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const HASH& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hasher() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const EQUAL& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::keyEqual()
+                                                                          const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::loadFactor() const
+{
+    return d_capacity ? static_cast<float>(d_size)
+                                              / static_cast<float>(d_capacity)
+                      : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::maxLoadFactor() const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+                                  // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bdlc::operator==(
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                  const_iterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        const ConstIterator match = rhs.find(ENTRY_UTIL::key(*it));
+        if (match == rhs.end() || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+                FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureA(b,
+                                                               a.allocator());
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureB(a,
+                                                               b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1163 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is an open-addressed hash table, whose primary
+// manipulators are 'insert' and 'erase', and whose basic accessors are
+// 'find', 'size', 'capacity', and the iterators.  The manipulators are
+// verified against an oracle ('bsl::set') for random sequences of operations,
+// using well-distributed and degenerate hash functors (the latter forcing long
+// probe sequences and many key comparisons).  The management of erased slots
+// is verified by observing the capacity during long sequences of insertions
+// and erasures.  The copy, move, assignment, and swap operations are verified
+// for tables using the same, and different, allocators, and exception safety
+// is verified using 'bslma::TestAllocator'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+// [ 5] FlatHashTable(const FlatHashTable&, Allocator * = 0);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable>);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+// [ 2] ~FlatHashTable();
+//
+// MANIPULATORS
+// [ 5] FlatHashTable& operator=(const FlatHashTable&);
+// [ 5] FlatHashTable& operator=(MovableRef<FlatHashTable>);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 4] void clear();
+// [ 2] size_t erase(const KEY&);
+// [ 3] iterator erase(const_iterator);
+// [ 2] iterator find(const KEY&);
+// [ 2] pair<iterator, bool> insert(const ENTRY&);
+// [ 5] pair<iterator, bool> insert(MovableRef<ENTRY>);
+// [ 3] pair<iterator, bool> insertKey(const KEY&);
+// [ 4] void rehash(size_t);
+// [ 4] void reserve(size_t);
+// [ 4] void reset();
+// [ 5] void swap(FlatHashTable&);
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 2] const HASH& hasher() const;
+// [ 2] const EQUAL& keyEqual() const;
+// [ 4] float loadFactor() const;
+// [ 4] float maxLoadFactor() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const FlatHashTable&, const FlatHashTable&);
+// [ 6] bool operator!=(const FlatHashTable&, const FlatHashTable&);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(FlatHashTable&, FlatHashTable&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] ERASED SLOTS
+// [ 7] EXCEPTION SAFETY
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+template <class ENTRY>
+struct IdentityUtil {
+    // This 'struct' provides the entry operations of a table whose entries
+    // are their own keys.
+
+    static const ENTRY& key(const ENTRY& entry)
+    {
+        return entry;
+    }
+
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const ENTRY&      key)
+    {
+        bslma::ConstructionUtil::construct(entry, allocator, key);
+    }
+};
+
+struct PairUtil {
+    // This 'struct' provides the entry operations of a table whose entries
+    // are 'bsl::pair<int, bsl::string>' objects keyed by their first member.
+
+    typedef bsl::pair<int, bsl::string> Entry;
+
+    static const int& key(const Entry& entry)
+    {
+        return entry.first;
+    }
+
+    static void constructFromKey(Entry            *entry,
+                                 bslma::Allocator *allocator,
+                                 const int&        key)
+    {
+        bslma::ConstructionUtil::construct(entry,
+                                           allocator,
+                                           key,
+                                           bsl::string());
+    }
+};
+
+struct ConstantHash {
+    // This hash functor returns the same value for every key, so that every
+    // key has the same probe sequence and control byte.
+
+    bsl::size_t operator()(int) const
+    {
+        return 42;
+    }
+};
+
+struct LowBitsHash {
+    // This hash functor returns one of 8 values, so that many keys share a
+    // probe sequence and control byte.
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key & 7);
+    }
+};
+
+struct StatefulHash {
+    // This hash functor has a state that does not affect its result, used to
+    // verify that the functors are copied and swapped.
+
+    int d_id;
+
+    explicit StatefulHash(int id = 0) : d_id(id)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key);
+    }
+};
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityUtil<int>,
+                            bsl::hash<int>,
+                            bsl::equal_to<int> >      IntTable;
+
+typedef bdlc::FlatHashTable<bsl::string,
+                            bsl::string,
+                            IdentityUtil<bsl::string>,
+                            bsl::hash<bsl::string>,
+                            bsl::equal_to<bsl::string> >
+                                                      StringTable;
+
+typedef bdlc::FlatHashTable<int,
+                            PairUtil::Entry,
+                            PairUtil,
+                            StatefulHash,
+                            bsl::equal_to<int> >      PairTable;
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *seed)
+    // Return the next value of the pseudo-random sequence having the
+    // specified 'seed', and update 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (*seed >> 16) & 0x7FFF;
+}
+
+template <class TABLE>
+static bool matchesOracle(const TABLE& table, const bsl::set<int>& oracle)
+    // Return 'true' if the specified 'table' has exactly the keys of the
+    // specified 'oracle', and 'false' otherwise.
+{
+    if (table.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t count = 0;
+    for (typename TABLE::const_iterator it = table.begin();
+         it != table.end();
+         ++it) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+    if (count != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (bsl::set<int>::const_iterator it = oracle.begin();
+         it != oracle.end();
+         ++it) {
+        if (!table.contains(*it) || *table.find(*it) != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class HASH>
+static void testAgainstOracle(int numKeys, int numOperations, int line)
+    // Apply the specified 'numOperations' random insertions and erasures of
+    // keys in the range '[0, numKeys)' to a table using the (template
+    // parameter) 'HASH' functor, and to an oracle, verifying that they have
+    // the same value after each operation, and reporting failures at the
+    // specified 'line'.
+{
+    typedef bdlc::FlatHashTable<int,
+                                int,
+                                IdentityUtil<int>,
+                                HASH,
+                                bsl::equal_to<int> > Obj;
+
+    bslma::TestAllocator ta("table", veryVeryVeryVerbose);
+    {
+        Obj           mX(0, HASH(), bsl::equal_to<int>(), &ta);
+        const Obj&    X = mX;
+        bsl::set<int> oracle;
+
+        unsigned int seed = 12345u + line;
+        for (int i = 0; i < numOperations; ++i) {
+            const int  key    = static_cast<int>(nextRandom(&seed)) % numKeys;
+            const bool insert = 0 != (nextRandom(&seed) & 1);
+
+            if (insert) {
+                const bool EXP = oracle.insert(key).second;
+
+                const bsl::pair<typename Obj::iterator, bool> RESULT =
+                                                                mX.insert(key);
+
+                ASSERTV(line, i, key, EXP == RESULT.second);
+                ASSERTV(line, i, key, key == *RESULT.first);
+            }
+            else {
+                const bsl::size_t EXP = oracle.erase(key);
+
+                ASSERTV(line, i, key, EXP == mX.erase(key));
+                ASSERTV(line, i, key, X.end() == X.find(key));
+            }
+            ASSERTV(line, i, X.size() == oracle.size());
+            ASSERTV(line, i, X.size() <= X.capacity() - X.capacity() / 8);
+
+            if (0 == i % 64 || i == numOperations - 1) {
+                ASSERTV(line, i, matchesOracle(X, oracle));
+            }
+        }
+    }
+    ASSERTV(line, 0 == ta.numBytesInUse());
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an allocation fails during 'insert' without a rehash, the
+        //:   table is unchanged.
+        //:
+        //: 2 If an allocation fails during a rehash, the table is left empty
+        //:   and no memory is leaked.
+        //:
+        //: 3 If an allocation fails during copy construction, no memory is
+        //:   leaked.
+        //
+        // Plan:
+        //: 1 Using 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*', insert into, and
+        //:   copy, tables of strings that allocate memory, and verify the
+        //:   resulting state, and that no memory is leaked.  (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+        const char *LONG = "a string long enough to allocate memory: ";
+
+        for (int n = 0; n < 40; ++n) {
+            bslma::TestAllocator ta("table", veryVeryVeryVerbose);
+            {
+                StringTable mX(0,
+                               bsl::hash<bsl::string>(),
+                               bsl::equal_to<bsl::string>(),
+                               &ta);
+                const StringTable& X = mX;
+
+                for (int i = 0; i < n; ++i) {
+                    mX.insert(bsl::string(LONG) + static_cast<char>('A' + i));
+                }
+
+                const bsl::size_t CAPACITY = X.capacity();
+                const bsl::string VALUE    = bsl::string(LONG) + "new";
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    if (static_cast<bsl::size_t>(n) != X.size()) {
+                        // A rehash failed, leaving the table empty; refill
+                        // it.
+
+                        ASSERTV(n, 0 == X.size());
+                        for (int i = 0; i < n; ++i) {
+                            mX.insert(bsl::string(LONG)
+                                      + static_cast<char>('A' + i));
+                        }
+                    }
+                    ASSERTV(n, !X.contains(VALUE));
+
+                    mX.insert(VALUE);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(n, static_cast<bsl::size_t>(n + 1) == X.size());
+                ASSERTV(n, X.contains(VALUE));
+                ASSERTV(n, CAPACITY <= X.capacity());
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, X.contains(bsl::string(LONG)
+                                               + static_cast<char>('A' + i)));
+                }
+
+                bslma::TestAllocator sa("copy", veryVeryVeryVerbose);
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    const StringTable Y(X, &sa);
+                    ASSERTV(n, X == Y);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                ASSERTV(n, 0 == sa.numBytesInUse());
+            }
+            ASSERTV(n, 0 == ta.numBytesInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EQUALITY-COMPARISON OPERATORS
+        //
+        // Concerns:
+        //: 1 Two tables are equal if, and only if, they have the same number
+        //:   of entries, and each entry of one has an equal entry (having the
+        //:   same key) in the other.
+        //:
+        //: 2 Equality does not depend on capacity, insertion order, or erased
+        //:   slots.
+        //
+        // Plan:
+        //: 1 Compare tables built in different orders, with different
+        //:   capacities, and differing in keys or in the non-key part of an
+        //:   entry.  (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable&, const FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EQUALITY-COMPARISON OPERATORS" << endl
+                          << "=============================" << endl;
+
+        bslma::TestAllocator ta("table", veryVeryVeryVerbose);
+
+        PairTable mX(0, StatefulHash(), bsl::equal_to<int>(), &ta);
+        PairTable mY(1000, StatefulHash(), bsl::equal_to<int>(), &ta);
+        const PairTable& X = mX;
+        const PairTable& Y = mY;
+
+        ASSERT(X == Y);
+        ASSERT(!(X != Y));
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insert(PairUtil::Entry(i, bsl::string(i % 7, 'x')));
+        }
+        ASSERT(X != Y);
+
+        for (int i = 199; i >= 0; --i) {
+            mY.insert(PairUtil::Entry(i, bsl::string(i % 7, 'x')));
+        }
+        ASSERT(X != Y);
+
+        for (int i = 100; i < 200; ++i) {
+            ASSERT(1 == mY.erase(i));
+        }
+        ASSERT(X == Y);
+        ASSERT(!(X != Y));
+        ASSERT(X.capacity() != Y.capacity());
+
+        mY.find(50)->second = "different";
+        ASSERT(X != Y);
+
+        mY.find(50)->second = X.find(50)->second;
+        ASSERT(X == Y);
+
+        mY.erase(99);
+        mY.insert(PairUtil::Entry(1000, bsl::string(99 % 7, 'x')));
+        ASSERT(X.size() == Y.size());
+        ASSERT(X != Y);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 A copy has the same value, capacity, and functors as the
+        //:   original, and uses the supplied (or default) allocator.
+        //:
+        //: 2 A table moved without a supplied allocator takes the storage
+        //:   and allocator of the original, allocating no memory, and the
+        //:   original is left empty with no capacity.
+        //:
+        //: 3 A table moved with a different allocator copies the original,
+        //:   which is unchanged; with the same allocator it takes the
+        //:   storage of the original.
+        //:
+        //: 4 Assignment does not change the allocator of the target.
+        //:
+        //: 5 'swap' exchanges values and functors without allocating;  the
+        //:   free 'swap' function supports tables using different
+        //:   allocators.
+        //:
+        //: 6 'insert' of a movable reference moves the entry into the table.
+        //
+        // Plan:
+        //: 1 Perform each operation on tables of 'bsl::pair<int, string>'
+        //:   entries, using test allocators, and verify the values,
+        //:   capacities, functors, allocators, and allocations.  (C-1..6)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable&, Allocator * = 0);
+        //   FlatHashTable(MovableRef<FlatHashTable>);
+        //   FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+        //   FlatHashTable& operator=(const FlatHashTable&);
+        //   FlatHashTable& operator=(MovableRef<FlatHashTable>);
+        //   pair<iterator, bool> insert(MovableRef<ENTRY>);
+        //   void swap(FlatHashTable&);
+        //   void swap(FlatHashTable&, FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, ASSIGNMENT, AND SWAP" << endl
+                          << "================================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        const char *LONG = "a string long enough to allocate memory";
+
+        bslma::TestAllocator ta("a", veryVeryVeryVerbose);
+        bslma::TestAllocator tb("b", veryVeryVeryVerbose);
+
+        PairTable mX(0, StatefulHash(1), bsl::equal_to<int>(), &ta);
+        const PairTable& X = mX;
+        for (int i = 0; i < 50; ++i) {
+            mX.insert(PairUtil::Entry(i, LONG));
+        }
+        for (int i = 0; i < 50; i += 3) {
+            mX.erase(i);
+        }
+
+        if (verbose) cout << "\tCopy construction." << endl;
+        {
+            const PairTable Y(X, &tb);
+
+            ASSERT(X == Y);
+            ASSERT(X.capacity() == Y.capacity());
+            ASSERT(1   == Y.hasher().d_id);
+            ASSERT(&tb == Y.allocator());
+            ASSERT(0   <  tb.numBytesInUse());
+
+            const PairTable Z(X);
+            ASSERT(X   == Z);
+            ASSERT(&da == Z.allocator());
+        }
+        ASSERT(0 == tb.numBytesInUse());
+        ASSERT(0 == da.numBytesInUse());
+
+        if (verbose) cout << "\tMove construction." << endl;
+        {
+            PairTable mW(X, &ta);  const PairTable& W = mW;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+            const bsl::size_t        CAPACITY        = W.capacity();
+
+            PairTable mY(MoveUtil::move(mW));  const PairTable& Y = mY;
+
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(X        == Y);
+            ASSERT(CAPACITY == Y.capacity());
+            ASSERT(&ta      == Y.allocator());
+            ASSERT(0        == W.size());
+            ASSERT(0        == W.capacity());
+            ASSERT(&ta      == W.allocator());
+
+            // Same allocator: storage moved.
+
+            PairTable mZ(MoveUtil::move(mY), &ta);  const PairTable& Z = mZ;
+
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(X == Z);
+            ASSERT(0 == Y.size());
+
+            // Different allocator: entries copied.
+
+            PairTable mV(MoveUtil::move(mZ), &tb);  const PairTable& V = mV;
+
+            ASSERT(X   == V);
+            ASSERT(X   == Z);
+            ASSERT(&tb == V.allocator());
+            ASSERT(0   <  tb.numBytesInUse());
+        }
+        ASSERT(0 == tb.numBytesInUse());
+
+        if (verbose) cout << "\tAssignment." << endl;
+        {
+            PairTable mY(0, StatefulHash(2), bsl::equal_to<int>(), &tb);
+            const PairTable& Y = mY;
+            mY.insert(PairUtil::Entry(1000, LONG));
+
+            mY = X;
+            ASSERT(X   == Y);
+            ASSERT(1   == Y.hasher().d_id);
+            ASSERT(&tb == Y.allocator());
+
+            mY = Y;
+            ASSERT(X   == Y);
+
+            PairTable mZ(X, &ta);  const PairTable& Z = mZ;
+
+            mY = MoveUtil::move(mZ);  // different allocator: copy
+            ASSERT(X   == Y);
+            ASSERT(X   == Z);
+            ASSERT(&tb == Y.allocator());
+
+            PairTable mW(X, &tb);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = tb.numAllocations();
+
+            mY = MoveUtil::move(mW);  // same allocator: move
+            ASSERT(NUM_ALLOCATIONS == tb.numAllocations());
+            ASSERT(X == Y);
+        }
+        ASSERT(0 == tb.numBytesInUse());
+
+        if (verbose) cout << "\tSwap." << endl;
+        {
+            PairTable mY(0, StatefulHash(2), bsl::equal_to<int>(), &ta);
+            const PairTable& Y = mY;
+            mY.insert(PairUtil::Entry(1000, LONG));
+
+            const PairTable XX(X, &ta);
+            const PairTable YY(Y, &ta);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            mX.swap(mY);
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(XX == Y);
+            ASSERT(YY == X);
+            ASSERT(2  == X.hasher().d_id);
+            ASSERT(1  == Y.hasher().d_id);
+
+            swap(mX, mY);
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(XX == X);
+            ASSERT(YY == Y);
+
+            PairTable mZ(0, StatefulHash(3), bsl::equal_to<int>(), &tb);
+            const PairTable& Z = mZ;
+
+            swap(mX, mZ);
+            ASSERT(XX  == Z);
+            ASSERT(0   == X.size());
+            ASSERT(&ta == X.allocator());
+            ASSERT(&tb == Z.allocator());
+
+            swap(mX, mZ);
+            ASSERT(XX  == X);
+            ASSERT(0   == Z.size());
+
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(mX.swap(mZ));
+            ASSERT_PASS(mX.swap(mY));
+        }
+
+        if (verbose) cout << "\tInserting a movable entry." << endl;
+        {
+            PairUtil::Entry entry(2000, LONG, &ta);
+
+            mX.reserve(X.size() + 1);
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            ASSERT(mX.insert(MoveUtil::move(entry)).second);
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(LONG == X.find(2000)->second);
+
+            PairUtil::Entry other(2000, "other", &ta);
+            ASSERT(!mX.insert(MoveUtil::move(other)).second);
+            ASSERT("other" == other.second);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANAGEMENT
+        //
+        // Concerns:
+        //: 1 The capacity is 0 or a power of two of at least 16, and the
+        //:   number of entries never exceeds 7/8 of the capacity.
+        //:
+        //: 2 'reserve' makes room for the specified number of entries, so
+        //:   that inserting them does not rehash.
+        //:
+        //: 3 'rehash' keeps the entries, and may reduce the capacity.
+        //:
+        //: 4 'clear' keeps the capacity; 'reset' releases it.
+        //:
+        //: 5 'loadFactor' and 'maxLoadFactor' report the expected values.
+        //
+        // Plan:
+        //: 1 Exercise each method, and verify the capacity, entries, and
+        //:   allocations.  (C-1..5)
+        //
+        // Testing:
+        //   void clear();
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   float loadFactor() const;
+        //   float maxLoadFactor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CAPACITY MANAGEMENT" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("table", veryVeryVeryVerbose);
+
+        IntTable mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+        const IntTable& X = mX;
+
+        ASSERT(0      == X.capacity());
+        ASSERT(0.0f   == X.loadFactor());
+        ASSERT(0.875f == X.maxLoadFactor());
+        ASSERT(0      == ta.numAllocations());
+
+        for (int i = 0; i < 1000; ++i) {
+            mX.insert(i);
+
+            const bsl::size_t CAPACITY = X.capacity();
+            ASSERTV(i, 16 <= CAPACITY);
+            ASSERTV(i, 0 == (CAPACITY & (CAPACITY - 1)));
+            ASSERTV(i, X.size() <= CAPACITY - CAPACITY / 8);
+        }
+        ASSERT(1024 == X.size() + 24);
+        ASSERT(2048 == X.capacity());
+        ASSERT(1000.0f / 2048.0f == X.loadFactor());
+
+        mX.rehash(0);
+        ASSERT(2048 == X.capacity());   // 1000 entries need 2048 slots
+
+        for (int i = 100; i < 1000; ++i) {
+            mX.erase(i);
+        }
+        mX.rehash(0);
+        ASSERT(128 == X.capacity());
+        ASSERT(100 == X.size());
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, X.contains(i));
+        }
+
+        mX.rehash(1000);
+        ASSERT(1024 == X.capacity());
+        ASSERT(100  == X.size());
+
+        mX.reserve(5000);
+        const bsl::size_t        CAPACITY        = X.capacity();
+        const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+        ASSERT(5000 <= CAPACITY - CAPACITY / 8);
+
+        for (int i = 0; i < 5000; ++i) {
+            mX.insert(i);
+        }
+        ASSERT(CAPACITY        == X.capacity());
+        ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+
+        mX.reserve(10);
+        ASSERT(CAPACITY == X.capacity());
+
+        mX.clear();
+        ASSERT(0        == X.size());
+        ASSERT(CAPACITY == X.capacity());
+        ASSERT(X.begin() == X.end());
+        ASSERT(!X.contains(1));
+
+        mX.insert(1);
+        ASSERT(1 == X.size());
+
+        mX.reset();
+        ASSERT(0 == X.size());
+        ASSERT(0 == X.capacity());
+        ASSERT(0 == ta.numBytesInUse());
+
+        mX.rehash(0);
+        ASSERT(0 == X.capacity());
+
+        mX.rehash(1);
+        ASSERT(16 == X.capacity());
+
+        mX.reset();
+
+        for (bsl::size_t n = 0; n < 200; ++n) {
+            IntTable mY(n, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const IntTable& Y = mY;
+
+            const bsls::Types::Int64 NUM = ta.numAllocations();
+            for (bsl::size_t i = 0; i < n; ++i) {
+                mY.insert(static_cast<int>(i));
+            }
+            ASSERTV(n, NUM == ta.numAllocations());
+            ASSERTV(n, n == Y.size());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ERASED SLOTS
+        //
+        // Concerns:
+        //: 1 A long sequence of insertions and erasures that keeps the number
+        //:   of entries bounded does not grow the capacity without bound.
+        //:
+        //: 2 Erasing through an iterator returns an iterator to the next
+        //:   entry, and iteration while erasing visits every entry once.
+        //:
+        //: 3 'insertKey' inserts an entry constructed from the key only if
+        //:   the key is not present.
+        //:
+        //: 4 Searches remain correct when probe sequences pass over erased
+        //:   slots.
+        //
+        // Plan:
+        //: 1 Repeatedly insert a new key and erase the oldest key, and verify
+        //:   the capacity stays bounded.  (C-1, 4)
+        //:
+        //: 2 Erase every other entry while iterating, and verify the
+        //:   remaining entries.  (C-2)
+        //:
+        //: 3 Call 'insertKey' for present and absent keys.  (C-3)
+        //:
+        //: 4 Use a degenerate hash functor, so that all keys share a probe
+        //:   sequence, erase entries, and verify all searches.  (C-4)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   pair<iterator, bool> insertKey(const KEY&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERASED SLOTS" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator ta("table", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tChurn keeps the capacity bounded." << endl;
+        {
+            IntTable mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const IntTable& X = mX;
+
+            const int WINDOW = 100;
+            for (int i = 0; i < WINDOW; ++i) {
+                mX.insert(i);
+            }
+            const bsl::size_t CAPACITY = X.capacity();
+
+            for (int i = WINDOW; i < 100000; ++i) {
+                ASSERTV(i, mX.insert(i).second);
+                ASSERTV(i, 1 == mX.erase(i - WINDOW));
+                ASSERTV(i, static_cast<bsl::size_t>(WINDOW) == X.size());
+                ASSERTV(i, X.capacity() <= 2 * CAPACITY);
+            }
+            for (int i = 100000 - WINDOW; i < 100000; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+            ASSERT(!X.contains(100000 - WINDOW - 1));
+        }
+
+        if (verbose) cout << "\tErasing while iterating." << endl;
+        {
+            IntTable mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const IntTable& X = mX;
+
+            for (int i = 0; i < 500; ++i) {
+                mX.insert(i);
+            }
+
+            bsl::set<int> visited;
+            for (IntTable::iterator it = mX.begin(); it != mX.end();) {
+                ASSERT(visited.insert(*it).second);
+                if (*it % 2) {
+                    it = mX.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERT(500 == visited.size());
+            ASSERT(250 == X.size());
+            for (int i = 0; i < 500; ++i) {
+                ASSERTV(i, (0 == i % 2) == X.contains(i));
+            }
+
+            for (IntTable::iterator it = mX.begin(); it != mX.end();) {
+                it = mX.erase(it);
+            }
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+        }
+
+        if (verbose) cout << "\t'insertKey'." << endl;
+        {
+            PairTable mX(0, StatefulHash(), bsl::equal_to<int>(), &ta);
+            const PairTable& X = mX;
+
+            bsl::pair<PairTable::iterator, bool> result = mX.insertKey(5);
+            ASSERT(result.second);
+            ASSERT(5  == result.first->first);
+            ASSERT("" == result.first->second);
+
+            result.first->second = "five";
+
+            result = mX.insertKey(5);
+            ASSERT(!result.second);
+            ASSERT("five" == result.first->second);
+            ASSERT(1 == X.size());
+        }
+
+        if (verbose) cout << "\tDegenerate hash." << endl;
+        {
+            typedef bdlc::FlatHashTable<int,
+                                        int,
+                                        IdentityUtil<int>,
+                                        ConstantHash,
+                                        bsl::equal_to<int> > Obj;
+
+            Obj mX(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            for (int i = 0; i < 200; ++i) {
+                mX.insert(i);
+            }
+            for (int i = 0; i < 200; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            for (int i = 0; i < 200; ++i) {
+                ASSERTV(i, (1 == i % 2) == X.contains(i));
+            }
+            for (int i = 0; i < 200; i += 2) {
+                ASSERTV(i, mX.insert(i).second);
+            }
+            for (int i = 0; i < 200; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+            ASSERT(200 == X.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 'insert' adds an entry only if its key is absent, and returns an
+        //:   iterator to the entry having the key.
+        //:
+        //: 2 'erase' removes the entry having the key, if any, and returns
+        //:   the number of entries removed.
+        //:
+        //: 3 'find', 'contains', 'size', and iteration reflect the entries of
+        //:   the table.
+        //:
+        //: 4 The table behaves correctly for degenerate hash functors.
+        //:
+        //: 5 All memory is supplied by the specified allocator, and released
+        //:   on destruction.
+        //
+        // Plan:
+        //: 1 Apply random sequences of insertions and erasures to tables and
+        //:   to an oracle ('bsl::set'), for various key ranges and hash
+        //:   functors, verifying their values agree.  (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+        //   ~FlatHashTable();
+        //   iterator begin();
+        //   iterator end();
+        //   size_t erase(const KEY&);
+        //   iterator find(const KEY&);
+        //   pair<iterator, bool> insert(const ENTRY&);
+        //   const_iterator begin() const;
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   const_iterator end() const;
+        //   const_iterator find(const KEY&) const;
+        //   const HASH& hasher() const;
+        //   const EQUAL& keyEqual() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                        << "========================================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_numKeys;
+            int d_numOperations;
+        } DATA[] = {
+            //LINE  NUM KEYS  NUM OPERATIONS
+            //----  --------  --------------
+            { L_,          1,            100 },
+            { L_,         16,           1000 },
+            { L_,        100,           5000 },
+            { L_,       1000,          20000 },
+            { L_,      10000,          50000 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int NUM_KEYS = DATA[ti].d_numKeys;
+            const int NUM_OPS  = DATA[ti].d_numOperations;
+
+            if (veryVerbose) { T_ P_(LINE) P_(NUM_KEYS) P(NUM_OPS) }
+
+            testAgainstOracle<bsl::hash<int> >(NUM_KEYS, NUM_OPS, LINE);
+            testAgainstOracle<LowBitsHash>(NUM_KEYS, NUM_OPS, LINE);
+            if (NUM_KEYS <= 1000) {
+                testAgainstOracle<ConstantHash>(NUM_KEYS, NUM_OPS, LINE);
+            }
+        }
+
+        if (verbose) cout << "\tFunctors and allocator." << endl;
+        {
+            bslma::TestAllocator ta("table", veryVeryVeryVerbose);
+
+            PairTable mX(0, StatefulHash(7), bsl::equal_to<int>(), &ta);
+            const PairTable& X = mX;
+
+            ASSERT(7   == X.hasher().d_id);
+            ASSERT(&ta == X.allocator());
+            ASSERT(X.keyEqual()(1, 1));
+            ASSERT(0   == ta.numAllocations());
+
+            mX.insert(PairUtil::Entry(1, "a string long enough to allocate"));
+            ASSERT(0 <  ta.numBytesInUse());
+            ASSERT(0 == da.numBytesInUse());
+
+            const IntTable Y(0, bsl::hash<int>(), bsl::equal_to<int>());
+            ASSERT(&da == Y.allocator());
+
+            const IntTable Z(100, bsl::hash<int>(), bsl::equal_to<int>());
+            ASSERT(128 == Z.capacity());
+            ASSERT(0   <  da.numBytesInUse());
+        }
+        ASSERT(0 == da.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few entries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("table", veryVeryVeryVerbose);
+        {
+            IntTable mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &ta);
+            const IntTable& X = mX;
+
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end() == X.find(1));
+            ASSERT(0 == mX.erase(1));
+
+            ASSERT(true  == mX.insert(1).second);
+            ASSERT(false == mX.insert(1).second);
+            ASSERT(true  == mX.insert(2).second);
+
+            ASSERT(2  == X.size());
+            ASSERT(16 == X.capacity());
+            ASSERT(1  == *X.find(1));
+            ASSERT(X.contains(2));
+            ASSERT(!X.contains(3));
+
+            int sum = 0;
+            for (IntTable::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                sum += *it;
+            }
+            ASSERT(3 == sum);
+
+            ASSERT(1 == mX.erase(1));
+            ASSERT(0 == mX.erase(1));
+            ASSERT(1 == X.size());
+            ASSERT(!X.contains(1));
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(100 == X.size());
+            ASSERT(128 == X.capacity());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
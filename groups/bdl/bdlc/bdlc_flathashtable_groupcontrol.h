@@ -0,0 +1,206 @@
+// bdlc_flathashtable_groupcontrol.h                                  -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+#define INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide inquiries to a flat hash table group of control bytes.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable_GroupControl: flat hash table group control inquiries
+//
+//@SEE_ALSO: bdlc_flathashtable
+//
+//@DESCRIPTION: This component provides a class,
+// 'bdlc::FlatHashTable_GroupControl', that answers inquiries on a group of
+// 'k_SIZE' (i.e., 16) control bytes of a 'bdlc::FlatHashTable'.  Each control
+// byte describes one slot of the table: a byte having its most-significant bit
+// unset indicates a slot that is in use, and holds 7 bits of the hash value of
+// the key of the slot's entry; otherwise the byte is one of the values
+// 'k_EMPTY' (a slot that has never been used since the last rehash) or
+// 'k_ERASED' (a slot whose entry was removed).  The inquiries return a bit
+// mask having bit 'i' set if byte 'i' of the group satisfies the inquiry.
+//
+// On platforms supporting SSE2 (i.e., all x86-64 platforms) each inquiry is
+// performed on the whole group with a few vector instructions; otherwise the
+// bytes are examined individually.
+//
+// This class is an implementation detail of 'bdlc::FlatHashTable' and should
+// not be used directly.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bdlc_flathashtable' and is
+// *not* intended for direct client use.  It is subject to change without
+// notice.  As such, a usage example is not provided.
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ================================
+                     // class FlatHashTable_GroupControl
+                     // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides inquiries on a group of 'k_SIZE' control bytes of a
+    // flat hash table.  The state of an object of this class is loaded on
+    // construction; subsequent changes to the underlying control bytes are not
+    // reflected.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::uint32_t BitMask;  // bit 'i' describes control byte 'i'
+
+    // PUBLIC CLASS DATA
+    static const bsl::uint8_t k_EMPTY  = 0x80;  // slot never used since the
+                                                // last rehash
+
+    static const bsl::uint8_t k_ERASED = 0xFE;  // slot whose entry was removed
+
+    static const bsl::size_t  k_SIZE   = 16;    // number of control bytes in a
+                                                // group
+
+  private:
+    // DATA
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
+    __m128i      d_value;          // the control bytes of the group
+#else
+    bsl::uint8_t d_value[k_SIZE];  // the control bytes of the group
+#endif
+
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl();
+    FlatHashTable_GroupControl(const FlatHashTable_GroupControl&);
+    FlatHashTable_GroupControl& operator=(const FlatHashTable_GroupControl&);
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const bsl::uint8_t *controls);
+        // Create an object providing inquiries on the 'k_SIZE' control bytes
+        // starting at the specified 'controls' address.  The behavior is
+        // undefined unless 'controls' refers to at least 'k_SIZE' bytes.
+
+    //! ~FlatHashTable_GroupControl() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    BitMask available() const;
+        // Return a bit mask of the control bytes indicating a slot that is not
+        // in use (i.e., having the value 'k_EMPTY' or 'k_ERASED').
+
+    bool containsEmpty() const;
+        // Return 'true' if any of the control bytes has the value 'k_EMPTY',
+        // and 'false' otherwise.
+
+    BitMask inUse() const;
+        // Return a bit mask of the control bytes indicating a slot that is in
+        // use.
+
+    BitMask match(bsl::uint8_t value) const;
+        // Return a bit mask of the control bytes having the specified 'value'.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // class FlatHashTable_GroupControl
+                     // --------------------------------
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                  const bsl::uint8_t *controls)
+{
+    BSLS_ASSERT_SAFE(controls);
+
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
+    d_value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(controls));
+#else
+    bsl::memcpy(d_value, controls, k_SIZE);
+#endif
+}
+
+// ACCESSORS
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::available() const
+{
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
+    return static_cast<BitMask>(_mm_movemask_epi8(d_value));
+#else
+    BitMask mask = 0;
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        mask |= static_cast<BitMask>(d_value[i] >> 7) << i;
+    }
+    return mask;
+#endif
+}
+
+inline
+bool FlatHashTable_GroupControl::containsEmpty() const
+{
+    return 0 != match(k_EMPTY);
+}
+
+inline
+FlatHashTable_GroupControl::BitMask FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & ((1u << k_SIZE) - 1);
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+    return static_cast<BitMask>(
+                         _mm_movemask_epi8(_mm_cmpeq_epi8(d_value, pattern)));
+#else
+    BitMask mask = 0;
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        mask |= static_cast<BitMask>(value == d_value[i]) << i;
+    }
+    return mask;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,346 @@
+// bdlc_flathashtable_groupcontrol.t.cpp                              -*-C++-*-
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides inquiries on a group of control bytes.
+// The inquiries are verified against an oracle that examines the bytes
+// individually, for a table of control byte patterns and for exhaustively
+// varied single bytes.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit FlatHashTable_GroupControl(const bsl::uint8_t *controls);
+//
+// ACCESSORS
+// [ 2] BitMask available() const;
+// [ 2] bool containsEmpty() const;
+// [ 2] BitMask inUse() const;
+// [ 2] BitMask match(bsl::uint8_t value) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable_GroupControl Obj;
+typedef Obj::BitMask                     BitMask;
+
+const bsl::size_t  SIZE   = Obj::k_SIZE;
+const bsl::uint8_t EMPTY  = Obj::k_EMPTY;
+const bsl::uint8_t ERASED = Obj::k_ERASED;
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static BitMask oracleMatch(const bsl::uint8_t *controls, bsl::uint8_t value)
+    // Return the bit mask of the 'SIZE' bytes at the specified 'controls'
+    // address having the specified 'value'.
+{
+    BitMask mask = 0;
+    for (bsl::size_t i = 0; i < SIZE; ++i) {
+        if (value == controls[i]) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+static BitMask oracleInUse(const bsl::uint8_t *controls)
+    // Return the bit mask of the 'SIZE' bytes at the specified 'controls'
+    // address indicating a slot that is in use.
+{
+    BitMask mask = 0;
+    for (bsl::size_t i = 0; i < SIZE; ++i) {
+        if (0 == (controls[i] & 0x80)) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+static void verify(const bsl::uint8_t *controls, int line)
+    // Verify the inquiries of a group control for the 'SIZE' bytes at the
+    // specified 'controls' address against the oracle, reporting failures at
+    // the specified 'line'.
+{
+    const Obj X(controls);
+
+    const BitMask IN_USE = oracleInUse(controls);
+
+    ASSERTV(line, IN_USE == X.inUse());
+    ASSERTV(line, (~IN_USE & 0xFFFF) == X.available());
+    ASSERTV(line, (0 != oracleMatch(controls, EMPTY)) == X.containsEmpty());
+
+    for (int value = 0; value < 256; ++value) {
+        const bsl::uint8_t V = static_cast<bsl::uint8_t>(value);
+        ASSERTV(line, value, oracleMatch(controls, V) == X.match(V));
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test    = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING INQUIRIES
+        //
+        // Concerns:
+        //: 1 Each inquiry returns a bit mask having bit 'i' set if, and only
+        //:   if, control byte 'i' satisfies the inquiry.
+        //:
+        //: 2 The control bytes need not be aligned.
+        //:
+        //: 3 Changes to the control bytes after construction do not affect
+        //:   the inquiries.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the inquiries against
+        //:   an oracle for a set of control byte patterns, at every offset
+        //:   of a buffer.  (C-1..2)
+        //:
+        //: 2 Set each byte of a group, in turn, to each possible value, and
+        //:   verify the inquiries against the oracle.  (C-1)
+        //:
+        //: 3 Modify the control bytes after creating a group control, and
+        //:   verify the inquiries are unchanged.  (C-3)
+        //
+        // Testing:
+        //   explicit FlatHashTable_GroupControl(const bsl::uint8_t *controls);
+        //   BitMask available() const;
+        //   bool containsEmpty() const;
+        //   BitMask inUse() const;
+        //   BitMask match(bsl::uint8_t value) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING INQUIRIES" << endl
+                          << "=================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_pattern_p;  // 'E' empty, 'X' erased, 'a'-'p' in use
+        } DATA[] = {
+            //LINE  PATTERN
+            //----  ----------------
+            { L_,   "EEEEEEEEEEEEEEEE" },
+            { L_,   "XXXXXXXXXXXXXXXX" },
+            { L_,   "abcdefghijklmnop" },
+            { L_,   "aaaaaaaaaaaaaaaa" },
+            { L_,   "aEbXcEdXeEfXgEhX" },
+            { L_,   "EaaaaaaaaaaaaaaE" },
+            { L_,   "XaaaaaaaaaaaaaaX" },
+            { L_,   "aXXXXXXXXXXXXXXE" },
+            { L_,   "pEEEEEEEEEEEEEEa" },
+            { L_,   "aXaXaXaXaXaXaXaX" },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_line;
+            const char *PATTERN = DATA[ti].d_pattern_p;
+
+            for (bsl::size_t offset = 0; offset < SIZE; ++offset) {
+                bsl::uint8_t buffer[2 * 16];
+                bsl::memset(buffer, 0xAA, sizeof buffer);
+
+                bsl::uint8_t *controls = buffer + offset;
+                for (bsl::size_t i = 0; i < SIZE; ++i) {
+                    const char c = PATTERN[i];
+                    controls[i] = 'E' == c
+                                ? EMPTY
+                                : 'X' == c
+                                ? ERASED
+                                : static_cast<bsl::uint8_t>(c - 'a' + 0x10);
+                }
+                verify(controls, LINE);
+            }
+        }
+
+        if (verbose) cout << "\nVarying each byte." << endl;
+        {
+            bsl::uint8_t controls[16];
+
+            for (bsl::size_t i = 0; i < SIZE; ++i) {
+                for (int value = 0; value < 256; ++value) {
+                    bsl::memset(controls, EMPTY, sizeof controls);
+                    controls[i] = static_cast<bsl::uint8_t>(value);
+                    verify(controls, L_);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nModifying bytes after construction." << endl;
+        {
+            bsl::uint8_t controls[16];
+            bsl::memset(controls, EMPTY, sizeof controls);
+
+            const Obj X(controls);
+
+            bsl::memset(controls, 0x11, sizeof controls);
+
+            ASSERT(0      == X.inUse());
+            ASSERT(0xFFFF == X.available());
+            ASSERT(0xFFFF == X.match(EMPTY));
+            ASSERT(0      == X.match(0x11));
+            ASSERT(X.containsEmpty());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a group control for a few control byte patterns and
+        //:   verify the results of the inquiries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsl::uint8_t controls[16];
+
+        bsl::memset(controls, EMPTY, sizeof controls);
+        {
+            const Obj X(controls);
+
+            ASSERT(0      == X.inUse());
+            ASSERT(0xFFFF == X.available());
+            ASSERT(0xFFFF == X.match(EMPTY));
+            ASSERT(0      == X.match(ERASED));
+            ASSERT(0      == X.match(0));
+            ASSERT(X.containsEmpty());
+        }
+
+        controls[0]  = 0x05;
+        controls[3]  = 0x7F;
+        controls[7]  = ERASED;
+        controls[15] = 0x05;
+        {
+            const Obj X(controls);
+
+            ASSERT(0x8009 == X.inUse());
+            ASSERT(0x7FF6 == X.available());
+            ASSERT(0x8001 == X.match(0x05));
+            ASSERT(0x0008 == X.match(0x7F));
+            ASSERT(0x0080 == X.match(ERASED));
+            ASSERT(0x7F76 == X.match(EMPTY));
+            ASSERT(X.containsEmpty());
+        }
+
+        bsl::memset(controls, ERASED, sizeof controls);
+        {
+            const Obj X(controls);
+
+            ASSERT(0      == X.inUse());
+            ASSERT(0xFFFF == X.available());
+            ASSERT(!X.containsEmpty());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
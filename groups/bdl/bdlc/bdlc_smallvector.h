@@ -0,0 +1,1324 @@
+// bdlc_smallvector.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_SMALLVECTOR
+#define INCLUDED_BDLC_SMALLVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector having capacity for a few elements in place.
+//
+//@CLASSES:
+//  bdlc::SmallVector: vector with inline capacity for a few elements
+//
+//@SEE_ALSO: bsl_vector
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::SmallVector', a sequence container, similar to 'bsl::vector', having
+// storage for up to 'INLINE_CAPACITY' elements within the object itself.  A
+// 'bdlc::SmallVector' allocates memory only when its size exceeds its inline
+// capacity, so that short-lived vectors that typically hold only a few
+// elements (e.g., lists of fields, attributes, or options) can be created,
+// populated, and destroyed without using an allocator at all.
+//
+// Once a 'bdlc::SmallVector' has allocated memory it behaves as a
+// 'bsl::vector' (growing geometrically) until 'shrink_to_fit' is called, which
+// returns the elements to the inline storage if they fit.
+//
+// The elements are constructed, relocated, and destroyed using
+// 'bslalg::ArrayPrimitives', so that elements of a type that uses
+// 'bslma::Allocator' are supplied the allocator of the vector, and elements of
+// a bitwise-moveable type are relocated (e.g., when the vector grows) using
+// 'memcpy'.
+//
+// The interface of 'bdlc::SmallVector' is a subset of that of 'bsl::vector',
+// with the following notable differences:
+//
+//: o Moving or swapping a vector whose elements are held in the inline
+//:   storage moves (or swaps) the elements individually; it is therefore
+//:   linear in the size of the vector, and invalidates iterators, pointers,
+//:   and references to the elements.  (Moving or swapping vectors whose
+//:   elements are held in allocated memory is constant-time.)
+//:
+//: o The vector uses 'bslma::Allocator *' to supply memory.  A vector created
+//:   by copy construction does not propagate the allocator of the original
+//:   vector, while a vector created by move construction without a specified
+//:   allocator does.  Assignment never changes the allocator of a vector, and
+//:   'swap' requires that both vectors use the same allocator.
+//:
+//: o 'bdlc::SmallVector' is not bitwise-moveable (because it may refer to its
+//:   own inline storage), regardless of the element type.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting the Fields of a Record
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we parse records having a few comma-separated fields, and want to
+// collect the offsets of the fields of each record.  Most records have at most
+// 8 fields, so we use a 'bdlc::SmallVector' having an inline capacity of 8 to
+// avoid allocating memory for each record.
+//
+// First, we define a function that loads the offsets of the fields of a
+// record:
+//..
+//  void loadFieldOffsets(bdlc::SmallVector<bsl::size_t, 8> *offsets,
+//                        const char                        *record)
+//      // Load into the specified 'offsets' the offset of each field of the
+//      // specified comma-separated 'record'.
+//  {
+//      offsets->clear();
+//      offsets->push_back(0);
+//      for (const char *p = record; *p; ++p) {
+//          if (',' == *p) {
+//              offsets->push_back(p - record + 1);
+//          }
+//      }
+//  }
+//..
+// Then, we create a test allocator, and a vector using it:
+//..
+//  bslma::TestAllocator              allocator;
+//  bdlc::SmallVector<bsl::size_t, 8> offsets(&allocator);
+//..
+// Next, we collect the offsets of the fields of a record having 4 fields, and
+// observe that no memory is allocated:
+//..
+//  loadFieldOffsets(&offsets, "IBM,100,123.45,NYSE");
+//
+//  assert(4  == offsets.size());
+//  assert(4  == offsets[1]);
+//  assert(15 == offsets[3]);
+//  assert(0  == allocator.numAllocations());
+//..
+// Finally, we collect the offsets of the fields of a record having 10 fields,
+// which exceeds the inline capacity, and observe that memory is allocated:
+//..
+//  loadFieldOffsets(&offsets, "a,b,c,d,e,f,g,h,i,j");
+//
+//  assert(10 == offsets.size());
+//  assert(18 == offsets[9]);
+//  assert(1  == allocator.numAllocations());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_autoarraydestructor.h>
+#include <bslalg_rangecompare.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_review.h>
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                            // =================
+                            // class SmallVector
+                            // =================
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+class SmallVector {
+    // This class template provides a sequence container of elements of the
+    // (template parameter) 'TYPE', having storage for up to the (template
+    // parameter) 'INLINE_CAPACITY' elements within the object itself.  Memory
+    // is allocated only if the size of the vector exceeds 'INLINE_CAPACITY'.
+
+    BSLMF_ASSERT(0 < INLINE_CAPACITY);
+
+    // PRIVATE TYPES
+    typedef bslalg::ArrayPrimitives  ArrayPrimitives;
+    typedef bslmf::MovableRefUtil    MoveUtil;
+
+    // DATA
+    bsls::AlignedBuffer<static_cast<int>(INLINE_CAPACITY * sizeof(TYPE)),
+                        bsls::AlignmentFromType<TYPE>::VALUE>
+                      d_inlineBuffer;  // storage for 'INLINE_CAPACITY'
+                                       // elements
+
+    TYPE             *d_data_p;        // address of the elements (either
+                                       // 'd_inlineBuffer' or allocated memory)
+
+    bsl::size_t       d_size;          // number of elements
+
+    bsl::size_t       d_capacity;      // number of elements for which there
+                                       // is storage at 'd_data_p'
+
+    bslma::Allocator *d_allocator_p;   // memory allocator (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    TYPE *allocateStorage(bsl::size_t capacity);
+        // Return the address of uninitialized memory, supplied by the
+        // allocator of this vector, for the specified 'capacity' elements.
+
+    TYPE *inlineData();
+        // Return the address of the inline storage of this vector.
+
+    void moveFrom(SmallVector *original);
+        // Move the elements of the specified 'original' vector, which uses
+        // the same allocator as this vector, into this vector, which is
+        // empty.  If 'original' holds its elements in allocated memory, that
+        // memory is transferred to this vector (and any memory allocated by
+        // this vector is released); otherwise the elements are relocated into
+        // the existing storage of this vector.  'original' is left empty (and
+        // holding no allocated memory).
+
+    void reallocate(bsl::size_t newCapacity);
+        // Relocate the elements of this vector into storage for the specified
+        // 'newCapacity' elements, which is the inline storage if
+        // 'newCapacity' is 'INLINE_CAPACITY', and allocated memory
+        // otherwise, and release any memory previously allocated.  The
+        // behavior is undefined unless 'size() <= newCapacity' and
+        // 'INLINE_CAPACITY <= newCapacity'.
+
+    void releaseStorage();
+        // Release any memory allocated for the elements of this vector, and
+        // use the inline storage.  The behavior is undefined unless this
+        // vector is empty.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t grownCapacity(bsl::size_t minimumCapacity) const;
+        // Return the capacity to which this vector grows to hold at least the
+        // specified 'minimumCapacity' elements.
+
+    const TYPE *inlineData() const;
+        // Return the address of the inline storage of this vector.
+
+  public:
+    // PUBLIC TYPES
+    typedef TYPE                value_type;
+    typedef TYPE&               reference;
+    typedef const TYPE&         const_reference;
+    typedef TYPE               *pointer;
+    typedef const TYPE         *const_pointer;
+    typedef TYPE               *iterator;
+    typedef const TYPE         *const_iterator;
+    typedef bsl::size_t         size_type;
+    typedef bsl::ptrdiff_t      difference_type;
+
+    enum { k_INLINE_CAPACITY = INLINE_CAPACITY };  // inline capacity
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SmallVector, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit SmallVector(bslma::Allocator *basicAllocator = 0);
+        // Create an empty vector.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    explicit SmallVector(bsl::size_t       initialSize,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create a vector having the specified 'initialSize' default-
+        // constructed elements.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    SmallVector(bsl::size_t       initialSize,
+                const TYPE&       value,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a vector having the specified 'initialSize' copies of the
+        // specified 'value'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    SmallVector(const TYPE       *first,
+                const TYPE       *last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a vector having copies of the elements in the specified
+        // array '[first, last)'.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '[first, last)' is a valid range.
+
+    SmallVector(const SmallVector&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a vector having the same value as the specified 'original'
+        // vector.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    SmallVector(bslmf::MovableRef<SmallVector> original);
+        // Create a vector having the same value and allocator as the
+        // specified 'original' vector, leaving 'original' empty.  If
+        // 'original' holds its elements in allocated memory, that memory is
+        // transferred to this vector (and no element is moved); otherwise the
+        // elements are moved individually.
+
+    SmallVector(bslmf::MovableRef<SmallVector>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a vector having the same value as the specified 'original'
+        // vector, using the specified 'basicAllocator' to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If 'original' uses the same allocator as this vector, it is
+        // left empty; otherwise its elements are moved individually into this
+        // vector, and 'original' is left in a valid but unspecified state.
+
+    ~SmallVector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    SmallVector& operator=(const SmallVector& rhs);
+        // Assign to this vector the value of the specified 'rhs' vector, and
+        // return a reference providing modifiable access to this vector.  If
+        // an exception is thrown, this vector is left in a valid but
+        // unspecified state.
+
+    SmallVector& operator=(bslmf::MovableRef<SmallVector> rhs);
+        // Assign to this vector the value of the specified 'rhs' vector, and
+        // return a reference providing modifiable access to this vector.  If
+        // 'rhs' uses the same allocator as this vector, it is left empty;
+        // otherwise it is left in a valid but unspecified state.  If an
+        // exception is thrown, this vector is left in a valid but unspecified
+        // state.
+
+    TYPE& operator[](bsl::size_t position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position' in this vector.  The behavior is undefined
+        // unless 'position < size()'.
+
+    TYPE& at(bsl::size_t position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position' in this vector.  Throw 'bsl::out_of_range'
+        // if 'position >= size()'.
+
+    TYPE& back();
+        // Return a reference providing modifiable access to the last element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    iterator begin();
+        // Return an iterator to the first element of this vector, or 'end()'
+        // if this vector is empty.
+
+    void clear();
+        // Remove all elements from this vector, retaining its capacity.
+
+    TYPE *data();
+        // Return the address of the modifiable first element of this vector.
+        // Note that '[data(), data() + size())' is a valid range.
+
+    iterator end();
+        // Return the past-the-end iterator of this vector.
+
+    iterator erase(const_iterator position);
+        // Remove from this vector the element at the specified 'position',
+        // and return an iterator to the element following the removed
+        // element (or 'end()').  The behavior is undefined unless 'position'
+        // is a dereferenceable iterator of this vector.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this vector the elements in the specified range
+        // '[first, last)', and return an iterator to the element following the
+        // removed elements (or 'end()').  The behavior is undefined unless
+        // '[first, last)' is a valid range of iterators of this vector.
+
+    TYPE& front();
+        // Return a reference providing modifiable access to the first element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    iterator insert(const_iterator position, const TYPE& value);
+        // Insert the specified 'value' into this vector before the element at
+        // the specified 'position' (or at the end if 'position' is 'end()'),
+        // and return an iterator to the inserted element.  If an exception
+        // is thrown, this vector is left in a valid but unspecified state.
+        // The behavior is undefined unless 'position' is an iterator of this
+        // vector.  Note that 'value' may refer to an element of this vector.
+
+    iterator insert(const_iterator position, bslmf::MovableRef<TYPE> value);
+        // Insert the specified 'value' into this vector before the element at
+        // the specified 'position' (or at the end if 'position' is 'end()'),
+        // and return an iterator to the inserted element.  'value' is left in
+        // a valid but unspecified state.  If an exception is thrown, this
+        // vector is left in a valid but unspecified state.  The behavior is
+        // undefined unless 'position' is an iterator of this vector, and
+        // 'value' does not refer to an element of this vector.
+
+    void pop_back();
+        // Remove the last element of this vector.  The behavior is undefined
+        // unless this vector is not empty.
+
+    void push_back(const TYPE& value);
+    void push_back(bslmf::MovableRef<TYPE> value);
+        // Append the specified 'value' to this vector.  If an exception is
+        // thrown, this vector is unchanged.  Note that 'value' may refer to
+        // an element of this vector.
+
+    void reserve(bsl::size_t newCapacity);
+        // Ensure that this vector has capacity for at least the specified
+        // 'newCapacity' elements.  If an exception is thrown, this vector is
+        // unchanged.
+
+    void resize(bsl::size_t newSize);
+        // Change the size of this vector to the specified 'newSize', removing
+        // elements from the end, or appending default-constructed elements,
+        // as necessary.
+
+    void resize(bsl::size_t newSize, const TYPE& value);
+        // Change the size of this vector to the specified 'newSize', removing
+        // elements from the end, or appending copies of the specified 'value',
+        // as necessary.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this vector to its size, moving the elements
+        // back to the inline storage if they fit (and releasing any allocated
+        // memory).  If an exception is thrown, this vector is unchanged.
+
+    void swap(SmallVector& other);
+        // Exchange the value of this vector with that of the specified
+        // 'other' vector.  If both vectors hold their elements in allocated
+        // memory, this method provides the no-throw exception-safety
+        // guarantee; otherwise the elements held in inline storage are moved
+        // individually.  The behavior is undefined unless this vector uses the
+        // same allocator as 'other'.
+
+    // ACCESSORS
+    const TYPE& operator[](bsl::size_t position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position' in this vector.  The behavior is
+        // undefined unless 'position < size()'.
+
+    const TYPE& at(bsl::size_t position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position' in this vector.  Throw
+        // 'bsl::out_of_range' if 'position >= size()'.
+
+    const TYPE& back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator to the first element of this vector, or 'end()'
+        // if this vector is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this vector can hold without
+        // allocating memory.
+
+    const TYPE *data() const;
+        // Return the address of the non-modifiable first element of this
+        // vector.  Note that '[data(), data() + size())' is a valid range.
+
+    bool empty() const;
+        // Return 'true' if this vector has no elements, and 'false'
+        // otherwise.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this vector.
+
+    const TYPE& front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    bool isInline() const;
+        // Return 'true' if the elements of this vector are held in its
+        // inline storage, and 'false' if they are held in allocated memory.
+
+    bsl::size_t max_size() const;
+        // Return the largest number of elements this vector could hold.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this vector.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this vector to supply memory.
+};
+
+// FREE OPERATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator==(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' vectors have the same
+    // value, and 'false' otherwise.  Two vectors have the same value if they
+    // have the same size, and each element of one is equal to the element at
+    // the same position in the other.
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator!=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' vectors do not have the
+    // same value, and 'false' otherwise.  Two vectors do not have the same
+    // value if they differ in size, or in the value of any element.
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator<(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' vector lexicographically precedes
+    // the specified 'rhs' vector, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+          SmallVector<TYPE, INLINE_CAPACITY>& b);
+    // Exchange the values of the specified 'a' and 'b' vectors.  If the
+    // vectors use different allocators, their values are exchanged by
+    // copying.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // -----------------
+                            // class SmallVector
+                            // -----------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::allocateStorage(
+                                                          bsl::size_t capacity)
+{
+    if (capacity > max_size()) {
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                  "bdlc::SmallVector: capacity exceeds limit");
+    }
+    return static_cast<TYPE *>(d_allocator_p->allocate(capacity
+                                                       * sizeof(TYPE)));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::inlineData()
+{
+    return reinterpret_cast<TYPE *>(d_inlineBuffer.buffer());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::moveFrom(SmallVector *original)
+{
+    BSLS_ASSERT_SAFE(0 == d_size);
+    BSLS_ASSERT_SAFE(d_allocator_p == original->d_allocator_p);
+
+    if (!original->isInline()) {
+        releaseStorage();
+
+        d_data_p     = original->d_data_p;
+        d_size       = original->d_size;
+        d_capacity   = original->d_capacity;
+
+        original->d_data_p   = original->inlineData();
+        original->d_size     = 0;
+        original->d_capacity = INLINE_CAPACITY;
+        return;                                                       // RETURN
+    }
+
+    // The capacity of this vector is at least 'INLINE_CAPACITY', so the
+    // elements of 'original' fit in its existing storage.
+
+    ArrayPrimitives::destructiveMove(d_data_p,
+                                     original->d_data_p,
+                                     original->d_data_p + original->d_size,
+                                     d_allocator_p);
+    d_size           = original->d_size;
+    original->d_size = 0;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::reallocate(bsl::size_t newCapacity)
+{
+    BSLS_ASSERT_SAFE(d_size          <= newCapacity);
+    BSLS_ASSERT_SAFE(INLINE_CAPACITY <= newCapacity);
+
+    TYPE *newData = INLINE_CAPACITY == newCapacity
+                  ? inlineData()
+                  : allocateStorage(newCapacity);
+
+    if (newData == d_data_p) {
+        return;                                                       // RETURN
+    }
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                         newData == inlineData() ? 0 : newData,
+                                         d_allocator_p);
+
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_data_p,
+                                     d_data_p + d_size,
+                                     d_allocator_p);
+    proctor.release();
+
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_data_p);
+    }
+    d_data_p   = newData;
+    d_capacity = newCapacity;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::releaseStorage()
+{
+    BSLS_ASSERT_SAFE(0 == d_size);
+
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_data_p);
+        d_data_p   = inlineData();
+        d_capacity = INLINE_CAPACITY;
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::grownCapacity(
+                                             bsl::size_t minimumCapacity) const
+{
+    const bsl::size_t doubled = 2 * d_capacity;
+    return doubled < minimumCapacity ? minimumCapacity : doubled;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE *SmallVector<TYPE, INLINE_CAPACITY>::inlineData() const
+{
+    return reinterpret_cast<const TYPE *>(d_inlineBuffer.buffer());
+}
+
+// CREATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bslma::Allocator *basicAllocator)
+: d_data_p(inlineData())
+, d_size(0)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bsl::size_t       initialSize,
+                                              bslma::Allocator *basicAllocator)
+: d_data_p(inlineData())
+, d_size(0)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    resize(initialSize);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bsl::size_t       initialSize,
+                                              const TYPE&       value,
+                                              bslma::Allocator *basicAllocator)
+: d_data_p(inlineData())
+, d_size(0)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    resize(initialSize, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              const TYPE       *first,
+                                              const TYPE       *last,
+                                              bslma::Allocator *basicAllocator)
+: d_data_p(inlineData())
+, d_size(0)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(first <= last);
+
+    const bsl::size_t numElements = last - first;
+
+    reserve(numElements);
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                                   isInline() ? 0 : d_data_p,
+                                                   d_allocator_p);
+
+    ArrayPrimitives::copyConstruct(d_data_p, first, last, d_allocator_p);
+    proctor.release();
+
+    d_size = numElements;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                          const SmallVector&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_data_p(inlineData())
+, d_size(0)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    reserve(original.d_size);
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                                   isInline() ? 0 : d_data_p,
+                                                   d_allocator_p);
+
+    ArrayPrimitives::copyConstruct(d_data_p,
+                                   original.d_data_p,
+                                   original.d_data_p + original.d_size,
+                                   d_allocator_p);
+    proctor.release();
+
+    d_size = original.d_size;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                       bslmf::MovableRef<SmallVector> original)
+: d_data_p(inlineData())
+, d_size(0)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    moveFrom(&MoveUtil::access(original));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                               bslmf::MovableRef<SmallVector>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_data_p(inlineData())
+, d_size(0)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    SmallVector& lvalue = MoveUtil::access(original);
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        moveFrom(&lvalue);
+        return;                                                       // RETURN
+    }
+
+    reserve(lvalue.d_size);
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                                   isInline() ? 0 : d_data_p,
+                                                   d_allocator_p);
+
+    ArrayPrimitives::moveConstruct(d_data_p,
+                                   lvalue.d_data_p,
+                                   lvalue.d_data_p + lvalue.d_size,
+                                   d_allocator_p);
+    proctor.release();
+
+    d_size = lvalue.d_size;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::~SmallVector()
+{
+    BSLS_ASSERT_SAFE(d_size <= d_capacity);
+    BSLS_ASSERT_SAFE(INLINE_CAPACITY <= d_capacity);
+
+    bslalg::ArrayDestructionPrimitives::destroy(d_data_p, d_data_p + d_size);
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_data_p);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(const SmallVector& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        reserve(rhs.d_size);
+        ArrayPrimitives::copyConstruct(d_data_p,
+                                       rhs.d_data_p,
+                                       rhs.d_data_p + rhs.d_size,
+                                       d_allocator_p);
+        d_size = rhs.d_size;
+    }
+    return *this;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(
+                                            bslmf::MovableRef<SmallVector> rhs)
+{
+    SmallVector& lvalue = MoveUtil::access(rhs);
+
+    if (this != &lvalue) {
+        clear();
+        if (d_allocator_p == lvalue.d_allocator_p) {
+            moveFrom(&lvalue);
+        }
+        else {
+            reserve(lvalue.d_size);
+            ArrayPrimitives::moveConstruct(d_data_p,
+                                           lvalue.d_data_p,
+                                           lvalue.d_data_p + lvalue.d_size,
+                                           d_allocator_p);
+            d_size = lvalue.d_size;
+        }
+    }
+    return *this;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE& SmallVector<TYPE, INLINE_CAPACITY>::operator[](bsl::size_t position)
+{
+    BSLS_ASSERT_SAFE(position < d_size);
+
+    return d_data_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE& SmallVector<TYPE, INLINE_CAPACITY>::at(bsl::size_t position)
+{
+    if (position >= d_size) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                    "bdlc::SmallVector::at: invalid position");
+    }
+    return d_data_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE& SmallVector<TYPE, INLINE_CAPACITY>::back()
+{
+    BSLS_ASSERT_SAFE(0 < d_size);
+
+    return d_data_p[d_size - 1];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin()
+{
+    return d_data_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::clear()
+{
+    bslalg::ArrayDestructionPrimitives::destroy(d_data_p, d_data_p + d_size);
+    d_size = 0;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::data()
+{
+    return d_data_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end()
+{
+    return d_data_p + d_size;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <  cend());
+
+    return erase(position, position + 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator first,
+                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= first);
+    BSLS_ASSERT_SAFE(first    <= last);
+    BSLS_ASSERT_SAFE(last     <= cend());
+
+    TYPE *const mFirst = d_data_p + (first - d_data_p);
+    TYPE *const mLast  = d_data_p + (last  - d_data_p);
+
+    ArrayPrimitives::erase(mFirst, mLast, d_data_p + d_size, d_allocator_p);
+    d_size -= last - first;
+
+    return mFirst;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE& SmallVector<TYPE, INLINE_CAPACITY>::front()
+{
+    BSLS_ASSERT_SAFE(0 < d_size);
+
+    return d_data_p[0];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           const TYPE&    value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    if (position == cend()) {
+        push_back(value);
+        return d_data_p + d_size - 1;                                 // RETURN
+    }
+
+    // 'value' may refer to an element of this vector, which growing the
+    // vector or shifting its elements would change, so insert a copy.
+
+    bsls::ObjectBuffer<TYPE> copy;
+    bslma::ConstructionUtil::construct(copy.address(), d_allocator_p, value);
+    bslma::DestructorGuard<TYPE> guard(copy.address());
+
+    return insert(position, MoveUtil::move(copy.object()));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator          position,
+                                           bslmf::MovableRef<TYPE> value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const bsl::size_t index = position - d_data_p;
+
+    if (index == d_size) {
+        push_back(MoveUtil::move(MoveUtil::access(value)));
+        return d_data_p + index;                                      // RETURN
+    }
+
+    if (d_size == d_capacity) {
+        reallocate(grownCapacity(d_size + 1));
+    }
+    ArrayPrimitives::insert(d_data_p + index,
+                            d_data_p + d_size,
+                            MoveUtil::move(MoveUtil::access(value)),
+                            d_allocator_p);
+    ++d_size;
+
+    return d_data_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::pop_back()
+{
+    BSLS_ASSERT_SAFE(0 < d_size);
+
+    --d_size;
+    bslma::DestructionUtil::destroy(d_data_p + d_size);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(const TYPE& value)
+{
+    if (d_size < d_capacity) {
+        bslma::ConstructionUtil::construct(d_data_p + d_size,
+                                           d_allocator_p,
+                                           value);
+        ++d_size;
+        return;                                                       // RETURN
+    }
+
+    // 'value' may refer to an element of this vector, so construct the new
+    // element before relocating the existing elements.
+
+    const bsl::size_t newCapacity = grownCapacity(d_size + 1);
+    TYPE             *newData     = allocateStorage(newCapacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                        d_allocator_p);
+
+    bslma::ConstructionUtil::construct(newData + d_size,
+                                       d_allocator_p,
+                                       value);
+    bslalg::AutoArrayDestructor<TYPE> guard(newData + d_size,
+                                            newData + d_size + 1);
+
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_data_p,
+                                     d_data_p + d_size,
+                                     d_allocator_p);
+    guard.release();
+    proctor.release();
+
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_data_p);
+    }
+    d_data_p   = newData;
+    d_capacity = newCapacity;
+    ++d_size;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(
+                                                 bslmf::MovableRef<TYPE> value)
+{
+    TYPE& lvalue = MoveUtil::access(value);
+
+    if (d_size < d_capacity) {
+        bslma::ConstructionUtil::construct(d_data_p + d_size,
+                                           d_allocator_p,
+                                           MoveUtil::move(lvalue));
+        ++d_size;
+        return;                                                       // RETURN
+    }
+
+    // 'value' may refer to an element of this vector, so construct the new
+    // element before relocating the existing elements.
+
+    const bsl::size_t newCapacity = grownCapacity(d_size + 1);
+    TYPE             *newData     = allocateStorage(newCapacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                        d_allocator_p);
+
+    bslma::ConstructionUtil::construct(newData + d_size,
+                                       d_allocator_p,
+                                       MoveUtil::move(lvalue));
+    bslalg::AutoArrayDestructor<TYPE> guard(newData + d_size,
+                                            newData + d_size + 1);
+
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_data_p,
+                                     d_data_p + d_size,
+                                     d_allocator_p);
+    guard.release();
+    proctor.release();
+
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_data_p);
+    }
+    d_data_p   = newData;
+    d_capacity = newCapacity;
+    ++d_size;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::reserve(bsl::size_t newCapacity)
+{
+    if (newCapacity > d_capacity) {
+        reallocate(newCapacity);
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(bsl::size_t newSize)
+{
+    if (newSize <= d_size) {
+        bslalg::ArrayDestructionPrimitives::destroy(d_data_p + newSize,
+                                                    d_data_p + d_size);
+        d_size = newSize;
+        return;                                                       // RETURN
+    }
+
+    if (newSize > d_capacity) {
+        reallocate(grownCapacity(newSize));
+    }
+    ArrayPrimitives::defaultConstruct(d_data_p + d_size,
+                                      newSize - d_size,
+                                      d_allocator_p);
+    d_size = newSize;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(bsl::size_t newSize,
+                                                const TYPE& value)
+{
+    if (newSize <= d_size) {
+        bslalg::ArrayDestructionPrimitives::destroy(d_data_p + newSize,
+                                                    d_data_p + d_size);
+        d_size = newSize;
+        return;                                                       // RETURN
+    }
+
+    if (newSize > d_capacity) {
+        // 'value' may refer to an element of this vector, which
+        // 'reallocate' would relocate, so fill from a copy.
+
+        bsls::ObjectBuffer<TYPE> copy;
+        bslma::ConstructionUtil::construct(copy.address(),
+                                           d_allocator_p,
+                                           value);
+        bslma::DestructorGuard<TYPE> guard(copy.address());
+
+        reallocate(grownCapacity(newSize));
+        ArrayPrimitives::uninitializedFillN(d_data_p + d_size,
+                                            newSize - d_size,
+                                            copy.object(),
+                                            d_allocator_p);
+    }
+    else {
+        ArrayPrimitives::uninitializedFillN(d_data_p + d_size,
+                                            newSize - d_size,
+                                            value,
+                                            d_allocator_p);
+    }
+    d_size = newSize;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::shrink_to_fit()
+{
+    if (!isInline() && d_size < d_capacity) {
+        reallocate(d_size <= INLINE_CAPACITY ? INLINE_CAPACITY : d_size);
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::swap(SmallVector& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    if (this == &other) {
+        return;                                                       // RETURN
+    }
+
+    if (!isInline() && !other.isInline()) {
+        TYPE *const       data     = d_data_p;
+        const bsl::size_t size     = d_size;
+        const bsl::size_t capacity = d_capacity;
+
+        d_data_p   = other.d_data_p;
+        d_size     = other.d_size;
+        d_capacity = other.d_capacity;
+
+        other.d_data_p   = data;
+        other.d_size     = size;
+        other.d_capacity = capacity;
+        return;                                                       // RETURN
+    }
+
+    SmallVector temp(MoveUtil::move(*this));
+    *this = MoveUtil::move(other);
+    other = MoveUtil::move(temp);
+}
+
+// ACCESSORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE& SmallVector<TYPE, INLINE_CAPACITY>::operator[](
+                                                   bsl::size_t position) const
+{
+    BSLS_ASSERT_SAFE(position < d_size);
+
+    return d_data_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE& SmallVector<TYPE, INLINE_CAPACITY>::at(bsl::size_t position) const
+{
+    if (position >= d_size) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                    "bdlc::SmallVector::at: invalid position");
+    }
+    return d_data_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE& SmallVector<TYPE, INLINE_CAPACITY>::back() const
+{
+    BSLS_ASSERT_SAFE(0 < d_size);
+
+    return d_data_p[d_size - 1];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin() const
+{
+    return d_data_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cbegin() const
+{
+    return d_data_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE *SmallVector<TYPE, INLINE_CAPACITY>::data() const
+{
+    return d_data_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end() const
+{
+    return d_data_p + d_size;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cend() const
+{
+    return d_data_p + d_size;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE& SmallVector<TYPE, INLINE_CAPACITY>::front() const
+{
+    BSLS_ASSERT_SAFE(0 < d_size);
+
+    return d_data_p[0];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::isInline() const
+{
+    return inlineData() == d_data_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::max_size() const
+{
+    return ~static_cast<bsl::size_t>(0) / sizeof(TYPE);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::size() const
+{
+    return d_size;
+}
+
+                                  // Aspects
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bslma::Allocator *SmallVector<TYPE, INLINE_CAPACITY>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator==(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return bslalg::RangeCompare::equal(lhs.begin(),
+                                       lhs.end(),
+                                       lhs.size(),
+                                       rhs.begin(),
+                                       rhs.end(),
+                                       rhs.size());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator!=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator<(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                     const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return 0 > bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                     lhs.end(),
+                                                     lhs.size(),
+                                                     rhs.begin(),
+                                                     rhs.end(),
+                                                     rhs.size());
+}
+
+// FREE FUNCTIONS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void bdlc::swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+                SmallVector<TYPE, INLINE_CAPACITY>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    SmallVector<TYPE, INLINE_CAPACITY> futureA(b, a.allocator());
+    SmallVector<TYPE, INLINE_CAPACITY> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
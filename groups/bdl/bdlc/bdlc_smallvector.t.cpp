@@ -0,0 +1,1406 @@
+// bdlc_smallvector.t.cpp                                             -*-C++-*-
+#include <bdlc_smallvector.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_keyword.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a sequence container whose primary
+// manipulators are 'push_back' and 'clear', and whose basic accessors are
+// 'size', 'capacity', 'isInline', and 'operator[]'.  We verify that memory is
+// allocated only when the size of a vector exceeds its inline capacity, that
+// elements are supplied the vector's allocator, that bitwise-moveable elements
+// are relocated without invoking their constructors, and that every
+// manipulator behaves correctly both while the elements are inline and after
+// they have moved to allocated memory.  Exception safety is verified using
+// 'bslma::TestAllocator'.
+//
+// A negative test case compares the number of allocations, and the time, of
+// populating many short vectors with that of 'bsl::vector'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit SmallVector(bslma::Allocator *basicAllocator = 0);
+// [ 3] explicit SmallVector(size_t initialSize, Allocator * = 0);
+// [ 3] SmallVector(size_t, const TYPE&, bslma::Allocator * = 0);
+// [ 3] SmallVector(const TYPE *, const TYPE *, bslma::Allocator * = 0);
+// [ 3] SmallVector(const SmallVector&, bslma::Allocator * = 0);
+// [ 4] SmallVector(MovableRef<SmallVector>);
+// [ 4] SmallVector(MovableRef<SmallVector>, bslma::Allocator *);
+// [ 2] ~SmallVector();
+//
+// MANIPULATORS
+// [ 3] SmallVector& operator=(const SmallVector&);
+// [ 4] SmallVector& operator=(MovableRef<SmallVector>);
+// [ 7] TYPE& operator[](size_t);
+// [ 7] TYPE& at(size_t);
+// [ 7] TYPE& back();
+// [ 7] iterator begin();
+// [ 2] void clear();
+// [ 7] TYPE *data();
+// [ 7] iterator end();
+// [ 5] iterator erase(const_iterator);
+// [ 5] iterator erase(const_iterator, const_iterator);
+// [ 7] TYPE& front();
+// [ 5] iterator insert(const_iterator, const TYPE&);
+// [ 5] iterator insert(const_iterator, MovableRef<TYPE>);
+// [ 2] void pop_back();
+// [ 2] void push_back(const TYPE&);
+// [ 2] void push_back(MovableRef<TYPE>);
+// [ 6] void reserve(size_t);
+// [ 6] void resize(size_t);
+// [ 6] void resize(size_t, const TYPE&);
+// [ 6] void shrink_to_fit();
+// [ 4] void swap(SmallVector&);
+//
+// ACCESSORS
+// [ 2] const TYPE& operator[](size_t) const;
+// [ 7] const TYPE& at(size_t) const;
+// [ 7] const TYPE& back() const;
+// [ 7] const_iterator begin() const;
+// [ 7] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 7] const TYPE *data() const;
+// [ 2] bool empty() const;
+// [ 7] const_iterator end() const;
+// [ 7] const_iterator cend() const;
+// [ 7] const TYPE& front() const;
+// [ 2] bool isInline() const;
+// [ 7] size_t max_size() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 7] bool operator==(const SmallVector&, const SmallVector&);
+// [ 7] bool operator!=(const SmallVector&, const SmallVector&);
+// [ 7] bool operator<(const SmallVector&, const SmallVector&);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(SmallVector&, SmallVector&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] EXCEPTION SAFETY
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: ALLOCATIONS AND TIME VS. 'bsl::vector'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bslmf::MovableRefUtil MoveUtil;
+
+typedef bdlc::SmallVector<int, 4>         IntVector;
+typedef bdlc::SmallVector<bsl::string, 4> StringVector;
+
+const char *const LONG = "a string long enough to allocate memory";
+
+template <int ID>
+class Counted {
+    // This class holds an 'int' value, and counts the invocations of its copy
+    // and move constructors.  'Counted<1>' is declared bitwise-moveable.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static int s_numCopies;
+    static int s_numMoves;
+
+    // CLASS METHODS
+    static void resetCounts()
+    {
+        s_numCopies = 0;
+        s_numMoves  = 0;
+    }
+
+    // CREATORS
+    explicit Counted(int value = 0) : d_value(value)
+    {
+    }
+
+    Counted(const Counted& original) : d_value(original.d_value)
+    {
+        ++s_numCopies;
+    }
+
+    Counted(bslmf::MovableRef<Counted> original) BSLS_KEYWORD_NOEXCEPT
+    : d_value(MoveUtil::access(original).d_value)
+    {
+        ++s_numMoves;
+    }
+
+    // MANIPULATORS
+    Counted& operator=(const Counted& rhs)
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    Counted& operator=(bslmf::MovableRef<Counted> rhs)
+    {
+        d_value = MoveUtil::access(rhs).d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+template <int ID>
+int Counted<ID>::s_numCopies = 0;
+
+template <int ID>
+int Counted<ID>::s_numMoves = 0;
+
+namespace BloombergLP {
+namespace bslmf {
+
+template <>
+struct IsBitwiseMoveable<Counted<1> > : bsl::true_type {
+};
+
+}  // close namespace bslmf
+}  // close enterprise namespace
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+template <class VECTOR>
+static bool hasValues(const VECTOR& vector, const int *values, int numValues)
+    // Return 'true' if the specified 'vector' holds exactly the specified
+    // 'numValues' 'values', and 'false' otherwise.
+{
+    if (vector.size() != static_cast<bsl::size_t>(numValues)) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < numValues; ++i) {
+        if (vector[i] != values[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class VECTOR>
+static void populate(VECTOR *vector, int numElements)
+    // Append to the specified 'vector' the specified 'numElements' values.
+{
+    for (int i = 0; i < numElements; ++i) {
+        vector->push_back(i);
+    }
+}
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting the Fields of a Record
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we parse records having a few comma-separated fields, and want to
+// collect the offsets of the fields of each record.  Most records have at most
+// 8 fields, so we use a 'bdlc::SmallVector' having an inline capacity of 8 to
+// avoid allocating memory for each record.
+//
+// First, we define a function that loads the offsets of the fields of a
+// record:
+//..
+    void loadFieldOffsets(bdlc::SmallVector<bsl::size_t, 8> *offsets,
+                          const char                        *record)
+        // Load into the specified 'offsets' the offset of each field of the
+        // specified comma-separated 'record'.
+    {
+        offsets->clear();
+        offsets->push_back(0);
+        for (const char *p = record; *p; ++p) {
+            if (',' == *p) {
+                offsets->push_back(p - record + 1);
+            }
+        }
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a test allocator, and a vector using it:
+//..
+    bslma::TestAllocator              allocator;
+    bdlc::SmallVector<bsl::size_t, 8> offsets(&allocator);
+//..
+// Next, we collect the offsets of the fields of a record having 4 fields, and
+// observe that no memory is allocated:
+//..
+    loadFieldOffsets(&offsets, "IBM,100,123.45,NYSE");
+
+    ASSERT(4  == offsets.size());
+    ASSERT(4  == offsets[1]);
+    ASSERT(15 == offsets[3]);
+    ASSERT(0  == allocator.numAllocations());
+//..
+// Finally, we collect the offsets of the fields of a record having 10 fields,
+// which exceeds the inline capacity, and observe that memory is allocated:
+//..
+    loadFieldOffsets(&offsets, "a,b,c,d,e,f,g,h,i,j");
+
+    ASSERT(10 == offsets.size());
+    ASSERT(18 == offsets[9]);
+    ASSERT(1  == allocator.numAllocations());
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an exception is thrown by 'push_back', the vector is
+        //:   unchanged, and no memory is leaked, both while the elements are
+        //:   inline and when the vector grows.
+        //:
+        //: 2 If an exception is thrown by a constructor, no memory is leaked.
+        //:
+        //: 3 If an exception is thrown by 'insert', 'reserve', or
+        //:   'shrink_to_fit', no memory is leaked, and (for 'reserve' and
+        //:   'shrink_to_fit') the vector is unchanged.
+        //
+        // Plan:
+        //: 1 Using 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*', invoke each method
+        //:   on vectors of strings of various sizes, and verify the state of
+        //:   the vector and that no memory is leaked.  (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+        for (int n = 0; n < 12; ++n) {
+            if (veryVerbose) { T_ P(n) }
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            {
+                StringVector mX(&sa);  const StringVector& X = mX;
+                for (int i = 0; i < n; ++i) {
+                    mX.push_back(bsl::string(LONG, &sa));
+                }
+
+                const StringVector W(X, &sa);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    ASSERTV(n, W == X);
+
+                    mX.push_back(X.empty() ? bsl::string(LONG) : X[0]);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(n, static_cast<bsl::size_t>(n + 1) == X.size());
+                mX.pop_back();
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    const StringVector Y(X, &sa);
+                    ASSERTV(n, X == Y);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    StringVector mY(X, &sa);  const StringVector& Y = mY;
+
+                    mY.insert(Y.begin(), bsl::string("inserted", &sa));
+                    ASSERTV(n, "inserted" == Y[0]);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    ASSERTV(n, W == X);
+
+                    mX.reserve(100);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                ASSERTV(n, W == X);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    ASSERTV(n, W == X);
+
+                    mX.shrink_to_fit();
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                ASSERTV(n, W == X);
+                ASSERTV(n, (n <= 4) == X.isInline());
+            }
+            ASSERTV(n, 0 == sa.numBytesInUse());
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS AND COMPARISON
+        //
+        // Concerns:
+        //: 1 The element accessors refer to the correct elements, both inline
+        //:   and in allocated memory.
+        //:
+        //: 2 'at' throws 'bsl::out_of_range' for an invalid position.
+        //:
+        //: 3 The comparison operators compare sizes and elements.
+        //
+        // Plan:
+        //: 1 Access the elements of vectors of various sizes using each
+        //:   accessor, and verify the results.  (C-1..2)
+        //:
+        //: 2 Compare pairs of vectors from a set of distinct values.  (C-3)
+        //
+        // Testing:
+        //   TYPE& operator[](size_t);
+        //   TYPE& at(size_t);
+        //   TYPE& back();
+        //   iterator begin();
+        //   TYPE *data();
+        //   iterator end();
+        //   TYPE& front();
+        //   const TYPE& at(size_t) const;
+        //   const TYPE& back() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const TYPE *data() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const TYPE& front() const;
+        //   size_t max_size() const;
+        //   bool operator==(const SmallVector&, const SmallVector&);
+        //   bool operator!=(const SmallVector&, const SmallVector&);
+        //   bool operator<(const SmallVector&, const SmallVector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ELEMENT ACCESS AND COMPARISON" << endl
+                          << "=============================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        for (int n = 1; n < 10; ++n) {
+            IntVector mX(&sa);  const IntVector& X = mX;
+            populate(&mX, n);
+
+            ASSERTV(n, 0     == X.front());
+            ASSERTV(n, n - 1 == X.back());
+            ASSERTV(n, X.data()   == &X[0]);
+            ASSERTV(n, X.begin()  == X.data());
+            ASSERTV(n, X.cbegin() == X.data());
+            ASSERTV(n, X.end()    == X.data() + n);
+            ASSERTV(n, X.cend()   == X.data() + n);
+
+            mX.front() = 100;
+            mX.back()  = 200;
+            ASSERTV(n, (1 == n ? 200 : 100) == X[0]);
+            ASSERTV(n, 200 == X[n - 1]);
+
+            int count = 0;
+            for (IntVector::iterator it = mX.begin(); it != mX.end(); ++it) {
+                *it = count++;
+            }
+            ASSERTV(n, n == count);
+            for (int i = 0; i < n; ++i) {
+                ASSERTV(n, i, i == X.at(i));
+                mX.at(i) = -i;
+                ASSERTV(n, i, -i == X[i]);
+                mX.data()[i] = i;
+                ASSERTV(n, i, i == mX[i]);
+            }
+
+            bool caught = false;
+            try {
+                mX.at(n);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERTV(n, caught);
+
+            caught = false;
+            try {
+                X.at(n + 10);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERTV(n, caught);
+        }
+
+        ASSERT(0 < IntVector().max_size());
+
+        if (verbose) cout << "\tComparison operators." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_numValues;
+                int d_values[10];
+            } DATA[] = {
+                //LINE  NUM  VALUES
+                //----  ---  ----------------------------------
+                { L_,     0, { 0 }                             },
+                { L_,     1, { 0 }                             },
+                { L_,     1, { 1 }                             },
+                { L_,     2, { 0, 0 }                          },
+                { L_,     2, { 0, 1 }                          },
+                { L_,     4, { 0, 1, 2, 3 }                    },
+                { L_,     5, { 0, 1, 2, 3, 4 }                 },
+                { L_,     5, { 0, 1, 2, 3, 5 }                 },
+                { L_,    10, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }  },
+                { L_,    10, { 1, 1, 2, 3, 4, 5, 6, 7, 8, 9 }  },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int  LINE1 = DATA[ti].d_line;
+                const int *V1    = DATA[ti].d_values;
+                const int  N1    = DATA[ti].d_numValues;
+
+                const IntVector X(V1, V1 + N1, &sa);
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const int  LINE2 = DATA[tj].d_line;
+                    const int *V2    = DATA[tj].d_values;
+                    const int  N2    = DATA[tj].d_numValues;
+
+                    const IntVector Y(V2, V2 + N2, &sa);
+
+                    const bsl::vector<int> EX(V1, V1 + N1);
+                    const bsl::vector<int> EY(V2, V2 + N2);
+
+                    ASSERTV(LINE1, LINE2, (ti == tj) == (X == Y));
+                    ASSERTV(LINE1, LINE2, (ti != tj) == (X != Y));
+                    ASSERTV(LINE1, LINE2, (EX < EY)  == (X <  Y));
+                }
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANAGEMENT
+        //
+        // Concerns:
+        //: 1 'reserve' allocates only if the requested capacity exceeds the
+        //:   current capacity, and never reduces the capacity.
+        //:
+        //: 2 'resize' appends default-constructed elements or copies of a
+        //:   value, or removes elements from the end, growing the capacity as
+        //:   needed.  The value may refer to an element of the vector.
+        //:
+        //: 3 'shrink_to_fit' returns elements to the inline storage if they
+        //:   fit, releasing the allocated memory, and otherwise reduces the
+        //:   allocated capacity to the size.
+        //
+        // Plan:
+        //: 1 Invoke each method on vectors of various sizes, and verify the
+        //:   size, capacity, elements, and allocations.  (C-1..3)
+        //
+        // Testing:
+        //   void reserve(size_t);
+        //   void resize(size_t);
+        //   void resize(size_t, const TYPE&);
+        //   void shrink_to_fit();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CAPACITY MANAGEMENT" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\t'reserve'." << endl;
+        {
+            IntVector mX(&sa);  const IntVector& X = mX;
+
+            mX.reserve(0);
+            mX.reserve(4);
+            ASSERT(4 == X.capacity());
+            ASSERT(X.isInline());
+            ASSERT(0 == sa.numAllocations());
+
+            populate(&mX, 3);
+            mX.reserve(20);
+            ASSERT(20 == X.capacity());
+            ASSERT(!X.isInline());
+            ASSERT(1  == sa.numAllocations());
+
+            const int EXP[] = { 0, 1, 2 };
+            ASSERT(hasValues(X, EXP, 3));
+
+            mX.reserve(10);
+            ASSERT(20 == X.capacity());
+            ASSERT(1  == sa.numAllocations());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+
+        if (verbose) cout << "\t'resize'." << endl;
+        {
+            StringVector mX(&sa);  const StringVector& X = mX;
+
+            mX.resize(3);
+            ASSERT(3  == X.size());
+            ASSERT("" == X[2]);
+            ASSERT(X.isInline());
+
+            mX.resize(6, LONG);
+            ASSERT(6    == X.size());
+            ASSERT(""   == X[2]);
+            ASSERT(LONG == X[3]);
+            ASSERT(LONG == X[5]);
+            ASSERT(&sa  == X[5].get_allocator().mechanism());
+            ASSERT(!X.isInline());
+
+            mX.resize(2);
+            ASSERT(2 == X.size());
+
+            // The value may refer to an element of the vector.
+
+            mX[1] = LONG;
+            mX.resize(X.capacity() + 1, X[1]);
+            for (bsl::size_t i = 1; i < X.size(); ++i) {
+                ASSERTV(i, LONG == X[i]);
+            }
+
+            mX.resize(0);
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+
+        if (verbose) cout << "\t'shrink_to_fit'." << endl;
+        {
+            IntVector mX(&sa);  const IntVector& X = mX;
+
+            mX.shrink_to_fit();
+            ASSERT(X.isInline());
+
+            populate(&mX, 10);
+            ASSERT(!X.isInline());
+
+            mX.resize(6);
+            mX.shrink_to_fit();
+            ASSERT(6 == X.capacity());
+            ASSERT(!X.isInline());
+
+            const int EXP[] = { 0, 1, 2, 3, 4, 5 };
+            ASSERT(hasValues(X, EXP, 6));
+
+            mX.resize(3);
+            mX.shrink_to_fit();
+            ASSERT(4 == X.capacity());
+            ASSERT(X.isInline());
+            ASSERT(hasValues(X, EXP, 3));
+            ASSERT(0 == sa.numBytesInUse());
+
+            mX.shrink_to_fit();
+            ASSERT(X.isInline());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // INSERT AND ERASE
+        //
+        // Concerns:
+        //: 1 'insert' inserts the value before the specified position, at
+        //:   every position, growing the vector if necessary, and returns an
+        //:   iterator to the inserted element.
+        //:
+        //: 2 Inserting a value that refers to an element of the vector
+        //:   inserts the value of that element before the insertion.
+        //:
+        //: 3 'erase' removes the element, or the range of elements, at the
+        //:   specified position, and returns an iterator to the following
+        //:   element.
+        //
+        // Plan:
+        //: 1 For vectors of every size up to beyond the inline capacity,
+        //:   insert and erase at every position, and compare the results with
+        //:   those of 'bsl::vector'.  (C-1, 3)
+        //:
+        //: 2 Insert elements of a full vector into itself.  (C-2)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   iterator insert(const_iterator, const TYPE&);
+        //   iterator insert(const_iterator, MovableRef<TYPE>);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT AND ERASE" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        for (int n = 0; n < 10; ++n) {
+            for (int p = 0; p <= n; ++p) {
+                bsl::vector<int> exp(&sa);
+                populate(&exp, n);
+
+                IntVector mX(&sa);  const IntVector& X = mX;
+                populate(&mX, n);
+
+                IntVector::iterator it = mX.insert(X.begin() + p, 100);
+                exp.insert(exp.begin() + p, 100);
+
+                ASSERTV(n, p, X.begin() + p == it);
+                ASSERTV(n, p, hasValues(X, exp.data(), n + 1));
+
+                int value = 200;
+                it = mX.insert(X.begin() + p, MoveUtil::move(value));
+                exp.insert(exp.begin() + p, 200);
+
+                ASSERTV(n, p, X.begin() + p == it);
+                ASSERTV(n, p, hasValues(X, exp.data(), n + 2));
+
+                it = mX.erase(X.begin() + p);
+                exp.erase(exp.begin() + p);
+
+                ASSERTV(n, p, X.begin() + p == it);
+                ASSERTV(n, p, hasValues(X, exp.data(), n + 1));
+
+                for (int q = p; q <= n + 1; ++q) {
+                    IntVector mY(X, &sa);  const IntVector& Y = mY;
+                    bsl::vector<int> expY(exp);
+
+                    it = mY.erase(Y.begin() + p, Y.begin() + q);
+                    expY.erase(expY.begin() + p, expY.begin() + q);
+
+                    ASSERTV(n, p, q, Y.begin() + p == it);
+                    ASSERTV(n, p, q,
+                            hasValues(Y, expY.data(), (int)expY.size()));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tInserting an element of the vector." << endl;
+        {
+            StringVector mX(&sa);  const StringVector& X = mX;
+            for (int i = 0; i < 4; ++i) {
+                mX.push_back(bsl::string(LONG) + static_cast<char>('0' + i));
+            }
+            ASSERT(X.size() == X.capacity());
+
+            const bsl::string LAST = X[3];
+            mX.insert(X.begin(), X[3]);
+            ASSERT(5    == X.size());
+            ASSERT(LAST == X[0]);
+            ASSERT(LAST == X[4]);
+
+            const bsl::string FIRST = X[0];
+            mX.insert(X.begin() + 2, X[0]);
+            ASSERT(FIRST == X[2]);
+        }
+        ASSERT(0 == sa.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MOVE AND SWAP
+        //
+        // Concerns:
+        //: 1 Moving a vector holding allocated memory transfers the memory,
+        //:   without moving elements; moving a vector holding its elements
+        //:   inline moves the elements.  In both cases the original is left
+        //:   empty and inline.
+        //:
+        //: 2 Moving with a different allocator moves the elements
+        //:   individually into memory supplied by the new allocator.
+        //:
+        //: 3 Move assignment releases memory held by the target if it takes
+        //:   the memory of the source.
+        //:
+        //: 4 'swap' exchanges values for all combinations of inline and
+        //:   allocated vectors; the free 'swap' supports different
+        //:   allocators.
+        //
+        // Plan:
+        //: 1 Move and swap vectors of every size up to beyond the inline
+        //:   capacity, and verify the values, allocators, and allocations.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   SmallVector(MovableRef<SmallVector>);
+        //   SmallVector(MovableRef<SmallVector>, bslma::Allocator *);
+        //   SmallVector& operator=(MovableRef<SmallVector>);
+        //   void swap(SmallVector&);
+        //   void swap(SmallVector&, SmallVector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MOVE AND SWAP" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("other", veryVeryVeryVerbose);
+
+        for (int n = 0; n < 10; ++n) {
+            if (veryVerbose) { T_ P(n) }
+
+            StringVector mW(&sa);  const StringVector& W = mW;
+            for (int i = 0; i < n; ++i) {
+                mW.push_back(bsl::string(LONG) + static_cast<char>('0' + i));
+            }
+            const bool INLINE = W.isInline();
+
+            {
+                StringVector mX(W, &sa);  const StringVector& X = mX;
+                const bsl::string *DATA = X.data();
+
+                const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+
+                StringVector mY(MoveUtil::move(mX));
+                const StringVector& Y = mY;
+
+                ASSERTV(n, NUM_ALLOCATIONS == sa.numAllocations());
+                ASSERTV(n, W   == Y);
+                ASSERTV(n, &sa == Y.allocator());
+                ASSERTV(n, X.empty());
+                ASSERTV(n, X.isInline());
+                ASSERTV(n, INLINE == (DATA != Y.data()));
+
+                StringVector mZ(MoveUtil::move(mY), &oa);
+                const StringVector& Z = mZ;
+
+                ASSERTV(n, W   == Z);
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, n   == static_cast<int>(Y.size()));
+                ASSERTV(n, INLINE || 0 < oa.numBytesInUse());
+            }
+            ASSERTV(n, 0 == oa.numBytesInUse());
+
+            for (int m = 0; m < 10; ++m) {
+                StringVector mX(&sa);  const StringVector& X = mX;
+                for (int i = 0; i < m; ++i) {
+                    mX.push_back(bsl::string(i + 1, 'x'));
+                }
+                const StringVector XX(X, &sa);
+
+                {
+                    StringVector mY(W, &sa);  const StringVector& Y = mY;
+
+                    mX.swap(mY);
+                    ASSERTV(n, m, W  == X);
+                    ASSERTV(n, m, XX == Y);
+
+                    swap(mX, mY);
+                    ASSERTV(n, m, W  == Y);
+                    ASSERTV(n, m, XX == X);
+
+                    mX.swap(mX);
+                    ASSERTV(n, m, XX == X);
+                }
+
+                {
+                    StringVector mY(W, &oa);  const StringVector& Y = mY;
+
+                    swap(mX, mY);
+                    ASSERTV(n, m, W   == X);
+                    ASSERTV(n, m, XX  == Y);
+                    ASSERTV(n, m, &sa == X.allocator());
+                    ASSERTV(n, m, &oa == Y.allocator());
+
+                    swap(mX, mY);
+                }
+
+                {
+                    StringVector mY(W, &sa);
+
+                    mX = MoveUtil::move(mY);
+                    ASSERTV(n, m, W == X);
+                    ASSERTV(n, m, mY.empty());
+
+                    StringVector mZ(XX, &oa);
+
+                    mX = MoveUtil::move(mZ);
+                    ASSERTV(n, m, XX  == X);
+                    ASSERTV(n, m, &sa == X.allocator());
+
+                    mX = MoveUtil::move(mX);
+                    ASSERTV(n, m, XX  == X);
+                }
+                ASSERTV(n, m, 0 == oa.numBytesInUse());
+            }
+        }
+        ASSERT(0 == sa.numBytesInUse());
+
+        if (verbose) cout << "\tSwapping different allocators." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            IntVector mX(&sa);
+            IntVector mY(&oa);
+            IntVector mZ(&sa);
+
+            ASSERT_FAIL(mX.swap(mY));
+            ASSERT_PASS(mX.swap(mZ));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // VALUE CONSTRUCTORS, COPY, AND COPY ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 Each constructor creates a vector having the specified elements
+        //:   and allocator, allocating memory only if the elements do not fit
+        //:   inline.
+        //:
+        //: 2 Copy assignment reuses the existing storage if it suffices, and
+        //:   never changes the allocator of the target.
+        //
+        // Plan:
+        //: 1 Create vectors of every size up to beyond the inline capacity
+        //:   using each constructor, and verify their state and the
+        //:   allocations.  (C-1)
+        //:
+        //: 2 Assign vectors of every pair of sizes.  (C-2)
+        //
+        // Testing:
+        //   explicit SmallVector(size_t initialSize, Allocator * = 0);
+        //   SmallVector(size_t, const TYPE&, bslma::Allocator * = 0);
+        //   SmallVector(const TYPE *, const TYPE *, bslma::Allocator * = 0);
+        //   SmallVector(const SmallVector&, bslma::Allocator * = 0);
+        //   SmallVector& operator=(const SmallVector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                   << endl
+                   << "VALUE CONSTRUCTORS, COPY, AND COPY ASSIGNMENT" << endl
+                   << "=============================================" << endl;
+
+        const int VALUES[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3 };
+
+        for (int n = 0; n < 10; ++n) {
+            const bsls::Types::Int64 EXP_ALLOCATIONS = n > 4 ? 1 : 0;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            {
+                const IntVector X(n, &sa);
+                ASSERTV(n, static_cast<bsl::size_t>(n) == X.size());
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, 0 == X[i]);
+                }
+                ASSERTV(n, EXP_ALLOCATIONS == sa.numAllocations());
+            }
+            {
+                const StringVector X(n, LONG, &sa);
+                ASSERTV(n, static_cast<bsl::size_t>(n) == X.size());
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, LONG == X[i]);
+                    ASSERTV(n, i, &sa == X[i].get_allocator().mechanism());
+                }
+            }
+            {
+                const bsls::Types::Int64 NUM = sa.numAllocations();
+
+                const IntVector X(VALUES, VALUES + n, &sa);
+                ASSERTV(n, hasValues(X, VALUES, n));
+                ASSERTV(n, EXP_ALLOCATIONS == sa.numAllocations() - NUM);
+
+                const IntVector Y(X, &sa);
+                ASSERTV(n, X == Y);
+                ASSERTV(n, 2 * EXP_ALLOCATIONS == sa.numAllocations() - NUM);
+
+                const IntVector Z(X);
+                ASSERTV(n, X   == Z);
+                ASSERTV(n, &da == Z.allocator());
+            }
+            ASSERTV(n, 0 == sa.numBytesInUse());
+        }
+        ASSERT(0 == da.numBytesInUse());
+
+        if (verbose) cout << "\tCopy assignment." << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        for (int n = 0; n < 10; ++n) {
+            for (int m = 0; m < 10; ++m) {
+                bslma::TestAllocator ta("target", veryVeryVeryVerbose);
+
+                const IntVector X(VALUES, VALUES + n, &sa);
+
+                IntVector mY(VALUES + 1, VALUES + 1 + m, &ta);
+                const IntVector& Y = mY;
+
+                const bsls::Types::Int64 NUM = ta.numAllocations();
+
+                mY = X;
+                ASSERTV(n, m, X   == Y);
+                ASSERTV(n, m, &ta == Y.allocator());
+                if (n <= (m > 4 ? m : 4)) {
+                    // The existing storage suffices.
+
+                    ASSERTV(n, m, NUM == ta.numAllocations());
+                }
+
+                mY = Y;
+                ASSERTV(n, m, X == Y);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 'push_back' appends the value, allocating memory only when the
+        //:   size exceeds the inline capacity, and growing geometrically.
+        //:
+        //: 2 Appending a value that refers to an element of a full vector
+        //:   appends the value of that element.
+        //:
+        //: 3 Elements are supplied the vector's allocator.
+        //:
+        //: 4 Bitwise-moveable elements are relocated without invoking their
+        //:   constructors; other elements are relocated by move construction.
+        //:
+        //: 5 'pop_back' and 'clear' destroy elements, and 'clear' retains the
+        //:   capacity.
+        //:
+        //: 6 The destructor destroys the elements and releases the memory.
+        //
+        // Plan:
+        //: 1 Append elements to vectors one at a time, and verify the size,
+        //:   capacity, 'isInline', elements, and allocations.  (C-1..3, 5..6)
+        //:
+        //: 2 Append elements to vectors of 'Counted<0>' and 'Counted<1>'
+        //:   (the latter declared bitwise-moveable), and verify the number of
+        //:   copies and moves.  (C-4)
+        //
+        // Testing:
+        //   explicit SmallVector(bslma::Allocator *basicAllocator = 0);
+        //   ~SmallVector();
+        //   void clear();
+        //   void pop_back();
+        //   void push_back(const TYPE&);
+        //   void push_back(MovableRef<TYPE>);
+        //   const TYPE& operator[](size_t) const;
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   bool isInline() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                        << "========================================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            const IntVector X;
+            ASSERT(&da == X.allocator());
+            ASSERT(X.isInline());
+        }
+
+        if (verbose) cout << "\tAppending values." << endl;
+        {
+            StringVector mX(&sa);  const StringVector& X = mX;
+
+            ASSERT(&sa == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(4   == X.capacity());
+            ASSERT(X.isInline());
+
+            bsl::size_t expCapacity = 4;
+            for (int i = 0; i < 40; ++i) {
+                bsl::string mVALUE(LONG, &sa);
+                mVALUE.push_back(static_cast<char>('0' + i));
+                const bsl::string& VALUE = mVALUE;
+
+                const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+                if (i % 2) {
+                    mX.push_back(VALUE);
+                }
+                else {
+                    bsl::string value(VALUE, &sa);
+                    mX.push_back(MoveUtil::move(value));
+                }
+
+                if (static_cast<bsl::size_t>(i) == expCapacity) {
+                    expCapacity *= 2;
+                }
+                ASSERTV(i, static_cast<bsl::size_t>(i + 1) == X.size());
+                ASSERTV(i, expCapacity == X.capacity());
+                ASSERTV(i, (i < 4) == X.isInline());
+                ASSERTV(i, VALUE == X[i]);
+                ASSERTV(i, &sa == X[i].get_allocator().mechanism());
+                ASSERTV(i, !X.empty());
+
+                if (0 == (i & (i - 1)) && 4 <= i) {
+                    // The vector grew: one block for the element, or none if
+                    // the element was moved, and one for the new storage.
+
+                    ASSERTV(i, sa.numBlocksTotal() - NUM_BLOCKS <= 2);
+                }
+            }
+            ASSERT(0 == da.numAllocations());
+
+            mX.pop_back();
+            ASSERT(39 == X.size());
+            ASSERT(64 == X.capacity());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(64 == X.capacity());
+            ASSERT(!X.isInline());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+
+        if (verbose) cout << "\tAppending an element of the vector." << endl;
+        {
+            StringVector mX(&sa);  const StringVector& X = mX;
+            for (int i = 0; i < 4; ++i) {
+                mX.push_back(bsl::string(LONG) + static_cast<char>('0' + i));
+            }
+            ASSERT(X.size() == X.capacity());
+
+            mX.push_back(X[0]);
+            ASSERT(X[0] == X[4]);
+
+            for (int i = 5; i < 8; ++i) {
+                mX.push_back(bsl::string(LONG));
+            }
+            ASSERT(X.size() == X.capacity());
+
+            mX.push_back(MoveUtil::move(mX[1]));
+            ASSERT(bsl::string(LONG) + '1' == X[8]);
+        }
+        ASSERT(0 == sa.numBytesInUse());
+
+        if (verbose) cout << "\tRelocating elements." << endl;
+        {
+            typedef bdlc::SmallVector<Counted<0>, 4> Vector0;
+            typedef bdlc::SmallVector<Counted<1>, 4> Vector1;
+
+            Vector0 mX(&sa);  const Vector0& X = mX;
+            Vector1 mY(&sa);  const Vector1& Y = mY;
+
+            Counted<0>::resetCounts();
+            Counted<1>::resetCounts();
+
+            for (int i = 0; i < 20; ++i) {
+                const Counted<0> VALUE0(i);
+                const Counted<1> VALUE1(i);
+
+                mX.push_back(VALUE0);
+                mY.push_back(VALUE1);
+            }
+            for (int i = 0; i < 20; ++i) {
+                ASSERTV(i, i == X[i].value());
+                ASSERTV(i, i == Y[i].value());
+            }
+
+            // Growing from 4 to 8, 16, and 32 elements relocates 4 + 8 + 16
+            // elements.
+
+            ASSERTV(Counted<0>::s_numCopies, 20 == Counted<0>::s_numCopies);
+            ASSERTV(Counted<0>::s_numMoves,  28 == Counted<0>::s_numMoves);
+            ASSERTV(Counted<1>::s_numCopies, 20 == Counted<1>::s_numCopies);
+            ASSERTV(Counted<1>::s_numMoves,   0 == Counted<1>::s_numMoves);
+        }
+        ASSERT(0 == sa.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Append elements to a vector beyond its inline capacity, and
+        //:   verify its state.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            IntVector mX(&sa);  const IntVector& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(X.isInline());
+
+            for (int i = 0; i < 4; ++i) {
+                mX.push_back(i);
+            }
+            ASSERT(4 == X.size());
+            ASSERT(X.isInline());
+            ASSERT(0 == sa.numAllocations());
+
+            mX.push_back(4);
+            ASSERT(5 == X.size());
+            ASSERT(!X.isInline());
+            ASSERT(1 == sa.numAllocations());
+
+            const int EXP[] = { 0, 1, 2, 3, 4 };
+            ASSERT(hasValues(X, EXP, 5));
+
+            IntVector mY(X, &sa);  const IntVector& Y = mY;
+            ASSERT(X == Y);
+
+            mY.pop_back();
+            ASSERT(X != Y);
+            ASSERT(Y.isInline() == false);
+
+            mY.shrink_to_fit();
+            ASSERT(Y.isInline());
+            ASSERT(hasValues(Y, EXP, 4));
+        }
+        ASSERT(0 == sa.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ALLOCATIONS AND TIME VS. 'bsl::vector'
+        //
+        // Concerns:
+        //: 1 Populating a short-lived 'bdlc::SmallVector' whose size does not
+        //:   exceed its inline capacity allocates no memory, and is faster
+        //:   than populating a 'bsl::vector'.
+        //
+        // Plan:
+        //: 1 For a range of sizes, create many vectors of each kind, append
+        //:   the given number of 'int' values to each, and destroy them.
+        //:   Report the number of allocations per vector (using a test
+        //:   allocator) and the time per vector (using the new-delete
+        //:   allocator).
+        //
+        // Testing:
+        //   PERFORMANCE: ALLOCATIONS AND TIME VS. 'bsl::vector'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: ALLOCATIONS AND TIME VS. 'bsl::vector'" << endl
+             << "===================================================" << endl;
+
+        typedef bdlc::SmallVector<int, 8> SmallVector;
+        typedef bsl::vector<int>          Vector;
+
+        const int SIZES[]    = { 0, 1, 2, 4, 8, 9, 16, 32 };
+        const int NUM_SIZES  = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+        const int NUM_COUNTS = 1000;
+        const int NUM_TIMES  = 1000000;
+
+        bslma::NewDeleteAllocator& nda =
+                                       bslma::NewDeleteAllocator::singleton();
+
+        cout << "inline capacity 8; allocations and ns per vector" << endl
+             << setw(6)  << "size"
+             << setw(14) << "small allocs"
+             << setw(14) << "vector allocs"
+             << setw(12) << "small ns"
+             << setw(12) << "vector ns"
+             << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bslma::TestAllocator smallAllocator;
+            bslma::TestAllocator vectorAllocator;
+
+            for (int i = 0; i < NUM_COUNTS; ++i) {
+                SmallVector mX(&smallAllocator);
+                populate(&mX, SIZE);
+
+                Vector mY(&vectorAllocator);
+                populate(&mY, SIZE);
+            }
+
+            bsls::Stopwatch smallTimer;
+            bsls::Stopwatch vectorTimer;
+            int             sum = 0;
+
+            smallTimer.start();
+            for (int i = 0; i < NUM_TIMES; ++i) {
+                SmallVector mX(&nda);
+                populate(&mX, SIZE);
+                sum += static_cast<int>(mX.size());
+            }
+            smallTimer.stop();
+
+            vectorTimer.start();
+            for (int i = 0; i < NUM_TIMES; ++i) {
+                Vector mY(&nda);
+                populate(&mY, SIZE);
+                sum += static_cast<int>(mY.size());
+            }
+            vectorTimer.stop();
+
+            ASSERTV(sum, 2 * SIZE * NUM_TIMES == sum);
+
+            cout << fixed << setprecision(2)
+                 << setw(6)  << SIZE
+                 << setw(14) << static_cast<double>(
+                                           smallAllocator.numAllocations())
+                                                                  / NUM_COUNTS
+                 << setw(14) << static_cast<double>(
+                                          vectorAllocator.numAllocations())
+                                                                  / NUM_COUNTS
+                 << setprecision(1)
+                 << setw(12) << smallTimer.accumulatedWallTime()
+                                                            * 1e9 / NUM_TIMES
+                 << setw(12) << vectorTimer.accumulatedWallTime()
+                                                            * 1e9 / NUM_TIMES
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
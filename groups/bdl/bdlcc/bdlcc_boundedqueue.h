@@ -28,6 +28,14 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The 'tryPopFront' method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// Batch methods 'pushBackN', 'tryPushBackN', 'popFrontUpTo', and
+// 'tryPopFrontN' push or pop a range of elements at once.  A batch acquires
+// its elements from the underlying semaphore with a single operation,
+// advances the shared push (or pop) index once, and completes with a single
+// update of the count of operations in progress, so that blocked threads are
+// released once for the whole batch.  This amortizes the cost of
+// synchronization for producers and consumers operating at high rates.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  Any threads blocked in 'pushBack'
@@ -182,6 +190,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslalg_scalarprimitives.h>
 
+#include <bslma_destructionutil.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_istriviallycopyable.h>
@@ -198,6 +207,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
 #include <bsl_cstdint.h>
 
 namespace BloombergLP {
@@ -272,6 +283,101 @@ class BoundedQueue_PushExceptionCompleteProctor {
         // If no queue is currently managed, this method has no effect.
 };
 
+                // ==========================================
+                // class BoundedQueue_PushRangeCompleteGuard
+                // ==========================================
+
+template <class TYPE>
+class BoundedQueue_PushRangeCompleteGuard {
+    // This class implements a guard that, upon destruction, invokes
+    // 'TYPE::pushCompleteN' for a range of reserved nodes, marking the nodes
+    // for which 'advance' was invoked as pushed and the remaining nodes as
+    // aborted.
+
+    // DATA
+    TYPE                *d_queue_p;      // managed queue
+    bsls::Types::Uint64  d_numPushed;    // number of nodes pushed
+    bsls::Types::Uint64  d_numReserved;  // number of nodes reserved
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PushRangeCompleteGuard();
+    BoundedQueue_PushRangeCompleteGuard(
+                                   const BoundedQueue_PushRangeCompleteGuard&);
+    BoundedQueue_PushRangeCompleteGuard& operator=(
+                                   const BoundedQueue_PushRangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PushRangeCompleteGuard(TYPE                *queue,
+                                        bsls::Types::Uint64  numReserved);
+        // Create a 'pushCompleteN' guard managing the specified 'numReserved'
+        // nodes of the specified 'queue'.
+
+    ~BoundedQueue_PushRangeCompleteGuard();
+        // Destroy this object and invoke the 'TYPE::pushCompleteN' method of
+        // the managed queue.
+
+    // MANIPULATORS
+    void advance();
+        // Mark the next managed node as pushed.
+};
+
+                 // =========================================
+                 // class BoundedQueue_PopRangeCompleteGuard
+                 // =========================================
+
+template <class TYPE, class NODE>
+class BoundedQueue_PopRangeCompleteGuard {
+    // This class implements a guard over a range of nodes reserved for
+    // popping from a queue of type 'TYPE'.  The nodes are popped one at a
+    // time with 'popFront', and, upon destruction, the values of the nodes
+    // remaining in the range are destroyed and 'TYPE::popCompleteN' is
+    // invoked for the whole range.
+
+    // DATA
+    TYPE                *d_queue_p;       // managed queue
+    NODE                *d_node_p;        // node at the front of the range
+    bsls::Types::Uint64  d_index;         // next pop index to examine
+    bsls::Types::Uint64  d_endIndex;      // end of the claimed pop indices
+    bsls::Types::Uint64  d_numRemaining;  // number of nodes not yet popped
+    bsls::Types::Uint64  d_numReserved;   // number of nodes reserved
+    bool                 d_isEmpty;       // if true, the empty condition will
+                                          // be signalled
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopRangeCompleteGuard();
+    BoundedQueue_PopRangeCompleteGuard(
+                                    const BoundedQueue_PopRangeCompleteGuard&);
+    BoundedQueue_PopRangeCompleteGuard& operator=(
+                                    const BoundedQueue_PopRangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PopRangeCompleteGuard(TYPE                *queue,
+                                       bsls::Types::Uint64  numReserved,
+                                       bool                 isEmpty);
+        // Create a guard over the specified 'numReserved' nodes of the
+        // specified 'queue' that will cause the empty condition to be
+        // signalled if the specified 'isEmpty' is 'true'.  The behavior is
+        // undefined unless '0 < numReserved' and 'numReserved' elements of
+        // 'queue' have been acquired from its pop semaphore.
+
+    ~BoundedQueue_PopRangeCompleteGuard();
+        // Destroy the values of the remaining nodes of the range, destroy this
+        // object, and invoke the 'TYPE::popCompleteN' method of the managed
+        // queue.
+
+    // MANIPULATORS
+    void popFront();
+        // Destroy the value stored in the node at the front of the range and
+        // remove that node from the range.  The behavior is undefined unless
+        // a node remains in the range.
+
+    // ACCESSORS
+    NODE *node() const;
+        // Return the address of the node at the front of the range.
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -404,6 +510,12 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PushRangeCompleteGuard<BoundedQueue<TYPE> >;
+
+    friend class BoundedQueue_PopRangeCompleteGuard<
+                                            BoundedQueue<TYPE>,
+                                            typename BoundedQueue<TYPE>::Node>;
+
     // PRIVATE CLASS METHODS
     static bool isQuiescentState(bsls::Types::Uint64 count);
         // Return 'true' if the specified 'count' implies a quiescent state
@@ -417,21 +529,55 @@ class BoundedQueue {
         // by a guard to complete the reclamation of a node in the presence of
         // an exception.
 
+    void popCompleteN(Uint64 numPopped, bool isEmpty);
+        // Mark the specified 'numPopped' "pop" operations, whose node values
+        // have been destroyed, as complete, and if the specified 'isEmpty' is
+        // 'true' then signal the queue empty condition.  This method is used
+        // by 'popFrontHelperN' through a guard.
+
     void popFrontHelper(TYPE *value);
         // Remove the element from the front of this queue and load that
         // element into the specified 'value'.  This method is invoked by
         // 'popFront' and 'tryPopFront' once an element is available.
 
+    void popFrontHelperN(TYPE *values, Uint64 numValues);
+        // Remove the specified 'numValues' elements from the front of this
+        // queue and load them, in order, into the leading elements of the
+        // specified 'values' array.  This method is invoked by 'popFrontUpTo'
+        // and 'tryPopFrontN' once 'numValues' elements are available.
+
+    Node *popFrontNode(Uint64 *index, Uint64 *endIndex, Uint64 numNeeded);
+        // Return the address of the next node to pop, skipping nodes marked
+        // for reclamation, starting at the specified 'index' in the range of
+        // claimed pop indices ending at the specified 'endIndex', and update
+        // 'index' (and, if needed, 'endIndex') accordingly.  If no claimed pop
+        // index remains, claim the specified 'numNeeded' subsequent pop
+        // indices, where 'numNeeded' is the number of nodes still to be popped
+        // by the caller.
+
     void pushComplete();
         // Mark a "push" operation as complete, and 'post' to the
         // 'd_popSemaphore' if appropriate.
 
+    void pushCompleteN(Uint64 numPushed, Uint64 numAborted);
+        // Mark the specified 'numPushed' "push" operations as complete, remove
+        // the indicators for the specified 'numAborted' started "push"
+        // operations whose nodes are marked to reclaim, and 'post' to the
+        // 'd_popSemaphore' if appropriate.  This method is used by
+        // 'pushBackHelperN' through a guard.
+
     void pushExceptionComplete();
         // Remove the indicator for a started push operation, and 'post' to the
         // 'd_popSemaphore' if appropriate.  This method is used within
         // 'pushFront' by a proctor to complete the marking of a node to
         // reclaim in the presence of an exception.
 
+    void pushBackHelperN(const TYPE *values, Uint64 numValues);
+        // Append, in order, the specified 'numValues' leading elements of the
+        // specified 'values' array to the back of this queue.  This method is
+        // invoked by 'pushBackN' and 'tryPushBackN' once 'numValues' empty
+        // elements are available.
+
     // NOT IMPLEMENTED
     BoundedQueue(const BoundedQueue&);
     BoundedQueue& operator=(const BoundedQueue&);
@@ -492,6 +638,32 @@ class BoundedQueue {
         // due to the queue being full will return 'e_DISABLED' if
         // 'disablePushBack' is invoked.
 
+    int popFrontUpTo(bsl::size_t *numPopped,
+                     TYPE        *values,
+                     bsl::size_t  maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the leading elements of the
+        // specified 'values' array, and load into the specified 'numPopped'
+        // the number of elements removed.  If the queue is empty, block until
+        // it is not empty.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' on success (in which
+        // case '0 < *numPopped'), 'e_DISABLED' if 'isPopFrontDisabled()' and
+        // 'e_FAILED' if an error occurs.  On failure, 'numPopped' and 'values'
+        // are not changed.  Threads blocked due to the queue being empty will
+        // return 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior
+        // is undefined unless '0 < maxNumValues'.
+
+    int pushBackN(const TYPE *values, bsl::size_t numValues);
+        // Append, in order, the specified 'numValues' leading elements of the
+        // specified 'values' array to the back of this queue.  If the queue is
+        // full, block until it is not full; the elements are appended in
+        // batches as space becomes available.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success, 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an
+        // error occurs.  On failure, a (possibly empty) leading part of
+        // 'values' has been appended.  Threads blocked due to the queue being
+        // full will return 'e_DISABLED' if 'disablePushBack' is invoked.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -522,6 +694,33 @@ class BoundedQueue {
         // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
         // 'e_FAILED' if an error occurs.  On failure, 'value' is not changed.
 
+    int tryPopFrontN(bsl::size_t *numPopped,
+                     TYPE        *values,
+                     bsl::size_t  maxNumValues);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, load them, in order, into
+        // the leading elements of the specified 'values' array, and load into
+        // the specified 'numPopped' the number of elements removed.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success (in which case '0 < *numPopped'),
+        // 'e_DISABLED' if 'isPopFrontDisabled()', 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
+        // an error occurs.  On failure, 'numPopped' and 'values' are not
+        // changed.  The behavior is undefined unless '0 < maxNumValues'.
+
+    int tryPushBackN(bsl::size_t *numPushed,
+                     const TYPE  *values,
+                     bsl::size_t  numValues);
+        // Attempt to append, in order, up to the specified 'numValues' leading
+        // elements of the specified 'values' array to the back of this queue
+        // without blocking, and load into the specified 'numPushed' the number
+        // of elements appended.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' on success (in which
+        // case '0 < *numPushed'), 'e_DISABLED' if 'isPushBackDisabled()',
+        // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
+        // 'e_FAILED' if an error occurs.  On failure, 'numPushed' is not
+        // changed.  The behavior is undefined unless '0 < numValues'.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -641,6 +840,95 @@ void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
     d_queue_p = 0;
 }
 
+                // ------------------------------------------
+                // class BoundedQueue_PushRangeCompleteGuard
+                // ------------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushRangeCompleteGuard<TYPE>::BoundedQueue_PushRangeCompleteGuard(
+                                              TYPE                *queue,
+                                              bsls::Types::Uint64  numReserved)
+: d_queue_p(queue)
+, d_numPushed(0)
+, d_numReserved(numReserved)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushRangeCompleteGuard<TYPE>::
+                                         ~BoundedQueue_PushRangeCompleteGuard()
+{
+    d_queue_p->pushCompleteN(d_numPushed, d_numReserved - d_numPushed);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushRangeCompleteGuard<TYPE>::advance()
+{
+    ++d_numPushed;
+}
+
+                 // -----------------------------------------
+                 // class BoundedQueue_PopRangeCompleteGuard
+                 // -----------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+inline
+BoundedQueue_PopRangeCompleteGuard<TYPE, NODE>::
+                    BoundedQueue_PopRangeCompleteGuard(
+                                              TYPE                *queue,
+                                              bsls::Types::Uint64  numReserved,
+                                              bool                 isEmpty)
+: d_queue_p(queue)
+, d_node_p(0)
+, d_index(0)
+, d_endIndex(0)
+, d_numRemaining(numReserved)
+, d_numReserved(numReserved)
+, d_isEmpty(isEmpty)
+{
+    d_node_p = d_queue_p->popFrontNode(&d_index, &d_endIndex, d_numRemaining);
+}
+
+template <class TYPE, class NODE>
+BoundedQueue_PopRangeCompleteGuard<TYPE, NODE>::
+                                          ~BoundedQueue_PopRangeCompleteGuard()
+{
+    while (d_numRemaining) {
+        popFront();
+    }
+    d_queue_p->popCompleteN(d_numReserved, d_isEmpty);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void BoundedQueue_PopRangeCompleteGuard<TYPE, NODE>::popFront()
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    bslma::DestructionUtil::destroy(d_node_p->d_value.address());
+
+    if (--d_numRemaining) {
+        d_node_p = d_queue_p->popFrontNode(&d_index,
+                                           &d_endIndex,
+                                           d_numRemaining);
+    }
+}
+
+// ACCESSORS
+template <class TYPE, class NODE>
+inline
+NODE *BoundedQueue_PopRangeCompleteGuard<TYPE, NODE>::node() const
+{
+    return d_node_p;
+}
+
                          // ------------------------
                          // struct BoundedQueue_Node
                          // ------------------------
@@ -716,6 +1004,35 @@ void BoundedQueue<TYPE>::popComplete(Node *node, bool isEmpty)
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popCompleteN(Uint64 numPopped, bool isEmpty)
+{
+    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_popCount,
+                                               numPopped * k_FINISHED_INC);
+    if (isQuiescentState(count)) {
+
+        // The total number of popped elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the
+        // push semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.post(static_cast<int>(count & k_STARTED_MASK));
+        }
+    }
+
+    if (isEmpty) {
+        AtomicOp::addUintAcqRel(&d_emptyGeneration, 1);
+        if (0 < AtomicOp::getUintAcquire(&d_emptyCount)) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+            }
+            d_emptyCondition.broadcast();
+        }
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 {
@@ -753,6 +1070,55 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 #endif
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popFrontHelperN(TYPE *values, Uint64 numValues)
+{
+    bool empty = isEmpty();
+
+    AtomicOp::addUint64AcqRel(&d_popCount, numValues * k_STARTED_INC);
+
+    BoundedQueue_PopRangeCompleteGuard<BoundedQueue<TYPE>, Node>
+                                                 guard(this, numValues, empty);
+
+    for (Uint64 i = 0; i < numValues; ++i) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[i] = bslmf::MovableRefUtil::move(
+                                               guard.node()->d_value.object());
+#else
+        values[i] = guard.node()->d_value.object();
+#endif
+        guard.popFront();
+    }
+}
+
+template <class TYPE>
+typename BoundedQueue<TYPE>::Node *BoundedQueue<TYPE>::popFrontNode(
+                                                         Uint64 *index,
+                                                         Uint64 *endIndex,
+                                                         Uint64  numNeeded)
+{
+    while (true) {
+        if (*index == *endIndex) {
+            // 'd_popIndex' stores the next location to use (want the original
+            // value)
+
+            *endIndex = AtomicOp::addUint64NvAcqRel(&d_popIndex, numNeeded);
+            *index    = *endIndex - numNeeded;
+        }
+
+        Node *node = &d_element_p[(*index)++ % d_capacity];
+
+        // As in 'popFrontHelper', nodes marked for reclamation are skipped
+        // and counted in 'd_popCount' as started and finished.
+
+        if (!node->reclaim()) {
+            return node;                                              // RETURN
+        }
+
+        AtomicOp::addUint64AcqRel(&d_popCount, k_STARTED_INC + k_FINISHED_INC);
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::pushComplete()
 {
@@ -771,6 +1137,33 @@ void BoundedQueue<TYPE>::pushComplete()
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::pushCompleteN(Uint64 numPushed, Uint64 numAborted)
+{
+    // Note that 'numAborted' started operations were previously recorded, so
+    // the subtraction does not borrow from the finished attribute.
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                                             &d_pushCount,
+                                             numPushed  * k_FINISHED_INC
+                                           - numAborted * k_STARTED_INC);
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.post(numToPost);
+        }
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::pushExceptionComplete()
 {
@@ -792,6 +1185,38 @@ void BoundedQueue<TYPE>::pushExceptionComplete()
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBackHelperN(const TYPE *values, Uint64 numValues)
+{
+    AtomicOp::addUint64AcqRel(&d_pushCount, numValues * k_STARTED_INC);
+
+    // 'd_pushIndex' stores the next location to use (want the original value)
+
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, numValues)
+                                                                   - numValues;
+
+    // Mark all the nodes to reclaim first, so that the nodes remaining after
+    // an exception are skipped by "pop" operations.
+
+    for (Uint64 i = 0; i < numValues; ++i) {
+        d_element_p[(index + i) % d_capacity].assignReclaim(true);
+    }
+
+    BoundedQueue_PushRangeCompleteGuard<BoundedQueue<TYPE> >
+                                                       guard(this, numValues);
+
+    for (Uint64 i = 0; i < numValues; ++i) {
+        Node& node = d_element_p[(index + i) % d_capacity];
+
+        bslalg::ScalarPrimitives::copyConstruct(node.d_value.address(),
+                                                values[i],
+                                                d_allocator_p);
+
+        node.assignReclaim(false);
+        guard.advance();
+    }
+}
+
 // CREATORS
 template <class TYPE>
 BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
@@ -922,6 +1347,69 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::popFrontUpTo(bsl::size_t *numPopped,
+                                     TYPE        *values,
+                                     bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    int rv = d_popSemaphore.wait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    // Acquire, without blocking, as many of the remaining elements as are
+    // available.
+
+    const int maxToTake = static_cast<int>(
+                  bsl::min<bsl::size_t>(maxNumValues - 1, INT_MAX));
+
+    Uint64 count = 1 + d_popSemaphore.take(maxToTake);
+
+    popFrontHelperN(values, count);
+
+    *numPopped = static_cast<bsl::size_t>(count);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBackN(const TYPE *values, bsl::size_t numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    while (0 < numValues) {
+        int rv = d_pushSemaphore.wait();
+        if (rv) {
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+
+        // Acquire, without blocking, as many of the remaining empty elements
+        // as are available.
+
+        const int maxToTake = static_cast<int>(
+                      bsl::min<bsl::size_t>(numValues - 1, INT_MAX));
+
+        Uint64 count = 1 + d_pushSemaphore.take(maxToTake);
+
+        pushBackHelperN(values, count);
+
+        values    += count;
+        numValues -= static_cast<bsl::size_t>(count);
+    }
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::removeAll()
 {
@@ -1056,6 +1544,70 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
 
     pushComplete();
 
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFrontN(bsl::size_t *numPopped,
+                                     TYPE        *values,
+                                     bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    int rv = d_popSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_EMPTY;                                           // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    const int maxToTake = static_cast<int>(
+                  bsl::min<bsl::size_t>(maxNumValues - 1, INT_MAX));
+
+    Uint64 count = 1 + d_popSemaphore.take(maxToTake);
+
+    popFrontHelperN(values, count);
+
+    *numPopped = static_cast<bsl::size_t>(count);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPushBackN(bsl::size_t *numPushed,
+                                     const TYPE  *values,
+                                     bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < numValues);
+
+    int rv = d_pushSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_FULL;                                            // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    const int maxToTake = static_cast<int>(
+                  bsl::min<bsl::size_t>(numValues - 1, INT_MAX));
+
+    Uint64 count = 1 + d_pushSemaphore.take(maxToTake);
+
+    pushBackHelperN(values, count);
+
+    *numPushed = static_cast<bsl::size_t>(count);
+
     return e_SUCCESS;
 }
 
@@ -85,6 +85,10 @@ using namespace bsl;
 // [ 7] int tryPopFront(TYPE *value);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int popFrontUpTo(bsl::size_t *, TYPE *, bsl::size_t);
+// [13] int pushBackN(const TYPE *values, bsl::size_t numValues);
+// [13] int tryPopFrontN(bsl::size_t *, TYPE *, bsl::size_t);
+// [13] int tryPushBackN(bsl::size_t *, const TYPE *, bsl::size_t);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
@@ -98,7 +102,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -751,6 +755,68 @@ extern "C" void *pushWaitDisable(void *arg)
     return 0;
 }
 
+const int k_BATCH_SEQUENCE_BITS = 20;
+const int k_BATCH_SEQUENCE_MASK = (1 << k_BATCH_SEQUENCE_BITS) - 1;
+
+void batchProducer(Obj *queue, int producerId, int numItems, int batchSize)
+    // Push, with 'pushBackN' in batches of the specified 'batchSize', the
+    // specified 'numItems' values encoding the specified 'producerId' and an
+    // increasing sequence number onto the specified 'queue'.
+{
+    bsl::vector<int> values(batchSize);
+
+    for (int i = 0; i < numItems; i += batchSize) {
+        const int n = numItems - i < batchSize ? numItems - i : batchSize;
+        for (int j = 0; j < n; ++j) {
+            values[j] = (producerId << k_BATCH_SEQUENCE_BITS) | (i + j);
+        }
+        ASSERT(e_SUCCESS == queue->pushBackN(values.data(), n));
+    }
+}
+
+void batchConsumer(Obj             *queue,
+                   bsls::AtomicInt *numConsumed,
+                   int              numProducers,
+                   int              batchSize)
+    // Pop values, with 'popFrontUpTo' in batches of up to the specified
+    // 'batchSize', from the specified 'queue' until a negative value is
+    // popped, verify that the values pushed by each of the specified
+    // 'numProducers' producers are observed in order, and add the number of
+    // values popped (other than negative values) to the specified
+    // 'numConsumed'.  Negative values popped in excess of one are pushed back
+    // for the other consumers.
+{
+    bsl::vector<int> values(batchSize);
+    bsl::vector<int> lastSequence(numProducers, -1);
+
+    int numStops = 0;
+    while (0 == numStops) {
+        bsl::size_t n = 0;
+
+        ASSERT(e_SUCCESS == queue->popFrontUpTo(&n, values.data(), batchSize));
+        ASSERT(0 < n && n <= static_cast<bsl::size_t>(batchSize));
+
+        for (bsl::size_t j = 0; j < n; ++j) {
+            if (values[j] < 0) {
+                ++numStops;
+                continue;
+            }
+            const int producerId = values[j] >> k_BATCH_SEQUENCE_BITS;
+            const int sequence   = values[j] & k_BATCH_SEQUENCE_MASK;
+
+            ASSERTV(producerId,
+                    sequence,
+                    lastSequence[producerId] < sequence);
+            lastSequence[producerId] = sequence;
+            ++(*numConsumed);
+        }
+    }
+
+    while (1 < numStops--) {
+        queue->pushBack(-1);
+    }
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -971,7 +1037,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1009,6 +1075,212 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // BATCH PUSH AND POP
+        //
+        // Concerns:
+        //: 1 'tryPushBackN' appends, in order, as many of the values as there
+        //:   is space for and reports the number appended.
+        //:
+        //: 2 'tryPopFrontN' and 'popFrontUpTo' remove, in order, up to the
+        //:   requested number of elements and report the number removed.
+        //:
+        //: 3 The methods fail, without modifying their output arguments, with
+        //:   the status of the corresponding single-element method when the
+        //:   queue is full, empty, or disabled.
+        //:
+        //: 4 An exception thrown while copying an element of a batch leaves
+        //:   the elements already appended in the queue, and the nodes of the
+        //:   remaining elements are reclaimed.
+        //:
+        //: 5 Under contention, every element pushed with 'pushBackN' is popped
+        //:   exactly once by 'popFrontUpTo', in order per producer.
+        //
+        // Plan:
+        //: 1 Push and pop batches of various sizes, including batches larger
+        //:   than the available space and batches wrapping around the end of
+        //:   the buffer, and verify the values and 'numElements'.  (C-1..2)
+        //:
+        //: 2 Verify the status of the methods for a full, empty, and disabled
+        //:   queue.  (C-3)
+        //:
+        //: 3 Using a test allocator with an allocation limit, cause an
+        //:   exception while pushing a batch of allocating elements, and
+        //:   verify the state of the queue.  (C-4)
+        //:
+        //: 4 Run several producer and consumer threads exchanging batches of
+        //:   values encoding the producer and a sequence number, and verify
+        //:   the count and order of the values consumed.  (C-5)
+        //
+        // Testing:
+        //   int popFrontUpTo(bsl::size_t *, TYPE *, bsl::size_t);
+        //   int pushBackN(const TYPE *values, bsl::size_t numValues);
+        //   int tryPopFrontN(bsl::size_t *, TYPE *, bsl::size_t);
+        //   int tryPushBackN(bsl::size_t *, const TYPE *, bsl::size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH PUSH AND POP" << endl
+                          << "==================" << endl;
+
+        if (verbose) cout << "\nTesting single-threaded batches." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(5, &sa);  const Obj& X = mX;
+
+            const int   VALUES[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+            int         values[10];
+            bsl::size_t n = 99;
+
+            ASSERT(e_EMPTY == mX.tryPopFrontN(&n, values, 10));
+            ASSERT(     99 == n);
+
+            ASSERT(e_SUCCESS == mX.tryPushBackN(&n, VALUES, 3));
+            ASSERT(        3 == n);
+            ASSERT(        3 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.tryPushBackN(&n, VALUES + 3, 7));
+            ASSERT(        2 == n);
+            ASSERT(        5 == X.numElements());
+            ASSERT(X.isFull());
+
+            n = 99;
+            ASSERT(e_FULL == mX.tryPushBackN(&n, VALUES, 1));
+            ASSERT(    99 == n);
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontN(&n, values, 4));
+            ASSERT(        4 == n);
+            ASSERT(        1 == X.numElements());
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, values[i], i == values[i]);
+            }
+
+            // The batch wraps around the end of the buffer.
+
+            ASSERT(e_SUCCESS == mX.tryPushBackN(&n, VALUES + 5, 5));
+            ASSERT(        4 == n);
+
+            ASSERT(e_SUCCESS == mX.popFrontUpTo(&n, values, 10));
+            ASSERT(        5 == n);
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, values[i], i + 4 == values[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_SUCCESS == mX.pushBackN(VALUES, 5));
+            ASSERT(        5 == X.numElements());
+
+            mX.disablePushBack();
+            n = 99;
+            ASSERT(e_DISABLED == mX.tryPushBackN(&n, VALUES, 1));
+            ASSERT(e_DISABLED == mX.pushBackN(VALUES, 1));
+            ASSERT(        99 == n);
+            mX.enablePushBack();
+
+            mX.disablePopFront();
+            ASSERT(e_DISABLED == mX.tryPopFrontN(&n, values, 1));
+            ASSERT(e_DISABLED == mX.popFrontUpTo(&n, values, 1));
+            ASSERT(        99 == n);
+            mX.enablePopFront();
+
+            ASSERT(e_SUCCESS == mX.popFrontUpTo(&n, values, 10));
+            ASSERT(        5 == n);
+            ASSERT(X.isEmpty());
+        }
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nTesting exceptions in batches." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bdlcc::BoundedQueue<AllocExceptionHelper>        mX(8, &sa);
+            const bdlcc::BoundedQueue<AllocExceptionHelper>& X = mX;
+
+            bsl::vector<AllocExceptionHelper> values(&sa);
+            for (int i = 0; i < 3; ++i) {
+                values.push_back(AllocExceptionHelper(&sa));
+            }
+
+            ASSERT(e_SUCCESS == mX.pushBack(values[0]));
+
+            int numException = 0;
+
+            sa.setAllocationLimit(1);
+            try {
+                bsl::size_t n;
+                mX.tryPushBackN(&n, values.data(), 3);
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
+
+            ASSERT(1 == numException);
+            ASSERT(2 == X.numElements());
+
+            bsl::size_t n = 0;
+
+            ASSERT(e_SUCCESS == mX.pushBackN(values.data(), 3));
+            ASSERT(        5 == X.numElements());
+
+            // The two reclaimed nodes are skipped.
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontN(&n, values.data(), 3));
+            ASSERT(        3 == n);
+            ASSERT(        2 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.popFrontUpTo(&n, values.data(), 3));
+            ASSERT(        2 == n);
+            ASSERT(X.isEmpty());
+
+            // All the nodes are available.
+
+            for (int i = 0; i < 8; ++i) {
+                ASSERTV(i, e_SUCCESS == mX.tryPushBack(values[0]));
+            }
+            ASSERT(X.isFull());
+            mX.removeAll();
+        }
+#endif
+        if (verbose) cout << "\nTesting concurrent batches." << endl;
+        {
+            const int k_NUM_PRODUCERS = 4;
+            const int k_NUM_CONSUMERS = 4;
+            const int k_NUM_ITEMS     = 20000;
+            const int k_BATCH_SIZE    = 7;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj             mX(32, &sa);
+            bsls::AtomicInt numConsumed(0);
+
+            bslmt::ThreadGroup consumers;
+            consumers.addThreads(bdlf::BindUtil::bind(&batchConsumer,
+                                                      &mX,
+                                                      &numConsumed,
+                                                      k_NUM_PRODUCERS,
+                                                      k_BATCH_SIZE),
+                                 k_NUM_CONSUMERS);
+
+            bslmt::ThreadGroup producers;
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                producers.addThread(bdlf::BindUtil::bind(&batchProducer,
+                                                         &mX,
+                                                         i,
+                                                         k_NUM_ITEMS,
+                                                         k_BATCH_SIZE));
+            }
+            producers.joinAll();
+
+            for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+                mX.pushBack(-1);
+            }
+            consumers.joinAll();
+
+            ASSERTV(numConsumed,
+                    k_NUM_PRODUCERS * k_NUM_ITEMS == numConsumed);
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // DRQS 153332608: 'waitUntilEmpty' RACE WITH 'popFront'
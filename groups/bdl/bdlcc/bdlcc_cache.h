@@ -10,6 +10,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlcc::Cache: in-process key-value cache
 //
+//@SEE_ALSO: bdlcc_shardedcache
+//
 //@DESCRIPTION: This component defines a single class template, 'bdlcc::Cache',
 // implementing a thread-safe in-memory key-value cache with a configurable
 // eviction policy.
@@ -27,11 +29,20 @@ BSLS_IDENT("$Id: $")
 // fixed maximum size is obtained by setting the high and low watermarks to the
 // same value.
 //
-// Two eviction policies are supported: LRU (Least Recently Used) and FIFO
-// (First In, First Out).  With LRU, the item that has *not* been accessed for
-// the longest period of time will be evicted first.  With FIFO, the eviction
-// order is based on the order of insertion, with the earliest inserted item
-// being evicted first.
+// Three eviction policies are supported: LRU (Least Recently Used), FIFO
+// (First In, First Out), and CLOCK.  With LRU, the item that has *not* been
+// accessed for the longest period of time will be evicted first.  With FIFO,
+// the eviction order is based on the order of insertion, with the earliest
+// inserted item being evicted first.
+//
+// CLOCK (also known as "second chance") is an approximation of LRU.  A
+// successful 'tryGetValue' merely sets a reference flag on the item, which
+// can be done while holding only a read lock.  When an item must be evicted,
+// the eviction queue is examined from the front: an item whose reference flag
+// is set has the flag cleared and is moved to the back of the queue, and the
+// first item found whose flag is not set is evicted.  Frequently accessed
+// items are therefore retained as with LRU, but the eviction order among
+// items accessed since they were last examined is that of insertion.
 //
 ///Thread Safety
 ///-------------
@@ -49,10 +60,17 @@ BSLS_IDENT("$Id: $")
 // All of the modifier methods of the cache potentially requires a write lock.
 // Of particular note is the 'tryGetValue' method, which requires a writer lock
 // only if the eviction queue needs to be modified.  This means 'tryGetValue'
-// requires only a read lock if the eviction policy is set to FIFO or the
-// argument 'modifyEvictionQueue' is set to 'false'.  For limited cases where
-// contention is likely, temporarily setting 'modifyEvictionQueue' to 'false'
-// might be of value.
+// requires only a read lock if the eviction policy is set to FIFO or CLOCK,
+// or the argument 'modifyEvictionQueue' is set to 'false'.  For limited cases
+// where contention is likely, temporarily setting 'modifyEvictionQueue' to
+// 'false' might be of value.  Where contention on reads is common, the CLOCK
+// eviction policy avoids the write lock on every access while retaining most
+// of the benefit of LRU; the cost of reordering the eviction queue is instead
+// borne by the thread performing an insertion that triggers eviction.
+//
+// Where many threads access the same cache concurrently, 'bdlcc_shardedcache'
+// provides a cache having the same interface that partitions its items among
+// independently locked 'bdlcc::Cache' shards.
 //
 // The 'visit' method acquires a read lock and calls the supplied visitor
 // function for every item in the cache, or until the visitor function returns
@@ -88,7 +106,8 @@ BSLS_IDENT("$Id: $")
 // +----------------------------------------------------+--------------------+
 // | tryGetValue                                        | O[1]               |
 // +----------------------------------------------------+--------------------+
-// | popFront                                           | O[1]               |
+// | popFront                                           | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
 // +----------------------------------------------------+--------------------+
 // | erase                                              | O[1]               |
 // +----------------------------------------------------+--------------------+
@@ -308,6 +327,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_review.h>
 
 #include <bsl_memory.h>
@@ -329,11 +349,50 @@ struct CacheEvictionPolicy {
     enum Enum {
         // Enumeration of supported cache eviction policies.
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,   // Least Recently Used
+        e_FIFO,  // First In, First Out
+        e_CLOCK  // approximate LRU, giving accessed items a second chance
     };
 };
 
+                        // =====================
+                        // struct Cache_MapValue
+                        // =====================
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+struct Cache_MapValue {
+    // This 'struct' holds the value of an item in a 'Cache', the position of
+    // the item in the eviction queue, and, for the CLOCK eviction policy, a
+    // flag indicating whether the item has been accessed since it was last
+    // examined for eviction.  The flag may be set while only a read lock on
+    // the cache is held.
+
+    // PUBLIC DATA
+    VALUE_PTR                d_valuePtr;    // pointer to the cached value
+
+    QUEUE_ITERATOR           d_queueIt;     // position in the eviction queue
+
+    bsls::AtomicBool         d_referenced;  // 'true' if accessed since last
+                                            // examined for eviction
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_MapValue& operator=(const Cache_MapValue&);
+
+  public:
+    // CREATORS
+    Cache_MapValue(const VALUE_PTR& valuePtr, QUEUE_ITERATOR queueIt);
+    Cache_MapValue(bslmf::MovableRef<VALUE_PTR> valuePtr,
+                   QUEUE_ITERATOR               queueIt);
+        // Create a 'Cache_MapValue' object holding the specified 'valuePtr'
+        // and 'queueIt', whose reference flag is not set.
+
+    Cache_MapValue(const Cache_MapValue& original);
+    Cache_MapValue(bslmf::MovableRef<Cache_MapValue> original);
+        // Create a 'Cache_MapValue' object having the same value and
+        // reference flag as the specified 'original' object.
+};
+
 template <class KEY>
 class Cache_QueueProctor {
     // This class implements a proctor that, on destruction, restores the queue
@@ -398,7 +457,8 @@ class Cache {
     typedef bsl::list<KEY>                                        QueueType;
         // Eviction queue type.
 
-    typedef bsl::pair<ValuePtrType, typename QueueType::iterator> MapValue;
+    typedef Cache_MapValue<ValuePtrType, typename QueueType::iterator>
+                                                                  MapValue;
         // Value type of the hash map.
 
     typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL>        MapType;
@@ -447,6 +507,13 @@ class Cache {
         // 'size() < lowWatermark()' beginning from the front of the eviction
         // queue.  Invoke the post-eviction callback for each item evicted.
 
+    typename MapType::iterator evictionCandidate();
+        // Return an iterator to the next item to be evicted from this cache.
+        // If the eviction policy is CLOCK, first move each item at the front
+        // of the eviction queue whose reference flag is set to the back of
+        // the queue, clearing its flag.  The behavior is undefined if this
+        // cache is empty.
+
     void evictItem(const typename MapType::iterator& mapIt);
         // Evict the item at the specified 'mapIt' and invoke the post-eviction
         // callback for that item.
@@ -591,7 +658,9 @@ class Cache {
         // Load, into the specified 'value', the value associated with the
         // specified 'key' in this cache.  If the optionally specified
         // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
-        // move the cached item to the back of the eviction queue.  Return 0 on
+        // move the cached item to the back of the eviction queue; if
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is CLOCK,
+        // then set the reference flag of the cached item.  Return 0 on
         // success, and 1 if 'key' does not exist in this cache.  Note that a
         // write lock is acquired only if this queue is modified.
 
@@ -624,7 +693,10 @@ class Cache {
         // Call the specified 'visitor' for every item stored in this cache in
         // the order of the eviction queue until 'visitor' returns 'false'.
         // The 'VISITOR' type must be a callable object that can be invoked in
-        // the same way as the function 'bool (const KEY&, const VALUE&)'
+        // the same way as the function 'bool (const KEY&, const VALUE&)'.
+        // Note that, if the eviction policy is CLOCK, the reference flags of
+        // the items are not considered, so the order of the visit is not
+        // necessarily the order in which the items would be evicted.
 };
 
 template <class KEY,
@@ -704,6 +776,55 @@ void Cache_QueueProctor<KEY>::release()
     d_queue_p = 0;
 }
 
+                        // ---------------------
+                        // struct Cache_MapValue
+                        // ---------------------
+
+// CREATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                                 const VALUE_PTR& valuePtr,
+                                                 QUEUE_ITERATOR   queueIt)
+: d_valuePtr(valuePtr)
+, d_queueIt(queueIt)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                     bslmf::MovableRef<VALUE_PTR> valuePtr,
+                                     QUEUE_ITERATOR               queueIt)
+: d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+, d_queueIt(queueIt)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                                const Cache_MapValue& original)
+: d_valuePtr(original.d_valuePtr)
+, d_queueIt(original.d_queueIt)
+, d_referenced(original.d_referenced.loadRelaxed())
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                   bslmf::MovableRef<Cache_MapValue> original)
+: d_valuePtr(bslmf::MovableRefUtil::move(
+                   bslmf::MovableRefUtil::access(original).d_valuePtr))
+, d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+, d_referenced(
+          bslmf::MovableRefUtil::access(original).d_referenced.loadRelaxed())
+{
+}
+
                         // -----------
                         // class Cache
                         // -----------
@@ -770,19 +891,42 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 
     while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(evictionCandidate());
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::evictionCandidate()
+{
+    BSLS_ASSERT(!d_queue.empty());
+
+    typename MapType::iterator mapIt = d_map.find(d_queue.front());
+    BSLS_ASSERT(mapIt != d_map.end());
+
+    if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy) {
+        // Since the write lock is held, no flag can be set during this loop,
+        // so every item is examined at most twice.
+
+        while (mapIt->second.d_referenced.loadRelaxed()) {
+            mapIt->second.d_referenced.storeRelaxed(false);
+            d_queue.splice(d_queue.end(), d_queue, d_queue.begin());
+
+            mapIt = d_map.find(d_queue.front());
+            BSLS_ASSERT(mapIt != d_map.end());
+        }
     }
+
+    return mapIt;
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
 {
-    ValuePtrType value = mapIt->second.first;
+    ValuePtrType value = mapIt->second.d_valuePtr;
 
-    d_queue.erase(mapIt->second.second);
+    d_queue.erase(mapIt->second.d_queueIt);
     d_map.erase(mapIt);
 
     if (d_postEvictionCallback) {
@@ -811,13 +955,13 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt != d_map.end()) {
         if (k_RVALUE_ASSIGN && moveValuePtr) {
-            mapIt->second.first = bslmf::MovableRefUtil::move(valuePtr);
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
         }
         else {
-            mapIt->second.first = valuePtr;
+            mapIt->second.d_valuePtr = valuePtr;
         }
 
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
 
         // Move 'queueIt' to the back of 'd_queue'.
 
@@ -836,13 +980,10 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
 
         if (moveValuePtr) {
             new (mapValue_p) MapValue(bslmf::MovableRefUtil::move(valuePtr),
-                                      queueIt,
-                                      d_allocator_p);
+                                      queueIt);
         }
         else {
-            new (mapValue_p) MapValue(valuePtr,
-                                      queueIt,
-                                      d_allocator_p);
+            new (mapValue_p) MapValue(valuePtr, queueIt);
         }
         bslma::DestructorGuard<MapValue> mapValueGuard(mapValue_p);
 
@@ -1072,9 +1213,7 @@ int Cache<KEY, VALUE, HASH, EQUAL>::popFront()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
 
     if (d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(evictionCandidate());
         return 0;                                                     // RETURN
     }
 
@@ -1115,16 +1254,24 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
         return 1;                                                     // RETURN
     }
 
-    *value = mapIt->second.first;
+    *value = mapIt->second.d_valuePtr;
 
     if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
         typename QueueType::iterator last = d_queue.end();
         --last;
         if (last != queueIt) {
             d_queue.splice(d_queue.end(), d_queue, queueIt);
         }
     }
+    else if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy &&
+             modifyEvictionQueue &&
+             !mapIt->second.d_referenced.loadRelaxed()) {
+        // Test before setting, to avoid writing to the cache line of a
+        // frequently accessed item on every access.
+
+        mapIt->second.d_referenced.storeRelaxed(true);
+    }
 
     return 0;
 }
@@ -1186,7 +1333,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
         const KEY&                             key = *queueIt;
         const typename MapType::const_iterator mapIt = d_map.find(key);
         BSLS_ASSERT(mapIt != d_map.end());
-        const ValuePtrType& valuePtr = mapIt->second.first;
+        const ValuePtrType& valuePtr = mapIt->second.d_valuePtr;
 
         if (!visitor(key, *valuePtr)) {
             break;
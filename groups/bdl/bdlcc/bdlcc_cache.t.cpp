@@ -9,7 +9,11 @@
 #include <bdlb_random.h>
 #include <bdlb_randomdevice.h>
 
+#include <bdlf_bind.h>
+
 #include <bslim_testutil.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_semaphore.h>
 
@@ -32,9 +36,11 @@
 #include <bsls_atomic.h>
 #include <bsls_review.h>
 #include <bsls_nameof.h>
+#include <bsls_stopwatch.h>
 #include <bsls_timeutil.h>  // 'CachePerformance'
 #include <bsls_types.h>     // 'BloombergLP::bsls::Types::Int64'
 
+#include <bsl_algorithm.h>  // 'lower_bound'
 #include <bsl_iostream.h>
 #include <bsl_vector.h>
 #include <bsl_string.h>
@@ -128,11 +134,14 @@ using namespace bsl;
 // [15] THREAD SAFETY
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
-// [18] USAGE EXAMPLE
+// [18] REPRODUCE DRQS 134930805
+// [19] CLOCK EVICTION POLICY
+// [20] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
 // [-4] READ WRITE PERFORMANCE
+// [-5] SKEWED ACCESS PERFORMANCE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -471,6 +480,41 @@ static bsl::ostream& printCache(
     return stream;
 }
 
+class EvictionRecorder {
+    // This class provides a post-eviction callback that appends each evicted
+    // 'int' value to a vector.
+
+    bsl::vector<int> *d_evicted_p;
+
+  public:
+    explicit EvictionRecorder(bsl::vector<int> *evicted)
+    : d_evicted_p(evicted)
+    {}
+
+    void operator()(const bsl::shared_ptr<int>& value)
+    {
+        d_evicted_p->push_back(*value);
+    }
+};
+
+class VisitorRecorder {
+    // This class provides a visitor that appends each visited 'int' key to a
+    // vector.
+
+    bsl::vector<int> *d_visited_p;
+
+  public:
+    explicit VisitorRecorder(bsl::vector<int> *visited)
+    : d_visited_p(visited)
+    {}
+
+    bool operator()(int key, int)
+    {
+        d_visited_p->push_back(key);
+        return true;
+    }
+};
+
 template <class VALUE>
 struct InplaceUtil {
     // The class is a wrapper to create a shared pointer in place, with and
@@ -1100,6 +1144,118 @@ extern "C" void *workFunc(void *arg)
 
 }  // close namespace cacheperf
 
+namespace zipfperf {
+
+class ZipfDistribution {
+    // This class provides a Zipf distribution of the keys '[0 .. numKeys)',
+    // the probability of key 'k' being proportional to '1 / (k + 1)^s'.
+
+    bsl::vector<double> d_cdf;  // cumulative probability of each key
+
+  public:
+    ZipfDistribution(int numKeys, double s, bslma::Allocator *allocator)
+    : d_cdf(allocator)
+    {
+        d_cdf.reserve(numKeys);
+        double sum = 0;
+        for (int i = 0; i < numKeys; ++i) {
+            sum += 1.0 / bsl::pow(static_cast<double>(i + 1), s);
+            d_cdf.push_back(sum);
+        }
+        for (int i = 0; i < numKeys; ++i) {
+            d_cdf[i] /= sum;
+        }
+    }
+
+    int operator()(bsls::Types::Uint64 *state) const
+        // Return a key drawn from this distribution, using and updating the
+        // specified random generator '*state'.
+    {
+        *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const double u = static_cast<double>(*state >> 11) /
+                                                         9007199254740992.0;
+        return static_cast<int>(bsl::lower_bound(d_cdf.begin(),
+                                                 d_cdf.end(),
+                                                 u) - d_cdf.begin());
+    }
+};
+
+typedef bdlcc::Cache<int, int> CacheType;
+
+void worker(CacheType              *cache,
+            const ZipfDistribution *distribution,
+            bslmt::Barrier         *barrier,
+            bsls::AtomicInt64      *numHits,
+            int                     numOps,
+            int                     seed)
+    // Wait on the specified 'barrier', then perform the specified 'numOps'
+    // lookups in the specified 'cache' of keys drawn from the specified
+    // 'distribution' using the specified 'seed', inserting the key on a miss.
+    // Add the number of successful lookups to the specified 'numHits'.
+{
+    bsls::Types::Uint64 state = seed;
+    bsls::Types::Int64  hits  = 0;
+
+    barrier->wait();
+
+    for (int i = 0; i < numOps; ++i) {
+        const int            key = (*distribution)(&state);
+        bsl::shared_ptr<int> value;
+        if (0 == cache->tryGetValue(&value, key)) {
+            ++hits;
+        }
+        else {
+            cache->insert(key, key);
+        }
+    }
+
+    numHits->addRelaxed(hits);
+}
+
+void run(bdlcc::CacheEvictionPolicy::Enum  evictionPolicy,
+         const char                       *policyName,
+         const ZipfDistribution&           distribution,
+         int                               capacity,
+         int                               numThreads,
+         int                               numOps)
+    // Run the specified 'numThreads' threads, each performing the specified
+    // 'numOps' lookups of keys drawn from the specified 'distribution' in a
+    // cache having the specified 'evictionPolicy' and 'capacity', and print
+    // the throughput and hit ratio, labelled with the specified 'policyName'.
+{
+    CacheType cache(evictionPolicy, capacity, capacity);
+
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threads;
+    bsls::AtomicInt64  numHits(0);
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.addThread(bdlf::BindUtil::bind(&worker,
+                                               &cache,
+                                               &distribution,
+                                               &barrier,
+                                               &numHits,
+                                               numOps,
+                                               i + 1));
+    }
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+    barrier.wait();
+    threads.joinAll();
+    timer.stop();
+
+    const double totalOps = static_cast<double>(numThreads) * numOps;
+
+    cout << policyName << ": "
+         << totalOps / timer.elapsedTime() << " ops/sec, hit ratio "
+         << static_cast<double>(numHits) / totalOps
+         << ", cpu " << timer.accumulatedUserTime() +
+                        timer.accumulatedSystemTime() << "s" << endl;
+}
+
+}  // close namespace zipfperf
+
 namespace testLock {
 
 bslma::TestAllocator talloc("tl", veryVeryVeryVerbose);
@@ -1284,8 +1440,9 @@ void testLocking()
     //:   lock and unlock a reader writer lock.
     //
     //: 3 'bdlcc::Cache_TestUtil' method of 'tryGetValue' actually read lock
-    //:   and unlock a reader writer lock if eviction policy is FIFO, and write
-    //:   lock and unlock a reader writer lock if eviction policy is LRU.
+    //:   and unlock a reader writer lock if eviction policy is FIFO or CLOCK,
+    //:   and write lock and unlock a reader writer lock if eviction policy is
+    //:   LRU.
     //
     // Plan:
     //: 1 Spawn a thread that calls 'lockRead', sleep for 0.1sec, and calls
@@ -1343,6 +1500,16 @@ void testLocking()
     //:   eviction policy, run 'tryGetValue' and measure how long it took to
     //:   complete.  It should be less than sec.
     //:
+    //:14 Spawn a thread that calls 'lockWrite', sleep for 0.1sec, and calls
+    //:   'unlock'.  On the main thread, use a 'bdlcc:Cache' object with CLOCK
+    //:   eviction policy, run 'tryGetValue' and measure how long it took to
+    //:   complete.  It should be around 0.1 sec.
+    //:
+    //:15 Spawn a thread that calls 'lockRead', sleep for 0.1sec, and calls
+    //:   'unlock'.  On the main thread, use a 'bdlcc:Cache' object with CLOCK
+    //:   eviction policy, run 'tryGetValue' and measure how long it took to
+    //:   complete.  It should be less than 0.1 sec.
+    //:
     // Testing:
     //   void insert(const KEYTYPE& key, const VALUETYPE& value);
     //   void insert(const KEYTYPE& key, const ValuePtrType& valuePtr);
@@ -1621,6 +1788,50 @@ void testLocking()
         ASSERT(duration < k_SLEEP_PERIOD / 2);
     }
 
+    CacheType          clockCache(bdlcc::CacheEvictionPolicy::e_CLOCK, 10, 20,
+                                                                      &talloc);
+    Cache_TestUtilType clockCache_TestUtil(clockCache);
+    ThreadData         tdClockWrite(&clockCache_TestUtil, k_SLEEP_PERIOD, 'W');
+    ThreadData         tdClockRead( &clockCache_TestUtil, k_SLEEP_PERIOD, 'R');
+
+    clockCache.insert(8, "Eight");
+
+    // LockWrite / tryGetValue, CLOCK
+    {
+        // Time the duration how long it took to run 'tryGetValue'
+        TimeType startTime = bsls::TimeUtil::getTimer();
+
+        bslmt::ThreadUtil::create(&handle, workThread, &tdClockWrite);
+        smp.wait();
+
+        bsl::shared_ptr<bsl::string> valuePtr;
+        int                          rc = clockCache.tryGetValue(&valuePtr, 8);
+        ASSERT(0 == rc);
+
+        TimeType endTime = bsls::TimeUtil::getTimer();
+        int      duration = static_cast<int>((endTime - startTime) / 1000);
+        bslmt::ThreadUtil::join(handle, &result);
+
+        ASSERT(duration > k_SLEEP_PERIOD / 2);
+    }
+
+    // LockRead / tryGetValue, CLOCK
+    {
+        bslmt::ThreadUtil::create(&handle, workThread, &tdClockRead);
+        smp.wait();
+        // Time the duration how long it took to run 'tryGetValue'
+        TimeType startTime = bsls::TimeUtil::getTimer();
+
+        bsl::shared_ptr<bsl::string> valuePtr;
+        int                          rc = clockCache.tryGetValue(&valuePtr, 8);
+        ASSERT(0 == rc);
+
+        TimeType endTime = bsls::TimeUtil::getTimer();
+        int      duration = static_cast<int>((endTime - startTime) / 1000);
+        bslmt::ThreadUtil::join(handle, &result);
+
+        ASSERT(duration < k_SLEEP_PERIOD / 2);
+    }
 }
 }  // close namespace testLock
 
@@ -4163,7 +4374,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4184,6 +4395,138 @@ int main(int argc, char *argv[])
         usageExample1::example1();
         usageExample2::example2();
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // CLOCK EVICTION POLICY
+        //
+        // Concerns:
+        //: 1 With the CLOCK eviction policy, an item accessed by 'tryGetValue'
+        //:   (with 'modifyEvictionQueue' set to 'true') since it was last
+        //:   examined for eviction is given a second chance, and the next
+        //:   item not accessed is evicted instead.
+        //:
+        //: 2 'tryGetValue' with 'modifyEvictionQueue' set to 'false' does not
+        //:   give an item a second chance.
+        //:
+        //: 3 If every item has been accessed, the item at the front of the
+        //:   eviction queue is evicted after all flags are cleared.
+        //:
+        //: 4 'popFront' follows the same eviction order as watermark
+        //:   enforcement, and the post-eviction callback is invoked for each
+        //:   evicted item.
+        //:
+        //: 5 Accessing an item does not change the order of the visit.
+        //
+        // Plan:
+        //: 1 Create a CLOCK cache with a fixed maximum size, fill it, access
+        //:   some items, insert new items, and verify which items have been
+        //:   evicted.  (C-1..3)
+        //:
+        //: 2 Install a callback recording evicted values and call 'popFront'
+        //:   after accessing items.  (C-4)
+        //:
+        //: 3 Visit the cache after accessing items.  (C-5)
+        //
+        // Testing:
+        //   CLOCK EVICTION POLICY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CLOCK EVICTION POLICY" << endl
+                                  << "=====================" << endl;
+
+        typedef bdlcc::Cache<int, int> IntCache;
+        typedef IntCache::ValuePtrType IntPtr;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            IntCache mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 3, 3, &ta);
+            const IntCache& X = mX;
+
+            ASSERT(bdlcc::CacheEvictionPolicy::e_CLOCK == X.evictionPolicy());
+
+            mX.insert(1, 10);
+            mX.insert(2, 20);
+            mX.insert(3, 30);
+            ASSERT(3 == X.size());
+
+            IntPtr value;
+
+            // Access 1, which then survives the eviction triggered by 4.
+
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT(10 == *value);
+
+            mX.insert(4, 40);
+            ASSERT(3 == X.size());
+            ASSERT(0 == mX.tryGetValue(&value, 1, false));
+            ASSERT(1 == mX.tryGetValue(&value, 2, false));
+            ASSERT(0 == mX.tryGetValue(&value, 3, false));
+            ASSERT(0 == mX.tryGetValue(&value, 4, false));
+
+            // The queue is now 3, 1, 4.  Accessing 3 without modifying the
+            // eviction queue does not save it.
+
+            mX.insert(5, 50);
+            ASSERT(3 == X.size());
+            ASSERT(1 == mX.tryGetValue(&value, 3, false));
+
+            // The queue is now 1, 4, 5.  Access all of them: 1 is evicted
+            // after every flag has been cleared.
+
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT(0 == mX.tryGetValue(&value, 4));
+            ASSERT(0 == mX.tryGetValue(&value, 5));
+
+            mX.insert(6, 60);
+            ASSERT(3 == X.size());
+            ASSERT(1 == mX.tryGetValue(&value, 1, false));
+            ASSERT(0 == mX.tryGetValue(&value, 4, false));
+            ASSERT(0 == mX.tryGetValue(&value, 5, false));
+            ASSERT(0 == mX.tryGetValue(&value, 6, false));
+        }
+        {
+            IntCache mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 100, 100, &ta);
+            const IntCache& X = mX;
+
+            bsl::vector<int> evicted(&ta);
+            mX.setPostEvictionCallback(EvictionRecorder(&evicted));
+
+            for (int i = 0; i < 5; ++i) {
+                mX.insert(i, i);
+            }
+
+            IntPtr value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+
+            bsl::vector<int> visited(&ta);
+            VisitorRecorder  recorder(&visited);
+            X.visit(recorder);
+            ASSERT(5 == visited.size());
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, visited[i], i == visited[i]);
+            }
+
+            ASSERT(0 == mX.popFront());
+            ASSERT(0 == mX.popFront());
+            ASSERT(0 == mX.popFront());
+            ASSERT(2 == X.size());
+
+            ASSERT(3 == evicted.size());
+            ASSERTV(evicted[0], 1 == evicted[0]);
+            ASSERTV(evicted[1], 3 == evicted[1]);
+            ASSERTV(evicted[2], 4 == evicted[2]);
+
+            ASSERT(0 == mX.tryGetValue(&value, 0, false));
+            ASSERT(0 == mX.tryGetValue(&value, 2, false));
+
+            ASSERT(0 == mX.popFront());
+            ASSERT(0 == mX.popFront());
+            ASSERT(1 == mX.popFront());
+            ASSERT(5 == evicted.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
       case 18: {
         // --------------------------------------------------------------------
@@ -4273,7 +4616,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to insert.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: if F, use FIFO for eviction policy; if C, use
+        //   CLOCK; LRU othrwise.
         //
         // Concerns:
         //: 1 Calculates wall time, user time, and system time for inserting
@@ -4295,6 +4639,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 4 && argv[4][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 4 && argv[4][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         cacheperf::CachePerformance cp("testInsert1", evictionPolicy,
@@ -4312,7 +4658,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to insert.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: if F, use FIFO for eviction policy; if C, use
+        //   CLOCK; LRU othrwise.
         //   5th parameter: number of batches to divide the number of rows
         //   into.
         //
@@ -4336,6 +4683,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 4 && argv[4][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 4 && argv[4][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         int numBatches = argc > 5 ? atoi(argv[5]) : 1;
@@ -4357,7 +4706,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to read.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: if F, use FIFO for eviction policy; if C, use
+        //   CLOCK; LRU othrwise.
         //   5th parameter: sparsity of values loaded.  Sparsity is the
         //   distance between consecutive values inserted, and represents how
         //   likely is a read to find the key given. A value of 1 means
@@ -4387,6 +4737,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 4 && argv[4][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 4 && argv[4][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         int sparsity = argc > 5 ? atoi(argv[5]) : 1;
@@ -4417,7 +4769,8 @@ int main(int argc, char *argv[])
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to read.
         //   4th parameter: number of writer threads.
-        //   5th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   5th parameter: if F, use FIFO for eviction policy; if C, use
+        //   CLOCK; LRU othrwise.
         //   6th parameter: sparsity of values loaded.  Sparsity is the
         //   distance between consecutive values inserted, and represents how
         //   likely is a read to find the key given. A value of 1 means
@@ -4450,6 +4803,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 5 && argv[5][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 5 && argv[5][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         int sparsity = argc > 6 ? atoi(argv[6]) : 1;
@@ -4471,6 +4826,64 @@ int main(int argc, char *argv[])
         times = cp.runTests(args, cacheperf::CachePerformance::testReadWrite);
         cp.printResult();
       } break;
+      case -5: {
+        // --------------------------------------------------------------------
+        // SKEWED ACCESS PERFORMANCE TEST
+        //   Compares the throughput and hit ratio of the eviction policies
+        //   under a skewed (Zipf) access pattern, where each thread looks up
+        //   keys and inserts each key not found.  To provide control over the
+        //   test, command line parameters are used.
+        //   2nd parameter: number of threads.
+        //   3rd parameter: number of lookups per thread.
+        //   4th parameter: number of distinct keys.
+        //   5th parameter: cache capacity.
+        //   6th parameter: Zipf exponent, in hundredths.
+        //
+        // Concerns:
+        //: 1 Reports lookups per second and hit ratio for LRU, CLOCK, and FIFO
+        //:   eviction policies.
+        //
+        // Plan:
+        //: 1 Run the same workload against a cache using each eviction policy
+        //:   and print the results.  (C-1)
+        //
+        // Testing:
+        //   SKEWED ACCESS PERFORMANCE
+        // --------------------------------------------------------------------
+
+        bslma::TestAllocator talloc("ptm5", false);
+
+        int    numThreads = argc > 2 ? atoi(argv[2]) : 4;
+        int    numOps     = argc > 3 ? atoi(argv[3]) : 1000000;
+        int    numKeys    = argc > 4 ? atoi(argv[4]) : 100000;
+        int    capacity   = argc > 5 ? atoi(argv[5]) : 10000;
+        double exponent   = argc > 6 ? atoi(argv[6]) / 100.0 : 0.99;
+
+        zipfperf::ZipfDistribution distribution(numKeys, exponent, &talloc);
+
+        cout << "threads: " << numThreads << ", lookups/thread: " << numOps
+             << ", keys: " << numKeys << ", capacity: " << capacity
+             << ", exponent: " << exponent << endl;
+
+        zipfperf::run(bdlcc::CacheEvictionPolicy::e_LRU,
+                      "LRU  ",
+                      distribution,
+                      capacity,
+                      numThreads,
+                      numOps);
+        zipfperf::run(bdlcc::CacheEvictionPolicy::e_CLOCK,
+                      "CLOCK",
+                      distribution,
+                      capacity,
+                      numThreads,
+                      numOps);
+        zipfperf::run(bdlcc::CacheEvictionPolicy::e_FIFO,
+                      "FIFO ",
+                      distribution,
+                      capacity,
+                      numThreads,
+                      numOps);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
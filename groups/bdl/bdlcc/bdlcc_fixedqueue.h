@@ -30,6 +30,13 @@ BSLS_IDENT("$Id: $")
 // 'tryPushBack' and 'tryPopFront' are also provided, which fail immediately
 // returning a non-zero value in case of overflow or underflow.
 //
+// Batch methods 'tryPushBackN', 'pushBackN', 'tryPopFrontN', and
+// 'popFrontUpTo' push or pop a range of elements at once: the range of cells
+// is reserved with a single update of the index shared by all pushers (or
+// poppers), and blocked threads are woken once for the whole range, which
+// amortizes the cost of synchronization for producers and consumers operating
+// at high rates.
+//
 // The queue may be placed into a "disabled" state using the 'disable' method.
 // When disabled, 'pushBack' and 'tryPushBack' fail immediately (they do not
 // block and any blocked invocations will fail immediately).  The queue may be
@@ -271,6 +278,7 @@ class FixedQueue {
     // FRIENDS
     template <class VAL> friend class FixedQueue_PushProctor;
     template <class VAL> friend class FixedQueue_PopGuard;
+    template <class VAL> friend class FixedQueue_PopRangeGuard;
 
   public:
     // TRAITS
@@ -312,6 +320,30 @@ class FixedQueue {
         // unspecified state.  Return 0 on success, and a non-zero value if the
         // queue is full or disabled.
 
+    int pushBackN(const TYPE *values, int numValues);
+        // Append, in order, the specified 'numValues' leading elements of the
+        // specified 'values' array to the back of this queue, blocking until
+        // either space is available - if necessary - or the queue is
+        // disabled.  Return 0 on success, and a nonzero value if the queue is
+        // disabled, in which case a (possibly empty) leading part of 'values'
+        // has been appended.  Note that the elements are appended in batches
+        // as space becomes available (see 'tryPushBackN'), and that elements
+        // pushed concurrently by other threads may be interleaved between
+        // batches.
+
+    int tryPushBackN(int *numPushed, const TYPE *values, int numValues);
+        // Attempt to append, in order, up to the specified 'numValues' leading
+        // elements of the specified 'values' array to the back of this queue
+        // without blocking, and load into the specified 'numPushed' the number
+        // of elements appended.  Return 0 if at least one element was
+        // appended, and a non-zero value if the queue is full or disabled (in
+        // which case 'numPushed' is not modified).  The appended elements
+        // occupy consecutive positions in this queue, are reserved with a
+        // single update of the push index shared by all pushers (in the
+        // absence of contention), and threads blocked in 'popFront' are
+        // released once for the whole batch.  The behavior is undefined unless
+        // '0 < numValues'.
+
     void popFront(TYPE* value);
         // Remove the element from the front of this queue and load that
         // element into the specified 'value'.  If the queue is empty, block
@@ -327,6 +359,27 @@ class FixedQueue {
         // removed element.  Return 0 on success, and a non-zero value if queue
         // was empty.  On failure, 'value' is not changed.
 
+    int popFrontUpTo(TYPE *values, int maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue and load them, in order, into the leading elements of the
+        // specified 'values' array.  If the queue is empty, block until it is
+        // not empty.  Return the number of elements removed (at least 1).
+        // The behavior is undefined unless '0 < maxNumValues'.  Note that this
+        // method removes the elements as 'tryPopFrontN' does.
+
+    int tryPopFrontN(TYPE *values, int maxNumValues);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, and load them, in order,
+        // into the leading elements of the specified 'values' array.  Return
+        // the number of elements removed, and 0 if the queue was empty.  The
+        // removed elements are reserved with a single update of the pop index
+        // shared by all poppers (in the absence of contention), and threads
+        // blocked in 'pushBack' are released once for the whole batch.  If
+        // an exception is thrown while loading an element into 'values', that
+        // element and the subsequent reserved elements are removed from the
+        // queue and destroyed.  The behavior is undefined unless
+        // '0 < maxNumValues'.
+
     void removeAll();
         // Remove all items from this queue.  Note that this operation is not
         // atomic; if other threads are concurrently pushing items into the
@@ -442,6 +495,10 @@ class FixedQueue_PushProctor {
                                      // index of cell being pushed when an
                                      // exception was thrown
 
+    unsigned int                  d_numReserved;
+                                     // number of cells reserved by the
+                                     // pushing thread, starting at 'd_index'
+
   private:
     // NOT IMPLEMENTED
     FixedQueue_PushProctor(const FixedQueue_PushProctor&);
@@ -452,12 +509,17 @@ class FixedQueue_PushProctor {
     // CREATORS
     FixedQueue_PushProctor(FixedQueue<VALUE> *queue,
                            unsigned int       generation,
-                           unsigned int       index);
+                           unsigned int       index,
+                           unsigned int       numReserved = 1);
         // Create a proctor that manages the specified 'queue' and, unless
         // 'release' is called, will remove and destroy all the elements from
         // 'queue' starting at the specified 'index' in the specified
-        // 'generation'.  The behavior is undefined unless 'index' and
-        // 'generation' refers to a valid element in 'queue'.
+        // 'generation'.  Optionally specify 'numReserved', the number of
+        // consecutive cells, starting at 'index', reserved for pushing by the
+        // current thread, all of which are then released; if 'numReserved' is
+        // not specified, only the cell at 'index' is released.  The behavior
+        // is undefined unless 'index' and 'generation' refers to a valid
+        // element in 'queue' and '0 < numReserved'.
 
     ~FixedQueue_PushProctor();
         // Destroy this proctor and, if 'release' was not called on this
@@ -471,6 +533,66 @@ class FixedQueue_PushProctor {
 
 };
 
+                       // ==============================
+                       // class FixedQueue_PopRangeGuard
+                       // ==============================
+
+template <class VALUE>
+class FixedQueue_PopRangeGuard {
+    // This class provides a guard over a range of consecutive cells of a
+    // 'FixedQueue' object that the current thread has reserved for popping.
+    // The cells are popped one at a time with 'popFront', and, upon the
+    // guard's destruction, the elements of the cells remaining in the range
+    // are destroyed and their cells popped, and waiting pushers are released
+    // for the whole range.  Note that this guard is used to provide exception
+    // safety when popping a range of elements from a 'FixedQueue' object.
+
+    // DATA
+    FixedQueue<VALUE> *d_parent_p;     // object from which elements are popped
+
+    unsigned int       d_generation;   // generation count of the first
+                                       // remaining cell
+
+    unsigned int       d_index;        // index of the first remaining cell
+
+    unsigned int       d_numRemaining; // number of cells not yet popped
+
+    const unsigned int d_numReserved;  // number of cells in the range
+
+  private:
+    // NOT IMPLEMENTED
+    FixedQueue_PopRangeGuard(const FixedQueue_PopRangeGuard&);
+    FixedQueue_PopRangeGuard& operator=(const FixedQueue_PopRangeGuard&);
+
+  public:
+    // CREATORS
+    FixedQueue_PopRangeGuard(FixedQueue<VALUE> *queue,
+                             unsigned int       generation,
+                             unsigned int       index,
+                             unsigned int       numReserved);
+        // Create a guard over the specified 'numReserved' consecutive cells of
+        // the specified 'queue', starting at the specified 'index' in the
+        // specified 'generation'.  The behavior is undefined unless the
+        // current thread has acquired a reservation to pop those cells (using
+        // 'FixedQueueIndexManager::reservePopIndexes').
+
+    ~FixedQueue_PopRangeGuard();
+        // Destroy the elements of the remaining cells of the range, update
+        // the state of the 'FixedQueue' object supplied at construction to
+        // remove (pop) them, and release waiting pushers.
+
+    // MANIPULATORS
+    void popFront();
+        // Destroy the element in the first remaining cell of the range and
+        // update the state of the 'FixedQueue' object supplied at construction
+        // to remove (pop) it.  The behavior is undefined unless a cell
+        // remains in the range.
+
+    // ACCESSORS
+    unsigned int index() const;
+        // Return the index of the first remaining cell of the range.
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -624,6 +746,103 @@ int FixedQueue<TYPE>::tryPopFront(TYPE *value)
     return 0;
 }
 
+template <class TYPE>
+int FixedQueue<TYPE>::tryPushBackN(int        *numPushed,
+                                   const TYPE *values,
+                                   int         numValues)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < numValues);
+
+    unsigned int generation;
+    unsigned int index;
+    unsigned int numReserved;
+
+    // SYNCHRONIZATION POINT 1
+    //
+    // As for 'tryPushBack', the following call to 'reservePushIndexes' writes
+    // 'FixedQueueIndexManaged::d_pushIndex' with full sequential consistency.
+
+    int retval = d_impl.reservePushIndexes(
+                                         &generation,
+                                         &index,
+                                         &numReserved,
+                                         static_cast<unsigned int>(numValues));
+
+    if (0 != retval) {
+        return retval;                                                // RETURN
+    }
+
+    for (unsigned int i = 0; i < numReserved; ++i) {
+        // Copy the element into the cell.  If an exception is thrown by the
+        // copy constructor, PushProctor will pop and discard items until
+        // reaching this cell, then release this cell and the subsequent cells
+        // reserved by this thread (see 'tryPushBack').
+
+        FixedQueue_PushProctor<TYPE> guard(this,
+                                           generation,
+                                           index,
+                                           numReserved - i);
+        bslalg::ScalarPrimitives::copyConstruct(&d_elements[index],
+                                                values[i],
+                                                d_allocator_p);
+        guard.release();
+        d_impl.commitPushIndex(generation, index);
+        d_impl.advanceIndex(&generation, &index);
+    }
+
+    const int numWaitingPoppers = d_numWaitingPoppers;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numWaitingPoppers)) {
+        d_popControlSema.post(bsl::min(numWaitingPoppers,
+                                       static_cast<int>(numReserved)));
+    }
+
+    *numPushed = static_cast<int>(numReserved);
+    return 0;
+}
+
+template <class TYPE>
+int FixedQueue<TYPE>::tryPopFrontN(TYPE *values, int maxNumValues)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+
+    unsigned int generation;
+    unsigned int index;
+    unsigned int numReserved;
+
+    // SYNCHRONIZATION POINT 2
+    //
+    // As for 'tryPopFront', the following call to 'reservePopIndexes' writes
+    // 'FixedQueueIndexManaged::d_popIndex' with full sequential consistency.
+
+    if (0 != d_impl.reservePopIndexes(
+                                  &generation,
+                                  &index,
+                                  &numReserved,
+                                  static_cast<unsigned int>(maxNumValues))) {
+        return 0;                                                     // RETURN
+    }
+
+    // 'FixedQueue_PopRangeGuard' will destroy the original objects, update the
+    // queue, and release waiting pushers, even if an assignment operator
+    // throws.
+
+    FixedQueue_PopRangeGuard<TYPE> guard(this, generation, index, numReserved);
+
+    for (unsigned int i = 0; i < numReserved; ++i) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[i] = bslmf::MovableRefUtil::move(d_elements[guard.index()]);
+#else
+        values[i] = d_elements[guard.index()];
+#endif
+        guard.popFront();
+    }
+
+    return static_cast<int>(numReserved);
+}
+
 // MANIPULATORS
 template <class TYPE>
 int FixedQueue<TYPE>::pushBack(const TYPE& value)
@@ -741,6 +960,61 @@ TYPE FixedQueue<TYPE>::popFront()
 #endif
 }
 
+template <class TYPE>
+int FixedQueue<TYPE>::pushBackN(const TYPE *values, int numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    while (0 < numValues) {
+        int numPushed;
+        int retval = tryPushBackN(&numPushed, values, numValues);
+
+        if (0 == retval) {
+            values    += numPushed;
+            numValues -= numPushed;
+            continue;
+        }
+
+        if (retval < 0) {
+            // The queue is disabled.
+
+            return retval;                                            // RETURN
+        }
+
+        d_numWaitingPushers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime (see 'pushBack')
+
+        if (isFull() && isEnabled()) {
+            d_pushControlSema.wait();
+        }
+
+        d_numWaitingPushers.addRelaxed(-1);
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+int FixedQueue<TYPE>::popFrontUpTo(TYPE *values, int maxNumValues)
+{
+    int numPopped;
+    while (0 == (numPopped = tryPopFrontN(values, maxNumValues))) {
+        d_numWaitingPoppers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 2-Prime (see 'popFront')
+
+        if (isEmpty()) {
+            d_popControlSema.wait();
+        }
+
+        d_numWaitingPoppers.addRelaxed(-1);
+    }
+
+    return numPopped;
+}
+
 template <class TYPE>
 void FixedQueue<TYPE>::removeAll()
 {
@@ -880,13 +1154,16 @@ FixedQueue_PopGuard<VALUE>::~FixedQueue_PopGuard()
 template <class VALUE>
 inline
 FixedQueue_PushProctor<VALUE>::FixedQueue_PushProctor(
-                                                 FixedQueue<VALUE> *queue,
-                                                 unsigned int       generation,
-                                                 unsigned int       index)
+                                                FixedQueue<VALUE> *queue,
+                                                unsigned int       generation,
+                                                unsigned int       index,
+                                                unsigned int       numReserved)
 : d_parent_p(queue)
 , d_generation(generation)
 , d_index(index)
+, d_numReserved(numReserved)
 {
+    BSLS_ASSERT(0 < numReserved);
 }
 
 template <class VALUE>
@@ -916,6 +1193,17 @@ FixedQueue_PushProctor<VALUE>::~FixedQueue_PushProctor()
 
         d_parent_p->d_impl.abortPushIndexReservation(d_generation, d_index);
 
+        // Release the subsequent cells reserved by the current thread, if
+        // any.  Each is now at the front of the queue in turn.
+
+        generation = d_generation;
+        index      = d_index;
+        for (unsigned int i = 1; i < d_numReserved; ++i) {
+            d_parent_p->d_impl.advanceIndex(&generation, &index);
+            d_parent_p->d_impl.abortPushIndexReservation(generation, index);
+            ++poppedItems;
+        }
+
         while (poppedItems--) {
             // Wake up waiting pushers.
 
@@ -931,6 +1219,68 @@ void FixedQueue_PushProctor<VALUE>::release()
 {
     d_parent_p = 0;
 }
+
+                       // ------------------------------
+                       // class FixedQueue_PopRangeGuard
+                       // ------------------------------
+
+// CREATORS
+template <class VALUE>
+inline
+FixedQueue_PopRangeGuard<VALUE>::FixedQueue_PopRangeGuard(
+                                                FixedQueue<VALUE> *queue,
+                                                unsigned int       generation,
+                                                unsigned int       index,
+                                                unsigned int       numReserved)
+: d_parent_p(queue)
+, d_generation(generation)
+, d_index(index)
+, d_numRemaining(numReserved)
+, d_numReserved(numReserved)
+{
+}
+
+template <class VALUE>
+FixedQueue_PopRangeGuard<VALUE>::~FixedQueue_PopRangeGuard()
+{
+    // Pop the cells remaining if an exception was thrown.
+
+    while (d_numRemaining) {
+        popFront();
+    }
+
+    // Notify pushers of available cells.
+
+    const int numWaitingPushers = d_parent_p->d_numWaitingPushers;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numWaitingPushers)) {
+        d_parent_p->d_pushControlSema.post(
+                                bsl::min(numWaitingPushers,
+                                         static_cast<int>(d_numReserved)));
+    }
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline
+void FixedQueue_PopRangeGuard<VALUE>::popFront()
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    bslma::DestructionUtil::destroy(d_parent_p->d_elements + d_index);
+
+    d_parent_p->d_impl.commitPopIndex(d_generation, d_index);
+    d_parent_p->d_impl.advanceIndex(&d_generation, &d_index);
+
+    --d_numRemaining;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+unsigned int FixedQueue_PopRangeGuard<VALUE>::index() const
+{
+    return d_index;
+}
 }  // close package namespace
 
 }  // close enterprise namespace
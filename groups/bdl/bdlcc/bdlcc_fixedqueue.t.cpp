@@ -50,6 +50,7 @@
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>            // 'atoi'
 
@@ -316,6 +317,68 @@ void exceptionProducer(bdlcc::FixedQueue<ExceptionTester> *tester,
 
 #endif
 
+enum {
+    k_BATCH_SEQUENCE_BITS = 20,
+    k_BATCH_SEQUENCE_MASK = (1 << k_BATCH_SEQUENCE_BITS) - 1
+};
+
+void batchProducer(bdlcc::FixedQueue<int> *queue,
+                   int                     producerId,
+                   int                     numItems,
+                   int                     batchSize)
+    // Push, in batches of the specified 'batchSize', the specified 'numItems'
+    // values encoding the specified 'producerId' and an increasing sequence
+    // number onto the specified 'queue'.
+{
+    bsl::vector<int> values(batchSize);
+
+    for (int i = 0; i < numItems; i += batchSize) {
+        const int n = bsl::min(batchSize, numItems - i);
+        for (int j = 0; j < n; ++j) {
+            values[j] = (producerId << k_BATCH_SEQUENCE_BITS) | (i + j);
+        }
+        ASSERTT(0 == queue->pushBackN(values.data(), n));
+    }
+}
+
+void batchConsumer(bdlcc::FixedQueue<int> *queue,
+                   bsls::AtomicInt        *numConsumed,
+                   int                     numProducers,
+                   int                     batchSize)
+    // Pop values, in batches of up to the specified 'batchSize', from the
+    // specified 'queue' until a negative value is popped, verify that the
+    // values pushed by each of the specified 'numProducers' producers are
+    // observed in order, and add the number of values popped (other than
+    // negative values) to the specified 'numConsumed'.  Negative values popped
+    // in excess of one are pushed back for the other consumers.
+{
+    bsl::vector<int> values(batchSize);
+    bsl::vector<int> lastSequence(numProducers, -1);
+
+    int numStops = 0;
+    while (0 == numStops) {
+        const int n = queue->popFrontUpTo(values.data(), batchSize);
+        ASSERTT(0 < n && n <= batchSize);
+
+        for (int j = 0; j < n; ++j) {
+            if (values[j] < 0) {
+                ++numStops;
+                continue;
+            }
+            const int producerId = values[j] >> k_BATCH_SEQUENCE_BITS;
+            const int sequence   = values[j] & k_BATCH_SEQUENCE_MASK;
+
+            ASSERTT(lastSequence[producerId] < sequence);
+            lastSequence[producerId] = sequence;
+            ++(*numConsumed);
+        }
+    }
+
+    while (1 < numStops--) {
+        queue->pushBack(-1);
+    }
+}
+
 class TestType
 {
     int *d_arg_p;
@@ -1305,7 +1368,7 @@ int main(int argc, char *argv[])
                     bslmt::Configuration::recommendedDefaultThreadStackSize());
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // ---------------------------------------------------------
         // Usage example test
         //
@@ -1321,6 +1384,175 @@ int main(int argc, char *argv[])
         break;
       }
 
+      case 19: {
+        // ---------------------------------------------------------
+        // Batch push and pop test
+        //
+        // Test that 'tryPushBackN' and 'tryPopFrontN' push and pop the
+        // available range of elements in order, wrapping around the end of
+        // the buffer, that they fail when the queue is full, disabled, or
+        // empty, that an exception thrown while copying an element of a
+        // batch leaves the queue usable, and that 'pushBackN' and
+        // 'popFrontUpTo' deliver every element, in order per producer, under
+        // contention.
+        // ---------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Batch push and pop test" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tSingle-threaded batches." << endl;
+        {
+            bdlcc::FixedQueue<int> queue(5, &ta);
+
+            const int VALUES[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+            int       values[10];
+            int       numPushed = -1;
+
+            ASSERT(0 == queue.tryPopFrontN(values, 10));
+
+            ASSERT(0 == queue.tryPushBackN(&numPushed, VALUES, 3));
+            ASSERT(3 == numPushed);
+            ASSERT(3 == queue.length());
+
+            ASSERT(0 == queue.tryPushBackN(&numPushed, VALUES + 3, 7));
+            ASSERT(2 == numPushed);
+            ASSERT(5 == queue.length());
+            ASSERT(queue.isFull());
+
+            numPushed = -1;
+            ASSERT(0 <  queue.tryPushBackN(&numPushed, VALUES, 1));
+            ASSERT(-1 == numPushed);
+
+            ASSERT(4 == queue.tryPopFrontN(values, 4));
+            for (int i = 0; i < 4; ++i) {
+                LOOP2_ASSERT(i, values[i], i == values[i]);
+            }
+            ASSERT(1 == queue.length());
+
+            // The batch wraps around the end of the buffer.
+
+            ASSERT(0 == queue.tryPushBackN(&numPushed, VALUES + 5, 5));
+            ASSERT(4 == numPushed);
+
+            ASSERT(5 == queue.popFrontUpTo(values, 10));
+            for (int i = 0; i < 5; ++i) {
+                LOOP2_ASSERT(i, values[i], i + 4 == values[i]);
+            }
+            ASSERT(queue.isEmpty());
+
+            queue.disable();
+            ASSERT(0 >  queue.tryPushBackN(&numPushed, VALUES, 1));
+            ASSERT(0 >  queue.pushBackN(VALUES, 1));
+            queue.enable();
+
+            ASSERT(0 == queue.pushBackN(VALUES, 5));
+            ASSERT(5 == queue.length());
+            ASSERT(5 == queue.tryPopFrontN(values, 10));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\tExceptions in batches." << endl;
+        {
+            bdlcc::FixedQueue<ExceptionTester> queue(6, &ta);
+
+            ExceptionTester values[4];
+
+            ASSERT(0 == queue.pushBack(ExceptionTester()));
+
+            ExceptionTester::s_throwFrom = static_cast<bsls::Types::Int64>(
+                                          bslmt::ThreadUtil::selfIdAsUint64());
+
+            bool caught = false;
+            try {
+                int numPushed;
+                queue.tryPushBackN(&numPushed, values, 4);
+            }
+            catch (...) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            ExceptionTester::s_throwFrom = static_cast<bsls::Types::Int64>(0);
+
+            // As for 'pushBack', an exception while pushing empties the queue.
+
+            ASSERT(0 == queue.length());
+
+            int numPushed = 0;
+            ASSERT(0 == queue.tryPushBackN(&numPushed, values, 4));
+            ASSERT(4 == numPushed);
+            ASSERT(4 == queue.length());
+
+            ExceptionTester::s_throwFrom = static_cast<bsls::Types::Int64>(
+                                          bslmt::ThreadUtil::selfIdAsUint64());
+
+            caught = false;
+            try {
+                queue.tryPopFrontN(values, 3);
+            }
+            catch (...) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            ExceptionTester::s_throwFrom = static_cast<bsls::Types::Int64>(0);
+
+            // The reserved elements are removed; the others remain.
+
+            ASSERT(1 == queue.length());
+
+            ASSERT(0 == queue.tryPushBackN(&numPushed, values, 4));
+            ASSERT(4 == numPushed);
+            ASSERT(4 == queue.tryPopFrontN(values, 4));
+            ASSERT(1 == queue.tryPopFrontN(values, 4));
+            ASSERT(queue.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+#endif
+
+        if (verbose) cout << "\tConcurrent batches." << endl;
+        {
+            const int k_NUM_PRODUCERS = 4;
+            const int k_NUM_CONSUMERS = 4;
+            const int k_NUM_ITEMS     = 20000;
+            const int k_BATCH_SIZE    = 7;
+
+            bdlcc::FixedQueue<int> queue(32, &ta);
+            bsls::AtomicInt        numConsumed(0);
+
+            bslmt::ThreadGroup consumers;
+            consumers.addThreads(bdlf::BindUtil::bind(&batchConsumer,
+                                                      &queue,
+                                                      &numConsumed,
+                                                      k_NUM_PRODUCERS,
+                                                      k_BATCH_SIZE),
+                                 k_NUM_CONSUMERS);
+
+            bslmt::ThreadGroup producers;
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                producers.addThread(bdlf::BindUtil::bind(&batchProducer,
+                                                         &queue,
+                                                         i,
+                                                         k_NUM_ITEMS,
+                                                         k_BATCH_SIZE));
+            }
+            producers.joinAll();
+
+            for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+                queue.pushBack(-1);
+            }
+            consumers.joinAll();
+
+            ASSERTV(numConsumed,
+                    k_NUM_PRODUCERS * k_NUM_ITEMS == numConsumed);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+
       case 18: {
           // ---------------------------------------------------------
           // Moving tests
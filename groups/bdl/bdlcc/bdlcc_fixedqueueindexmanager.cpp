@@ -356,13 +356,9 @@ FixedQueueIndexManager::~FixedQueueIndexManager()
     d_allocator_p->deallocate(d_states);
 }
 
-// MANIPULATORS
-int FixedQueueIndexManager::reservePushIndex(unsigned int *generation,
-                                             unsigned int *index)
+// PRIVATE MANIPULATORS
+int FixedQueueIndexManager::acquirePushIndex(unsigned int *result)
 {
-    BSLS_ASSERT(0 != generation);
-    BSLS_ASSERT(0 != index);
-
     enum Status { e_SUCCESS = 0, e_QUEUE_FULL = 1, e_DISABLED_QUEUE = -1 };
 
     unsigned int loadedPushIndex = d_pushIndex.loadRelaxed();
@@ -393,11 +389,10 @@ int FixedQueueIndexManager::reservePushIndex(unsigned int *generation,
 
         if (compare == was) {
             // We've successfully changed the state and thus acquired the
-            // index.  Exit the loop.
+            // index.
 
-            *generation = currGeneration;
-            *index      = currIndex;
-            break;
+            *result = combinedIndex;
+            return e_SUCCESS;                                         // RETURN
         }
 
         // We've failed to reserve the index.  We can use the result of the
@@ -467,38 +462,10 @@ int FixedQueueIndexManager::reservePushIndex(unsigned int *generation,
         unsigned int next = nextCombinedIndex(combinedIndex);
         loadedPushIndex   = d_pushIndex.testAndSwap(combinedIndex, next);
     }
-
-    // We've acquired the cell; attempt to increment the push index.
-
-    unsigned int next = nextCombinedIndex(combinedIndex);
-    d_pushIndex.testAndSwap(combinedIndex, next);
-
-    return e_SUCCESS;
-}
-
-void FixedQueueIndexManager::commitPushIndex(unsigned int generation,
-                                             unsigned int index)
-{
-    BSLS_ASSERT(generation <= d_maxGeneration);
-    BSLS_ASSERT(index      <  d_capacity);
-    BSLS_ASSERT(e_WRITING  == decodeStateFromElementState(d_states[index]));
-    BSLS_ASSERT(generation ==
-                decodeGenerationFromElementState(d_states[index]));
-
-    // We cannot guarantee the full pre-conditions of this function.  The
-    // preceding assertions are as close as we can get.
-
-    // Mark the pushed cell with the 'FULL' state.
-
-    d_states[index] = encodeElementState(generation, e_FULL);
 }
 
-int FixedQueueIndexManager::reservePopIndex(unsigned int *generation,
-                                            unsigned int *index)
+int FixedQueueIndexManager::acquirePopIndex(unsigned int *result)
 {
-    BSLS_ASSERT(0 != generation);
-    BSLS_ASSERT(0 != index);
-
     enum Status { e_SUCCESS = 0, e_QUEUE_EMPTY = 1 };
 
     unsigned int loadedPopIndex = d_popIndex.load();
@@ -524,12 +491,10 @@ int FixedQueueIndexManager::reservePopIndex(unsigned int *generation,
 
         if (compare == was) {
             // We've successfully changed the state and thus acquired the
-            // index.  Exit the loop.
-
-            *generation = currGeneration;
-            *index      = currIndex;
+            // index.
 
-            break;
+            *result = loadedPopIndex;
+            return e_SUCCESS;                                         // RETURN
         }
 
         // We've failed to reserve the index.  We can use the result of the
@@ -597,11 +562,184 @@ int FixedQueueIndexManager::reservePopIndex(unsigned int *generation,
         unsigned int next = nextCombinedIndex(loadedPopIndex);
         loadedPopIndex   = d_popIndex.testAndSwap(loadedPopIndex, next);
     }
+}
+
+unsigned int FixedQueueIndexManager::acquireFollowingIndexes(
+                                            unsigned int combinedIndex,
+                                            unsigned int maxNumIndexes,
+                                            int          fromState,
+                                            int          toState)
+{
+    unsigned int numAcquired = 1;
+
+    while (numAcquired < maxNumIndexes) {
+        const unsigned int next = nextCombinedIndex(combinedIndex);
+
+        const unsigned int generation =
+                                  static_cast<unsigned int>(next / d_capacity);
+        const unsigned int index =
+                                  static_cast<unsigned int>(next % d_capacity);
+
+        const int compare = encodeElementState(generation,
+                                               ElementState(fromState));
+        const int swap    = encodeElementState(generation,
+                                               ElementState(toState));
+
+        if (compare != d_states[index].testAndSwap(compare, swap)) {
+            // The cell is not available (or has been acquired by another
+            // thread): the range ends here.
+
+            break;
+        }
+
+        combinedIndex = next;
+        ++numAcquired;
+    }
+
+    return numAcquired;
+}
+
+// MANIPULATORS
+int FixedQueueIndexManager::reservePushIndex(unsigned int *generation,
+                                             unsigned int *index)
+{
+    BSLS_ASSERT(0 != generation);
+    BSLS_ASSERT(0 != index);
+
+    unsigned int combinedIndex;
+
+    const int rc = acquirePushIndex(&combinedIndex);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // We've acquired the cell; attempt to increment the push index.
+
+    unsigned int next = nextCombinedIndex(combinedIndex);
+    d_pushIndex.testAndSwap(combinedIndex, next);
+
+    *generation = static_cast<unsigned int>(combinedIndex / d_capacity);
+    *index      = static_cast<unsigned int>(combinedIndex % d_capacity);
+
+    return 0;
+}
+
+int FixedQueueIndexManager::reservePushIndexes(unsigned int *generation,
+                                               unsigned int *index,
+                                               unsigned int *numReserved,
+                                               unsigned int  maxNumReserved)
+{
+    BSLS_ASSERT(0 != generation);
+    BSLS_ASSERT(0 != index);
+    BSLS_ASSERT(0 != numReserved);
+    BSLS_ASSERT(0 <  maxNumReserved);
+
+    unsigned int combinedIndex;
+
+    const int rc = acquirePushIndex(&combinedIndex);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // Extend the reservation to the subsequent empty cells, then attempt, with
+    // a single 'testAndSwap', to move the push index past all of them.  If
+    // that fails, other pushers will advance the push index past the reserved
+    // cells (which they find in the 'e_WRITING' state) as they would past a
+    // cell reserved by 'reservePushIndex'.
+
+    const unsigned int count = acquireFollowingIndexes(combinedIndex,
+                                                       maxNumReserved,
+                                                       e_EMPTY,
+                                                       e_WRITING);
+
+    unsigned int next = combinedIndex;
+    for (unsigned int i = 0; i < count; ++i) {
+        next = nextCombinedIndex(next);
+    }
+    d_pushIndex.testAndSwap(combinedIndex, next);
+
+    *generation  = static_cast<unsigned int>(combinedIndex / d_capacity);
+    *index       = static_cast<unsigned int>(combinedIndex % d_capacity);
+    *numReserved = count;
+
+    return 0;
+}
+
+void FixedQueueIndexManager::commitPushIndex(unsigned int generation,
+                                             unsigned int index)
+{
+    BSLS_ASSERT(generation <= d_maxGeneration);
+    BSLS_ASSERT(index      <  d_capacity);
+    BSLS_ASSERT(e_WRITING  == decodeStateFromElementState(d_states[index]));
+    BSLS_ASSERT(generation ==
+                decodeGenerationFromElementState(d_states[index]));
+
+    // We cannot guarantee the full pre-conditions of this function.  The
+    // preceding assertions are as close as we can get.
+
+    // Mark the pushed cell with the 'FULL' state.
+
+    d_states[index] = encodeElementState(generation, e_FULL);
+}
+
+int FixedQueueIndexManager::reservePopIndex(unsigned int *generation,
+                                            unsigned int *index)
+{
+    BSLS_ASSERT(0 != generation);
+    BSLS_ASSERT(0 != index);
+
+    unsigned int combinedIndex;
+
+    const int rc = acquirePopIndex(&combinedIndex);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
 
     // Attempt to increment the pop index.
 
-    d_popIndex.testAndSwap(loadedPopIndex,
-                           nextCombinedIndex(loadedPopIndex));
+    d_popIndex.testAndSwap(combinedIndex, nextCombinedIndex(combinedIndex));
+
+    *generation = static_cast<unsigned int>(combinedIndex / d_capacity);
+    *index      = static_cast<unsigned int>(combinedIndex % d_capacity);
+
+    return 0;
+}
+
+int FixedQueueIndexManager::reservePopIndexes(unsigned int *generation,
+                                              unsigned int *index,
+                                              unsigned int *numReserved,
+                                              unsigned int  maxNumReserved)
+{
+    BSLS_ASSERT(0 != generation);
+    BSLS_ASSERT(0 != index);
+    BSLS_ASSERT(0 != numReserved);
+    BSLS_ASSERT(0 <  maxNumReserved);
+
+    unsigned int combinedIndex;
+
+    const int rc = acquirePopIndex(&combinedIndex);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // Extend the reservation to the subsequent full cells, then attempt, with
+    // a single 'testAndSwap', to move the pop index past all of them (see
+    // 'reservePushIndexes').
+
+    const unsigned int count = acquireFollowingIndexes(combinedIndex,
+                                                       maxNumReserved,
+                                                       e_FULL,
+                                                       e_READING);
+
+    unsigned int next = combinedIndex;
+    for (unsigned int i = 0; i < count; ++i) {
+        next = nextCombinedIndex(next);
+    }
+    d_popIndex.testAndSwap(combinedIndex, next);
+
+    *generation  = static_cast<unsigned int>(combinedIndex / d_capacity);
+    *index       = static_cast<unsigned int>(combinedIndex % d_capacity);
+    *numReserved = count;
 
     return 0;
 }
@@ -789,6 +927,23 @@ void FixedQueueIndexManager::abortPushIndexReservation(unsigned int generation,
 }
 
 // ACCESSORS
+void FixedQueueIndexManager::advanceIndex(unsigned int *generation,
+                                          unsigned int *index) const
+{
+    BSLS_ASSERT(0 != generation);
+    BSLS_ASSERT(0 != index);
+    BSLS_ASSERT(*generation <= d_maxGeneration);
+    BSLS_ASSERT(*index      <  d_capacity);
+
+    const unsigned int combinedIndex =
+                      *generation * static_cast<unsigned int>(d_capacity)
+                    + *index;
+    const unsigned int next          = nextCombinedIndex(combinedIndex);
+
+    *generation = static_cast<unsigned int>(next / d_capacity);
+    *index      = static_cast<unsigned int>(next % d_capacity);
+}
+
 bsl::size_t FixedQueueIndexManager::length() const
 {
     // Note that 'FixedQueue::pushBack' and 'FixedQueue::popFront' rely on the
@@ -281,6 +281,31 @@ class FixedQueueIndexManager {
     unsigned int nextGeneration(unsigned int generation) const;
         // Return the generation subsequent to the specified 'generation'.
 
+    // PRIVATE MANIPULATORS
+    int acquirePushIndex(unsigned int *result);
+        // Mark the next available cell for pushing as 'e_WRITING' and load
+        // its combined index into the specified 'result', without advancing
+        // 'd_pushIndex' past it.  Return 0 on success, a negative value if the
+        // queue is disabled, and a positive value if the queue is full.
+
+    int acquirePopIndex(unsigned int *result);
+        // Mark the next available cell for popping as 'e_READING' and load its
+        // combined index into the specified 'result', without advancing
+        // 'd_popIndex' past it.  Return 0 on success, and a non-zero value if
+        // the queue is empty.
+
+    unsigned int acquireFollowingIndexes(unsigned int combinedIndex,
+                                         unsigned int maxNumIndexes,
+                                         int          fromState,
+                                         int          toState);
+        // Starting after the cell having the specified 'combinedIndex', which
+        // the calling thread has acquired, change the state of each
+        // consecutive cell from the specified 'fromState' to the specified
+        // 'toState' (in the generation of that cell), stopping at the first
+        // cell not in 'fromState' or once the range of acquired cells
+        // (including the one at 'combinedIndex') has the specified
+        // 'maxNumIndexes' cells.  Return the number of cells in the range.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FixedQueueIndexManager,
@@ -371,11 +396,34 @@ class FixedQueueIndexManager {
         // should not otherwise be used by the caller; the value reflects the
         // number of times the 'index' in the circular buffer has been used.
 
+    int reservePushIndexes(unsigned int *generation,
+                           unsigned int *index,
+                           unsigned int *numReserved,
+                           unsigned int  maxNumReserved);
+        // Reserve a range of up to the specified 'maxNumReserved' consecutive
+        // indices at which to enqueue elements in an (externally managed)
+        // circular buffer; load the specified 'index' and 'generation' with
+        // the index and generation of the first reserved cell, and the
+        // specified 'numReserved' with the number of reserved cells.  Return
+        // 0 on success, a negative value if the queue is disabled, and a
+        // positive value if the queue is full.  On success, at least one cell
+        // is reserved, the subsequent cells (if any) are obtained by
+        // repeatedly invoking 'advanceIndex', and *each* reserved cell must
+        // be committed with 'commitPushIndex' (in order).  The push index
+        // shared by all pushers is advanced past the whole range with a
+        // single atomic operation (in the absence of contention).  If this
+        // method fails 'generation', 'index', and 'numReserved' are
+        // unmodified.  The behavior is undefined unless '0 < maxNumReserved'
+        // and the current thread is not already holding a reservation on
+        // either a push or pop index.
+
     void commitPushIndex(unsigned int generation, unsigned int index);
         // Mark the specified 'index' as occupied (full) in the specified
         // 'generation'.  The behavior is undefined unless 'generation' and
         // 'index' match those returned by a previous successful call to
-        // 'reservePushIndex' (that has not previously been committed).
+        // 'reservePushIndex' (that has not previously been committed), or
+        // refer to a cell reserved by 'reservePushIndexes' (that has not
+        // previously been committed).
 
                          // Popping Elements
 
@@ -397,12 +445,33 @@ class FixedQueueIndexManager {
         // caller; the value reflects the of times the 'index' in the circular
         // buffer has been used.
 
+    int reservePopIndexes(unsigned int *generation,
+                          unsigned int *index,
+                          unsigned int *numReserved,
+                          unsigned int  maxNumReserved);
+        // Reserve a range of up to the specified 'maxNumReserved' consecutive
+        // indices from which to dequeue elements from an (externally managed)
+        // circular buffer; load the specified 'index' and 'generation' with
+        // the index and generation of the first reserved cell, and the
+        // specified 'numReserved' with the number of reserved cells.  Return
+        // 0 on success, and a non-zero value if the queue is empty.  On
+        // success, at least one cell is reserved, the subsequent cells (if
+        // any) are obtained by repeatedly invoking 'advanceIndex', and *each*
+        // reserved cell must be committed with 'commitPopIndex' (in order).
+        // The pop index shared by all poppers is advanced past the whole
+        // range with a single atomic operation (in the absence of
+        // contention).  If this method fails 'generation', 'index', and
+        // 'numReserved' are unmodified.  The behavior is undefined unless
+        // '0 < maxNumReserved' and the current thread is not already holding
+        // a reservation on either a push or pop index.
+
     void commitPopIndex(unsigned int generation, unsigned int index);
         // Mark the specified 'index' as available (empty) in the generation
         // following the specified 'generation'.  The behavior is undefined
         // unless 'generation' and index' match those returned by a previous
         // successful call to 'reservePopIndex' (that has not previously been
-        // committed).
+        // committed), or refer to a cell reserved by 'reservePopIndexes' (that
+        // has not previously been committed).
 
                                 // Disabled State
 
@@ -448,6 +517,14 @@ class FixedQueueIndexManager {
         // for pushing, and committing that index.
 
     // ACCESSORS
+    void advanceIndex(unsigned int *generation, unsigned int *index) const;
+        // Load into the specified 'generation' and 'index' the generation and
+        // index of the cell following, in the circular buffer, the cell they
+        // refer to on entry.  The behavior is undefined unless 'generation'
+        // and 'index' refer to a valid cell.  Note that this method is used to
+        // iterate over the cells reserved by 'reservePushIndexes' or
+        // 'reservePopIndexes'.
+
     bool isEnabled() const;
         // Return 'true' if the queue is enabled, and 'false' if it is
         // disabled.
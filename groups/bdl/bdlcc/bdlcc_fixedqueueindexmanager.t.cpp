@@ -90,6 +90,8 @@ using namespace bsl;
 // [ 3] void commitPushIndex(unsigned int , unsigned int );
 // [ 3] int reservePopIndex(unsigned int *, unsigned int *);
 // [ 3] void commitPopIndex(unsigned int , unsigned int );
+// [13] int reservePushIndexes(unsigned *,unsigned *,unsigned *,unsigned);
+// [13] int reservePopIndexes(unsigned *,unsigned *,unsigned *,unsigned);
 // [ 6] int reservePopIndexForClear(unsigned *,unsigned *,unsigned,unsigned);
 // [ 7] void abortPushIndexReservation(unsigned int, unsigned int);
 // [ 5] void disable();
@@ -100,9 +102,10 @@ using namespace bsl;
 // [ 3] unsigned int length() const;
 // [ 2] unsigned int capacity() const;
 // [10] bsl::ostream& print(bsl::ostream& ) const;
+// [13] void advanceIndex(unsigned int *, unsigned int *) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 4] CONCERN: 'gg' generator and 'dirtyGG' generator
 // [11] CONCERN: Thread-Safety (concurrent access does not corrupt state)
 // [12] CONCERN: maxCombinedIndex
@@ -982,7 +985,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -1021,6 +1024,198 @@ int main(int argc, char *argv[])
     ASSERT(1 == result);
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING: reservePushIndexes, reservePopIndexes, advanceIndex
+        //
+        // Concerns:
+        //: 1 'advanceIndex' loads the following cell, moving to the next
+        //:   generation after the last index of the buffer.
+        //:
+        //: 2 'reservePushIndexes' reserves the requested number of cells if
+        //:   they are available, and otherwise the available cells (at least
+        //:   one), starting at the current push index.
+        //:
+        //: 3 'reservePopIndexes' reserves the requested number of cells if
+        //:   they are full, and otherwise the leading full cells (at least
+        //:   one), starting at the current pop index.
+        //:
+        //: 4 Ranges wrap around the end of the buffer into the next
+        //:   generation.
+        //:
+        //: 5 The methods fail, without modifying their arguments, if the
+        //:   queue is full (push) or empty (pop); 'reservePushIndexes' fails
+        //:   if the queue is disabled.
+        //
+        // Plan:
+        //: 1 Invoke 'advanceIndex' on every index of a buffer.  (C-1)
+        //:
+        //: 2 Reserve ranges of cells for pushing and popping, commit them,
+        //:   and verify the reserved ranges and the resulting 'length'.
+        //:   (C-2..5)
+        //
+        // Testing:
+        //   int reservePushIndexes(unsigned *,unsigned *,unsigned *,unsigned);
+        //   int reservePopIndexes(unsigned *,unsigned *,unsigned *,unsigned);
+        //   void advanceIndex(unsigned int *, unsigned int *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: reservePushIndexes, reservePopIndexes"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tTesting 'advanceIndex'." << endl;
+        {
+            const unsigned int k_CAPACITY = 5;
+
+            Obj mX(k_CAPACITY, &ta);  const Obj& X = mX;
+
+            for (unsigned int i = 0; i < k_CAPACITY; ++i) {
+                unsigned int generation = 3;
+                unsigned int index      = i;
+
+                X.advanceIndex(&generation, &index);
+
+                const unsigned int EXP_GEN = i + 1 < k_CAPACITY ? 3 : 4;
+                const unsigned int EXP_IDX = (i + 1) % k_CAPACITY;
+
+                ASSERTV(i, generation, EXP_GEN == generation);
+                ASSERTV(i, index,      EXP_IDX == index);
+            }
+        }
+
+        if (verbose) cout << "\tTesting reserving ranges." << endl;
+        {
+            Obj mX(5, &ta);  const Obj& X = mX;
+
+            unsigned int generation  = 9;
+            unsigned int index       = 9;
+            unsigned int numReserved = 9;
+
+            ASSERT(0 != mX.reservePopIndexes(&generation,
+                                             &index,
+                                             &numReserved,
+                                             3));
+            ASSERT(9 == generation);
+            ASSERT(9 == index);
+            ASSERT(9 == numReserved);
+
+            ASSERT(0 == mX.reservePushIndexes(&generation,
+                                              &index,
+                                              &numReserved,
+                                              3));
+            ASSERT(0 == generation);
+            ASSERT(0 == index);
+            ASSERT(3 == numReserved);
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                mX.commitPushIndex(generation, index);
+                X.advanceIndex(&generation, &index);
+            }
+            ASSERT(3 == X.length());
+
+            ASSERT(0 == mX.reservePushIndexes(&generation,
+                                              &index,
+                                              &numReserved,
+                                              10));
+            ASSERT(0 == generation);
+            ASSERT(3 == index);
+            ASSERT(2 == numReserved);
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                mX.commitPushIndex(generation, index);
+                X.advanceIndex(&generation, &index);
+            }
+            ASSERT(5 == X.length());
+
+            ASSERT(0 <  mX.reservePushIndexes(&generation,
+                                              &index,
+                                              &numReserved,
+                                              1));
+            ASSERT(5 == X.length());
+
+            ASSERT(0 == mX.reservePopIndexes(&generation,
+                                             &index,
+                                             &numReserved,
+                                             4));
+            ASSERT(0 == generation);
+            ASSERT(0 == index);
+            ASSERT(4 == numReserved);
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                mX.commitPopIndex(generation, index);
+                X.advanceIndex(&generation, &index);
+            }
+            ASSERT(1 == X.length());
+
+            // The push range wraps around into the next generation.
+
+            ASSERT(0 == mX.reservePushIndexes(&generation,
+                                              &index,
+                                              &numReserved,
+                                              10));
+            ASSERT(1 == generation);
+            ASSERT(0 == index);
+            ASSERT(4 == numReserved);
+
+            // Commit only the first two cells of the range.
+
+            unsigned int pushGeneration = generation;
+            unsigned int pushIndex      = index;
+
+            for (unsigned int i = 0; i < 2; ++i) {
+                mX.commitPushIndex(pushGeneration, pushIndex);
+                X.advanceIndex(&pushGeneration, &pushIndex);
+            }
+
+            // The pop range stops at the first cell not yet committed.
+
+            ASSERT(0 == mX.reservePopIndexes(&generation,
+                                             &index,
+                                             &numReserved,
+                                             10));
+            ASSERT(0 == generation);
+            ASSERT(4 == index);
+            ASSERT(3 == numReserved);
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                mX.commitPopIndex(generation, index);
+                X.advanceIndex(&generation, &index);
+            }
+
+            for (unsigned int i = 0; i < 2; ++i) {
+                mX.commitPushIndex(pushGeneration, pushIndex);
+                X.advanceIndex(&pushGeneration, &pushIndex);
+            }
+            ASSERT(2 == X.length());
+
+            ASSERT(0 == mX.reservePopIndexes(&generation,
+                                             &index,
+                                             &numReserved,
+                                             10));
+            ASSERT(1 == generation);
+            ASSERT(2 == index);
+            ASSERT(2 == numReserved);
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                mX.commitPopIndex(generation, index);
+                X.advanceIndex(&generation, &index);
+            }
+            ASSERT(0 == X.length());
+
+            mX.disable();
+            ASSERT(0 >  mX.reservePushIndexes(&generation,
+                                              &index,
+                                              &numReserved,
+                                              1));
+            ASSERT(0 == X.length());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // CONCERN: maxCombinedIndex
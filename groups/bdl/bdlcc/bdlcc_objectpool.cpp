@@ -30,6 +30,16 @@ BSLS_IDENT_RCSID(bdlcc_objectpool_cpp,"$Id$ $CSID$")
 // lowest-order bit of the count is reserved to indicate an object that is
 // available for reuse but has yet to be added back to the free list.
 //
+// When thread caching is enabled, an object released to a thread cache keeps
+// the reference count it had while in use (2, plus any increment by a thread
+// still racing to pop it from the free list), and its node is linked into the
+// cache through 'd_next_p'.  A racing thread therefore sees an object in use
+// and backs off, and cannot pop the node through a stale free-list head,
+// since the node can reappear at the head only after its count is brought
+// back to 0.  Objects leaving a cache go through the usual release protocol
+// one by one ('prepareRelease'), and those not handed over to a racing thread
+// are chained and attached to the free list with a single compare-and-swap.
+//
 // The reference count is thus unguarded and is crucial to the whole algorithm.
 // Any change in the logic for using the reference count must be made with
 // extreme caution and only after consulting with threading experts in our
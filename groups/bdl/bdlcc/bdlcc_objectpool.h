@@ -51,6 +51,28 @@ BSLS_IDENT("$Id: $")
 // 'getObject' and 'releaseObject', respectively).  The pool can thus be used
 // anywhere a 'bdlma::Factory' (or, therefore, a 'bdlma::Deleter') is expected.
 //
+///Batch Operations
+///----------------
+// 'getObjects' and 'releaseObjects' acquire and release several objects in a
+// single call.  'getObjects' grows the pool at most once to cover the whole
+// request, rather than once per depletion, and 'releaseObjects' returns all
+// the objects to the free list with a single atomic operation.
+//
+///Thread Caching
+///--------------
+// By default, every 'getObject' and 'releaseObject' operates on the free list
+// shared by all threads.  When many threads acquire and release objects at a
+// high rate, that list becomes a point of contention.  Calling
+// 'enableThreadCaching' (before the pool is shared between threads) gives
+// each thread a private cache holding up to a given number of released
+// objects.  'releaseObject' then puts the object in the cache of the calling
+// thread, and 'getObject' takes an object from that cache whenever it is not
+// empty, touching no shared state.  When a cache overflows, half of its
+// objects are returned to the shared free list at once, and a cache is
+// emptied into the free list when its thread exits.  Objects held in a thread
+// cache are not reported by 'numAvailableObjects', and can be obtained only
+// by the thread owning the cache.
+//
 ///Integrating with 'bslma::ManagedPtr' and 'bsl::shared_ptr'
 /// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // A 'bdlcc::ObjectPool' is designed to work with both managed and shared
@@ -112,9 +134,10 @@ BSLS_IDENT("$Id: $")
 // There are two potential sources of exceptions in this component: memory
 // allocation and object construction.  The object pool is exception-neutral
 // with full guarantee of rollback for the following methods: if an exception
-// is thrown in 'getObject', 'reserveCapacity', or 'increaseCapacity', then the
-// pool is in a valid unmodified state (i.e., identical to its state prior to
-// the call to 'getObject').  No other method of 'bdlcc::ObjectPool' can throw.
+// is thrown in 'getObject', 'getObjects', 'reserveCapacity', or
+// 'increaseCapacity', then the pool is in a valid unmodified state (i.e.,
+// identical to its state prior to the call to 'getObject').  No other method
+// of 'bdlcc::ObjectPool' can throw.
 //
 ///Pool replenishment policy
 ///-------------------------
@@ -336,6 +359,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_exceptionutil.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_performancehint.h>
 #include <bsls_review.h>
@@ -694,6 +718,20 @@ class ObjectPool : public bdlma::Factory<TYPE> {
             // proctor.
     };
 
+    struct ThreadCache {
+        // This 'struct' holds the objects released by one thread, linked
+        // through the 'd_next_p' field of their object nodes.  The reference
+        // count of a cached node is left as it was while the object was in
+        // use, so that a thread concurrently trying to pop that node from the
+        // free list backs off as it would for an object in use.
+
+        MyType      *d_pool_p;      // pool owning this cache
+        ThreadCache *d_prev_p;      // previous cache in registry
+        ThreadCache *d_next_p;      // next cache in registry
+        ObjectNode  *d_head_p;      // list of cached objects
+        int          d_numObjects;  // number of cached objects
+    };
+
     enum {
         // A block containing 'N' objects is organized with a single
         // 'BlockNode' followed by 'N' frames, each frame consisting of one
@@ -731,10 +769,14 @@ class ObjectPool : public bdlma::Factory<TYPE> {
         k_GROW_FACTOR           =   2,  // multiplicative factor to grow
                                         // capacity
 
-        k_MAX_NUM_OBJECTS       = -32   // minimum 'd_numReplenishObjects'
+        k_MAX_NUM_OBJECTS       = -32,  // minimum 'd_numReplenishObjects'
                                         // value beyond which
                                         // 'd_numReplenishObjects' becomes
                                         // positive
+
+        k_DEFAULT_THREAD_CACHE_CAPACITY
+                                =  64   // objects cached per thread unless
+                                        // specified otherwise
     };
 
     // DATA
@@ -765,8 +807,22 @@ class ObjectPool : public bdlma::Factory<TYPE> {
     bslma::Allocator      *d_allocator_p;          // held, not owned
 
     bslmt::Mutex           d_mutex;                // pool replenishment
+                                                   // and cache registry
                                                    // serializer
 
+    int                    d_threadCacheCapacity;  // maximum objects cached
+                                                   // per thread, or 0 if
+                                                   // thread caching is
+                                                   // disabled
+
+    bslmt::ThreadUtil::Key d_cacheKey;             // key of the calling
+                                                   // thread's cache (valid
+                                                   // only if thread caching
+                                                   // is enabled)
+
+    ThreadCache           *d_caches_p;             // registry of the thread
+                                                   // caches
+
     // NOT IMPLEMENTED
     ObjectPool(const MyType&, bslma::Allocator * = 0);
     ObjectPool& operator=(const MyType&);
@@ -775,6 +831,12 @@ class ObjectPool : public bdlma::Factory<TYPE> {
     friend class AutoCleanup;
 
   private:
+    // PRIVATE CLASS METHODS
+    static void removeThreadCache(void *cache);
+        // Return the objects held in the specified thread 'cache' to the free
+        // list of the pool owning it, and deallocate 'cache'.  This function
+        // is invoked on thread exit for each thread having a cache.
+
     // PRIVATE MANIPULATORS
     void replenish();
         // Add additional objects to this pool based on the replenishment
@@ -784,6 +846,40 @@ class ObjectPool : public bdlma::Factory<TYPE> {
         // Create the specified 'numObjects' objects and attach them to this
         // object pool.
 
+    ThreadCache *lookupThreadCache();
+        // Return the address of the cache of the calling thread, creating it
+        // if needed, or 0 if the cache cannot be created.  The behavior is
+        // undefined unless thread caching is enabled.
+
+    void destroyThreadCache(ThreadCache *cache);
+        // Return the objects held in the specified 'cache' to the free list,
+        // remove 'cache' from the registry, and deallocate it.
+
+    void flushThreadCache(ThreadCache *cache, int numToKeep);
+        // Return all but the specified 'numToKeep' most recently cached
+        // objects of the specified 'cache' to the free list.  The behavior is
+        // undefined unless '0 <= numToKeep <= cache->d_numObjects'.
+
+    TYPE *popObject();
+        // Remove an object from the free list, replenishing this pool if the
+        // free list is empty, and return its address.
+
+    bool prepareRelease(ObjectNode *node);
+        // Mark the object of the specified in-use 'node' as available.
+        // Return 'true' if the caller must attach 'node' to the free list,
+        // and 'false' if the object was instead handed over to a thread
+        // concurrently trying to pop 'node' from the free list.
+
+    void pushObjects(ObjectNode *head, ObjectNode *tail, int numObjects);
+        // Attach the specified list of 'numObjects' nodes, beginning at the
+        // specified 'head' and ending at the specified 'tail', to the free
+        // list.  The behavior is undefined unless each node of the list was
+        // returned 'true' by 'prepareRelease'.
+
+    void releaseNodes(ObjectNode *list);
+        // Return the objects of the specified null-terminated 'list' of
+        // in-use nodes to the free list using a single atomic operation.
+
   public:
     // TYPES
     typedef RESETTER ResetterType;
@@ -870,12 +966,30 @@ class ObjectPool : public bdlma::Factory<TYPE> {
         // reclaimed.
 
     // MANIPULATORS
+    int enableThreadCaching(int maxCachedObjects =
+                                              k_DEFAULT_THREAD_CACHE_CAPACITY);
+        // Give each thread using this pool a private cache of up to the
+        // optionally specified 'maxCachedObjects' released objects (see
+        // {Thread Caching}).  Return 0 on success, and a non-zero value
+        // (leaving this pool unaffected) if no thread-specific storage key
+        // is available.  The behavior is undefined unless
+        // '1 <= maxCachedObjects', thread caching is not already enabled, and
+        // no other thread is using this pool.
+
     TYPE *getObject();
         // Return an address of modifiable object from this object pool.  If
         // this pool is empty, it is replenished according to the strategy
         // specified at the pool construction (or an implementation-defined
         // strategy if none was provided).
 
+    void getObjects(TYPE **objects, int numObjects);
+        // Load into the specified 'objects' array the addresses of the
+        // specified 'numObjects' modifiable objects from this object pool.
+        // If this pool does not have enough objects available, it is grown
+        // once to cover the whole request.  The behavior is undefined unless
+        // 'objects' has room for at least 'numObjects' pointers and
+        // '0 <= numObjects'.
+
     void increaseCapacity(int numObjects);
         // Create the specified 'numObjects' objects and add them to this
         // object pool.  The behavior is undefined unless '0 <= numObjects'.
@@ -890,6 +1004,14 @@ class ObjectPool : public bdlma::Factory<TYPE> {
         // 'getObject' requests.  The behavior is undefined unless the 'object'
         // was obtained from this object pool's 'getObject' method.
 
+    void releaseObjects(TYPE **objects, int numObjects);
+        // Return the specified 'numObjects' objects of the specified
+        // 'objects' array back to this object pool, as if by invoking
+        // 'releaseObject' on each of them, but attaching them to the free
+        // list in a single atomic operation.  The behavior is undefined
+        // unless '0 <= numObjects' and each object was obtained from this
+        // object pool and not yet released.
+
     void reserveCapacity(int numObjects);
         // Create enough objects to satisfy requests for at least the specified
         // 'numObjects' objects before the next replenishment.  The behavior is
@@ -900,12 +1022,18 @@ class ObjectPool : public bdlma::Factory<TYPE> {
     // ACCESSORS
     int numAvailableObjects() const;
         // Return a *snapshot* of the number of objects available in this pool.
+        // Note that objects held in thread caches are not included (see
+        // {Thread Caching}).
 
     int numObjects() const;
         // Return the (instantaneous) number of objects managed by this pool.
         // This includes both the objects available in the pool and the objects
         // that were allocated from the pool and not yet released.
 
+    int threadCacheCapacity() const;
+        // Return the maximum number of released objects each thread may cache
+        // in this pool, or 0 if thread caching is not enabled.
+
     // 'bdlma::Factory' INTERFACE
     virtual TYPE *createObject();
         // This concrete implementation of 'bdlma::Factory::createObject'
@@ -926,6 +1054,14 @@ class ObjectPool : public bdlma::Factory<TYPE> {
                                 // ObjectPool
                                 // ----------
 
+// PRIVATE CLASS METHODS
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::removeThreadCache(void *cache)
+{
+    ThreadCache *threadCache = static_cast<ThreadCache *>(cache);
+    threadCache->d_pool_p->destroyThreadCache(threadCache);
+}
+
 // PRIVATE MANIPULATORS
 template <class TYPE, class CREATOR, class RESETTER>
 void ObjectPool<TYPE, CREATOR, RESETTER>::replenish()
@@ -1002,6 +1138,267 @@ void ObjectPool<TYPE, CREATOR, RESETTER>::addObjects(int numObjects)
     d_numAvailableObjects.addRelaxed(numObjects);
 }
 
+template <class TYPE, class CREATOR, class RESETTER>
+typename ObjectPool<TYPE, CREATOR, RESETTER>::ThreadCache *
+ObjectPool<TYPE, CREATOR, RESETTER>::lookupThreadCache()
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+        return cache;                                                 // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BSLS_TRY {
+        cache = static_cast<ThreadCache *>(
+                                d_allocator_p->allocate(sizeof(ThreadCache)));
+    }
+    BSLS_CATCH(...) {
+        return 0;                                                     // RETURN
+    }
+
+    cache->d_pool_p     = this;
+    cache->d_prev_p     = 0;
+    cache->d_next_p     = d_caches_p;
+    cache->d_head_p     = 0;
+    cache->d_numObjects = 0;
+
+    if (d_caches_p) {
+        d_caches_p->d_prev_p = cache;
+    }
+    d_caches_p = cache;
+
+    bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+
+    return cache;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::destroyThreadCache(
+                                                            ThreadCache *cache)
+{
+    releaseNodes(cache->d_head_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (cache->d_prev_p) {
+        cache->d_prev_p->d_next_p = cache->d_next_p;
+    }
+    else {
+        d_caches_p = cache->d_next_p;
+    }
+    if (cache->d_next_p) {
+        cache->d_next_p->d_prev_p = cache->d_prev_p;
+    }
+
+    d_allocator_p->deallocate(cache);
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::flushThreadCache(
+                                                        ThreadCache *cache,
+                                                        int          numToKeep)
+{
+    BSLS_ASSERT(0 <= numToKeep);
+    BSLS_ASSERT(numToKeep <= cache->d_numObjects);
+
+    // Keep the most recently released objects, which are the likeliest to
+    // still be in the cache of the processor.
+
+    ObjectNode *list = cache->d_head_p;
+    ObjectNode *last = 0;
+    for (int i = 0; i < numToKeep; ++i) {
+        last = list;
+        list = list->d_inUse.d_next_p;
+    }
+
+    if (last) {
+        last->d_inUse.d_next_p = 0;
+    }
+    else {
+        cache->d_head_p = 0;
+    }
+    cache->d_numObjects = numToKeep;
+
+    releaseNodes(list);
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+TYPE *ObjectPool<TYPE, CREATOR, RESETTER>::popObject()
+{
+    ObjectNode *p;
+    do {
+        p = d_freeObjectsList.loadAcquire();
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!p)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            p = d_freeObjectsList;
+            if (!p) {
+                replenish();
+                continue;
+            }
+        }
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            2 != bsls::AtomicOperations::addIntNv(&p->d_inUse.d_refCount,2))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            for (int i = 0; i < 3; ++i) {
+                // To avoid unnecessary contention, assume that if we did not
+                // get the first reference, then the other thread is about to
+                // complete the pop.  Wait for a few cycles until he does.  If
+                // he does not complete then go on and try to acquire it
+                // ourselves.
+
+                if (d_freeObjectsList != p) {
+                    break;
+                }
+            }
+        }
+
+        // Force a dependent read of d_next_p to make sure that we're not
+        // racing against a thread calling 'deallocate' for 'p' and that
+        // checked the 'refCount' *before* we incremented it.  Either we can
+        // observe the new free list value (== p) and because of the release
+        // barrier, we can observe the new 'd_next_p' value (this relies on a
+        // dependent load) or 'loadRelaxed' will the "old" (!= p) and the
+        // condition will fail.  Note that 'h' is made volatile so that the
+        // compiler does not replace the 'h->d_inUse' load with 'p->d_inUse'
+        // (and thus removing the data dependency).  TBD to be completely
+        // thorough 'h->d_inUse.d_next_p' needs a load dependent barrier (no-op
+        // on all current architectures though).
+
+        const ObjectNode * volatile h = d_freeObjectsList.loadRelaxed();
+
+        // Split the likely into 2 to workaround gcc 4.2 to gcc 4.4 bugs
+        // documented in 'bsls_performancehint'.
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(h == p)
+         && BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                  d_freeObjectsList.testAndSwap(p,h->d_inUse.d_next_p) == p)) {
+            break;
+        }
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        int refCount;
+        for (;;) {
+            refCount = bsls::AtomicOperations::getInt(&p->d_inUse.d_refCount);
+
+            if (refCount & 1) {
+                // The node is now free but not on the free list.  Try to take
+                // it.
+
+                if (refCount == bsls::AtomicOperations::testAndSwapInt(
+                                                    &p->d_inUse.d_refCount,
+                                                    refCount,
+                                                    refCount^1)) {
+                    // Taken!
+                    p->d_inUse.d_next_p = 0;  // not strictly necessary
+                    d_numAvailableObjects.addRelaxed(-1);
+                    return (TYPE*)(p + 1);                            // RETURN
+
+                }
+            }
+            else if (refCount == bsls::AtomicOperations::testAndSwapInt(
+                                                    &p->d_inUse.d_refCount,
+                                                    refCount,
+                                                    refCount - 2)) {
+                break;
+            }
+        }
+    } while (1);
+
+    p->d_inUse.d_next_p = 0;  // not strictly necessary
+    d_numAvailableObjects.addRelaxed(-1);
+    return (TYPE *)(p+1);
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+bool ObjectPool<TYPE, CREATOR, RESETTER>::prepareRelease(ObjectNode *node)
+{
+    int refCount = bsls::AtomicOperations::getIntRelaxed(
+                                                    &node->d_inUse.d_refCount);
+    do {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
+            refCount = bsls::AtomicOperations::testAndSwapInt(
+                                                     &node->d_inUse.d_refCount,
+                                                     2,
+                                                     0);
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
+                break;
+            }
+        }
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        const int oldRefCount = refCount;
+        refCount = bsls::AtomicOperations::testAndSwapInt(
+                                                     &node->d_inUse.d_refCount,
+                                                     refCount,
+                                                     refCount - 1);
+        if (oldRefCount == refCount) {
+            // Someone else is still trying to pop this item.  Just let them
+            // have it.
+
+            d_numAvailableObjects.addRelaxed(1);
+            return false;                                             // RETURN
+        }
+
+    } while (1);
+
+    return true;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::pushObjects(ObjectNode *head,
+                                                      ObjectNode *tail,
+                                                      int         numObjects)
+{
+    ObjectNode *oldHead = d_freeObjectsList.loadRelaxed();
+    for (;;) {
+        tail->d_inUse.d_next_p = oldHead;
+        ObjectNode * const expected = oldHead;
+        oldHead = d_freeObjectsList.testAndSwap(oldHead, head);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(expected == oldHead)) {
+            break;
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+    d_numAvailableObjects.addRelaxed(numObjects);
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::releaseNodes(ObjectNode *list)
+{
+    // Chain the nodes that are not handed over to a concurrent 'getObject',
+    // reading the link of each node *before* releasing it.
+
+    ObjectNode *head       = 0;
+    ObjectNode *tail       = 0;
+    int         numObjects = 0;
+
+    while (list) {
+        ObjectNode *node = list;
+        list = list->d_inUse.d_next_p;
+
+        if (prepareRelease(node)) {
+            node->d_inUse.d_next_p = head;
+            if (!tail) {
+                tail = node;
+            }
+            head = node;
+            ++numObjects;
+        }
+    }
+
+    if (head) {
+        pushObjects(head, tail, numObjects);
+    }
+}
+
 // CREATORS
 template <class TYPE, class CREATOR, class RESETTER>
 ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
@@ -1014,6 +1411,8 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_caches_p(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1030,6 +1429,8 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_caches_p(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1046,6 +1447,8 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_caches_p(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1065,6 +1468,8 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_caches_p(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1085,6 +1490,8 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_caches_p(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1102,6 +1509,8 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_caches_p(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1109,6 +1518,20 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 template <class TYPE, class CREATOR, class RESETTER>
 ObjectPool<TYPE, CREATOR, RESETTER>::~ObjectPool()
 {
+    // Once the key is deleted, no thread-exit cleanup can run for this pool,
+    // so the caches of the threads still alive can be deallocated.  The
+    // objects they hold are destroyed with the others below.
+
+    if (d_threadCacheCapacity) {
+        bslmt::ThreadUtil::deleteKey(d_cacheKey);
+
+        while (d_caches_p) {
+            ThreadCache *cache = d_caches_p;
+            d_caches_p = cache->d_next_p;
+            d_allocator_p->deallocate(cache);
+        }
+    }
+
     // Traverse the 'd_blockList', destroying all the objects associated with
     // each block, irrespective of whether their reference count is zero or
     // not.
@@ -1125,93 +1548,102 @@ ObjectPool<TYPE, CREATOR, RESETTER>::~ObjectPool()
 
 // MANIPULATORS
 template <class TYPE, class CREATOR, class RESETTER>
-TYPE *ObjectPool<TYPE, CREATOR, RESETTER>::getObject()
+int ObjectPool<TYPE, CREATOR, RESETTER>::enableThreadCaching(
+                                                          int maxCachedObjects)
 {
-    ObjectNode *p;
-    do {
-        p = d_freeObjectsList.loadAcquire();
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!p)) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    BSLS_ASSERT(1 <= maxCachedObjects);
+    BSLS_ASSERT(0 == d_threadCacheCapacity);
+
+    const int rc = bslmt::ThreadUtil::createKey(
+                                    &d_cacheKey,
+                                    (bslmt::ThreadUtil::Destructor)
+                                    &MyType::removeThreadCache);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
 
-            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-            p = d_freeObjectsList;
-            if (!p) {
-                replenish();
-                continue;
-            }
-        }
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            2 != bsls::AtomicOperations::addIntNv(&p->d_inUse.d_refCount,2))) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            for (int i = 0; i < 3; ++i) {
-                // To avoid unnecessary contention, assume that if we did not
-                // get the first reference, then the other thread is about to
-                // complete the pop.  Wait for a few cycles until he does.  If
-                // he does not complete then go on and try to acquire it
-                // ourselves.
+    d_threadCacheCapacity = maxCachedObjects;
+    return 0;
+}
 
-                if (d_freeObjectsList != p) {
-                    break;
-                }
-            }
+template <class TYPE, class CREATOR, class RESETTER>
+TYPE *ObjectPool<TYPE, CREATOR, RESETTER>::getObject()
+{
+    if (d_threadCacheCapacity) {
+        ThreadCache *cache = static_cast<ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+        if (cache && cache->d_head_p) {
+            ObjectNode *p   = cache->d_head_p;
+            cache->d_head_p = p->d_inUse.d_next_p;
+            --cache->d_numObjects;
+
+            p->d_inUse.d_next_p = 0;  // not strictly necessary
+            return (TYPE *)(p + 1);                                   // RETURN
         }
+    }
+    return popObject();
+}
 
-        // Force a dependent read of d_next_p to make sure that we're not
-        // racing against a thread calling 'deallocate' for 'p' and that
-        // checked the 'refCount' *before* we incremented it.  Either we can
-        // observe the new free list value (== p) and because of the release
-        // barrier, we can observe the new 'd_next_p' value (this relies on a
-        // dependent load) or 'loadRelaxed' will the "old" (!= p) and the
-        // condition will fail.  Note that 'h' is made volatile so that the
-        // compiler does not replace the 'h->d_inUse' load with 'p->d_inUse'
-        // (and thus removing the data dependency).  TBD to be completely
-        // thorough 'h->d_inUse.d_next_p' needs a load dependent barrier (no-op
-        // on all current architectures though).
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::getObjects(TYPE **objects,
+                                                     int    numObjects)
+{
+    BSLS_ASSERT(objects || 0 == numObjects);
+    BSLS_ASSERT(0 <= numObjects);
+
+    ThreadCache *cache = d_threadCacheCapacity
+                       ? static_cast<ThreadCache *>(
+                                   bslmt::ThreadUtil::getSpecific(d_cacheKey))
+                       : 0;
+
+    int numCached = 0;
+    if (cache) {
+        numCached = cache->d_numObjects < numObjects
+                  ? cache->d_numObjects
+                  : numObjects;
+    }
 
-        const ObjectNode * volatile h = d_freeObjectsList.loadRelaxed();
+    // Grow the pool once for the part of the request that neither the cache
+    // nor the free list can satisfy.  Nothing has been taken yet, so an
+    // exception leaves the pool unmodified.
 
-        // Split the likely into 2 to workaround gcc 4.2 to gcc 4.4 bugs
-        // documented in 'bsls_performancehint'.
+    if (numObjects - numCached > d_numAvailableObjects.loadRelaxed()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(h == p)
-         && BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
-                  d_freeObjectsList.testAndSwap(p,h->d_inUse.d_next_p) == p)) {
-            break;
+        int shortfall = numObjects - numCached
+                                         - d_numAvailableObjects.loadRelaxed();
+        if (shortfall > 0) {
+            if (shortfall > k_MAX_NUM_OBJECTS_PER_FRAME) {
+                shortfall = k_MAX_NUM_OBJECTS_PER_FRAME;
+            }
+            addObjects(shortfall);
         }
+    }
 
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    int i = 0;
+    for (; i < numCached; ++i) {
+        ObjectNode *p   = cache->d_head_p;
+        cache->d_head_p = p->d_inUse.d_next_p;
 
-        int refCount;
-        for (;;) {
-            refCount = bsls::AtomicOperations::getInt(&p->d_inUse.d_refCount);
+        p->d_inUse.d_next_p = 0;  // not strictly necessary
+        objects[i] = (TYPE *)(p + 1);
+    }
+    if (cache) {
+        cache->d_numObjects -= numCached;
+    }
 
-            if (refCount & 1) {
-                // The node is now free but not on the free list.  Try to take
-                // it.
+    // Other threads may deplete the free list before we are done, in which
+    // case 'popObject' replenishes the pool as usual.
 
-                if (refCount == bsls::AtomicOperations::testAndSwapInt(
-                                                    &p->d_inUse.d_refCount,
-                                                    refCount,
-                                                    refCount^1)) {
-                    // Taken!
-                    p->d_inUse.d_next_p = 0;  // not strictly necessary
-                    d_numAvailableObjects.addRelaxed(-1);
-                    return (TYPE*)(p + 1);                            // RETURN
-
-                }
-            }
-            else if (refCount == bsls::AtomicOperations::testAndSwapInt(
-                                                    &p->d_inUse.d_refCount,
-                                                    refCount,
-                                                    refCount - 2)) {
-                break;
-            }
+    BSLS_TRY {
+        for (; i < numObjects; ++i) {
+            objects[i] = popObject();
         }
-    } while (1);
-
-    p->d_inUse.d_next_p = 0;  // not strictly necessary
-    d_numAvailableObjects.addRelaxed(-1);
-    return (TYPE *)(p+1);
+    }
+    BSLS_CATCH(...) {
+        releaseObjects(objects, i);
+        BSLS_RETHROW;
+    }
 }
 
 template <class TYPE, class CREATOR, class RESETTER>
@@ -1229,47 +1661,67 @@ void ObjectPool<TYPE, CREATOR, RESETTER>::releaseObject(TYPE *object)
     ObjectNode *current = (ObjectNode *)(void *)object - 1;
     d_objectResetter.object()(object);
 
-    int refCount = bsls::AtomicOperations::getIntRelaxed(
-                                                 &current->d_inUse.d_refCount);
-    do {
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-            refCount = bsls::AtomicOperations::testAndSwapInt(
-                                                  &current->d_inUse.d_refCount,
-                                                  2,
-                                                  0);
-            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-                break;
+    if (d_threadCacheCapacity) {
+        ThreadCache *cache = lookupThreadCache();
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+            current->d_inUse.d_next_p = cache->d_head_p;
+            cache->d_head_p = current;
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                             ++cache->d_numObjects > d_threadCacheCapacity)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                flushThreadCache(cache, d_threadCacheCapacity / 2);
             }
+            return;                                                   // RETURN
         }
+    }
 
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    if (prepareRelease(current)) {
+        pushObjects(current, current, 1);
+    }
+}
 
-        const int oldRefCount = refCount;
-        refCount = bsls::AtomicOperations::testAndSwapInt(
-                                                &current->d_inUse.d_refCount,
-                                                refCount,
-                                                refCount - 1);
-        if (oldRefCount == refCount) {
-            // Someone else is still trying to pop this item.  Just let them
-            // have it.
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::releaseObjects(TYPE **objects,
+                                                         int    numObjects)
+{
+    BSLS_ASSERT(objects || 0 == numObjects);
+    BSLS_ASSERT(0 <= numObjects);
 
-            d_numAvailableObjects.addRelaxed(1);
-            return;                                                   // RETURN
+    if (0 == numObjects) {
+        return;                                                       // RETURN
+    }
+
+    // Link the objects through their (in-use) nodes.
+
+    ObjectNode *head = 0;
+    ObjectNode *tail = 0;
+    for (int i = 0; i < numObjects; ++i) {
+        ObjectNode *node = (ObjectNode *)(void *)objects[i] - 1;
+        d_objectResetter.object()(objects[i]);
+
+        node->d_inUse.d_next_p = head;
+        if (!tail) {
+            tail = node;
         }
+        head = node;
+    }
 
-    } while (1);
+    if (d_threadCacheCapacity) {
+        ThreadCache *cache = lookupThreadCache();
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+            tail->d_inUse.d_next_p = cache->d_head_p;
+            cache->d_head_p = head;
 
-    ObjectNode *head = d_freeObjectsList.loadRelaxed();
-    for (;;) {
-        current->d_inUse.d_next_p = head;
-        ObjectNode * const oldHead = head;
-        head = d_freeObjectsList.testAndSwap(head, current);
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(oldHead == head)) {
-            break;
+            cache->d_numObjects += numObjects;
+            if (cache->d_numObjects > d_threadCacheCapacity) {
+                flushThreadCache(cache, d_threadCacheCapacity / 2);
+            }
+            return;                                                   // RETURN
         }
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
     }
-    d_numAvailableObjects.addRelaxed(1);
+
+    releaseNodes(head);
 }
 
 template <class TYPE, class CREATOR, class RESETTER>
@@ -1297,6 +1749,13 @@ int ObjectPool<TYPE, CREATOR, RESETTER>::numObjects() const
     return d_numObjects;
 }
 
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+int ObjectPool<TYPE, CREATOR, RESETTER>::threadCacheCapacity() const
+{
+    return d_threadCacheCapacity;
+}
+
 template <class TYPE, class CREATOR, class RESETTER>
 inline
 TYPE *ObjectPool<TYPE, CREATOR, RESETTER>::createObject()
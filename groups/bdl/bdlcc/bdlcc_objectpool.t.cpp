@@ -36,7 +36,9 @@
 #include <bsls_timeutil.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
@@ -95,14 +97,18 @@ using namespace bsl;  // automatically added by script
 // [ 2] ~bdlcc::ObjectPool();
 //
 // MANIPULATORS
+// [19] int enableThreadCaching(int maxCachedObjects);
 // [ 2] TYPE *getObject();
+// [18] void getObjects(TYPE **objects, int numObjects);
 // [ 8] void increaseCapacity(int numObjects);
 // [ 9] void releaseObject(TYPE *objPtr);
+// [18] void releaseObjects(TYPE **objects, int numObjects);
 // [ 1] void reserveCapacity(int numObjects);
 //
 // ACCESSORS
 // [ 8] int numAvailableObjects() const;
 // [ 7] int numObjects() const;
+// [19] int threadCacheCapacity() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 3] Verify concurrent access to underlying free object list.
@@ -110,6 +116,8 @@ using namespace bsl;  // automatically added by script
 // [ 5] Verify concurrent access to underlying free object list.
 // [ 6] Verify concurrent access to underlying free object list.
 // [10] USAGE EXAMPLE
+// [19] CONCERN: concurrent use of per-thread caches
+// [-1] PERFORMANCE: get/release throughput
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -499,6 +507,245 @@ void case13Processor(bdlcc::ObjectPool<Case13Type>  *mX,
 
 }  // close unnamed namespace
 
+//                         CASE -1 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace OBJECTPOOL_TEST_CASE_MINUS_1 {
+
+enum { k_MAX_BATCH_SIZE = 64 };
+
+struct Message {
+    // This 'struct' simulates a small message object recycled through a
+    // pool.
+
+    char d_buffer[64];
+};
+
+typedef bdlcc::ObjectPool<Message> Pool;
+
+void benchmarkWorker(Pool            *pool,
+                     bsls::AtomicInt *numReady,
+                     bslmt::Barrier  *barrier,
+                     int              numIterations,
+                     int              batchSize,
+                     bool             useBatchApi)
+    // Increment the specified 'numReady' and wait on the specified 'barrier',
+    // then repeat the specified 'numIterations' times: get the specified
+    // 'batchSize' objects from the specified 'pool' and release them, using
+    // 'getObjects' and 'releaseObjects' if the specified 'useBatchApi' is
+    // 'true', and 'getObject' and 'releaseObject' otherwise.
+{
+    Message *objects[k_MAX_BATCH_SIZE];
+
+    ++*numReady;
+    barrier->wait();
+
+    for (int i = 0; i < numIterations; ++i) {
+        if (useBatchApi) {
+            pool->getObjects(objects, batchSize);
+        }
+        else {
+            for (int j = 0; j < batchSize; ++j) {
+                objects[j] = pool->getObject();
+            }
+        }
+
+        for (int j = 0; j < batchSize; ++j) {
+            objects[j]->d_buffer[0] = static_cast<char>(i);
+        }
+
+        if (useBatchApi) {
+            pool->releaseObjects(objects, batchSize);
+        }
+        else {
+            for (int j = 0; j < batchSize; ++j) {
+                pool->releaseObject(objects[j]);
+            }
+        }
+    }
+}
+
+double runBenchmark(int  numThreads,
+                    int  numIterations,
+                    int  batchSize,
+                    bool useThreadCache,
+                    bool useBatchApi)
+    // Return the number of seconds taken by the specified 'numThreads'
+    // threads to each perform the specified 'numIterations' iterations of
+    // getting and releasing the specified 'batchSize' objects from a shared
+    // pool, having thread caching enabled if the specified 'useThreadCache'
+    // is 'true', using the batch methods if the specified 'useBatchApi' is
+    // 'true'.
+{
+    Pool pool;
+    if (useThreadCache) {
+        int rc = pool.enableThreadCaching();
+        ASSERT(0 == rc);
+    }
+    pool.reserveCapacity(numThreads * batchSize);
+
+    bsls::AtomicInt    numReady(0);
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threads;
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.addThread(bdlf::BindUtil::bind(&benchmarkWorker,
+                                               &pool,
+                                               &numReady,
+                                               &barrier,
+                                               numIterations,
+                                               batchSize,
+                                               useBatchApi));
+    }
+
+    // Start timing only once every worker is about to wait on the barrier,
+    // so that thread creation is not measured.
+
+    while (numReady < numThreads) {
+        bslmt::ThreadUtil::yield();
+    }
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    barrier.wait();
+    threads.joinAll();
+    const bsls::Types::Int64 stop  = bsls::TimeUtil::getTimer();
+
+    return static_cast<double>(stop - start) / 1.0e9;
+}
+
+}  // close namespace OBJECTPOOL_TEST_CASE_MINUS_1
+
+//                         CASE 19 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace OBJECTPOOL_TEST_CASE_19 {
+
+enum {
+    k_NUM_THREADS    = 8,
+    k_NUM_ITERATIONS = 2000,
+    k_BATCH_SIZE     = 5
+};
+
+struct Slot {
+    // This 'struct' records the thread currently holding it.
+
+    int d_owner;  // id of the holding thread, or -1 if not held
+
+    Slot()
+    : d_owner(-1)
+    {
+    }
+};
+
+typedef bdlcc::ObjectPool<Slot> Pool;
+
+void getAndRelease(Pool *pool, int numObjects)
+    // Get the specified 'numObjects' objects from the specified 'pool', then
+    // release them.
+{
+    Slot *objects[k_BATCH_SIZE];
+    BSLS_ASSERT_OPT(numObjects <= k_BATCH_SIZE);
+
+    for (int i = 0; i < numObjects; ++i) {
+        objects[i] = pool->getObject();
+    }
+    for (int i = 0; i < numObjects; ++i) {
+        pool->releaseObject(objects[i]);
+    }
+}
+
+void cacheWorker(Pool *pool, bslmt::Barrier *barrier, int id)
+    // Wait on the specified 'barrier', then repeatedly get objects from the
+    // specified 'pool', alternating single and batch calls, and verify that
+    // no other thread holds them concurrently by tagging them with the
+    // specified 'id'.
+{
+    Slot *objects[k_BATCH_SIZE];
+
+    barrier->wait();
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        if (i % 2) {
+            pool->getObjects(objects, k_BATCH_SIZE);
+        }
+        else {
+            for (int j = 0; j < k_BATCH_SIZE; ++j) {
+                objects[j] = pool->getObject();
+            }
+        }
+
+        for (int j = 0; j < k_BATCH_SIZE; ++j) {
+            LOOP3_ASSERTT(id, i, objects[j]->d_owner,
+                          -1 == objects[j]->d_owner);
+            objects[j]->d_owner = id;
+        }
+
+        if (0 == i % 64) {
+            bslmt::ThreadUtil::yield();
+        }
+
+        for (int j = 0; j < k_BATCH_SIZE; ++j) {
+            LOOP3_ASSERTT(id, i, objects[j]->d_owner,
+                          id == objects[j]->d_owner);
+            objects[j]->d_owner = -1;
+        }
+
+        if (i % 3) {
+            pool->releaseObjects(objects, k_BATCH_SIZE);
+        }
+        else {
+            for (int j = 0; j < k_BATCH_SIZE; ++j) {
+                pool->releaseObject(objects[j]);
+            }
+        }
+    }
+}
+
+}  // close namespace OBJECTPOOL_TEST_CASE_19
+
+//                         CASE 18 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace OBJECTPOOL_TEST_CASE_18 {
+
+enum { k_MAX_OBJECTS = 32 };
+
+struct Counted {
+    // This 'struct' counts the number of times it was reset.
+
+    int d_resetCount;
+
+    Counted()
+    : d_resetCount(0)
+    {
+    }
+
+    void reset()
+    {
+        ++d_resetCount;
+    }
+};
+
+typedef bdlcc::ObjectPool<Counted,
+                          bdlcc::ObjectPoolFunctors::DefaultCreator,
+                          bdlcc::ObjectPoolFunctors::Reset<Counted> > Pool;
+
+bool areDistinct(Counted **objects, int numObjects)
+    // Return 'true' if the specified 'numObjects' elements of the specified
+    // 'objects' array are distinct, and 'false' otherwise.
+{
+    for (int i = 0; i < numObjects; ++i) {
+        for (int j = i + 1; j < numObjects; ++j) {
+            if (objects[i] == objects[j]) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    return true;
+}
+
+}  // close namespace OBJECTPOOL_TEST_CASE_18
+
 //                         CASE 12 RELATED ENTITIES
 //-----------------------------------------------------------------------------
 
@@ -1257,6 +1504,281 @@ int main(int argc, char *argv[])
     using namespace bdlf::PlaceHolders;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 19: {
+        // --------------------------------------------------------------------
+        // THREAD CACHING
+        //
+        // Concerns:
+        //: 1 Thread caching is disabled by default, and 'enableThreadCaching'
+        //:   enables it with the specified (or a default) capacity.
+        //:
+        //: 2 An object released by a thread satisfies the next 'getObject'
+        //:   of that thread, and is not reported by 'numAvailableObjects'
+        //:   while cached.
+        //:
+        //: 3 When a cache exceeds its capacity, all but half of its capacity
+        //:   (the most recently released objects) are returned to the free
+        //:   list.
+        //:
+        //: 4 'getObjects' and 'releaseObjects' use the cache.
+        //:
+        //: 5 The cache of an exiting thread is returned to the free list.
+        //:
+        //: 6 Destroying a pool reclaims the caches of live threads.
+        //:
+        //: 7 Under concurrent use, no object is held by two threads at once,
+        //:   and all objects are available once every thread exited.
+        //
+        // Plan:
+        //: 1 Enable caching with a capacity of 4, and verify the identity of
+        //:   the objects obtained after releasing 1, 2, and 5 objects, and
+        //:   the number of available objects.  (C-1..4)
+        //:
+        //: 2 Get and release 3 objects from another thread, join it, and
+        //:   verify the number of available objects.  (C-5)
+        //:
+        //: 3 Verify that the test allocator has no memory in use once the
+        //:   pool is destroyed.  (C-6)
+        //:
+        //: 4 Have several threads get, tag, check, and release objects
+        //:   singly and in batches, then verify that all objects are
+        //:   available.  (C-7)
+        //
+        // Testing:
+        //   int enableThreadCaching(int maxCachedObjects);
+        //   int threadCacheCapacity() const;
+        //   CONCERN: concurrent use of per-thread caches
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD CACHING" << endl
+                          << "==============" << endl;
+
+        using namespace OBJECTPOOL_TEST_CASE_19;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            Pool mX(-1, &ta);  const Pool& X = mX;
+
+            ASSERT(0 == X.threadCacheCapacity());
+
+            ASSERT(0 == mX.enableThreadCaching());
+            ASSERT(0 <  X.threadCacheCapacity());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        {
+            Pool mX(-1, &ta);  const Pool& X = mX;
+
+            ASSERT(0 == mX.enableThreadCaching(4));
+            ASSERT(4 == X.threadCacheCapacity());
+
+            if (veryVerbose) cout << "\tSingle object." << endl;
+
+            Slot *objects[k_BATCH_SIZE];
+
+            objects[0] = mX.getObject();
+            const int NUM_AVAILABLE = X.numAvailableObjects();
+
+            mX.releaseObject(objects[0]);
+            ASSERT(NUM_AVAILABLE == X.numAvailableObjects());
+
+            ASSERT(objects[0]    == mX.getObject());
+            ASSERT(NUM_AVAILABLE == X.numAvailableObjects());
+
+            if (veryVerbose) cout << "\tCache overflow." << endl;
+
+            mX.reserveCapacity(k_BATCH_SIZE);
+            for (int i = 1; i < k_BATCH_SIZE; ++i) {
+                objects[i] = mX.getObject();
+            }
+            const int NUM_OBJECTS = X.numObjects();
+            const int AVAILABLE   = X.numAvailableObjects();
+
+            for (int i = 0; i < 4; ++i) {
+                mX.releaseObject(objects[i]);
+            }
+            ASSERTV(AVAILABLE, X.numAvailableObjects(),
+                    AVAILABLE == X.numAvailableObjects());
+
+            mX.releaseObject(objects[4]);
+            ASSERTV(AVAILABLE, X.numAvailableObjects(),
+                    AVAILABLE + 3 == X.numAvailableObjects());
+
+            ASSERT(objects[4] == mX.getObject());
+            ASSERT(objects[3] == mX.getObject());
+            ASSERT(AVAILABLE + 3 == X.numAvailableObjects());
+
+            if (veryVerbose) cout << "\tBatch operations." << endl;
+
+            mX.releaseObjects(objects + 3, 2);
+            ASSERT(AVAILABLE + 3 == X.numAvailableObjects());
+
+            Slot *batch[2];
+            mX.getObjects(batch, 2);
+            ASSERT(AVAILABLE + 3 == X.numAvailableObjects());
+            ASSERT((batch[0] == objects[3] && batch[1] == objects[4])
+                || (batch[0] == objects[4] && batch[1] == objects[3]));
+
+            mX.releaseObjects(batch, 2);
+            ASSERT(NUM_OBJECTS   == X.numObjects());
+
+            if (veryVerbose) cout << "\tThread exit." << endl;
+
+            const int AVAILABLE2 = X.numAvailableObjects();
+            ASSERT(3 <= AVAILABLE2);
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                &handle,
+                                bdlf::BindUtil::bind(&getAndRelease, &mX, 3)));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(AVAILABLE2, X.numAvailableObjects(),
+                    AVAILABLE2 == X.numAvailableObjects());
+            ASSERT(NUM_OBJECTS == X.numObjects());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (veryVerbose) cout << "\tConcurrent use." << endl;
+
+        {
+            Pool mX(-1, &ta);  const Pool& X = mX;
+
+            ASSERT(0 == mX.enableThreadCaching(8));
+
+            bslmt::Barrier     barrier(k_NUM_THREADS);
+            bslmt::ThreadGroup threads;
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(&cacheWorker,
+                                                       &mX,
+                                                       &barrier,
+                                                       i));
+            }
+            threads.joinAll();
+
+            ASSERTV(X.numObjects(), X.numAvailableObjects(),
+                    X.numObjects() == X.numAvailableObjects());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 'getObjects' loads the requested number of distinct objects,
+        //:   growing the pool (by a single block) only for the part of the
+        //:   request that the available objects cannot satisfy.
+        //:
+        //: 2 'releaseObjects' resets each object and makes all of them
+        //:   available again.
+        //:
+        //: 3 Batches of zero objects have no effect.
+        //:
+        //: 4 If growing the pool throws, 'getObjects' leaves the pool
+        //:   unmodified.
+        //
+        // Plan:
+        //: 1 Get batches from an empty and from a partially depleted pool,
+        //:   and verify the number of objects, of available objects, and of
+        //:   blocks allocated.  (C-1)
+        //:
+        //: 2 Release the batches, and verify the reset counts and the number
+        //:   of available objects.  (C-2)
+        //:
+        //: 3 Get and release empty batches.  (C-3)
+        //:
+        //: 4 Exhaust the allocator while growing the pool in 'getObjects',
+        //:   and verify the state of the pool.  (C-4)
+        //
+        // Testing:
+        //   void getObjects(TYPE **objects, int numObjects);
+        //   void releaseObjects(TYPE **objects, int numObjects);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        using namespace OBJECTPOOL_TEST_CASE_18;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            Pool mX(-1, &ta);  const Pool& X = mX;
+
+            Counted *objects[k_MAX_OBJECTS];
+
+            mX.getObjects(objects, 0);
+            ASSERT(0 == X.numObjects());
+            mX.releaseObjects(objects, 0);
+            ASSERT(0 == X.numAvailableObjects());
+
+            bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            mX.getObjects(objects, 10);
+            ASSERT(10            == X.numObjects());
+            ASSERT(0             == X.numAvailableObjects());
+            ASSERT(numBlocks + 1 == ta.numBlocksTotal());
+            ASSERT(areDistinct(objects, 10));
+
+            mX.releaseObjects(objects, 10);
+            ASSERT(10 == X.numAvailableObjects());
+            for (int i = 0; i < 10; ++i) {
+                LOOP_ASSERT(i, 1 == objects[i]->d_resetCount);
+            }
+
+            Counted *others[k_MAX_OBJECTS];
+
+            numBlocks = ta.numBlocksTotal();
+
+            mX.getObjects(others, 10);
+            ASSERT(10        == X.numObjects());
+            ASSERT(0         == X.numAvailableObjects());
+            ASSERT(numBlocks == ta.numBlocksTotal());
+            for (int i = 0; i < 10; ++i) {
+                LOOP_ASSERT(i, objects + 10 != bsl::find(objects,
+                                                         objects + 10,
+                                                         others[i]));
+            }
+
+            mX.releaseObjects(others, 4);
+            ASSERT(4 == X.numAvailableObjects());
+
+            mX.getObjects(objects, 16);
+            ASSERT(22            == X.numObjects());
+            ASSERT(0             == X.numAvailableObjects());
+            ASSERT(numBlocks + 1 == ta.numBlocksTotal());
+            ASSERT(areDistinct(objects, 16));
+
+            mX.releaseObjects(objects, 16);
+            mX.releaseObjects(others + 4, 6);
+            ASSERT(22 == X.numAvailableObjects());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            if (veryVerbose) cout << "\tException neutrality." << endl;
+
+            ta.setAllocationLimit(0);
+
+            bool caught = false;
+            try {
+                mX.getObjects(objects, k_MAX_OBJECTS);
+            }
+            catch (const bslma::TestAllocatorException&) {
+                caught = true;
+            }
+            ta.setAllocationLimit(-1);
+
+            ASSERT(caught);
+            ASSERT(22 == X.numObjects());
+            ASSERT(22 == X.numAvailableObjects());
+#endif
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 17: {
         /////////////////////////////////////////////////////////
         // bdlma::Factory test
@@ -2557,6 +3079,76 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: GET/RELEASE THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Thread caching improves the throughput of 'getObject' and
+        //:   'releaseObject' when many threads share a pool.
+        //
+        // Plan:
+        //: 1 For 1 to 64 threads, have each thread repeatedly get and release
+        //:   a batch of objects from a shared pool, and report the number of
+        //:   million objects obtained per second by the existing shared free
+        //:   list, with thread caching, and with thread caching and the batch
+        //:   methods.  The total number of objects obtained is fixed, and can
+        //:   be specified as the second argument (in millions).  The batch
+        //:   size can be specified as the third argument.
+        //
+        // Testing:
+        //   PERFORMANCE: get/release throughput
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: GET/RELEASE THROUGHPUT" << endl
+                          << "===================================" << endl;
+
+        using namespace OBJECTPOOL_TEST_CASE_MINUS_1;
+
+        const int NUM_MILLIONS = argc > 2 ? atoi(argv[2]) : 4;
+        const int BATCH_SIZE   = argc > 3
+                               ? bsl::min(atoi(argv[3]),
+                                          static_cast<int>(k_MAX_BATCH_SIZE))
+                               : 4;
+
+        ASSERT(0 < NUM_MILLIONS);
+        ASSERT(0 < BATCH_SIZE);
+
+        cout << "Million objects per second (" << NUM_MILLIONS
+             << " million objects, batches of " << BATCH_SIZE << ")\n"
+             << "threads     shared     cached   cached+batch\n";
+
+        for (int numThreads = 1; numThreads <= 64; numThreads *= 2) {
+            const int NUM_ITERATIONS = static_cast<int>(
+                                      NUM_MILLIONS * 1000000LL
+                                           / (numThreads * BATCH_SIZE));
+            const double NUM_OBJECTS = static_cast<double>(NUM_ITERATIONS)
+                                          * numThreads * BATCH_SIZE / 1.0e6;
+
+            const double shared = runBenchmark(numThreads,
+                                               NUM_ITERATIONS,
+                                               BATCH_SIZE,
+                                               false,
+                                               false);
+            const double cached = runBenchmark(numThreads,
+                                               NUM_ITERATIONS,
+                                               BATCH_SIZE,
+                                               true,
+                                               false);
+            const double batch  = runBenchmark(numThreads,
+                                               NUM_ITERATIONS,
+                                               BATCH_SIZE,
+                                               true,
+                                               true);
+
+            printf("%7d %10.2f %10.2f %14.2f\n",
+                   numThreads,
+                   NUM_OBJECTS / shared,
+                   NUM_OBJECTS / cached,
+                   NUM_OBJECTS / batch);
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,909 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-sharded in-process cache.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: in-process key-value cache partitioned into shards
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::ShardedCache', implementing a thread-safe in-memory key-value cache
+// that partitions its items into a (user defined) number of independent
+// *shards*.  Each shard is a 'bdlcc::Cache' object having its own
+// reader-writer lock, hash map, and eviction queue, and each key is assigned
+// to exactly one shard based on its hash value.  Operations on keys residing
+// in different shards therefore never contend with each other, which allows
+// lookups and updates to scale with the number of threads using the cache.
+//
+// 'bdlcc::ShardedCache' provides the same interface as 'bdlcc::Cache', and
+// uses the same template parameters: the key type ('KEY'), the value type
+// ('VALUE'), the optional hash function ('HASH'), and the optional equal
+// function ('EQUAL').
+//
+///Watermarks and Eviction Order
+///-----------------------------
+// The low and high watermarks supplied at construction describe the cache as a
+// whole.  They are divided evenly (rounding up) among the shards, and each
+// shard enforces its own portion independently: eviction of the items of a
+// shard starts when that shard reaches its high watermark, and continues
+// until it falls below its low watermark.  The total number of items in the
+// cache is therefore bounded by 'numShards() * ceil(highWatermark() /
+// numShards())'.  Note that, since keys are not necessarily distributed
+// evenly, a shard may begin evicting before the cache as a whole reaches its
+// high watermark.
+//
+// The LRU, FIFO, and CLOCK eviction policies are applied within each shard,
+// so the eviction order of two items is well defined only if both items reside
+// in the same shard.  In particular, 'popFront' removes the item at the front
+// of the eviction queue of *some* non-empty shard, selecting shards in a
+// round-robin manner, and 'visit' visits the shards one after another, each in
+// the order of its eviction queue.
+//
+///Number of Shards
+///----------------
+// The number of shards is rounded up to a power of two.  Contention decreases
+// as the number of shards increases, up to a plateau reached at roughly four
+// times the number of threads *concurrently* using the cache.  Using a large
+// number of shards with small watermarks makes the eviction behavior of the
+// cache coarser, since each shard holds only a small number of items.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::ShardedCache' class template is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.
+//
+// The post-eviction callback is invoked while the write lock of the shard
+// holding the evicted item is held; therefore, as with 'bdlcc::Cache', the
+// cache object itself should not be used in a post-eviction callback.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Shared Quote Cache
+///- - - - - - - - - - - - - - - -
+// Suppose that a pool of worker threads frequently looks up quotes, keyed by
+// security identifier, that are expensive to retrieve.  A single
+// 'bdlcc::Cache' guarding all of the quotes would serialize every LRU lookup
+// on the cache's write lock, so we use a 'bdlcc::ShardedCache' instead.
+//
+// First, we define the cache, having 8 shards and holding at most 800 quotes:
+//..
+//  typedef bdlcc::ShardedCache<int, double> QuoteCache;
+//
+//  QuoteCache quoteCache(bdlcc::CacheEvictionPolicy::e_LRU,
+//                        700,
+//                        800,
+//                        8,
+//                        &talloc);
+//  assert(8   == quoteCache.numShards());
+//  assert(700 == quoteCache.lowWatermark());
+//  assert(800 == quoteCache.highWatermark());
+//..
+// Then, we populate the cache:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      quoteCache.insert(i, 100.0 + i);
+//  }
+//  assert(100 == quoteCache.size());
+//..
+// Next, we look up a quote, exactly as we would with a 'bdlcc::Cache':
+//..
+//  bsl::shared_ptr<double> quote;
+//  int                     rc = quoteCache.tryGetValue(&quote, 42);
+//  assert(0     == rc);
+//  assert(142.0 == *quote);
+//..
+// Finally, we erase a quote that is no longer valid:
+//..
+//  rc = quoteCache.erase(42);
+//  assert(0  == rc);
+//  assert(99 == quoteCache.size());
+//
+//  rc = quoteCache.tryGetValue(&quote, 42);
+//  assert(1  == rc);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_cache.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                        // ===============================
+                        // class ShardedCache_VisitorProxy
+                        // ===============================
+
+template <class KEY, class VALUE, class VISITOR>
+class ShardedCache_VisitorProxy {
+    // This class implements a functor that forwards each visited item to a
+    // client-supplied visitor, and records whether the visitor requested that
+    // the visit stop, so that the visit can stop across shard boundaries.
+
+    // DATA
+    VISITOR *d_visitor_p;  // client visitor (held, not owned)
+    bool     d_stopped;    // 'true' once 'd_visitor_p' has returned 'false'
+
+  public:
+    // CREATORS
+    explicit ShardedCache_VisitorProxy(VISITOR *visitor);
+        // Create a proxy forwarding to the specified 'visitor'.
+
+    // MANIPULATORS
+    bool operator()(const KEY& key, const VALUE& value);
+        // Invoke the held visitor on the specified 'key' and 'value', and
+        // return its result.
+
+    // ACCESSORS
+    bool stopped() const;
+        // Return 'true' if the held visitor has returned 'false', and 'false'
+        // otherwise.
+};
+
+                            // ==================
+                            // class ShardedCache
+                            // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+    // This class represents an in-process key-value store, partitioned into
+    // independently locked shards, supporting a variety of eviction policies.
+
+  public:
+    // PUBLIC TYPES
+    typedef Cache<KEY, VALUE, HASH, EQUAL>             ShardType;
+        // Type of each of the shards of this cache.
+
+    typedef typename ShardType::ValuePtrType           ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef typename ShardType::PostEvictionCallback   PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef typename ShardType::KVType                 KVType;
+        // Value type of a bulk insert entry.
+
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16  // default number of shards
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::shared_ptr<ShardType>                 ShardPtrType;
+
+    // DATA
+    bslma::Allocator          *d_allocator_p;     // memory allocator (held,
+                                                  // not owned)
+
+    bsl::size_t                d_shardMask;       // 'numShards() - 1', used
+                                                  // to select a shard
+
+    HASH                       d_hashFunction;    // hash function, used to
+                                                  // select a shard
+
+    CacheEvictionPolicy::Enum  d_evictionPolicy;  // eviction policy
+
+    bsl::size_t                d_lowWatermark;    // aggregate low watermark
+
+    bsl::size_t                d_highWatermark;   // aggregate high watermark
+
+    bsl::vector<ShardPtrType>  d_shards;          // shards, each owning a
+                                                  // disjoint subset of keys
+
+    bsls::AtomicUint           d_nextPopShard;    // index of the next shard
+                                                  // to be tried by 'popFront'
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t roundUpToPowerOfTwo(bsl::size_t value);
+        // Return the smallest power of two greater than or equal to the
+        // specified 'value', or 1 if 'value' is 0.
+
+    static bsl::size_t shardWatermark(bsl::size_t watermark,
+                                      bsl::size_t numShards);
+        // Return the portion of the specified aggregate 'watermark' enforced
+        // by each of the specified 'numShards' shards.
+
+    // PRIVATE MANIPULATORS
+    void createShards(bsl::size_t  numShards,
+                      const EQUAL& equalFunction);
+        // Create the specified 'numShards' shards using the eviction policy,
+        // watermarks, and hash function of this object and the specified
+        // 'equalFunction'.
+
+    template <class KEY_OR_KV>
+    void partition(bsl::vector<bsl::vector<KEY_OR_KV> > *shardData,
+                   const bsl::vector<KEY_OR_KV>&          data);
+    template <class KEY_OR_KV>
+    void partition(bsl::vector<bsl::vector<KEY_OR_KV> > *shardData,
+                   bsl::vector<KEY_OR_KV>                *data);
+        // Load into the specified 'shardData', having 'numShards()' elements,
+        // each element of the specified 'data' appended to the vector at the
+        // index of the shard owning its key.  The overload taking 'data' by
+        // pointer moves each element out of '*data'.
+
+    // PRIVATE ACCESSORS
+    const KEY& keyOf(const KEY& key) const;
+    const KEY& keyOf(const KVType& keyValue) const;
+        // Return the key of the specified element of bulk operation data.
+
+    ShardType& shard(const KEY& key) const;
+        // Return a reference providing modifiable access to the shard owning
+        // the specified 'key'.
+
+    bsl::size_t shardIndex(const KEY& key) const;
+        // Return the index of the shard owning the specified 'key'.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // CREATORS
+    explicit ShardedCache(bslma::Allocator *basicAllocator = 0);
+        // Create an empty LRU cache having no size limit and
+        // 'k_DEFAULT_NUM_SHARDS' shards.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards = k_DEFAULT_NUM_SHARDS,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy' and the
+        // specified aggregate 'lowWatermark' and 'highWatermark'.  Optionally
+        // specify 'numShards', which is rounded up to the next power of two,
+        // and used as the number of shards of this cache.  If 'numShards' is
+        // not specified, 'k_DEFAULT_NUM_SHARDS' is used.  Optionally specify
+        // the 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.  The behavior
+        // is undefined unless 'lowWatermark <= highWatermark',
+        // '1 <= lowWatermark', '1 <= highWatermark', and '1 <= numShards'.
+
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy', the
+        // specified aggregate 'lowWatermark' and 'highWatermark', and the
+        // specified 'numShards', which is rounded up to the next power of two.
+        // The specified 'hashFunction' is used to generate the hash values
+        // for a given key, both to select a shard and within each shard, and
+        // the specified 'equalFunction' is used to determine whether two keys
+        // have the same value.  Optionally specify the 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark',
+        // '1 <= highWatermark', and '1 <= numShards'.
+
+    //! ~ShardedCache() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.  Note that shards are cleared one after another, so items
+        // inserted concurrently with a call to this method may remain.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.  Note that the lock of
+        // each shard is acquired at most once.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+        // Move the specified 'key' and its associated 'value' into this cache.
+        // If 'key' already exists, then its value will be replaced with
+        // 'value'.  Note that all the methods that take moved objects provide
+        // the 'basic' but not the 'strong' exception guarantee -- throws may
+        // occur after the objects are moved out of; the cache will not be
+        // modified, but 'key' or 'value' may be changed.  Also note that 'key'
+        // must be copyable, even if it is moved.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'value'.  Note that the method with 'key' moved provides the
+        // 'basic' but not the 'strong' exception guarantee -- if a throw
+        // occurs, the cache will not be modified, but 'key' may be changed.
+        // Also note that 'key' must be copyable, even if it is moved.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // Note that the lock of each shard is acquired at most once.
+
+    int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // If an exception occurs during this action, we provide only the
+        // basic guarantee - both this cache and 'data' will be in some valid
+        // but unspecified state.
+
+    int popFront();
+        // Remove the item at the front of the eviction queue of a non-empty
+        // shard, selecting shards in round-robin order.  Invoke the
+        // post-eviction callback for the removed item.  Return 0 on success,
+        // and 1 if this cache is empty.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback of every shard to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the optionally specified
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
+        // move the cached item to the back of the eviction queue of its shard.
+        // Return 0 on success, and 1 if 'key' does not exist in this cache.
+        // Note that only the lock of the shard owning 'key' is acquired, and
+        // a write lock is acquired only if the eviction queue is modified.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache that
+        // returns 'true' if two 'KEY' objects have the same value, and 'false'
+        // otherwise.
+
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache to
+        // generate a hash value (of type 'std::size_t') for a 'KEY' object.
+
+    bsl::size_t highWatermark() const;
+        // Return the aggregate high watermark of this cache.
+
+    bsl::size_t lowWatermark() const;
+        // Return the aggregate low watermark of this cache.
+
+    bsl::size_t numShards() const;
+        // Return the number of shards of this cache.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.  Note that the shards are
+        // inspected one after another, so the returned value is not
+        // necessarily the size of the cache at any single point in time if
+        // the cache is modified concurrently.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // shard by shard and, within each shard, in the order of its eviction
+        // queue, until 'visitor' returns 'false'.  The 'VISITOR' type must be
+        // a callable object that can be invoked in the same way as the
+        // function 'bool (const KEY&, const VALUE&)'.  Note that the read lock
+        // of only one shard is held at any time.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                    // -------------------------------
+                    // class ShardedCache_VisitorProxy
+                    // -------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+ShardedCache_VisitorProxy<KEY, VALUE, VISITOR>::ShardedCache_VisitorProxy(
+                                                              VISITOR *visitor)
+: d_visitor_p(visitor)
+, d_stopped(false)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+bool ShardedCache_VisitorProxy<KEY, VALUE, VISITOR>::operator()(
+                                                          const KEY&   key,
+                                                          const VALUE& value)
+{
+    d_stopped = !(*d_visitor_p)(key, value);
+    return !d_stopped;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+bool ShardedCache_VisitorProxy<KEY, VALUE, VISITOR>::stopped() const
+{
+    return d_stopped;
+}
+
+                            // ------------------
+                            // class ShardedCache
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::roundUpToPowerOfTwo(
+                                                             bsl::size_t value)
+{
+    bsl::size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::shardWatermark(
+                                                     bsl::size_t watermark,
+                                                     bsl::size_t numShards)
+{
+    // Round up, without overflowing for the "no limit" watermark.
+
+    return watermark / numShards + (watermark % numShards ? 1 : 0);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::createShards(
+                                                  bsl::size_t  numShards,
+                                                  const EQUAL& equalFunction)
+{
+    const bsl::size_t lowWatermark  = shardWatermark(d_lowWatermark,
+                                                     numShards);
+    const bsl::size_t highWatermark = shardWatermark(d_highWatermark,
+                                                     numShards);
+
+    d_shards.resize(numShards);
+    for (bsl::size_t i = 0; i < numShards; ++i) {
+        d_shards[i].createInplace(d_allocator_p,
+                                  d_evictionPolicy,
+                                  lowWatermark,
+                                  highWatermark,
+                                  d_hashFunction,
+                                  equalFunction,
+                                  d_allocator_p);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class KEY_OR_KV>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::partition(
+                          bsl::vector<bsl::vector<KEY_OR_KV> > *shardData,
+                          const bsl::vector<KEY_OR_KV>&          data)
+{
+    BSLS_ASSERT(shardData->size() == d_shards.size());
+
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        (*shardData)[shardIndex(keyOf(data[i]))].push_back(data[i]);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class KEY_OR_KV>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::partition(
+                          bsl::vector<bsl::vector<KEY_OR_KV> > *shardData,
+                          bsl::vector<KEY_OR_KV>                *data)
+{
+    BSLS_ASSERT(shardData->size() == d_shards.size());
+
+    for (bsl::size_t i = 0; i < data->size(); ++i) {
+        (*shardData)[shardIndex(keyOf((*data)[i]))].push_back(
+                                      bslmf::MovableRefUtil::move((*data)[i]));
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const KEY& ShardedCache<KEY, VALUE, HASH, EQUAL>::keyOf(const KEY& key) const
+{
+    return key;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const KEY& ShardedCache<KEY, VALUE, HASH, EQUAL>::keyOf(
+                                                  const KVType& keyValue) const
+{
+    return keyValue.first;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardType&
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shard(const KEY& key) const
+{
+    return *d_shards[shardIndex(key)];
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shardIndex(const KEY& key) const
+{
+    // Each shard hashes the key again to select a bucket, so scramble the
+    // hash value before selecting a shard to keep the shard index independent
+    // of the bucket index.
+
+    bsls::Types::Uint64 hash = d_hashFunction(key);
+    hash *= 0x9E3779B97F4A7C15ULL;
+    return static_cast<bsl::size_t>(hash >> 32) & d_shardMask;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shardMask(k_DEFAULT_NUM_SHARDS - 1)
+, d_hashFunction()
+, d_evictionPolicy(CacheEvictionPolicy::e_LRU)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_shards(d_allocator_p)
+, d_nextPopShard(0)
+{
+    createShards(k_DEFAULT_NUM_SHARDS, EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numShards,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shardMask(roundUpToPowerOfTwo(numShards) - 1)
+, d_hashFunction()
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_shards(d_allocator_p)
+, d_nextPopShard(0)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+    BSLS_ASSERT(1 <= numShards);
+
+    createShards(d_shardMask + 1, EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numShards,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shardMask(roundUpToPowerOfTwo(numShards) - 1)
+, d_hashFunction(hashFunction)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_shards(d_allocator_p)
+, d_nextPopShard(0)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+    BSLS_ASSERT(1 <= numShards);
+
+    createShards(d_shardMask + 1, equalFunction);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return shard(key).erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    bsl::vector<bsl::vector<KEY> > shardKeys(d_shards.size(), d_allocator_p);
+    partition(&shardKeys, keys);
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        if (!shardKeys[i].empty()) {
+            count += d_shards[i]->eraseBulk(shardKeys[i]);
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    shard(key).insert(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                const KEY&               key,
+                                                bslmf::MovableRef<VALUE> value)
+{
+    shard(key).insert(key, bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                  bslmf::MovableRef<KEY> key,
+                                                  const VALUE&           value)
+{
+    KEY& localKey = key;
+
+    shard(localKey).insert(bslmf::MovableRefUtil::move(localKey), value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY>   key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    KEY& localKey = key;
+
+    shard(localKey).insert(bslmf::MovableRefUtil::move(localKey),
+                           bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 const ValuePtrType& valuePtr)
+{
+    shard(key).insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY> key,
+                                              const ValuePtrType&    valuePtr)
+{
+    KEY& localKey = key;
+
+    shard(localKey).insert(bslmf::MovableRefUtil::move(localKey), valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                              const bsl::vector<KVType>& data)
+{
+    bsl::vector<bsl::vector<KVType> > shardData(d_shards.size(),
+                                                d_allocator_p);
+    partition(&shardData, data);
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        if (!shardData[i].empty()) {
+            count += d_shards[i]->insertBulk(
+                                  bslmf::MovableRefUtil::move(shardData[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                  bslmf::MovableRef<bsl::vector<KVType> > data)
+{
+    bsl::vector<KVType>& localData = data;
+
+    bsl::vector<bsl::vector<KVType> > shardData(d_shards.size(),
+                                                d_allocator_p);
+    partition(&shardData, &localData);
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        if (!shardData[i].empty()) {
+            count += d_shards[i]->insertBulk(
+                                  bslmf::MovableRefUtil::move(shardData[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::popFront()
+{
+    const bsl::size_t numShards = d_shards.size();
+    const bsl::size_t start     = d_nextPopShard.addRelaxed(1) - 1;
+
+    for (bsl::size_t i = 0; i < numShards; ++i) {
+        if (0 == d_shards[(start + i) & d_shardMask]->popFront()) {
+            return 0;                                                 // RETURN
+        }
+    }
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->setPostEvictionCallback(postEvictionCallback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    return shard(key).tryGetValue(value, key, modifyEvictionQueue);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_shards[0]->equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_shards.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    ShardedCache_VisitorProxy<KEY, VALUE, VISITOR> proxy(&visitor);
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->visit(proxy);
+        if (proxy.stopped()) {
+            break;
+        }
+    }
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY,  class VALUE,  class HASH,  class EQUAL>
+struct UsesBslmaAllocator<bdlcc::ShardedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1050 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_shardedcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>    // 'atoi', 'rand'
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::ShardedCache', that
+// partitions a key-value cache into a number of independently locked
+// 'bdlcc::Cache' shards.  Since the behavior of each shard is provided (and
+// tested) by 'bdlcc::Cache', this test driver concentrates on the
+// distribution of keys among shards, the division of the watermarks, the
+// aggregation of results across shards ('size', 'visit', bulk operations,
+// 'popFront'), and thread safety.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ShardedCache(bslma::Allocator *basicAllocator);
+// [ 2] ShardedCache(policy, lowWat, highWat, numShards, basicAllocator);
+// [ 2] ShardedCache(policy, lowWat, highWat, numShards, hash, equal, alloc);
+//
+// MANIPULATORS
+// [ 3] void insert(const KEY& key, const VALUE& value);
+// [ 3] void insert(KEY&& key, VALUE&& value);
+// [ 3] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 4] int insertBulk(const bsl::vector<KVType>& data);
+// [ 4] int insertBulk(bsl::vector<KVType>&& data);
+// [ 3] int tryGetValue(value, key, modifyEvictionQueue);
+// [ 3] int erase(const KEY& key);
+// [ 4] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 5] int popFront();
+// [ 5] void setPostEvictionCallback(postEvictionCallback);
+// [ 5] void clear();
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 2] bsl::size_t numShards() const;
+// [ 3] bsl::size_t size() const;
+// [ 6] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] THREAD SAFETY
+// [ 8] USAGE EXAMPLE
+// [-1] READ PERFORMANCE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::ShardedCache<int, bsl::string> Obj;
+typedef Obj::ValuePtrType                     ValuePtr;
+typedef Obj::KVType                           KVType;
+
+struct TestHash {
+    // This 'struct' provides a hash functor, identified by 'd_id', that
+    // hashes an 'int' to its own value.
+
+    int d_id;
+
+    explicit TestHash(int id = 0)
+    : d_id(id)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key);
+    }
+};
+
+struct TestEqual {
+    // This 'struct' provides an equality functor, identified by 'd_id'.
+
+    int d_id;
+
+    explicit TestEqual(int id = 0)
+    : d_id(id)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs == rhs;
+    }
+};
+
+struct CollectingVisitor {
+    // This 'struct' provides a visitor that records the visited keys, and
+    // stops after visiting 'd_limit' items.
+
+    bsl::vector<int> d_keys;
+    bsl::size_t      d_limit;
+
+    explicit CollectingVisitor(
+                         bsl::size_t limit = bsl::numeric_limits<int>::max())
+    : d_keys()
+    , d_limit(limit)
+    {
+    }
+
+    bool operator()(int key, const bsl::string&)
+    {
+        d_keys.push_back(key);
+        return d_keys.size() < d_limit;
+    }
+};
+
+struct EvictionCounter {
+    // This 'struct' provides a post-eviction callback that counts the number
+    // of evicted items.
+
+    bsls::AtomicInt *d_count_p;
+
+    explicit EvictionCounter(bsls::AtomicInt *count)
+    : d_count_p(count)
+    {
+    }
+
+    void operator()(const ValuePtr&)
+    {
+        ++*d_count_p;
+    }
+};
+
+// ============================================================================
+//                     THREAD SAFETY TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace threadSafetyTest {
+
+enum { k_NUM_THREADS = 8, k_NUM_KEYS = 1000, k_NUM_ITERATIONS = 20 };
+
+void worker(Obj *cache, bslmt::Barrier *barrier, int id)
+    // Repeatedly insert, read, and erase keys in the specified 'cache', after
+    // waiting on the specified 'barrier'.  Keys inserted by the thread having
+    // the specified 'id' are disjoint from those inserted by other threads.
+{
+    barrier->wait();
+
+    const int base = id * k_NUM_KEYS;
+
+    const bsl::string value(1, static_cast<char>('a' + id));
+
+    for (int iter = 0; iter < k_NUM_ITERATIONS; ++iter) {
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            cache->insert(base + i, value);
+        }
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            ValuePtr result;
+            int      rc = cache->tryGetValue(&result, base + i);
+            ASSERTV(id, i, 0 == rc);
+            if (0 == rc) {
+                ASSERTV(id, i, *result, value == *result);
+            }
+        }
+        for (int i = 0; i < k_NUM_KEYS; i += 2) {
+            ASSERTV(id, i, 0 == cache->erase(base + i));
+        }
+        for (int i = 1; i < k_NUM_KEYS; i += 2) {
+            ASSERTV(id, i, 0 == cache->erase(base + i));
+        }
+    }
+}
+
+}  // close namespace threadSafetyTest
+
+// ============================================================================
+//                        PERFORMANCE TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace readPerformanceTest {
+
+template <class CACHE>
+void reader(CACHE *cache, bslmt::Barrier *barrier, int numKeys, int numReads)
+    // Wait on the specified 'barrier', then perform the specified 'numReads'
+    // LRU lookups of keys in the range '[0 .. numKeys)' in the specified
+    // 'cache'.
+{
+    barrier->wait();
+
+    unsigned int seed = static_cast<unsigned int>(bsl::rand());
+    for (int i = 0; i < numReads; ++i) {
+        seed = seed * 1103515245 + 12345;
+        bsl::shared_ptr<int> value;
+        cache->tryGetValue(&value, static_cast<int>((seed >> 8) % numKeys));
+    }
+}
+
+template <class CACHE>
+double run(CACHE *cache, int numThreads, int numKeys, int numReads)
+    // Populate the specified 'cache' with the specified 'numKeys' keys, run
+    // the specified 'numThreads' threads each performing the specified
+    // 'numReads' LRU lookups, and return the elapsed wall time in seconds.
+{
+    for (int i = 0; i < numKeys; ++i) {
+        cache->insert(i, i);
+    }
+
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threads;
+    threads.addThreads(bdlf::BindUtil::bind(&reader<CACHE>,
+                                            cache,
+                                            &barrier,
+                                            numKeys,
+                                            numReads),
+                       numThreads);
+
+    bsls::Stopwatch timer;
+    timer.start();
+    barrier.wait();
+    threads.joinAll();
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close namespace readPerformanceTest
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample1 {
+
+void example1()
+{
+    bslma::TestAllocator talloc("ue1", veryVeryVeryVerbose);
+
+///Example 1: A Shared Quote Cache
+///- - - - - - - - - - - - - - - -
+// Suppose that a pool of worker threads frequently looks up quotes, keyed by
+// security identifier, that are expensive to retrieve.  A single
+// 'bdlcc::Cache' guarding all of the quotes would serialize every LRU lookup
+// on the cache's write lock, so we use a 'bdlcc::ShardedCache' instead.
+//
+// First, we define the cache, having 8 shards and holding at most 800 quotes:
+//..
+    typedef bdlcc::ShardedCache<int, double> QuoteCache;
+
+    QuoteCache quoteCache(bdlcc::CacheEvictionPolicy::e_LRU,
+                          700,
+                          800,
+                          8,
+                          &talloc);
+    ASSERT(8   == quoteCache.numShards());
+    ASSERT(700 == quoteCache.lowWatermark());
+    ASSERT(800 == quoteCache.highWatermark());
+//..
+// Then, we populate the cache:
+//..
+    for (int i = 0; i < 100; ++i) {
+        quoteCache.insert(i, 100.0 + i);
+    }
+    ASSERT(100 == quoteCache.size());
+//..
+// Next, we look up a quote, exactly as we would with a 'bdlcc::Cache':
+//..
+    bsl::shared_ptr<double> quote;
+    int                     rc = quoteCache.tryGetValue(&quote, 42);
+    ASSERT(0     == rc);
+    ASSERT(142.0 == *quote);
+//..
+// Finally, we erase a quote that is no longer valid:
+//..
+    rc = quoteCache.erase(42);
+    ASSERT(0  == rc);
+    ASSERT(99 == quoteCache.size());
+
+    rc = quoteCache.tryGetValue(&quote, 42);
+    ASSERT(1  == rc);
+//..
+}
+
+}  // close namespace usageExample1
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usageExample1::example1();
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Concurrent insertions, lookups, and erasures of keys residing in
+        //:   the same and in different shards do not corrupt the cache.
+        //
+        // Plan:
+        //: 1 Run several threads, each inserting, reading back, and erasing
+        //:   its own disjoint range of keys, and verify that every read finds
+        //:   the value inserted by the same thread and that the cache is empty
+        //:   at the end.  (C-1)
+        //
+        // Testing:
+        //   THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD SAFETY" << endl
+                          << "=============" << endl;
+
+        using namespace threadSafetyTest;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU,
+                   k_NUM_THREADS * k_NUM_KEYS,
+                   k_NUM_THREADS * k_NUM_KEYS * 2,
+                   4,
+                   &ta);
+
+            bslmt::Barrier     barrier(k_NUM_THREADS);
+            bslmt::ThreadGroup threads(&ta);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(&worker,
+                                                       &mX,
+                                                       &barrier,
+                                                       i));
+            }
+            threads.joinAll();
+
+            ASSERTV(mX.size(), 0 == mX.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // VISIT
+        //
+        // Concerns:
+        //: 1 'visit' visits every item of every shard exactly once.
+        //:
+        //: 2 When the visitor returns 'false', no further item is visited,
+        //:   including items in subsequent shards.
+        //:
+        //: 3 Within a shard, items are visited in eviction order.
+        //
+        // Plan:
+        //: 1 Populate a cache having several shards, and visit it with a
+        //:   visitor collecting the keys.  Verify the collected keys.  (C-1)
+        //:
+        //: 2 Visit the cache with visitors stopping after 'N' items, for 'N'
+        //:   spanning several shards, and verify that exactly 'N' items are
+        //:   visited.  (C-2)
+        //:
+        //: 3 Using a single shard, access an item and verify that it is
+        //:   visited last.  (C-3)
+        //
+        // Testing:
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "VISIT" << endl
+                                  << "=====" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const int k_NUM_KEYS = 100;
+
+        Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, 1000, 1000, 8, &ta);
+        const Obj& X = mX;
+
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            mX.insert(i, "x");
+        }
+
+        {
+            CollectingVisitor visitor;
+            X.visit(visitor);
+
+            ASSERTV(visitor.d_keys.size(),
+                    k_NUM_KEYS == visitor.d_keys.size());
+
+            bsl::set<int> keys(visitor.d_keys.begin(), visitor.d_keys.end());
+            ASSERTV(keys.size(), k_NUM_KEYS == keys.size());
+            ASSERT(0              == *keys.begin());
+            ASSERT(k_NUM_KEYS - 1 == *keys.rbegin());
+        }
+
+        for (bsl::size_t limit = 1; limit <= k_NUM_KEYS; limit += 7) {
+            CollectingVisitor visitor(limit);
+            X.visit(visitor);
+
+            ASSERTV(limit, visitor.d_keys.size(),
+                    limit == visitor.d_keys.size());
+        }
+
+        {
+            Obj mY(bdlcc::CacheEvictionPolicy::e_LRU, 10, 10, 1, &ta);
+
+            mY.insert(1, "a");
+            mY.insert(2, "b");
+            mY.insert(3, "c");
+
+            ValuePtr value;
+            ASSERT(0 == mY.tryGetValue(&value, 1));
+
+            CollectingVisitor visitor;
+            mY.visit(visitor);
+
+            ASSERT(3 == visitor.d_keys.size());
+            ASSERT(2 == visitor.d_keys[0]);
+            ASSERT(3 == visitor.d_keys[1]);
+            ASSERT(1 == visitor.d_keys[2]);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // POPFRONT, CLEAR, AND POST-EVICTION CALLBACK
+        //
+        // Concerns:
+        //: 1 The post-eviction callback is installed in every shard, and is
+        //:   invoked for items evicted by 'erase', 'popFront', and watermark
+        //:   enforcement, but not by 'clear'.
+        //:
+        //: 2 'popFront' removes exactly one item while the cache is not
+        //:   empty, regardless of which shards are empty, and returns 1 once
+        //:   the cache is empty.
+        //:
+        //: 3 'clear' empties every shard.
+        //
+        // Plan:
+        //: 1 Install a counting callback, populate a cache, and call
+        //:   'popFront' until it fails, checking the size and count.
+        //:   (C-1..2)
+        //:
+        //: 2 Populate the cache, erase an item, then 'clear' it, and check the
+        //:   size and count.  (C-1, 3)
+        //
+        // Testing:
+        //   int popFront();
+        //   void setPostEvictionCallback(postEvictionCallback);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "POPFRONT, CLEAR, AND POST-EVICTION CALLBACK"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const int k_NUM_KEYS = 50;
+
+        bsls::AtomicInt count(0);
+
+        Obj mX(bdlcc::CacheEvictionPolicy::e_FIFO, 1000, 1000, 16, &ta);
+        const Obj& X = mX;
+
+        mX.setPostEvictionCallback(EvictionCounter(&count));
+
+        ASSERT(1 == mX.popFront());
+
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            mX.insert(i, "x");
+        }
+
+        for (int i = k_NUM_KEYS; i > 0; --i) {
+            ASSERTV(i, X.size(), static_cast<bsl::size_t>(i) == X.size());
+            ASSERTV(i, 0 == mX.popFront());
+        }
+        ASSERTV(X.size(), 0 == X.size());
+        ASSERT(1 == mX.popFront());
+        ASSERTV(count, k_NUM_KEYS == count);
+
+        count = 0;
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            mX.insert(i, "x");
+        }
+        ASSERT(0 == mX.erase(0));
+        ASSERT(1 == count);
+
+        mX.clear();
+        ASSERTV(X.size(), 0 == X.size());
+        ASSERT(1 == count);
+
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            ValuePtr value;
+            ASSERTV(i, 1 == mX.tryGetValue(&value, i));
+        }
+
+        // Watermark enforcement within a shard.
+
+        count = 0;
+        {
+            Obj mY(bdlcc::CacheEvictionPolicy::e_FIFO, 4, 8, 4, &ta);
+
+            mY.setPostEvictionCallback(EvictionCounter(&count));
+
+            for (int i = 0; i < 1000; ++i) {
+                mY.insert(i, "y");
+            }
+
+            ASSERTV(mY.size(), 8 >= mY.size());
+            ASSERTV(count, 1000 == count + static_cast<int>(mY.size()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BULK OPERATIONS
+        //
+        // Concerns:
+        //: 1 'insertBulk' inserts every item into the shard owning its key,
+        //:   and returns the number of newly inserted items.
+        //:
+        //: 2 The moving 'insertBulk' inserts the same items as the copying
+        //:   one.
+        //:
+        //: 3 'eraseBulk' removes every listed item present in the cache, and
+        //:   returns the number of items removed.
+        //
+        // Plan:
+        //: 1 Bulk insert data, some keys of which are already present, and
+        //:   verify the return value and the values found by 'tryGetValue'.
+        //:   (C-1..2)
+        //:
+        //: 2 Bulk erase a set of keys, some of which are not present, and
+        //:   verify the return value and the contents of the cache.  (C-3)
+        //
+        // Testing:
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int insertBulk(bsl::vector<KVType>&& data);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BULK OPERATIONS" << endl
+                                  << "===============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const int k_NUM_KEYS = 64;
+
+        for (int moveData = 0; moveData < 2; ++moveData) {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, 1000, 1000, 8, &ta);
+            const Obj& X = mX;
+
+            mX.insert(0, "old");
+            mX.insert(1, "old");
+
+            bsl::vector<KVType> data(&ta);
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                ValuePtr value;
+                value.createInplace(&ta, "new", &ta);
+                data.push_back(KVType(i, value));
+            }
+
+            int rc = moveData
+                   ? mX.insertBulk(bslmf::MovableRefUtil::move(data))
+                   : mX.insertBulk(data);
+
+            ASSERTV(moveData, rc, k_NUM_KEYS - 2 == rc);
+            ASSERTV(moveData, X.size(), k_NUM_KEYS == X.size());
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                ValuePtr value;
+                ASSERTV(moveData, i, 0 == mX.tryGetValue(&value, i));
+                ASSERTV(moveData, i, "new" == *value);
+            }
+
+            bsl::vector<int> keys(&ta);
+            for (int i = 0; i < k_NUM_KEYS * 2; i += 2) {
+                keys.push_back(i);
+            }
+
+            rc = mX.eraseBulk(keys);
+
+            ASSERTV(moveData, rc, k_NUM_KEYS / 2 == rc);
+            ASSERTV(moveData, X.size(), k_NUM_KEYS / 2 == X.size());
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                ValuePtr value;
+                ASSERTV(moveData, i, (i % 2) == !mX.tryGetValue(&value, i));
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, TRYGETVALUE, AND ERASE
+        //
+        // Concerns:
+        //: 1 Each of the 'insert' overloads adds a new item, or replaces the
+        //:   value of an existing item.
+        //:
+        //: 2 'tryGetValue' finds exactly the items that were inserted.
+        //:
+        //: 3 'erase' removes exactly the specified item.
+        //:
+        //: 4 'size' is the total number of items in all shards.
+        //:
+        //: 5 Keys are distributed among all of the shards.
+        //
+        // Plan:
+        //: 1 Using each 'insert' overload, insert and then replace items, and
+        //:   verify the values found by 'tryGetValue' and the size.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Erase the items one at a time, verifying the return value of
+        //:   'erase' and the size.  (C-3..4)
+        //:
+        //: 3 Using a visitor on each shard of a cache having watermarks
+        //:   limiting each shard, verify that every shard holds items.  (C-5)
+        //
+        // Testing:
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(KEY&& key, VALUE&& value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   int erase(const KEY& key);
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, TRYGETVALUE, AND ERASE" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const int k_NUM_KEYS = 200;
+
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, 1000, 1000, 8, &ta);
+            const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                switch (i % 3) {
+                  case 0: {
+                    mX.insert(i, bsl::string("v"));
+                  } break;
+                  case 1: {
+                    int         key = i;
+                    bsl::string value("v");
+                    mX.insert(bslmf::MovableRefUtil::move(key),
+                              bslmf::MovableRefUtil::move(value));
+                  } break;
+                  default: {
+                    ValuePtr value;
+                    value.createInplace(&ta, "v", &ta);
+                    mX.insert(i, value);
+                  } break;
+                }
+                ASSERTV(i, X.size(), i + 1U == X.size());
+            }
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                mX.insert(i, bsl::string("w"));
+            }
+            ASSERTV(X.size(), k_NUM_KEYS == X.size());
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                ValuePtr value;
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i, i % 2));
+                ASSERTV(i, "w" == *value);
+            }
+
+            ValuePtr value;
+            ASSERT(1 == mX.tryGetValue(&value, k_NUM_KEYS));
+            ASSERT(1 == mX.tryGetValue(&value, -1));
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                ASSERTV(i, 0 == mX.erase(i));
+                ASSERTV(i, 1 == mX.erase(i));
+                ASSERTV(i, 1 == mX.tryGetValue(&value, i));
+                ASSERTV(i, X.size(), k_NUM_KEYS - i - 1U == X.size());
+            }
+        }
+
+        {
+            // Each shard holds at most 2 items, so 16 items spread over the 8
+            // shards can be retained only if every shard receives some.
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_FIFO, 16, 16, 8, &ta);
+            const Obj& X = mX;
+
+            for (int i = 0; i < 10000; ++i) {
+                mX.insert(i, "z");
+            }
+
+            ASSERTV(X.size(), 8 <= X.size());
+            ASSERTV(X.size(), 16 >= X.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an LRU cache with no size limit
+        //:   and 'k_DEFAULT_NUM_SHARDS' shards.
+        //:
+        //: 2 The number of shards is rounded up to a power of two.
+        //:
+        //: 3 The accessors return the aggregate watermarks and the eviction
+        //:   policy supplied at construction.
+        //:
+        //: 4 The supplied hash and equality functors are used.
+        //:
+        //: 5 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor and verify the accessors.
+        //:   (C-1..4)
+        //:
+        //: 2 Use a test allocator, and verify that the default allocator is
+        //:   unused.  (C-5)
+        //
+        // Testing:
+        //   explicit ShardedCache(bslma::Allocator *basicAllocator);
+        //   ShardedCache(policy, lowWat, highWat, numShards, basicAllocator);
+        //   ShardedCache(policy, lowWat, highWat, numShards, hash, eq, alloc);
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numShards() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("test",    veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(bdlcc::CacheEvictionPolicy::e_LRU == X.evictionPolicy());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                             X.lowWatermark());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                            X.highWatermark());
+            ASSERT(0 == X.size());
+            ASSERT(0 <  ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_numShards;
+            bsl::size_t d_expShards;
+        } DATA[] = {
+            { L_,  1,  1 },
+            { L_,  2,  2 },
+            { L_,  3,  4 },
+            { L_,  5,  8 },
+            { L_,  8,  8 },
+            { L_, 17, 32 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE       = DATA[ti].d_line;
+            const bsl::size_t NUM_SHARDS = DATA[ti].d_numShards;
+            const bsl::size_t EXP_SHARDS = DATA[ti].d_expShards;
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_FIFO,
+                   10,
+                   20,
+                   NUM_SHARDS,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERTV(LINE, X.numShards(), EXP_SHARDS == X.numShards());
+            ASSERTV(LINE,
+                    bdlcc::CacheEvictionPolicy::e_FIFO == X.evictionPolicy());
+            ASSERTV(LINE, 10 == X.lowWatermark());
+            ASSERTV(LINE, 20 == X.highWatermark());
+        }
+
+        {
+            typedef bdlcc::ShardedCache<int, bsl::string, TestHash, TestEqual>
+                                                                       HashObj;
+
+            HashObj mX(bdlcc::CacheEvictionPolicy::e_LRU,
+                       5,
+                       6,
+                       2,
+                       TestHash(7),
+                       TestEqual(9),
+                       &ta);
+            const HashObj& X = mX;
+
+            ASSERT(2                                 == X.numShards());
+            ASSERT(bdlcc::CacheEvictionPolicy::e_LRU == X.evictionPolicy());
+            ASSERT(5                                 == X.lowWatermark());
+            ASSERT(6                                 == X.highWatermark());
+            ASSERT(7                                 == X.hashFunction().d_id);
+            ASSERT(9                                == X.equalFunction().d_id);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a cache, insert, find, and erase a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, 2, 3, 4, &ta);
+        const Obj& X = mX;
+
+        mX.insert(1, "one");
+        mX.insert(2, "two");
+        ASSERT(2 == X.size());
+
+        ValuePtr value;
+        ASSERT(0 == mX.tryGetValue(&value, 1));
+        ASSERT("one" == *value);
+        ASSERT(1 == mX.tryGetValue(&value, 3));
+
+        ASSERT(0 == mX.erase(1));
+        ASSERT(1 == X.size());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // READ PERFORMANCE
+        //   Compare the throughput of concurrent LRU lookups in a
+        //   'bdlcc::ShardedCache' with that of a 'bdlcc::Cache'.
+        //   2nd parameter: number of threads (default 4).
+        //   3rd parameter: number of reads per thread (default 1000000).
+        //   4th parameter: number of shards (default 16).
+        //
+        // Concerns:
+        //: 1 LRU lookups in a sharded cache scale with the number of threads.
+        //
+        // Plan:
+        //: 1 Time the same read workload against both caches and report the
+        //:   results.  (C-1)
+        //
+        // Testing:
+        //   READ PERFORMANCE
+        // --------------------------------------------------------------------
+
+        cout << endl << "READ PERFORMANCE" << endl
+                     << "================" << endl;
+
+        const int numThreads = argc > 2 ? atoi(argv[2]) : 4;
+        const int numReads   = argc > 3 ? atoi(argv[3]) : 1000000;
+        const int numShards  = argc > 4 ? atoi(argv[4]) : 16;
+        const int numKeys    = 100000;
+
+        bdlcc::Cache<int, int> cache(bdlcc::CacheEvictionPolicy::e_LRU,
+                                     numKeys * 2,
+                                     numKeys * 2);
+        double cacheTime = readPerformanceTest::run(&cache,
+                                                    numThreads,
+                                                    numKeys,
+                                                    numReads);
+
+        bdlcc::ShardedCache<int, int> shardedCache(
+                                             bdlcc::CacheEvictionPolicy::e_LRU,
+                                             numKeys * 2,
+                                             numKeys * 2,
+                                             numShards);
+        double shardedTime = readPerformanceTest::run(&shardedCache,
+                                                      numThreads,
+                                                      numKeys,
+                                                      numReads);
+
+        const double totalReads = static_cast<double>(numThreads) * numReads;
+
+        cout << "threads: " << numThreads
+             << ", shards: " << shardedCache.numShards() << endl
+             << "bdlcc::Cache:        " << totalReads / cacheTime
+             << " reads/sec" << endl
+             << "bdlcc::ShardedCache: " << totalReads / shardedTime
+             << " reads/sec" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERT(gam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,796 @@
+// bdlde_base64util.cpp                                               -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_base64util_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_BASE64UTIL_SIMD
+    // Convert runs of input using SSSE3, or AVX2 if the processor supports it
+    // (see 'selectEncodeKernel' and 'selectDecodeKernel').
+#include <immintrin.h>
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+// LOCAL CONSTANTS
+
+// The following table is a map of a 6-bit index value to the corresponding
+// Base64 encoding of that index.
+
+const char k_ENCODING[] = {
+//   0    1    2    3    4    5    6    7
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 000
+    'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 010
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 020
+    'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',  // 030
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',  // 040
+    'o', 'p', 'q', 'r', 's', 't', 'u', 'v',  // 050
+    'w', 'x', 'y', 'z', '0', '1', '2', '3',  // 060
+    '4', '5', '6', '7', '8', '9', '+', '/',  // 070
+};
+
+// The following table is a map from numeric Base64 encoding characters to the
+// corresponding 6-bit index; every other character maps to 'ff', which has
+// its high bit set.
+
+const unsigned char ff = 0xff;
+const unsigned char k_DECODING[256] = {
+    //  0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F
+    // --  --  --  --  --  --  --  --  --  --  --  --  --  --  --  --
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 00
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 10
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, 62, ff, ff, ff, 63,  // 20
+       52, 53, 54, 55, 56, 57, 58, 59, 60, 61, ff, ff, ff, ff, ff, ff,  // 30
+       ff,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,  // 40
+       15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, ff, ff, ff, ff, ff,  // 50
+       ff, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,  // 60
+       41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, ff, ff, ff, ff, ff,  // 70
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 80
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 90
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // A0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // B0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // C0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // D0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // E0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
+};
+
+// LOCAL TYPES
+
+typedef bsl::size_t (*EncodeKernel)(char                *out,
+                                    const unsigned char *input,
+                                    bsl::size_t          length);
+    // Signature of a function that encodes a prefix, consisting of a multiple
+    // of 3 bytes, of the specified 'input' of the specified 'length' bytes
+    // into the specified 'out' buffer (4 characters for each 3 bytes) without
+    // reading past 'input + length', and returns the length of that prefix.
+
+typedef bsl::size_t (*DecodeKernel)(char                *out,
+                                    const unsigned char *input,
+                                    bsl::size_t          length);
+    // Signature of a function that decodes a prefix, consisting of a multiple
+    // of 4 characters all in the Base64 alphabet, of the specified 'input' of
+    // the specified 'length' characters into the specified 'out' buffer (3
+    // bytes for each 4 characters) without reading past 'input + length', and
+    // returns the length of that prefix.  The function may write up to
+    // '3 * length / 4' bytes to 'out', beyond those it decodes.
+
+// LOCAL FUNCTIONS
+
+inline
+bool isIgnorable(unsigned char character, bool unrecognizedIsError)
+    // Return 'true' if the specified 'character' is ignored by a
+    // 'Base64Decoder' constructed with the specified 'unrecognizedIsError',
+    // and 'false' otherwise.
+{
+    return unrecognizedIsError
+           ? ' ' == character || ('\t' <= character && character <= '\r')
+           : k_DECODING[character] >= 64 && '=' != character;
+}
+
+bsl::size_t insertLineBreaks(char        *buffer,
+                             bsl::size_t  length,
+                             bsl::size_t  maxLineLength)
+    // Insert a CRLF after each specified 'maxLineLength' characters of the
+    // specified 'buffer' of the specified 'length' characters, except at its
+    // end, and return the resulting length.  The behavior is undefined unless
+    // 'buffer' has room for the resulting characters and
+    // '0 < maxLineLength'.
+{
+    if (length <= maxLineLength) {
+        return length;                                                // RETURN
+    }
+
+    const bsl::size_t numBreaks = (length - 1) / maxLineLength;
+    const bsl::size_t newLength = length + 2 * numBreaks;
+
+    // Move the lines, starting with the (possibly partial) last one, to their
+    // final positions; each line moves further than any preceding one, so no
+    // character is overwritten before it is moved.
+
+    bsl::size_t lineLength = length - numBreaks * maxLineLength;
+    const char *source      = buffer + length;
+    char       *destination = buffer + newLength;
+
+    for (bsl::size_t i = 0; i < numBreaks; ++i) {
+        source      -= lineLength;
+        destination -= lineLength;
+        bsl::memmove(destination, source, lineLength);
+        *--destination = '\n';
+        *--destination = '\r';
+        lineLength = maxLineLength;
+    }
+    BSLS_ASSERT(source - lineLength == buffer);
+    BSLS_ASSERT(destination - lineLength == buffer);
+
+    return newLength;
+}
+
+bsl::size_t encodeImp(char        *out,
+                      const char  *input,
+                      bsl::size_t  inputLength,
+                      int          maxLineLength,
+                      EncodeKernel kernel)
+    // Write the Base64 encoding of the specified 'input' of the specified
+    // 'inputLength' bytes to the specified 'out' buffer, as per
+    // 'Base64Util::encode' called with the specified 'maxLineLength', using
+    // the specified 'kernel', if not 0, to encode a prefix of 'input', and
+    // return the number of characters written.
+{
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    const unsigned char *p   = reinterpret_cast<const unsigned char *>(input);
+    const unsigned char *end = p + inputLength;
+    char                *o   = out;
+
+    if (kernel) {
+        const bsl::size_t numConsumed = kernel(o, p, inputLength);
+
+        p += numConsumed;
+        o += numConsumed / 3 * 4;
+    }
+
+    for (; end - p >= 3; p += 3, o += 4) {
+        const unsigned value = (p[0] << 16) | (p[1] << 8) | p[2];
+
+        o[0] = k_ENCODING[ value >> 18        ];
+        o[1] = k_ENCODING[(value >> 12) & 0x3f];
+        o[2] = k_ENCODING[(value >>  6) & 0x3f];
+        o[3] = k_ENCODING[ value        & 0x3f];
+    }
+
+    if (end - p == 2) {
+        const unsigned value = (p[0] << 8) | p[1];
+
+        o[0] = k_ENCODING[ value >> 10        ];
+        o[1] = k_ENCODING[(value >>  4) & 0x3f];
+        o[2] = k_ENCODING[(value <<  2) & 0x3f];
+        o[3] = '=';
+        o += 4;
+    }
+    else if (end - p == 1) {
+        o[0] = k_ENCODING[  p[0] >> 2        ];
+        o[1] = k_ENCODING[ (p[0] << 4) & 0x3f];
+        o[2] = '=';
+        o[3] = '=';
+        o += 4;
+    }
+
+    const bsl::size_t length = o - out;
+
+    return 0 == maxLineLength
+           ? length
+           : insertLineBreaks(out,
+                              length,
+                              static_cast<bsl::size_t>(maxLineLength));
+}
+
+int decodeImp(char         *out,
+              bsl::size_t  *numOut,
+              const char   *input,
+              bsl::size_t   inputLength,
+              bool          unrecognizedIsError,
+              DecodeKernel  kernel)
+    // Decode the specified 'input' of the specified 'inputLength' characters
+    // to the specified 'out' buffer and load into the specified 'numOut' the
+    // number of bytes written, as per 'Base64Util::decode' called with the
+    // specified 'unrecognizedIsError', using the specified 'kernel', if not 0,
+    // to decode runs of characters in the Base64 alphabet.  Return 0 on
+    // success, and a non-zero value otherwise.
+{
+    BSLS_ASSERT(numOut);
+
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    const unsigned char *p   = reinterpret_cast<const unsigned char *>(input);
+    const unsigned char *end = p + inputLength;
+    char                *o   = out;
+
+    unsigned stack      = 0;  // 6-bit values of the current quantum
+    int      numInStack = 0;  // number of values in 'stack'
+
+    while (p != end) {
+        if (0 == numInStack) {
+            // At a quantum boundary, decode as many complete quanta as
+            // possible before examining individual characters.
+
+            if (kernel) {
+                const bsl::size_t numConsumed = kernel(o, p, end - p);
+
+                p += numConsumed;
+                o += numConsumed / 4 * 3;
+            }
+
+            for (; end - p >= 4; p += 4, o += 3) {
+                const unsigned char v0 = k_DECODING[p[0]];
+                const unsigned char v1 = k_DECODING[p[1]];
+                const unsigned char v2 = k_DECODING[p[2]];
+                const unsigned char v3 = k_DECODING[p[3]];
+
+                if ((v0 | v1 | v2 | v3) & 0x80) {
+                    break;
+                }
+
+                const unsigned value =
+                                   (v0 << 18) | (v1 << 12) | (v2 << 6) | v3;
+
+                o[0] = static_cast<char>(value >> 16);
+                o[1] = static_cast<char>(value >>  8);
+                o[2] = static_cast<char>(value);
+            }
+
+            if (p == end) {
+                break;
+            }
+        }
+
+        const unsigned char character = *p++;
+        const unsigned char value     = k_DECODING[character];
+
+        if (value < 64) {
+            stack = (stack << 6) | value;
+            if (4 == ++numInStack) {
+                *o++ = static_cast<char>(stack >> 16);
+                *o++ = static_cast<char>(stack >>  8);
+                *o++ = static_cast<char>(stack);
+                numInStack = 0;
+            }
+        }
+        else if (isIgnorable(character, unrecognizedIsError)) {
+            // Skip the rest of a run of ignorable characters (typically a
+            // line break) before resuming at the top of the loop.
+
+            while (p != end && isIgnorable(*p, unrecognizedIsError)) {
+                ++p;
+            }
+        }
+        else if ('=' == character) {
+            // Padding is allowed only after 2 or 3 characters of a quantum
+            // whose unused bits are 0, and after 2 characters must be
+            // followed by a second '='.  Only ignorable characters may
+            // follow.
+
+            bool needEqual;
+
+            if (2 == numInStack && 0 == (stack & 0xf)) {
+                *o++ = static_cast<char>(stack >> 4);
+                needEqual = true;
+            }
+            else if (3 == numInStack && 0 == (stack & 0x3)) {
+                *o++ = static_cast<char>(stack >> 10);
+                *o++ = static_cast<char>(stack >>  2);
+                needEqual = false;
+            }
+            else {
+                return k_FAILURE;                                     // RETURN
+            }
+
+            for (; p != end; ++p) {
+                if (isIgnorable(*p, unrecognizedIsError)) {
+                    continue;
+                }
+                if (needEqual && '=' == *p) {
+                    needEqual = false;
+                    continue;
+                }
+                return k_FAILURE;                                     // RETURN
+            }
+
+            if (needEqual) {
+                return k_FAILURE;                                     // RETURN
+            }
+
+            numInStack = 0;
+            break;
+        }
+        else {
+            return k_FAILURE;                                         // RETURN
+        }
+    }
+
+    if (0 != numInStack) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    *numOut = o - out;
+    return k_SUCCESS;
+}
+
+#if defined(BDLDE_BASE64UTIL_SIMD)
+
+// The vectorized implementations below follow the techniques described by
+// Wojciech Mula and Daniel Lemire in "Faster Base64 Encoding and Decoding
+// Using AVX2 Instructions" (ACM Transactions on the Web, 2018).
+
+#define BDLDE_BASE64UTIL_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define BDLDE_BASE64UTIL_TARGET_AVX2  __attribute__((target("avx2")))
+    // Compile the function so annotated for a processor supporting SSSE3 (or
+    // AVX2) regardless of the target of the translation unit.  Such functions
+    // are invoked only after a runtime check for the respective instructions.
+
+BDLDE_BASE64UTIL_TARGET_SSSE3
+inline
+__m128i ssse3EncodeBlock(__m128i input)
+    // Return the Base64 characters encoding the 12 bytes in the low 96 bits
+    // of the specified 'input'.
+{
+    // Gather bytes 'a', 'b', and 'c' of each 3-byte group into a 32-bit lane
+    // as 'b a c b', then move each 6-bit value into a byte of its own by
+    // multiplying the 16-bit halves of the lane by powers of 2.
+
+    input = _mm_shuffle_epi8(input, _mm_setr_epi8(1,  0,  2,  1,
+                                                  4,  3,  5,  4,
+                                                  7,  6,  8,  7,
+                                                  10, 9, 11, 10));
+
+    const __m128i t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // Translate each 6-bit value to its character by adding an offset
+    // selected by the range the value falls into: 'A'..'Z', 'a'..'z',
+    // '0'..'9', '+', and '/'.
+
+    const __m128i offsets = _mm_setr_epi8('A',      'a' - 26,
+                                          '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52,
+                                          '+' - 62, '/' - 63,
+                                          0,        0);
+
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    range = _mm_sub_epi8(range, _mm_cmpgt_epi8(indices, _mm_set1_epi8(25)));
+
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+}
+
+BDLDE_BASE64UTIL_TARGET_SSSE3
+bsl::size_t ssse3Encode(char                *out,
+                        const unsigned char *input,
+                        bsl::size_t          length)
+    // Encode a prefix of the specified 'input' of the specified 'length'
+    // bytes into the specified 'out' buffer 12 bytes at a time, and return
+    // the length of that prefix.  See 'EncodeKernel'.
+{
+    const unsigned char *p = input;
+
+    // Each step reads 16 bytes and encodes the first 12.
+
+    for (; length - (p - input) >= 16; p += 12, out += 16) {
+        const __m128i block = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(p));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         ssse3EncodeBlock(block));
+    }
+
+    return p - input;
+}
+
+BDLDE_BASE64UTIL_TARGET_AVX2
+bsl::size_t avx2Encode(char                *out,
+                       const unsigned char *input,
+                       bsl::size_t          length)
+    // Encode a prefix of the specified 'input' of the specified 'length'
+    // bytes into the specified 'out' buffer 24 bytes at a time, and return
+    // the length of that prefix.  See 'EncodeKernel'.
+{
+    const __m256i shuffle = _mm256_setr_epi8(1,  0,  2,  1,
+                                             4,  3,  5,  4,
+                                             7,  6,  8,  7,
+                                             10, 9, 11, 10,
+                                             1,  0,  2,  1,
+                                             4,  3,  5,  4,
+                                             7,  6,  8,  7,
+                                             10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8('A',      'a' - 26,
+                                             '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52,
+                                             '+' - 62, '/' - 63,
+                                             0,        0,
+                                             'A',      'a' - 26,
+                                             '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52,
+                                             '+' - 62, '/' - 63,
+                                             0,        0);
+
+    const unsigned char *p = input;
+
+    // Each step reads 28 bytes, placing bytes '[0 .. 12)' and '[12 .. 24)' in
+    // the low 96 bits of the two 128-bit lanes, and encodes the first 24, as
+    // per 'ssse3EncodeBlock'.
+
+    for (; length - (p - input) >= 28; p += 24, out += 32) {
+        const __m128i low  = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(p));
+        const __m128i high = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(p + 12));
+
+        __m256i block = _mm256_inserti128_si256(_mm256_castsi128_si256(low),
+                                                high,
+                                                1);
+        block = _mm256_shuffle_epi8(block, shuffle);
+
+        const __m256i t0 = _mm256_and_si256(block,
+                                            _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0,
+                                              _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(block,
+                                            _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2,
+                                              _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(t1, t3);
+
+        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        range = _mm256_sub_epi8(range,
+                                _mm256_cmpgt_epi8(indices,
+                                                  _mm256_set1_epi8(25)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                            _mm256_add_epi8(indices,
+                                            _mm256_shuffle_epi8(offsets,
+                                                                range)));
+    }
+
+    for (; length - (p - input) >= 16; p += 12, out += 16) {
+        const __m128i block = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(p));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         ssse3EncodeBlock(block));
+    }
+
+    return p - input;
+}
+
+BDLDE_BASE64UTIL_TARGET_SSSE3
+inline
+bool ssse3DecodeBlock(__m128i *result, __m128i input)
+    // Load into the specified 'result' the 12 bytes (in its low 96 bits)
+    // decoded from the 16 characters of the specified 'input' and return
+    // 'true' if every character of 'input' is in the Base64 alphabet, and
+    // return 'false' with no effect otherwise.
+{
+    // Classify each character by its high and low nibbles: a character is in
+    // the alphabet if, and only if, the bitwise AND of the class bits
+    // selected by its nibbles is 0.  Note that the shifted high nibbles are
+    // masked with 0x2f rather than 0x0f, to reuse that constant below;
+    // 'pshufb' ignores bits 4-6 of each index.
+
+    const __m128i lowTable  = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x13, 0x1a,
+                                            0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i highTable = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                            0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x10, 0x10);
+    const __m128i rollTable = _mm_setr_epi8(0,   16,  19,  4,
+                                            -65, -65, -71, -71,
+                                            0,   0,   0,   0,
+                                            0,   0,   0,   0);
+    const __m128i mask2F    = _mm_set1_epi8(0x2f);
+
+    const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(input, 4),
+                                              mask2F);
+    const __m128i lowNibbles  = _mm_and_si128(input, mask2F);
+    const __m128i invalid     = _mm_and_si128(
+                                       _mm_shuffle_epi8(lowTable, lowNibbles),
+                                       _mm_shuffle_epi8(highTable,
+                                                        highNibbles));
+
+    if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(invalid,
+                                                   _mm_setzero_si128()))) {
+        return false;                                                 // RETURN
+    }
+
+    // Translate each character to its 6-bit value by adding an offset
+    // selected by its high nibble ('/' sharing its high nibble with '+').
+
+    const __m128i isSlash = _mm_cmpeq_epi8(input, mask2F);
+    const __m128i roll    = _mm_shuffle_epi8(rollTable,
+                                             _mm_add_epi8(isSlash,
+                                                          highNibbles));
+    __m128i values = _mm_add_epi8(input, roll);
+
+    // Merge the four 6-bit values of each 32-bit lane into 24 bits, then
+    // gather the three bytes of each lane, in big-endian order.
+
+    values = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    values = _mm_madd_epi16(values, _mm_set1_epi32(0x00011000));
+
+    *result = _mm_shuffle_epi8(values, _mm_setr_epi8(2,  1,  0,
+                                                     6,  5,  4,
+                                                     10, 9,  8,
+                                                     14, 13, 12,
+                                                     -1, -1, -1, -1));
+    return true;
+}
+
+BDLDE_BASE64UTIL_TARGET_SSSE3
+bsl::size_t ssse3Decode(char                *out,
+                        const unsigned char *input,
+                        bsl::size_t          length)
+    // Decode a prefix of the specified 'input' of the specified 'length'
+    // characters into the specified 'out' buffer 16 characters at a time, and
+    // return the length of that prefix.  See 'DecodeKernel'.
+{
+    const unsigned char *p = input;
+
+    // Each step writes 16 bytes, of which 12 are decoded; requiring 24
+    // characters to remain ensures the write is within '3 * length / 4'
+    // bytes.
+
+    for (; length - (p - input) >= 24; p += 16, out += 12) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+
+        if (!ssse3DecodeBlock(&block, block)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), block);
+    }
+
+    return p - input;
+}
+
+BDLDE_BASE64UTIL_TARGET_AVX2
+bsl::size_t avx2Decode(char                *out,
+                       const unsigned char *input,
+                       bsl::size_t          length)
+    // Decode a prefix of the specified 'input' of the specified 'length'
+    // characters into the specified 'out' buffer 32 characters at a time, and
+    // return the length of that prefix.  See 'DecodeKernel'.
+{
+    const __m256i lowTable  = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                               0x11, 0x11, 0x11, 0x11,
+                                               0x11, 0x11, 0x13, 0x1a,
+                                               0x1b, 0x1b, 0x1b, 0x1a,
+                                               0x15, 0x11, 0x11, 0x11,
+                                               0x11, 0x11, 0x11, 0x11,
+                                               0x11, 0x11, 0x13, 0x1a,
+                                               0x1b, 0x1b, 0x1b, 0x1a);
+    const __m256i highTable = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                               0x04, 0x08, 0x04, 0x08,
+                                               0x10, 0x10, 0x10, 0x10,
+                                               0x10, 0x10, 0x10, 0x10,
+                                               0x10, 0x10, 0x01, 0x02,
+                                               0x04, 0x08, 0x04, 0x08,
+                                               0x10, 0x10, 0x10, 0x10,
+                                               0x10, 0x10, 0x10, 0x10);
+    const __m256i rollTable = _mm256_setr_epi8(0,   16,  19,  4,
+                                               -65, -65, -71, -71,
+                                               0,   0,   0,   0,
+                                               0,   0,   0,   0,
+                                               0,   16,  19,  4,
+                                               -65, -65, -71, -71,
+                                               0,   0,   0,   0,
+                                               0,   0,   0,   0);
+    const __m256i gather    = _mm256_setr_epi8(2,  1,  0,
+                                               6,  5,  4,
+                                               10, 9,  8,
+                                               14, 13, 12,
+                                               -1, -1, -1, -1,
+                                               2,  1,  0,
+                                               6,  5,  4,
+                                               10, 9,  8,
+                                               14, 13, 12,
+                                               -1, -1, -1, -1);
+    const __m256i mask2F    = _mm256_set1_epi8(0x2f);
+
+    const unsigned char *p = input;
+
+    // Each step writes 32 bytes, of which 24 are decoded, as per
+    // 'ssse3DecodeBlock'; requiring 44 characters to remain ensures the write
+    // is within '3 * length / 4' bytes.
+
+    for (; length - (p - input) >= 44; p += 32, out += 24) {
+        const __m256i block = _mm256_loadu_si256(
+                                       reinterpret_cast<const __m256i *>(p));
+
+        const __m256i highNibbles = _mm256_and_si256(
+                                                 _mm256_srli_epi32(block, 4),
+                                                 mask2F);
+        const __m256i lowNibbles  = _mm256_and_si256(block, mask2F);
+
+        if (!_mm256_testz_si256(_mm256_shuffle_epi8(lowTable, lowNibbles),
+                                _mm256_shuffle_epi8(highTable,
+                                                    highNibbles))) {
+            break;
+        }
+
+        const __m256i isSlash = _mm256_cmpeq_epi8(block, mask2F);
+        const __m256i roll    = _mm256_shuffle_epi8(
+                                          rollTable,
+                                          _mm256_add_epi8(isSlash,
+                                                          highNibbles));
+        __m256i values = _mm256_add_epi8(block, roll);
+
+        values = _mm256_maddubs_epi16(values,
+                                      _mm256_set1_epi32(0x01400140));
+        values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+        values = _mm256_shuffle_epi8(values, gather);
+
+        // Move the 12 bytes of the high lane next to those of the low lane.
+
+        values = _mm256_permutevar8x32_epi32(
+                                 values,
+                                 _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), values);
+    }
+
+    // Note that the following loop is not delegated to 'ssse3Decode': mixing
+    // legacy SSE code with AVX code without clearing the upper halves of the
+    // registers incurs a large penalty on some processors.
+
+    for (; length - (p - input) >= 24; p += 16, out += 12) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+
+        if (!ssse3DecodeBlock(&block, block)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), block);
+    }
+
+    return p - input;
+}
+
+EncodeKernel selectEncodeKernel()
+    // Return the fastest encoding kernel supported by the processor, or 0 if
+    // there is none.
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2")  ? &avx2Encode
+         : __builtin_cpu_supports("ssse3") ? &ssse3Encode
+         : 0;
+}
+
+DecodeKernel selectDecodeKernel()
+    // Return the fastest decoding kernel supported by the processor, or 0 if
+    // there is none.
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2")  ? &avx2Decode
+         : __builtin_cpu_supports("ssse3") ? &ssse3Decode
+         : 0;
+}
+
+const EncodeKernel s_encodeKernel = selectEncodeKernel();
+const DecodeKernel s_decodeKernel = selectDecodeKernel();
+    // Kernels used by 'Base64Util'.  Note that, before these are initialized
+    // (e.g., during the initialization of other static objects), they are 0,
+    // which selects the scalar implementation.
+
+#else
+
+const EncodeKernel s_encodeKernel = 0;
+const DecodeKernel s_decodeKernel = 0;
+
+#endif // defined(BDLDE_BASE64UTIL_SIMD)
+
+}  // close unnamed namespace
+
+namespace bdlde {
+
+                             // -----------------
+                             // struct Base64Util
+                             // -----------------
+
+// CLASS METHODS
+bsl::size_t Base64Util::encode(char        *out,
+                               const char  *input,
+                               bsl::size_t  inputLength,
+                               int          maxLineLength)
+{
+    BSLS_ASSERT(out   || 0 == encodedLength(inputLength, maxLineLength));
+    BSLS_ASSERT(input || 0 == inputLength);
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    return encodeImp(out, input, inputLength, maxLineLength, s_encodeKernel);
+}
+
+int Base64Util::decode(char        *out,
+                       bsl::size_t *numOut,
+                       const char  *input,
+                       bsl::size_t  inputLength,
+                       bool         unrecognizedIsError)
+{
+    BSLS_ASSERT(out   || 0 == inputLength);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(input || 0 == inputLength);
+
+    return decodeImp(out,
+                     numOut,
+                     input,
+                     inputLength,
+                     unrecognizedIsError,
+                     s_decodeKernel);
+}
+
+                           // ----------------------
+                           // struct Base64Util_Impl
+                           // ----------------------
+
+// CLASS METHODS
+bsl::size_t Base64Util_Impl::encodeScalar(char        *out,
+                                          const char  *input,
+                                          bsl::size_t  inputLength,
+                                          int          maxLineLength)
+{
+    BSLS_ASSERT(out || 0 == inputLength);
+    BSLS_ASSERT(input || 0 == inputLength);
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    return encodeImp(out, input, inputLength, maxLineLength, 0);
+}
+
+int Base64Util_Impl::decodeScalar(char        *out,
+                                  bsl::size_t *numOut,
+                                  const char  *input,
+                                  bsl::size_t  inputLength,
+                                  bool         unrecognizedIsError)
+{
+    BSLS_ASSERT(out || 0 == inputLength);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(input || 0 == inputLength);
+
+    return decodeImp(out, numOut, input, inputLength, unrecognizedIsError, 0);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,271 @@
+// bdlde_base64util.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLDE_BASE64UTIL
+#define INCLUDED_BDLDE_BASE64UTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide functions to encode and decode complete Base64 buffers.
+//
+//@CLASSES:
+//  bdlde::Base64Util     : namespace for one-shot Base64 encoding/decoding
+//  bdlde::Base64Util_Impl: scalar implementations for testing/benchmarking
+//
+//@SEE_ALSO: bdlde_base64encoder, bdlde_base64decoder
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::Base64Util', that
+// serves as a namespace for functions that convert a complete, contiguous
+// buffer to or from its Base64 representation in a single call.  The
+// 'bdlde::Base64Encoder' and 'bdlde::Base64Decoder' mechanisms support
+// incremental conversion of input supplied in arbitrary pieces, and therefore
+// process one character at a time; when the entire input is available up
+// front, the functions of this component produce *exactly* the same result
+// (see {Relationship to 'Base64Encoder' and 'Base64Decoder'}) at a small
+// fraction of the cost.  The 'struct' 'bdlde::Base64Util_Impl' exposes the
+// portable scalar implementations, which should not be used other than to
+// test and benchmark.
+//
+///Relationship to 'Base64Encoder' and 'Base64Decoder'
+///---------------------------------------------------
+// 'Base64Util::encode' called with a given 'maxLineLength' writes the same
+// sequence of characters as a 'Base64Encoder' constructed with that
+// 'maxLineLength' to which the entire input is supplied with one call to
+// 'convert' followed by one call to 'endConvert': the (padded) Base64
+// encoding, with a CRLF inserted after each 'maxLineLength' characters except
+// at the end of the output, or no CRLF at all if 'maxLineLength' is 0.
+//
+// 'Base64Util::decode' called with a given 'unrecognizedIsError' flag
+// succeeds if, and only if, a 'Base64Decoder' constructed with that flag
+// accepts the entire input supplied with one call to 'convert' followed by
+// one call to 'endConvert', and in that case writes the same output.  In
+// particular, whitespace is ignored, the input must end on a 4-character
+// boundary (counting '=' padding, but not ignored characters), the unused
+// bits of a padded final quantum must be 0, and any character other than
+// whitespace that is not part of the Base64 alphabet is either an error or
+// ignored depending on 'unrecognizedIsError'.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// On x86-64 platforms built with GCC or clang, runs of input are converted
+// using SSSE3 instructions (16 output characters, or 16 input characters,
+// per step) or, if the processor supports them, AVX2 instructions (32 per
+// step), as determined by a runtime check; the remaining characters, line
+// breaks, padding, and any character not in the Base64 alphabet are handled
+// by the scalar implementation, which remains authoritative.  Other platforms
+// use the scalar implementation throughout.
+//
+///Performance
+///-----------
+// See the test driver for this component in the '.t.cpp' to compare the
+// performance of these functions against that of 'Base64Encoder' and
+// 'Base64Decoder'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Buffer
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a binary attachment that we want to embed, in its Base64
+// representation, into a text document, and later recover.
+//
+// First, we prepare the attachment:
+//..
+//  const char attachment[] = "\x01\x02\x03Hello, world!\xff";
+//  const bsl::size_t attachmentLength = sizeof attachment - 1;
+//..
+// Then, we size a buffer for the encoding, suppressing line breaks, and
+// encode the attachment:
+//..
+//  bsl::string encoded;
+//  encoded.resize(bdlde::Base64Util::encodedLength(attachmentLength, 0));
+//
+//  bsl::size_t numOut = bdlde::Base64Util::encode(&encoded[0],
+//                                                 attachment,
+//                                                 attachmentLength,
+//                                                 0);
+//  assert(encoded.length() == numOut);
+//  assert("AQIDSGVsbG8sIHdvcmxkIf8=" == encoded);
+//..
+// Next, we size a buffer large enough for the decoded result and decode the
+// Base64 text:
+//..
+//  bsl::vector<char> decoded(
+//                   bdlde::Base64Util::maxDecodedLength(encoded.length()));
+//
+//  int rc = bdlde::Base64Util::decode(decoded.data(),
+//                                     &numOut,
+//                                     encoded.data(),
+//                                     encoded.length());
+//  assert(0 == rc);
+//..
+// Finally, we trim the decoded buffer to the number of bytes actually written
+// and verify that we recovered the original attachment:
+//..
+//  decoded.resize(numOut);
+//  assert(attachmentLength == decoded.size());
+//  assert(0 == bsl::memcmp(attachment, decoded.data(), attachmentLength));
+//..
+// Note that input that is not a complete Base64 encoding is rejected:
+//..
+//  rc = bdlde::Base64Util::decode(decoded.data(), &numOut, "QUJD!", 5);
+//  assert(0 != rc);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                             // =================
+                             // struct Base64Util
+                             // =================
+
+struct Base64Util {
+    // This 'struct' provides a namespace for functions that convert complete
+    // buffers to and from their Base64 representation.
+
+    // CLASS DATA
+    static const int k_DEFAULT_MAX_LINE_LENGTH = 76;
+        // Maximum output line length recommended by the MIME standard, and
+        // used by default by 'Base64Encoder'.
+
+    // CLASS METHODS
+    static bsl::size_t encodedLength(
+                        bsl::size_t inputLength,
+                        int         maxLineLength = k_DEFAULT_MAX_LINE_LENGTH);
+        // Return the exact number of characters written by 'encode' for an
+        // input of the specified 'inputLength' bytes, including any CRLF
+        // inserted to keep each line of output from exceeding the optionally
+        // specified 'maxLineLength'.  If 'maxLineLength' is 0, no CRLF is
+        // inserted.  The behavior is undefined unless '0 <= maxLineLength'.
+
+    static bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+        // Return the maximum number of bytes that 'decode' can write for an
+        // input of the specified 'inputLength' characters.
+
+    static bsl::size_t encode(
+                       char        *out,
+                       const char  *input,
+                       bsl::size_t  inputLength,
+                       int          maxLineLength = k_DEFAULT_MAX_LINE_LENGTH);
+        // Write the Base64 encoding of the specified 'input' of the specified
+        // 'inputLength' bytes to the specified 'out' buffer, inserting a CRLF
+        // after each optionally specified 'maxLineLength' characters of
+        // output (except at the end of the output), and return the number of
+        // characters written, which is
+        // 'encodedLength(inputLength, maxLineLength)'.  If 'maxLineLength' is
+        // 0, no CRLF is inserted.  The behavior is undefined unless 'out'
+        // refers to a buffer of at least
+        // 'encodedLength(inputLength, maxLineLength)' characters that does not
+        // overlap 'input', and '0 <= maxLineLength'.  Note that the output is
+        // identical to that of a 'Base64Encoder' configured with
+        // 'maxLineLength' and supplied the entire input.
+
+    static int decode(char        *out,
+                      bsl::size_t *numOut,
+                      const char  *input,
+                      bsl::size_t  inputLength,
+                      bool         unrecognizedIsError = true);
+        // Decode the specified 'input' of the specified 'inputLength'
+        // characters from its Base64 representation, writing the resulting
+        // bytes to the specified 'out' buffer, and load into the specified
+        // 'numOut' the number of bytes written.  Characters that are neither
+        // part of the Base64 alphabet, '=', nor whitespace are treated as
+        // errors if the optionally specified 'unrecognizedIsError' is 'true',
+        // and ignored otherwise.  Return 0 on success, and a non-zero value if
+        // 'input' is not a complete, valid Base64 encoding, in which case the
+        // contents of 'out' and the value loaded into 'numOut' are
+        // unspecified.  The behavior is undefined unless 'out' refers to a
+        // buffer of at least 'maxDecodedLength(inputLength)' bytes that does
+        // not overlap 'input'.  Note that this function succeeds exactly when
+        // a 'Base64Decoder' constructed with 'unrecognizedIsError' accepts the
+        // entire input followed by 'endConvert', and then produces the same
+        // output.
+};
+
+                           // ======================
+                           // struct Base64Util_Impl
+                           // ======================
+
+struct Base64Util_Impl {
+    // This 'struct' provides the portable scalar implementations of the
+    // functions of 'Base64Util', for testing and benchmarking.
+
+    // CLASS METHODS
+    static bsl::size_t encodeScalar(char        *out,
+                                    const char  *input,
+                                    bsl::size_t  inputLength,
+                                    int          maxLineLength);
+        // Write the Base64 encoding of the specified 'input' of the specified
+        // 'inputLength' bytes to the specified 'out' buffer, and return the
+        // number of characters written, as per 'Base64Util::encode' called
+        // with the specified 'maxLineLength', without using any vectorized
+        // implementation.
+
+    static int decodeScalar(char        *out,
+                            bsl::size_t *numOut,
+                            const char  *input,
+                            bsl::size_t  inputLength,
+                            bool         unrecognizedIsError);
+        // Decode the specified 'input' of the specified 'inputLength'
+        // characters to the specified 'out' buffer, load into the specified
+        // 'numOut' the number of bytes written, and return 0 on success and a
+        // non-zero value otherwise, as per 'Base64Util::decode' called with
+        // the specified 'unrecognizedIsError', without using any vectorized
+        // implementation.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // struct Base64Util
+                             // -----------------
+
+// CLASS METHODS
+inline
+bsl::size_t Base64Util::encodedLength(bsl::size_t inputLength,
+                                      int         maxLineLength)
+{
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    const bsl::size_t length = (inputLength + 2) / 3 * 4;
+    const bsl::size_t lineLength = static_cast<bsl::size_t>(maxLineLength);
+
+    return 0 == lineLength || length <= lineLength
+           ? length
+           : length + 2 * ((length - 1) / lineLength);
+}
+
+inline
+bsl::size_t Base64Util::maxDecodedLength(bsl::size_t inputLength)
+{
+    return (inputLength + 3) / 4 * 3;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,975 @@
+// bdlde_base64util.t.cpp                                             -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bdlde_base64decoder.h>
+#include <bdlde_base64encoder.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides functions that encode and decode complete
+// buffers, and whose results are specified to be identical to those of the
+// 'bdlde::Base64Encoder' and 'bdlde::Base64Decoder' mechanisms supplied the
+// same input in one piece.  We therefore verify the functions primarily by
+// comparing their results with those of the mechanisms (the oracles) over a
+// large set of inputs: every length up to several vector widths, every
+// interesting line length, every alignment, and every possible character
+// substituted or inserted at every position of valid encodings.  Both the
+// dispatching functions (which use the vectorized implementation available on
+// the test machine) and the scalar implementations are checked, so that any
+// divergence is attributed to one or the other.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bsl::size_t encodedLength(bsl::size_t inputLength, int mll);
+// [ 2] bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+// [ 3] bsl::size_t encode(char *, const char *, bsl::size_t, int mll);
+// [ 4] int decode(char *, size_t *, const char *, size_t, bool);
+// [ 3] bsl::size_t Base64Util_Impl::encodeScalar(...);
+// [ 4] int Base64Util_Impl::decodeScalar(...);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: THROUGHPUT COMPARED TO MECHANISMS
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Base64Util      Util;
+typedef bdlde::Base64Util_Impl Impl;
+
+static const int LINE_LENGTHS[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 11, 12, 16, 31, 32, 57, 64, 75, 76, 77, 100,
+    1000
+};
+static const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS / sizeof *LINE_LENGTHS;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int randState = 12345;
+
+unsigned int randUnsigned()
+    // Return the next value of a simple pseudo-random sequence.
+{
+    randState = randState * 1103515245 + 12345;
+    return randState >> 8;
+}
+
+void fillRandom(char *buffer, bsl::size_t length)
+    // Load the specified 'length' pseudo-random bytes into the specified
+    // 'buffer'.
+{
+    for (bsl::size_t i = 0; i < length; ++i) {
+        buffer[i] = static_cast<char>(randUnsigned() >> 4);
+    }
+}
+
+bsl::string oracleEncode(const char  *input,
+                         bsl::size_t  length,
+                         int          maxLineLength)
+    // Return the encoding of the specified 'input' of the specified 'length'
+    // produced by a 'bdlde::Base64Encoder' configured with the specified
+    // 'maxLineLength'.
+{
+    bdlde::Base64Encoder encoder(maxLineLength);
+    bsl::string          result;
+
+    bsl::back_insert_iterator<bsl::string> out(result);
+
+    int rc = encoder.convert(out, input, input + length);
+    ASSERT(0 == rc);
+    rc = encoder.endConvert(out);
+    ASSERT(0 == rc);
+
+    return result;
+}
+
+int oracleDecode(bsl::string *result,
+                 const char  *input,
+                 bsl::size_t  length,
+                 bool         unrecognizedIsError)
+    // Decode the specified 'input' of the specified 'length' using a
+    // 'bdlde::Base64Decoder' constructed with the specified
+    // 'unrecognizedIsError', load the output into the specified 'result', and
+    // return 0 if the decoder accepts the entire input, and -1 otherwise.
+{
+    bdlde::Base64Decoder decoder(unrecognizedIsError);
+
+    result->clear();
+    bsl::back_insert_iterator<bsl::string> out(*result);
+
+    if (0 > decoder.convert(out, input, input + length)) {
+        return -1;                                                    // RETURN
+    }
+    return 0 > decoder.endConvert(out) ? -1 : 0;
+}
+
+void verifyEncode(int line, const char *input, bsl::size_t length, int mll)
+    // Verify that 'Base64Util::encode' and 'Base64Util_Impl::encodeScalar'
+    // produce the encoding of the specified 'input' of the specified 'length'
+    // with the specified 'mll' line length produced by 'Base64Encoder', and
+    // that 'encodedLength' is exact, reporting failures against the specified
+    // 'line'.
+{
+    const bsl::string  EXP = oracleEncode(input, length, mll);
+    const bsl::size_t  LEN = Util::encodedLength(length, mll);
+
+    ASSERTV(line, length, mll, EXP.length() == LEN);
+
+    // Guard bytes after the output detect writes past its end.
+
+    bsl::vector<char> buffer(LEN + 64, '#');
+
+    bsl::size_t numOut = Util::encode(buffer.data(), input, length, mll);
+    ASSERTV(line, length, mll, LEN == numOut);
+    ASSERTV(line, length, mll, EXP == bsl::string(buffer.data(), numOut));
+    ASSERTV(line, length, mll, '#' == buffer[LEN]);
+
+    bsl::fill(buffer.begin(), buffer.end(), '#');
+    numOut = Impl::encodeScalar(buffer.data(), input, length, mll);
+    ASSERTV(line, length, mll, LEN == numOut);
+    ASSERTV(line, length, mll, EXP == bsl::string(buffer.data(), numOut));
+    ASSERTV(line, length, mll, '#' == buffer[LEN]);
+}
+
+int verifyDecode(int line, const char *input, bsl::size_t length)
+    // Verify that 'Base64Util::decode' and 'Base64Util_Impl::decodeScalar'
+    // accept the specified 'input' of the specified 'length' exactly when
+    // 'Base64Decoder' does (in both error-reporting modes), and then produce
+    // the same output, reporting failures against the specified 'line'.
+    // Return the number of modes in which the input is accepted.
+{
+    int numAccepted = 0;
+
+    for (int mode = 0; mode < 2; ++mode) {
+        const bool STRICT = 0 == mode;
+
+        bsl::string EXP;
+        const int   EXP_RC = oracleDecode(&EXP, input, length, STRICT);
+
+        numAccepted += 0 == EXP_RC;
+
+        const bsl::size_t MAX = Util::maxDecodedLength(length);
+
+        for (int impl = 0; impl < 2; ++impl) {
+            bsl::vector<char> buffer(MAX + 64, '#');
+            bsl::size_t       numOut = 0;
+
+            const int rc = 0 == impl
+                           ? Util::decode(buffer.data(),
+                                          &numOut,
+                                          input,
+                                          length,
+                                          STRICT)
+                           : Impl::decodeScalar(buffer.data(),
+                                                &numOut,
+                                                input,
+                                                length,
+                                                STRICT);
+
+            ASSERTV(line, length, STRICT, impl, rc, EXP_RC,
+                    (0 == rc) == (0 == EXP_RC));
+            ASSERTV(line, length, STRICT, impl, '#' == buffer[MAX]);
+
+            if (0 == rc && 0 == EXP_RC) {
+                ASSERTV(line, length, STRICT, impl, numOut <= MAX);
+                ASSERTV(line, length, STRICT, impl,
+                        EXP == bsl::string(buffer.data(), numOut));
+            }
+        }
+    }
+
+    return numAccepted;
+}
+
+double mbPerSecond(bsl::size_t numBytes, double seconds)
+    // Return the throughput, in megabytes per second, of processing the
+    // specified 'numBytes' in the specified 'seconds'.
+{
+    return static_cast<double>(numBytes) / seconds / 1.0e6;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+    (void)veryVeryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Buffer
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a binary attachment that we want to embed, in its Base64
+// representation, into a text document, and later recover.
+//
+// First, we prepare the attachment:
+//..
+    const char attachment[] = "\x01\x02\x03Hello, world!\xff";
+    const bsl::size_t attachmentLength = sizeof attachment - 1;
+//..
+// Then, we size a buffer for the encoding, suppressing line breaks, and
+// encode the attachment:
+//..
+    bsl::string encoded;
+    encoded.resize(bdlde::Base64Util::encodedLength(attachmentLength, 0));
+
+    bsl::size_t numOut = bdlde::Base64Util::encode(&encoded[0],
+                                                   attachment,
+                                                   attachmentLength,
+                                                   0);
+    ASSERT(encoded.length() == numOut);
+    ASSERT("AQIDSGVsbG8sIHdvcmxkIf8=" == encoded);
+//..
+// Next, we size a buffer large enough for the decoded result and decode the
+// Base64 text:
+//..
+    bsl::vector<char> decoded(
+                     bdlde::Base64Util::maxDecodedLength(encoded.length()));
+
+    int rc = bdlde::Base64Util::decode(decoded.data(),
+                                       &numOut,
+                                       encoded.data(),
+                                       encoded.length());
+    ASSERT(0 == rc);
+//..
+// Finally, we trim the decoded buffer to the number of bytes actually written
+// and verify that we recovered the original attachment:
+//..
+    decoded.resize(numOut);
+    ASSERT(attachmentLength == decoded.size());
+    ASSERT(0 == bsl::memcmp(attachment, decoded.data(), attachmentLength));
+//..
+// Note that input that is not a complete Base64 encoding is rejected:
+//..
+    rc = bdlde::Base64Util::decode(decoded.data(), &numOut, "QUJD!", 5);
+    ASSERT(0 != rc);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'decode'
+        //
+        // Concerns:
+        //: 1 'decode' and 'decodeScalar' accept exactly the inputs that a
+        //:   'Base64Decoder' (in the same error-reporting mode) accepts when
+        //:   supplied the entire input followed by 'endConvert', and then
+        //:   produce the same output.
+        //:
+        //: 2 Whitespace, line breaks, padding, and unrecognized characters
+        //:   are handled correctly wherever they occur, in particular within
+        //:   or immediately after runs long enough to be converted by the
+        //:   vectorized implementation.
+        //:
+        //: 3 No more than 'maxDecodedLength' bytes are written.
+        //
+        // Plan:
+        //: 1 Using a table of hand-picked inputs, exercising padding, unused
+        //:   bits, whitespace, and unrecognized characters, verify the result
+        //:   of 'decode' and compare it with the oracle.  (C-1)
+        //:
+        //: 2 Decode the encodings, for every line length in a set, of
+        //:   pseudo-random inputs of every length up to 300, at every
+        //:   alignment, and compare with the oracle.  (C-1, 3)
+        //:
+        //: 3 For a set of valid encodings, substitute every one of the 256
+        //:   possible characters at every position, and separately insert
+        //:   each of a set of characters at every position, and compare with
+        //:   the oracle.  (C-1..3)
+        //
+        // Testing:
+        //   int decode(char *, size_t *, const char *, size_t, bool);
+        //   int Base64Util_Impl::decodeScalar(...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'decode'"
+                          << "\n================" << endl;
+
+        if (verbose) cout << "\tHand-picked inputs." << endl;
+        {
+            static const struct {
+                int         d_line;     // source line number
+                const char *d_input;    // input
+                int         d_strictRc; // 0 if accepted in strict mode
+                int         d_laxRc;    // 0 if accepted in relaxed mode
+                const char *d_output;   // output, if accepted
+            } DATA[] = {
+                //LN  INPUT                     STRICT  LAX  OUTPUT
+                //--  -----------------------   ------  ---  --------
+                { L_, "",                            0,   0, ""          },
+                { L_, "Zg==",                        0,   0, "f"         },
+                { L_, "Zm8=",                        0,   0, "fo"        },
+                { L_, "Zm9v",                        0,   0, "foo"       },
+                { L_, "Zm9vYg==",                    0,   0, "foob"      },
+                { L_, "Zm9vYmE=",                    0,   0, "fooba"     },
+                { L_, "Zm9vYmFy",                    0,   0, "foobar"    },
+                { L_, " Zm9v\r\nYmFy\t",             0,   0, "foobar"    },
+                { L_, "Zm9vYg= =",                   0,   0, "foob"      },
+                { L_, "Zm9vYg==  \r\n",              0,   0, "foob"      },
+                { L_, "Zm9vYmE= ",                   0,   0, "fooba"     },
+                { L_, "Zm9vYg=",                    -1,  -1, ""          },
+                { L_, "Zm9vYg",                     -1,  -1, ""          },
+                { L_, "Zm9vY",                      -1,  -1, ""          },
+                { L_, "Zm9vYh==",                   -1,  -1, ""          },
+                { L_, "Zm9vYmF=",                   -1,  -1, ""          },
+                { L_, "Zm9v====",                   -1,  -1, ""          },
+                { L_, "Zm9vY===",                   -1,  -1, ""          },
+                { L_, "Zm9vYg===",                  -1,  -1, ""          },
+                { L_, "Zm9vYg==Zm9v",               -1,  -1, ""          },
+                { L_, "Zm9vYmE=Zg==",               -1,  -1, ""          },
+                { L_, "=",                          -1,  -1, ""          },
+                { L_, "Zm9v!YmFy",                  -1,   0, "foobar"    },
+                { L_, "Zm9vYg==!",                  -1,   0, "foob"      },
+                { L_, "Zm9vYg=!=",                  -1,   0, "foob"      },
+                { L_, "Zm9-_vYmFy",                 -1,   0, "foobar"    },
+                { L_, "Zm9v\x80YmFy",               -1,   0, "foobar"    },
+                { L_, "Zm9\0vYmFy",                 -1,   0, "foobar"    },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE   = DATA[ti].d_line;
+                const char *const  INPUT  = DATA[ti].d_input;
+                const bsl::size_t  LENGTH = LINE == DATA[NUM_DATA - 1].d_line
+                                            ? 9
+                                            : bsl::strlen(INPUT);
+
+                for (int mode = 0; mode < 2; ++mode) {
+                    const bool STRICT = 0 == mode;
+                    const int  EXP_RC = STRICT ? DATA[ti].d_strictRc
+                                               : DATA[ti].d_laxRc;
+
+                    char        buffer[64];
+                    bsl::size_t numOut = 0;
+
+                    const int rc = Util::decode(buffer,
+                                                &numOut,
+                                                INPUT,
+                                                LENGTH,
+                                                STRICT);
+
+                    if (veryVerbose) { P_(LINE) P_(STRICT) P(rc) }
+
+                    ASSERTV(LINE, STRICT, rc, (0 == rc) == (0 == EXP_RC));
+                    if (0 == rc && 0 == EXP_RC) {
+                        ASSERTV(LINE, STRICT,
+                                bsl::string(DATA[ti].d_output) ==
+                                                 bsl::string(buffer, numOut));
+                    }
+                }
+
+                verifyDecode(LINE, INPUT, LENGTH);
+            }
+        }
+
+        if (verbose) cout << "\tRound trip of all lengths." << endl;
+        {
+            char input[300 + 32];
+            fillRandom(input, sizeof input);
+
+            for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+                const int MLL = LINE_LENGTHS[li];
+
+                for (bsl::size_t length = 0; length <= 300; ++length) {
+                    const bsl::string ENCODED = oracleEncode(input,
+                                                             length,
+                                                             MLL);
+
+                    // Decode from every alignment.
+
+                    for (int offset = 0; offset < 32; offset += 7) {
+                        bsl::vector<char> buffer(offset + ENCODED.length());
+                        bsl::memcpy(buffer.data() + offset,
+                                    ENCODED.data(),
+                                    ENCODED.length());
+
+                        const int numAccepted = verifyDecode(
+                                                      L_,
+                                                      buffer.data() + offset,
+                                                      ENCODED.length());
+                        ASSERTV(MLL, length, offset, 2 == numAccepted);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tSubstituted and inserted characters." << endl;
+        {
+            static const bsl::size_t LENGTHS[] = { 1, 2, 3, 40, 59, 100 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            static const char INSERTED[] = { ' ', '\r', '\n', '=', '!', '\0',
+                                             '\x7f', '\x80', '\xff', 'A',
+                                             '/' };
+            const int NUM_INSERTED = sizeof INSERTED / sizeof *INSERTED;
+
+            char input[100];
+            fillRandom(input, sizeof input);
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                for (int mi = 0; mi < 2; ++mi) {
+                    const int MLL = 0 == mi ? 0 : 76;
+
+                    const bsl::string ENCODED = oracleEncode(input,
+                                                             LENGTHS[li],
+                                                             MLL);
+
+                    for (bsl::size_t pos = 0; pos < ENCODED.length(); ++pos) {
+                        bsl::string mX(ENCODED);
+
+                        for (int c = 0; c < 256; ++c) {
+                            mX[pos] = static_cast<char>(c);
+                            verifyDecode(L_, mX.data(), mX.length());
+                        }
+                    }
+
+                    for (bsl::size_t pos = 0; pos <= ENCODED.length(); ++pos) {
+                        for (int ci = 0; ci < NUM_INSERTED; ++ci) {
+                            bsl::string mX(ENCODED);
+                            mX.insert(pos, 1, INSERTED[ci]);
+                            verifyDecode(L_, mX.data(), mX.length());
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tCorruption of a large input." << endl;
+        {
+            bsl::vector<char> input(6000);
+            fillRandom(input.data(), input.size());
+
+            const bsl::string ENCODED = oracleEncode(input.data(),
+                                                     input.size(),
+                                                     0);
+
+            for (int i = 0; i < 300; ++i) {
+                bsl::string mX(ENCODED);
+                mX[randUnsigned() % mX.length()] = static_cast<char>(
+                                                              randUnsigned());
+                verifyDecode(L_, mX.data(), mX.length());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'encode'
+        //
+        // Concerns:
+        //: 1 'encode' and 'encodeScalar' write the same characters as a
+        //:   'Base64Encoder' configured with the same 'maxLineLength' and
+        //:   supplied the entire input, for every input length (including
+        //:   those for which the vectorized implementation converts some, but
+        //:   not all, of the input) and every line length.
+        //:
+        //: 2 Exactly 'encodedLength' characters are written, and the input is
+        //:   not required to be aligned.
+        //:
+        //: 3 Every byte value is encoded correctly.
+        //
+        // Plan:
+        //: 1 For every line length in a set, and every input length up to
+        //:   300, encode pseudo-random input at several alignments, compare
+        //:   with the oracle, and verify that a guard byte following the
+        //:   output is intact.  (C-1..2)
+        //:
+        //: 2 Encode buffers containing every byte value in every position of
+        //:   a 3-byte group, and some large buffers.  (C-1, 3)
+        //
+        // Testing:
+        //   bsl::size_t encode(char *, const char *, bsl::size_t, int mll);
+        //   bsl::size_t Base64Util_Impl::encodeScalar(...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'encode'"
+                          << "\n================" << endl;
+
+        if (verbose) cout << "\tAll lengths and line lengths." << endl;
+        {
+            char input[300 + 32];
+            fillRandom(input, sizeof input);
+
+            for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+                const int MLL = LINE_LENGTHS[li];
+
+                if (veryVerbose) { P(MLL) }
+
+                for (bsl::size_t length = 0; length <= 300; ++length) {
+                    for (int offset = 0; offset < 32; offset += 5) {
+                        verifyEncode(L_, input + offset, length, MLL);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tEvery byte value." << endl;
+        {
+            char input[3 * 256];
+
+            for (int shift = 0; shift < 3; ++shift) {
+                for (int i = 0; i < 3 * 256; ++i) {
+                    input[i] = static_cast<char>(i / 3 + (i % 3 == shift)
+                                                         * 0x55);
+                }
+                verifyEncode(L_, input, sizeof input, 0);
+                verifyEncode(L_, input, sizeof input, 76);
+            }
+        }
+
+        if (verbose) cout << "\tLarge inputs." << endl;
+        {
+            bsl::vector<char> input(100000);
+            fillRandom(input.data(), input.size());
+
+            for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+                verifyEncode(L_, input.data(), input.size(), LINE_LENGTHS[li]);
+                verifyEncode(L_,
+                             input.data() + 1,
+                             input.size() - 2,
+                             LINE_LENGTHS[li]);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'encodedLength' AND 'maxDecodedLength'
+        //
+        // Concerns:
+        //: 1 'encodedLength' returns the same value as
+        //:   'Base64Encoder::encodedLength' for every input length and line
+        //:   length.
+        //:
+        //: 2 'maxDecodedLength' returns the same value as
+        //:   'Base64Decoder::maxDecodedLength'.
+        //:
+        //: 3 Both functions handle lengths not representable as 'int'.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Compare the functions with the corresponding functions of the
+        //:   mechanisms for all lengths in a range.  (C-1..2)
+        //:
+        //: 2 Verify the results for a large length by hand.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for negative line lengths.  (C-4)
+        //
+        // Testing:
+        //   bsl::size_t encodedLength(bsl::size_t inputLength, int mll);
+        //   bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'encodedLength' AND 'maxDecodedLength'"
+                          << "\n=============================================="
+                          << endl;
+
+        for (int length = 0; length <= 1000; ++length) {
+            ASSERTV(length,
+                    static_cast<bsl::size_t>(
+                           bdlde::Base64Encoder::encodedLength(length)) ==
+                                                 Util::encodedLength(length));
+
+            for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+                const int MLL = LINE_LENGTHS[li];
+
+                ASSERTV(length, MLL,
+                        static_cast<bsl::size_t>(
+                           bdlde::Base64Encoder::encodedLength(length, MLL)) ==
+                                            Util::encodedLength(length, MLL));
+            }
+
+            ASSERTV(length,
+                    static_cast<bsl::size_t>(
+                        bdlde::Base64Decoder::maxDecodedLength(length)) ==
+                                              Util::maxDecodedLength(length));
+        }
+
+        {
+            const bsl::size_t LENGTH = 3ULL << 32;  // 4 * 2^32 chars encoded
+
+            ASSERT((4ULL << 32) == Util::encodedLength(LENGTH, 0));
+            ASSERT((4ULL << 32) + 2 * (((4ULL << 32) - 1) / 64) ==
+                                            Util::encodedLength(LENGTH, 64));
+            ASSERT((3ULL << 32) == Util::maxDecodedLength(4ULL << 32));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::encodedLength(1, 0));
+            ASSERT_FAIL(Util::encodedLength(1, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode and decode the test vectors of RFC 4648, and a buffer
+        //:   long enough for the vectorized implementation, with and without
+        //:   line breaks.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_input;    // input
+            const char *d_encoded;  // expected encoding
+        } DATA[] = {
+            //LINE  INPUT      ENCODED
+            //----  --------   ----------
+            { L_,   "",        ""         },
+            { L_,   "f",       "Zg=="     },
+            { L_,   "fo",      "Zm8="     },
+            { L_,   "foo",     "Zm9v"     },
+            { L_,   "foob",    "Zm9vYg==" },
+            { L_,   "fooba",   "Zm9vYmE=" },
+            { L_,   "foobar",  "Zm9vYmFy" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const bsl::string INPUT   = DATA[ti].d_input;
+            const bsl::string ENCODED = DATA[ti].d_encoded;
+
+            char        buffer[16];
+            bsl::size_t numOut = Util::encode(buffer,
+                                              INPUT.data(),
+                                              INPUT.length());
+
+            ASSERTV(LINE, ENCODED == bsl::string(buffer, numOut));
+
+            ASSERTV(LINE, 0 == Util::decode(buffer,
+                                            &numOut,
+                                            ENCODED.data(),
+                                            ENCODED.length()));
+            ASSERTV(LINE, INPUT == bsl::string(buffer, numOut));
+        }
+
+        const bsl::string TEXT(
+            "Man is distinguished, not only by his reason, but by this "
+            "singular passion from other animals, which is a lust of the "
+            "mind.");
+        const bsl::string ENCODED(
+            "TWFuIGlzIGRpc3Rpbmd1aXNoZWQsIG5vdCBvbmx5IGJ5IGhpcyByZWFzb24sIGJ1"
+            "dCBieSB0aGlz\r\n"
+            "IHNpbmd1bGFyIHBhc3Npb24gZnJvbSBvdGhlciBhbmltYWxzLCB3aGljaCBpcyBh"
+            "IGx1c3Qgb2Yg\r\n"
+            "dGhlIG1pbmQu");
+
+        bsl::string encoded(Util::encodedLength(TEXT.length()), '\0');
+        ASSERT(ENCODED.length() == encoded.length());
+        ASSERT(encoded.length() == Util::encode(&encoded[0],
+                                                TEXT.data(),
+                                                TEXT.length()));
+        ASSERTV(encoded, ENCODED == encoded);
+
+        bsl::string decoded(Util::maxDecodedLength(ENCODED.length()), '\0');
+        bsl::size_t numOut = 0;
+        ASSERT(0 == Util::decode(&decoded[0],
+                                 &numOut,
+                                 ENCODED.data(),
+                                 ENCODED.length()));
+        decoded.resize(numOut);
+        ASSERTV(decoded, TEXT == decoded);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT COMPARED TO MECHANISMS
+        //
+        // Concerns:
+        //: 1 'encode' and 'decode' are substantially faster than the
+        //:   'Base64Encoder' and 'Base64Decoder' mechanisms, and than the
+        //:   scalar implementations, for large buffers.
+        //
+        // Plan:
+        //: 1 For buffers of several sizes, with and without line breaks,
+        //:   measure and report the throughput (in megabytes of unencoded
+        //:   data per second) of the mechanisms, the scalar implementations,
+        //:   and the dispatching functions.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: THROUGHPUT COMPARED TO MECHANISMS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: THROUGHPUT COMPARED TO MECHANISMS"
+                          << "\n=============================================="
+                          << endl;
+
+        static const bsl::size_t SIZES[] = { 1024, 64 * 1024, 1024 * 1024 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const bsl::size_t TOTAL = 256 * 1024 * 1024;  // bytes per measurement
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            for (int mi = 0; mi < 2; ++mi) {
+                const bsl::size_t SIZE = SIZES[si];
+                const int         MLL  = 0 == mi ? 0 : 76;
+                const int         REPS = static_cast<int>(TOTAL / SIZE / 8);
+
+                bsl::vector<char> input(SIZE);
+                fillRandom(input.data(), SIZE);
+
+                bsl::string       encoded(Util::encodedLength(SIZE, MLL), 0);
+                bsl::vector<char> decoded(Util::maxDecodedLength(
+                                                            encoded.size()));
+                bsl::size_t       numOut = 0;
+
+                bsls::Stopwatch timer;
+
+                timer.start(); {
+                    for (int i = 0; i < REPS; ++i) {
+                        bdlde::Base64Encoder encoder(MLL);
+                        char *out = &encoded[0];
+                        int   numOutInt;
+                        int   numIn;
+                        encoder.convert(out,
+                                        &numOutInt,
+                                        &numIn,
+                                        input.begin(),
+                                        input.end());
+                        encoder.endConvert(out + numOutInt, &numOutInt);
+                    }
+                } timer.stop();
+                const double encoderMbps = mbPerSecond(SIZE * REPS,
+                                                       timer.elapsedTime());
+
+                timer.reset();
+                timer.start(); {
+                    for (int i = 0; i < REPS; ++i) {
+                        Impl::encodeScalar(&encoded[0],
+                                           input.data(),
+                                           SIZE,
+                                           MLL);
+                    }
+                } timer.stop();
+                const double scalarEncodeMbps = mbPerSecond(
+                                                         SIZE * REPS,
+                                                         timer.elapsedTime());
+
+                timer.reset();
+                timer.start(); {
+                    for (int i = 0; i < REPS; ++i) {
+                        Util::encode(&encoded[0], input.data(), SIZE, MLL);
+                    }
+                } timer.stop();
+                const double encodeMbps = mbPerSecond(SIZE * REPS,
+                                                      timer.elapsedTime());
+
+                timer.reset();
+                timer.start(); {
+                    for (int i = 0; i < REPS; ++i) {
+                        bdlde::Base64Decoder decoder(true);
+                        char *out = decoded.data();
+                        int   numOutInt;
+                        int   numIn;
+                        decoder.convert(out,
+                                        &numOutInt,
+                                        &numIn,
+                                        encoded.begin(),
+                                        encoded.end());
+                        decoder.endConvert(out + numOutInt, &numOutInt);
+                    }
+                } timer.stop();
+                const double decoderMbps = mbPerSecond(SIZE * REPS,
+                                                       timer.elapsedTime());
+
+                timer.reset();
+                timer.start(); {
+                    for (int i = 0; i < REPS; ++i) {
+                        Impl::decodeScalar(decoded.data(),
+                                           &numOut,
+                                           encoded.data(),
+                                           encoded.size(),
+                                           true);
+                    }
+                } timer.stop();
+                const double scalarDecodeMbps = mbPerSecond(
+                                                         SIZE * REPS,
+                                                         timer.elapsedTime());
+
+                timer.reset();
+                timer.start(); {
+                    for (int i = 0; i < REPS; ++i) {
+                        Util::decode(decoded.data(),
+                                     &numOut,
+                                     encoded.data(),
+                                     encoded.size());
+                    }
+                } timer.stop();
+                const double decodeMbps = mbPerSecond(SIZE * REPS,
+                                                      timer.elapsedTime());
+
+                ASSERT(SIZE == numOut);
+                ASSERT(0 == bsl::memcmp(input.data(), decoded.data(), SIZE));
+
+                cout << "size: " << SIZE << ", maxLineLength: " << MLL
+                     << "\n  encode (MB/s): Base64Encoder " << encoderMbps
+                     << ", scalar " << scalarEncodeMbps
+                     << ", Base64Util " << encodeMbps
+                     << "\n  decode (MB/s): Base64Decoder " << decoderMbps
+                     << ", scalar " << scalarDecodeMbps
+                     << ", Base64Util " << decodeMbps << endl;
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -33,6 +33,17 @@ BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 #include <cpuid.h>
 #endif
 
+#if defined(LIKE_X86_GCC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+
+#define BDLDE_CRC32C_TARGET_PCLMUL __attribute__((target("sse4.2,pclmul")))
+    // Compile the function so annotated for a processor supporting the SSE4.2
+    // and PCLMULQDQ instructions regardless of the target of the translation
+    // unit.  Such functions are invoked only after a runtime check for these
+    // instructions.
+#endif
+
 // #define BDLDE_SUPPORT_SPARC_HARDWARE_OPTIMIZATION
     // The Sparc hardware optimization is implemented in a third-party library
     // provided by Oracle.  For the time being we remove optimized crc32
@@ -687,6 +698,11 @@ class Crc32cCalculator {
     static Crc32cFn s_crc32cFn;
         // A global CRC32-C calculator function to compute CRC32-C checksum.
 
+    static Crc32cFn s_crc32cParallelFn;
+        // A global CRC32-C calculator function to compute CRC32-C checksum
+        // using interleaved streams combined by carry-less multiplication if
+        // supported, and 's_crc32cFn' otherwise.
+
     // CREATORS
     Crc32cCalculator();
         // Create an instance of this class.
@@ -706,6 +722,15 @@ class Crc32cCalculator {
         // Invoke the global function that calculates CRC3-C passing to this
         // function the specified 'data', 'length' and 'crc' parameters.  Note
         // that if 'data' is 0, then 'length' must also be 0.
+
+    unsigned int parallel(const unsigned char *data,
+                          bsl::size_t          length,
+                          unsigned int         crc) const;
+        // Invoke the global function that calculates CRC32-C using interleaved
+        // streams combined by carry-less multiplication (or, if unsupported,
+        // the function invoked by 'operator()') passing to this function the
+        // specified 'data', 'length' and 'crc' parameters.  Note that if
+        // 'data' is 0, then 'length' must also be 0.
 };
 
 inline
@@ -1154,6 +1179,148 @@ unsigned int crc32cSse64bit(const unsigned char *data,
     return ~crc;
 }
 
+const bsl::size_t k_PCLMUL_LONG_STREAM = 8192;
+    // Length, in bytes, of each of the three streams of a long block processed
+    // by 'crc32cSsePclmul'.
+
+const bsl::size_t k_PCLMUL_SHORT_STREAM = 256;
+    // Length, in bytes, of each of the three streams of a short block
+    // processed by 'crc32cSsePclmul'.
+
+const bsls::Types::Uint64 k_PCLMUL_LONG_SHIFT  = 0x54A86326;
+const bsls::Types::Uint64 k_PCLMUL_SHORT_SHIFT = 0xB9E02B86;
+    // The bit-reflected values of 'x^(8 * n - 33) mod P', where 'P' is the
+    // CRC32-C polynomial and 'n' is 'k_PCLMUL_LONG_STREAM' and
+    // 'k_PCLMUL_SHORT_STREAM', respectively.  See 'crc32cShift'.
+
+BDLDE_CRC32C_TARGET_PCLMUL
+inline
+unsigned int crc32cShift(unsigned int crc, bsls::Types::Uint64 constant)
+    // Return the CRC32-C state resulting from extending the message having the
+    // specified CRC32-C state 'crc' (without the initial and final inversion)
+    // with 'n' zero bytes, where the specified 'constant' is the bit-reflected
+    // value of 'x^(8 * n - 33) mod P'.  Note that the carry-less product of
+    // two bit-reflected values is the reflected product multiplied by 'x', and
+    // that the 'crc32' instruction applied to a 64-bit value 'v' with a zero
+    // state computes 'v * x^32 mod P', so that the result is
+    // 'crc * x^(8 * n) mod P' as required.
+{
+    const __m128i lhs     = _mm_cvtsi32_si128(static_cast<int>(crc));
+    const __m128i rhs     = _mm_cvtsi64_si128(
+                                          static_cast<long long>(constant));
+    const __m128i product = _mm_clmulepi64_si128(lhs, rhs, 0);
+
+    const bsls::Types::Uint64 folded = static_cast<bsls::Types::Uint64>(
+                                                  _mm_cvtsi128_si64(product));
+
+    return static_cast<unsigned int>(_mm_crc32_u64(0, folded));
+}
+
+BDLDE_CRC32C_TARGET_PCLMUL
+inline
+unsigned int crc32cThreeStreams(const unsigned char *data,
+                                bsl::size_t          streamLength,
+                                bsls::Types::Uint64  shiftConstant,
+                                unsigned int         crc)
+    // Return the CRC32-C state resulting from extending the specified 'crc'
+    // state (without the initial and final inversion) with the '3 *
+    // streamLength' bytes at the specified 'data', computed as three
+    // interleaved streams of the specified 'streamLength' bytes each that are
+    // then combined using the specified 'shiftConstant' (see 'crc32cShift').
+    // The behavior is undefined unless 'data' is aligned on an 8-byte
+    // boundary, 'streamLength' is a positive multiple of 8, and
+    // 'shiftConstant' corresponds to 'streamLength'.
+{
+    const bsl::size_t          numWords = streamLength / 8;
+    const bsls::Types::Uint64 *word     =
+                           reinterpret_cast<const bsls::Types::Uint64 *>(data);
+    const bsls::Types::Uint64 *end      = word + numWords;
+
+    bsls::Types::Uint64 crc0 = crc;
+    bsls::Types::Uint64 crc1 = 0;
+    bsls::Types::Uint64 crc2 = 0;
+
+    // The three 'crc32' instructions are independent, which hides their
+    // latency.
+
+    do {
+        crc0 = _mm_crc32_u64(crc0, word[0]);
+        crc1 = _mm_crc32_u64(crc1, word[numWords]);
+        crc2 = _mm_crc32_u64(crc2, word[2 * numWords]);
+    } while (++word < end);
+
+    // 'crc(A || B) == shift(crc(A), length(B)) ^ crc(B)' for 'crc(B)' computed
+    // from a zero state.
+
+    unsigned int result = crc32cShift(static_cast<unsigned int>(crc0),
+                                      shiftConstant)
+                        ^ static_cast<unsigned int>(crc1);
+    return crc32cShift(result, shiftConstant)
+         ^ static_cast<unsigned int>(crc2);
+}
+
+BDLDE_CRC32C_TARGET_PCLMUL
+unsigned int crc32cSsePclmul(const unsigned char *data,
+                             bsl::size_t          length,
+                             unsigned int         crc)
+    // Calculate the CRC32-C value (using SSE4.2 and PCLMULQDQ intrinsics) for
+    // the specified 'data' over the specified 'length' number of bytes, using
+    // the specified 'crc' value as the starting point for the calculation.
+    // Blocks of data are processed as three interleaved streams whose CRC32-C
+    // values are combined using carry-less multiplication, long blocks first,
+    // then short blocks, and the remaining bytes serially.  The behavior is
+    // undefined unless the SSE4.2 and PCLMULQDQ instructions are supported.
+    // Note that the 'data' is permitted to be null if the 'length' is 0.
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    bsls::Types::Uint64 state = ~crc;
+
+    // Process bytes one at a time until we reach an 8-byte boundary (or until
+    // we reach the end of the buffer, whichever is sooner).
+
+    while (length && (reinterpret_cast<bsls::Types::UintPtr>(data) & 7)) {
+        state = _mm_crc32_u8(static_cast<unsigned int>(state), *data++);
+        --length;
+    }
+
+    unsigned int crc32 = static_cast<unsigned int>(state);
+
+    while (length >= 3 * k_PCLMUL_LONG_STREAM) {
+        crc32   = crc32cThreeStreams(data,
+                                     k_PCLMUL_LONG_STREAM,
+                                     k_PCLMUL_LONG_SHIFT,
+                                     crc32);
+        data   += 3 * k_PCLMUL_LONG_STREAM;
+        length -= 3 * k_PCLMUL_LONG_STREAM;
+    }
+
+    while (length >= 3 * k_PCLMUL_SHORT_STREAM) {
+        crc32   = crc32cThreeStreams(data,
+                                     k_PCLMUL_SHORT_STREAM,
+                                     k_PCLMUL_SHORT_SHIFT,
+                                     crc32);
+        data   += 3 * k_PCLMUL_SHORT_STREAM;
+        length -= 3 * k_PCLMUL_SHORT_STREAM;
+    }
+
+    // Process the remaining 8-byte words, then the remaining bytes.
+
+    state = crc32;
+    for (; length >= 8; data += 8, length -= 8) {
+        state = _mm_crc32_u64(
+                         state,
+                         *reinterpret_cast<const bsls::Types::Uint64 *>(data));
+    }
+
+    crc32 = static_cast<unsigned int>(state);
+    for (; length; --length) {
+        crc32 = _mm_crc32_u8(crc32, *data++);
+    }
+
+    return ~crc32;
+}
+
 #  endif // BSLS_PLATFORM_CPU_64_BIT
 
 unsigned int crc32cHardwareSerial(const unsigned char *data,
@@ -1211,14 +1378,18 @@ unsigned int crc32cHardwareSerial(const unsigned char *data,
 
 Crc32cCalculator::Crc32cFn Crc32cCalculator::s_crc32cFn = 0;
 
+Crc32cCalculator::Crc32cFn Crc32cCalculator::s_crc32cParallelFn = 0;
+
 Crc32cCalculator::Crc32cCalculator()
 {
 #if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
 
 #if defined(BSLS_PLATFORM_CMP_CLANG)
 #    define BDLDE_SSE4_2 bit_SSE42
+#    define BDLDE_PCLMUL bit_PCLMULQDQ
 #elif defined(BSLS_PLATFORM_CMP_GNU)
 #    define BDLDE_SSE4_2 bit_SSE4_2
+#    define BDLDE_PCLMUL bit_PCLMUL
 #endif
 
 #ifdef BDLDE_SSE4_2
@@ -1228,9 +1399,17 @@ Crc32cCalculator::Crc32cCalculator()
     if (ecx & BDLDE_SSE4_2) { // SSE 4.2 Support for CRC32-C
 
 #ifdef BSLS_PLATFORM_CPU_64_BIT
-        BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
-                      "(SSE4.2 instructions available, 64-bit mode)");
-        s_crc32cFn = crc32cSse64bit;
+        if (ecx & BDLDE_PCLMUL) { // Carry-less multiplication
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 and PCLMULQDQ instructions available, "
+                          "64-bit mode)");
+            s_crc32cFn = crc32cSsePclmul;
+        }
+        else {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 instructions available, 64-bit mode)");
+            s_crc32cFn = crc32cSse64bit;
+        }
 
 #else
         BSLS_LOG_INFO("Using hardware version (serial) for CRC32-C "
@@ -1239,6 +1418,7 @@ Crc32cCalculator::Crc32cCalculator()
         s_crc32cFn = crc32cHardwareSerial;
 #endif  // BSLS_PLATFORM_CPU_64_BIT
 #undef BDLDE_SSE4_2
+#undef BDLDE_PCLMUL
     }
     else {
         BSLS_LOG_INFO("Using software version for CRC32-C computation "
@@ -1270,6 +1450,11 @@ Crc32cCalculator::Crc32cCalculator()
                   "(neither an x86 nor SPARC architecture)");
     s_crc32cFn = crc32cSoftware;
 #endif // BSLS_PLATFORM_CPU_X86 || BSLS_PLATFORM_CPU_X86_64
+
+    // The parallel implementation is the default one when available (see
+    // above); otherwise it falls back to the default one.
+
+    s_crc32cParallelFn = s_crc32cFn;
 }
 
 Crc32cCalculator& Crc32cCalculator::instance()
@@ -1291,6 +1476,15 @@ unsigned int Crc32cCalculator::operator()(const unsigned char *data,
     return s_crc32cFn(data, length, crc);
 }
 
+inline
+unsigned int Crc32cCalculator::parallel(const unsigned char *data,
+                                        bsl::size_t          length,
+                                        unsigned int         crc) const
+{
+    BSLS_ASSERT(data || 0 == length);
+    return s_crc32cParallelFn(data, length, crc);
+}
+
 }  // close unnamed namespace
 
 
@@ -1358,6 +1552,25 @@ unsigned int Crc32c_Impl::calculateHardwareSerial(const void   *data,
 #endif // BSLS_PLATFORM_CMP_GNU || BSLS_PLATFORM_CMP_CLANG
 }
 
+unsigned int Crc32c_Impl::calculateHardwareParallel(const void   *data,
+                                                    bsl::size_t   length,
+                                                    unsigned int  crc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(   (data || !length)
+                     && "If 'data' is 0, then 'length' also must be 0");
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(length == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return crc;                                                   // RETURN
+    }
+
+    Crc32cCalculator& calculator = Crc32cCalculator::instance();
+    return calculator.parallel(static_cast<const unsigned char *>(data),
+                               length,
+                               crc);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -35,7 +35,10 @@ BSLS_IDENT("$Id$")
 // on a supported architecture with a compatible compiler.  In addition,
 // runtime checks are performed to detect whether the running platform has the
 // required hardware support:
-//: o x86:   SSE4.2 instructions are required
+//: o x86:   SSE4.2 instructions are required; in 64-bit mode, if the
+//:   PCLMULQDQ (carry-less multiplication) instruction is also available, the
+//:   data is processed as three interleaved streams of 8-byte 'crc32'
+//:   instructions whose results are combined by carry-less multiplication
 //: o sparc: runtime check is detected by the 'is_sparc_crc32c_avail' system
 //:   call
 //
@@ -143,6 +146,22 @@ struct Crc32c_Impl {
         // fall back to the software version when running on unsupported
         // platforms.  Also note that if 'data' is 0, then 'length' must also
         // be 0.
+
+    static
+    unsigned int calculateHardwareParallel(
+                                    const void   *data,
+                                    bsl::size_t   length,
+                                    unsigned int  crc = Crc32c::k_NULL_CRC32C);
+        // Return the CRC32-C value calculated for the specified 'data' over
+        // the specified 'length' number of bytes, using the optionally
+        // specified 'crc' value as the starting point for the calculation.
+        // This utilizes a hardware-based implementation that computes three
+        // interleaved streams of 8-byte 'crc32' instructions and combines
+        // them using carry-less multiplication (PCLMULQDQ).  Note that this
+        // function will fall back to the implementation used by
+        // 'Crc32c::calculate' when running on platforms not supporting those
+        // instructions.  Also note that if 'data' is 0, then 'length' must
+        // also be 0.
 };
 
 }  // close package namespace
@@ -229,14 +229,20 @@ using namespace bsl;
 // [6] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
 // [2] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
 // [3] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
+// [7] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
+// [2] int Crc32c_Impl::calculateHardwareParallel(const void *, size_t, uint);
+// [3] int Crc32c_Impl::calculateHardwareParallel(const void *, size_t, uint);
+// [7] int Crc32c_Impl::calculateHardwareParallel(const void *, size_t, uint);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 7] CALCULATE CRC32-C ON LARGE BUFFERS
+// [ 8] USAGE EXAMPLE
 // [-1] DEFAULT PERFORMANCE TEST
 // [-2] SOFTWARE PERFORMANCE TEST
 // [-3] THROUGPUT DEFAULT & SOFTWARE BENCHMARK
 // [-4] DEFAULT & FOLLY PERFORMANCE TEST
 // [-5] PERFORMANCE TEST ON USER INPUT
+// [-6] THROUGHPUT ACROSS BUFFER SIZES BENCHMARK
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -697,6 +703,7 @@ void test2_calculateOnBuffer()
     //   bdlde::Crc32c::calculate(const void *, size_t, unsigned int);
     //   bdlde::Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
     //   bdlde::Crc32c_Impl::calculateHardwareSerial(const void *,size_t,uint);
+    //   Crc32c_Impl::calculateHardwareParallel(const void *, size_t, uint);
     // ------------------------------------------------------------------------
 {
     if (verbose) bsl::cout << bsl::endl
@@ -754,6 +761,9 @@ void test2_calculateOnBuffer()
         unsigned int crc32cHWSerial = Crc32c_Impl::calculateHardwareSerial(
                                                                        BUFFER,
                                                                        LENGTH);
+        // HW Parallel
+        unsigned int crc32cHWParallel =
+                       Crc32c_Impl::calculateHardwareParallel(BUFFER, LENGTH);
 
         // Verify correctness
         LOOP3_ASSERT(LINE, crc32cDefault,
@@ -762,6 +772,8 @@ void test2_calculateOnBuffer()
                            EXPECTED,       crc32cSoftware == EXPECTED);
         LOOP3_ASSERT(LINE, crc32cHWSerial,
                            EXPECTED,       crc32cHWSerial == EXPECTED);
+        LOOP3_ASSERT(LINE, crc32cHWParallel,
+                           EXPECTED,       crc32cHWParallel == EXPECTED);
 
         // Test edge case of non-null buffer and LENGTH = 0
 
@@ -774,9 +786,13 @@ void test2_calculateOnBuffer()
         // Hardware Serial
         crc32cHWSerial = Crc32c_Impl::calculateHardwareSerial(BUFFER, 0);
 
-        LOOP2_ASSERT(LINE, crc32cDefault,  crc32cDefault  == 0u);
-        LOOP2_ASSERT(LINE, crc32cSoftware, crc32cSoftware == 0u);
-        LOOP2_ASSERT(LINE, crc32cHWSerial, crc32cHWSerial == 0u);
+        // Hardware Parallel
+        crc32cHWParallel = Crc32c_Impl::calculateHardwareParallel(BUFFER, 0);
+
+        LOOP2_ASSERT(LINE, crc32cDefault,    crc32cDefault    == 0u);
+        LOOP2_ASSERT(LINE, crc32cSoftware,   crc32cSoftware   == 0u);
+        LOOP2_ASSERT(LINE, crc32cHWSerial,   crc32cHWSerial   == 0u);
+        LOOP2_ASSERT(LINE, crc32cHWParallel, crc32cHWParallel == 0u);
     }
 
     // P-2
@@ -854,6 +870,9 @@ void test2_calculateOnBuffer()
 
         ASSERT_PASS(0 == Crc32c_Impl::calculateHardwareSerial(0, VALID));
         ASSERT_FAIL(0 == Crc32c_Impl::calculateHardwareSerial(0, INVALID));
+
+        ASSERT_PASS(0 == Crc32c_Impl::calculateHardwareParallel(0, VALID));
+        ASSERT_FAIL(0 == Crc32c_Impl::calculateHardwareParallel(0, INVALID));
     }
 }
 
@@ -878,6 +897,7 @@ void test3_calculateOnMisalignedBuffer()
     //   bdlde::Crc32c::calculate(const void *, size_t, unsigned int);
     //   bdlde::Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
     //   bdlde::Crc32c_Impl::calculateHardwareSerial(const void *,size_t,uint);
+    //   Crc32c_Impl::calculateHardwareParallel(const void *, size_t, uint);
     // ------------------------------------------------------------------------
 {
     if (verbose) bsl::cout
@@ -980,6 +1000,11 @@ void test3_calculateOnMisalignedBuffer()
                            Crc32c_Impl::calculateHardwareSerial(allocPtr + i,
                                                                 LENGTH);
 
+            // Hardware Parallel
+            unsigned int crc32cHWParallel =
+                         Crc32c_Impl::calculateHardwareParallel(allocPtr + i,
+                                                                LENGTH);
+
             // Verify correctness
             LOOP3_ASSERT(LINE, crc32cDefault,
                                EXPECTED,       crc32cDefault  == EXPECTED);
@@ -987,6 +1012,8 @@ void test3_calculateOnMisalignedBuffer()
                                EXPECTED,       crc32cSoftware == EXPECTED);
             LOOP3_ASSERT(LINE, crc32cHWSerial,
                                EXPECTED,       crc32cHWSerial == EXPECTED);
+            LOOP3_ASSERT(LINE, crc32cHWParallel,
+                               EXPECTED,       crc32cHWParallel == EXPECTED);
         }
     }
 }
@@ -1315,6 +1342,143 @@ void test6_multithreadedCrc32cSoftware()
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
 
+void test7_calculateOnLargeBuffers()
+    // ------------------------------------------------------------------------
+    // CALCULATE CRC32-C ON LARGE BUFFERS
+    //
+    // Concerns:
+    //: 1 Calculating CRC32-C on buffers large enough to be processed as
+    //:   interleaved streams yields the same result as the software
+    //:   implementation, for buffer lengths at and around the boundaries of
+    //:   the blocks processed by each stream.
+    //:
+    //: 2 The result does not depend on the alignment of the buffer.
+    //:
+    //: 3 The result of calculating CRC32-C on a buffer in two parts, using the
+    //:   CRC32-C of the first part as the previous CRC32-C for the second,
+    //:   is the same as that of calculating it on the whole buffer.
+    //
+    // Plan:
+    //: 1 Fill a buffer with pseudo-random bytes and, for a table of lengths
+    //:   around multiples of 768 (three streams of 256 bytes) and 24576
+    //:   (three streams of 8192 bytes), and for each offset '0 <= i < 8' from
+    //:   an 8-byte boundary, verify that the default, hardware serial, and
+    //:   hardware parallel implementations yield the result of the software
+    //:   implementation.  (C-1..2)
+    //:
+    //: 2 For each length in P-1, split the buffer at several points and
+    //:   verify that calculating CRC32-C on the second part using the result
+    //:   for the first part as the previous CRC32-C yields the result for the
+    //:   whole buffer.  (C-3)
+    //
+    // Testing:
+    //   bdlde::Crc32c::calculate(const void *, size_t, unsigned int);
+    //   bdlde::Crc32c_Impl::calculateHardwareSerial(const void *,size_t,uint);
+    //   Crc32c_Impl::calculateHardwareParallel(const void *, size_t, uint);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout
+                         << bsl::endl
+                         << "CALCULATE CRC32-C ON LARGE BUFFERS" << bsl::endl
+                         << "==================================" << bsl::endl;
+
+    const bsl::size_t k_SHORT_BLOCK = 3 * 256;
+    const bsl::size_t k_LONG_BLOCK  = 3 * 8192;
+
+    const bsl::size_t LENGTHS[] = {
+        k_SHORT_BLOCK - 8,
+        k_SHORT_BLOCK - 1,
+        k_SHORT_BLOCK,
+        k_SHORT_BLOCK + 1,
+        k_SHORT_BLOCK + 9,
+        2 * k_SHORT_BLOCK + 7,
+        k_LONG_BLOCK - k_SHORT_BLOCK,
+        k_LONG_BLOCK - 1,
+        k_LONG_BLOCK,
+        k_LONG_BLOCK + 1,
+        k_LONG_BLOCK + k_SHORT_BLOCK,
+        k_LONG_BLOCK + k_SHORT_BLOCK + 15,
+        2 * k_LONG_BLOCK - 1,
+        2 * k_LONG_BLOCK + 3 * k_SHORT_BLOCK + 13,
+        5 * k_LONG_BLOCK + 12345
+    };
+
+    const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+    const bsl::size_t k_MAX_SIZE  = LENGTHS[NUM_LENGTHS - 1] + 8;
+
+    bsl::vector<char> storage(k_MAX_SIZE + 8, pa);
+
+    // Find an 8-byte boundary within 'storage'.
+
+    char *buffer = storage.data();
+    buffer += bsls::AlignmentUtil::calculateAlignmentOffset(buffer, 8);
+
+    unsigned int seed = 12345;
+    for (bsl::size_t i = 0; i < k_MAX_SIZE; ++i) {
+        seed      = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+
+    for (bsl::size_t ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const bsl::size_t LENGTH = LENGTHS[ti];
+
+        if (veryVerbose) {
+            T_ P(LENGTH);
+        }
+
+        for (bsl::size_t offset = 0; offset < 8; ++offset) {
+            const char *DATA = buffer + offset;
+
+            const unsigned int EXPECTED = Crc32c_Impl::calculateSoftware(
+                                                                       DATA,
+                                                                       LENGTH);
+
+            const unsigned int crc32cDefault  = Crc32c::calculate(DATA,
+                                                                  LENGTH);
+            const unsigned int crc32cHWSerial =
+                               Crc32c_Impl::calculateHardwareSerial(DATA,
+                                                                    LENGTH);
+            const unsigned int crc32cHWParallel =
+                             Crc32c_Impl::calculateHardwareParallel(DATA,
+                                                                    LENGTH);
+
+            ASSERTV(LENGTH, offset, EXPECTED, crc32cDefault,
+                    EXPECTED == crc32cDefault);
+            ASSERTV(LENGTH, offset, EXPECTED, crc32cHWSerial,
+                    EXPECTED == crc32cHWSerial);
+            ASSERTV(LENGTH, offset, EXPECTED, crc32cHWParallel,
+                    EXPECTED == crc32cHWParallel);
+        }
+
+        const unsigned int EXPECTED = Crc32c_Impl::calculateSoftware(buffer,
+                                                                     LENGTH);
+
+        const bsl::size_t SPLITS[] = { 1, 7, 256, LENGTH / 2, LENGTH - 1 };
+        const bsl::size_t NUM_SPLITS = sizeof SPLITS / sizeof *SPLITS;
+
+        for (bsl::size_t si = 0; si < NUM_SPLITS; ++si) {
+            const bsl::size_t SPLIT = SPLITS[si];
+
+            const unsigned int crc32cDefault = Crc32c::calculate(
+                                            buffer + SPLIT,
+                                            LENGTH - SPLIT,
+                                            Crc32c::calculate(buffer, SPLIT));
+
+            const unsigned int crc32cHWParallel =
+                Crc32c_Impl::calculateHardwareParallel(
+                          buffer + SPLIT,
+                          LENGTH - SPLIT,
+                          Crc32c_Impl::calculateHardwareParallel(buffer,
+                                                                 SPLIT));
+
+            ASSERTV(LENGTH, SPLIT, EXPECTED, crc32cDefault,
+                    EXPECTED == crc32cDefault);
+            ASSERTV(LENGTH, SPLIT, EXPECTED, crc32cHWParallel,
+                    EXPECTED == crc32cHWParallel);
+        }
+    }
+}
+
 void testN1_performanceDefault()
     // ------------------------------------------------------------------------
     // PERFORMANCE: CALCULATE CRC32-C ON BUFFER DEFAULT
@@ -1831,6 +1995,108 @@ void testN5_performanceDefaultUserInput()
          << "\n\n";
 }
 
+void testN6_throughputAcrossBufferSizes()
+    // ------------------------------------------------------------------------
+    // BENCHMARK: THROUGHPUT ACROSS BUFFER SIZES
+    //
+    // Concerns:
+    //: 1 Report the throughput (bytes per second) of the software, hardware
+    //:   serial, default, and hardware parallel implementations of CRC32-C
+    //:   calculation for buffers of sizes ranging from a few bytes to tens of
+    //:   megabytes, in a single thread.
+    //
+    // Plan:
+    //: 1 For each buffer size, time a number of CRC32-C calculations
+    //:   (inversely proportional to the size, so that approximately the same
+    //:   number of bytes is processed for each size) using each
+    //:   implementation, and report the number of bytes processed per second
+    //:   by each.
+    //
+    // Testing:
+    //   BENCHMARK: THROUGHPUT ACROSS BUFFER SIZES
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout
+                 << bsl::endl
+                 << "BENCHMARK: THROUGHPUT ACROSS BUFFER SIZES" << bsl::endl
+                 << "=========================================" << bsl::endl;
+
+    const bsls::Types::Int64 k_BYTES_PER_SIZE = 1024 * 1024 * 1024; // 1 Gi
+    const bsls::Types::Int64 k_NS_PER_S       = 1000000000;
+
+    bsl::vector<int> bufferLengths(pa);
+    const int        k_MAX_SIZE = populateBufferLengthsSorted(&bufferLengths);
+
+    char *buffer = static_cast<char *>(pa->allocate(k_MAX_SIZE));
+    bsl::generate_n(buffer, k_MAX_SIZE, bsl::rand);
+
+    typedef unsigned int (*Crc32cFunction)(const void   *data,
+                                           bsl::size_t   length,
+                                           unsigned int  crc);
+
+    const struct {
+        const char     *d_name;
+        Crc32cFunction  d_function;
+    } IMPLS[] = {
+        { "Software(B/s)",    &Crc32c_Impl::calculateSoftware         },
+        { "HW Serial(B/s)",   &Crc32c_Impl::calculateHardwareSerial   },
+        { "Default(B/s)",     &Crc32c::calculate                      },
+        { "HW Parallel(B/s)", &Crc32c_Impl::calculateHardwareParallel }
+    };
+
+    const int NUM_IMPLS = static_cast<int>(sizeof IMPLS / sizeof *IMPLS);
+
+    bsl::ios_base::fmtflags flags = bsl::cout.flags();
+
+    bsl::cout << bsl::setw(10) << "Size(B)";
+    for (int impl = 0; impl < NUM_IMPLS; ++impl) {
+        bsl::cout << " |" << bsl::setw(18) << IMPLS[impl].d_name;
+    }
+    bsl::cout << '\n';
+
+    for (unsigned int i = 0; i < bufferLengths.size(); ++i) {
+        const int                length   = bufferLengths[i];
+        const bsls::Types::Int64 numIters = bsl::max<bsls::Types::Int64>(
+                                                 k_BYTES_PER_SIZE / length / 8,
+                                                 1);
+
+        bsl::cout << bsl::setw(10) << length;
+
+        unsigned int expected = Crc32c_Impl::calculateSoftware(buffer, length);
+
+        for (int impl = 0; impl < NUM_IMPLS; ++impl) {
+            const Crc32cFunction function = IMPLS[impl].d_function;
+
+            unsigned int crc = function(buffer, length, Crc32c::k_NULL_CRC32C);
+            ASSERTV(length, impl, expected, crc, expected == crc);
+
+            // <time>
+            bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            for (bsls::Types::Int64 k = 0; k < numIters; ++k) {
+                crc = function(buffer, length, crc);
+            }
+            bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            // </time>
+
+            static_cast<void>(crc);
+
+            const double bytesPerSecond =
+                  static_cast<double>(numIters) * static_cast<double>(length)
+                * static_cast<double>(k_NS_PER_S)
+                / static_cast<double>(bsl::max<bsls::Types::Int64>(elapsed,
+                                                                   1));
+
+            bsl::cout << " |" << bsl::setw(18) << bsl::fixed
+                      << bsl::setprecision(0) << bytesPerSecond;
+        }
+        bsl::cout << bsl::endl;
+    }
+
+    bsl::cout.flags(flags);
+
+    pa->deallocate(buffer);
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1864,7 +2130,7 @@ int main(int argc, char* argv[])
     bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_INFO);
 
     switch(test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -1907,6 +2173,9 @@ int main(int argc, char* argv[])
                                             checksum);
 //..
       } break;
+      case  7: {
+        test7_calculateOnLargeBuffers();
+      } break;
       case  6: {
         test6_multithreadedCrc32cSoftware();
       } break;
@@ -1940,6 +2209,9 @@ int main(int argc, char* argv[])
       case -5: {
         testN5_performanceDefaultUserInput();
       } break;
+      case -6: {
+        testN6_throughputAcrossBufferSizes();
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
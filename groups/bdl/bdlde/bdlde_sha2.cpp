@@ -1,10 +1,22 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_ostream.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_SHA2_SIMD
+    // Compile the SHA extensions and AVX2 implementations of the SHA-256
+    // block transformation, selected at runtime.
+
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -197,11 +209,11 @@ const bsl::uint64_t sha512Constants[80] =
              0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
 
 template<class INTEGER, bsl::size_t ARRAY_SIZE>
-void transform(INTEGER             *state,
-               const unsigned char *message,
-               bsl::uint64_t        numberOfBuffers,
-               bsl::uint64_t        bufferSize,
-               const INTEGER      (&constants)[ARRAY_SIZE])
+void portableTransform(INTEGER             *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numberOfBuffers,
+                       bsl::uint64_t        bufferSize,
+                       const INTEGER      (&constants)[ARRAY_SIZE])
     // Update the specified 'state' with the hashed contents of the specified
     // 'message' having a length equal to the specified 'bufferSize' times the
     // specified 'numberOfBuffers', mixing it with the values in the specified
@@ -247,6 +259,502 @@ void transform(INTEGER             *state,
     }
 }
 
+// First 32 bits of the fractional part of the square root of the first 8
+// primes.
+const bsl::uint32_t sha256InitialState[8] =
+            {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+typedef void (*Sha256Transform)(bsl::uint32_t       *state,
+                                const unsigned char *message,
+                                bsl::size_t          numBlocks);
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'numBlocks' 64-byte blocks at the specified 'message' according to the
+    // SHA-256 block transformation.
+
+void portableSha256Transform(bsl::uint32_t       *state,
+                             const unsigned char *message,
+                             bsl::size_t          numBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'numBlocks' 64-byte blocks at the specified 'message' using the portable
+    // implementation.
+{
+    portableTransform(state, message, numBlocks, 64, sha256Constants);
+}
+
+#if defined(BDLDE_SHA2_SIMD)
+
+#define BDLDE_SHA2_TARGET_SHA __attribute__((target("sha,sse4.1,ssse3")))
+    // Compile the function so annotated for a processor supporting the SHA
+    // extensions regardless of the target of the translation unit.  Such
+    // functions are invoked only after a runtime check for these instructions.
+
+#define BDLDE_SHA2_TARGET_AVX2 __attribute__((target("avx2")))
+    // Compile the function so annotated for a processor supporting AVX2
+    // regardless of the target of the translation unit.  Such functions are
+    // invoked only after a runtime check for these instructions.
+
+                        // -------------------------
+                        // SHA extensions (SHA-NI)
+                        // -------------------------
+
+// The 'sha256rnds2' instruction performs two rounds on a state held in two
+// registers, one holding the words A, B, E, and F, and the other holding C, D,
+// G, and H (in order of decreasing significance), taking the sum of message
+// and round constant words for the two rounds from the low half of a third
+// register.  Each group of four rounds therefore uses two 'sha256rnds2'
+// instructions, and the message schedule for the group four ahead is prepared
+// by 'sha256msg1' and 'sha256msg2'.
+
+BDLDE_SHA2_TARGET_SHA
+inline
+void shaNiLoadState(__m128i *abef, __m128i *cdgh, const bsl::uint32_t *state)
+    // Load into the specified 'abef' and 'cdgh' the specified 'state', held
+    // as the eight words 'A' to 'H', in the layout used by 'sha256rnds2'.
+{
+    const __m128i dcba = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(state));
+    const __m128i hgfe = _mm_loadu_si128(
+                               reinterpret_cast<const __m128i *>(state + 4));
+
+    const __m128i cdab = _mm_shuffle_epi32(dcba, 0xb1);
+    const __m128i efgh = _mm_shuffle_epi32(hgfe, 0x1b);
+
+    *abef = _mm_alignr_epi8(cdab, efgh, 8);
+    *cdgh = _mm_blend_epi16(efgh, cdab, 0xf0);
+}
+
+BDLDE_SHA2_TARGET_SHA
+inline
+void shaNiStoreState(bsl::uint32_t *state, __m128i abef, __m128i cdgh)
+    // Store into the specified 'state', as the eight words 'A' to 'H', the
+    // state held in the specified 'abef' and 'cdgh' in the layout used by
+    // 'sha256rnds2'.
+{
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1b);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+                     _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4),
+                     _mm_alignr_epi8(dchg, feba, 8));
+}
+
+BDLDE_SHA2_TARGET_SHA
+inline
+void shaNiRounds(__m128i             *abef,
+                 __m128i             *cdgh,
+                 __m128i             *schedule,
+                 int                  group,
+                 const unsigned char *block)
+    // Perform the four rounds of the specified 'group' (in the range
+    // '[0 .. 15]') of the SHA-256 transformation of the specified 64-byte
+    // 'block' on the state held in the specified 'abef' and 'cdgh', using and
+    // advancing the message schedule held in the specified 4-element
+    // 'schedule' array.  The behavior is undefined unless this function is
+    // called for each 'group' in increasing order for the same 'block'.
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                            0x0405060700010203ULL);
+
+    __m128i& current = schedule[group & 3];
+    if (group < 4) {
+        current = _mm_shuffle_epi8(
+                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                         block + 16 * group)),
+                         byteSwap);
+    }
+
+    __m128i words = _mm_add_epi32(
+                            current,
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                sha256Constants + 4 * group)));
+    *cdgh = _mm_sha256rnds2_epu32(*cdgh, *abef, words);
+
+    if (3 <= group && group < 15) {
+        // Complete the schedule for the next group, partially computed by
+        // 'sha256msg1' three groups ago.
+
+        __m128i& next = schedule[(group + 1) & 3];
+        next = _mm_add_epi32(next,
+                             _mm_alignr_epi8(current,
+                                             schedule[(group + 3) & 3],
+                                             4));
+        next = _mm_sha256msg2_epu32(next, current);
+    }
+
+    words = _mm_shuffle_epi32(words, 0x0e);
+    *abef = _mm_sha256rnds2_epu32(*abef, *cdgh, words);
+
+    if (1 <= group && group < 13) {
+        __m128i& previous = schedule[(group + 3) & 3];
+        previous = _mm_sha256msg1_epu32(previous, current);
+    }
+}
+
+template <int NUM_LANES, int GROUP = 0>
+struct ShaNiRounds {
+    // This 'struct' provides a namespace for a function performing the rounds
+    // of groups 'GROUP' to 15 of the SHA-256 transformation of a block in
+    // each of 'NUM_LANES' lanes, interleaving the lanes to hide the latency
+    // of 'sha256rnds2'.  The recursion unrolls the groups, so that the
+    // message schedule is held in registers.
+
+    // CLASS METHODS
+    BDLDE_SHA2_TARGET_SHA
+    static void run(__m128i                    *abef,
+                    __m128i                    *cdgh,
+                    __m128i                   (*schedule)[4],
+                    const unsigned char *const *blocks)
+        // Perform the rounds of groups 'GROUP' to 15 of the transformation of
+        // 'blocks[lane]' on the state held in 'abef[lane]' and 'cdgh[lane]',
+        // using the message schedule in 'schedule[lane]', for each 'lane' in
+        // '[0 .. NUM_LANES)' of the specified 'abef', 'cdgh', 'schedule', and
+        // 'blocks'.
+    {
+        for (int lane = 0; lane < NUM_LANES; ++lane) {
+            shaNiRounds(&abef[lane],
+                        &cdgh[lane],
+                        schedule[lane],
+                        GROUP,
+                        blocks[lane]);
+        }
+        ShaNiRounds<NUM_LANES, GROUP + 1>::run(abef, cdgh, schedule, blocks);
+    }
+};
+
+template <int NUM_LANES>
+struct ShaNiRounds<NUM_LANES, 16> {
+    // This partial specialization terminates the recursion of 'ShaNiRounds'.
+
+    // CLASS METHODS
+    static void run(__m128i *, __m128i *, __m128i (*)[4],
+                    const unsigned char *const *)
+        // Do nothing.
+    {
+    }
+};
+
+template <int NUM_LANES>
+BDLDE_SHA2_TARGET_SHA
+void shaNiTransformLanes(__m128i              *abef,
+                         __m128i              *cdgh,
+                         const unsigned char **blocks,
+                         bsl::size_t           numBlocks)
+    // Update the state held in 'abef[lane]' and 'cdgh[lane]' with the hashed
+    // contents of the specified 'numBlocks' 64-byte blocks at 'blocks[lane]',
+    // for each 'lane' in '[0 .. NUM_LANES)' of the specified 'abef', 'cdgh',
+    // and 'blocks', using the SHA extensions and advancing each 'blocks[lane]'
+    // past the blocks hashed.
+{
+    for (; 0 < numBlocks; --numBlocks) {
+        __m128i savedAbef[NUM_LANES];
+        __m128i savedCdgh[NUM_LANES];
+        for (int lane = 0; lane < NUM_LANES; ++lane) {
+            savedAbef[lane] = abef[lane];
+            savedCdgh[lane] = cdgh[lane];
+        }
+
+        __m128i schedule[NUM_LANES][4];
+        ShaNiRounds<NUM_LANES>::run(abef, cdgh, schedule, blocks);
+
+        for (int lane = 0; lane < NUM_LANES; ++lane) {
+            abef[lane]    = _mm_add_epi32(abef[lane], savedAbef[lane]);
+            cdgh[lane]    = _mm_add_epi32(cdgh[lane], savedCdgh[lane]);
+            blocks[lane] += 64;
+        }
+    }
+}
+
+BDLDE_SHA2_TARGET_SHA
+void shaNiTransform(bsl::uint32_t       *state,
+                    const unsigned char *message,
+                    bsl::size_t          numBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'numBlocks' 64-byte blocks at the specified 'message' using the SHA
+    // extensions.
+{
+    __m128i abef;
+    __m128i cdgh;
+    shaNiLoadState(&abef, &cdgh, state);
+    shaNiTransformLanes<1>(&abef, &cdgh, &message, numBlocks);
+    shaNiStoreState(state, abef, cdgh);
+}
+
+BDLDE_SHA2_TARGET_SHA
+void shaNiTransform2(bsl::uint32_t              (*state)[2],
+                     const unsigned char *const  *blocks,
+                     bsl::size_t                  numBlocks)
+    // Update each of the two states held in the specified 'state', where
+    // 'state[i][lane]' is word 'i' of the state of 'lane', with the hashed
+    // contents of the specified 'numBlocks' 64-byte blocks at the respective
+    // address in the specified 'blocks' using the SHA extensions, interleaving
+    // the rounds of the two lanes.
+{
+    bsl::uint32_t        laneState[2][8];
+    const unsigned char *message[2];
+    __m128i              abef[2];
+    __m128i              cdgh[2];
+    for (int lane = 0; lane < 2; ++lane) {
+        for (int i = 0; i < 8; ++i) {
+            laneState[lane][i] = state[i][lane];
+        }
+        shaNiLoadState(&abef[lane], &cdgh[lane], laneState[lane]);
+        message[lane] = blocks[lane];
+    }
+
+    shaNiTransformLanes<2>(abef, cdgh, message, numBlocks);
+
+    for (int lane = 0; lane < 2; ++lane) {
+        shaNiStoreState(laneState[lane], abef[lane], cdgh[lane]);
+        for (int i = 0; i < 8; ++i) {
+            state[i][lane] = laneState[lane][i];
+        }
+    }
+}
+
+                        // ----
+                        // AVX2
+                        // ----
+
+BDLDE_SHA2_TARGET_AVX2
+inline
+__m256i avx2RotateRight(__m256i value, int shift)
+    // Return the specified 'value' with each 32-bit lane rotated right by the
+    // specified 'shift' bits.
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+                           _mm256_slli_epi32(value, 32 - shift));
+}
+
+BDLDE_SHA2_TARGET_AVX2
+inline
+void avx2LoadWords(__m256i                    *words,
+                   const unsigned char *const *blocks,
+                   int                         offset)
+    // Load into the specified 'words' the eight big-endian 32-bit words at the
+    // specified 'offset' into each of the eight specified 'blocks', such that
+    // lane 'j' of 'words[i]' holds word 'i' of 'blocks[j] + offset'.
+{
+    const __m256i byteSwap = _mm256_setr_epi8(
+                                 3,  2,  1,  0,  7,  6,  5,  4,
+                                11, 10,  9,  8, 15, 14, 13, 12,
+                                 3,  2,  1,  0,  7,  6,  5,  4,
+                                11, 10,  9,  8, 15, 14, 13, 12);
+
+    __m256i rows[8];
+    for (int lane = 0; lane < 8; ++lane) {
+        rows[lane] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                                                       blocks[lane] + offset));
+    }
+
+    // Transpose the 8x8 matrix of words, in three steps of interleaving 32-bit
+    // elements, 64-bit elements, and 128-bit halves.
+
+    __m256i pairs[8];
+    for (int i = 0; i < 4; ++i) {
+        pairs[2 * i]     = _mm256_unpacklo_epi32(rows[2 * i], rows[2 * i + 1]);
+        pairs[2 * i + 1] = _mm256_unpackhi_epi32(rows[2 * i], rows[2 * i + 1]);
+    }
+
+    __m256i quads[8];
+    for (int i = 0; i < 2; ++i) {
+        quads[4 * i]     = _mm256_unpacklo_epi64(pairs[4 * i],
+                                                 pairs[4 * i + 2]);
+        quads[4 * i + 1] = _mm256_unpackhi_epi64(pairs[4 * i],
+                                                 pairs[4 * i + 2]);
+        quads[4 * i + 2] = _mm256_unpacklo_epi64(pairs[4 * i + 1],
+                                                 pairs[4 * i + 3]);
+        quads[4 * i + 3] = _mm256_unpackhi_epi64(pairs[4 * i + 1],
+                                                 pairs[4 * i + 3]);
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        const __m256i low  = _mm256_permute2x128_si256(quads[i],
+                                                       quads[i + 4],
+                                                       0x20);
+        const __m256i high = _mm256_permute2x128_si256(quads[i],
+                                                       quads[i + 4],
+                                                       0x31);
+        words[i]     = _mm256_shuffle_epi8(low,  byteSwap);
+        words[i + 4] = _mm256_shuffle_epi8(high, byteSwap);
+    }
+}
+
+BDLDE_SHA2_TARGET_AVX2
+void avx2Transform8(bsl::uint32_t              (*state)[8],
+                    const unsigned char *const  *blocks,
+                    bsl::size_t                  numBlocks)
+    // Update each of the eight states held in the specified 'state', where
+    // 'state[i][lane]' is word 'i' of the state of 'lane', with the hashed
+    // contents of the specified 'numBlocks' 64-byte blocks at the respective
+    // address in the specified 'blocks' using AVX2 instructions, each lane
+    // being processed in one 32-bit element of the vector registers.
+{
+    __m256i current[8];
+    for (int i = 0; i < 8; ++i) {
+        current[i] = _mm256_loadu_si256(
+                                 reinterpret_cast<const __m256i *>(state[i]));
+    }
+
+    const unsigned char *message[8];
+    bsl::copy(blocks, blocks + 8, message);
+
+    for (; 0 < numBlocks; --numBlocks) {
+        __m256i w[16];
+        avx2LoadWords(w,     message,  0);
+        avx2LoadWords(w + 8, message, 32);
+
+        __m256i a = current[0];
+        __m256i b = current[1];
+        __m256i c = current[2];
+        __m256i d = current[3];
+        __m256i e = current[4];
+        __m256i f = current[5];
+        __m256i g = current[6];
+        __m256i h = current[7];
+
+        for (int index = 0; index < 64; ++index) {
+            if (16 <= index) {
+                const __m256i w2  = w[(index -  2) & 15];
+                const __m256i w15 = w[(index - 15) & 15];
+                const __m256i s1  = _mm256_xor_si256(
+                                    _mm256_xor_si256(avx2RotateRight(w2, 17),
+                                                     avx2RotateRight(w2, 19)),
+                                    _mm256_srli_epi32(w2, 10));
+                const __m256i s0  = _mm256_xor_si256(
+                                    _mm256_xor_si256(avx2RotateRight(w15,  7),
+                                                     avx2RotateRight(w15, 18)),
+                                    _mm256_srli_epi32(w15, 3));
+                w[index & 15] = _mm256_add_epi32(
+                                   _mm256_add_epi32(w[index & 15], s0),
+                                   _mm256_add_epi32(w[(index - 7) & 15], s1));
+            }
+
+            const __m256i sum1 = _mm256_xor_si256(
+                                     _mm256_xor_si256(avx2RotateRight(e,  6),
+                                                      avx2RotateRight(e, 11)),
+                                     avx2RotateRight(e, 25));
+            const __m256i ch   = _mm256_xor_si256(_mm256_and_si256(e, f),
+                                                  _mm256_andnot_si256(e, g));
+            const __m256i t1   = _mm256_add_epi32(
+                    _mm256_add_epi32(_mm256_add_epi32(h, sum1), ch),
+                    _mm256_add_epi32(
+                        _mm256_set1_epi32(static_cast<int>(
+                                                      sha256Constants[index])),
+                        w[index & 15]));
+
+            const __m256i sum0 = _mm256_xor_si256(
+                                     _mm256_xor_si256(avx2RotateRight(a,  2),
+                                                      avx2RotateRight(a, 13)),
+                                     avx2RotateRight(a, 22));
+            const __m256i maj  = _mm256_or_si256(
+                                    _mm256_and_si256(a, b),
+                                    _mm256_and_si256(_mm256_or_si256(a, b),
+                                                     c));
+            const __m256i t2   = _mm256_add_epi32(sum0, maj);
+
+            h = g;
+            g = f;
+            f = e;
+            e = _mm256_add_epi32(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = _mm256_add_epi32(t1, t2);
+        }
+
+        current[0] = _mm256_add_epi32(current[0], a);
+        current[1] = _mm256_add_epi32(current[1], b);
+        current[2] = _mm256_add_epi32(current[2], c);
+        current[3] = _mm256_add_epi32(current[3], d);
+        current[4] = _mm256_add_epi32(current[4], e);
+        current[5] = _mm256_add_epi32(current[5], f);
+        current[6] = _mm256_add_epi32(current[6], g);
+        current[7] = _mm256_add_epi32(current[7], h);
+
+        for (int lane = 0; lane < 8; ++lane) {
+            message[lane] += 64;
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[i]),
+                            current[i]);
+    }
+}
+
+                        // ---------
+                        // Detection
+                        // ---------
+
+bool detectShaNi()
+    // Return 'true' if the processor supports the SHA extensions, together
+    // with the SSSE3 and SSE4.1 instructions used alongside them, and 'false'
+    // otherwise.
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0, 0) < 7 || !__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return false;                                                 // RETURN
+    }
+    if (!(ecx & bit_SSSE3) || !(ecx & bit_SSE4_1)) {
+        return false;                                                 // RETURN
+    }
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return 0 != (ebx & (1u << 29));  // 'SHA' feature flag
+}
+
+bool detectAvx2()
+    // Return 'true' if the processor supports the AVX2 instructions, and
+    // 'false' otherwise.
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+const bool s_hasShaNi = detectShaNi();
+    // 'true' if the processor supports the SHA extensions.
+
+const bool s_hasAvx2 = detectAvx2();
+    // 'true' if the processor supports the AVX2 instructions.
+
+#endif // defined(BDLDE_SHA2_SIMD)
+
+void transform(bsl::uint32_t       *state,
+               const unsigned char *message,
+               bsl::uint64_t        numberOfBuffers,
+               bsl::uint64_t        bufferSize,
+               const bsl::uint32_t (&constants)[64])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' (which
+    // must be 64) times the specified 'numberOfBuffers', mixing it with the
+    // values in the specified 'constants' (which must be 'sha256Constants'),
+    // using the SHA extensions if supported.
+{
+#if defined(BDLDE_SHA2_SIMD)
+    if (s_hasShaNi) {
+        shaNiTransform(state, message, numberOfBuffers);
+        return;                                                       // RETURN
+    }
+#endif
+
+    portableTransform(state, message, numberOfBuffers, bufferSize, constants);
+}
+
+void transform(bsl::uint64_t       *state,
+               const unsigned char *message,
+               bsl::uint64_t        numberOfBuffers,
+               bsl::uint64_t        bufferSize,
+               const bsl::uint64_t (&constants)[80])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' times the
+    // specified 'numberOfBuffers', mixing it with the values in the specified
+    // 'constants'.
+{
+    portableTransform(state, message, numberOfBuffers, bufferSize, constants);
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -344,6 +852,272 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
     }
 }
 
+bsl::size_t loadFinalBlocks(unsigned char        (&finalBlocks)[128],
+                            const unsigned char   *remainder,
+                            bsl::size_t            remainderLength,
+                            bsl::uint64_t          totalLength)
+    // Load into the specified 'finalBlocks' the specified 'remainderLength'
+    // bytes at the specified 'remainder', followed by the SHA-256 padding for
+    // a message having the specified 'totalLength' bytes, and return the
+    // number of 64-byte blocks (1 or 2) so loaded.  The behavior is undefined
+    // unless 'remainderLength < 64'.
+{
+    const bsl::size_t numBlocks = remainderLength + 1 + 8 <= 64 ? 1 : 2;
+
+    bsl::copy(remainder, remainder + remainderLength, finalBlocks);
+    finalBlocks[remainderLength] = 1 << 7;
+    bsl::fill(finalBlocks + remainderLength + 1,
+              finalBlocks + numBlocks * 64 - 8,
+              0);
+    unpack(totalLength * 8, finalBlocks + numBlocks * 64 - 8);
+
+    return numBlocks;
+}
+
+void digestOne(unsigned char       *result,
+               const unsigned char *message,
+               bsl::size_t          length,
+               Sha256Transform      transformFunction)
+    // Load into the specified 'result' the SHA-256 digest of the specified
+    // 'message' having the specified 'length', using the specified
+    // 'transformFunction'.
+{
+    bsl::uint32_t state[8];
+    bsl::copy(sha256InitialState, sha256InitialState + 8, state);
+
+    const bsl::size_t numFullBlocks = length / 64;
+    transformFunction(state, message, numFullBlocks);
+
+    unsigned char     finalBlocks[128];
+    const bsl::size_t numFinalBlocks = loadFinalBlocks(
+                                              finalBlocks,
+                                              message + numFullBlocks * 64,
+                                              length % 64,
+                                              length);
+    transformFunction(state, finalBlocks, numFinalBlocks);
+
+    for (int i = 0; i < 8; ++i) {
+        unpack(state[i], result + 4 * i);
+    }
+}
+
+#if defined(BDLDE_SHA2_SIMD)
+
+template <int NUM_LANES>
+class LaneScheduler {
+    // This class computes the SHA-256 digests of a sequence of messages using
+    // a transformation that processes 'NUM_LANES' independent blocks at a
+    // time.  Each lane is assigned a message; whenever the message occupying
+    // a lane is finished, the lane is assigned the next message, so that
+    // messages of different lengths keep all lanes busy until the sequence
+    // runs out.
+
+  public:
+    // TYPES
+    typedef void (*LaneTransform)(bsl::uint32_t (*state)[NUM_LANES],
+                                  const unsigned char *const *blocks,
+                                  bsl::size_t numBlocks);
+        // Update each lane 'j' of the specified 'state', where
+        // 'state[i][j]' is word 'i' of the state of lane 'j', with the hashed
+        // contents of the specified 'numBlocks' 64-byte blocks at
+        // 'blocks[j]'.
+
+  private:
+    // DATA
+    bsl::uint32_t        d_state[8][NUM_LANES];  // state of each lane
+
+    const unsigned char *d_blocks[NUM_LANES];    // next block of each lane
+
+    bsl::size_t          d_numBlocks[NUM_LANES]; // number of blocks left in
+                                                 // current run of each lane
+
+    bsl::size_t          d_numFinalBlocks[NUM_LANES];
+                                                 // number of blocks in
+                                                 // 'd_finalBlocks' still to
+                                                 // be run after current run
+
+    unsigned char        d_finalBlocks[NUM_LANES][128];
+                                                 // final (padded) blocks of
+                                                 // message in each lane
+
+    unsigned char       *d_results[NUM_LANES];   // digest of each lane, or 0
+                                                 // if lane is idle
+
+    // PRIVATE MANIPULATORS
+    void assign(int            lane,
+                unsigned char *result,
+                const void    *message,
+                bsl::size_t    length);
+        // Assign to the specified 'lane' the specified 'message' having the
+        // specified 'length', whose digest is to be loaded into the specified
+        // 'result'.
+
+    void finish(int lane, Sha256Transform transformFunction);
+        // Hash the blocks remaining for the message in the specified 'lane'
+        // using the specified 'transformFunction', load its digest, and make
+        // 'lane' idle.
+
+  public:
+    // CLASS METHODS
+    static void digestMany(unsigned char      *results,
+                           const void *const  *messages,
+                           const bsl::size_t  *lengths,
+                           bsl::size_t         numMessages,
+                           LaneTransform       laneTransform,
+                           Sha256Transform     transformFunction,
+                           int                 minNumBusyLanes);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' messages described by the specified
+        // 'messages' and 'lengths', as per 'Sha256::digestMany', using the
+        // specified 'laneTransform' for as long as at least the specified
+        // 'minNumBusyLanes' lanes are busy, and then the specified
+        // 'transformFunction' for the messages remaining in each lane.
+};
+
+template <int NUM_LANES>
+void LaneScheduler<NUM_LANES>::assign(int            lane,
+                                      unsigned char *result,
+                                      const void    *message,
+                                      bsl::size_t    length)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(message);
+    const bsl::size_t    numFullBlocks = length / 64;
+
+    for (int i = 0; i < 8; ++i) {
+        d_state[i][lane] = sha256InitialState[i];
+    }
+    d_results[lane] = result;
+
+    const bsl::size_t numFinalBlocks = loadFinalBlocks(
+                                                d_finalBlocks[lane],
+                                                bytes + numFullBlocks * 64,
+                                                length % 64,
+                                                length);
+    if (0 < numFullBlocks) {
+        d_blocks[lane]         = bytes;
+        d_numBlocks[lane]      = numFullBlocks;
+        d_numFinalBlocks[lane] = numFinalBlocks;
+    }
+    else {
+        d_blocks[lane]         = d_finalBlocks[lane];
+        d_numBlocks[lane]      = numFinalBlocks;
+        d_numFinalBlocks[lane] = 0;
+    }
+}
+
+template <int NUM_LANES>
+void LaneScheduler<NUM_LANES>::finish(int             lane,
+                                      Sha256Transform transformFunction)
+{
+    bsl::uint32_t state[8];
+    for (int i = 0; i < 8; ++i) {
+        state[i] = d_state[i][lane];
+    }
+
+    if (0 < d_numBlocks[lane]) {
+        transformFunction(state, d_blocks[lane], d_numBlocks[lane]);
+    }
+    if (0 < d_numFinalBlocks[lane]) {
+        transformFunction(state, d_finalBlocks[lane], d_numFinalBlocks[lane]);
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        unpack(state[i], d_results[lane] + 4 * i);
+    }
+    d_results[lane] = 0;
+}
+
+template <int NUM_LANES>
+void LaneScheduler<NUM_LANES>::digestMany(
+                                       unsigned char      *results,
+                                       const void *const  *messages,
+                                       const bsl::size_t  *lengths,
+                                       bsl::size_t         numMessages,
+                                       LaneTransform       laneTransform,
+                                       Sha256Transform     transformFunction,
+                                       int                 minNumBusyLanes)
+{
+    static const unsigned char k_IDLE_BLOCK[64] = { 0 };
+        // block hashed, and discarded, by idle lanes
+
+    LaneScheduler scheduler;
+
+    bsl::size_t next        = 0;
+    int         numBusyLanes = 0;
+    for (int lane = 0; lane < NUM_LANES; ++lane) {
+        if (next < numMessages) {
+            scheduler.assign(lane,
+                             results + next * Sha256::k_DIGEST_SIZE,
+                             messages[next],
+                             lengths[next]);
+            ++next;
+            ++numBusyLanes;
+        }
+        else {
+            scheduler.d_results[lane] = 0;
+            scheduler.d_blocks[lane]  = k_IDLE_BLOCK;
+        }
+    }
+
+    while (minNumBusyLanes <= numBusyLanes) {
+        // Run all lanes for as many blocks as remain in the shortest run.
+
+        bsl::size_t numBlocks = 0;
+        for (int lane = 0; lane < NUM_LANES; ++lane) {
+            if (scheduler.d_results[lane] &&
+                (0 == numBlocks || scheduler.d_numBlocks[lane] < numBlocks)) {
+                numBlocks = scheduler.d_numBlocks[lane];
+            }
+        }
+
+        laneTransform(scheduler.d_state, scheduler.d_blocks, numBlocks);
+
+        for (int lane = 0; lane < NUM_LANES; ++lane) {
+            if (!scheduler.d_results[lane]) {
+                continue;                                           // CONTINUE
+            }
+
+            scheduler.d_blocks[lane]    += numBlocks * 64;
+            scheduler.d_numBlocks[lane] -= numBlocks;
+            if (0 < scheduler.d_numBlocks[lane]) {
+                continue;                                           // CONTINUE
+            }
+
+            if (0 < scheduler.d_numFinalBlocks[lane]) {
+                scheduler.d_blocks[lane]         =
+                                                scheduler.d_finalBlocks[lane];
+                scheduler.d_numBlocks[lane]      =
+                                             scheduler.d_numFinalBlocks[lane];
+                scheduler.d_numFinalBlocks[lane] = 0;
+            }
+            else if (next < numMessages) {
+                scheduler.finish(lane, transformFunction);
+                scheduler.assign(lane,
+                                 results + next * Sha256::k_DIGEST_SIZE,
+                                 messages[next],
+                                 lengths[next]);
+                ++next;
+            }
+            else {
+                scheduler.finish(lane, transformFunction);
+                scheduler.d_blocks[lane] = k_IDLE_BLOCK;
+                --numBusyLanes;
+            }
+        }
+    }
+
+    // Too few lanes are busy to make the lane transformation worthwhile;
+    // finish the remaining messages one at a time.
+
+    for (int lane = 0; lane < NUM_LANES; ++lane) {
+        if (scheduler.d_results[lane]) {
+            scheduler.finish(lane, transformFunction);
+        }
+    }
+}
+
+#endif // defined(BDLDE_SHA2_SIMD)
+
 } // close unnamed namespace
 
 Sha224::Sha224()
@@ -357,6 +1131,22 @@ Sha224::Sha224(const void *data, bsl::size_t length)
     update(data, length);
 }
 
+// CLASS METHODS
+void Sha256::digestMany(unsigned char      *results,
+                        const void *const  *messages,
+                        const bsl::size_t  *lengths,
+                        bsl::size_t         numMessages)
+{
+#if defined(BDLDE_SHA2_SIMD)
+    if (s_hasShaNi) {
+        Sha256_Impl::digestManyShaNi(results, messages, lengths, numMessages);
+        return;                                                       // RETURN
+    }
+#endif
+
+    Sha256_Impl::digestManyAvx2(results, messages, lengths, numMessages);
+}
+
 Sha256::Sha256()
 {
     reset();
@@ -410,16 +1200,7 @@ void Sha256::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 32 bits of the fractional part of the square root of the first 8
-    // primes.
-    d_state[0] = 0x6a09e667;
-    d_state[1] = 0xbb67ae85;
-    d_state[2] = 0x3c6ef372;
-    d_state[3] = 0xa54ff53a;
-    d_state[4] = 0x510e527f;
-    d_state[5] = 0x9b05688c;
-    d_state[6] = 0x1f83d9ab;
-    d_state[7] = 0x5be0cd19;
+    bsl::copy(sha256InitialState, sha256InitialState + 8, d_state);
 }
 
 void Sha384::reset()
@@ -650,6 +1431,69 @@ bsl::ostream& Sha512::print(bsl::ostream& stream) const
     return stream;
 }
 
+                             // ------------------
+                             // struct Sha256_Impl
+                             // ------------------
+
+// CLASS METHODS
+void Sha256_Impl::digestManyPortable(unsigned char      *results,
+                                     const void *const  *messages,
+                                     const bsl::size_t  *lengths,
+                                     bsl::size_t         numMessages)
+{
+    for (bsl::size_t i = 0; i < numMessages; ++i) {
+        digestOne(results + i * Sha256::k_DIGEST_SIZE,
+                  static_cast<const unsigned char *>(messages[i]),
+                  lengths[i],
+                  &portableSha256Transform);
+    }
+}
+
+void Sha256_Impl::digestManyShaNi(unsigned char      *results,
+                                  const void *const  *messages,
+                                  const bsl::size_t  *lengths,
+                                  bsl::size_t         numMessages)
+{
+#if defined(BDLDE_SHA2_SIMD)
+    if (s_hasShaNi) {
+        LaneScheduler<2>::digestMany(results,
+                                     messages,
+                                     lengths,
+                                     numMessages,
+                                     &shaNiTransform2,
+                                     &shaNiTransform,
+                                     2);
+        return;                                                       // RETURN
+    }
+#endif
+
+    digestManyPortable(results, messages, lengths, numMessages);
+}
+
+void Sha256_Impl::digestManyAvx2(unsigned char      *results,
+                                 const void *const  *messages,
+                                 const bsl::size_t  *lengths,
+                                 bsl::size_t         numMessages)
+{
+#if defined(BDLDE_SHA2_SIMD)
+    if (s_hasAvx2) {
+        // Below three busy lanes, the eight-lane transformation is slower
+        // than hashing the remaining messages one at a time.
+
+        LaneScheduler<8>::digestMany(results,
+                                     messages,
+                                     lengths,
+                                     numMessages,
+                                     &avx2Transform8,
+                                     &portableSha256Transform,
+                                     3);
+        return;                                                       // RETURN
+    }
+#endif
+
+    digestManyPortable(results, messages, lengths, numMessages);
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
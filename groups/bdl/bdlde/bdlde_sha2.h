@@ -12,6 +12,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //  bdlde::Sha256: value-semantic type representing a SHA-256 digest
 //  bdlde::Sha384: value-semantic type representing a SHA-384 digest
 //  bdlde::Sha512: value-semantic type representing a SHA-512 digest
+//  bdlde::Sha256_Impl: alternative implementations of 'Sha256::digestMany'
 //
 //@SEE_ALSO: bdlde_md5
 //
@@ -25,9 +26,50 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+///Hashing Many Messages
+///---------------------
+// The class method 'Sha256::digestMany' computes the SHA-256 digests of a
+// number of independent messages in a single call.  The result for each
+// message is identical to that obtained by supplying the message to a
+// default-constructed 'Sha256' and calling 'loadDigest', but the messages are
+// hashed in parallel lanes where the hardware allows (see {Support for
+// Hardware Acceleration}), so that an application hashing many small or
+// medium-sized messages (e.g., to detect duplicates) obtains a substantially
+// higher throughput than by hashing them one at a time.  The struct
+// 'bdlde::Sha256_Impl' exposes the individual implementations of
+// 'digestMany', which should not be used other than to test and benchmark.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// On x86-64 platforms built with GCC or clang, runtime checks are performed to
+// detect whether the processor supports instructions that accelerate SHA-256:
+//: o If the SHA extensions (SHA-NI) are supported, the block transformation
+//:   used by 'Sha224' and 'Sha256' uses the dedicated 'sha256rnds2',
+//:   'sha256msg1', and 'sha256msg2' instructions, and 'digestMany'
+//:   interleaves the transformation of two messages at a time to hide the
+//:   latency of those instructions.
+//:
+//: o Otherwise, if AVX2 is supported, 'digestMany' hashes eight messages at a
+//:   time, each in one 32-bit lane of the 256-bit vector registers, assigning
+//:   the next message to a lane as soon as the message occupying it is
+//:   finished.
+//
+// Other platforms use the portable implementation throughout.  'Sha384' and
+// 'Sha512' always use the portable implementation.
+//
+///Performance
+///-----------
+// See the test driver for this component in the '.t.cpp' to compare the
+// throughput of the implementations of 'digestMany' for various message
+// sizes.
+//
 ///Usage
 ///-----
-// In this section we show intended usage of this component.  The
+// In this section we show intended usage of this component.
+//
+///Example 1: Validating a Password
+/// - - - - - - - - - - - - - - - -
+// The
 // 'validatePassword' function below returns whether a specified password has a
 // specified hash value.  The 'assertPasswordIsExpected' function below has a
 // sample password to hash and a hash value that matches it.  Note that the
@@ -73,6 +115,51 @@ BSLS_IDENT("$Id$ $CSID$")
 //      ASSERT(validatePassword(password, salt, expected));
 //  }
 //..
+//
+///Example 2: Hashing a Batch of Messages
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that we store messages that frequently arrive more than once, and we
+// want to detect duplicates by their SHA-256 digest.  Rather than hashing each
+// message of an incoming batch separately, we hash the whole batch at once.
+//
+// First, we describe each message of the batch by its address and length:
+//..
+//  const char *const batch[] = { "alpha", "beta", "alpha" };
+//  enum { k_NUM_MESSAGES = sizeof batch / sizeof *batch };
+//
+//  const void  *messages[k_NUM_MESSAGES];
+//  bsl::size_t  lengths[k_NUM_MESSAGES];
+//  for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+//      messages[i] = batch[i];
+//      lengths[i]  = bsl::strlen(batch[i]);
+//  }
+//..
+// Then, we compute all of the digests, which are loaded contiguously into a
+// single array:
+//..
+//  unsigned char digests[k_NUM_MESSAGES][bdlde::Sha256::k_DIGEST_SIZE];
+//  bdlde::Sha256::digestMany(digests[0], messages, lengths, k_NUM_MESSAGES);
+//..
+// Now, we observe that each digest is the one computed by a 'Sha256' object:
+//..
+//  for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+//      unsigned char expected[bdlde::Sha256::k_DIGEST_SIZE];
+//      bdlde::Sha256(messages[i], lengths[i]).loadDigest(expected);
+//
+//      ASSERT(bsl::equal(expected,
+//                        expected + bdlde::Sha256::k_DIGEST_SIZE,
+//                        digests[i]));
+//  }
+//..
+// Finally, we find that the first and last messages are duplicates:
+//..
+//  ASSERT( bsl::equal(digests[0],
+//                     digests[0] + bdlde::Sha256::k_DIGEST_SIZE,
+//                     digests[2]));
+//  ASSERT(!bsl::equal(digests[0],
+//                     digests[0] + bdlde::Sha256::k_DIGEST_SIZE,
+//                     digests[1]));
+//..
 
 #include <bdlscm_version.h>
 
@@ -201,6 +288,26 @@ class Sha256 {
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void digestMany(unsigned char      *results,
+                           const void *const  *messages,
+                           const bsl::size_t  *lengths,
+                           bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' messages, where message 'i' is the
+        // 'lengths[i]' bytes at 'messages[i]' for the specified 'messages' and
+        // 'lengths' arrays, such that the digest of message 'i' occupies the
+        // 'k_DIGEST_SIZE' bytes at 'results + i * k_DIGEST_SIZE'.  The digest
+        // of each message is identical to that loaded by 'loadDigest' after
+        // supplying that message to a default-constructed 'Sha256', but the
+        // messages may be hashed in parallel (see {Hashing Many Messages}).
+        // The behavior is undefined unless 'results' refers to an array of at
+        // least 'numMessages * k_DIGEST_SIZE' bytes that does not overlap any
+        // message, 'messages' and 'lengths' refer to arrays of at least
+        // 'numMessages' elements, and, for each 'i' in '[0 .. numMessages)',
+        // '[messages[i], messages[i] + lengths[i])' is a valid range.  Note
+        // that if 'messages[i]' is 0, then 'lengths[i]' must also be 0.
+
     // CREATORS
     Sha256();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -403,6 +510,45 @@ class Sha512 {
         // output 'stream' and return a reference to the modifiable 'stream'.
 };
 
+                             // ==================
+                             // struct Sha256_Impl
+                             // ==================
+
+struct Sha256_Impl {
+    // This 'struct' provides alternative implementations of
+    // 'Sha256::digestMany', for testing and benchmarking.
+
+    // CLASS METHODS
+    static void digestManyPortable(unsigned char      *results,
+                                   const void *const  *messages,
+                                   const bsl::size_t  *lengths,
+                                   bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' messages described by the specified
+        // 'messages' and 'lengths', as per 'Sha256::digestMany', hashing the
+        // messages one at a time using the portable implementation.
+
+    static void digestManyShaNi(unsigned char      *results,
+                                const void *const  *messages,
+                                const bsl::size_t  *lengths,
+                                bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' messages described by the specified
+        // 'messages' and 'lengths', as per 'Sha256::digestMany', hashing two
+        // messages at a time using the SHA extensions.  Fall back to
+        // 'digestManyPortable' if the SHA extensions are not supported.
+
+    static void digestManyAvx2(unsigned char      *results,
+                               const void *const  *messages,
+                               const bsl::size_t  *lengths,
+                               bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' messages described by the specified
+        // 'messages' and 'lengths', as per 'Sha256::digestMany', hashing eight
+        // messages at a time using AVX2 instructions.  Fall back to
+        // 'digestManyPortable' if AVX2 is not supported.
+};
+
 // FREE OPERATORS
 bool operator==(const Sha224& lhs, const Sha224& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' SHA digests have the same
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -120,6 +121,12 @@ using namespace bsl;
 // [24] bsl::ostream& Sha384::print(bsl::ostream& stream) const;
 // [25] bsl::ostream& Sha512::print(bsl::ostream& stream) const;
 //
+// CLASS METHODS
+// [26] void Sha256::digestMany(uchar *, const void *const *, ...);
+// [26] void Sha256_Impl::digestManyPortable(uchar *, ...);
+// [26] void Sha256_Impl::digestManyShaNi(uchar *, ...);
+// [26] void Sha256_Impl::digestManyAvx2(uchar *, ...);
+//
 // FREE OPERATORS
 // [ 6] bool operator==(const Sha224& lhs, const Sha224& rhs);
 // [ 7] bool operator==(const Sha256& lhs, const Sha256& rhs);
@@ -135,7 +142,8 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'digestMany' THROUGHPUT
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -336,6 +344,55 @@ void assertPasswordIsExpected()
 
     ASSERT(validatePassword(password, salt, expected));
 }
+//..
+//
+///Example 2: Hashing a Batch of Messages
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that we store messages that frequently arrive more than once, and we
+// want to detect duplicates by their SHA-256 digest.  Rather than hashing each
+// message of an incoming batch separately, we hash the whole batch at once.
+//
+void hashBatch()
+    // Hash a batch of messages containing a duplicate.
+{
+// First, we describe each message of the batch by its address and length:
+//..
+    const char *const batch[] = { "alpha", "beta", "alpha" };
+    enum { k_NUM_MESSAGES = sizeof batch / sizeof *batch };
+
+    const void  *messages[k_NUM_MESSAGES];
+    bsl::size_t  lengths[k_NUM_MESSAGES];
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        messages[i] = batch[i];
+        lengths[i]  = bsl::strlen(batch[i]);
+    }
+//..
+// Then, we compute all of the digests, which are loaded contiguously into a
+// single array:
+//..
+    unsigned char digests[k_NUM_MESSAGES][bdlde::Sha256::k_DIGEST_SIZE];
+    bdlde::Sha256::digestMany(digests[0], messages, lengths, k_NUM_MESSAGES);
+//..
+// Now, we observe that each digest is the one computed by a 'Sha256' object:
+//..
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        unsigned char expected[bdlde::Sha256::k_DIGEST_SIZE];
+        bdlde::Sha256(messages[i], lengths[i]).loadDigest(expected);
+
+        ASSERT(bsl::equal(expected,
+                          expected + bdlde::Sha256::k_DIGEST_SIZE,
+                          digests[i]));
+    }
+//..
+// Finally, we find that the first and last messages are duplicates:
+//..
+    ASSERT( bsl::equal(digests[0],
+                       digests[0] + bdlde::Sha256::k_DIGEST_SIZE,
+                       digests[2]));
+    ASSERT(!bsl::equal(digests[0],
+                       digests[0] + bdlde::Sha256::k_DIGEST_SIZE,
+                       digests[1]));
+}
 
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
@@ -483,6 +540,85 @@ void testReset(const char (&message)[LENGTH])
     ASSERT(digest1 == digest2);
 }
 
+typedef void (*DigestManyFunction)(unsigned char      *results,
+                                   const void *const  *messages,
+                                   const bsl::size_t  *lengths,
+                                   bsl::size_t         numMessages);
+    // Pointer to a function having the signature of 'Sha256::digestMany'.
+
+struct DigestManyImplementation {
+    // This 'struct' describes an implementation of 'Sha256::digestMany'.
+
+    const char         *d_name;      // name of the implementation
+    DigestManyFunction  d_function;  // the implementation
+};
+
+const DigestManyImplementation DIGEST_MANY[] = {
+    { "digestMany",         &bdlde::Sha256::digestMany                },
+    { "digestManyPortable", &bdlde::Sha256_Impl::digestManyPortable   },
+    { "digestManyShaNi",    &bdlde::Sha256_Impl::digestManyShaNi      },
+    { "digestManyAvx2",     &bdlde::Sha256_Impl::digestManyAvx2       }
+};
+const int NUM_DIGEST_MANY = sizeof DIGEST_MANY / sizeof *DIGEST_MANY;
+
+unsigned int randState = 12345;
+
+unsigned int randUnsigned()
+    // Return the next value of a simple pseudo-random sequence.
+{
+    randState = randState * 1103515245 + 12345;
+    return randState >> 8;
+}
+
+void verifyDigestMany(int                       line,
+                      const bsl::vector<char>&  data,
+                      const bsl::size_t        *offsets,
+                      const bsl::size_t        *lengths,
+                      bsl::size_t               numMessages)
+    // Verify that each implementation of 'digestMany' loads, for the
+    // specified 'numMessages' messages of the specified 'lengths' at the
+    // specified 'offsets' into the specified 'data', the digests obtained
+    // from 'Sha256' objects, and writes nothing beyond the digests, reporting
+    // failures against the specified 'line'.
+{
+    const bsl::size_t SIZE = bdlde::Sha256::k_DIGEST_SIZE;
+
+    bsl::vector<const void *>  messages(numMessages + 1);
+    bsl::vector<unsigned char> expected(numMessages * SIZE + 1);
+    for (bsl::size_t i = 0; i < numMessages; ++i) {
+        messages[i] = 0 == lengths[i] && 0 == i % 2
+                      ? 0
+                      : data.data() + offsets[i];
+
+        bdlde::Sha256(messages[i], lengths[i]).loadDigest(&expected[i * SIZE]);
+    }
+
+    for (int ii = 0; ii < NUM_DIGEST_MANY; ++ii) {
+        const DigestManyImplementation& IMP = DIGEST_MANY[ii];
+
+        bsl::vector<unsigned char> results(numMessages * SIZE + 1, 0xa5);
+        IMP.d_function(results.data(),
+                       messages.data(),
+                       lengths,
+                       numMessages);
+
+        ASSERTV(line, IMP.d_name, 0xa5 == results.back());
+        for (bsl::size_t i = 0; i < numMessages; ++i) {
+            ASSERTV(line, IMP.d_name, numMessages, i, lengths[i],
+                    bsl::equal(&expected[i * SIZE],
+                               &expected[i * SIZE] + SIZE,
+                               &results[i * SIZE]));
+        }
+    }
+}
+
+double mbPerSecond(bsl::size_t numBytes, double seconds)
+    // Return the throughput, in megabytes per second, of processing the
+    // specified 'numBytes' in the specified 'seconds'.
+{
+    return static_cast<double>(numBytes) / seconds / 1.0e6;
+}
+
 template<class HASHER, bsl::size_t LENGTH>
 void testTwoArgumentConstructor(const char (&message)[LENGTH])
     // Test the two-argument constructor accepting the specified 'message' and
@@ -505,11 +641,12 @@ int main(int argc, char *argv[])
 {
     int        test = argc > 1 ? bsl::atoi(argv[1]) : 0;
     int     verbose = argc > 2;
+    int veryVerbose = argc > 3;
 
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -520,7 +657,8 @@ int main(int argc, char *argv[])
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Run the usage example function 'assertPasswordIsExpected'.
+        //   Run the usage example functions 'assertPasswordIsExpected' and
+        //   'hashBatch'.
         //
         // Testing:
         //   Usage example.
@@ -530,6 +668,142 @@ int main(int argc, char *argv[])
                           << "=====================" "\n";
 
         assertPasswordIsExpected();
+        hashBatch();
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'digestMany'
+        //
+        // Concerns:
+        //: 1 Each implementation of 'digestMany' loads, for each message, the
+        //:   digest obtained from a 'Sha256' object supplied that message,
+        //:   and in particular the known SHA-256 digests.
+        //:
+        //: 2 The digest of each message is loaded at the position of the
+        //:   message in the batch, and nothing is written beyond the last
+        //:   digest.
+        //:
+        //: 3 Messages of every length modulo the block size, including those
+        //:   whose padding needs an extra block, are hashed correctly,
+        //:   regardless of their alignment.
+        //:
+        //: 4 Batches of any size, including batches smaller than the number
+        //:   of lanes and batches in which messages of very different lengths
+        //:   finish at different times, are hashed correctly.
+        //:
+        //: 5 A message may have a null address if its length is 0.
+        //:
+        //: 6 Each implementation produces the same results whether or not
+        //:   the hardware it uses is supported (falling back otherwise).
+        //
+        // Plan:
+        //: 1 Hash the messages having known SHA-256 digests as one batch
+        //:   using each implementation, and compare the results with the
+        //:   known digests.  (C-1)
+        //:
+        //: 2 For batch sizes from 0 to 20, hash batches of consecutive
+        //:   lengths starting at each length in '[0 .. 130]' and at varying
+        //:   offsets, with each implementation, and compare the results with
+        //:   those obtained from 'Sha256' objects, verifying that a sentinel
+        //:   byte following the results is untouched.  Zero-length messages
+        //:   are alternately given null addresses.  (C-1..5)
+        //:
+        //: 3 Repeat P-2 for batches of pseudo-random lengths up to 20000
+        //:   bytes, mixing short and long messages.  (C-1..5)
+        //:
+        //: 4 The implementations fall back to the portable implementation
+        //:   when the hardware they use is not supported, so P-1..3 verify
+        //:   whichever implementation is in effect on the test platform.
+        //:   (C-6)
+        //
+        // Testing:
+        //   void Sha256::digestMany(uchar *, const void *const *, ...);
+        //   void Sha256_Impl::digestManyPortable(uchar *, ...);
+        //   void Sha256_Impl::digestManyShaNi(uchar *, ...);
+        //   void Sha256_Impl::digestManyAvx2(uchar *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'digestMany'" "\n"
+                             "====================" "\n";
+
+        const bsl::size_t SIZE = bdlde::Sha256::k_DIGEST_SIZE;
+
+        if (verbose) cout << "\nKnown digests." << endl;
+        {
+            const bsl::size_t NUM_MESSAGES = arraySize(inputMessages);
+
+            const void  *messages[NUM_MESSAGES];
+            bsl::size_t  lengths[NUM_MESSAGES];
+            for (bsl::size_t i = 0; i < NUM_MESSAGES; ++i) {
+                messages[i] = inputMessages[i].data();
+                lengths[i]  = inputMessages[i].size();
+            }
+
+            for (int ii = 0; ii < NUM_DIGEST_MANY; ++ii) {
+                const DigestManyImplementation& IMP = DIGEST_MANY[ii];
+
+                unsigned char results[NUM_MESSAGES][SIZE];
+                IMP.d_function(results[0], messages, lengths, NUM_MESSAGES);
+
+                for (bsl::size_t i = 0; i < NUM_MESSAGES; ++i) {
+                    bsl::string hexDigest;
+                    toHex(&hexDigest, results[i]);
+                    ASSERTV(IMP.d_name, i, sha256Results[i] == hexDigest);
+                }
+            }
+        }
+
+        bsl::vector<char> data(64 * 1024);
+        for (bsl::size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<char>(randUnsigned());
+        }
+
+        if (verbose) cout << "\nBatches of consecutive lengths." << endl;
+        {
+            const bsl::size_t MAX_NUM_MESSAGES = 20;
+
+            bsl::size_t offsets[MAX_NUM_MESSAGES];
+            bsl::size_t lengths[MAX_NUM_MESSAGES];
+
+            for (bsl::size_t numMessages = 0;
+                 numMessages <= MAX_NUM_MESSAGES;
+                 ++numMessages) {
+                if (veryVerbose) { P(numMessages) }
+
+                for (bsl::size_t start = 0; start <= 130; ++start) {
+                    for (bsl::size_t i = 0; i < numMessages; ++i) {
+                        offsets[i] = (start + 7 * i) % 61;
+                        lengths[i] = start + i;
+                    }
+                    verifyDigestMany(L_,
+                                     data,
+                                     offsets,
+                                     lengths,
+                                     numMessages);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nBatches of mixed lengths." << endl;
+        {
+            const bsl::size_t MAX_NUM_MESSAGES = 40;
+
+            bsl::size_t offsets[MAX_NUM_MESSAGES];
+            bsl::size_t lengths[MAX_NUM_MESSAGES];
+
+            for (int iteration = 0; iteration < 200; ++iteration) {
+                const bsl::size_t numMessages = randUnsigned()
+                                              % (MAX_NUM_MESSAGES + 1);
+
+                for (bsl::size_t i = 0; i < numMessages; ++i) {
+                    const unsigned int r = randUnsigned();
+                    lengths[i] = 0 == r % 4 ? r % 20000 : r % 300;
+                    offsets[i] = randUnsigned()
+                               % (data.size() - lengths[i] + 1);
+                }
+                verifyDigestMany(L_, data, offsets, lengths, numMessages);
+            }
+        }
       } break;
       case 25: {
         // --------------------------------------------------------------------
@@ -1250,6 +1524,92 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'digestMany' THROUGHPUT
+        //
+        // Concerns:
+        //: 1 The accelerated implementations of 'digestMany' have a
+        //:   substantially higher throughput than hashing each message with
+        //:   a 'Sha256' object using the portable implementation.
+        //
+        // Plan:
+        //: 1 For several message sizes, measure and report the throughput (in
+        //:   megabytes of messages per second) of hashing a batch of messages
+        //:   one at a time with 'Sha256' objects, and with each
+        //:   implementation of 'digestMany'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'digestMany' THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: 'digestMany' THROUGHPUT" "\n"
+                             "=====================================" "\n";
+
+        static const bsl::size_t SIZES[] = { 16, 64, 256, 1024, 4096, 65536 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const bsl::size_t BATCH = 1024 * 1024;       // bytes per batch
+        const bsl::size_t TOTAL = 64 * 1024 * 1024;  // bytes per measurement
+
+        bsl::vector<char> data(BATCH);
+        for (bsl::size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<char>(randUnsigned());
+        }
+
+        cout << "size";
+        cout << "\tSha256";
+        for (int ii = 0; ii < NUM_DIGEST_MANY; ++ii) {
+            cout << '\t' << DIGEST_MANY[ii].d_name;
+        }
+        cout << "\t(MB/s)" << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const bsl::size_t SIZE         = SIZES[si];
+            const bsl::size_t NUM_MESSAGES = BATCH / SIZE;
+            const int         REPS         = static_cast<int>(TOTAL / BATCH);
+
+            bsl::vector<const void *>  messages(NUM_MESSAGES);
+            bsl::vector<bsl::size_t>   lengths(NUM_MESSAGES, SIZE);
+            bsl::vector<unsigned char> results(NUM_MESSAGES *
+                                               bdlde::Sha256::k_DIGEST_SIZE);
+            for (bsl::size_t i = 0; i < NUM_MESSAGES; ++i) {
+                messages[i] = data.data() + i * SIZE;
+            }
+
+            bsls::Stopwatch timer;
+
+            timer.start(); {
+                for (int r = 0; r < REPS; ++r) {
+                    for (bsl::size_t i = 0; i < NUM_MESSAGES; ++i) {
+                        bdlde::Sha256(messages[i], SIZE).loadDigest(
+                                 &results[i * bdlde::Sha256::k_DIGEST_SIZE]);
+                    }
+                }
+            } timer.stop();
+
+            cout << SIZE << '\t'
+                 << mbPerSecond(NUM_MESSAGES * SIZE * REPS,
+                                timer.elapsedTime());
+
+            for (int ii = 0; ii < NUM_DIGEST_MANY; ++ii) {
+                timer.reset();
+                timer.start(); {
+                    for (int r = 0; r < REPS; ++r) {
+                        DIGEST_MANY[ii].d_function(results.data(),
+                                                   messages.data(),
+                                                   lengths.data(),
+                                                   NUM_MESSAGES);
+                    }
+                } timer.stop();
+
+                cout << '\t'
+                     << mbPerSecond(NUM_MESSAGES * SIZE * REPS,
+                                    timer.elapsedTime());
+            }
+            cout << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
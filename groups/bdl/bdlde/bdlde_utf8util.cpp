@@ -14,6 +14,19 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BDLDE_UTF8UTIL_SIMD
+    // Validate using SSE2 (which all x86-64 processors support), or AVX2 if
+    // the processor supports it (see 'validPrefix').
+#include <immintrin.h>
+#include <string.h>     // 'strnlen'
+#endif
 
 // LOCAL MACROS
 
@@ -138,6 +151,433 @@ int get4ByteValue(const char *pc)
                                |  (pc[3] & k_CONT_VALUE_MASK);
 }
 
+
+#if defined(BDLDE_UTF8UTIL_SIMD)
+
+static
+int strictSequenceLength(const char *pc, const char *end)
+    // Return the length of the multi-byte UTF-8 sequence starting at the
+    // specified 'pc' and ending before the specified 'end' if it encodes a
+    // valid Unicode code point, and 0 otherwise.  The behavior is undefined
+    // unless 'pc < end' and '*pc' is not an ASCII character.
+{
+    const bsls::Types::IntPtr available = end - pc;
+
+    switch ((*pc >> 4) & 0xf) {
+      case 0xc:
+      case 0xd: {
+        if (available < 2
+         || isNotContinuation(pc[1])
+         || get2ByteValue(pc) < k_MIN_2_BYTE_VALUE) {
+            return 0;                                                 // RETURN
+        }
+        return 2;                                                     // RETURN
+      }
+      case 0xe: {
+        if (available < 3
+         || isNotContinuation(pc[1])
+         || isNotContinuation(pc[2])) {
+            return 0;                                                 // RETURN
+        }
+        const int value = get3ByteValue(pc);
+        if (value < k_MIN_3_BYTE_VALUE || isSurrogateValue(value)) {
+            return 0;                                                 // RETURN
+        }
+        return 3;                                                     // RETURN
+      }
+      case 0xf: {
+        if (available < 4
+         || (*pc & 8)
+         || isNotContinuation(pc[1])
+         || isNotContinuation(pc[2])
+         || isNotContinuation(pc[3])) {
+            return 0;                                                 // RETURN
+        }
+        const int value = get4ByteValue(pc);
+        if (value < k_MIN_4_BYTE_VALUE || value > k_MAX_VALID) {
+            return 0;                                                 // RETURN
+        }
+        return 4;                                                     // RETURN
+      }
+    }
+
+    return 0;
+}
+
+static
+const char *sse2ValidPrefix(bsls::Types::IntPtr *numCodePoints,
+                            const char          *string,
+                            const char          *end,
+                            bsls::Types::IntPtr  maxNumCodePoints)
+    // Return the address of the end of a prefix of the specified 'string',
+    // ending before the specified 'end' and containing at most the specified
+    // 'maxNumCodePoints' Unicode code points, that is valid UTF-8, and load
+    // the number of code points in that prefix into the specified
+    // 'numCodePoints'.  Runs of ASCII characters are skipped 16 bytes at a
+    // time; other sequences are validated one at a time, and the prefix ends
+    // at the first invalid sequence or when fewer than 16 bytes remain.
+{
+    const char          *pc    = string;
+    bsls::Types::IntPtr  count = 0;
+
+    while (end - pc >= 16) {
+        const __m128i input =
+                       _mm_loadu_si128(reinterpret_cast<const __m128i *>(pc));
+        const int     nonAscii = _mm_movemask_epi8(input);
+
+        if (0 == nonAscii) {
+            if (maxNumCodePoints - count < 16) {
+                break;
+            }
+            pc    += 16;
+            count += 16;
+            continue;
+        }
+
+        const int numAscii = __builtin_ctz(nonAscii);
+        if (maxNumCodePoints - count <= numAscii) {
+            break;
+        }
+        pc    += numAscii;
+        count += numAscii;
+
+        const int sequenceLength = strictSequenceLength(pc, end);
+        if (0 == sequenceLength) {
+            break;
+        }
+        pc += sequenceLength;
+        ++count;
+    }
+
+    *numCodePoints = count;
+    return pc;
+}
+
+#define BDLDE_UTF8UTIL_TARGET_AVX2 __attribute__((target("avx2")))
+    // Compile the function so annotated for a processor supporting AVX2
+    // regardless of the target of the translation unit.  Such functions are
+    // invoked only after a runtime check for AVX2.
+
+BDLDE_UTF8UTIL_TARGET_AVX2
+static inline
+__m256i lookup(__m256i table, __m256i nibbles)
+    // Return the bytes of the specified 'table' (holding the same 16 bytes in
+    // each 128-bit lane) indexed by the respective bytes of the specified
+    // 'nibbles', each of which must be in the range '[0 .. 15]'.
+{
+    return _mm256_shuffle_epi8(table, nibbles);
+}
+
+BDLDE_UTF8UTIL_TARGET_AVX2
+static inline
+__m256i highNibbles(__m256i input)
+    // Return the high 4 bits of each byte of the specified 'input'.
+{
+    return _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                            _mm256_set1_epi8(0x0f));
+}
+
+template <int N>
+BDLDE_UTF8UTIL_TARGET_AVX2
+static inline
+__m256i previousBytes(__m256i input, __m256i previousInput)
+    // Return the 32 bytes preceding by 'N' bytes those of the specified
+    // 'input', where the specified 'previousInput' holds the 32 bytes
+    // preceding 'input'.
+{
+    return _mm256_alignr_epi8(
+                      input,
+                      _mm256_permute2x128_si256(previousInput, input, 0x21),
+                      16 - N);
+}
+
+BDLDE_UTF8UTIL_TARGET_AVX2
+static
+const char *avx2ValidPrefix(bsls::Types::IntPtr *numCodePoints,
+                            const char          *string,
+                            const char          *end,
+                            bsls::Types::IntPtr  maxNumCodePoints)
+    // Return the address of the end of a prefix of the specified 'string',
+    // ending before the specified 'end' and containing at most the specified
+    // 'maxNumCodePoints' Unicode code points, that is valid UTF-8, and load
+    // the number of code points in that prefix into the specified
+    // 'numCodePoints'.  The input is validated 32 bytes at a time using the
+    // algorithm of Keiser and Lemire ("Validating UTF-8 In Less Than One
+    // Instruction Per Byte", 2021), which classifies each pair of adjacent
+    // bytes through three 16-entry lookup tables, and the prefix ends at the
+    // last code point boundary preceding the first block containing an error,
+    // or when fewer than 32 bytes remain.  The behavior is undefined unless
+    // the processor supports AVX2.
+{
+    // Each bit of the lookup results flags one kind of error for a pair of
+    // adjacent bytes; an error is present if a bit is set in all three
+    // lookups.
+
+    enum {
+        k_TOO_SHORT      = 1 << 0,  // 11______ 0_______, 11______ 11______
+        k_TOO_LONG       = 1 << 1,  // 0_______ 10______
+        k_OVERLONG_3     = 1 << 2,  // 11100000 100_____
+        k_TOO_LARGE      = 1 << 3,  // 11110100 1001____, 11110100 101_____,
+                                    // 11110101 1001____, ...
+        k_SURROGATE      = 1 << 4,  // 11101101 101_____
+        k_OVERLONG_2     = 1 << 5,  // 1100000_ 10______
+        k_TOO_LARGE_1000 = 1 << 6,  // 11110101 1000____, 1111011_ 1000____,
+                                    // 11111___ 1000____
+        k_OVERLONG_4     = 1 << 6,  // 11110000 1000____
+        k_TWO_CONTS      = 1 << 7,  // 10______ 10______
+        k_CARRY          = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+    };
+
+#define U_TWICE(B0, B1, B2, B3, B4, B5, B6, B7,                               \
+                B8, B9, BA, BB, BC, BD, BE, BF)                               \
+    _mm256_setr_epi8(                                                         \
+                  static_cast<char>(B0), static_cast<char>(B1),               \
+                  static_cast<char>(B2), static_cast<char>(B3),               \
+                  static_cast<char>(B4), static_cast<char>(B5),               \
+                  static_cast<char>(B6), static_cast<char>(B7),               \
+                  static_cast<char>(B8), static_cast<char>(B9),               \
+                  static_cast<char>(BA), static_cast<char>(BB),               \
+                  static_cast<char>(BC), static_cast<char>(BD),               \
+                  static_cast<char>(BE), static_cast<char>(BF),               \
+                  static_cast<char>(B0), static_cast<char>(B1),               \
+                  static_cast<char>(B2), static_cast<char>(B3),               \
+                  static_cast<char>(B4), static_cast<char>(B5),               \
+                  static_cast<char>(B6), static_cast<char>(B7),               \
+                  static_cast<char>(B8), static_cast<char>(B9),               \
+                  static_cast<char>(BA), static_cast<char>(BB),               \
+                  static_cast<char>(BC), static_cast<char>(BD),               \
+                  static_cast<char>(BE), static_cast<char>(BF))
+
+    // Indexed by the high nibble of the first byte of a pair.
+
+    const __m256i byte1HighTable = U_TWICE(
+        k_TOO_LONG,  k_TOO_LONG,  k_TOO_LONG,  k_TOO_LONG,
+        k_TOO_LONG,  k_TOO_LONG,  k_TOO_LONG,  k_TOO_LONG,
+        k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS,
+        k_TOO_SHORT | k_OVERLONG_2,
+        k_TOO_SHORT,
+        k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE,
+        k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_1000 | k_OVERLONG_4);
+
+    // Indexed by the low nibble of the first byte of a pair.
+
+    const __m256i byte1LowTable = U_TWICE(
+        k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4,
+        k_CARRY | k_OVERLONG_2,
+        k_CARRY,
+        k_CARRY,
+        k_CARRY | k_TOO_LARGE,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000 | k_SURROGATE,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,
+        k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000);
+
+    // Indexed by the high nibble of the second byte of a pair.
+
+    const __m256i byte2HighTable = U_TWICE(
+        k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+        k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+        k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3
+                   | k_TOO_LARGE_1000 | k_OVERLONG_4,
+        k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3 | k_TOO_LARGE,
+        k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE  | k_TOO_LARGE,
+        k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE  | k_TOO_LARGE,
+        k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT);
+
+#undef U_TWICE
+
+    const __m256i lowNibbleMask   = _mm256_set1_epi8(0x0f);
+    const __m256i highBit         = _mm256_set1_epi8(static_cast<char>(0x80));
+    const __m256i maxContinuation = _mm256_set1_epi8(static_cast<char>(0xbf));
+    const __m256i thirdByteBias   = _mm256_set1_epi8(0xe0 - 0x80);
+    const __m256i fourthByteBias  = _mm256_set1_epi8(0xf0 - 0x80);
+
+    const char          *pc             = string;
+    const char          *committed      = string;
+    bsls::Types::IntPtr  committedCount = 0;
+    bsls::Types::IntPtr  numLeadBytes   = 0;
+    __m256i              previousInput  = _mm256_setzero_si256();
+
+    // 'committed' is the last code point boundary up to which the input is
+    // known to be valid, and 'committedCount' the number of code points
+    // preceding it.  'numLeadBytes' is the number of bytes preceding 'pc' that
+    // are not continuation bytes.  Note that the bytes between 'committed'
+    // and 'pc' are the start of a single code point whose remaining bytes (if
+    // any) are in the next block.
+
+    while (end - pc >= 32) {
+        const __m256i input =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pc));
+
+        if (committed == pc && 0 == _mm256_movemask_epi8(input)) {
+            // ASCII block following a complete code point.
+
+            if (maxNumCodePoints - committedCount < 32) {
+                break;
+            }
+            pc             += 32;
+            numLeadBytes   += 32;
+            committed       = pc;
+            committedCount += 32;
+            previousInput   = input;
+            continue;
+        }
+
+        const __m256i prev1 = previousBytes<1>(input, previousInput);
+        const __m256i prev2 = previousBytes<2>(input, previousInput);
+        const __m256i prev3 = previousBytes<3>(input, previousInput);
+
+        const __m256i special = _mm256_and_si256(
+                 _mm256_and_si256(
+                       lookup(byte1HighTable, highNibbles(prev1)),
+                       lookup(byte1LowTable,
+                              _mm256_and_si256(prev1, lowNibbleMask))),
+                 lookup(byte2HighTable, highNibbles(input)));
+
+        // A byte must be a continuation byte if the byte 2 (resp. 3) places
+        // before is the lead byte of a 3-byte (resp. 4-byte) sequence; only
+        // those bytes have their high bit set after the saturating
+        // subtractions.
+
+        const __m256i mustBeContinuation = _mm256_and_si256(
+                      _mm256_or_si256(_mm256_subs_epu8(prev2, thirdByteBias),
+                                      _mm256_subs_epu8(prev3, fourthByteBias)),
+                      highBit);
+
+        const __m256i error = _mm256_xor_si256(mustBeContinuation, special);
+
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
+
+        // Bytes greater than '0xbf' as signed characters are not continuation
+        // bytes.
+
+        const __m256i      isLead   = _mm256_cmpgt_epi8(input,
+                                                        maxContinuation);
+        const unsigned int leadMask = static_cast<unsigned int>(
+                                                _mm256_movemask_epi8(isLead));
+
+        const bsls::Types::IntPtr newNumLeadBytes =
+                                  numLeadBytes + __builtin_popcount(leadMask);
+
+        // Find the start of a code point that is incomplete at the end of the
+        // block.
+
+        const unsigned char *blockEnd =
+                            reinterpret_cast<const unsigned char *>(pc + 32);
+        int numTrailing = 0;
+        if (blockEnd[-1] >= 0xc0) {
+            numTrailing = 1;
+        }
+        else if (blockEnd[-2] >= 0xe0) {
+            numTrailing = 2;
+        }
+        else if (blockEnd[-3] >= 0xf0) {
+            numTrailing = 3;
+        }
+
+        const bsls::Types::IntPtr newCommittedCount =
+                                 newNumLeadBytes - (numTrailing ? 1 : 0);
+        if (newCommittedCount > maxNumCodePoints) {
+            break;
+        }
+
+        pc             += 32;
+        numLeadBytes    = newNumLeadBytes;
+        committed       = pc - numTrailing;
+        committedCount  = newCommittedCount;
+        previousInput   = input;
+    }
+
+    *numCodePoints = committedCount;
+    return committed;
+}
+
+static
+bool detectAvx2()
+    // Return 'true' if the processor supports the AVX2 instructions, and
+    // 'false' otherwise.
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+static const bool s_hasAvx2 = detectAvx2();
+    // 'true' if the processor supports the AVX2 instructions.
+
+#endif // defined(BDLDE_UTF8UTIL_SIMD)
+
+static inline
+const char *validPrefix(bsls::Types::IntPtr *numCodePoints,
+                        const char          *string,
+                        const char          *end,
+                        bsls::Types::IntPtr  maxNumCodePoints =
+                               bsl::numeric_limits<bsls::Types::IntPtr>::max())
+    // Return the address of the end of a prefix of the specified 'string',
+    // ending before the specified 'end' and containing at most the optionally
+    // specified 'maxNumCodePoints' Unicode code points, that is valid UTF-8
+    // (as checked by 'validateAndCountCodePoints'), and load the number of
+    // code points in that prefix into the specified 'numCodePoints'.  Note
+    // that the prefix is not necessarily the longest valid one; in
+    // particular, it is empty on platforms where no vectorized implementation
+    // is available, and the scalar implementations below resume from the
+    // returned address, so the results do not depend on the prefix found.
+{
+#if defined(BDLDE_UTF8UTIL_SIMD)
+    return s_hasAvx2
+           ? avx2ValidPrefix(numCodePoints, string, end, maxNumCodePoints)
+           : sse2ValidPrefix(numCodePoints, string, end, maxNumCodePoints);
+#else
+    (void)end;
+    (void)maxNumCodePoints;
+
+    *numCodePoints = 0;
+    return string;
+#endif
+}
+
+static inline
+const char *validPrefixOfCString(bsls::Types::IntPtr *numCodePoints,
+                                 const char          *string,
+                                 bsls::Types::IntPtr  maxNumCodePoints =
+                               bsl::numeric_limits<bsls::Types::IntPtr>::max())
+    // Return the address of the end of a prefix of the specified
+    // null-terminated 'string', containing at most the optionally specified
+    // 'maxNumCodePoints' Unicode code points, that is valid UTF-8, and load
+    // the number of code points in that prefix into the specified
+    // 'numCodePoints'.  See 'validPrefix'.
+{
+#if defined(BDLDE_UTF8UTIL_SIMD)
+    // No more than '4 * maxNumCodePoints' bytes can be consumed; avoid
+    // scanning further for the terminating null byte.
+
+    const bsls::Types::IntPtr maxLength =
+                    maxNumCodePoints
+                  < bsl::numeric_limits<bsls::Types::IntPtr>::max() / 4
+                    ? 4 * maxNumCodePoints
+                    : bsl::numeric_limits<bsls::Types::IntPtr>::max();
+
+    return validPrefix(numCodePoints,
+                       string,
+                       string + ::strnlen(string,
+                                          static_cast<bsl::size_t>(maxLength)),
+                       maxNumCodePoints);
+#else
+    (void)maxNumCodePoints;
+
+    *numCodePoints = 0;
+    return string;
+#endif
+}
+
 static
 int validateAndCountCodePoints(const char **invalidString, const char *string)
     // Return the number of Unicode code points in the specified 'string' if it
@@ -155,7 +595,10 @@ int validateAndCountCodePoints(const char **invalidString, const char *string)
     BSLS_ASSERT_SAFE(invalidString);
     BSLS_ASSERT_SAFE(string);
 
-    int count = 0;
+    bsls::Types::IntPtr prefixCount;
+    string = validPrefixOfCString(&prefixCount, string);
+
+    int count = static_cast<int>(prefixCount);
 
     while (true) {
         switch ((*string >> 4) & 0xf) {
@@ -259,10 +702,14 @@ static int validateAndCountCodePoints(const char             **invalidString,
     BSLS_ASSERT_SAFE(string);
     BSLS_ASSERT_SAFE(0 <= bsls::Types::IntPtr(length));
 
-    const char       *pc     = string;
     const char *const pcEnd4 = string + length - 4;
 
-    int count = 0;
+    bsls::Types::IntPtr prefixCount;
+    const char         *pc = validPrefix(&prefixCount,
+                                         string,
+                                         string + length);
+
+    int count = static_cast<int>(prefixCount);
 
     while (pc <= pcEnd4) {
         switch ((*pc >> 4) & 0xf) {
@@ -425,6 +872,8 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
                               // code point, and assigned to 'string' between
                               // iterations.
 
+    string = validPrefixOfCString(&ret, string, numCodePoints);
+
     // Note that we keep 'string' pointing to the beginning of the Unicode
     // code point being processed, and only advance it to the next code point
     // between iterations.
@@ -609,6 +1058,8 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
 
     const char * const endOfInput = string + length;
 
+    string = validPrefix(&ret, string, endOfInput, numCodePoints);
+
     // Note that we keep 'string' pointing to the beginning of the Unicode
     // code point being processed, and only advance it to the next code point
     // between iterations.
@@ -59,6 +59,13 @@ BSLS_IDENT("$Id: $")
 // explicit length argument.  Naturally, null-terminated C-style strings cannot
 // contain embedded null code points.
 //
+// On x86-64 platforms, 'isValid', 'numCodePointsIfValid', and 'advanceIfValid'
+// validate their input 32 bytes at a time using AVX2 instructions if the
+// processor supports them (as detected at runtime), and otherwise skip runs of
+// ASCII characters 16 bytes at a time using SSE2 instructions.  The results
+// are identical to those of the byte-by-byte implementation used on other
+// platforms.
+//
 // The UTF-8 format is described in the RFC 3629 document at:
 //..
 //  http://tools.ietf.org/html/rfc3629
@@ -14,6 +14,7 @@
 #include <bslim_testutil.h>
 
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -57,6 +58,9 @@ using bsl::size_t;
 //: o Test case 10 Test 'numBytesIfValid'.
 //: o Test case 11 Test 'getByteSize'.
 //: o Test case 12 Test 'appendUtf8Character'.
+//: o Test case 13 Test that the validating functions, which use vectorized
+//:   implementations on some platforms, agree with a byte-by-byte reference
+//:   implementation on long strings.
 //-----------------------------------------------------------------------------
 // CLASS METHODS
 // [12] int appendUtf8Character(bsl::string *, unsigned int);
@@ -97,11 +101,13 @@ using bsl::size_t;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
-// [13] USAGE EXAMPLE 1
-// [14] USAGE EXAMPLE 2
+// [14] USAGE EXAMPLE 1
+// [15] USAGE EXAMPLE 2
 // [ 9] 'advanceIfValid' on correct input followed by incorrect input
+// [13] VALIDATION OF LONG STRINGS AGAINST A REFERENCE IMPLEMENTATION
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] VALIDATION THROUGHPUT BENCHMARK
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -2525,6 +2531,278 @@ namespace USAGE {
 
 }  // close namespace USAGE
 
+// ============================================================================
+//                       HELPER DEFINITIONS FOR TEST 13
+// ----------------------------------------------------------------------------
+
+namespace BDEDE_UTF8UTIL_CASE_13 {
+
+int refSequenceLength(const char  *pc,
+                      bsl::size_t  length,
+                      bool         allowTooLarge = false)
+    // Return the length of the UTF-8 sequence at the specified 'pc', having
+    // the specified 'length' bytes available, if it encodes a valid Unicode
+    // code point per RFC 3629, and 0 otherwise.  If the optionally specified
+    // 'allowTooLarge' is 'true', 4-byte sequences encoding values above
+    // 'U+10ffff' are deemed valid.  The behavior is undefined unless
+    // '0 < length'.  Note that this function is a straightforward reference
+    // implementation against which the component is tested.
+{
+    const unsigned char *upc = reinterpret_cast<const unsigned char *>(pc);
+
+    unsigned int value;
+    unsigned int minValue;
+    bsl::size_t  sequenceLength;
+
+    if (upc[0] < 0x80) {
+        return 1;                                                     // RETURN
+    }
+    else if (upc[0] < 0xc0) {
+        return 0;                                                     // RETURN
+    }
+    else if (upc[0] < 0xe0) {
+        sequenceLength = 2;
+        minValue       = 0x80;
+        value          = upc[0] & 0x1f;
+    }
+    else if (upc[0] < 0xf0) {
+        sequenceLength = 3;
+        minValue       = 0x800;
+        value          = upc[0] & 0xf;
+    }
+    else if (upc[0] < 0xf8) {
+        sequenceLength = 4;
+        minValue       = 0x10000;
+        value          = upc[0] & 0x7;
+    }
+    else {
+        return 0;                                                     // RETURN
+    }
+
+    if (length < sequenceLength) {
+        return 0;                                                     // RETURN
+    }
+
+    for (bsl::size_t ii = 1; ii < sequenceLength; ++ii) {
+        if (0x80 != (upc[ii] & 0xc0)) {
+            return 0;                                                 // RETURN
+        }
+        value = (value << 6) | (upc[ii] & 0x3f);
+    }
+
+    if (value < minValue
+     || (value > 0x10ffff && !allowTooLarge)
+     || (value >= 0xd800 && value <= 0xdfff)) {
+        return 0;                                                     // RETURN
+    }
+
+    return static_cast<int>(sequenceLength);
+}
+
+Obj::IntPtr refNumCodePointsIfValid(const char  **invalidString,
+                                    const char   *string,
+                                    bsl::size_t   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if it is valid UTF-8, and a negative
+    // value otherwise, loading the address of the first invalid sequence into
+    // the specified 'invalidString'.
+{
+    const char *const end   = string + length;
+    Obj::IntPtr       count = 0;
+
+    while (string < end) {
+        const int sequenceLength = refSequenceLength(string, end - string);
+        if (0 == sequenceLength) {
+            *invalidString = string;
+            return -1;                                                // RETURN
+        }
+        string += sequenceLength;
+        ++count;
+    }
+
+    return count;
+}
+
+Obj::IntPtr refAdvanceIfValid(int          *status,
+                              const char  **result,
+                              const char   *string,
+                              bsl::size_t   length,
+                              Obj::IntPtr   numCodePoints)
+    // Advance over at most the specified 'numCodePoints' valid Unicode code
+    // points of the specified 'string' having the specified 'length', load
+    // the address of the end of the code points advanced over into the
+    // specified 'result', load into the specified 'status' 0 if
+    // 'numCodePoints' code points were advanced over or the end of 'string'
+    // was reached, and a negative value otherwise, and return the number of
+    // code points advanced over.  Note that, like 'Obj::advanceIfValid', this
+    // function does not detect 4-byte sequences encoding values above
+    // 'U+10ffff'.
+{
+    const char *const end = string + length;
+    Obj::IntPtr       ret = 0;
+
+    *status = 0;
+    for (; ret < numCodePoints && string < end; ++ret) {
+        const int sequenceLength = refSequenceLength(string,
+                                                     end - string,
+                                                     true);
+        if (0 == sequenceLength) {
+            *status = -1;
+            break;
+        }
+        string += sequenceLength;
+    }
+
+    *result = string;
+    return ret;
+}
+
+void verifyAgainstReference(int line, const bsl::string& str)
+    // Verify that the validating functions of 'Obj' applied to the specified
+    // 'str' agree with the reference implementations above, reporting
+    // failures with the specified 'line'.  The behavior is undefined unless
+    // 'str' contains no null bytes.
+{
+    const char        *DATA   = str.data();
+    const bsl::size_t  LENGTH = str.length();
+
+    const char        *expInvalid = 0;
+    const Obj::IntPtr  EXP_COUNT  = refNumCodePointsIfValid(&expInvalid,
+                                                            DATA,
+                                                            LENGTH);
+
+    const char *invalid = 0;
+    ASSERTV(line, LENGTH, (0 <= EXP_COUNT) == Obj::isValid(&invalid,
+                                                           DATA,
+                                                           LENGTH));
+    if (EXP_COUNT < 0) {
+        ASSERTV(line, LENGTH, expInvalid - DATA, invalid - DATA,
+                expInvalid == invalid);
+    }
+
+    invalid = 0;
+    ASSERTV(line, LENGTH, (0 <= EXP_COUNT) == Obj::isValid(&invalid,
+                                                           str.c_str()));
+    if (EXP_COUNT < 0) {
+        ASSERTV(line, LENGTH, expInvalid - DATA, invalid - DATA,
+                expInvalid == invalid);
+    }
+
+    invalid = 0;
+    Obj::IntPtr count = Obj::numCodePointsIfValid(&invalid, DATA, LENGTH);
+    ASSERTV(line, LENGTH, EXP_COUNT, count, (EXP_COUNT < 0) == (count < 0));
+    if (EXP_COUNT < 0) {
+        ASSERTV(line, LENGTH, expInvalid - DATA, invalid - DATA,
+                expInvalid == invalid);
+    }
+    else {
+        ASSERTV(line, LENGTH, EXP_COUNT, count, EXP_COUNT == count);
+    }
+
+    invalid = 0;
+    count   = Obj::numCodePointsIfValid(&invalid, str.c_str());
+    ASSERTV(line, LENGTH, EXP_COUNT, count, (EXP_COUNT < 0) == (count < 0));
+    if (EXP_COUNT < 0) {
+        ASSERTV(line, LENGTH, expInvalid - DATA, invalid - DATA,
+                expInvalid == invalid);
+    }
+    else {
+        ASSERTV(line, LENGTH, EXP_COUNT, count, EXP_COUNT == count);
+    }
+
+    int               expStatus;
+    const char       *expResult;
+    const Obj::IntPtr NUM_VALID = refAdvanceIfValid(&expStatus,
+                                                    &expResult,
+                                                    DATA,
+                                                    LENGTH,
+                                                    INT_MAX);
+
+    const Obj::IntPtr NUM_CODE_POINTS[] = {
+        0, 1, NUM_VALID / 2, NUM_VALID - 1, NUM_VALID, NUM_VALID + 1, INT_MAX
+    };
+    const int NUM_NUM_CODE_POINTS = static_cast<int>(
+                         sizeof NUM_CODE_POINTS / sizeof *NUM_CODE_POINTS);
+
+    for (int ti = 0; ti < NUM_NUM_CODE_POINTS; ++ti) {
+        const Obj::IntPtr N = NUM_CODE_POINTS[ti];
+
+        if (N < 0) {
+            continue;
+        }
+
+        const Obj::IntPtr EXP_RET = refAdvanceIfValid(&expStatus,
+                                                      &expResult,
+                                                      DATA,
+                                                      LENGTH,
+                                                      N);
+
+        int         status = 99;
+        const char *result = 0;
+        Obj::IntPtr ret    = Obj::advanceIfValid(&status,
+                                                 &result,
+                                                 DATA,
+                                                 LENGTH,
+                                                 N);
+        ASSERTV(line, LENGTH, N, EXP_RET, ret, EXP_RET == ret);
+        ASSERTV(line, LENGTH, N, expStatus, status,
+                (0 == expStatus) == (0 == status));
+        ASSERTV(line, LENGTH, N, expResult - DATA, result - DATA,
+                expResult == result);
+
+        status = 99;
+        result = 0;
+        ret    = Obj::advanceIfValid(&status, &result, str.c_str(), N);
+        ASSERTV(line, LENGTH, N, EXP_RET, ret, EXP_RET == ret);
+        ASSERTV(line, LENGTH, N, expStatus, status,
+                (0 == expStatus) == (0 == status));
+        ASSERTV(line, LENGTH, N, expResult - DATA, result - DATA,
+                expResult == result);
+    }
+}
+
+bsl::string makeCorpus(bsl::size_t length, int asciiPercent, int cjkPercent)
+    // Return a valid UTF-8 string of at least the specified 'length' bytes in
+    // which approximately the specified 'asciiPercent' percent of the code
+    // points are printable ASCII characters, approximately the specified
+    // 'cjkPercent' percent are CJK ideographs (encoded in 3 bytes), and the
+    // remaining ones are random 2-, 3-, or 4-byte code points.
+{
+    bsl::string ret;
+    ret.reserve(length + 4);
+
+    // Note that the low-order bits of 'randUnsigned' are not very random.
+
+    while (ret.length() < length) {
+        const int r = static_cast<int>((randUnsigned() >> 16) % 100);
+
+        if (r < asciiPercent) {
+            ret.push_back(
+                        static_cast<char>(' ' + (randUnsigned() >> 16) % 95));
+        }
+        else if (r < asciiPercent + cjkPercent) {
+            ret += utf8Encode(0x4e00 + (randUnsigned() >> 16) % 0x5200);
+        }
+        else {
+            switch ((randUnsigned() >> 16) % 3) {
+              case 0: {
+                appendRand2Byte(&ret);
+              } break;
+              case 1: {
+                appendRand3Byte(&ret);
+              } break;
+              default: {
+                appendRand4Byte(&ret);
+              } break;
+            }
+        }
+    }
+
+    return ret;
+}
+
+}  // close namespace BDEDE_UTF8UTIL_CASE_13
+
 // ============================================================================
 //                       HELPER DEFINITIONS FOR TEST 4
 // ----------------------------------------------------------------------------
@@ -2802,7 +3080,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -2913,7 +3191,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
@@ -3012,6 +3290,125 @@ int main(int argc, char *argv[])
     ASSERT(false == bdlde::Utf8Util::isValid(stringWithOverlong.c_str()));
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // VALIDATION OF LONG STRINGS AGAINST A REFERENCE IMPLEMENTATION
+        //
+        // Concerns:
+        //: 1 On platforms where the validating functions use vectorized
+        //:   implementations, which process blocks of 16 or 32 bytes, their
+        //:   results are identical to those of a byte-by-byte implementation,
+        //:   regardless of where in the string (and in particular, relative
+        //:   to block boundaries) multi-byte sequences and invalid sequences
+        //:   are located.
+        //:
+        //: 2 A code point straddling the end of the input, or the boundary
+        //:   of a block, is handled correctly.
+        //:
+        //: 3 The limit on the number of code points to advance over is
+        //:   honored exactly by 'advanceIfValid'.
+        //
+        // Plan:
+        //: 1 Generate valid strings several blocks long that are entirely
+        //:   ASCII, mostly ASCII, mostly CJK ideographs, and random mixtures
+        //:   of 1-, 2-, 3-, and 4-byte sequences.
+        //:
+        //: 2 For each string and each of its prefixes, verify that 'isValid',
+        //:   'numCodePointsIfValid', and 'advanceIfValid' (for various
+        //:   numbers of code points) agree with straightforward reference
+        //:   implementations.  (C-2..3)
+        //:
+        //: 3 For each string, insert, at every position, each of a table of
+        //:   invalid sequences, and repeat the verification of P-2.  (C-1)
+        //
+        // Testing:
+        //   VALIDATION OF LONG STRINGS AGAINST A REFERENCE IMPLEMENTATION
+        // --------------------------------------------------------------------
+
+        using namespace BDEDE_UTF8UTIL_CASE_13;
+
+        if (verbose) cout << "VALIDATION OF LONG STRINGS AGAINST A REFERENCE"
+                             " IMPLEMENTATION\n"
+                             "==============================================="
+                             "===============\n";
+
+        static const struct {
+            int         d_line;        // source line number
+            const char *d_invalid_p;   // invalid sequence
+        } INVALID[] = {
+            //LINE  INVALID
+            //----  -------
+            { L_,   "\x80" },
+            { L_,   "\xbf\xbf" },
+            { L_,   "\xc0\x80" },
+            { L_,   "\xc1\xbf" },
+            { L_,   "\xc2" },
+            { L_,   "\xc2\x41" },
+            { L_,   "\xdf\xc0" },
+            { L_,   "\xe0\x80\x80" },
+            { L_,   "\xe0\x9f\xbf" },
+            { L_,   "\xe1\x80" },
+            { L_,   "\xe1\xc0\x80" },
+            { L_,   "\xed\xa0\x80" },
+            { L_,   "\xed\xbf\xbf" },
+            { L_,   "\xf0\x80\x80\x80" },
+            { L_,   "\xf0\x8f\xbf\xbf" },
+            { L_,   "\xf0\x90\x80" },
+            { L_,   "\xf1\x80\x80\x41" },
+            { L_,   "\xf4\x90\x80\x80" },
+            { L_,   "\xf5\x80\x80\x80" },
+            { L_,   "\xf7\xbf\xbf\xbf" },
+            { L_,   "\xf8\x88\x80\x80\x80" },
+            { L_,   "\xfe" },
+            { L_,   "\xff" },
+        };
+        const int NUM_INVALID = static_cast<int>(sizeof INVALID /
+                                                 sizeof *INVALID);
+
+        static const struct {
+            int d_line;           // source line number
+            int d_asciiPercent;   // percentage of ASCII code points
+            int d_cjkPercent;     // percentage of CJK ideographs
+        } CORPORA[] = {
+            //LINE  ASCII  CJK
+            //----  -----  ---
+            { L_,   100,     0 },
+            { L_,    95,     0 },
+            { L_,    10,    90 },
+            { L_,     0,     0 },
+            { L_,    50,    25 },
+        };
+        const int NUM_CORPORA = static_cast<int>(sizeof CORPORA /
+                                                 sizeof *CORPORA);
+
+        for (int ci = 0; ci < NUM_CORPORA; ++ci) {
+            const int         LINE   = CORPORA[ci].d_line;
+            const bsl::string CORPUS = makeCorpus(
+                                                 200,
+                                                 CORPORA[ci].d_asciiPercent,
+                                                 CORPORA[ci].d_cjkPercent);
+
+            if (veryVerbose) {
+                T_ P_(LINE) P(CORPUS.length());
+            }
+
+            for (bsl::size_t len = 0; len <= CORPUS.length(); ++len) {
+                verifyAgainstReference(LINE, CORPUS.substr(0, len));
+            }
+
+            for (int ii = 0; ii < NUM_INVALID; ++ii) {
+                const int   INV_LINE = INVALID[ii].d_line;
+                const char *INV      = INVALID[ii].d_invalid_p;
+
+                for (bsl::size_t pos = 0; pos <= CORPUS.length(); ++pos) {
+                    bsl::string str = CORPUS;
+                    str.insert(pos, INV);
+
+                    verifyAgainstReference(INV_LINE, str);
+                }
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING 'appendUtf8Character'
@@ -5059,6 +5456,122 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // VALIDATION THROUGHPUT BENCHMARK
+        //
+        // Concerns:
+        //: 1 Report the throughput of the validating functions on
+        //:   ASCII-heavy and CJK-heavy text, compared to that of a
+        //:   byte-by-byte reference implementation.
+        //
+        // Plan:
+        //: 1 Generate a valid corpus of 1 MiB that is mostly ASCII with an
+        //:   occasional multi-byte code point (as is typical of JSON or XML
+        //:   messages), one that is mostly CJK ideographs with some ASCII
+        //:   punctuation, and one that is entirely ASCII.
+        //:
+        //: 2 Time a number of calls to 'isValid', 'numCodePointsIfValid', and
+        //:   'advanceIfValid' on each corpus, and to the reference
+        //:   implementation of test case 13, and report the throughput of
+        //:   each in MB/s.
+        //
+        // Testing:
+        //   VALIDATION THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        using namespace BDEDE_UTF8UTIL_CASE_13;
+
+        if (verbose) cout << "VALIDATION THROUGHPUT BENCHMARK\n"
+                             "===============================\n";
+
+        const bsl::size_t k_CORPUS_LENGTH = 1024 * 1024;
+        const int         k_NUM_ITERS     = 100;
+
+        static const struct {
+            const char *d_name;           // corpus name
+            int         d_asciiPercent;   // percentage of ASCII code points
+            int         d_cjkPercent;     // percentage of CJK ideographs
+        } CORPORA[] = {
+            { "ASCII only",  100,  0 },
+            { "ASCII heavy",  99,  0 },
+            { "CJK heavy",    10, 90 },
+        };
+        const int NUM_CORPORA = static_cast<int>(sizeof CORPORA /
+                                                 sizeof *CORPORA);
+
+        for (int ci = 0; ci < NUM_CORPORA; ++ci) {
+            const bsl::string CORPUS = makeCorpus(
+                                                 k_CORPUS_LENGTH,
+                                                 CORPORA[ci].d_asciiPercent,
+                                                 CORPORA[ci].d_cjkPercent);
+
+            const char        *DATA   = CORPUS.data();
+            const bsl::size_t  LENGTH = CORPUS.length();
+            const double       MB     = static_cast<double>(LENGTH)
+                                      * k_NUM_ITERS / (1024 * 1024);
+
+            const char  *invalid = 0;
+            const char  *result  = 0;
+            int          status  = 0;
+            Obj::IntPtr  sum     = 0;
+
+            bsls::Stopwatch sw;
+
+            cout << CORPORA[ci].d_name << " (" << LENGTH << " bytes, "
+                 << Obj::numCodePointsRaw(DATA, LENGTH) << " code points)\n";
+
+            sw.start();
+            for (int ii = 0; ii < k_NUM_ITERS; ++ii) {
+                sum += refNumCodePointsIfValid(&invalid, DATA, LENGTH);
+            }
+            sw.stop();
+            cout << "\treference:                  " << MB / sw.elapsedTime()
+                 << " MB/s\n";
+
+            sw.reset();
+            sw.start();
+            for (int ii = 0; ii < k_NUM_ITERS; ++ii) {
+                sum += Obj::isValid(&invalid, DATA, LENGTH);
+            }
+            sw.stop();
+            cout << "\tisValid:                    " << MB / sw.elapsedTime()
+                 << " MB/s\n";
+
+            sw.reset();
+            sw.start();
+            for (int ii = 0; ii < k_NUM_ITERS; ++ii) {
+                sum += Obj::isValid(&invalid, CORPUS.c_str());
+            }
+            sw.stop();
+            cout << "\tisValid (null-terminated):  " << MB / sw.elapsedTime()
+                 << " MB/s\n";
+
+            sw.reset();
+            sw.start();
+            for (int ii = 0; ii < k_NUM_ITERS; ++ii) {
+                sum += Obj::numCodePointsIfValid(&invalid, DATA, LENGTH);
+            }
+            sw.stop();
+            cout << "\tnumCodePointsIfValid:       " << MB / sw.elapsedTime()
+                 << " MB/s\n";
+
+            sw.reset();
+            sw.start();
+            for (int ii = 0; ii < k_NUM_ITERS; ++ii) {
+                sum += Obj::advanceIfValid(&status,
+                                           &result,
+                                           DATA,
+                                           LENGTH,
+                                           INT_MAX);
+            }
+            sw.stop();
+            cout << "\tadvanceIfValid:             " << MB / sw.elapsedTime()
+                 << " MB/s\n";
+
+            ASSERT(0 < sum);
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
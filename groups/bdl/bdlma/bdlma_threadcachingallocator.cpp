@@ -0,0 +1,481 @@
+// bdlma_threadcachingallocator.cpp                                   -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_concurrentpool.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+
+#include <new>           // placement 'new'
+
+namespace BloombergLP {
+namespace {
+
+enum {
+    k_DEFAULT_NUM_POOLS      = 10,
+    k_DEFAULT_BATCH_SIZE     = 32,
+    k_DEFAULT_MAX_CHUNK_SIZE = 32,
+    k_MIN_BLOCK_SIZE         = 8
+};
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                       // ----------------------------
+                       // class ThreadCachingAllocator
+                       // ----------------------------
+
+// PRIVATE TYPES
+union ThreadCachingAllocator::Header {
+    // This 'union' provides the header of every memory block dispensed by a
+    // 'ThreadCachingAllocator'.  While the block is allocated, the header
+    // records the pool from which it came; while the block is the first of a
+    // full stack held in a depot, the header links to the next stack.  In
+    // either case, the memory immediately following the header (i.e., the
+    // memory returned to the client) links to the next block of a stack while
+    // the block is free.
+
+    int                                  d_poolIdx;      // pool used for this
+                                                         // block, or -1 if
+                                                         // not pooled
+
+    Header                              *d_nextStack_p;  // next full stack in
+                                                         // a depot
+
+    bsls::AlignmentUtil::MaxAlignedType  d_dummy;        // force alignment
+
+    // MANIPULATORS
+    Header *& nextBlock()
+        // Return a reference providing modifiable access to the link to the
+        // next block of the stack containing this free block.
+    {
+        return *reinterpret_cast<Header **>(this + 1);
+    }
+};
+
+struct ThreadCachingAllocator::Stack {
+    // This 'struct' describes a singly-linked stack of free blocks.
+
+    Header *d_head_p;  // top of the stack, or 0 if empty
+    int     d_count;   // number of blocks in the stack
+};
+
+struct ThreadCachingAllocator::Depot {
+    // This 'struct' holds the full stacks of free blocks of one pool that are
+    // not cached by any thread.
+
+    bslmt::Mutex  d_mutex;     // protects 'd_stacks_p'
+    Header       *d_stacks_p;  // list of full stacks, linked through their
+                               // first block's header
+};
+
+struct ThreadCachingAllocator::ThreadCache {
+    // This 'struct' holds the loaded and previous stacks of one thread for
+    // every pool of a 'ThreadCachingAllocator'.  The '2 * numPools()' stacks
+    // immediately follow this 'struct' in memory.
+
+    ThreadCachingAllocator *d_allocator_p;  // owner of this cache
+    ThreadCache            *d_prev_p;       // previous cache in registry
+    ThreadCache            *d_next_p;       // next cache in registry
+    Stack                  *d_stacks_p;     // loaded stack of pool 'i' at
+                                            // '2 * i', previous stack at
+                                            // '2 * i + 1'
+};
+
+// PRIVATE CLASS METHODS
+void ThreadCachingAllocator::removeThreadCache(void *cache)
+{
+    ThreadCache *threadCache = static_cast<ThreadCache *>(cache);
+    threadCache->d_allocator_p->destroyThreadCache(threadCache);
+}
+
+// PRIVATE MANIPULATORS
+ThreadCachingAllocator::ThreadCache *
+ThreadCachingAllocator::createThreadCache()
+{
+    const int numStacks = 2 * d_numPools;
+
+    ThreadCache *cache = static_cast<ThreadCache *>(d_allocAdapter.allocate(
+                             sizeof(ThreadCache) + numStacks * sizeof(Stack)));
+
+    cache->d_allocator_p = this;
+    cache->d_prev_p      = 0;
+    cache->d_stacks_p    = reinterpret_cast<Stack *>(cache + 1);
+
+    for (int i = 0; i < numStacks; ++i) {
+        cache->d_stacks_p[i].d_head_p = 0;
+        cache->d_stacks_p[i].d_count  = 0;
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+        cache->d_next_p = d_caches_p;
+        if (d_caches_p) {
+            d_caches_p->d_prev_p = cache;
+        }
+        d_caches_p = cache;
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+
+    return cache;
+}
+
+void ThreadCachingAllocator::destroyThreadCache(ThreadCache *cache)
+{
+    for (int i = 0; i < d_numPools; ++i) {
+        Stack& loaded   = cache->d_stacks_p[2 * i];
+        Stack& previous = cache->d_stacks_p[2 * i + 1];
+
+        if (previous.d_count) {
+            pushStack(i, &previous);
+        }
+
+        if (d_batchSize == loaded.d_count) {
+            pushStack(i, &loaded);
+        }
+        else {
+            while (loaded.d_head_p) {
+                Header *block   = loaded.d_head_p;
+                loaded.d_head_p = block->nextBlock();
+                d_pools_p[i].deallocate(block);
+            }
+        }
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+        if (cache->d_prev_p) {
+            cache->d_prev_p->d_next_p = cache->d_next_p;
+        }
+        else {
+            d_caches_p = cache->d_next_p;
+        }
+        if (cache->d_next_p) {
+            cache->d_next_p->d_prev_p = cache->d_prev_p;
+        }
+    }
+
+    d_allocAdapter.deallocate(cache);
+}
+
+void ThreadCachingAllocator::initialize()
+{
+    BSLS_ASSERT(1 <= d_numPools);
+    BSLS_ASSERT(1 <= d_batchSize);
+
+    d_maxBlockSize = k_MIN_BLOCK_SIZE;
+
+    d_pools_p = static_cast<ConcurrentPool *>(
+                      d_allocAdapter.allocate(d_numPools * sizeof *d_pools_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoPoolsDeallocator(
+                                                              d_pools_p,
+                                                              &d_allocAdapter);
+    bslma::AutoDestructor<ConcurrentPool> autoPoolsDtor(d_pools_p, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoPoolsDtor) {
+        new (d_pools_p + i) ConcurrentPool(
+                             d_maxBlockSize + static_cast<int>(sizeof(Header)),
+                             bsls::BlockGrowth::BSLS_GEOMETRIC,
+                             k_DEFAULT_MAX_CHUNK_SIZE,
+                             &d_allocAdapter);
+
+        BSLS_ASSERT(d_maxBlockSize <=
+                       bsl::numeric_limits<bsls::Types::size_type>::max() / 2);
+
+        d_maxBlockSize *= 2;
+    }
+
+    d_maxBlockSize /= 2;
+
+    d_depots_p = static_cast<Depot *>(
+                     d_allocAdapter.allocate(d_numPools * sizeof *d_depots_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoDepotsDeallocator(
+                                                             d_depots_p,
+                                                             &d_allocAdapter);
+    bslma::AutoDestructor<Depot> autoDepotsDtor(d_depots_p, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoDepotsDtor) {
+        new (d_depots_p + i) Depot();
+        d_depots_p[i].d_stacks_p = 0;
+    }
+
+    int rc = bslmt::ThreadUtil::createKey(
+                     &d_cacheKey,
+                     (bslmt::ThreadUtil::Destructor)
+                     &ThreadCachingAllocator::removeThreadCache);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+
+    autoDepotsDtor.release();
+    autoDepotsDeallocator.release();
+    autoPoolsDtor.release();
+    autoPoolsDeallocator.release();
+}
+
+void ThreadCachingAllocator::pushStack(int poolIdx, Stack *stack)
+{
+    BSLS_ASSERT(d_batchSize == stack->d_count);
+
+    Depot& depot = d_depots_p[poolIdx];
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&depot.d_mutex);
+
+        stack->d_head_p->d_nextStack_p = depot.d_stacks_p;
+        depot.d_stacks_p               = stack->d_head_p;
+    }
+
+    stack->d_head_p = 0;
+    stack->d_count  = 0;
+}
+
+void ThreadCachingAllocator::refillStack(int poolIdx, Stack *stack)
+{
+    BSLS_ASSERT(0 == stack->d_count);
+
+    Depot& depot = d_depots_p[poolIdx];
+
+    Header *head;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&depot.d_mutex);
+
+        head = depot.d_stacks_p;
+        if (head) {
+            depot.d_stacks_p = head->d_nextStack_p;
+        }
+    }
+
+    if (head) {
+        stack->d_head_p = head;
+        stack->d_count  = d_batchSize;
+        return;                                                       // RETURN
+    }
+
+    // The depot is empty; carve a new stack from the pool.  Should the pool
+    // fail to replenish, the blocks obtained so far remain in 'stack'.
+
+    ConcurrentPool& pool = d_pools_p[poolIdx];
+    for (int i = 0; i < d_batchSize; ++i) {
+        Header *block    = static_cast<Header *>(pool.allocate());
+        block->nextBlock() = stack->d_head_p;
+        stack->d_head_p  = block;
+        ++stack->d_count;
+    }
+}
+
+// PRIVATE ACCESSORS
+inline
+int ThreadCachingAllocator::findPool(bsls::Types::size_type size) const
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(static_cast<bsl::uint32_t>(
+                                ((size + k_MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1));
+}
+
+// CREATORS
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_pools_p(0)
+, d_depots_p(0)
+, d_numPools(k_DEFAULT_NUM_POOLS)
+, d_batchSize(k_DEFAULT_BATCH_SIZE)
+, d_maxBlockSize(0)
+, d_caches_p(0)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize();
+}
+
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_pools_p(0)
+, d_depots_p(0)
+, d_numPools(numPools)
+, d_batchSize(k_DEFAULT_BATCH_SIZE)
+, d_maxBlockSize(0)
+, d_caches_p(0)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize();
+}
+
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              int               numPools,
+                                              int               batchSize,
+                                              bslma::Allocator *basicAllocator)
+: d_pools_p(0)
+, d_depots_p(0)
+, d_numPools(numPools)
+, d_batchSize(batchSize)
+, d_maxBlockSize(0)
+, d_caches_p(0)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize();
+}
+
+ThreadCachingAllocator::~ThreadCachingAllocator()
+{
+    // Once the key is deleted, no thread-exit cleanup can run for this
+    // allocator, so the caches of the threads still alive can be reclaimed.
+    // The blocks they hold belong to the pools, which are released below.
+
+    bslmt::ThreadUtil::deleteKey(d_cacheKey);
+
+    while (d_caches_p) {
+        ThreadCache *cache = d_caches_p;
+        d_caches_p = cache->d_next_p;
+        d_allocAdapter.deallocate(cache);
+    }
+
+    for (int i = 0; i < d_numPools; ++i) {
+        d_depots_p[i].~Depot();
+        d_pools_p[i].release();
+        d_pools_p[i].~ConcurrentPool();
+    }
+    d_allocAdapter.deallocate(d_depots_p);
+    d_allocAdapter.deallocate(d_pools_p);
+}
+
+// MANIPULATORS
+void *ThreadCachingAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size > d_maxBlockSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        Header *block = static_cast<Header *>(
+                               d_allocAdapter.allocate(sizeof(Header) + size));
+        block->d_poolIdx = -1;
+        return block + 1;                                             // RETURN
+    }
+
+    const int poolIdx = findPool(size);
+
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        cache = createThreadCache();
+    }
+
+    Stack& loaded = cache->d_stacks_p[2 * poolIdx];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == loaded.d_head_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        Stack& previous = cache->d_stacks_p[2 * poolIdx + 1];
+        if (previous.d_count) {
+            loaded            = previous;
+            previous.d_head_p = 0;
+            previous.d_count  = 0;
+        }
+        else {
+            refillStack(poolIdx, &loaded);
+        }
+    }
+
+    Header *block   = loaded.d_head_p;
+    loaded.d_head_p = block->nextBlock();
+    --loaded.d_count;
+
+    block->d_poolIdx = poolIdx;
+    return block + 1;
+}
+
+void ThreadCachingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header    *block   = static_cast<Header *>(address) - 1;
+    const int  poolIdx = block->d_poolIdx;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(-1 == poolIdx)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_allocAdapter.deallocate(block);
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT(0 <= poolIdx && poolIdx < d_numPools);
+
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // 'deallocate' must not throw: if no cache can be created for this
+        // thread, return the block directly to its pool.
+
+        BSLS_TRY {
+            cache = createThreadCache();
+        }
+        BSLS_CATCH(...) {
+            d_pools_p[poolIdx].deallocate(block);
+            return;                                                   // RETURN
+        }
+    }
+
+    Stack& loaded = cache->d_stacks_p[2 * poolIdx];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_batchSize == loaded.d_count)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        Stack& previous = cache->d_stacks_p[2 * poolIdx + 1];
+        if (previous.d_count) {
+            pushStack(poolIdx, &previous);
+        }
+        previous        = loaded;
+        loaded.d_head_p = 0;
+        loaded.d_count  = 0;
+    }
+
+    block->nextBlock() = loaded.d_head_p;
+    loaded.d_head_p  = block;
+    ++loaded.d_count;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,433 @@
+// bdlma_threadcachingallocator.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a pooling allocator having per-thread block caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingAllocator: multipool allocator with per-thread caches
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::ThreadCachingAllocator', that implements the 'bslma::Allocator'
+// protocol and that, like 'bdlma::ConcurrentMultipoolAllocator', dispenses
+// memory from a configurable number of 'bdlma::ConcurrentPool' objects, each
+// managing memory blocks of a unique size.  The pools are placed in an array,
+// starting at index 0, with each successive pool managing memory blocks of a
+// size twice that of the previous pool.  Requests for blocks larger than the
+// largest pooled size are forwarded directly to the underlying allocator.
+//..
+//   ,----------------------------.
+//  ( bdlma::ThreadCachingAllocator )
+//   `----------------------------'
+//                 |         ctor/dtor
+//                 |         batchSize
+//                 |         maxPooledBlockSize
+//                 |         numPools
+//                 V
+//         ,----------------.
+//        ( bslma::Allocator )
+//         `----------------'
+//                           allocate
+//                           deallocate
+//..
+// Unlike 'bdlma::ConcurrentMultipoolAllocator', in which every allocation and
+// deallocation operates on the free list shared by all threads, a
+// 'bdlma::ThreadCachingAllocator' places a small cache of free blocks in front
+// of each pool for every thread that uses the allocator.  Allocation and
+// deallocation requests are satisfied from the calling thread's cache without
+// any synchronization, and the shared state is touched only when a cache
+// becomes empty or full, and then a whole *batch* of blocks at a time.
+//
+///Caching Strategy
+///----------------
+// The caching scheme follows the "magazine" design: for every pool, each
+// thread owns two singly-linked stacks of free blocks, a *loaded* stack and a
+// *previous* stack, each holding at most 'batchSize()' blocks.  Blocks are
+// allocated from, and deallocated to, the loaded stack.  When the loaded stack
+// is empty on allocation, it is exchanged with the previous stack if that one
+// is full; when the loaded stack is full on deallocation, it is exchanged
+// with the previous stack if that one is empty.  Only when neither exchange is
+// possible does the thread visit a per-pool *depot* of full stacks (each
+// holding exactly 'batchSize()' blocks), protected by a mutex:
+//
+//: o An allocation that finds both stacks empty takes a full stack from the
+//:   depot or, if the depot is empty, allocates 'batchSize()' blocks from the
+//:   shared 'bdlma::ConcurrentPool'.
+//:
+//: o A deallocation that finds both stacks full hands the previous stack to
+//:   the depot.
+//
+// Hence a thread that alternates between allocating and deallocating never
+// leaves its cache, and even in the worst case at most one mutex acquisition
+// is made for every 'batchSize()' operations.  In particular, when blocks are
+// allocated by a "producer" thread and deallocated by a "consumer" thread,
+// full stacks migrate from the consumer to the producer through the depot
+// without ever touching the shared pool free lists.
+//
+// Each thread's cache is created on the first allocation (or deallocation)
+// made by that thread, and is destroyed when the thread exits: complete
+// stacks are returned to the depot and the remaining blocks to their pool.
+// Note that at most '2 * batchSize()' blocks per pool are retained in the
+// cache of any one thread.
+//
+///Configuration at Construction
+///-----------------------------
+// When creating a 'bdlma::ThreadCachingAllocator', clients can optionally
+// configure:
+//
+//: 1 NUMBER OF POOLS -- the number of internal pools (the block size managed
+//:   by the first pool is eight bytes, with each successive pool managing
+//:   blocks of a size twice that of the previous pool).
+//:
+//: 2 BATCH SIZE -- the number of blocks moved at once between a thread cache
+//:   and the shared state of the allocator.
+//:
+//: 3 BASIC ALLOCATOR -- the allocator used to supply memory (to replenish an
+//:   internal pool, to create thread caches, or directly if the maximum block
+//:   size is exceeded).  If not specified, the currently installed default
+//:   allocator (see 'bslma_default') is used.
+//
+// A default-constructed thread-caching allocator has a relatively small,
+// implementation-defined number of pools 'N' with respective block sizes
+// ranging from '2^3 = 8' to '2^(N+2)', and an implementation-defined batch
+// size.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ThreadCachingAllocator' is fully thread-safe (see
+// 'bsldoc_glossary'): 'allocate' and 'deallocate' may be called concurrently
+// from any number of threads, and a block may be deallocated by a thread
+// other than the one that allocated it.  The underlying allocator need not be
+// thread-safe, as all access to it is serialized.  The behavior is undefined
+// if the allocator is destroyed while another thread is accessing it *or* is
+// exiting after having accessed it.
+//
+// Each 'bdlma::ThreadCachingAllocator' object consumes one thread-specific
+// storage key (see 'bslmt::ThreadUtil::createKey') for its lifetime; such keys
+// are a limited resource, so these allocators are intended to be long-lived
+// objects shared by many threads rather than created in large numbers.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Threads
+///- - - - - - - - - - - - - - - - - - - - - -
+// A common source of contention in a multipool allocator is the pattern in
+// which one thread allocates messages and another thread consumes and frees
+// them: every deallocation by the consumer and every allocation by the
+// producer operates on the same shared free list.  A
+// 'bdlma::ThreadCachingAllocator' turns this traffic into the occasional
+// exchange of batches of blocks.
+//
+// First, we define a trivial message queue whose nodes are supplied by the
+// allocator under test:
+//..
+//  class MessageQueue {
+//      // This class provides a thread-safe queue of 'int' messages.
+//
+//      // DATA
+//      bsl::deque<int *> d_queue;      // queued messages
+//      bslmt::Mutex      d_mutex;      // protects 'd_queue'
+//      bslmt::Condition  d_condition;  // signaled on push
+//
+//    public:
+//      // CREATORS
+//      explicit MessageQueue(bslma::Allocator *basicAllocator = 0)
+//      : d_queue(basicAllocator)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      void push(int *message)
+//      {
+//          bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+//          d_queue.push_back(message);
+//          d_condition.signal();
+//      }
+//
+//      int *pop()
+//      {
+//          bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+//          while (d_queue.empty()) {
+//              d_condition.wait(&d_mutex);
+//          }
+//          int *message = d_queue.front();
+//          d_queue.pop_front();
+//          return message;
+//      }
+//  };
+//..
+// Then, we define a consumer that frees every message it receives, until it
+// receives a negative value:
+//..
+//  struct Consumer {
+//      // This 'struct' defines a functor that consumes messages.
+//
+//      MessageQueue     *d_queue_p;      // source of messages
+//      bslma::Allocator *d_allocator_p;  // allocator of messages
+//      int              *d_sum_p;        // sum of consumed values
+//
+//      void operator()()
+//      {
+//          while (true) {
+//              int *message = d_queue_p->pop();
+//              int  value   = *message;
+//              d_allocator_p->deallocate(message);
+//              if (0 > value) {
+//                  break;
+//              }
+//              *d_sum_p += value;
+//          }
+//      }
+//  };
+//..
+// Now, we create the allocator, the queue, and a consumer thread:
+//..
+//  bdlma::ThreadCachingAllocator allocator;
+//  MessageQueue                  queue;
+//
+//  int      sum      = 0;
+//  Consumer consumer = { &queue, &allocator, &sum };
+//
+//  bslmt::ThreadUtil::Handle handle;
+//  bslmt::ThreadUtil::create(&handle, consumer);
+//..
+// Finally, the main thread produces messages; the blocks freed by the consumer
+// find their way back to the main thread's cache in batches:
+//..
+//  for (int i = 1; i <= 1000; ++i) {
+//      int *message = static_cast<int *>(allocator.allocate(sizeof(int)));
+//      *message = i;
+//      queue.push(message);
+//  }
+//  int *last = static_cast<int *>(allocator.allocate(sizeof(int)));
+//  *last = -1;
+//  queue.push(last);
+//
+//  bslmt::ThreadUtil::join(handle);
+//  assert(500500 == sum);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentallocatoradapter.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+class ConcurrentPool;
+
+                       // ============================
+                       // class ThreadCachingAllocator
+                       // ============================
+
+class ThreadCachingAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol to provide a
+    // thread-safe allocator that maintains a configurable number of
+    // 'bdlma::ConcurrentPool' objects, each dispensing memory blocks of a
+    // unique size, fronted by a per-thread cache of free blocks for each pool.
+    // Blocks are moved between a thread's cache and the shared pools in
+    // batches of a configurable size.  Requests for blocks larger than the
+    // largest pooled size are satisfied directly by the underlying allocator.
+    // All memory allocated via this object is released on destruction.
+
+    // PRIVATE TYPES
+    union Header;        // header preceding every block
+
+    struct Stack;        // stack of free blocks
+
+    struct Depot;        // per-pool repository of full stacks
+
+    struct ThreadCache;  // per-thread stacks for every pool
+
+    // DATA
+    ConcurrentPool         *d_pools_p;       // array of memory pools, each
+                                             // dispensing fixed-size blocks
+
+    Depot                  *d_depots_p;      // array of depots, one per pool
+
+    int                     d_numPools;      // number of memory pools
+
+    int                     d_batchSize;     // number of blocks in a full
+                                             // stack
+
+    bsls::Types::size_type  d_maxBlockSize;  // largest pooled block size
+
+    bslmt::ThreadUtil::Key  d_cacheKey;      // key for the calling thread's
+                                             // 'ThreadCache'
+
+    ThreadCache            *d_caches_p;      // list of live thread caches
+
+    bslmt::Mutex            d_cachesMutex;   // protects 'd_caches_p'
+
+    bslmt::Mutex            d_mutex;         // serializes use of the
+                                             // underlying allocator
+
+    ConcurrentAllocatorAdapter
+                            d_allocAdapter;  // thread-enabled adapter for the
+                                             // underlying allocator
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingAllocator(const ThreadCachingAllocator&);
+    ThreadCachingAllocator& operator=(const ThreadCachingAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static void removeThreadCache(void *cache);
+        // Return the blocks held by the specified 'cache' to the allocator
+        // that owns it and destroy 'cache'.  This function is registered as
+        // the cleanup function of the thread-specific key holding 'cache',
+        // and so is invoked on exit of the thread owning 'cache'.
+
+    // PRIVATE MANIPULATORS
+    ThreadCache *createThreadCache();
+        // Create a cache for the calling thread, register it with this
+        // allocator and as the value of the thread-specific key of this
+        // allocator, and return its address.
+
+    void destroyThreadCache(ThreadCache *cache);
+        // Return the blocks held by the specified 'cache' to the depots and
+        // pools of this allocator, unregister 'cache', and deallocate it.
+
+    void initialize();
+        // Create the pools and depots of this allocator and the
+        // thread-specific key used to locate thread caches.
+
+    void pushStack(int poolIdx, Stack *stack);
+        // Move the full specified 'stack' of blocks from the pool having the
+        // specified 'poolIdx' to the corresponding depot, and leave 'stack'
+        // empty.
+
+    void refillStack(int poolIdx, Stack *stack);
+        // Load the empty specified 'stack' with a full stack of blocks for the
+        // pool having the specified 'poolIdx', taken from the corresponding
+        // depot if one is available, and otherwise allocated from the pool.
+
+    // PRIVATE ACCESSORS
+    int findPool(bsls::Types::size_type size) const;
+        // Return the index of the memory pool in this allocator for an
+        // allocation request of the specified 'size' (in bytes).  The
+        // behavior is undefined unless '1 <= size <= maxPooledBlockSize()'.
+
+  public:
+    // CREATORS
+    explicit ThreadCachingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit ThreadCachingAllocator(int               numPools,
+                                    bslma::Allocator *basicAllocator = 0);
+    ThreadCachingAllocator(int               numPools,
+                           int               batchSize,
+                           bslma::Allocator *basicAllocator = 0);
+        // Create a thread-caching allocator.  Optionally specify 'numPools',
+        // indicating the number of internally created 'ConcurrentPool'
+        // objects; the block size of the first pool is 8 bytes, with the
+        // block size of each additional pool successively doubling.  If
+        // 'numPools' is not specified, an implementation-defined number of
+        // pools 'N' -- covering memory blocks ranging in size from '2^3 = 8'
+        // to '2^(N+2)' -- are created.  If 'numPools' is specified, optionally
+        // specify a 'batchSize' indicating the number of blocks moved at once
+        // between the cache of a thread and the shared state of this
+        // allocator.  If 'batchSize' is not specified, an
+        // implementation-defined value is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numPools' and '1 <= batchSize'.
+
+    virtual ~ThreadCachingAllocator();
+        // Destroy this allocator.  All memory allocated from this allocator,
+        // including the caches of threads that have not yet exited, is
+        // released.  The behavior is undefined unless no other thread is
+        // using, or exiting after having used, this allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of maximally aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size > maxPooledBlockSize()', the memory allocation is managed
+        // directly by the underlying allocator, and is not pooled.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator for reuse.  If 'address' is 0, this method has no effect.
+        // The behavior is undefined unless 'address' was allocated by this
+        // allocator and has not already been deallocated.  Note that
+        // 'address' may have been allocated by any thread.
+
+    // ACCESSORS
+    int batchSize() const;
+        // Return the number of blocks moved at once between the cache of a
+        // thread and the shared state of this allocator.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled by this
+        // allocator.  Note that the maximum value is defined as:
+        //..
+        //  2 ^ (numPools + 2)
+        //..
+        // where 'numPools' is either specified at construction, or an
+        // implementation-defined value.
+
+    int numPools() const;
+        // Return the number of pools managed by this allocator.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class ThreadCachingAllocator
+                       // ----------------------------
+
+// ACCESSORS
+inline
+int ThreadCachingAllocator::batchSize() const
+{
+    return d_batchSize;
+}
+
+inline
+bsls::Types::size_type ThreadCachingAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+inline
+int ThreadCachingAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
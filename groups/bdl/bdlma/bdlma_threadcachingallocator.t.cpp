@@ -0,0 +1,1276 @@
+// bdlma_threadcachingallocator.t.cpp                                 -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>  // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_deque.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a thread-safe allocator that fronts an array of
+// 'bdlma::ConcurrentPool' objects with per-thread caches of free blocks.  The
+// concerns are that every block dispensed is usable and properly aligned, that
+// blocks are recycled through the calling thread's cache and, in batches,
+// through the shared depots (which we observe through the number of
+// allocations made from the underlying test allocator), that the cache of a
+// thread is reclaimed when the thread exits or the allocator is destroyed, and
+// that the allocator operates correctly when blocks are allocated and freed
+// by different threads concurrently.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingAllocator(bslma::Allocator *ba = 0);
+// [ 2] ThreadCachingAllocator(int numPools, bslma::Allocator *ba = 0);
+// [ 2] ThreadCachingAllocator(int numPools, int batchSize, *ba = 0);
+// [ 6] ~ThreadCachingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 2] int batchSize() const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 2] int numPools() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] BATCHED REFILL AND RETURN
+// [ 5] THREAD EXIT
+// [ 7] CONCURRENT PRODUCERS AND CONSUMERS
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: CROSS-THREAD AND SAME-THREAD PATTERNS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingAllocator Obj;
+typedef bsls::Types::Int64            Int64;
+
+const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                     HELPER FUNCTIONS AND CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address) % MAX_ALIGN;
+}
+
+class BlockQueue {
+    // This class provides a thread-safe queue of batches of memory blocks.
+
+    // DATA
+    bsl::deque<bsl::vector<void *> *> d_queue;      // queued batches
+    bslmt::Mutex                      d_mutex;      // protects 'd_queue'
+    bslmt::Condition                  d_condition;  // signaled on push
+
+  public:
+    // CREATORS
+    explicit BlockQueue(bslma::Allocator *basicAllocator = 0)
+    : d_queue(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    void push(bsl::vector<void *> *batch)
+        // Append the specified 'batch' to this queue.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_queue.push_back(batch);
+        d_condition.signal();
+    }
+
+    bsl::vector<void *> *pop()
+        // Remove and return the batch at the front of this queue, blocking
+        // until one is available.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        while (d_queue.empty()) {
+            d_condition.wait(&d_mutex);
+        }
+        bsl::vector<void *> *batch = d_queue.front();
+        d_queue.pop_front();
+        return batch;
+    }
+};
+
+bsls::Types::size_type blockSize(int id, int i)
+    // Return the size of the block having the specified index 'i' in a batch
+    // produced by the thread having the specified 'id'.  Sizes cycle through
+    // every pool of a default 'Obj' and, occasionally, exceed the largest
+    // pooled size.
+{
+    static const bsls::Types::size_type SIZES[] = {
+        1, 8, 9, 16, 24, 32, 48, 64, 100, 128, 256, 512, 1000, 2048, 4096,
+        5000
+    };
+    const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+    return SIZES[(id * 7 + i) % NUM_SIZES];
+}
+
+struct Producer {
+    // This 'struct' defines a functor that allocates batches of blocks, fills
+    // each block with a byte pattern, and pushes them to a queue.
+
+    bslma::Allocator *d_allocator_p;   // allocator under test
+    BlockQueue       *d_queue_p;       // destination of batches
+    int               d_id;            // identifies this producer
+    int               d_numBatches;    // number of batches to produce
+    int               d_batchLength;   // number of blocks per batch
+
+    void operator()() const
+    {
+        for (int b = 0; b < d_numBatches; ++b) {
+            bsl::vector<void *> *batch = new bsl::vector<void *>();
+            batch->reserve(d_batchLength);
+            for (int i = 0; i < d_batchLength; ++i) {
+                const bsls::Types::size_type size = blockSize(d_id, i);
+                void *block = d_allocator_p->allocate(size);
+                bsl::memset(block, d_id, size);
+                batch->push_back(block);
+            }
+            d_queue_p->push(batch);
+        }
+        d_queue_p->push(0);
+    }
+};
+
+struct Consumer {
+    // This 'struct' defines a functor that pops batches of blocks from a
+    // queue, verifies their contents, and deallocates them, until a null
+    // batch is received.
+
+    bslma::Allocator *d_allocator_p;   // allocator under test
+    BlockQueue       *d_queue_p;       // source of batches
+    int               d_id;            // identifies the matching producer
+    int              *d_numErrors_p;   // number of corrupted blocks found
+
+    void operator()() const
+    {
+        while (bsl::vector<void *> *batch = d_queue_p->pop()) {
+            for (int i = 0; i < static_cast<int>(batch->size()); ++i) {
+                const unsigned char *block =
+                                static_cast<unsigned char *>((*batch)[i]);
+                const bsls::Types::size_type size = blockSize(d_id, i);
+                if (block[0] != d_id || block[size - 1] != d_id) {
+                    ++*d_numErrors_p;
+                }
+                d_allocator_p->deallocate((*batch)[i]);
+            }
+            delete batch;
+        }
+    }
+};
+
+struct Churner {
+    // This 'struct' defines a functor that repeatedly allocates and frees a
+    // number of blocks of a fixed size, optionally synchronizing on a barrier
+    // before it returns.
+
+    bslma::Allocator *d_allocator_p;  // allocator under test
+    int               d_numBlocks;    // blocks allocated per round
+    int               d_numRounds;    // number of rounds
+    int               d_size;         // size of each block
+    bslmt::Barrier   *d_ready_p;      // if not 0, waited on when done
+    bslmt::Barrier   *d_release_p;    // if not 0, waited on before return
+
+    void operator()() const
+    {
+        bsl::vector<void *> blocks(d_numBlocks, static_cast<void *>(0));
+        for (int r = 0; r < d_numRounds; ++r) {
+            for (int i = 0; i < d_numBlocks; ++i) {
+                blocks[i] = d_allocator_p->allocate(d_size);
+            }
+            for (int i = 0; i < d_numBlocks; ++i) {
+                d_allocator_p->deallocate(blocks[i]);
+            }
+        }
+        if (d_ready_p) {
+            d_ready_p->wait();
+        }
+        if (d_release_p) {
+            d_release_p->wait();
+        }
+    }
+};
+
+struct Allocating {
+    // This 'struct' defines a functor that allocates a number of blocks of a
+    // fixed size into a vector, waits on a barrier, and then allocates
+    // another number of blocks into a second vector.
+
+    bslma::Allocator    *d_allocator_p;  // allocator under test
+    int                  d_size;         // size of each block
+    bsl::vector<void *> *d_first_p;      // filled with the first blocks
+    bsl::vector<void *> *d_second_p;     // filled with the second blocks
+    int                  d_numSecond;    // number of second blocks
+    bslmt::Barrier      *d_barrier_p;    // waited on twice between phases
+
+    void operator()() const
+    {
+        for (int i = 0; i < static_cast<int>(d_first_p->size()); ++i) {
+            (*d_first_p)[i] = d_allocator_p->allocate(d_size);
+        }
+        d_barrier_p->wait();
+        d_barrier_p->wait();
+        for (int i = 0; i < d_numSecond; ++i) {
+            d_second_p->push_back(d_allocator_p->allocate(d_size));
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               BENCHMARKS
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace bench {
+
+struct SameThreadWorker {
+    // This 'struct' defines a functor that allocates and frees a window of
+    // blocks in the calling thread.
+
+    bslma::Allocator *d_allocator_p;
+    int               d_numOps;
+    int               d_size;
+
+    void operator()() const
+    {
+        enum { k_WINDOW = 64 };
+        void *blocks[k_WINDOW];
+        for (int n = 0; n < d_numOps; n += k_WINDOW) {
+            for (int i = 0; i < k_WINDOW; ++i) {
+                blocks[i] = d_allocator_p->allocate(d_size);
+            }
+            for (int i = 0; i < k_WINDOW; ++i) {
+                d_allocator_p->deallocate(blocks[i]);
+            }
+        }
+    }
+};
+
+struct CrossThreadProducer {
+    // This 'struct' defines a functor that allocates batches of blocks and
+    // hands them to a consumer thread.
+
+    bslma::Allocator *d_allocator_p;
+    BlockQueue       *d_queue_p;
+    int               d_numOps;
+    int               d_size;
+
+    void operator()() const
+    {
+        enum { k_BATCH = 256 };
+        for (int n = 0; n < d_numOps; n += k_BATCH) {
+            bsl::vector<void *> *batch = new bsl::vector<void *>(k_BATCH);
+            for (int i = 0; i < k_BATCH; ++i) {
+                (*batch)[i] = d_allocator_p->allocate(d_size);
+            }
+            d_queue_p->push(batch);
+        }
+        d_queue_p->push(0);
+    }
+};
+
+struct CrossThreadConsumer {
+    // This 'struct' defines a functor that frees the blocks of every batch
+    // handed over by a producer thread.
+
+    bslma::Allocator *d_allocator_p;
+    BlockQueue       *d_queue_p;
+
+    void operator()() const
+    {
+        while (bsl::vector<void *> *batch = d_queue_p->pop()) {
+            for (int i = 0; i < static_cast<int>(batch->size()); ++i) {
+                d_allocator_p->deallocate((*batch)[i]);
+            }
+            delete batch;
+        }
+    }
+};
+
+double runSameThread(bslma::Allocator *allocator,
+                     int               numThreads,
+                     int               numOps,
+                     int               size)
+    // Run the specified 'numThreads' threads each performing the specified
+    // 'numOps' allocations (and as many deallocations) of the specified
+    // 'size' from the specified 'allocator' and return the elapsed wall time
+    // in seconds.
+{
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    SameThreadWorker worker = { allocator, numOps, size };
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int t = 0; t < numThreads; ++t) {
+        bslmt::ThreadUtil::create(&handles[t], worker);
+    }
+    for (int t = 0; t < numThreads; ++t) {
+        bslmt::ThreadUtil::join(handles[t]);
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+double runCrossThread(bslma::Allocator *allocator,
+                      int               numPairs,
+                      int               numOps,
+                      int               size)
+    // Run the specified 'numPairs' pairs of threads, the producer of each pair
+    // allocating the specified 'numOps' blocks of the specified 'size' from
+    // the specified 'allocator' and the consumer freeing them, and return the
+    // elapsed wall time in seconds.
+{
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(2 * numPairs);
+    bsl::vector<BlockQueue *>              queues(numPairs);
+    for (int p = 0; p < numPairs; ++p) {
+        queues[p] = new BlockQueue();
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int p = 0; p < numPairs; ++p) {
+        CrossThreadProducer producer = { allocator, queues[p], numOps, size };
+        CrossThreadConsumer consumer = { allocator, queues[p] };
+        bslmt::ThreadUtil::create(&handles[2 * p], producer);
+        bslmt::ThreadUtil::create(&handles[2 * p + 1], consumer);
+    }
+    for (int t = 0; t < 2 * numPairs; ++t) {
+        bslmt::ThreadUtil::join(handles[t]);
+    }
+    timer.stop();
+
+    for (int p = 0; p < numPairs; ++p) {
+        delete queues[p];
+    }
+    return timer.elapsedTime();
+}
+
+}  // close namespace bench
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Threads
+///- - - - - - - - - - - - - - - - - - - - - -
+// A common source of contention in a multipool allocator is the pattern in
+// which one thread allocates messages and another thread consumes and frees
+// them: every deallocation by the consumer and every allocation by the
+// producer operates on the same shared free list.  A
+// 'bdlma::ThreadCachingAllocator' turns this traffic into the occasional
+// exchange of batches of blocks.
+//
+// First, we define a trivial message queue whose nodes are supplied by the
+// allocator under test:
+//..
+    class MessageQueue {
+        // This class provides a thread-safe queue of 'int' messages.
+
+        // DATA
+        bsl::deque<int *> d_queue;      // queued messages
+        bslmt::Mutex      d_mutex;      // protects 'd_queue'
+        bslmt::Condition  d_condition;  // signaled on push
+
+      public:
+        // CREATORS
+        explicit MessageQueue(bslma::Allocator *basicAllocator = 0)
+        : d_queue(basicAllocator)
+        {
+        }
+
+        // MANIPULATORS
+        void push(int *message)
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            d_queue.push_back(message);
+            d_condition.signal();
+        }
+
+        int *pop()
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            while (d_queue.empty()) {
+                d_condition.wait(&d_mutex);
+            }
+            int *message = d_queue.front();
+            d_queue.pop_front();
+            return message;
+        }
+    };
+//..
+// Then, we define a consumer that frees every message it receives, until it
+// receives a negative value:
+//..
+    struct MessageConsumer {
+        // This 'struct' defines a functor that consumes messages.
+
+        MessageQueue     *d_queue_p;      // source of messages
+        bslma::Allocator *d_allocator_p;  // allocator of messages
+        int              *d_sum_p;        // sum of consumed values
+
+        void operator()()
+        {
+            while (true) {
+                int *message = d_queue_p->pop();
+                int  value   = *message;
+                d_allocator_p->deallocate(message);
+                if (0 > value) {
+                    break;
+                }
+                *d_sum_p += value;
+            }
+        }
+    };
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Now, we create the allocator, the queue, and a consumer thread:
+//..
+    bdlma::ThreadCachingAllocator allocator;
+    MessageQueue                  queue;
+
+    int             sum      = 0;
+    MessageConsumer consumer = { &queue, &allocator, &sum };
+
+    bslmt::ThreadUtil::Handle handle;
+    bslmt::ThreadUtil::create(&handle, consumer);
+//..
+// Finally, the main thread produces messages; the blocks freed by the consumer
+// find their way back to the main thread's cache in batches:
+//..
+    for (int i = 1; i <= 1000; ++i) {
+        int *message = static_cast<int *>(allocator.allocate(sizeof(int)));
+        *message = i;
+        queue.push(message);
+    }
+    int *last = static_cast<int *>(allocator.allocate(sizeof(int)));
+    *last = -1;
+    queue.push(last);
+
+    bslmt::ThreadUtil::join(handle);
+    ASSERT(500500 == sum);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PRODUCERS AND CONSUMERS
+        //
+        // Concerns:
+        //: 1 Blocks allocated by one thread and freed by another are never
+        //:   handed out twice while in use.
+        //:
+        //: 2 Concurrent allocations and deallocations of pooled and unpooled
+        //:   sizes by many threads leave no memory outstanding once the
+        //:   allocator is destroyed.
+        //
+        // Plan:
+        //: 1 Run several producer/consumer thread pairs sharing one allocator.
+        //:   Each producer fills every block it allocates with its id, and
+        //:   each consumer verifies the pattern before freeing the block.
+        //:   (C-1)
+        //:
+        //: 2 Concurrently run churning threads that allocate and free blocks
+        //:   in the same thread.
+        //:
+        //: 3 Verify that the underlying test allocator has no memory in use
+        //:   after the allocator is destroyed.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENT PRODUCERS AND CONSUMERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT PRODUCERS AND CONSUMERS" << endl
+                          << "==================================" << endl;
+
+        const int BATCH_SIZES[] = { 1, 3, 32 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        const int NUM_PAIRS    = 4;
+        const int NUM_CHURNERS = 2;
+
+        for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+            const int BATCH_SIZE = BATCH_SIZES[bi];
+
+            if (veryVerbose) { T_ P(BATCH_SIZE) }
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            int                  numErrors[NUM_PAIRS] = { 0 };
+            {
+                Obj mX(10, BATCH_SIZE, &ta);
+
+                bsl::vector<BlockQueue *>              queues;
+                bsl::vector<bslmt::ThreadUtil::Handle> handles;
+
+                for (int p = 0; p < NUM_PAIRS; ++p) {
+                    queues.push_back(new BlockQueue());
+
+                    Producer producer = { &mX, queues[p], p + 1, 200, 50 };
+                    Consumer consumer = { &mX, queues[p], p + 1,
+                                          &numErrors[p] };
+
+                    bslmt::ThreadUtil::Handle handle;
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handle, producer));
+                    handles.push_back(handle);
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handle, consumer));
+                    handles.push_back(handle);
+                }
+                for (int c = 0; c < NUM_CHURNERS; ++c) {
+                    Churner churner = { &mX, 100, 100, 24 * (c + 1), 0, 0 };
+
+                    bslmt::ThreadUtil::Handle handle;
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handle, churner));
+                    handles.push_back(handle);
+                }
+                for (int t = 0; t < static_cast<int>(handles.size()); ++t) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[t]));
+                }
+                for (int p = 0; p < NUM_PAIRS; ++p) {
+                    ASSERTV(BATCH_SIZE, p, numErrors[p], 0 == numErrors[p]);
+                    delete queues[p];
+                }
+            }
+            ASSERTV(BATCH_SIZE, ta.numBlocksInUse(),
+                    0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 The destructor releases all memory, including the caches of
+        //:   threads that are still running.
+        //:
+        //: 2 A thread that has used the allocator can exit safely after the
+        //:   allocator is destroyed.
+        //
+        // Plan:
+        //: 1 Start several threads that use the allocator and then block on a
+        //:   barrier.  Destroy the allocator while the threads are blocked and
+        //:   verify that the underlying test allocator has no memory in use.
+        //:   (C-1)
+        //:
+        //: 2 Release the threads and join them.  (C-2)
+        //
+        // Testing:
+        //   ~ThreadCachingAllocator();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DESTRUCTOR" << endl
+                          << "==========" << endl;
+
+        const int NUM_THREADS = 4;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bslmt::Barrier ready(NUM_THREADS + 1);
+        bslmt::Barrier release(NUM_THREADS + 1);
+
+        bsl::vector<bslmt::ThreadUtil::Handle> handles(NUM_THREADS);
+        {
+            Obj mX(&ta);
+
+            for (int t = 0; t < NUM_THREADS; ++t) {
+                Churner churner = { &mX, 50, 10, 8 << t, &ready, &release };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[t], churner));
+            }
+            ready.wait();
+
+            ASSERT(0 < ta.numBlocksInUse());
+
+            // Also give the main thread a cache.
+
+            mX.deallocate(mX.allocate(1));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        release.wait();
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[t]));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // THREAD EXIT
+        //
+        // Concerns:
+        //: 1 The cache of a thread is created on the first use of the
+        //:   allocator by that thread and destroyed when the thread exits.
+        //:
+        //: 2 The blocks cached by a thread are available to other threads
+        //:   once that thread has exited.
+        //
+        // Plan:
+        //: 1 Run a thread that churns through blocks, and verify that the
+        //:   number of blocks in use by the underlying allocator while the
+        //:   thread is blocked on a barrier exceeds by one (the cache) the
+        //:   number after the thread has exited.  (C-1)
+        //:
+        //: 2 Run the same thread again, and verify that it causes no further
+        //:   allocation from the underlying allocator.  Then allocate from the
+        //:   main thread the same number of blocks as the thread, and verify
+        //:   that, apart from its cache, no further memory is allocated.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   THREAD EXIT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD EXIT" << endl
+                          << "===========" << endl;
+
+        const int BATCH_SIZES[] = { 1, 2, 5, 32 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+            const int BATCH_SIZE = BATCH_SIZES[bi];
+            const int NUM_BLOCKS = 5 * BATCH_SIZE + 3;
+
+            if (veryVerbose) { T_ P(BATCH_SIZE) }
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(4, BATCH_SIZE, &ta);
+
+                ASSERT(0 == ta.numAllocations() - 2);  // pools and depots
+
+                bslmt::Barrier ready(2);
+                bslmt::Barrier release(2);
+
+                Churner churner = { &mX, NUM_BLOCKS, 3, 16, &ready, &release};
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, churner));
+                ready.wait();
+                const Int64 IN_USE = ta.numBlocksInUse();
+                release.wait();
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                ASSERTV(BATCH_SIZE, IN_USE, ta.numBlocksInUse(),
+                        IN_USE - 1 == ta.numBlocksInUse());
+
+                const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, churner));
+                ready.wait();
+                ASSERTV(BATCH_SIZE, NUM_ALLOCATIONS, ta.numAllocations(),
+                        NUM_ALLOCATIONS + 1 == ta.numAllocations());
+                release.wait();
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                ASSERTV(BATCH_SIZE, IN_USE, ta.numBlocksInUse(),
+                        IN_USE - 1 == ta.numBlocksInUse());
+
+                bsl::vector<void *> blocks;
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    blocks.push_back(mX.allocate(16));
+                }
+                ASSERTV(BATCH_SIZE, NUM_ALLOCATIONS, ta.numAllocations(),
+                        NUM_ALLOCATIONS + 2 == ta.numAllocations());
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    mX.deallocate(blocks[i]);
+                }
+            }
+            ASSERTV(BATCH_SIZE, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BATCHED REFILL AND RETURN
+        //
+        // Concerns:
+        //: 1 A thread that repeatedly allocates and frees up to
+        //:   '2 * batchSize()' blocks of one size does not allocate from the
+        //:   underlying allocator once warmed up.
+        //:
+        //: 2 Blocks freed by a thread other than the one that allocated them
+        //:   are handed back, in full stacks, to any thread that allocates
+        //:   them, without allocating more memory from the pool.
+        //
+        // Plan:
+        //: 1 For a range of batch sizes, repeatedly allocate and free a
+        //:   varying number of blocks, and verify that, after the first round,
+        //:   no allocation is made from the underlying allocator.  (C-1)
+        //:
+        //: 2 Have a thread allocate a number of blocks, free them from the
+        //:   main thread, and then have the thread allocate all but the
+        //:   '2 * batchSize()' blocks retained in the cache of the main
+        //:   thread.  Verify that no allocation is made from the underlying
+        //:   allocator, and that the blocks dispensed the second time are
+        //:   blocks dispensed the first time.  (C-2)
+        //
+        // Testing:
+        //   BATCHED REFILL AND RETURN
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCHED REFILL AND RETURN" << endl
+                          << "=========================" << endl;
+
+        const int BATCH_SIZES[] = { 1, 2, 3, 8, 32 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        if (verbose) cout << "\nSame-thread recycling." << endl;
+
+        for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+            const int BATCH_SIZE = BATCH_SIZES[bi];
+
+            for (int n = 1; n <= 2 * BATCH_SIZE + 1; ++n) {
+                bslma::TestAllocator ta("object", veryVeryVerbose);
+                Obj                  mX(4, BATCH_SIZE, &ta);
+
+                bsl::vector<void *> blocks(n, static_cast<void *>(0));
+                Int64               numAllocations = 0;
+
+                for (int r = 0; r < 4; ++r) {
+                    for (int i = 0; i < n; ++i) {
+                        blocks[i] = mX.allocate(20);
+                    }
+                    for (int i = 0; i < n; ++i) {
+                        mX.deallocate(blocks[i]);
+                    }
+                    if (0 == r) {
+                        numAllocations = ta.numAllocations();
+                    }
+                    ASSERTV(BATCH_SIZE, n, r,
+                            numAllocations == ta.numAllocations());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nCross-thread recycling." << endl;
+
+        for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+            const int BATCH_SIZE = BATCH_SIZES[bi];
+            const int NUM_BLOCKS = 6 * BATCH_SIZE;
+
+            if (veryVerbose) { T_ P(BATCH_SIZE) }
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(4, BATCH_SIZE, &ta);
+
+                // Give the main thread a cache up front.
+
+                mX.deallocate(mX.allocate(MAX_ALIGN));
+
+                bsl::vector<void *> first(NUM_BLOCKS, static_cast<void *>(0));
+                bsl::vector<void *> second;
+                bslmt::Barrier      barrier(2);
+
+                Allocating allocating = { &mX,
+                                          24,
+                                          &first,
+                                          &second,
+                                          NUM_BLOCKS - 2 * BATCH_SIZE,
+                                          &barrier };
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, allocating));
+
+                barrier.wait();
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    mX.deallocate(first[i]);
+                }
+                const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+                barrier.wait();
+
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                ASSERTV(BATCH_SIZE, NUM_ALLOCATIONS, ta.numAllocations(),
+                        NUM_ALLOCATIONS == ta.numAllocations());
+
+                bsl::set<void *> firstSet(first.begin(), first.end());
+                for (int i = 0; i < static_cast<int>(second.size()); ++i) {
+                    ASSERTV(BATCH_SIZE, i, firstSet.count(second[i]));
+                    mX.deallocate(second[i]);
+                }
+            }
+            ASSERTV(BATCH_SIZE, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //
+        // Concerns:
+        //: 1 'allocate(0)' returns 0 and 'deallocate(0)' has no effect.
+        //:
+        //: 2 Every block returned by 'allocate' is maximally aligned, is
+        //:   writable over its whole requested size, and does not overlap any
+        //:   other block in use.
+        //:
+        //: 3 A block freed by a thread is the next block of the same pool
+        //:   allocated by that thread.
+        //:
+        //: 4 Requests larger than 'maxPooledBlockSize()' are forwarded to the
+        //:   underlying allocator and returned to it on deallocation.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate 0 bytes and a null address.  (C-1)
+        //:
+        //: 2 Allocate blocks of every size up to beyond the largest pooled
+        //:   size, fill each, and verify its alignment and that the contents
+        //:   of every block are intact after all blocks are filled.  (C-2)
+        //:
+        //: 3 Free a block and allocate a block of a size in the same pool;
+        //:   verify that the same address is returned.  (C-3)
+        //:
+        //: 4 Allocate and free blocks larger than the largest pooled size, and
+        //:   verify the number of blocks in use by the underlying allocator.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE AND DEALLOCATE" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(5, 4, &ta);  const Obj& X = mX;
+
+            const int MAX_SIZE = static_cast<int>(X.maxPooledBlockSize());
+            ASSERT(128 == MAX_SIZE);
+
+            if (verbose) cout << "\nZero size and null address." << endl;
+            {
+                const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+                ASSERT(0 == mX.allocate(0));
+                mX.deallocate(0);
+                ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            }
+
+            if (verbose) cout << "\nAlignment and contents." << endl;
+            {
+                bsl::vector<void *> blocks;
+                for (int size = 1; size <= 2 * MAX_SIZE; ++size) {
+                    void *block = mX.allocate(size);
+                    ASSERTV(size, isMaximallyAligned(block));
+                    bsl::memset(block, size & 0xff, size);
+                    blocks.push_back(block);
+                }
+                for (int size = 1; size <= 2 * MAX_SIZE; ++size) {
+                    const unsigned char *block =
+                               static_cast<unsigned char *>(blocks[size - 1]);
+                    for (int i = 0; i < size; ++i) {
+                        ASSERTV(size, i, (size & 0xff) == block[i]);
+                    }
+                }
+                for (int size = 1; size <= 2 * MAX_SIZE; ++size) {
+                    mX.deallocate(blocks[size - 1]);
+                }
+            }
+
+            if (verbose) cout << "\nLIFO reuse within a thread." << endl;
+            {
+                for (int size = 1; size <= MAX_SIZE; ++size) {
+                    void *block = mX.allocate(size);
+                    mX.deallocate(block);
+                    int samePool = 1;  // smallest size in the same pool
+                    while (2 * samePool < size) {
+                        samePool *= 2;
+                    }
+                    const int SAME_POOL = 1 == samePool ? 1 : samePool + 1;
+                    ASSERTV(size, block == mX.allocate(SAME_POOL));
+                    mX.deallocate(block);
+                }
+            }
+
+            if (verbose) cout << "\nUnpooled blocks." << endl;
+            {
+                const Int64 IN_USE = ta.numBlocksInUse();
+
+                void *block1 = mX.allocate(MAX_SIZE + 1);
+                void *block2 = mX.allocate(10 * MAX_SIZE);
+                ASSERT(isMaximallyAligned(block1));
+                ASSERT(isMaximallyAligned(block2));
+                ASSERT(IN_USE + 2 == ta.numBlocksInUse());
+
+                mX.deallocate(block1);
+                ASSERT(IN_USE + 1 == ta.numBlocksInUse());
+                mX.deallocate(block2);
+                ASSERT(IN_USE     == ta.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor configures the number of pools and the batch
+        //:   size as specified, or to the documented defaults.
+        //:
+        //: 2 'maxPooledBlockSize' is '2 ^ (numPools + 2)'.
+        //:
+        //: 3 All memory comes from the supplied allocator, or from the default
+        //:   allocator if none is supplied, and is released on destruction.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and a range of arguments,
+        //:   and verify the values of the accessors.  (C-1..2)
+        //:
+        //: 2 Use test allocators to verify the source of memory.  (C-3)
+        //
+        // Testing:
+        //   ThreadCachingAllocator(bslma::Allocator *ba = 0);
+        //   ThreadCachingAllocator(int numPools, bslma::Allocator *ba = 0);
+        //   ThreadCachingAllocator(int numPools, int batchSize, *ba = 0);
+        //   int batchSize() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   int numPools() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                ASSERT(10   == X.numPools());
+                ASSERT(32   == X.batchSize());
+                ASSERT(4096 == X.maxPooledBlockSize());
+
+                mX.deallocate(mX.allocate(1));
+                mX.deallocate(mX.allocate(5000));
+            }
+            ASSERT(0 <  ta.numBlocksTotal());
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            {
+                Obj mX;  const Obj& X = mX;
+
+                ASSERT(10 == X.numPools());
+                mX.deallocate(mX.allocate(1));
+            }
+            ASSERT(0 <  defaultAllocator.numBlocksTotal());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+
+        for (int numPools = 1; numPools <= 12; ++numPools) {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(numPools, &ta);  const Obj& X = mX;
+
+                ASSERTV(numPools, numPools == X.numPools());
+                ASSERTV(numPools, 32       == X.batchSize());
+                ASSERTV(numPools,
+                        (4u << numPools) == X.maxPooledBlockSize());
+            }
+            for (int batchSize = 1; batchSize <= 64; batchSize *= 4) {
+                Obj mX(numPools, batchSize, &ta);  const Obj& X = mX;
+
+                ASSERTV(numPools, batchSize, numPools  == X.numPools());
+                ASSERTV(numPools, batchSize, batchSize == X.batchSize());
+                ASSERTV(numPools, batchSize,
+                        (4u << numPools) == X.maxPooledBlockSize());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and free blocks of a few sizes from the main thread and
+        //:   from a second thread.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *p1 = mX.allocate(1);
+            void *p2 = mX.allocate(100);
+            void *p3 = mX.allocate(10000);
+            ASSERT(p1 && p2 && p3);
+            ASSERT(p1 != p2 && p2 != p3);
+
+            mX.deallocate(p1);
+            ASSERT(p1 == mX.allocate(8));
+
+            Churner churner = { &mX, 100, 10, 40, 0, 0 };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, churner));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            mX.deallocate(p3);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CROSS-THREAD AND SAME-THREAD PATTERNS
+        //
+        // Concerns:
+        //: 1 The per-thread caches reduce the cost of allocation and
+        //:   deallocation compared to 'bdlma::ConcurrentMultipoolAllocator'
+        //:   and to 'malloc', both when blocks are freed by the allocating
+        //:   thread and when they are freed by another thread.
+        //
+        // Plan:
+        //: 1 For a range of thread counts, time a "same-thread" pattern, in
+        //:   which each thread allocates and frees windows of 64 blocks, and a
+        //:   "cross-thread" pattern, in which producer threads allocate blocks
+        //:   that are freed by matching consumer threads, using a
+        //:   'bdlma::ThreadCachingAllocator', a
+        //:   'bdlma::ConcurrentMultipoolAllocator', and the
+        //:   'bslma::NewDeleteAllocator'.  Report nanoseconds per
+        //:   allocate/deallocate pair.  (C-1)
+        //
+        // Note that 'allocbench' (see 'benchmarks/allocators') runs the same
+        // patterns against more allocators and writes the results as CSV,
+        // but is built only when the benchmarks are enabled, whereas this
+        // case is always built with the test driver.
+        //
+        // Testing:
+        //   PERFORMANCE: CROSS-THREAD AND SAME-THREAD PATTERNS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                    << endl
+                    << "PERFORMANCE: CROSS-THREAD AND SAME-THREAD PATTERNS\n"
+                    << "==================================================\n";
+
+        // Neither the allocators under test nor the batches exchanged between
+        // threads should be served by the (serializing) test allocator.
+
+        bslma::DefaultAllocatorGuard newDeleteGuard(
+                                    &bslma::NewDeleteAllocator::singleton());
+
+        const int NUM_OPS = argc > 2 ? atoi(argv[2]) : 1 << 20;
+        const int SIZE    = argc > 3 ? atoi(argv[3]) : 64;
+
+        const int NUM_THREADS[]   = { 1, 2, 4, 8 };
+        const int NUM_NUM_THREADS = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        cout << "ops/thread = " << NUM_OPS << ", size = " << SIZE
+             << "; ns per allocate/deallocate pair" << endl;
+
+        for (int pattern = 0; pattern < 2; ++pattern) {
+            cout << "\n"
+                 << (0 == pattern ? "same-thread" : "cross-thread")
+                 << (0 == pattern ? " (threads)"
+                                  : " (producer/consumer pairs)")
+                 << "\n"
+                 << setw(8)  << "threads"
+                 << setw(16) << "ThreadCaching"
+                 << setw(20) << "ConcurrentMultipool"
+                 << setw(12) << "malloc" << endl;
+
+            for (int ti = 0; ti < NUM_NUM_THREADS; ++ti) {
+                const int NT = NUM_THREADS[ti];
+
+                double elapsed[3];
+                for (int a = 0; a < 3; ++a) {
+                    Obj                                 tca;
+                    bdlma::ConcurrentMultipoolAllocator cmpa;
+                    bslma::Allocator *allocator =
+                           0 == a ? static_cast<bslma::Allocator *>(&tca)
+                         : 1 == a ? static_cast<bslma::Allocator *>(&cmpa)
+                         : &bslma::NewDeleteAllocator::singleton();
+
+                    elapsed[a] = 0 == pattern
+                         ? bench::runSameThread(allocator, NT, NUM_OPS, SIZE)
+                         : bench::runCrossThread(allocator, NT, NUM_OPS, SIZE);
+                }
+
+                const double PAIRS = static_cast<double>(NT) * NUM_OPS;
+                cout << setw(8)  << NT
+                     << setw(16) << elapsed[0] * 1e9 / PAIRS
+                     << setw(20) << elapsed[1] * 1e9 / PAIRS
+                     << setw(12) << elapsed[2] * 1e9 / PAIRS << endl;
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -493,6 +493,7 @@ MultiQueueThreadPool::MultiQueueThreadPool(
 , d_queueRegistry(basicAllocator)
 , d_nextId(1)
 , d_state(e_STATE_STOPPED)
+, d_defaultBatchSize(1)
 , d_numActiveQueues(0)
 , d_numExecuted(0)
 , d_numEnqueued(0)
@@ -519,6 +520,7 @@ MultiQueueThreadPool::MultiQueueThreadPool(ThreadPool       *threadPool,
 , d_queueRegistry(basicAllocator)
 , d_nextId(1)
 , d_state(e_STATE_STOPPED)
+, d_defaultBatchSize(1)
 , d_numActiveQueues(0)
 , d_numExecuted(0)
 , d_numEnqueued(0)
@@ -539,13 +541,19 @@ MultiQueueThreadPool::~MultiQueueThreadPool()
 // MANIPULATORS
 int MultiQueueThreadPool::createQueue()
 {
-    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::WriteLockGuard<MultiQueueThreadPool_StripedLock> guard(&d_lock);
 
     int id = d_nextId++;
 
-    // Note that 'd_queuePool' does its own synchronization.
+    // Note that 'd_queuePool' does its own synchronization.  A queue obtained
+    // from the pool may have been used (and configured) before, so its batch
+    // size is always set.
+
+    MultiQueueThreadPool_Queue *queue = d_queuePool.getObject();
+
+    queue->setBatchSize(d_defaultBatchSize);
 
-    d_queueRegistry[id] = d_queuePool.getObject();
+    d_queueRegistry[id] = queue;
 
     return id;
 }
@@ -553,7 +561,7 @@ int MultiQueueThreadPool::createQueue()
 int MultiQueueThreadPool::deleteQueue(int                   id,
                                       const CleanupFunctor& cleanupFunctor)
 {
-    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::WriteLockGuard<MultiQueueThreadPool_StripedLock> guard(&d_lock);
 
     MultiQueueThreadPool_Queue *queue = 0;
 
@@ -574,7 +582,7 @@ int MultiQueueThreadPool::deleteQueue(int id)
 
     bool isProcessor;
     {
-        bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+        bslmt::WriteLockGuard<MultiQueueThreadPool_StripedLock> guard(&d_lock);
 
         MultiQueueThreadPool_Queue *queue = 0;
 
@@ -596,7 +604,7 @@ int MultiQueueThreadPool::deleteQueue(int id)
 
 int MultiQueueThreadPool::enableQueue(int id)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     MultiQueueThreadPool_Queue *queue;
 
@@ -609,7 +617,7 @@ int MultiQueueThreadPool::enableQueue(int id)
 
 int MultiQueueThreadPool::disableQueue(int id)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     MultiQueueThreadPool_Queue *queue;
 
@@ -624,7 +632,8 @@ void MultiQueueThreadPool::drain()
 {
     while (1) {
         {
-            bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+            bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(
+                                                            &d_lock.stripe(0));
 
             if (   e_STATE_STOPPED == d_state
                 || 0               == d_threadPool_p->enabled()) {
@@ -658,7 +667,7 @@ int MultiQueueThreadPool::drainQueue(int id)
     while (1) {
         {
             bslmt::ReadLockGuard<bslmt::ReaderWriterMutex>
-                                                   guard(&d_lock);
+                                                   guard(&d_lock.stripe(id));
 
             QueueRegistry::iterator iter = d_queueRegistry.find(id);
 
@@ -682,7 +691,8 @@ int MultiQueueThreadPool::pauseQueue(int id)
     MultiQueueThreadPool_Queue *queue;
     int rv;
     {
-        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(
+                                                           &d_lock.stripe(id));
 
         if (findIfUsable(id, &queue)) {
             return 1;                                                 // RETURN
@@ -702,7 +712,7 @@ int MultiQueueThreadPool::pauseQueue(int id)
 
 int MultiQueueThreadPool::resumeQueue(int id)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     MultiQueueThreadPool_Queue *queue;
 
@@ -716,7 +726,7 @@ int MultiQueueThreadPool::resumeQueue(int id)
 void MultiQueueThreadPool::shutdown()
 {
     {
-        bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+        bslmt::WriteLockGuard<MultiQueueThreadPool_StripedLock> guard(&d_lock);
 
         if (e_STATE_STOPPED == d_state || 0 == d_threadPool_p->enabled()) {
             // Note that 'd_queuePool' does its own synchronization.
@@ -747,7 +757,7 @@ void MultiQueueThreadPool::shutdown()
         bslmt::ThreadUtil::yield();
     }
 
-    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::WriteLockGuard<MultiQueueThreadPool_StripedLock> guard(&d_lock);
 
     bsl::size_t latchCount = d_queueRegistry.size();
 
@@ -783,7 +793,8 @@ int MultiQueueThreadPool::start()
 {
     while (1) {
         {
-            bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+            bslmt::WriteLockGuard<MultiQueueThreadPool_StripedLock> guard(
+                                                                      &d_lock);
 
             if (e_STATE_RUNNING == d_state) {
                 return 0;                                             // RETURN
@@ -815,7 +826,7 @@ int MultiQueueThreadPool::start()
 void MultiQueueThreadPool::stop()
 {
     {
-        bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+        bslmt::WriteLockGuard<MultiQueueThreadPool_StripedLock> guard(&d_lock);
 
         if (e_STATE_STOPPED == d_state) {
             return;                                                   // RETURN
@@ -830,7 +841,7 @@ void MultiQueueThreadPool::stop()
     }
 
     {
-        bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+        bslmt::WriteLockGuard<MultiQueueThreadPool_StripedLock> guard(&d_lock);
 
         if (d_threadPoolIsOwned) {
             d_threadPool_p->drain();
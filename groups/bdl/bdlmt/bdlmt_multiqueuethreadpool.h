@@ -70,6 +70,27 @@ BSLS_IDENT("$Id: $")
 // encouraged to use benchmarks to guide their decision when setting this
 // option.
 //
+// The batch size of a queue is set when the queue is created to the default
+// batch size of the pool, which is initially 1 and can be changed with
+// 'setDefaultBatchSize'.  A pool managing many short-lived queues can thus
+// have all of them drain up to a given number of jobs each time they are
+// scheduled, without configuring each queue individually.
+//
+///Queue Registry Locking
+///----------------------
+// Every method taking a queue id (e.g., 'enqueueJob') looks up the queue in a
+// registry protected by a reader-writer lock.  That lock is divided into
+// stripes, each aligned to, and padded to fill, its own cache line: a lookup
+// read-locks only the stripe selected by the queue id, while methods that
+// modify the registry or the state of the pool (e.g., 'createQueue',
+// 'deleteQueue', 'start', and 'stop') lock every stripe for writing.  Threads
+// enqueuing jobs to different queues therefore do not contend on a single lock
+// word, at the cost of making queue creation and deletion somewhat more
+// expensive.  Note that the alignment of a thread pool allocated from a
+// 'bslma::Allocator' is limited to that provided by the allocator, in which
+// case the stripes still occupy distinct cache-line-sized slots, but adjacent
+// stripes may share a cache line.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -339,17 +360,20 @@ BSLS_IDENT("$Id: $")
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_assert.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bslmt_condition.h>
 #include <bslmt_mutex.h>
 #include <bslmt_mutexassert.h>
+#include <bslmt_platform.h>
 #include <bslmt_readerwritermutex.h>
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_compilerfeatures.h>
 
 #include <bsl_deque.h>
 #include <bsl_functional.h>
@@ -552,6 +576,95 @@ class MultiQueueThreadPool_Queue {
         // Return an instantaneous snapshot of the length of this queue.
 };
 
+                    // ==================================
+                    // struct MultiQueueThreadPool_Stripe
+                    // ==================================
+
+template <int PADDING>
+struct MultiQueueThreadPool_Stripe {
+    // This component-private 'struct' holds one stripe of a
+    // 'MultiQueueThreadPool_StripedLock', aligned to a cache line and
+    // followed by the specified 'PADDING' bytes, so that it occupies whole
+    // cache lines even where 'alignas' is not supported.
+
+    // DATA
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_ALIGNAS)
+    alignas(bslmt::Platform::e_CACHE_LINE_SIZE)
+#endif
+    bslmt::ReaderWriterMutex d_lock;              // stripe lock
+
+    char                     d_padding[PADDING];  // prevent false sharing
+};
+
+template <>
+struct MultiQueueThreadPool_Stripe<0> {
+    // This specialization holds a stripe whose lock already occupies whole
+    // cache lines, and so needs no padding.
+
+    // DATA
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_ALIGNAS)
+    alignas(bslmt::Platform::e_CACHE_LINE_SIZE)
+#endif
+    bslmt::ReaderWriterMutex d_lock;              // stripe lock
+};
+
+                  // ======================================
+                  // class MultiQueueThreadPool_StripedLock
+                  // ======================================
+
+class MultiQueueThreadPool_StripedLock {
+    // This private class provides a reader-writer lock divided into a fixed
+    // number of stripes, each aligned to its own cache line.  A reader locks
+    // only the stripe selected by a key, and a writer locks all the stripes,
+    // so that readers using different stripes do not contend.  This class
+    // provides the 'lockWrite' and 'unlock' methods required by
+    // 'bslmt::WriteLockGuard'.
+
+    // PRIVATE TYPES
+    enum {
+        k_NUM_STRIPES = 16,  // number of stripes (a power of 2)
+
+        k_PADDING     = (bslmt::Platform::e_CACHE_LINE_SIZE -
+                                    sizeof(bslmt::ReaderWriterMutex) %
+                                          bslmt::Platform::e_CACHE_LINE_SIZE)
+                                          % bslmt::Platform::e_CACHE_LINE_SIZE
+                             // bytes needed after a lock to fill whole cache
+                             // lines (0 if it already does)
+    };
+
+    typedef MultiQueueThreadPool_Stripe<k_PADDING> Stripe;
+
+    BSLMF_ASSERT(0 == sizeof(Stripe) % bslmt::Platform::e_CACHE_LINE_SIZE);
+
+    // DATA
+    Stripe d_stripes[k_NUM_STRIPES];
+
+    // NOT IMPLEMENTED
+    MultiQueueThreadPool_StripedLock(const MultiQueueThreadPool_StripedLock&);
+    MultiQueueThreadPool_StripedLock& operator=(
+                                      const MultiQueueThreadPool_StripedLock&);
+
+  public:
+    // CREATORS
+    MultiQueueThreadPool_StripedLock();
+        // Create a striped lock having no stripe locked.
+
+    // MANIPULATORS
+    void lockWrite();
+        // Lock every stripe of this object for writing.  The calling thread
+        // blocks until no other thread holds any stripe.
+
+    bslmt::ReaderWriterMutex& stripe(int key);
+        // Return a reference providing modifiable access to the stripe of
+        // this object selected by the specified 'key', to be locked for
+        // reading.
+
+    void unlock();
+        // Release the write lock held by the calling thread on every stripe
+        // of this object.  The behavior is undefined unless the calling thread
+        // acquired the write lock with 'lockWrite'.
+};
+
                         // ==========================
                         // class MultiQueueThreadPool
                         // ==========================
@@ -598,9 +711,15 @@ class MultiQueueThreadPool {
 
     State             d_state;              // maintains internal state
 
-    mutable bslmt::ReaderWriterMutex
-                      d_lock;               // locked for write when deleting
-                                            // queues or changing pool state
+    mutable MultiQueueThreadPool_StripedLock
+                      d_lock;               // locked for write when creating
+                                            // or deleting queues or changing
+                                            // pool state, and read-locked by
+                                            // stripe (selected by queue id)
+                                            // otherwise
+
+    bsls::AtomicInt   d_defaultBatchSize;   // batch size of newly created
+                                            // queues
 
     bsls::AtomicInt   d_numActiveQueues;    // number of non-empty queues
 
@@ -641,7 +760,8 @@ class MultiQueueThreadPool {
        // if the 'id' is not contained in 'd_queueRegistry', this
        // 'MultiQueueThreadPool' is not in the running state, or
        // '0 == d_threadPool_p->enabled()'.  The behavior is undefined unless
-       // the invoking thread has a lock, read or write, on 'd_lock'.
+       // the invoking thread holds a read lock on 'd_lock.stripe(id)' or the
+       // write lock on 'd_lock'.
 
   public:
     // TRAITS
@@ -692,10 +812,10 @@ class MultiQueueThreadPool {
         // paused.
 
     int createQueue();
-        // Create a queue with unlimited capacity and a default number of
-        // initial elements.  Return a non-zero queue ID.  The queue ID can be
-        // used to enqueue jobs to the queue, or to control or delete the
-        // queue.
+        // Create a queue with unlimited capacity, a default number of initial
+        // elements, and an execution batch size of 'defaultBatchSize()'.
+        // Return a non-zero queue ID.  The queue ID can be used to enqueue
+        // jobs to the queue, or to control or delete the queue.
 
     int deleteQueue(int id, const CleanupFunctor& cleanupFunctor);
         // Disable enqueuing to the queue associated with the specified 'id',
@@ -787,8 +907,16 @@ class MultiQueueThreadPool {
         // jobs are available then only the available jobs will be processed in
         // the current batch.  Return 0 on success, and a non-zero value
         // otherwise.  The behavior is undefined unless '1 <= batchSize'.  Note
-        // that the initial value for the execution batch size is 1 for all
-        // queues.
+        // that the initial value for the execution batch size of a queue is
+        // the default batch size of this pool at the time the queue was
+        // created (see 'setDefaultBatchSize').
+
+    void setDefaultBatchSize(int batchSize);
+        // Set the execution batch size of the queues subsequently created by
+        // 'createQueue' to the specified 'batchSize' (see
+        // {'Job Execution Batch Size'}).  The batch size of existing queues is
+        // not affected.  The behavior is undefined unless '1 <= batchSize'.
+        // Note that the initial default batch size is 1.
 
     void shutdown();
         // Disable queuing on all queues, and wait until all non-paused queues
@@ -821,6 +949,11 @@ class MultiQueueThreadPool {
         // jobs are available then only the available jobs will be processed in
         // the current batch.
 
+    int defaultBatchSize() const;
+        // Return an instantaneous snapshot of the execution batch size given
+        // to the queues created by 'createQueue' (see
+        // 'setDefaultBatchSize').
+
     bool isPaused(int id) const;
         // Return 'true' if the queue associated with the specified 'id' is
         // currently paused, or 'false' otherwise (including if 'id' is not a
@@ -908,6 +1041,42 @@ int MultiQueueThreadPool_Queue::length() const
     return static_cast<int>(d_list.size());
 }
 
+                  // --------------------------------------
+                  // class MultiQueueThreadPool_StripedLock
+                  // --------------------------------------
+
+// CREATORS
+inline
+MultiQueueThreadPool_StripedLock::MultiQueueThreadPool_StripedLock()
+{
+}
+
+// MANIPULATORS
+inline
+void MultiQueueThreadPool_StripedLock::lockWrite()
+{
+    // Stripes are always acquired in the same order so that concurrent
+    // writers cannot deadlock.
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes[i].d_lock.lockWrite();
+    }
+}
+
+inline
+bslmt::ReaderWriterMutex& MultiQueueThreadPool_StripedLock::stripe(int key)
+{
+    return d_stripes[key & (k_NUM_STRIPES - 1)].d_lock;
+}
+
+inline
+void MultiQueueThreadPool_StripedLock::unlock()
+{
+    for (int i = k_NUM_STRIPES - 1; 0 <= i; --i) {
+        d_stripes[i].d_lock.unlock();
+    }
+}
+
                         // --------------------------
                         // class MultiQueueThreadPool
                         // --------------------------
@@ -937,7 +1106,7 @@ int MultiQueueThreadPool::findIfUsable(int                          id,
 inline
 int MultiQueueThreadPool::addJobAtFront(int id, const Job& functor)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     MultiQueueThreadPool_Queue *queue;
 
@@ -956,7 +1125,7 @@ int MultiQueueThreadPool::addJobAtFront(int id, const Job& functor)
 inline
 int MultiQueueThreadPool::enqueueJob(int id, const Job& functor)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     MultiQueueThreadPool_Queue *queue;
 
@@ -977,7 +1146,7 @@ void MultiQueueThreadPool::numProcessedReset(int *numExecuted,
                                              int *numEnqueued,
                                              int *numDeleted)
 {
-    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::WriteLockGuard<MultiQueueThreadPool_StripedLock> guard(&d_lock);
 
     // To maintain consistency, all three must be zeroed atomically.
 
@@ -991,12 +1160,20 @@ void MultiQueueThreadPool::numProcessedReset(int *numExecuted,
     *numEnqueued = d_numEnqueued.swap(0);
 }
 
+inline
+void MultiQueueThreadPool::setDefaultBatchSize(int batchSize)
+{
+    BSLS_ASSERT_SAFE(1 <= batchSize);
+
+    d_defaultBatchSize = batchSize;
+}
+
 inline
 int MultiQueueThreadPool::setBatchSize(int id, int batchSize)
 {
     BSLS_ASSERT_SAFE(1 <= batchSize);
 
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     MultiQueueThreadPool_Queue *queue;
 
@@ -1013,7 +1190,7 @@ int MultiQueueThreadPool::setBatchSize(int id, int batchSize)
 inline
 int MultiQueueThreadPool::batchSize(int id) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
 
@@ -1024,10 +1201,16 @@ int MultiQueueThreadPool::batchSize(int id) const
     return -1;
 }
 
+inline
+int MultiQueueThreadPool::defaultBatchSize() const
+{
+    return d_defaultBatchSize;
+}
+
 inline
 bool MultiQueueThreadPool::isEnabled(int id) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
 
@@ -1041,7 +1224,7 @@ bool MultiQueueThreadPool::isEnabled(int id) const
 inline
 bool MultiQueueThreadPool::isPaused(int id) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
 
@@ -1063,7 +1246,7 @@ int MultiQueueThreadPool::numElements() const
 inline
 int MultiQueueThreadPool::numElements(int id) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(id));
 
     QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
 
@@ -1092,7 +1275,7 @@ void MultiQueueThreadPool::numProcessed(int *numExecuted,
 inline
 int MultiQueueThreadPool::numQueues() const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock.stripe(0));
 
     return static_cast<int>(d_queueRegistry.size());
 }
@@ -72,6 +72,7 @@ using namespace BloombergLP;
 //
 // MANIPULATORS
 // [33] void setBatchSize(int id, int batchSize);
+// [34] void setDefaultBatchSize(int batchSize);
 // [ 2] int createQueue();
 // [ 2] int deleteQueue(int id, const bsl::function<void()>& cleanupFunc);
 // [ 2] int enqueueJob(int id, const bsl::function<void()>& functor);
@@ -84,6 +85,7 @@ using namespace BloombergLP;
 //
 // ACCESSORS
 // [33] int batchSize(int id) const;
+// [34] int defaultBatchSize() const;
 // [13] void numProcessed(int *, int *, int * = 0) const;
 // [ 4] int numQueues() const;
 // [13] int numElements() const;
@@ -112,8 +114,10 @@ using namespace BloombergLP;
 // [30] DRQS 140150365: resume fails immediately after pause
 // [31] DRQS 140403279: pause can deadlock with delete and create
 // [32] DRQS 143578129: 'numElements' stress test
-// [34] USAGE EXAMPLE 1
+// [35] CONCERN: striped registry lock under concurrent use
+// [36] USAGE EXAMPLE 1
 // [-2] PERFORMANCE TEST
+// [-3] PERFORMANCE: job dispatch throughput
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1467,6 +1471,113 @@ struct DoNothing {
         // NOP functor for cases 21, 22.
 };
 
+// ============================================================================
+//                         For test case -3
+// ----------------------------------------------------------------------------
+
+namespace MULTIQUEUETHREADPOOL_CASE_MINUS_3 {
+
+void submitJobs(Obj             *mX,
+                const int       *queueIds,
+                int              numQueues,
+                int              numJobs,
+                int              offset,
+                bsls::AtomicInt *numReady,
+                bslmt::Barrier  *barrier)
+    // Increment the specified 'numReady' and wait on the specified 'barrier',
+    // then enqueue the specified 'numJobs' no-op jobs to the specified
+    // 'numQueues' queues of the specified 'mX' having the ids in the specified
+    // 'queueIds', in round-robin order starting at the specified 'offset'.
+{
+    const Func job = &noop;
+
+    ++*numReady;
+    barrier->wait();
+
+    for (int i = 0; i < numJobs; ++i) {
+        mX->enqueueJob(queueIds[(offset + i) % numQueues], job);
+    }
+}
+
+}  // close namespace MULTIQUEUETHREADPOOL_CASE_MINUS_3
+
+// ============================================================================
+//                         For test case 35
+// ----------------------------------------------------------------------------
+
+namespace MULTIQUEUETHREADPOOL_CASE_35 {
+
+enum {
+    k_NUM_QUEUES       = 40,  // more than the number of lock stripes
+    k_NUM_PRODUCERS    = 4,
+    k_NUM_JOBS         = 2000,
+    k_NUM_CHURN_ROUNDS = 200
+};
+
+void produce(Obj             *mX,
+             const int       *queueIds,
+             bsls::AtomicInt *counters,
+             bslmt::Barrier  *barrier)
+    // Wait on the specified 'barrier', then enqueue 'k_NUM_JOBS' jobs to the
+    // 'k_NUM_QUEUES' queues of the specified 'mX' having the ids in the
+    // specified 'queueIds', in round-robin order, each job incrementing the
+    // element of the specified 'counters' corresponding to its queue.
+{
+    barrier->wait();
+
+    for (int i = 0; i < k_NUM_JOBS; ++i) {
+        const int index = i % k_NUM_QUEUES;
+
+        Func job;
+        makeFunc(&job, incrementCounter, counters + index);
+
+        ASSERT(0 == mX->enqueueJob(queueIds[index], job));
+    }
+}
+
+void churn(Obj *mX, bslmt::Barrier *barrier)
+    // Wait on the specified 'barrier', then repeatedly create a queue in the
+    // specified 'mX', enqueue jobs to it, query it, and delete it.
+{
+    barrier->wait();
+
+    for (int i = 0; i < k_NUM_CHURN_ROUNDS; ++i) {
+        const int id = mX->createQueue();
+
+        ASSERT(0    == mX->enqueueJob(id, &noop));
+        ASSERT(0    == mX->addJobAtFront(id, &noop));
+        ASSERT(true == mX->isEnabled(id));
+        ASSERT(0    <  mX->numQueues());
+
+        if (i % 2) {
+            ASSERT(0 == mX->deleteQueue(id));
+        }
+        else {
+            ASSERT(0 == mX->deleteQueue(id, &noop));
+        }
+        ASSERT(-1 == mX->numElements(id));
+    }
+}
+
+}  // close namespace MULTIQUEUETHREADPOOL_CASE_35
+
+// ============================================================================
+//                         For test case 34
+// ----------------------------------------------------------------------------
+
+namespace MULTIQUEUETHREADPOOL_CASE_34 {
+
+void pauseOwnQueue(Obj *mX, int id)
+    // Pause the queue having the specified 'id' in the specified 'mX'.  Note
+    // that this function is intended to be executed as a job of that queue,
+    // so that the pause takes effect once the current batch of jobs
+    // completes.
+{
+    ASSERT(0 == mX->pauseQueue(id));
+}
+
+}  // close namespace MULTIQUEUETHREADPOOL_CASE_34
+
 // ============================================================================
 //                              MAIN PROGRAM
 
@@ -1481,7 +1592,7 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 34: {
+      case 36: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -1562,6 +1673,246 @@ int main(int argc, char *argv[]) {
         ASSERT(0 <  ta.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       }  break;
+      case 35: {
+        // --------------------------------------------------------------------
+        // CONCERN: STRIPED REGISTRY LOCK UNDER CONCURRENT USE
+        //
+        // Concerns:
+        //: 1 The write lock of the striped lock excludes readers of every
+        //:   stripe, and readers of different stripes do not exclude each
+        //:   other.
+        //:
+        //: 2 Queues whose ids select every stripe of the registry lock can be
+        //:   used.
+        //:
+        //: 3 Jobs enqueued concurrently from several threads to many queues
+        //:   are all executed, while other threads create and delete queues.
+        //
+        // Plan:
+        //: 1 Lock a 'bdlmt::MultiQueueThreadPool_StripedLock' for writing and
+        //:   verify that no stripe can be locked for reading; then read-lock
+        //:   two stripes at once.  (C-1)
+        //:
+        //: 2 Create more queues than there are stripes, and have several
+        //:   threads enqueue counting jobs to them while another thread
+        //:   repeatedly creates, uses, and deletes queues.  Drain the pool,
+        //:   and verify the counters and the job statistics.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: striped registry lock under concurrent use
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCERN: STRIPED REGISTRY LOCK\n"
+                          << "==============================\n";
+
+        using namespace MULTIQUEUETHREADPOOL_CASE_35;
+
+        if (verbose) cout << "\nTesting the striped lock." << endl;
+        {
+            bdlmt::MultiQueueThreadPool_StripedLock mX;
+
+            mX.lockWrite();
+            for (int i = 0; i < 64; ++i) {
+                ASSERTV(i, 0 != mX.stripe(i).tryLockRead());
+            }
+            mX.unlock();
+
+            ASSERT(0 == mX.stripe(0).tryLockRead());
+            ASSERT(0 == mX.stripe(1).tryLockRead());
+            ASSERT(0 == mX.stripe(0).tryLockRead());
+            mX.stripe(0).unlock();
+            mX.stripe(0).unlock();
+            mX.stripe(1).unlock();
+
+            ASSERT(0 == mX.stripe(5).tryLockWrite());
+            mX.stripe(5).unlock();
+        }
+
+        if (verbose) cout << "\nTesting concurrent use." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            {
+                Obj mX(bslmt::ThreadAttributes(), 2, 4, 30, &ta);
+                const Obj& X = mX;
+
+                ASSERT(0 == mX.start());
+
+                int             queueIds[k_NUM_QUEUES];
+                bsls::AtomicInt counters[k_NUM_QUEUES];
+
+                for (int i = 0; i < k_NUM_QUEUES; ++i) {
+                    queueIds[i] = mX.createQueue();
+                }
+
+                bslmt::Barrier     barrier(k_NUM_PRODUCERS + 1);
+                bslmt::ThreadGroup threads;
+
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    threads.addThread(bdlf::BindUtil::bind(&produce,
+                                                           &mX,
+                                                           queueIds,
+                                                           &counters[0],
+                                                           &barrier));
+                }
+                threads.addThread(bdlf::BindUtil::bind(&churn,
+                                                       &mX,
+                                                       &barrier));
+                threads.joinAll();
+
+                mX.drain();
+
+                ASSERT(k_NUM_QUEUES == X.numQueues());
+
+                for (int i = 0; i < k_NUM_QUEUES; ++i) {
+                    const int EXPECTED = k_NUM_PRODUCERS * k_NUM_JOBS
+                                                                / k_NUM_QUEUES;
+
+                    ASSERTV(i, counters[i], EXPECTED == counters[i]);
+                    ASSERTV(i, 0 == X.numElements(queueIds[i]));
+                }
+
+                int numExecuted;
+                int numEnqueued;
+                int numDeleted;
+
+                X.numProcessed(&numExecuted, &numEnqueued, &numDeleted);
+
+                ASSERTV(numEnqueued,
+                        k_NUM_PRODUCERS * k_NUM_JOBS + 2 * k_NUM_CHURN_ROUNDS
+                                                               == numEnqueued);
+                ASSERTV(numEnqueued, numExecuted, numDeleted,
+                        numEnqueued == numExecuted + numDeleted);
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+      }  break;
+      case 34: {
+        // --------------------------------------------------------------------
+        // TESTING DEFAULT BATCH SIZE
+        //
+        // Concerns:
+        //: 1 The default batch size is initially 1, and 'defaultBatchSize'
+        //:   returns the value assigned by 'setDefaultBatchSize'.
+        //:
+        //: 2 A queue created by 'createQueue' has the default batch size at
+        //:   the time of its creation, including a queue recycled from a
+        //:   deleted queue having another batch size.
+        //:
+        //: 3 Changing the default batch size does not affect existing queues.
+        //:
+        //: 4 A queue created with a default batch size of 'N' executes up to
+        //:   'N' jobs each time it is scheduled.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Set the default batch size, create queues, and verify the result
+        //:   of 'defaultBatchSize' and 'batchSize'.  (C-1..3)
+        //:
+        //: 2 For several default batch sizes, create a paused queue, enqueue
+        //:   a job pausing the queue followed by several counting jobs, and
+        //:   resume the queue.  Once the queue is paused again, verify that
+        //:   the number of counting jobs executed is one less than the batch
+        //:   size (since the pause takes effect at the end of the batch).
+        //:   (C-4)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-5)
+        //
+        // Testing:
+        //   void setDefaultBatchSize(int batchSize);
+        //   int defaultBatchSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING DEFAULT BATCH SIZE\n"
+                          << "==========================\n";
+
+        using namespace MULTIQUEUETHREADPOOL_CASE_34;
+
+        if (verbose) cout << "\nTesting 'defaultBatchSize'." << endl;
+        {
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);  const Obj& X = mX;
+
+            mX.start();
+
+            ASSERT(1 == X.defaultBatchSize());
+
+            const int id1 = mX.createQueue();
+            ASSERT(1 == X.batchSize(id1));
+
+            mX.setDefaultBatchSize(4);
+            ASSERT(4 == X.defaultBatchSize());
+            ASSERT(1 == X.batchSize(id1));
+
+            const int id2 = mX.createQueue();
+            ASSERT(4 == X.batchSize(id2));
+
+            ASSERT(0 == mX.setBatchSize(id2, 7));
+            ASSERT(0 == mX.deleteQueue(id2));
+
+            mX.setDefaultBatchSize(2);
+            ASSERT(2 == X.defaultBatchSize());
+            ASSERT(1 == X.batchSize(id1));
+
+            const int id3 = mX.createQueue();
+            ASSERT(2 == X.batchSize(id3));
+        }
+
+        if (verbose) cout << "\nTesting batch execution." << endl;
+        {
+            const int k_NUM_JOBS = 6;
+
+            for (int batchSize = 1; batchSize <= k_NUM_JOBS + 2; ++batchSize) {
+                Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);
+                const Obj& X = mX;
+
+                mX.start();
+                mX.setDefaultBatchSize(batchSize);
+
+                const int id = mX.createQueue();
+                ASSERT(0 == mX.pauseQueue(id));
+
+                bsls::AtomicInt count(0);
+
+                Func pauser;
+                makeFunc(&pauser, pauseOwnQueue, &mX, id);
+                ASSERT(0 == mX.enqueueJob(id, pauser));
+
+                for (int i = 0; i < k_NUM_JOBS; ++i) {
+                    Func job;
+                    makeFunc(&job, incrementCounter, &count);
+                    ASSERT(0 == mX.enqueueJob(id, job));
+                }
+
+                ASSERT(0 == mX.resumeQueue(id));
+
+                while (!X.isPaused(id)) {
+                    bslmt::ThreadUtil::yield();
+                }
+
+                const int EXPECTED = bsl::min(batchSize - 1, k_NUM_JOBS);
+
+                ASSERTV(batchSize, count, EXPECTED == count);
+                ASSERTV(batchSize, X.numElements(id),
+                        k_NUM_JOBS - EXPECTED == X.numElements(id));
+
+                ASSERT(0 == mX.resumeQueue(id));
+                ASSERT(0 == mX.drainQueue(id));
+                ASSERT(k_NUM_JOBS == count);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30);
+
+            ASSERT_SAFE_PASS(mX.setDefaultBatchSize( 1));
+            ASSERT_SAFE_PASS(mX.setDefaultBatchSize( 2));
+            ASSERT_SAFE_FAIL(mX.setDefaultBatchSize( 0));
+            ASSERT_SAFE_FAIL(mX.setDefaultBatchSize(-1));
+        }
+      }  break;
       case 33: {
         // --------------------------------------------------------------------
         // TESTING BATCH SIZE
@@ -5132,6 +5483,92 @@ int main(int argc, char *argv[]) {
                             mqpoolperf::MQPoolPerformance::testFastSearch);
         cp.printResult();
       }  break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: JOB DISPATCH THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of dispatching trivial jobs to many queues
+        //:   from several producer threads, for several default batch sizes.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 producer threads and batch sizes of 1, 4, and
+        //:   16, create 1000 queues, have the producers enqueue a fixed
+        //:   total number of no-op jobs to the queues in round-robin order,
+        //:   drain the pool, and report the number of jobs dispatched per
+        //:   second.  The total number of jobs (in thousands) can be
+        //:   specified as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: job dispatch throughput
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE: JOB DISPATCH THROUGHPUT\n"
+             << "====================================\n";
+
+        using namespace MULTIQUEUETHREADPOOL_CASE_MINUS_3;
+
+        enum { k_NUM_QUEUES = 1000 };
+
+        const int NUM_JOBS = 1000 * (argc > 2 ? bsl::atoi(argv[2]) : 400);
+
+        ASSERT(0 < NUM_JOBS);
+
+        bsl::vector<int> queueIds(k_NUM_QUEUES);
+
+        cout << "Thousand jobs per second (" << NUM_JOBS << " jobs, "
+             << k_NUM_QUEUES << " queues)\n"
+             << "producers    batch 1    batch 4   batch 16\n";
+
+        for (int numProducers = 1; numProducers <= 8; numProducers *= 2) {
+            cout << bsl::setw(9) << numProducers;
+
+            for (int batchSize = 1; batchSize <= 16; batchSize *= 4) {
+                Obj mX(bslmt::ThreadAttributes(), 4, 4, 30);
+
+                mX.start();
+                mX.setDefaultBatchSize(batchSize);
+
+                for (int i = 0; i < k_NUM_QUEUES; ++i) {
+                    queueIds[i] = mX.createQueue();
+                }
+
+                bsls::AtomicInt    numReady(0);
+                bslmt::Barrier     barrier(numProducers + 1);
+                bslmt::ThreadGroup threads;
+
+                for (int i = 0; i < numProducers; ++i) {
+                    threads.addThread(bdlf::BindUtil::bind(
+                                                     &submitJobs,
+                                                     &mX,
+                                                     queueIds.data(),
+                                                     k_NUM_QUEUES,
+                                                     NUM_JOBS / numProducers,
+                                                     i * 7,
+                                                     &numReady,
+                                                     &barrier));
+                }
+
+                while (numReady < numProducers) {
+                    bslmt::ThreadUtil::yield();
+                }
+
+                const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+                barrier.wait();
+                threads.joinAll();
+                mX.drain();
+                const bsls::Types::Int64 stop  = bsls::TimeUtil::getTimer();
+
+                const double seconds = static_cast<double>(stop - start)
+                                                                      / 1.0e9;
+
+                cout << bsl::setw(11) << bsl::fixed << bsl::setprecision(1)
+                     << (NUM_JOBS / numProducers * numProducers) / seconds
+                                                                      / 1000.0;
+            }
+            cout << endl;
+        }
+      }  break;
       default: {
           cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
           testStatus = -1;
@@ -0,0 +1,760 @@
+// bdlmt_timingwheeleventscheduler.cpp                                -*-C++-*-
+#include <bdlmt_timingwheeleventscheduler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_timingwheeleventscheduler_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_systemtime.h>
+
+#include <bsl_limits.h>
+
+// IMPLEMENTATION NOTES: The wheel at level 'L' has 'k_NUM_SLOTS' slots, each
+// spanning '2^(k_LEVEL_BITS * L)' ticks.  An event due in tick 'e', scheduled
+// when the next tick to be processed is 'c', is placed in the wheel at the
+// lowest level 'L' such that 'e - c < 2^(k_LEVEL_BITS * (L + 1))', in the slot
+// indexed by bits '[k_LEVEL_BITS * L, k_LEVEL_BITS * (L + 1))' of 'e'.  The
+// slot of the wheel at level 'L > 0' containing tick 't' is "cascaded" (its
+// events are re-placed according to the rule above) when 't' is processed and
+// is a multiple of '2^(k_LEVEL_BITS * L)'; at that point every event of the
+// slot is due less than '2^(k_LEVEL_BITS * L)' ticks later, and so moves to a
+// lower level.  The level-0 slot of tick 't' holds exactly the events due in
+// 't', which are moved to the ready list when 't' is processed.
+//
+// Events due too far in the future to fit in the outermost wheel are placed
+// as if due in the last tick that does fit, and are re-placed (using their
+// real expiry) when their slot is cascaded.
+//
+// Ticks are processed only by the dispatcher thread.  When the lower wheels
+// are empty, ticks are skipped up to the next tick at which a non-empty wheel
+// cascades, so that the cost of processing is independent of how long the
+// dispatcher slept.
+
+namespace BloombergLP {
+namespace bdlmt {
+
+namespace {
+
+const bsls::Types::Int64 k_DEFAULT_TICK_SIZE = 1000;  // microseconds
+
+const bsls::Types::Int64 k_GENERATION_MASK = 0x7FFFFFFF;
+    // The generation stored in a handle is masked so that handles are never
+    // negative.
+
+}  // close unnamed namespace
+
+                  // -------------------------------------
+                  // struct TimingWheelEventScheduler_Node
+                  // -------------------------------------
+
+// CREATORS
+TimingWheelEventScheduler_Node::TimingWheelEventScheduler_Node(
+                                                  int               index,
+                                                  bslma::Allocator *allocator)
+: d_callback(bsl::allocator_arg, allocator)
+, d_epochTime(0)
+, d_interval(0)
+, d_expiryTick(0)
+, d_generation(0)
+, d_index(index)
+, d_level(0)
+, d_state(e_FREE)
+, d_canceled(false)
+{
+    d_prev_p = this;
+    d_next_p = this;
+}
+
+                      // -------------------------------
+                      // class TimingWheelEventScheduler
+                      // -------------------------------
+
+// PRIVATE CLASS METHODS
+void TimingWheelEventScheduler::spliceAll(Link *list, Link *from)
+{
+    if (from->d_next_p == from) {
+        return;                                                       // RETURN
+    }
+
+    Link *first = from->d_next_p;
+    Link *last  = from->d_prev_p;
+
+    first->d_prev_p          = list->d_prev_p;
+    list->d_prev_p->d_next_p = first;
+    last->d_next_p           = list;
+    list->d_prev_p           = last;
+
+    from->d_prev_p = from;
+    from->d_next_p = from;
+}
+
+// PRIVATE MANIPULATORS
+void TimingWheelEventScheduler::advance(bsls::Types::Int64 nowTick)
+{
+    while (d_currentTick <= nowTick) {
+        int level = 0;
+        while (level < k_NUM_LEVELS && 0 == d_levelCounts[level]) {
+            ++level;
+        }
+
+        if (k_NUM_LEVELS == level) {
+            // No event is scheduled: all ticks up to 'nowTick' are trivially
+            // processed.
+
+            d_currentTick = nowTick + 1;
+            return;                                                   // RETURN
+        }
+
+        if (0 < level) {
+            // The wheels below 'level' are empty; skip to the next tick at
+            // which the wheel at 'level' cascades.
+
+            const bsls::Types::Int64 span =
+                              bsls::Types::Int64(1) << (k_LEVEL_BITS * level);
+            const bsls::Types::Int64 boundary =
+                                     (d_currentTick + span - 1) & ~(span - 1);
+
+            if (boundary > nowTick) {
+                d_currentTick = nowTick + 1;
+                return;                                               // RETURN
+            }
+            d_currentTick = boundary;
+        }
+
+        const bsls::Types::Int64 tick = d_currentTick;
+
+        for (int l = 1; l < k_NUM_LEVELS; ++l) {
+            const int shift = k_LEVEL_BITS * l;
+
+            if (0 != (tick & ((bsls::Types::Int64(1) << shift) - 1))) {
+                break;
+            }
+
+            Link *slot = &d_wheels[l][(tick >> shift) & (k_NUM_SLOTS - 1)];
+
+            Link cascaded;
+            cascaded.d_prev_p = &cascaded;
+            cascaded.d_next_p = &cascaded;
+            spliceAll(&cascaded, slot);
+
+            while (cascaded.d_next_p != &cascaded) {
+                Node *node = static_cast<Node *>(cascaded.d_next_p);
+                unlink(node);
+                --d_levelCounts[l];
+                link(node);
+            }
+        }
+
+        Link *slot = &d_wheels[0][tick & (k_NUM_SLOTS - 1)];
+        for (Link *p = slot->d_next_p; p != slot; p = p->d_next_p) {
+            static_cast<Node *>(p)->d_state = Node::e_READY;
+            --d_levelCounts[0];
+        }
+        spliceAll(&d_ready, slot);
+
+        ++d_currentTick;
+    }
+}
+
+int TimingWheelEventScheduler::cancelNode(Node *node)
+{
+    BSLS_ASSERT(Node::e_FREE != node->d_state);
+
+    if (Node::e_RUNNING == node->d_state) {
+        if (0 == node->d_interval || node->d_canceled) {
+            return 1;                                                 // RETURN
+        }
+        node->d_canceled = true;
+        --d_numRecurringEvents;
+        return 0;                                                     // RETURN
+    }
+
+    unlinkNode(node);
+
+    if (node->d_interval) {
+        --d_numRecurringEvents;
+    }
+    else {
+        --d_numEvents;
+    }
+    freeNode(node);
+
+    return 0;
+}
+
+void TimingWheelEventScheduler::dispatchEvents()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    while (d_running) {
+        advance(nowTick());
+
+        if (d_ready.d_next_p != &d_ready) {
+            Node *node = static_cast<Node *>(d_ready.d_next_p);
+            unlink(node);
+
+            if (0 == node->d_interval) {
+                --d_numEvents;
+            }
+            node->d_state   = Node::e_RUNNING;
+            d_currentNode_p = node;
+
+            d_mutex.unlock();
+            d_dispatcherFunctor(node->d_callback);
+            d_mutex.lock();
+
+            d_currentNode_p = 0;
+
+            if (node->d_interval && !node->d_canceled) {
+                node->d_epochTime  += node->d_interval;
+                node->d_expiryTick  = toExpiryTick(node->d_epochTime);
+                link(node);
+            }
+            else {
+                freeNode(node);
+            }
+
+            d_iterationCondition.broadcast();
+            continue;
+        }
+
+        bool empty = true;
+        for (int level = 0; level < k_NUM_LEVELS; ++level) {
+            if (d_levelCounts[level]) {
+                empty = false;
+                break;
+            }
+        }
+
+        if (empty) {
+            d_wakeTick = bsl::numeric_limits<bsls::Types::Int64>::max();
+            d_queueCondition.wait(&d_mutex);
+        }
+        else {
+            d_wakeTick = nextWakeTick();
+
+            bsls::TimeInterval wakeTime;
+            wakeTime.addMicroseconds(d_wakeTick * d_tickSize);
+            d_queueCondition.timedWait(&d_mutex, wakeTime);
+        }
+        d_wakeTick = 0;
+    }
+}
+
+TimingWheelEventScheduler::Node *TimingWheelEventScheduler::findNode(
+                                                           Handle handle) const
+{
+    if (0 > handle) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Int64 index = handle & 0xFFFFFFFF;
+
+    if (index >= static_cast<bsls::Types::Int64>(d_nodes.size())) {
+        return 0;                                                     // RETURN
+    }
+
+    Node *node = d_nodes[static_cast<bsl::size_t>(index)];
+
+    if (Node::e_FREE == node->d_state
+     || (node->d_generation & k_GENERATION_MASK) != (handle >> 32)) {
+        return 0;                                                     // RETURN
+    }
+
+    return node;
+}
+
+void TimingWheelEventScheduler::freeNode(Node *node)
+{
+    node->d_callback = bsl::nullptr_t();
+    node->d_state    = Node::e_FREE;
+    ++node->d_generation;
+
+    d_freeNodes.push_back(node->d_index);
+}
+
+void TimingWheelEventScheduler::initialize()
+{
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+            d_wheels[level][slot].d_prev_p = &d_wheels[level][slot];
+            d_wheels[level][slot].d_next_p = &d_wheels[level][slot];
+        }
+        d_levelCounts[level] = 0;
+    }
+    d_ready.d_prev_p = &d_ready;
+    d_ready.d_next_p = &d_ready;
+}
+
+TimingWheelEventScheduler::Handle TimingWheelEventScheduler::insertEvent(
+                                      const bsl::function<void()>& callback,
+                                      bsls::Types::Int64           epochTime,
+                                      bsls::Types::Int64           interval)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    Node *node;
+
+    if (d_freeNodes.empty()) {
+        const int index = static_cast<int>(d_nodes.size());
+
+        d_freeNodes.reserve(d_freeNodes.size() + 1);
+        d_nodes.reserve(d_nodes.size() + 1);
+
+        node = new (*d_allocator_p) Node(index, d_allocator_p);
+        d_nodes.push_back(node);
+
+        node->d_callback = callback;
+    }
+    else {
+        node = d_nodes[d_freeNodes.back()];
+
+        node->d_callback = callback;
+        d_freeNodes.pop_back();
+    }
+
+    node->d_epochTime  = epochTime;
+    node->d_interval   = interval;
+    node->d_expiryTick = toExpiryTick(epochTime);
+    node->d_canceled   = false;
+
+    if (interval) {
+        ++d_numRecurringEvents;
+    }
+    else {
+        ++d_numEvents;
+    }
+
+    link(node);
+
+    if (d_wakeTick && node->d_expiryTick < d_wakeTick) {
+        d_queueCondition.signal();
+    }
+
+    return (static_cast<Handle>(node->d_generation & k_GENERATION_MASK) << 32)
+         | node->d_index;
+}
+
+void TimingWheelEventScheduler::link(Node *node)
+{
+    const bsls::Types::Int64 expiry = node->d_expiryTick;
+
+    if (expiry < d_currentTick) {
+        node->d_state = Node::e_READY;
+        append(&d_ready, node);
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Int64 distance = expiry - d_currentTick;
+    bsls::Types::Int64       position = expiry;
+    int                      level    = 0;
+
+    if (distance >> (k_LEVEL_BITS * k_NUM_LEVELS)) {
+        level    = k_NUM_LEVELS - 1;
+        position = d_currentTick +
+                   (bsls::Types::Int64(1) << (k_LEVEL_BITS * k_NUM_LEVELS)) -
+                   1;
+    }
+    else {
+        while (distance >> (k_LEVEL_BITS * (level + 1))) {
+            ++level;
+        }
+    }
+
+    const int slot = static_cast<int>(
+                   (position >> (k_LEVEL_BITS * level)) & (k_NUM_SLOTS - 1));
+
+    node->d_state = Node::e_SCHEDULED;
+    node->d_level = level;
+    ++d_levelCounts[level];
+    append(&d_wheels[level][slot], node);
+}
+
+void TimingWheelEventScheduler::unlinkNode(Node *node)
+{
+    BSLS_ASSERT(Node::e_SCHEDULED == node->d_state
+             || Node::e_READY     == node->d_state);
+
+    if (Node::e_SCHEDULED == node->d_state) {
+        --d_levelCounts[node->d_level];
+    }
+    unlink(node);
+}
+
+// PRIVATE ACCESSORS
+bsls::Types::Int64 TimingWheelEventScheduler::nextWakeTick() const
+{
+    if (d_levelCounts[0]) {
+        const bsls::Types::Int64 boundary =
+                                       (d_currentTick | (k_NUM_SLOTS - 1)) + 1;
+
+        for (bsls::Types::Int64 t = d_currentTick; t < boundary; ++t) {
+            const Link *slot = &d_wheels[0][t & (k_NUM_SLOTS - 1)];
+            if (slot->d_next_p != slot) {
+                return t;                                          // RETURN
+            }
+        }
+        return boundary;                                              // RETURN
+    }
+
+    int level = 1;
+    while (level < k_NUM_LEVELS - 1 && 0 == d_levelCounts[level]) {
+        ++level;
+    }
+
+    const bsls::Types::Int64 span =
+                              bsls::Types::Int64(1) << (k_LEVEL_BITS * level);
+
+    return (d_currentTick + span - 1) & ~(span - 1);
+}
+
+bsls::Types::Int64 TimingWheelEventScheduler::nowTick() const
+{
+    return now().totalMicroseconds() / d_tickSize;
+}
+
+bsls::Types::Int64 TimingWheelEventScheduler::toExpiryTick(
+                                            bsls::Types::Int64 epochTime) const
+{
+    if (0 >= epochTime) {
+        return 0;                                                     // RETURN
+    }
+    return (epochTime + d_tickSize - 1) / d_tickSize;
+}
+
+// CREATORS
+TimingWheelEventScheduler::TimingWheelEventScheduler(
+                                              bslma::Allocator *basicAllocator)
+: d_ready()
+, d_nodes(basicAllocator)
+, d_freeNodes(basicAllocator)
+, d_tickSize(k_DEFAULT_TICK_SIZE)
+, d_currentTick(0)
+, d_wakeTick(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_currentNode_p(0)
+, d_dispatcherFunctor(bsl::allocator_arg,
+                      basicAllocator,
+                      bdlf::BindUtil::bind(&bsl::function<void()>::operator(),
+                                           bdlf::PlaceHolders::_1))
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(bsls::SystemClockType::e_REALTIME)
+, d_iterationCondition()
+, d_running(false)
+, d_clockType(bsls::SystemClockType::e_REALTIME)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+TimingWheelEventScheduler::TimingWheelEventScheduler(
+                                   bsls::SystemClockType::Enum  clockType,
+                                   bslma::Allocator            *basicAllocator)
+: d_ready()
+, d_nodes(basicAllocator)
+, d_freeNodes(basicAllocator)
+, d_tickSize(k_DEFAULT_TICK_SIZE)
+, d_currentTick(0)
+, d_wakeTick(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_currentNode_p(0)
+, d_dispatcherFunctor(bsl::allocator_arg,
+                      basicAllocator,
+                      bdlf::BindUtil::bind(&bsl::function<void()>::operator(),
+                                           bdlf::PlaceHolders::_1))
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_iterationCondition()
+, d_running(false)
+, d_clockType(clockType)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+TimingWheelEventScheduler::TimingWheelEventScheduler(
+                                   const bsls::TimeInterval&    tickSize,
+                                   bsls::SystemClockType::Enum  clockType,
+                                   bslma::Allocator            *basicAllocator)
+: d_ready()
+, d_nodes(basicAllocator)
+, d_freeNodes(basicAllocator)
+, d_tickSize(tickSize.totalMicroseconds())
+, d_currentTick(0)
+, d_wakeTick(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_currentNode_p(0)
+, d_dispatcherFunctor(bsl::allocator_arg,
+                      basicAllocator,
+                      bdlf::BindUtil::bind(&bsl::function<void()>::operator(),
+                                           bdlf::PlaceHolders::_1))
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_iterationCondition()
+, d_running(false)
+, d_clockType(clockType)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+TimingWheelEventScheduler::TimingWheelEventScheduler(
+                             const Dispatcher&            dispatcherFunctor,
+                             const bsls::TimeInterval&    tickSize,
+                             bsls::SystemClockType::Enum  clockType,
+                             bslma::Allocator            *basicAllocator)
+: d_ready()
+, d_nodes(basicAllocator)
+, d_freeNodes(basicAllocator)
+, d_tickSize(tickSize.totalMicroseconds())
+, d_currentTick(0)
+, d_wakeTick(0)
+, d_numEvents(0)
+, d_numRecurringEvents(0)
+, d_currentNode_p(0)
+, d_dispatcherFunctor(bsl::allocator_arg, basicAllocator, dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_iterationCondition()
+, d_running(false)
+, d_clockType(clockType)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+TimingWheelEventScheduler::~TimingWheelEventScheduler()
+{
+    stop();
+
+    for (bsl::size_t i = 0; i < d_nodes.size(); ++i) {
+        d_allocator_p->deleteObjectRaw(d_nodes[i]);
+    }
+}
+
+// MANIPULATORS
+void TimingWheelEventScheduler::cancelAllEvents()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    for (bsl::size_t i = 0; i < d_nodes.size(); ++i) {
+        Node *node = d_nodes[i];
+
+        if (Node::e_FREE != node->d_state) {
+            cancelNode(node);
+        }
+    }
+}
+
+void TimingWheelEventScheduler::cancelAllEventsAndWait()
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    for (bsl::size_t i = 0; i < d_nodes.size(); ++i) {
+        Node *node = d_nodes[i];
+
+        if (Node::e_FREE != node->d_state) {
+            cancelNode(node);
+        }
+    }
+
+    while (d_currentNode_p) {
+        d_iterationCondition.wait(&d_mutex);
+    }
+}
+
+int TimingWheelEventScheduler::cancelEvent(Handle handle)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    Node *node = findNode(handle);
+
+    return node ? cancelNode(node) : 1;
+}
+
+int TimingWheelEventScheduler::cancelEventAndWait(Handle handle)
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    Node *node = findNode(handle);
+
+    if (!node) {
+        return 1;                                                     // RETURN
+    }
+
+    const unsigned int generation = node->d_generation;
+    const int          rc         = cancelNode(node);
+
+    while (node == d_currentNode_p && generation == node->d_generation) {
+        d_iterationCondition.wait(&d_mutex);
+    }
+
+    return rc;
+}
+
+int TimingWheelEventScheduler::rescheduleEvent(
+                                       Handle                    handle,
+                                       const bsls::TimeInterval& newEpochTime)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    Node *node = findNode(handle);
+
+    if (!node || node->d_interval || Node::e_RUNNING == node->d_state) {
+        return 1;                                                     // RETURN
+    }
+
+    unlinkNode(node);
+
+    node->d_epochTime  = newEpochTime.totalMicroseconds();
+    node->d_expiryTick = toExpiryTick(node->d_epochTime);
+
+    link(node);
+
+    if (d_wakeTick && node->d_expiryTick < d_wakeTick) {
+        d_queueCondition.signal();
+    }
+
+    return 0;
+}
+
+TimingWheelEventScheduler::Handle TimingWheelEventScheduler::scheduleEvent(
+                                       const bsls::TimeInterval&    epochTime,
+                                       const bsl::function<void()>& callback)
+{
+    return insertEvent(callback, epochTime.totalMicroseconds(), 0);
+}
+
+TimingWheelEventScheduler::Handle
+TimingWheelEventScheduler::scheduleRecurringEvent(
+                                  const bsls::TimeInterval&    interval,
+                                  const bsl::function<void()>& callback,
+                                  const bsls::TimeInterval&    startEpochTime)
+{
+    BSLS_ASSERT(1 <= interval.totalMicroseconds());
+
+    const bsls::TimeInterval start = bsls::TimeInterval() == startEpochTime
+                                   ? now() + interval
+                                   : startEpochTime;
+
+    return insertEvent(callback,
+                       start.totalMicroseconds(),
+                       interval.totalMicroseconds());
+}
+
+int TimingWheelEventScheduler::start()
+{
+    bslmt::ThreadAttributes attr;
+
+    return start(attr);
+}
+
+int TimingWheelEventScheduler::start(
+                              const bslmt::ThreadAttributes& threadAttributes)
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    // Implementation note: d_dispatcherMutex is in a lock hierarchy with
+    // d_mutex and must be locked first.
+
+    bslmt::LockGuard<bslmt::Mutex> dispatcherLock(&d_dispatcherMutex);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (d_running ||
+        bslmt::ThreadUtil::invalidHandle() != d_dispatcherThread) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::ThreadAttributes modAttr(threadAttributes);
+    modAttr.setDetachedState(bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+    if (bslmt::ThreadUtil::createWithAllocator(
+             &d_dispatcherThread,
+             modAttr,
+             bdlf::BindUtil::bind(&TimingWheelEventScheduler::dispatchEvents,
+                                  this),
+             d_allocator_p)) {
+        return -1;                                                    // RETURN
+    }
+
+    d_running = true;
+    return 0;
+}
+
+void TimingWheelEventScheduler::stop()
+{
+    BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                            d_dispatcherThread));
+
+    // Implementation note: d_dispatcherMutex is in a lock hierarchy with
+    // d_mutex and must be locked first.
+
+    bslmt::LockGuard<bslmt::Mutex> dispatcherLock(&d_dispatcherMutex);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (!d_running) {
+        return;                                                       // RETURN
+    }
+
+    d_running = false;
+    d_queueCondition.signal();
+
+    lock.release()->unlock();
+
+    bslmt::ThreadUtil::join(d_dispatcherThread);
+    d_dispatcherThread = bslmt::ThreadUtil::invalidHandle();
+}
+
+// ACCESSORS
+bsls::TimeInterval TimingWheelEventScheduler::now() const
+{
+    return bsls::SystemTime::now(d_clockType);
+}
+
+int TimingWheelEventScheduler::numEvents() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    return d_numEvents;
+}
+
+int TimingWheelEventScheduler::numRecurringEvents() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    return d_numRecurringEvents;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
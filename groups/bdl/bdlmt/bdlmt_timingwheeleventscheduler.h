@@ -0,0 +1,628 @@
+// bdlmt_timingwheeleventscheduler.h                                  -*-C++-*-
+#ifndef INCLUDED_BDLMT_TIMINGWHEELEVENTSCHEDULER
+#define INCLUDED_BDLMT_TIMINGWHEELEVENTSCHEDULER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an event scheduler with O(1) schedule and cancel.
+//
+//@CLASSES:
+//  bdlmt::TimingWheelEventScheduler: hierarchical timing-wheel scheduler
+//
+//@SEE_ALSO: bdlmt_eventscheduler, bdlmt_timereventscheduler
+//
+//@DESCRIPTION: This component provides a thread-safe event scheduler,
+// 'bdlmt::TimingWheelEventScheduler', that schedules and cancels one-time and
+// recurring events in constant time.  Like 'bdlmt::EventScheduler', the
+// callbacks of the events are processed by a separate thread (called the
+// dispatcher thread), and are executed either in the dispatcher thread or by
+// an optionally supplied dispatcher functor.
+//
+///Comparison to 'bdlmt::EventScheduler'
+///-------------------------------------
+// 'bdlmt::EventScheduler' orders its events in skip lists: scheduling and
+// canceling an event take O(log n) time and allocate (and free) a list node.
+// This component instead keeps its events in a hashed, hierarchical timing
+// wheel: the time line is divided into "ticks" of a size specified at
+// construction, and each event is hashed into a slot of one of several wheels
+// of coarser and coarser resolution according to the number of ticks until it
+// expires.  Scheduling and canceling an event are then O(1) operations that
+// link or unlink a node, and nodes are recycled rather than freed, so a
+// workload that schedules and cancels events at a steady rate (e.g., session
+// timeouts, nearly all of which are canceled before they expire) performs no
+// memory allocation in the steady state (other than what the callback itself
+// may require).
+//
+// The costs of this approach are:
+//
+//: o Events are dispatched with a resolution of one tick: an event is
+//:   dispatched no earlier than its scheduled time, but up to one tick (plus
+//:   scheduling latency) later.  Events that expire in the same tick are not
+//:   guaranteed to be dispatched in the order of their scheduled times.
+//:
+//: o While events are scheduled, the dispatcher thread wakes at least once
+//:   every 256 ticks to move ("cascade") events from coarser wheels to finer
+//:   ones.  The tick size should therefore be chosen as the coarsest
+//:   resolution acceptable to the application.
+//
+// Events are referred to by integral handles, as in
+// 'bdlmt::TimerEventScheduler', which do not need to be released: a handle
+// becomes invalid when its event is dispatched (for a one-time event) or
+// canceled, and an invalid handle is never confused with the handle of a
+// subsequently scheduled event.
+//
+///Wheel Geometry
+///--------------
+// The scheduler has 'k_NUM_LEVELS' wheels of 'k_NUM_SLOTS' slots each.  The
+// slots of the wheel at level 'L' each span '256^L' ticks, so that the four
+// wheels together cover '256^4' ticks (about 49 days with the default tick of
+// one millisecond).  An event further in the future is parked in the
+// outermost wheel and re-hashed each time that wheel turns.
+//
+///Thread Safety
+///-------------
+// 'bdlmt::TimingWheelEventScheduler' is fully thread-safe, meaning that all
+// non-creator methods can be safely invoked concurrently from multiple
+// threads.  'stop', 'cancelEventAndWait', and 'cancelAllEventsAndWait' must
+// not be invoked from the dispatcher thread.
+//
+///Supported Clock-Types
+///---------------------
+// As for 'bdlmt::EventScheduler', the 'bsls::SystemClockType' supplied at
+// construction determines the epoch of all the times supplied to, and
+// returned by, this scheduler; the current time according to that clock is
+// available from the 'now' accessor.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Session Timeouts
+///- - - - - - - - - - - - - -
+// A server closes sessions that have been idle for longer than a timeout.
+// Every message received on a session cancels the pending timeout of the
+// session and schedules a new one, so that nearly every timeout is canceled
+// before it expires.
+//
+// First, we define a session, holding the handle of its pending timeout:
+//..
+//  struct Session {
+//      bdlmt::TimingWheelEventScheduler::Handle d_timeout;
+//      bsls::AtomicBool                         d_closed;
+//  };
+//
+//  void closeSession(Session *session)
+//      // Close the specified 'session'.
+//  {
+//      session->d_closed = true;
+//  }
+//..
+// Then, we create a scheduler having a tick of 10 milliseconds, based on the
+// monotonic clock, and start it:
+//..
+//  bdlmt::TimingWheelEventScheduler scheduler(
+//                                     bsls::TimeInterval(0, 10 * 1000 * 1000),
+//                                     bsls::SystemClockType::e_MONOTONIC);
+//  scheduler.start();
+//..
+// Next, we schedule the initial timeout of a session, one second from now:
+//..
+//  const bsls::TimeInterval timeout(1.0);
+//
+//  Session session;
+//  session.d_closed  = false;
+//  session.d_timeout = scheduler.scheduleEvent(
+//                             scheduler.now() + timeout,
+//                             bdlf::BindUtil::bind(&closeSession, &session));
+//..
+// Then, each time a message arrives, we push the timeout back by canceling
+// the pending event and scheduling a new one (in a real server,
+// 'rescheduleEvent' could be used instead):
+//..
+//  for (int i = 0; i < 1000; ++i) {
+//      int rc = scheduler.cancelEvent(session.d_timeout);
+//      assert(0 == rc);
+//
+//      session.d_timeout = scheduler.scheduleEvent(
+//                             scheduler.now() + timeout,
+//                             bdlf::BindUtil::bind(&closeSession, &session));
+//  }
+//  assert(!session.d_closed);
+//  assert(1 == scheduler.numEvents());
+//..
+// Finally, once messages stop arriving, the session is closed after the
+// timeout expires:
+//..
+//  while (!session.d_closed) {
+//      bslmt::ThreadUtil::microSleep(10 * 1000);
+//  }
+//  assert(0 == scheduler.numEvents());
+//
+//  scheduler.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_systemclocktype.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                  // =====================================
+                  // struct TimingWheelEventScheduler_Link
+                  // =====================================
+
+struct TimingWheelEventScheduler_Link {
+    // [!PRIVATE!] This 'struct' provides the links of a circular,
+    // doubly-linked, intrusive list.  A list is represented by a sentinel
+    // link, which is empty when it refers to itself.
+
+    // DATA
+    TimingWheelEventScheduler_Link *d_prev_p;  // previous link
+    TimingWheelEventScheduler_Link *d_next_p;  // next link
+};
+
+                  // =====================================
+                  // struct TimingWheelEventScheduler_Node
+                  // =====================================
+
+struct TimingWheelEventScheduler_Node : TimingWheelEventScheduler_Link {
+    // [!PRIVATE!] This 'struct' holds the state of a scheduled event.  Nodes
+    // are owned by the scheduler and recycled when their events complete or
+    // are canceled.
+
+    // TYPES
+    enum State {
+        e_FREE,       // not in use
+        e_SCHEDULED,  // linked into a slot of a wheel
+        e_READY,      // linked into the list of events due for dispatch
+        e_RUNNING     // callback being executed by the dispatcher thread
+    };
+
+    // DATA
+    bsl::function<void()> d_callback;     // callback to dispatch
+
+    bsls::Types::Int64    d_epochTime;    // time, in microseconds, at which
+                                          // the event is due
+
+    bsls::Types::Int64    d_interval;     // interval, in microseconds, of a
+                                          // recurring event, and 0 for a
+                                          // one-time event
+
+    bsls::Types::Int64    d_expiryTick;   // tick in which the event is due
+
+    unsigned int          d_generation;   // incremented each time the node
+                                          // is freed, to invalidate handles
+
+    int                   d_index;        // index in the node table
+
+    int                   d_level;        // wheel containing the node, if
+                                          // scheduled
+
+    State                 d_state;        // current state
+
+    bool                  d_canceled;     // 'true' if a running recurring
+                                          // event was canceled
+
+    // CREATORS
+    TimingWheelEventScheduler_Node(int index, bslma::Allocator *allocator);
+        // Create a free node having the specified 'index', using the
+        // specified 'allocator' to supply memory.
+};
+
+                      // ===============================
+                      // class TimingWheelEventScheduler
+                      // ===============================
+
+class TimingWheelEventScheduler {
+    // This class provides a thread-safe event scheduler, based on a
+    // hierarchical timing wheel, that executes callbacks in a separate
+    // "dispatcher thread."  'start' must be invoked to start dispatching the
+    // callbacks.  'stop' pauses the dispatching of the callbacks without
+    // removing the pending events.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsls::Types::Int64 Handle;
+        // Handle of a scheduled event.
+
+    typedef bsl::function<void(const bsl::function<void()>&)> Dispatcher;
+        // Defines a type alias for the dispatcher functor type.
+
+    // PUBLIC CONSTANTS
+    enum {
+        e_INVALID_HANDLE = -1  // value never returned as a valid handle
+    };
+
+    enum {
+        k_NUM_LEVELS    = 4,    // number of wheels
+        k_LEVEL_BITS    = 8,    // log2 of the number of slots of a wheel
+        k_NUM_SLOTS     = 1 << k_LEVEL_BITS
+                                // number of slots of each wheel
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef TimingWheelEventScheduler_Link Link;
+    typedef TimingWheelEventScheduler_Node Node;
+
+    // DATA
+    Link                      d_wheels[k_NUM_LEVELS][k_NUM_SLOTS];
+                                                // sentinels of the slots
+
+    int                       d_levelCounts[k_NUM_LEVELS];
+                                                // number of events in each
+                                                // wheel
+
+    Link                      d_ready;          // sentinel of the list of
+                                                // events due for dispatch
+
+    bsl::vector<Node *>       d_nodes;          // all nodes, by index
+                                                // (owned)
+
+    bsl::vector<int>          d_freeNodes;      // indices of free nodes
+
+    bsls::Types::Int64        d_tickSize;       // tick size, in microseconds
+
+    bsls::Types::Int64        d_currentTick;    // next tick to be processed;
+                                                // all earlier ticks have been
+                                                // processed
+
+    bsls::Types::Int64        d_wakeTick;       // tick at which the sleeping
+                                                // dispatcher will wake, or 0
+                                                // if it is not sleeping
+
+    int                       d_numEvents;      // number of one-time events
+                                                // scheduled or ready
+
+    int                       d_numRecurringEvents;
+                                                // number of recurring events
+
+    Node                     *d_currentNode_p;  // event being dispatched, if
+                                                // any
+
+    Dispatcher                d_dispatcherFunctor;
+                                                // dispatches callbacks
+
+    bslmt::ThreadUtil::Handle d_dispatcherThread;
+                                                // dispatcher thread handle
+
+    bslmt::Mutex              d_dispatcherMutex;
+                                                // serializes starting and
+                                                // stopping the dispatcher
+
+    mutable bslmt::Mutex      d_mutex;          // protects all the above
+
+    bslmt::Condition          d_queueCondition; // signaled when the
+                                                // dispatcher must re-examine
+                                                // the wheel
+
+    bslmt::Condition          d_iterationCondition;
+                                                // signaled when the
+                                                // dispatcher completes an
+                                                // event
+
+    bool                      d_running;        // controls the dispatcher
+                                                // loop
+
+    bsls::SystemClockType::Enum
+                              d_clockType;      // clock type used
+
+    bslma::Allocator         *d_allocator_p;    // memory allocator (held, not
+                                                // owned)
+
+    // PRIVATE CLASS METHODS
+    static void append(Link *list, Link *link);
+        // Append the specified 'link' to the end of the specified 'list'.
+
+    static void spliceAll(Link *list, Link *from);
+        // Move all links of the specified 'from' list to the end of the
+        // specified 'list'.
+
+    static void unlink(Link *link);
+        // Remove the specified 'link' from the list containing it.
+
+    // PRIVATE MANIPULATORS
+    void advance(bsls::Types::Int64 nowTick);
+        // Process every tick up to and including the specified 'nowTick',
+        // cascading events to finer wheels and moving the events that are due
+        // to the ready list.  The behavior is undefined unless 'd_mutex' is
+        // locked.
+
+    int cancelNode(Node *node);
+        // Cancel the event of the specified 'node'.  Return 0 on success, and
+        // a non-zero value if the event is a one-time event being dispatched
+        // or a recurring event being dispatched that was already canceled.
+        // The behavior is undefined unless 'd_mutex' is locked and 'node' is
+        // not free.
+
+    void dispatchEvents();
+        // While 'd_running' is 'true', dispatch events at their scheduled
+        // times.  Note that this method implements the dispatcher thread.
+
+    Node *findNode(Handle handle) const;
+        // Return the node referred to by the specified 'handle', or 0 if
+        // 'handle' is not the handle of a scheduled, ready, or running event.
+        // The behavior is undefined unless 'd_mutex' is locked.
+
+    void freeNode(Node *node);
+        // Return the specified 'node' to the free list, invalidating its
+        // handles.  The behavior is undefined unless 'd_mutex' is locked and
+        // 'node' is not linked into any list.
+
+    void initialize();
+        // Make every wheel slot and the ready list empty.  Note that this
+        // method is invoked by each constructor.
+
+    Handle insertEvent(const bsl::function<void()>& callback,
+                       bsls::Types::Int64           epochTime,
+                       bsls::Types::Int64           interval);
+        // Schedule an event executing the specified 'callback' at the
+        // specified 'epochTime' (in microseconds), recurring with the
+        // specified 'interval' (in microseconds) if it is not 0, and return
+        // its handle.
+
+    void link(Node *node);
+        // Link the specified 'node' into the wheel slot (or the ready list)
+        // corresponding to its expiry.  The behavior is undefined unless
+        // 'd_mutex' is locked.
+
+    void unlinkNode(Node *node);
+        // Unlink the specified scheduled or ready 'node'.  The behavior is
+        // undefined unless 'd_mutex' is locked.
+
+    // PRIVATE ACCESSORS
+    bsls::Types::Int64 nextWakeTick() const;
+        // Return the earliest tick at which the dispatcher must examine the
+        // wheel.  The behavior is undefined unless 'd_mutex' is locked and
+        // some event is scheduled.
+
+    bsls::Types::Int64 nowTick() const;
+        // Return the index of the current tick.
+
+    bsls::Types::Int64 toExpiryTick(bsls::Types::Int64 epochTime) const;
+        // Return the index of the first tick starting at or after the
+        // specified 'epochTime' (in microseconds).
+
+    // NOT IMPLEMENTED
+    TimingWheelEventScheduler(const TimingWheelEventScheduler&);
+    TimingWheelEventScheduler& operator=(const TimingWheelEventScheduler&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimingWheelEventScheduler,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TimingWheelEventScheduler(bslma::Allocator *basicAllocator = 0);
+        // Construct a scheduler having a tick of one millisecond, using the
+        // default dispatcher functor and the realtime clock epoch for all
+        // time intervals.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    explicit TimingWheelEventScheduler(
+                              bsls::SystemClockType::Enum  clockType,
+                              bslma::Allocator            *basicAllocator = 0);
+        // Construct a scheduler having a tick of one millisecond, using the
+        // default dispatcher functor and the specified 'clockType' to
+        // indicate the epoch used for all time intervals.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    TimingWheelEventScheduler(
+                              const bsls::TimeInterval&    tickSize,
+                              bsls::SystemClockType::Enum  clockType,
+                              bslma::Allocator            *basicAllocator = 0);
+        // Construct a scheduler having the specified 'tickSize' truncated to
+        // microseconds, using the default dispatcher functor and the
+        // specified 'clockType' to indicate the epoch used for all time
+        // intervals.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless 'tickSize' is
+        // at least one microsecond.
+
+    TimingWheelEventScheduler(
+                              const Dispatcher&            dispatcherFunctor,
+                              const bsls::TimeInterval&    tickSize,
+                              bsls::SystemClockType::Enum  clockType,
+                              bslma::Allocator            *basicAllocator = 0);
+        // Construct a scheduler having the specified 'tickSize' truncated to
+        // microseconds, using the specified 'dispatcherFunctor' and the
+        // specified 'clockType' to indicate the epoch used for all time
+        // intervals.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless 'tickSize' is
+        // at least one microsecond.
+
+    ~TimingWheelEventScheduler();
+        // Stop the dispatcher thread, discard all unprocessed events, and
+        // destroy this object.  The behavior is undefined if this method is
+        // invoked from the dispatcher thread.
+
+    // MANIPULATORS
+    void cancelAllEvents();
+        // Cancel all recurring and one-time events scheduled in this
+        // scheduler.  Note that an event being dispatched when this method
+        // is invoked completes normally.
+
+    void cancelAllEventsAndWait();
+        // Cancel all recurring and one-time events scheduled in this
+        // scheduler, and block until the event being dispatched, if any,
+        // completes.  The behavior is undefined if this method is invoked
+        // from the dispatcher thread.
+
+    int cancelEvent(Handle handle);
+        // Cancel the event having the specified 'handle'.  Return 0 on
+        // successful cancellation, and a non-zero value if 'handle' is
+        // invalid *or* if the (one-time) event has already been dispatched or
+        // canceled.  Note that canceling a recurring event while it is being
+        // dispatched succeeds and prevents any further occurrence.
+
+    int cancelEventAndWait(Handle handle);
+        // Cancel the event having the specified 'handle', and block until the
+        // event, if it is being dispatched, completes.  Return 0 on
+        // successful cancellation, and a non-zero value if 'handle' is
+        // invalid *or* if the (one-time) event has already been dispatched or
+        // canceled.  The behavior is undefined if this method is invoked from
+        // the dispatcher thread.
+
+    int rescheduleEvent(Handle handle, const bsls::TimeInterval& newEpochTime);
+        // Reschedule the one-time event having the specified 'handle' at the
+        // specified 'newEpochTime' truncated to microseconds.  Return 0 on
+        // success, and a non-zero value if 'handle' is invalid, refers to a
+        // recurring event, *or* if the event is being, or has been,
+        // dispatched.
+
+    Handle scheduleEvent(const bsls::TimeInterval&    epochTime,
+                         const bsl::function<void()>& callback);
+        // Schedule the specified 'callback' to be dispatched at the specified
+        // 'epochTime' truncated to microseconds, and return a handle that can
+        // be used to cancel the event.  The 'epochTime' is an absolute time
+        // represented as an interval from the epoch of the clock indicated at
+        // construction.  Note that 'epochTime' may be in the past, in which
+        // case the event is dispatched as soon as possible.
+
+    Handle scheduleRecurringEvent(
+                               const bsls::TimeInterval&    interval,
+                               const bsl::function<void()>& callback,
+                               const bsls::TimeInterval&    startEpochTime =
+                                                         bsls::TimeInterval());
+        // Schedule a recurring event that invokes the specified 'callback' at
+        // every specified 'interval' truncated to microseconds, with the first
+        // event dispatched at the optionally specified 'startEpochTime'
+        // truncated to microseconds, and return a handle that can be used to
+        // cancel the event.  If 'startEpochTime' is not specified, the first
+        // event is dispatched one 'interval' from now.  The behavior is
+        // undefined unless 'interval' is at least one microsecond.  Note that
+        // if the dispatcher falls behind, the missed occurrences are
+        // dispatched serially.
+
+    int start();
+        // Begin dispatching events on this scheduler using default attributes
+        // for the dispatcher thread.  Return 0 on success, and a nonzero value
+        // otherwise.  If this scheduler is already started, this invocation
+        // has no effect and 0 is returned.
+
+    int start(const bslmt::ThreadAttributes& threadAttributes);
+        // Begin dispatching events on this scheduler using the specified
+        // 'threadAttributes' for the dispatcher thread (except that the
+        // DetachedState attribute is always set to 'CREATE_JOINABLE').
+        // Return 0 on success, and a nonzero value otherwise.  If this
+        // scheduler is already started, this invocation has no effect and 0
+        // is returned.
+
+    void stop();
+        // End the dispatching of events on this scheduler (but do not remove
+        // any pending events), and wait for any (one) currently executing
+        // event to complete.  If the scheduler is already stopped then this
+        // method has no effect.  The behavior is undefined if this method is
+        // invoked from the dispatcher thread.
+
+    // ACCESSORS
+    bsls::SystemClockType::Enum clockType() const;
+        // Return the value of the clock type that this object was created
+        // with.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    bsls::TimeInterval now() const;
+        // Return the current epoch time, an absolute time represented as an
+        // interval from the epoch of the clock indicated at construction.
+
+    int numEvents() const;
+        // Return the number of pending one-time events in this scheduler.
+
+    int numRecurringEvents() const;
+        // Return the number of recurring events registered with this
+        // scheduler.
+
+    bsls::TimeInterval tickSize() const;
+        // Return the tick size of this scheduler.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class TimingWheelEventScheduler
+                      // -------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+void TimingWheelEventScheduler::append(Link *list, Link *link)
+{
+    link->d_next_p           = list;
+    link->d_prev_p           = list->d_prev_p;
+    list->d_prev_p->d_next_p = link;
+    list->d_prev_p           = link;
+}
+
+inline
+void TimingWheelEventScheduler::unlink(Link *link)
+{
+    link->d_prev_p->d_next_p = link->d_next_p;
+    link->d_next_p->d_prev_p = link->d_prev_p;
+    link->d_prev_p           = link;
+    link->d_next_p           = link;
+}
+
+// ACCESSORS
+inline
+bsls::SystemClockType::Enum TimingWheelEventScheduler::clockType() const
+{
+    return d_clockType;
+}
+
+inline
+bslma::Allocator *TimingWheelEventScheduler::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bsls::TimeInterval TimingWheelEventScheduler::tickSize() const
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(d_tickSize);
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
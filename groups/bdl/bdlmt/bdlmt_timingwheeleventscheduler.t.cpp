@@ -0,0 +1,1159 @@
+// bdlmt_timingwheeleventscheduler.t.cpp                              -*-C++-*-
+#include <bdlmt_timingwheeleventscheduler.h>
+
+#include <bdlmt_eventscheduler.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// The component under test is an event scheduler whose events are kept in a
+// hierarchical timing wheel.  We first verify, without starting the
+// dispatcher thread, that events can be scheduled and canceled and that the
+// handles of completed events are invalidated and never reused.  We then
+// verify that events (including events far enough in the future to be
+// cascaded from coarser wheels) are dispatched exactly once and never before
+// their scheduled times, that recurring events recur until canceled
+// (including when canceled by their own callback), that one-time events can
+// be rescheduled, that the '...AndWait' methods wait for a running callback,
+// and that nodes are recycled so that scheduling does not allocate in the
+// steady state.
+//
+// In addition to positive test cases, a negative test case -1 can be run
+// manually to compare the cost of scheduling and canceling timers with
+// 'bdlmt::EventScheduler'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] TimingWheelEventScheduler(bslma::Allocator *);
+// [ 2] TimingWheelEventScheduler(SystemClockType::Enum, Allocator *);
+// [ 2] TimingWheelEventScheduler(const TI&, SystemClockType::Enum, Alloc *);
+// [ 8] TimingWheelEventScheduler(const Dispatcher&, const TI&, Enum, Alloc *);
+// [ 2] ~TimingWheelEventScheduler();
+//
+// MANIPULATORS
+// [ 7] void cancelAllEvents();
+// [ 7] void cancelAllEventsAndWait();
+// [ 2] int cancelEvent(Handle);
+// [ 7] int cancelEventAndWait(Handle);
+// [ 6] int rescheduleEvent(Handle, const bsls::TimeInterval&);
+// [ 2] Handle scheduleEvent(const bsls::TimeInterval&, const function&);
+// [ 5] Handle scheduleRecurringEvent(const TI&, const func&, const TI&);
+// [ 3] int start();
+// [ 3] int start(const bslmt::ThreadAttributes&);
+// [ 3] void stop();
+//
+// ACCESSORS
+// [ 2] bsls::SystemClockType::Enum clockType() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] bsls::TimeInterval now() const;
+// [ 2] int numEvents() const;
+// [ 2] int numRecurringEvents() const;
+// [ 2] bsls::TimeInterval tickSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] TESTING CASCADING
+// [ 8] TESTING ALLOCATION AND DISPATCHER FUNCTOR
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: SCHEDULE AND CANCEL
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::TimingWheelEventScheduler Obj;
+typedef Obj::Handle                      Handle;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void incrementCounter(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+void noop()
+    // Do nothing.
+{
+}
+
+void waitForCount(const bsls::AtomicInt& counter, int count, int maxMs)
+    // Wait until the specified 'counter' reaches the specified 'count', or
+    // until about the specified 'maxMs' milliseconds elapse.
+{
+    for (int i = 0; i < maxMs && counter < count; ++i) {
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+}
+
+                            // ==================
+                            // class TimeRecorder
+                            // ==================
+
+class TimeRecorder {
+    // This class records, for each of a set of events, the time at which the
+    // event was dispatched and the number of times it was dispatched.
+
+    // DATA
+    const Obj                  *d_scheduler_p;
+    bsl::vector<bsls::Types::Int64>
+                                d_dispatchTimes;  // microseconds
+    bsl::vector<int>            d_counts;
+    bsls::AtomicInt             d_numDispatched;
+    bslmt::Mutex                d_mutex;
+
+  public:
+    // CREATORS
+    TimeRecorder(const Obj *scheduler, int numEvents)
+    : d_scheduler_p(scheduler)
+    , d_dispatchTimes(numEvents, 0)
+    , d_counts(numEvents, 0)
+    , d_numDispatched(0)
+    {
+    }
+
+    // MANIPULATORS
+    void record(int index)
+        // Record the dispatch of the event having the specified 'index'.
+    {
+        bsls::Types::Int64 now = d_scheduler_p->now().totalMicroseconds();
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_dispatchTimes[index] = now;
+        ++d_counts[index];
+        ++d_numDispatched;
+    }
+
+    // ACCESSORS
+    int count(int index) const
+    {
+        return d_counts[index];
+    }
+
+    bsls::Types::Int64 dispatchTime(int index) const
+    {
+        return d_dispatchTimes[index];
+    }
+
+    const bsls::AtomicInt& numDispatched() const
+    {
+        return d_numDispatched;
+    }
+};
+
+                        // =========================
+                        // struct SelfCancelingEvent
+                        // =========================
+
+struct SelfCancelingEvent {
+    // This 'struct' provides a recurring callback that cancels its own event
+    // on its third occurrence.
+
+    Obj             *d_scheduler_p;
+    Handle           d_handle;
+    bsls::AtomicInt  d_count;
+    int              d_cancelRc;
+
+    void run()
+    {
+        if (3 == ++d_count) {
+            d_cancelRc = d_scheduler_p->cancelEvent(d_handle);
+        }
+    }
+};
+
+void slowCallback(bsls::AtomicInt *started, bsls::AtomicInt *finished)
+    // Increment the specified 'started', sleep for 100 milliseconds, then
+    // increment the specified 'finished'.
+{
+    ++*started;
+    bslmt::ThreadUtil::microSleep(100 * 1000);
+    ++*finished;
+}
+
+void countingDispatcher(bsls::AtomicInt              *counter,
+                        const bsl::function<void()>&  callback)
+    // Increment the specified 'counter' and invoke the specified 'callback'.
+{
+    ++*counter;
+    callback();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Session Timeouts
+///- - - - - - - - - - - - - -
+// A server closes sessions that have been idle for longer than a timeout.
+// Every message received on a session cancels the pending timeout of the
+// session and schedules a new one, so that nearly every timeout is canceled
+// before it expires.
+//
+// First, we define a session, holding the handle of its pending timeout:
+//..
+    struct Session {
+        bdlmt::TimingWheelEventScheduler::Handle d_timeout;
+        bsls::AtomicBool                         d_closed;
+    };
+
+    void closeSession(Session *session)
+        // Close the specified 'session'.
+    {
+        session->d_closed = true;
+    }
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we create a scheduler having a tick of 10 milliseconds, based on the
+// monotonic clock, and start it:
+//..
+    bdlmt::TimingWheelEventScheduler scheduler(
+                                       bsls::TimeInterval(0, 10 * 1000 * 1000),
+                                       bsls::SystemClockType::e_MONOTONIC);
+    scheduler.start();
+//..
+// Next, we schedule the initial timeout of a session, one second from now:
+//..
+    const bsls::TimeInterval timeout(1.0);
+
+    Session session;
+    session.d_closed  = false;
+    session.d_timeout = scheduler.scheduleEvent(
+                               scheduler.now() + timeout,
+                               bdlf::BindUtil::bind(&closeSession, &session));
+//..
+// Then, each time a message arrives, we push the timeout back by canceling
+// the pending event and scheduling a new one (in a real server,
+// 'rescheduleEvent' could be used instead):
+//..
+    for (int i = 0; i < 1000; ++i) {
+        int rc = scheduler.cancelEvent(session.d_timeout);
+        ASSERT(0 == rc);
+
+        session.d_timeout = scheduler.scheduleEvent(
+                               scheduler.now() + timeout,
+                               bdlf::BindUtil::bind(&closeSession, &session));
+    }
+    ASSERT(!session.d_closed);
+    ASSERT(1 == scheduler.numEvents());
+//..
+// Finally, once messages stop arriving, the session is closed after the
+// timeout expires:
+//..
+    while (!session.d_closed) {
+        bslmt::ThreadUtil::microSleep(10 * 1000);
+    }
+    ASSERT(0 == scheduler.numEvents());
+
+    scheduler.stop();
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING ALLOCATION AND DISPATCHER FUNCTOR
+        //
+        // Concerns:
+        //: 1 All memory is supplied by the object allocator and is released
+        //:   on destruction, including the memory of undispatched events.
+        //:
+        //: 2 Once an event has been canceled, scheduling another event with
+        //:   a callback that does not allocate does not allocate memory.
+        //:
+        //: 3 Callbacks are invoked through the dispatcher functor supplied at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Schedule and cancel an event, then schedule and cancel many more
+        //:   and verify that the number of allocations is unchanged.  (C-2)
+        //:
+        //: 2 Supply a dispatcher functor counting its invocations, dispatch
+        //:   events, and verify the count.  (C-3)
+        //:
+        //: 3 Destroy the scheduler with events pending and verify that no
+        //:   memory remains in use.  (C-1)
+        //
+        // Testing:
+        //   TimingWheelEventScheduler(const Dispatcher&, const TI&, Enum, A*);
+        //   TESTING ALLOCATION AND DISPATCHER FUNCTOR
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ALLOCATION AND DISPATCHER FUNCTOR"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            bsls::AtomicInt numDispatched(0);
+            bsls::AtomicInt counter(0);
+
+            Obj mX(bdlf::BindUtil::bind(&countingDispatcher,
+                                        &numDispatched,
+                                        bdlf::PlaceHolders::_1),
+                   bsls::TimeInterval(0, 1000 * 1000),
+                   bsls::SystemClockType::e_MONOTONIC,
+                   &ta);
+            ASSERT(&ta == mX.allocator());
+
+            const bsls::TimeInterval far = mX.now() + bsls::TimeInterval(60);
+
+            Handle h = mX.scheduleEvent(far, &noop);
+            ASSERT(0 == mX.cancelEvent(h));
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            for (int i = 0; i < 1000; ++i) {
+                h = mX.scheduleEvent(far + bsls::TimeInterval(0, i * 1000),
+                                     &noop);
+                ASSERT(0 == mX.cancelEvent(h));
+            }
+            ASSERTV(numAllocations, ta.numAllocations(),
+                    numAllocations == ta.numAllocations());
+
+            ASSERT(0 == mX.start());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.scheduleEvent(mX.now(),
+                                 bdlf::BindUtil::bind(&incrementCounter,
+                                                      &counter));
+            }
+            waitForCount(counter, 10, 5000);
+            ASSERTV(counter, 10 == counter);
+            ASSERTV(numDispatched, 10 == numDispatched);
+
+            for (int i = 0; i < 10; ++i) {
+                mX.scheduleEvent(far, &noop);
+            }
+            ASSERT(10 == mX.numEvents());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING CANCEL AND WAIT
+        //
+        // Concerns:
+        //: 1 'cancelEventAndWait' returns only once the callback of the event,
+        //:   if running, has completed, and fails for a running one-time
+        //:   event.
+        //:
+        //: 2 'cancelAllEvents' cancels every pending event.
+        //:
+        //: 3 'cancelAllEventsAndWait' additionally waits for the running
+        //:   callback, if any, to complete.
+        //
+        // Plan:
+        //: 1 Schedule an event with a slow callback, wait for it to start,
+        //:   then invoke 'cancelEventAndWait' and verify the return value and
+        //:   that the callback has completed.  (C-1)
+        //:
+        //: 2 Schedule many events, invoke 'cancelAllEvents', and verify that
+        //:   no event remains and none is dispatched.  (C-2)
+        //:
+        //: 3 Repeat P-1 with a recurring event and 'cancelAllEventsAndWait'.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void cancelAllEvents();
+        //   void cancelAllEventsAndWait();
+        //   int cancelEventAndWait(Handle);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CANCEL AND WAIT" << endl
+                          << "=======================" << endl;
+
+        Obj mX(bsls::SystemClockType::e_MONOTONIC);
+        ASSERT(0 == mX.start());
+
+        {
+            bsls::AtomicInt started(0), finished(0);
+
+            Handle h = mX.scheduleEvent(
+                                 mX.now(),
+                                 bdlf::BindUtil::bind(&slowCallback,
+                                                      &started,
+                                                      &finished));
+            waitForCount(started, 1, 5000);
+            ASSERT(1 == started);
+
+            ASSERT(0 != mX.cancelEventAndWait(h));
+            ASSERT(1 == finished);
+            ASSERT(0 != mX.cancelEvent(h));
+        }
+
+        {
+            bsls::AtomicInt counter(0);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.scheduleEvent(mX.now() + bsls::TimeInterval(0.05 + i / 1e3),
+                                 bdlf::BindUtil::bind(&incrementCounter,
+                                                      &counter));
+            }
+            mX.scheduleRecurringEvent(bsls::TimeInterval(0.05),
+                                      bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter));
+            ASSERT(100 == mX.numEvents());
+            ASSERT(  1 == mX.numRecurringEvents());
+
+            mX.cancelAllEvents();
+            ASSERT(0 == mX.numEvents());
+            ASSERT(0 == mX.numRecurringEvents());
+
+            bslmt::ThreadUtil::microSleep(300 * 1000);
+            ASSERTV(counter, 0 == counter);
+        }
+
+        {
+            bsls::AtomicInt started(0), finished(0);
+
+            mX.scheduleRecurringEvent(bsls::TimeInterval(0.001),
+                                      bdlf::BindUtil::bind(&slowCallback,
+                                                           &started,
+                                                           &finished));
+            waitForCount(started, 1, 5000);
+
+            mX.cancelAllEventsAndWait();
+            ASSERT(started == finished);
+            ASSERT(0 == mX.numRecurringEvents());
+
+            const int count = finished;
+            bslmt::ThreadUtil::microSleep(200 * 1000);
+            ASSERT(count == started);
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'rescheduleEvent'
+        //
+        // Concerns:
+        //: 1 A pending one-time event can be moved earlier or later.
+        //:
+        //: 2 Rescheduling fails for recurring events, for dispatched events,
+        //:   and for invalid handles.
+        //
+        // Plan:
+        //: 1 Schedule an event far in the future, reschedule it to the near
+        //:   future, and verify that it is dispatched, not before its new
+        //:   time.  Schedule an event in the near future, reschedule it far,
+        //:   and verify that it is not dispatched.  (C-1)
+        //:
+        //: 2 Attempt to reschedule the dispatched event, a recurring event,
+        //:   and 'e_INVALID_HANDLE'.  (C-2)
+        //
+        // Testing:
+        //   int rescheduleEvent(Handle, const bsls::TimeInterval&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'rescheduleEvent'" << endl
+                          << "=========================" << endl;
+
+        Obj mX(bsls::SystemClockType::e_MONOTONIC);
+        ASSERT(0 == mX.start());
+
+        TimeRecorder recorder(&mX, 2);
+
+        Handle h0 = mX.scheduleEvent(
+                        mX.now() + bsls::TimeInterval(100),
+                        bdlf::BindUtil::bind(&TimeRecorder::record,
+                                             &recorder,
+                                             0));
+        Handle h1 = mX.scheduleEvent(
+                        mX.now() + bsls::TimeInterval(0.05),
+                        bdlf::BindUtil::bind(&TimeRecorder::record,
+                                             &recorder,
+                                             1));
+
+        const bsls::TimeInterval newTime = mX.now() + bsls::TimeInterval(0.02);
+
+        ASSERT(0 == mX.rescheduleEvent(h0, newTime));
+        ASSERT(0 == mX.rescheduleEvent(h1,
+                                       mX.now() + bsls::TimeInterval(100)));
+
+        bslmt::ThreadUtil::microSleep(300 * 1000);
+
+        ASSERT(1 == recorder.count(0));
+        ASSERT(0 == recorder.count(1));
+        ASSERTV(recorder.dispatchTime(0), newTime.totalMicroseconds(),
+                recorder.dispatchTime(0) >= newTime.totalMicroseconds());
+
+        ASSERT(0 != mX.rescheduleEvent(h0, mX.now()));
+        ASSERT(0 == mX.cancelEvent(h1));
+
+        Handle hr = mX.scheduleRecurringEvent(bsls::TimeInterval(100),
+                                              &noop);
+        ASSERT(0 != mX.rescheduleEvent(hr, mX.now()));
+        ASSERT(0 != mX.rescheduleEvent(Obj::e_INVALID_HANDLE, mX.now()));
+        ASSERT(0 == mX.cancelEvent(hr));
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING RECURRING EVENTS
+        //
+        // Concerns:
+        //: 1 A recurring event is dispatched repeatedly until canceled.
+        //:
+        //: 2 A recurring event can be canceled by its own callback, and is
+        //:   then not dispatched again.
+        //:
+        //: 3 'numRecurringEvents' reflects the recurring events.
+        //
+        // Plan:
+        //: 1 Schedule a recurring event every 10 milliseconds, wait for a few
+        //:   occurrences, cancel it, and verify that it no longer recurs.
+        //:   (C-1,3)
+        //:
+        //: 2 Schedule a recurring event canceling itself on its third
+        //:   occurrence, and verify the number of occurrences.  (C-2..3)
+        //
+        // Testing:
+        //   Handle scheduleRecurringEvent(const TI&, const func&, const TI&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING RECURRING EVENTS" << endl
+                          << "========================" << endl;
+
+        Obj mX(bsls::SystemClockType::e_MONOTONIC);
+        ASSERT(0 == mX.start());
+
+        {
+            bsls::AtomicInt counter(0);
+
+            Handle h = mX.scheduleRecurringEvent(
+                                    bsls::TimeInterval(0.01),
+                                    bdlf::BindUtil::bind(&incrementCounter,
+                                                         &counter));
+            ASSERT(1 == mX.numRecurringEvents());
+            ASSERT(0 == mX.numEvents());
+
+            waitForCount(counter, 5, 5000);
+            ASSERTV(counter, 5 <= counter);
+
+            ASSERT(0 == mX.cancelEventAndWait(h));
+            ASSERT(0 == mX.numRecurringEvents());
+
+            const int count = counter;
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+            ASSERTV(count, counter, count == counter);
+
+            ASSERT(0 != mX.cancelEvent(h));
+        }
+
+        {
+            SelfCancelingEvent event;
+            event.d_scheduler_p = &mX;
+            event.d_count       = 0;
+            event.d_cancelRc    = -1;
+
+            // The dispatcher cannot run the callback before 'd_handle' is set
+            // since the first occurrence is at least 5 milliseconds away.
+
+            event.d_handle = mX.scheduleRecurringEvent(
+                                    bsls::TimeInterval(0.005),
+                                    bdlf::BindUtil::bind(
+                                                      &SelfCancelingEvent::run,
+                                                      &event),
+                                    mX.now() + bsls::TimeInterval(0.005));
+
+            waitForCount(event.d_count, 3, 5000);
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+
+            ASSERTV(event.d_count, 3 == event.d_count);
+            ASSERTV(event.d_cancelRc, 0 == event.d_cancelRc);
+            ASSERT(0 == mX.numRecurringEvents());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING CASCADING
+        //
+        // Concerns:
+        //: 1 Events due more than 256 ticks in the future (held in coarser
+        //:   wheels) are dispatched exactly once, and not before their
+        //:   scheduled times.
+        //:
+        //: 2 Events scheduled in the past are dispatched promptly.
+        //
+        // Plan:
+        //: 1 Using a tick of 100 microseconds, schedule events spread between
+        //:   0 and 300 milliseconds (i.e., up to 3000 ticks), in a shuffled
+        //:   order, plus events in the past, and verify the dispatch times
+        //:   and counts.  (C-1..2)
+        //
+        // Testing:
+        //   TESTING CASCADING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CASCADING" << endl
+                          << "=================" << endl;
+
+        enum { k_NUM_EVENTS = 300, k_NUM_PAST = 10 };
+
+        Obj mX(bsls::TimeInterval(0, 100 * 1000),
+               bsls::SystemClockType::e_MONOTONIC);
+        ASSERT(bsls::TimeInterval(0, 100 * 1000) == mX.tickSize());
+
+        TimeRecorder recorder(&mX, k_NUM_EVENTS + k_NUM_PAST);
+
+        bsl::vector<bsls::Types::Int64> times(k_NUM_EVENTS + k_NUM_PAST);
+
+        const bsls::TimeInterval base = mX.now();
+
+        ASSERT(0 == mX.start());
+
+        for (int i = 0; i < k_NUM_EVENTS; ++i) {
+            const int j = (i * 7919) % k_NUM_EVENTS;  // shuffle
+
+            const bsls::TimeInterval t = base +
+                                        bsls::TimeInterval(0, j * 1000 * 1000);
+
+            times[j] = t.totalMicroseconds();
+            mX.scheduleEvent(t,
+                             bdlf::BindUtil::bind(&TimeRecorder::record,
+                                                  &recorder,
+                                                  j));
+        }
+        for (int i = 0; i < k_NUM_PAST; ++i) {
+            const int j = k_NUM_EVENTS + i;
+
+            const bsls::TimeInterval t = base -
+                                   bsls::TimeInterval(0, i * 10 * 1000 * 1000);
+
+            times[j] = t.totalMicroseconds();
+            mX.scheduleEvent(t,
+                             bdlf::BindUtil::bind(&TimeRecorder::record,
+                                                  &recorder,
+                                                  j));
+        }
+
+        waitForCount(recorder.numDispatched(),
+                     k_NUM_EVENTS + k_NUM_PAST,
+                     10 * 1000);
+        bslmt::ThreadUtil::microSleep(50 * 1000);
+
+        ASSERTV(recorder.numDispatched(),
+                k_NUM_EVENTS + k_NUM_PAST == recorder.numDispatched());
+        ASSERT(0 == mX.numEvents());
+
+        for (int j = 0; j < k_NUM_EVENTS + k_NUM_PAST; ++j) {
+            ASSERTV(j, recorder.count(j), 1 == recorder.count(j));
+            ASSERTV(j, times[j], recorder.dispatchTime(j),
+                    times[j] <= recorder.dispatchTime(j));
+            if (veryVerbose) {
+                P_(j) P(recorder.dispatchTime(j) - times[j]);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING DISPATCH
+        //
+        // Concerns:
+        //: 1 Once started, the scheduler dispatches each one-time event
+        //:   exactly once, not before its scheduled time.
+        //:
+        //: 2 'stop' stops dispatching without discarding events, and 'start'
+        //:   resumes it.
+        //:
+        //: 3 Events scheduled while the dispatcher sleeps until a later event
+        //:   wake the dispatcher.
+        //
+        // Plan:
+        //: 1 Schedule an event one second in the future, then schedule
+        //:   events in the near future and verify that they are dispatched
+        //:   on time.  (C-1,3)
+        //:
+        //: 2 Stop the scheduler, schedule an event in the past, verify that
+        //:   it is not dispatched, restart the scheduler and verify that it
+        //:   is.  (C-2)
+        //
+        // Testing:
+        //   int start();
+        //   int start(const bslmt::ThreadAttributes&);
+        //   void stop();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DISPATCH" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_EVENTS = 20 };
+
+        Obj mX(bsls::SystemClockType::e_MONOTONIC);
+
+        bslmt::ThreadAttributes attributes;
+        ASSERT(0 == mX.start(attributes));
+        ASSERT(0 == mX.start());
+
+        TimeRecorder recorder(&mX, k_NUM_EVENTS + 1);
+
+        mX.scheduleEvent(mX.now() + bsls::TimeInterval(1.0),
+                         bdlf::BindUtil::bind(&TimeRecorder::record,
+                                              &recorder,
+                                              k_NUM_EVENTS));
+
+        bslmt::ThreadUtil::microSleep(20 * 1000);
+
+        bsl::vector<bsls::Types::Int64> times(k_NUM_EVENTS);
+
+        for (int i = 0; i < k_NUM_EVENTS; ++i) {
+            const bsls::TimeInterval t = mX.now() +
+                                        bsls::TimeInterval(0, i * 1000 * 1000);
+
+            times[i] = t.totalMicroseconds();
+            mX.scheduleEvent(t,
+                             bdlf::BindUtil::bind(&TimeRecorder::record,
+                                                  &recorder,
+                                                  i));
+        }
+
+        waitForCount(recorder.numDispatched(), k_NUM_EVENTS, 5000);
+
+        // The one-second event should still be pending, so the others were
+        // dispatched before it.
+
+        ASSERTV(recorder.numDispatched(),
+                k_NUM_EVENTS == recorder.numDispatched());
+        ASSERT(1 == mX.numEvents());
+
+        for (int i = 0; i < k_NUM_EVENTS; ++i) {
+            ASSERTV(i, 1 == recorder.count(i));
+            ASSERTV(i, times[i], recorder.dispatchTime(i),
+                    times[i] <= recorder.dispatchTime(i));
+        }
+
+        mX.stop();
+        mX.stop();
+
+        bsls::AtomicInt counter(0);
+        mX.scheduleEvent(mX.now() - bsls::TimeInterval(1.0),
+                         bdlf::BindUtil::bind(&incrementCounter, &counter));
+        bslmt::ThreadUtil::microSleep(50 * 1000);
+        ASSERT(0 == counter);
+        ASSERT(2 == mX.numEvents());
+
+        ASSERT(0 == mX.start());
+        waitForCount(counter, 1, 5000);
+        ASSERT(1 == counter);
+
+        waitForCount(recorder.numDispatched(), k_NUM_EVENTS + 1, 5000);
+        ASSERT(1 == recorder.count(k_NUM_EVENTS));
+        ASSERT(0 == mX.numEvents());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING SCHEDULE AND CANCEL
+        //
+        // Concerns:
+        //: 1 The constructors set the clock type, tick size, and allocator.
+        //:
+        //: 2 'scheduleEvent' returns a valid handle, and the event counts
+        //:   reflect the scheduled events.
+        //:
+        //: 3 'cancelEvent' succeeds exactly once per event, and fails for
+        //:   invalid handles.
+        //:
+        //: 4 The handle of a canceled event is not valid for an event
+        //:   subsequently scheduled in its place.
+        //
+        // Plan:
+        //: 1 Create schedulers with each constructor and verify the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Without starting the scheduler, schedule events at varied times,
+        //:   cancel them, and verify the return values and counts.  Schedule
+        //:   a new event after a cancellation and verify that the canceled
+        //:   handle does not cancel it.  (C-2..4)
+        //
+        // Testing:
+        //   TimingWheelEventScheduler(bslma::Allocator *);
+        //   TimingWheelEventScheduler(SystemClockType::Enum, Allocator *);
+        //   TimingWheelEventScheduler(const TI&, SystemClockType::Enum, A*);
+        //   ~TimingWheelEventScheduler();
+        //   int cancelEvent(Handle);
+        //   Handle scheduleEvent(const bsls::TimeInterval&, const function&);
+        //   bsls::SystemClockType::Enum clockType() const;
+        //   bslma::Allocator *allocator() const;
+        //   bsls::TimeInterval now() const;
+        //   int numEvents() const;
+        //   int numRecurringEvents() const;
+        //   bsls::TimeInterval tickSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SCHEDULE AND CANCEL" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(bsls::SystemClockType::e_REALTIME == X.clockType());
+            ASSERT(bsls::TimeInterval(0, 1000 * 1000) == X.tickSize());
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.numEvents());
+            ASSERT(0 == X.numRecurringEvents());
+        }
+        {
+            Obj mX(bsls::SystemClockType::e_MONOTONIC, &ta);
+            const Obj& X = mX;
+            ASSERT(bsls::SystemClockType::e_MONOTONIC == X.clockType());
+            ASSERT(bsls::TimeInterval(0, 1000 * 1000) == X.tickSize());
+            ASSERT(&ta == X.allocator());
+        }
+        {
+            Obj mX(bsls::TimeInterval(0, 5000),
+                   bsls::SystemClockType::e_MONOTONIC);  const Obj& X = mX;
+            ASSERT(bsls::TimeInterval(0, 5000) == X.tickSize());
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+
+        enum { k_NUM_EVENTS = 1000 };
+
+        Obj mX(bsls::SystemClockType::e_MONOTONIC, &ta);  const Obj& X = mX;
+
+        const bsls::TimeInterval base = X.now();
+
+        bsl::vector<Handle> handles;
+        for (int i = 0; i < k_NUM_EVENTS; ++i) {
+            // Spread the events from the past to about 11 days ahead so that
+            // every wheel is used.
+
+            bsls::Types::Int64 offset = (i % 2 ? 1 : -1) *
+                                        static_cast<bsls::Types::Int64>(i) *
+                                        i * i * 1000;
+
+            bsls::TimeInterval t = base;
+            t.addMicroseconds(offset);
+
+            handles.push_back(mX.scheduleEvent(t, &noop));
+            ASSERT(0 <= handles.back());
+            ASSERT(i + 1 == X.numEvents());
+        }
+        ASSERT(0 == X.numRecurringEvents());
+
+        for (int i = 0; i < k_NUM_EVENTS; i += 2) {
+            ASSERTV(i, 0 == mX.cancelEvent(handles[i]));
+            ASSERTV(i, 0 != mX.cancelEvent(handles[i]));
+        }
+        ASSERT(k_NUM_EVENTS / 2 == X.numEvents());
+
+        Handle h = mX.scheduleEvent(base, &noop);
+        for (int i = 0; i < k_NUM_EVENTS; i += 2) {
+            ASSERTV(i, h != handles[i]);
+        }
+        ASSERT(0 != mX.cancelEvent(handles[0]));
+        ASSERT(k_NUM_EVENTS / 2 + 1 == X.numEvents());
+        ASSERT(0 == mX.cancelEvent(h));
+
+        for (int i = 1; i < k_NUM_EVENTS; i += 2) {
+            ASSERTV(i, 0 == mX.cancelEvent(handles[i]));
+        }
+        ASSERT(0 == X.numEvents());
+
+        ASSERT(0 != mX.cancelEvent(Obj::e_INVALID_HANDLE));
+        ASSERT(0 != mX.cancelEvent(12345678));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a scheduler, schedule a one-time and a recurring event,
+        //:   wait for them to be dispatched, and stop the scheduler.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsls::AtomicInt once(0), recurring(0);
+
+        Obj mX;
+        ASSERT(0 == mX.start());
+
+        mX.scheduleEvent(mX.now() + bsls::TimeInterval(0.01),
+                         bdlf::BindUtil::bind(&incrementCounter, &once));
+        Handle h = mX.scheduleRecurringEvent(
+                          bsls::TimeInterval(0.005),
+                          bdlf::BindUtil::bind(&incrementCounter, &recurring));
+
+        waitForCount(once, 1, 5000);
+        waitForCount(recurring, 3, 5000);
+        ASSERT(1 == once);
+        ASSERT(3 <= recurring);
+
+        ASSERT(0 == mX.cancelEventAndWait(h));
+        mX.stop();
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SCHEDULE AND CANCEL
+        //
+        // Concerns:
+        //: 1 Scheduling and canceling timers that never expire (e.g., request
+        //:   timeouts) is cheaper with this component than with
+        //:   'bdlmt::EventScheduler', and does not degrade with the number of
+        //:   pending timers.
+        //
+        // Plan:
+        //: 1 For each of several numbers of pending timers, schedule that
+        //:   many timers at random times within the next hour, then measure
+        //:   the time to repeatedly cancel one timer and schedule a
+        //:   replacement, in both schedulers.
+        //
+        // Testing:
+        //   PERFORMANCE: SCHEDULE AND CANCEL
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: SCHEDULE AND CANCEL" << endl
+                          << "================================" << endl;
+
+        const int k_NUM_PENDING[] = { 1000, 10000, 100000 };
+        const int k_NUM_OPS       = 1000000;
+
+        for (int p = 0; p < 3; ++p) {
+            const int numPending = k_NUM_PENDING[p];
+
+            double esTime, twTime;
+
+            {
+                bdlmt::EventScheduler mX(bsls::SystemClockType::e_MONOTONIC);
+                ASSERT(0 == mX.start());
+
+                bsl::vector<bdlmt::EventScheduler::EventHandle> handles(
+                                                                   numPending);
+
+                const bsls::TimeInterval base = mX.now();
+                unsigned int             seed = 1;
+
+                for (int i = 0; i < numPending; ++i) {
+                    seed = seed * 1103515245 + 12345;
+                    mX.scheduleEvent(&handles[i],
+                                     base + bsls::TimeInterval(
+                                                       60 + (seed >> 20), 0),
+                                     &noop);
+                }
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < k_NUM_OPS; ++i) {
+                    const int j = i % numPending;
+
+                    seed = seed * 1103515245 + 12345;
+                    mX.cancelEvent(&handles[j]);
+                    mX.scheduleEvent(&handles[j],
+                                     base + bsls::TimeInterval(
+                                                       60 + (seed >> 20), 0),
+                                     &noop);
+                }
+                timer.stop();
+                esTime = timer.elapsedTime();
+
+                mX.cancelAllEvents();
+                mX.stop();
+            }
+
+            {
+                Obj mX(bsls::SystemClockType::e_MONOTONIC);
+                ASSERT(0 == mX.start());
+
+                bsl::vector<Handle> handles(numPending);
+
+                const bsls::TimeInterval base = mX.now();
+                unsigned int             seed = 1;
+
+                for (int i = 0; i < numPending; ++i) {
+                    seed = seed * 1103515245 + 12345;
+                    handles[i] = mX.scheduleEvent(
+                                           base + bsls::TimeInterval(
+                                                       60 + (seed >> 20), 0),
+                                           &noop);
+                }
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < k_NUM_OPS; ++i) {
+                    const int j = i % numPending;
+
+                    seed = seed * 1103515245 + 12345;
+                    mX.cancelEvent(handles[j]);
+                    handles[j] = mX.scheduleEvent(
+                                           base + bsls::TimeInterval(
+                                                       60 + (seed >> 20), 0),
+                                           &noop);
+                }
+                timer.stop();
+                twTime = timer.elapsedTime();
+
+                mX.stop();
+            }
+
+            cout << "pending timers: " << numPending
+                 << "\n\tEventScheduler:            "
+                 << esTime * 1e9 / k_NUM_OPS << " ns/op"
+                 << "\n\tTimingWheelEventScheduler: "
+                 << twTime * 1e9 / k_NUM_OPS << " ns/op" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,536 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstddef.h>
+
+// IMPLEMENTATION NOTES: Two counters track the jobs of the pool:
+// 'd_numPendingJobs' counts the jobs held in a deque or inbox, and
+// 'd_numOutstandingJobs' counts the jobs that have been enqueued but not yet
+// completed.  Both are incremented *before* the job is published, so that
+// neither ever becomes negative, and so that 'drain' can not observe a zero
+// 'd_numOutstandingJobs' while a job that enqueues sub-jobs is running (the
+// sub-jobs are counted before their parent completes).
+//
+// An idle thread increments 'd_numThreadsWaiting' and then reads
+// 'd_numPendingJobs', while 'submit' increments 'd_numPendingJobs' and then
+// reads 'd_numThreadsWaiting'.  Since all four operations are sequentially
+// consistent, either the idle thread observes the new job (and does not
+// block), or 'submit' observes the waiting thread (and posts
+// 'd_workSemaphore').
+
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i=0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                     // ----------------------------------
+                     // class WorkStealingThreadPool_Deque
+                     // ----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Deque::WorkStealingThreadPool_Deque(
+                                              int               capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_topPad()
+, d_bottom(0)
+, d_bottomPad()
+, d_slots_p(0)
+, d_mask(0)
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT(1 <= capacity);
+    BSLS_ASSERT(basicAllocator);
+
+    bsls::Types::Int64 size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    d_mask = size - 1;
+
+    d_slots_p = static_cast<Slot *>(
+              d_allocator_p->allocate(static_cast<bsl::size_t>(size) *
+                                      sizeof(Slot)));
+
+    for (bsls::Types::Int64 i = 0; i < size; ++i) {
+        bsls::AtomicOperations::initPointer(&d_slots_p[i], 0);
+    }
+}
+
+WorkStealingThreadPool_Deque::~WorkStealingThreadPool_Deque()
+{
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+                     // -----------------------------------
+                     // struct WorkStealingThreadPool_Worker
+                     // -----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Worker::WorkStealingThreadPool_Worker(
+                                         int               index,
+                                         int               dequeCapacity,
+                                         bslma::Allocator *basicAllocator)
+: d_deque(dequeCapacity, basicAllocator)
+, d_inboxMutex()
+, d_inbox(basicAllocator)
+, d_inboxSize(0)
+, d_randomState(static_cast<unsigned int>(index) * 2654435761u + 1)
+, d_index(index)
+{
+}
+
+// MANIPULATORS
+WorkStealingThreadPool_Worker::Job *WorkStealingThreadPool_Worker::popInbox()
+{
+    if (0 == d_inboxSize.loadRelaxed()) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_inboxMutex);
+
+    if (d_inbox.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_inbox.front();
+    d_inbox.pop_front();
+    d_inboxSize.storeRelaxed(static_cast<int>(d_inbox.size()));
+
+    return job;
+}
+
+void WorkStealingThreadPool_Worker::pushInbox(Job *job)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_inboxMutex);
+
+    d_inbox.push_back(job);
+    d_inboxSize.storeRelaxed(static_cast<int>(d_inbox.size()));
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool::Job *WorkStealingThreadPool::createJob(
+                                                            const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    return new (d_jobPool.allocate()) Job(bsl::allocator_arg,
+                                          d_allocator_p,
+                                          functor);
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::createJob(
+                                               bslmf::MovableRef<Job> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    return new (d_jobPool.allocate()) Job(
+                                         bsl::allocator_arg,
+                                         d_allocator_p,
+                                         bslmf::MovableRefUtil::move(functor));
+}
+
+void WorkStealingThreadPool::destroyJob(Job *job)
+{
+    job->~Job();
+    d_jobPool.deallocate(job);
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::findJob(Worker *worker)
+{
+    Job *job = static_cast<Job *>(worker->d_deque.popBottom());
+
+    if (!job) {
+        job = worker->popInbox();
+    }
+
+    if (!job) {
+        const unsigned int numWorkers =
+                                   static_cast<unsigned int>(d_workers.size());
+        const unsigned int start      = worker->nextRandom() % numWorkers;
+
+        for (unsigned int i = 0; i < numWorkers && !job; ++i) {
+            Worker *victim = d_workers[(start + i) % numWorkers];
+
+            if (victim == worker) {
+                continue;
+            }
+
+            job = static_cast<Job *>(victim->d_deque.steal());
+
+            if (!job) {
+                job = victim->popInbox();
+            }
+        }
+    }
+
+    if (job) {
+        --d_numPendingJobs;
+    }
+
+    return job;
+}
+
+void WorkStealingThreadPool::initialize(int dequeCapacity)
+{
+    BSLS_ASSERT_OPT(1 <= d_numThreads);
+    BSLS_ASSERT_OPT(1 <= dequeCapacity);
+
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+
+    d_workers.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(i,
+                                                        dequeCapacity,
+                                                        d_allocator_p));
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+void WorkStealingThreadPool::removeAll()
+{
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        Worker *worker = d_workers[i];
+
+        while (Job *job = static_cast<Job *>(worker->d_deque.popBottom())) {
+            destroyJob(job);
+        }
+        while (Job *job = worker->popInbox()) {
+            destroyJob(job);
+        }
+    }
+
+    d_numPendingJobs     = 0;
+    d_numOutstandingJobs = 0;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_drainMutex);
+    d_drainCondition.broadcast();
+}
+
+int WorkStealingThreadPool::submit(Job *job)
+{
+    Worker *worker = static_cast<Worker *>(
+                                bslmt::ThreadUtil::getSpecific(d_workerKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                           worker ? e_RUN != d_control.loadRelaxed()
+                                  : !d_enabled.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        destroyJob(job);
+        return 1;                                                     // RETURN
+    }
+
+    ++d_numOutstandingJobs;
+    ++d_numPendingJobs;
+
+    if (worker) {
+        if (0 != worker->d_deque.pushBottom(job)) {
+            worker->pushInbox(job);
+        }
+    }
+    else {
+        const unsigned int index = d_nextInbox.addRelaxed(1) %
+                                   static_cast<unsigned int>(d_workers.size());
+        d_workers[index]->pushInbox(job);
+    }
+
+    if (0 < d_numThreadsWaiting) {
+        d_workSemaphore.post();
+    }
+
+    return 0;
+}
+
+void WorkStealingThreadPool::wakeAll()
+{
+    d_workSemaphore.post(d_numThreads);
+}
+
+void WorkStealingThreadPool::waitForOutstandingJobs()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_drainMutex);
+
+    while (0 != d_numOutstandingJobs) {
+        d_drainCondition.wait(&d_drainMutex);
+    }
+}
+
+void WorkStealingThreadPool::workerThread(int index)
+{
+    Worker *worker = d_workers[index];
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, worker);
+
+    while (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(e_RUN == d_control)) {
+        Job *job = findJob(worker);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(job)) {
+            (*job)();
+            destroyJob(job);
+
+            if (0 == --d_numOutstandingJobs) {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_drainMutex);
+                d_drainCondition.broadcast();
+            }
+            continue;
+        }
+
+        ++d_numThreadsWaiting;
+
+        if (e_RUN == d_control && 0 == d_numPendingJobs) {
+            d_workSemaphore.wait();
+        }
+        else {
+            // A job is pending but could not be taken (e.g., it is being
+            // published, or a steal lost a race): let its owner proceed.
+
+            bslmt::ThreadUtil::yield();
+        }
+
+        --d_numThreadsWaiting;
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, 0);
+}
+
+int WorkStealingThreadPool::startNewThread(int index)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    bsl::function<void()> workerThreadFunc = bdlf::BindUtil::bind(
+                                         &WorkStealingThreadPool::workerThread,
+                                         this,
+                                         index);
+
+    int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_workers(basicAllocator)
+, d_nextInbox(0)
+, d_enabled(false)
+, d_control(e_STOP)
+, d_numPendingJobs(0)
+, d_numOutstandingJobs(0)
+, d_numThreadsWaiting(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(k_DEFAULT_DEQUE_CAPACITY);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              int               dequeCapacity,
+                                              bslma::Allocator *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_workers(basicAllocator)
+, d_nextInbox(0)
+, d_enabled(false)
+, d_control(e_STOP)
+, d_numPendingJobs(0)
+, d_numOutstandingJobs(0)
+, d_numThreadsWaiting(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(dequeCapacity);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             int                             dequeCapacity,
+                             bslma::Allocator               *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_workers(basicAllocator)
+, d_nextInbox(0)
+, d_enabled(false)
+, d_control(e_STOP)
+, d_numPendingJobs(0)
+, d_numOutstandingJobs(0)
+, d_numThreadsWaiting(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(dequeCapacity);
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    // Jobs enqueued while the pool was not started are discarded here.
+
+    removeAll();
+
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        d_allocator_p->deleteObjectRaw(d_workers[i]);
+    }
+
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool::enqueueJob(
+                                       WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return submit(createJob(bdlf::BindUtil::bindR<void>(function, userData)));
+}
+
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_RUN == d_control.loadRelaxed()) {
+        waitForOutstandingJobs();
+    }
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_RUN == d_control.loadRelaxed()) {
+        d_control = e_STOP;
+        d_enabled = false;
+
+        wakeAll();
+        d_threadGroup.joinAll();
+
+        removeAll();
+    }
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_STOP != d_control.loadRelaxed()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_control = e_RUN;
+
+    for (int i = d_threadGroup.numThreads(); i < d_numThreads; ++i) {
+        if (0 != startNewThread(i)) {
+            d_control = e_STOP;
+
+            wakeAll();
+            d_threadGroup.joinAll();
+            return -1;                                                // RETURN
+        }
+    }
+
+    d_enabled = true;
+
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_RUN == d_control.loadRelaxed()) {
+        d_enabled = false;
+
+        waitForOutstandingJobs();
+
+        d_control = e_STOP;
+
+        wakeAll();
+        d_threadGroup.joinAll();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,795 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size pool of threads that steal each other's jobs.
+//
+//@CLASSES:
+//   bdlmt::WorkStealingThreadPool: fixed-size work-stealing thread pool
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that distributes user-defined functions
+// ("jobs") among a fixed number of processing threads without funneling every
+// job through a single shared queue.  The pool is intended for workloads in
+// which jobs are small and numerous, and in particular for "fork/join"
+// workloads, in which a running job splits its work into sub-jobs that it
+// enqueues back into the same pool.
+//
+// The interface and lifecycle of 'bdlmt::WorkStealingThreadPool' mirror those
+// of 'bdlmt::FixedThreadPool': a pool is constructed with a fixed number of
+// threads, 'start' spawns them and enables queuing, 'enqueueJob' submits a
+// job, 'drain' waits for all submitted jobs to complete, 'stop' disables
+// queuing, drains, and joins the threads, and 'shutdown' discards pending
+// jobs and joins the threads.
+//
+///Scheduling
+///----------
+// Each processing thread ("worker") owns two job containers:
+//
+//: o A lock-free, fixed-capacity, double-ended queue (a "Chase-Lev" deque).
+//:   Only the owning worker pushes to, and pops from, the "bottom" of its
+//:   deque; any other worker may "steal" a job from the "top".  A job
+//:   enqueued by a job running on a worker thread is pushed onto that
+//:   worker's deque and, unless it is stolen first, is executed next by the
+//:   same worker (in last-in, first-out order), which keeps the working set
+//:   of a fork/join computation in that worker's cache.
+//:
+//: o A mutex-protected "inbox" that receives jobs enqueued from threads that
+//:   are not workers of the pool, and jobs enqueued by a worker whose deque is
+//:   full.  External threads distribute their jobs across the inboxes of all
+//:   workers in round-robin order, so concurrent producers contend on
+//:   different mutexes rather than on a single queue.
+//
+// A worker looking for a job first pops from the bottom of its own deque,
+// then from its own inbox, and then visits the other workers, starting at a
+// randomly chosen victim, trying to steal from each victim's deque and then
+// from its inbox.  A worker that finds no job blocks until a new job is
+// enqueued.
+//
+// Note that, unlike 'bdlmt::FixedThreadPool', jobs are *not* guaranteed to
+// begin execution in the order they were enqueued, even when enqueued from a
+// single thread.
+//
+///Enqueuing from Jobs
+///-------------------
+// 'disable', 'drain', and 'stop' affect only threads that are not workers of
+// the pool: a job running on a worker thread can always enqueue sub-jobs as
+// long as the pool is started.  In particular, 'drain' (and hence 'stop')
+// waits for the sub-jobs enqueued by the jobs it waits for, so a fork/join
+// computation enqueued before a call to 'drain' is complete when 'drain'
+// returns.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with 'bdlmt::FixedThreadPool', on Unix platforms all the threads in the
+// pool block all asynchronous signals; only the synchronous signals 'SIGBUS',
+// 'SIGFPE', 'SIGILL', 'SIGSEGV', 'SIGSYS', 'SIGABRT', 'SIGTRAP', and 'SIGIOT'
+// are left unblocked.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Parallel Fork/Join Sum
+///- - - - - - - - - - - - - - - - - -
+// In this example we compute the sum of the elements of an array by
+// recursively splitting the array in halves, summing each half in a separate
+// job.  Each job that splits its range enqueues a sub-job for one half into
+// the pool from which it is run, which pushes the sub-job onto the deque of
+// the current worker where it can be stolen by an idle worker.
+//
+// First, we define the job, which either sums a small range directly or
+// forks a sub-job for each half of its range:
+//..
+//  struct SumJob {
+//      // This 'struct' sums a range of integers into an atomic total.
+//
+//      // DATA
+//      bdlmt::WorkStealingThreadPool *d_pool_p;
+//      const int                     *d_begin_p;
+//      const int                     *d_end_p;
+//      bsls::AtomicInt64             *d_total_p;
+//
+//      // ACCESSORS
+//      void operator()() const
+//          // Add the sum of the range '[d_begin_p, d_end_p)' to
+//          // '*d_total_p'.
+//      {
+//          if (d_end_p - d_begin_p <= 1024) {
+//              bsls::Types::Int64 sum = 0;
+//              for (const int *p = d_begin_p; p != d_end_p; ++p) {
+//                  sum += *p;
+//              }
+//              d_total_p->add(sum);
+//              return;                                               // RETURN
+//          }
+//
+//          const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+//
+//          SumJob left  = { d_pool_p, d_begin_p, middle,  d_total_p };
+//          SumJob right = { d_pool_p, middle,    d_end_p, d_total_p };
+//
+//          d_pool_p->enqueueJob(left);
+//          d_pool_p->enqueueJob(right);
+//      }
+//  };
+//..
+// Then, we create and start a pool with four threads:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we populate the data to sum:
+//..
+//  bsl::vector<int> data(100000);
+//  for (bsl::size_t i = 0; i < data.size(); ++i) {
+//      data[i] = static_cast<int>(i % 7);
+//  }
+//..
+// Now, we enqueue the root job and wait for the entire computation, including
+// all the sub-jobs it forks, to complete:
+//..
+//  bsls::AtomicInt64 total(0);
+//  SumJob root = { &pool, data.data(), data.data() + data.size(), &total };
+//  pool.enqueueJob(root);
+//  pool.drain();
+//..
+// Finally, we verify the result and stop the pool:
+//..
+//  bsls::Types::Int64 expected = 0;
+//  for (bsl::size_t i = 0; i < data.size(); ++i) {
+//      expected += data[i];
+//  }
+//  assert(expected == total);
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigset_t
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" {
+typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+        // This type declares the prototype for functions that are suitable to
+        // be specified to 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+}
+
+                     // ==================================
+                     // class WorkStealingThreadPool_Deque
+                     // ==================================
+
+class WorkStealingThreadPool_Deque {
+    // [!PRIVATE!] This class implements a fixed-capacity, lock-free,
+    // double-ended queue of pointers, as described in "Correct and Efficient
+    // Work-Stealing for Weak Memory Models" (Le, Pop, Cohen, Zappa Nardelli,
+    // PPoPP 2013), with the difference that the underlying array does not
+    // grow (a full deque rejects 'pushBottom').  'pushBottom' and 'popBottom'
+    // may be called only by a single "owner" thread; 'steal' may be called
+    // concurrently from any thread.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations::AtomicTypes::Pointer Slot;
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_INDEX_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE -
+                                                     sizeof(bsls::AtomicInt64)
+    };
+
+    // DATA
+    bsls::AtomicInt64  d_top;             // index of the oldest element;
+                                          // advanced by 'steal' and by
+                                          // 'popBottom' of the last element
+
+    const char         d_topPad[k_INDEX_PADDING];
+                                          // padding to prevent false sharing
+
+    bsls::AtomicInt64  d_bottom;          // one past the index of the newest
+                                          // element; modified only by the
+                                          // owner
+
+    const char         d_bottomPad[k_INDEX_PADDING];
+                                          // padding to prevent false sharing
+
+    Slot              *d_slots_p;         // circular array of 'd_mask + 1'
+                                          // elements (owned)
+
+    bsls::Types::Int64 d_mask;            // capacity minus one
+
+    bslma::Allocator  *d_allocator_p;     // memory allocator (held, not
+                                          // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Deque(const WorkStealingThreadPool_Deque&);
+    WorkStealingThreadPool_Deque& operator=(
+                                          const WorkStealingThreadPool_Deque&);
+
+  public:
+    // CREATORS
+    WorkStealingThreadPool_Deque(int               capacity,
+                                 bslma::Allocator *basicAllocator);
+        // Create an empty deque able to hold at least the specified
+        // 'capacity' elements, using the specified 'basicAllocator' to supply
+        // memory.  The behavior is undefined unless '1 <= capacity'.  Note
+        // that the capacity is rounded up to a power of two.
+
+    ~WorkStealingThreadPool_Deque();
+        // Destroy this deque.  Note that elements remaining in this deque are
+        // not destroyed.
+
+    // MANIPULATORS
+    void *popBottom();
+        // Remove the most recently pushed element from this deque and return
+        // it, or return 0 if this deque is empty.  The behavior is undefined
+        // unless this method is called from the owner thread.
+
+    int pushBottom(void *element);
+        // Push the specified 'element' onto the bottom of this deque.  Return
+        // 0 on success, and a non-zero value if this deque is full.  The
+        // behavior is undefined unless this method is called from the owner
+        // thread and '0 != element'.
+
+    void *steal();
+        // Remove the oldest element from this deque and return it, or return
+        // 0 if this deque is empty or if a concurrent operation removed the
+        // oldest element first.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of elements this deque can hold.
+
+    bool isEmpty() const;
+        // Return a snapshot of whether this deque is empty.
+};
+
+                     // ===================================
+                     // struct WorkStealingThreadPool_Worker
+                     // ===================================
+
+struct WorkStealingThreadPool_Worker {
+    // [!PRIVATE!] This 'struct' holds the job containers and per-thread state
+    // of a single processing thread of a 'WorkStealingThreadPool'.
+
+    // PUBLIC TYPES
+    typedef bsl::function<void()> Job;
+
+    // DATA
+    WorkStealingThreadPool_Deque d_deque;       // jobs pushed by this worker
+
+    bslmt::Mutex                 d_inboxMutex;  // protects 'd_inbox'
+
+    bsl::deque<Job *>            d_inbox;       // jobs pushed by other
+                                                // threads
+
+    bsls::AtomicInt              d_inboxSize;   // snapshot of
+                                                // 'd_inbox.size()', used to
+                                                // avoid locking empty inboxes
+
+    unsigned int                 d_randomState; // state of the generator
+                                                // used to pick victims
+
+    int                          d_index;       // index in the pool
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Worker(const WorkStealingThreadPool_Worker&);
+    WorkStealingThreadPool_Worker& operator=(
+                                         const WorkStealingThreadPool_Worker&);
+
+  public:
+    // CREATORS
+    WorkStealingThreadPool_Worker(int               index,
+                                  int               dequeCapacity,
+                                  bslma::Allocator *basicAllocator);
+        // Create a worker having the specified 'index', whose deque has the
+        // specified 'dequeCapacity', using the specified 'basicAllocator' to
+        // supply memory.
+
+    // MANIPULATORS
+    Job *popInbox();
+        // Remove the oldest job from the inbox of this worker and return it,
+        // or return 0 if the inbox is empty.
+
+    void pushInbox(Job *job);
+        // Append the specified 'job' to the inbox of this worker.
+
+    unsigned int nextRandom();
+        // Return the next value of the pseudo-random sequence of this worker.
+};
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a thread pool of a fixed number of threads, each
+    // owning a work-stealing deque of jobs.  Jobs enqueued by a thread of the
+    // pool are pushed to that thread's deque; jobs enqueued by other threads
+    // are distributed among the threads in round-robin order.  Idle threads
+    // steal jobs from busy ones.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::function<void()> Job;
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_DEQUE_CAPACITY = 4096  // default capacity of the deque of
+                                         // each worker
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker Worker;
+
+    // PRIVATE CONSTANTS
+    enum {
+        e_STOP,
+        e_RUN
+    };
+
+    // DATA
+    bdlma::ConcurrentPool          d_jobPool;         // memory for 'Job'
+                                                      // objects
+
+    bsl::vector<Worker *>          d_workers;         // one per thread
+                                                      // (owned)
+
+    bslmt::ThreadUtil::Key         d_workerKey;       // thread-specific key
+                                                      // mapping a thread of
+                                                      // this pool to its
+                                                      // 'Worker'
+
+    bsls::AtomicUint               d_nextInbox;       // round-robin index of
+                                                      // the inbox for the
+                                                      // next external job
+
+    bsls::AtomicBool               d_enabled;         // whether external
+                                                      // threads may enqueue
+
+    bsls::AtomicInt                d_control;         // 'e_STOP' or 'e_RUN'
+
+    bsls::AtomicInt                d_numPendingJobs;  // jobs enqueued but
+                                                      // not yet dequeued
+
+    bsls::AtomicInt                d_numOutstandingJobs;
+                                                      // jobs enqueued but
+                                                      // not yet completed
+
+    bsls::AtomicInt                d_numThreadsWaiting;
+                                                      // threads blocked (or
+                                                      // about to block) on
+                                                      // 'd_workSemaphore'
+
+    bslmt::Semaphore               d_workSemaphore;   // idle threads wait
+                                                      // here for new jobs
+
+    bslmt::Mutex                   d_drainMutex;      // used with
+                                                      // 'd_drainCondition'
+
+    bslmt::Condition               d_drainCondition;  // signaled when
+                                                      // 'd_numOutstandingJobs'
+                                                      // drops to 0
+
+    bslmt::Mutex                   d_metaMutex;       // serializes 'start',
+                                                      // 'stop', 'shutdown'
+
+    bslmt::ThreadGroup             d_threadGroup;     // processing threads
+
+    bslmt::ThreadAttributes        d_threadAttributes;
+                                                      // attributes of
+                                                      // processing threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                       d_blockSet;        // signals blocked by
+                                                      // processing threads
+#endif
+
+    const int                      d_numThreads;      // number of threads
+
+    bslma::Allocator              *d_allocator_p;     // memory allocator
+                                                      // (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    Job *createJob(const Job& functor);
+    Job *createJob(bslmf::MovableRef<Job> functor);
+        // Return a pointer to a new copy of the specified 'functor', allocated
+        // from 'd_jobPool'.
+
+    void destroyJob(Job *job);
+        // Destroy the specified 'job' and return its memory to 'd_jobPool'.
+
+    Job *findJob(Worker *worker);
+        // Return a job for the specified 'worker' to execute, taken from its
+        // own deque or inbox, or stolen from another worker, or 0 if no job
+        // was found.
+
+    void initialize(int dequeCapacity);
+        // Create 'd_numThreads' workers, each having a deque of the specified
+        // 'dequeCapacity', and the thread-specific key used to identify them.
+
+    void removeAll();
+        // Destroy, without executing, all jobs held by this pool.  The
+        // behavior is undefined unless no processing thread is running.
+
+    int submit(Job *job);
+        // Add the specified 'job' to the appropriate container of this pool
+        // and wake an idle thread if any.  Return 0 on success, and a
+        // non-zero value (after destroying 'job') if queuing is disabled for
+        // the calling thread.
+
+    void wakeAll();
+        // Wake every processing thread blocked waiting for a job.
+
+    void workerThread(int index);
+        // The main function executed by the processing thread having the
+        // specified 'index'.
+
+    void waitForOutstandingJobs();
+        // Block until every job enqueued in this pool has completed.
+
+    int startNewThread(int index);
+        // Spawn the processing thread having the specified 'index'.  Return 0
+        // on success, and a non-zero value otherwise.  Note that this method
+        // must be called with 'd_metaMutex' locked.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+    WorkStealingThreadPool(int               numThreads,
+                           int               dequeCapacity,
+                           bslma::Allocator *basicAllocator = 0);
+        // Construct a thread pool with the specified 'numThreads' number of
+        // threads, each owning a deque able to hold at least the optionally
+        // specified 'dequeCapacity' jobs.  If 'dequeCapacity' is not
+        // specified, 'k_DEFAULT_DEQUE_CAPACITY' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numThreads' and '1 <= dequeCapacity'.  Note
+        // that jobs pushed by a thread whose deque is full are placed in that
+        // thread's (unbounded) inbox instead.
+
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           int                             dequeCapacity,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Construct a thread pool with the specified 'threadAttributes',
+        // 'numThreads' number of threads, each owning a deque able to hold at
+        // least the specified 'dequeCapacity' jobs.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numThreads' and '1 <= dequeCapacity'.
+
+    ~WorkStealingThreadPool();
+        // Discard all pending jobs without executing them, block until all
+        // currently running jobs complete, and then destroy this thread pool.
+
+    // MANIPULATORS
+    void disable();
+        // Disable queuing into this pool from threads that are not threads of
+        // this pool.  Subsequent calls to 'enqueueJob' from such threads will
+        // immediately fail.  Note that this method has no effect on jobs
+        // currently in the pool, nor on jobs enqueued by running jobs.
+
+    void enable();
+        // Enable queuing into this pool if it is started.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by a thread of this
+        // pool.  If the calling thread is a thread of this pool, the job is
+        // pushed onto that thread's deque; otherwise the job is placed in the
+        // inbox of the next thread in round-robin order.  Return 0 if
+        // enqueued successfully, and a non-zero value if this pool is not
+        // started or, for threads that are not threads of this pool, if
+        // queuing is disabled.  This method never blocks.  The behavior is
+        // undefined unless 'functor' is not "unset".
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a thread of this
+        // pool.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is disabled for the
+        // calling thread.
+
+    void drain();
+        // Wait until all pending jobs, including jobs enqueued by those jobs,
+        // complete.  Note that if any jobs are submitted concurrently with
+        // this method by threads that are not threads of this pool, this
+        // method may or may not wait until they have also completed.  The
+        // behavior is undefined if this method is called from a job executed
+        // by this pool.
+
+    void shutdown();
+        // Disable queuing on this thread pool, discard all pending jobs, and
+        // after all active jobs have completed, join all processing threads.
+        // Note that jobs enqueued by active jobs are also discarded.  The
+        // behavior is undefined if this method is called from a job executed
+        // by this pool.
+
+    int start();
+        // Spawn 'numThreads()' processing threads.  On success, enable
+        // enqueuing and return 0.  Return a non-zero value otherwise.  If
+        // 'numThreads()' threads were not successfully started, all threads
+        // are stopped.  Note that calling 'start' on a started pool has no
+        // effect and returns 0.
+
+    void stop();
+        // Disable queuing on this thread pool, wait until all pending jobs
+        // (including the jobs they enqueue) complete, then shut down all
+        // processing threads.  The behavior is undefined if this method is
+        // called from a job executed by this pool.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if queuing from threads that are not threads of this
+        // pool is enabled, and 'false' otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if 'numThreads()' threads are started on this pool,
+        // and 'false' otherwise.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs enqueued in this pool that
+        // have not yet been dequeued by a processing thread.
+
+    int numThreads() const;
+        // Return the number of threads passed to this thread pool at
+        // construction.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of threads currently started by
+        // this thread pool.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // ----------------------------------
+                     // class WorkStealingThreadPool_Deque
+                     // ----------------------------------
+
+// MANIPULATORS
+inline
+void *WorkStealingThreadPool_Deque::popBottom()
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+
+    // The sequentially consistent store of 'd_bottom' followed by the
+    // sequentially consistent load of 'd_top' orders this operation with
+    // respect to a concurrent 'steal'.
+
+    d_bottom = bottom;
+    bsls::Types::Int64 top = d_top;
+
+    if (top > bottom) {
+        // empty
+
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    void *element = bsls::AtomicOperations::getPtrRelaxed(
+                                                &d_slots_p[bottom & d_mask]);
+
+    if (top == bottom) {
+        // Last element: race against thieves for it.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            element = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+
+    return element;
+}
+
+inline
+int WorkStealingThreadPool_Deque::pushBottom(void *element)
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed();
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+
+    if (bottom - top > d_mask) {
+        return 1;                                                     // RETURN
+    }
+
+    bsls::AtomicOperations::setPtrRelaxed(&d_slots_p[bottom & d_mask],
+                                          element);
+    d_bottom.storeRelease(bottom + 1);
+
+    return 0;
+}
+
+inline
+void *WorkStealingThreadPool_Deque::steal()
+{
+    bsls::Types::Int64 top          = d_top;
+    const bsls::Types::Int64 bottom = d_bottom;
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    // The slot is read before the claim; the claim succeeding implies the
+    // owner could not have overwritten the slot, since doing so requires
+    // 'd_top' to have advanced past 'top'.
+
+    void *element = bsls::AtomicOperations::getPtrRelaxed(
+                                                   &d_slots_p[top & d_mask]);
+
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    return element;
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool_Deque::capacity() const
+{
+    return static_cast<int>(d_mask + 1);
+}
+
+inline
+bool WorkStealingThreadPool_Deque::isEmpty() const
+{
+    return d_top.loadAcquire() >= d_bottom.loadAcquire();
+}
+
+                     // -----------------------------------
+                     // struct WorkStealingThreadPool_Worker
+                     // -----------------------------------
+
+// MANIPULATORS
+inline
+unsigned int WorkStealingThreadPool_Worker::nextRandom()
+{
+    // xorshift32
+
+    unsigned int x = d_randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    d_randomState = x;
+    return x;
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_enabled = false;
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    d_enabled = e_RUN == d_control.load();
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    return submit(createJob(functor));
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    return submit(createJob(bslmf::MovableRefUtil::move(functor)));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return d_enabled;
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    return d_numPendingJobs;
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
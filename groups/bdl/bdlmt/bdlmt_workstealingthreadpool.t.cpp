@@ -0,0 +1,1133 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_latch.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// A work-stealing thread pool dispatches jobs onto a fixed number of threads,
+// each owning a lock-free deque ('bdlmt::WorkStealingThreadPool_Deque') and a
+// mutex-protected inbox.  We first verify the deque in isolation, including
+// concurrent stealing, and then verify that the pool can be started, stopped,
+// drained, and shut down, that jobs enqueued from outside the pool and from
+// jobs running in the pool are each executed exactly once, that 'drain' waits
+// for jobs enqueued by jobs, and that jobs overflowing a full deque are not
+// lost.
+//
+// In addition to positive test cases, a negative test case -1 can be run
+// manually to compare the throughput of this pool with 'bdlmt::ThreadPool'
+// and 'bdlmt::FixedThreadPool' on fork/join and flat workloads using
+// 'bslmt::ThroughputBenchmark'.
+// ----------------------------------------------------------------------------
+// CLASS 'bdlmt::WorkStealingThreadPool_Deque'
+// [ 2] WorkStealingThreadPool_Deque(int, bslma::Allocator *);
+// [ 2] ~WorkStealingThreadPool_Deque();
+// [ 2] void *popBottom();
+// [ 2] int pushBottom(void *);
+// [ 2] void *steal();
+// [ 2] int capacity() const;
+// [ 2] bool isEmpty() const;
+//
+// CLASS 'bdlmt::WorkStealingThreadPool'
+// [ 3] WorkStealingThreadPool(int, bslma::Allocator *);
+// [ 3] WorkStealingThreadPool(int, int, bslma::Allocator *);
+// [ 3] WorkStealingThreadPool(const ThreadAttributes&, int, int, Alloc *);
+// [ 3] ~WorkStealingThreadPool();
+// [ 3] int start();
+// [ 3] void stop();
+// [ 3] bool isStarted() const;
+// [ 3] int numThreads() const;
+// [ 3] int numThreadsStarted() const;
+// [ 4] int enqueueJob(const Job&);
+// [ 4] int enqueueJob(bslmf::MovableRef<Job>);
+// [ 4] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 4] void drain();
+// [ 4] int numPendingJobs() const;
+// [ 5] void disable();
+// [ 5] void enable();
+// [ 5] bool isEnabled() const;
+// [ 5] void shutdown();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] TESTING FORK/JOIN
+// [ 7] TESTING DEQUE OVERFLOW
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: FORK/JOIN AND FLAT WORKLOADS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool       Obj;
+typedef bdlmt::WorkStealingThreadPool_Deque Deque;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void incrementCounter(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+extern "C" void incrementCounterC(void *counter)
+    // Increment the 'bsls::AtomicInt' addressed by the specified 'counter'.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void waitOnBarrier(bslmt::Barrier *barrier, bsls::AtomicInt *counter)
+    // Wait on the specified 'barrier', then increment the specified
+    // 'counter'.
+{
+    barrier->wait();
+    ++*counter;
+}
+
+void countTree(Obj *pool, int depth, bsls::AtomicInt *numLeaves)
+    // Enqueue into the specified 'pool' two jobs each counting a tree of the
+    // specified 'depth' minus one, or increment the specified 'numLeaves' if
+    // 'depth' is 0.
+{
+    if (0 == depth) {
+        ++*numLeaves;
+        return;                                                       // RETURN
+    }
+
+    ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&countTree,
+                                                      pool,
+                                                      depth - 1,
+                                                      numLeaves)));
+    ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&countTree,
+                                                      pool,
+                                                      depth - 1,
+                                                      numLeaves)));
+}
+
+void fanOut(Obj *pool, int numJobs, bsls::AtomicInt *counter)
+    // Enqueue into the specified 'pool' the specified 'numJobs' jobs, each
+    // incrementing the specified 'counter'.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                          counter)));
+    }
+}
+
+                              // ===============
+                              // struct DequeOps
+                              // ===============
+
+struct DequeOps {
+    // This 'struct' provides namespace for the thread functions of the
+    // concurrent deque test.
+
+    static void record(void              *element,
+                       bsls::AtomicInt   *taken,
+                       bsls::AtomicInt64 *sum)
+        // If the specified 'element' is not 0, add its value to the specified
+        // 'sum' and increment the specified 'taken'.
+    {
+        if (element) {
+            sum->add(reinterpret_cast<bsls::Types::IntPtr>(element));
+            ++*taken;
+        }
+    }
+
+    static void owner(Deque             *deque,
+                      int                numElements,
+                      bsls::AtomicInt   *taken,
+                      bsls::AtomicInt64 *sum)
+        // Push the values '1 .. numElements' (encoded as pointers) onto the
+        // specified 'deque', popping some of them back, and accumulate in the
+        // specified 'sum' the values popped, incrementing the specified
+        // 'taken' for each.
+    {
+        for (bsls::Types::IntPtr i = 1; i <= numElements; ++i) {
+            while (0 != deque->pushBottom(reinterpret_cast<void *>(i))) {
+                record(deque->popBottom(), taken, sum);
+            }
+            if (0 == i % 3) {
+                record(deque->popBottom(), taken, sum);
+            }
+        }
+        while (!deque->isEmpty()) {
+            record(deque->popBottom(), taken, sum);
+        }
+    }
+
+    static void thief(Deque             *deque,
+                      int                numElements,
+                      bsls::AtomicInt   *taken,
+                      bsls::AtomicInt64 *sum)
+        // Steal from the specified 'deque' until the specified 'taken' reaches
+        // the specified 'numElements', accumulating in the specified 'sum' the
+        // values stolen.
+    {
+        while (*taken < numElements) {
+            record(deque->steal(), taken, sum);
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                         PERFORMANCE TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace perf {
+
+template <class POOL>
+struct ForkJoinJob {
+    // This 'struct' implements a job that forks a binary tree of jobs of a
+    // given depth into a pool, each leaf arriving at a latch.
+
+    // DATA
+    POOL          *d_pool_p;
+    int            d_depth;
+    bslmt::Latch  *d_latch_p;
+
+    // ACCESSORS
+    void operator()() const
+        // Enqueue two jobs of depth 'd_depth - 1' or, for a leaf, perform a
+        // small amount of work and arrive at the latch.
+    {
+        if (0 == d_depth) {
+            bslmt::ThroughputBenchmark::busyWork(50);
+            d_latch_p->arrive();
+            return;                                                   // RETURN
+        }
+        ForkJoinJob child = { d_pool_p, d_depth - 1, d_latch_p };
+        d_pool_p->enqueueJob(child);
+        d_pool_p->enqueueJob(child);
+    }
+};
+
+template <class POOL>
+void runForkJoin(POOL *pool, int depth, int)
+    // Run a fork/join tree of the specified 'depth' in the specified 'pool'
+    // and wait for its completion.
+{
+    bslmt::Latch       latch(1 << depth);
+    ForkJoinJob<POOL>  root = { pool, depth, &latch };
+    pool->enqueueJob(root);
+    latch.wait();
+}
+
+template <class POOL>
+void runFlat(POOL *pool, int numJobs, int)
+    // Enqueue the specified 'numJobs' small independent jobs into the
+    // specified 'pool' and wait for their completion.
+{
+    bslmt::Latch      latch(numJobs);
+    ForkJoinJob<POOL> leaf = { pool, 0, &latch };
+    for (int i = 0; i < numJobs; ++i) {
+        pool->enqueueJob(leaf);
+    }
+    latch.wait();
+}
+
+template <class POOL>
+double measure(POOL *pool,
+               bool  forkJoin,
+               int   numProducers,
+               int   param)
+    // Return the median throughput, in submissions per second, of the
+    // specified 'numProducers' threads each repeatedly submitting to the
+    // specified 'pool' a fork/join tree of depth 'param' if the specified
+    // 'forkJoin' is 'true', or 'param' flat jobs otherwise.
+{
+    bslmt::ThroughputBenchmark bench;
+    if (forkJoin) {
+        bench.addThreadGroup(bdlf::BindUtil::bind(&runForkJoin<POOL>,
+                                                  pool,
+                                                  param,
+                                                  bdlf::PlaceHolders::_1),
+                             numProducers,
+                             0);
+    }
+    else {
+        bench.addThreadGroup(bdlf::BindUtil::bind(&runFlat<POOL>,
+                                                  pool,
+                                                  param,
+                                                  bdlf::PlaceHolders::_1),
+                             numProducers,
+                             0);
+    }
+
+    bslmt::ThroughputBenchmarkResult result;
+    bench.execute(&result, 300, 5);
+
+    double median;
+    result.getMedian(&median, 0);
+    return median;
+}
+
+}  // close namespace perf
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Example 1: A Parallel Fork/Join Sum
+///- - - - - - - - - - - - - - - - - -
+// In this example we compute the sum of the elements of an array by
+// recursively splitting the array in halves, summing each half in a separate
+// job.  Each job that splits its range enqueues a sub-job for one half into
+// the pool from which it is run, which pushes the sub-job onto the deque of
+// the current worker where it can be stolen by an idle worker.
+//
+// First, we define the job, which either sums a small range directly or
+// forks a sub-job for each half of its range:
+//..
+    struct SumJob {
+        // This 'struct' sums a range of integers into an atomic total.
+
+        // DATA
+        bdlmt::WorkStealingThreadPool *d_pool_p;
+        const int                     *d_begin_p;
+        const int                     *d_end_p;
+        bsls::AtomicInt64             *d_total_p;
+
+        // ACCESSORS
+        void operator()() const
+            // Add the sum of the range '[d_begin_p, d_end_p)' to
+            // '*d_total_p'.
+        {
+            if (d_end_p - d_begin_p <= 1024) {
+                bsls::Types::Int64 sum = 0;
+                for (const int *p = d_begin_p; p != d_end_p; ++p) {
+                    sum += *p;
+                }
+                d_total_p->add(sum);
+                return;                                               // RETURN
+            }
+
+            const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+
+            SumJob left  = { d_pool_p, d_begin_p, middle,  d_total_p };
+            SumJob right = { d_pool_p, middle,    d_end_p, d_total_p };
+
+            d_pool_p->enqueueJob(left);
+            d_pool_p->enqueueJob(right);
+        }
+    };
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we create and start a pool with four threads:
+//..
+    bdlmt::WorkStealingThreadPool pool(4);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we populate the data to sum:
+//..
+    bsl::vector<int> data(100000);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<int>(i % 7);
+    }
+//..
+// Now, we enqueue the root job and wait for the entire computation, including
+// all the sub-jobs it forks, to complete:
+//..
+    bsls::AtomicInt64 total(0);
+    SumJob root = { &pool, data.data(), data.data() + data.size(), &total };
+    pool.enqueueJob(root);
+    pool.drain();
+//..
+// Finally, we verify the result and stop the pool:
+//..
+    bsls::Types::Int64 expected = 0;
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        expected += data[i];
+    }
+    ASSERT(expected == total);
+
+    pool.stop();
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING DEQUE OVERFLOW
+        //
+        // Concerns:
+        //: 1 A job enqueued by a worker whose deque is full is placed in the
+        //:   worker's inbox and is executed.
+        //
+        // Plan:
+        //: 1 Using a pool whose deques have capacity 1, run a job that
+        //:   enqueues many jobs and verify that all of them run.  (C-1)
+        //
+        // Testing:
+        //   TESTING DEQUE OVERFLOW
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DEQUE OVERFLOW" << endl
+                          << "======================" << endl;
+
+        for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+
+            Obj mX(numThreads, 1, &ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+            const int       NUM_JOBS = 1000;
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                           &mX,
+                                                           NUM_JOBS,
+                                                           &counter)));
+            mX.drain();
+            LOOP_ASSERT(numThreads, NUM_JOBS == counter);
+
+            mX.stop();
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING FORK/JOIN
+        //
+        // Concerns:
+        //: 1 Jobs enqueued by jobs running in the pool are executed exactly
+        //:   once.
+        //:
+        //: 2 'drain' waits for jobs enqueued by the jobs it waits for.
+        //:
+        //: 3 'stop' executes every job of a fork/join tree even though it
+        //:   disables queuing from external threads.
+        //:
+        //: 4 Fork/join trees submitted concurrently from several external
+        //:   threads all complete.
+        //
+        // Plan:
+        //: 1 Enqueue a job that forks a binary tree of jobs, 'drain', and
+        //:   verify the number of leaves.  (C-1..2)
+        //:
+        //: 2 Enqueue a tree and immediately 'stop'.  (C-3)
+        //:
+        //: 3 Enqueue trees from several threads concurrently.  (C-4)
+        //
+        // Testing:
+        //   TESTING FORK/JOIN
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING FORK/JOIN" << endl
+                          << "=================" << endl;
+
+        const int DEPTH = 12;
+
+        for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+
+            Obj mX(numThreads, &ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt numLeaves(0);
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&countTree,
+                                                           &mX,
+                                                           DEPTH,
+                                                           &numLeaves)));
+            mX.drain();
+            LOOP_ASSERT(numThreads, (1 << DEPTH) == numLeaves);
+            ASSERT(0 == mX.numPendingJobs());
+
+            numLeaves = 0;
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&countTree,
+                                                           &mX,
+                                                           DEPTH,
+                                                           &numLeaves)));
+            mX.stop();
+            LOOP_ASSERT(numThreads, (1 << DEPTH) == numLeaves);
+            ASSERT(!mX.isStarted());
+
+            ASSERT(0 == mX.start());
+
+            const int          NUM_PRODUCERS = 4;
+            bsls::AtomicInt    leaves[NUM_PRODUCERS];
+            bslmt::ThreadGroup producers;
+
+            for (int i = 0; i < NUM_PRODUCERS; ++i) {
+                leaves[i] = 0;
+                producers.addThread(bdlf::BindUtil::bind(&countTree,
+                                                         &mX,
+                                                         DEPTH,
+                                                         &leaves[i]));
+            }
+            producers.joinAll();
+            mX.drain();
+
+            for (int i = 0; i < NUM_PRODUCERS; ++i) {
+                LOOP2_ASSERT(numThreads, i, (1 << DEPTH) == leaves[i]);
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'disable', 'enable', AND 'shutdown'
+        //
+        // Concerns:
+        //: 1 A disabled pool rejects jobs from external threads.
+        //:
+        //: 2 'enable' re-enables a started pool but not a stopped one.
+        //:
+        //: 3 'shutdown' discards pending jobs without executing them, and
+        //:   releases their memory.
+        //
+        // Plan:
+        //: 1 Disable and enable a pool, checking 'isEnabled' and the result of
+        //:   'enqueueJob'.  (C-1..2)
+        //:
+        //: 2 Block every thread of a pool on a barrier, enqueue further jobs,
+        //:   and 'shutdown' once the blocked jobs are released; verify the
+        //:   further jobs did not run and no memory is outstanding.  (C-3)
+        //
+        // Testing:
+        //   void disable();
+        //   void enable();
+        //   bool isEnabled() const;
+        //   void shutdown();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'disable', 'enable', AND 'shutdown'"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(2, &ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isEnabled());
+            mX.enable();
+            ASSERT(false == X.isEnabled());
+
+            ASSERT(0 == mX.start());
+            ASSERT(true  == X.isEnabled());
+
+            bsls::AtomicInt counter(0);
+
+            mX.disable();
+            ASSERT(false == X.isEnabled());
+            ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter)));
+            mX.enable();
+            ASSERT(true  == X.isEnabled());
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter)));
+            mX.drain();
+            ASSERT(1 == counter);
+
+            const int      NUM_THREADS = X.numThreads();
+            bslmt::Barrier barrier(NUM_THREADS + 1);
+            bsls::AtomicInt blocked(0);
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOnBarrier,
+                                                               &barrier,
+                                                               &blocked)));
+            }
+
+            // Wait for every thread to be busy.
+
+            while (0 != X.numPendingJobs()) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            counter = 0;
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                                   bdlf::BindUtil::bind(&incrementCounter,
+                                                        &counter)));
+            }
+            ASSERT(100 == X.numPendingJobs());
+
+            // Release the blocked jobs only after 'shutdown' has stopped the
+            // pool (which it does before disabling it); use a separate thread
+            // to call 'shutdown'.
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                &handle,
+                                bdlf::BindUtil::bind(&Obj::shutdown, &mX)));
+
+            while (X.isEnabled()) {
+                bslmt::ThreadUtil::yield();
+            }
+            barrier.wait();
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(NUM_THREADS == blocked);
+            ASSERTV(counter, 0 == counter);
+            ASSERT(0 == X.numPendingJobs());
+            ASSERT(false == X.isStarted());
+            ASSERT(false == X.isEnabled());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'enqueueJob' AND 'drain'
+        //
+        // Concerns:
+        //: 1 Each 'enqueueJob' overload enqueues a job that is executed
+        //:   exactly once.
+        //:
+        //: 2 'enqueueJob' fails if the pool is not started.
+        //:
+        //: 3 'drain' returns once all jobs have been executed, and leaves the
+        //:   pool started.
+        //:
+        //: 4 Jobs are allocated from the pool's allocator.
+        //
+        // Plan:
+        //: 1 Enqueue jobs using each overload from several threads, 'drain',
+        //:   and verify the counters.  (C-1, 3..4)
+        //:
+        //: 2 Enqueue into an unstarted pool.  (C-2)
+        //
+        // Testing:
+        //   int enqueueJob(const Job&);
+        //   int enqueueJob(bslmf::MovableRef<Job>);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   void drain();
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'enqueueJob' AND 'drain'" << endl
+                          << "================================" << endl;
+
+        for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(numThreads, &ta);  const Obj& X = mX;
+
+                bsls::AtomicInt counter(0);
+
+                ASSERT(0 != mX.enqueueJob(
+                                   bdlf::BindUtil::bind(&incrementCounter,
+                                                        &counter)));
+                ASSERT(0 != mX.enqueueJob(&incrementCounterC, &counter));
+                ASSERT(0 == X.numPendingJobs());
+
+                ASSERT(0 == mX.start());
+
+                const int NUM_JOBS = 1000;
+
+                bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    const Obj::Job job(bdlf::BindUtil::bind(&incrementCounter,
+                                                            &counter));
+                    ASSERT(0 == mX.enqueueJob(job));
+
+                    Obj::Job movable(bdlf::BindUtil::bind(&incrementCounter,
+                                                          &counter));
+                    ASSERT(0 == mX.enqueueJob(
+                                     bslmf::MovableRefUtil::move(movable)));
+
+                    ASSERT(0 == mX.enqueueJob(&incrementCounterC, &counter));
+                }
+                ASSERT(numAllocations < ta.numAllocations());
+
+                mX.drain();
+                LOOP_ASSERT(counter, 3 * NUM_JOBS == counter);
+                ASSERT(0 == X.numPendingJobs());
+                ASSERT(X.isStarted());
+
+                counter = 0;
+
+                bslmt::ThreadGroup producers;
+                for (int i = 0; i < 4; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(
+                                      &fanOut,
+                                      &mX,
+                                      NUM_JOBS,
+                                      &counter));
+                }
+                producers.joinAll();
+                mX.drain();
+                LOOP_ASSERT(counter, 4 * NUM_JOBS == counter);
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'start', AND 'stop'
+        //
+        // Concerns:
+        //: 1 Each constructor creates a stopped pool with the requested number
+        //:   of threads, using the supplied allocator.
+        //:
+        //: 2 'start' starts 'numThreads' threads, and is idempotent.
+        //:
+        //: 3 'stop' joins all threads and is idempotent; the pool can be
+        //:   restarted.
+        //:
+        //: 4 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 For each constructor, construct, start, stop, restart, and
+        //:   destroy a pool, checking the accessors and allocators.  (C-1..4)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int, bslma::Allocator *);
+        //   WorkStealingThreadPool(int, int, bslma::Allocator *);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, int, Alloc*);
+        //   ~WorkStealingThreadPool();
+        //   int start();
+        //   void stop();
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'start', AND 'stop'" << endl
+                          << "=====================================" << endl;
+
+        for (char cfg = 'a'; cfg <= 'c'; ++cfg) {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            bslma::TestAllocator da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            const int NUM_THREADS = 3;
+
+            {
+                Obj *objPtr = 0;
+
+                bslmt::ThreadAttributes attr;
+                switch (cfg) {
+                  case 'a': {
+                    objPtr = new (ta) Obj(NUM_THREADS, &ta);
+                  } break;
+                  case 'b': {
+                    objPtr = new (ta) Obj(NUM_THREADS, 16, &ta);
+                  } break;
+                  case 'c': {
+                    objPtr = new (ta) Obj(attr, NUM_THREADS, 16, &ta);
+                  } break;
+                }
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                ASSERT(NUM_THREADS == X.numThreads());
+                ASSERT(0           == X.numThreadsStarted());
+                ASSERT(false       == X.isStarted());
+                ASSERT(false       == X.isEnabled());
+                ASSERT(0           <  ta.numBytesInUse());
+
+                ASSERT(0           == mX.start());
+                ASSERT(NUM_THREADS == X.numThreadsStarted());
+                ASSERT(true        == X.isStarted());
+                ASSERT(true        == X.isEnabled());
+
+                ASSERT(0           == mX.start());
+                ASSERT(NUM_THREADS == X.numThreadsStarted());
+
+                mX.stop();
+                ASSERT(0           == X.numThreadsStarted());
+                ASSERT(false       == X.isStarted());
+                ASSERT(false       == X.isEnabled());
+
+                mX.stop();
+
+                ASSERT(0           == mX.start());
+                ASSERT(true        == X.isStarted());
+
+                ta.deleteObject(objPtr);
+            }
+            LOOP_ASSERT(cfg, 0 == ta.numBytesInUse());
+            LOOP_ASSERT(cfg, 0 == da.numBytesInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'WorkStealingThreadPool_Deque'
+        //
+        // Concerns:
+        //: 1 The capacity is the requested capacity rounded up to a power of
+        //:   two, and 'pushBottom' fails when the deque is full.
+        //:
+        //: 2 'popBottom' returns elements in LIFO order and 'steal' in FIFO
+        //:   order; both return 0 on an empty deque.
+        //:
+        //: 3 Under concurrent 'steal' calls from several threads, each
+        //:   element pushed is removed exactly once.
+        //
+        // Plan:
+        //: 1 Push, pop, and steal in a single thread, checking each result.
+        //:   (C-1..2)
+        //:
+        //: 2 Run an owner thread pushing and popping while several thieves
+        //:   steal, and verify the count and sum of the elements removed.
+        //:   (C-3)
+        //
+        // Testing:
+        //   WorkStealingThreadPool_Deque(int, bslma::Allocator *);
+        //   ~WorkStealingThreadPool_Deque();
+        //   void *popBottom();
+        //   int pushBottom(void *);
+        //   void *steal();
+        //   int capacity() const;
+        //   bool isEmpty() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'WorkStealingThreadPool_Deque'" << endl
+                          << "======================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tSingle-threaded." << endl;
+        {
+            Deque mX(5, &ta);  const Deque& X = mX;
+
+            ASSERT(8 == X.capacity());
+            ASSERT(X.isEmpty());
+            ASSERT(0 == mX.popBottom());
+            ASSERT(0 == mX.steal());
+
+            char elements[9];
+            for (int i = 0; i < 8; ++i) {
+                ASSERT(0 == mX.pushBottom(&elements[i]));
+            }
+            ASSERT(0 != mX.pushBottom(&elements[8]));
+            ASSERT(!X.isEmpty());
+
+            ASSERT(&elements[0] == mX.steal());
+            ASSERT(&elements[1] == mX.steal());
+            ASSERT(&elements[7] == mX.popBottom());
+            ASSERT(&elements[6] == mX.popBottom());
+
+            ASSERT(0 == mX.pushBottom(&elements[8]));
+            ASSERT(&elements[8] == mX.popBottom());
+
+            for (int i = 2; i < 6; ++i) {
+                ASSERTV(i, &elements[i] == mX.steal());
+            }
+            ASSERT(X.isEmpty());
+            ASSERT(0 == mX.popBottom());
+            ASSERT(0 == mX.steal());
+
+            // Wrap around the circular array several times.
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(0 == mX.pushBottom(&elements[i % 9]));
+                ASSERT(0 == mX.pushBottom(&elements[(i + 1) % 9]));
+                ASSERT(&elements[i % 9]       == mX.steal());
+                ASSERT(&elements[(i + 1) % 9] == mX.popBottom());
+            }
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tConcurrent stealing." << endl;
+        {
+            const int NUM_ELEMENTS = 100000;
+            const int NUM_THIEVES  = 3;
+
+            Deque mX(64, &ta);
+
+            bsls::AtomicInt taken(0);
+            bsls::AtomicInt64 sums[NUM_THIEVES + 1];
+            for (int i = 0; i <= NUM_THIEVES; ++i) {
+                sums[i] = 0;
+            }
+
+            bslmt::ThreadGroup threads;
+            for (int i = 0; i < NUM_THIEVES; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(&DequeOps::thief,
+                                                       &mX,
+                                                       NUM_ELEMENTS,
+                                                       &taken,
+                                                       &sums[i]));
+            }
+            DequeOps::owner(&mX, NUM_ELEMENTS, &taken, &sums[NUM_THIEVES]);
+            threads.joinAll();
+
+            bsls::Types::Int64 total = 0;
+            for (int i = 0; i <= NUM_THIEVES; ++i) {
+                total += sums[i];
+                if (veryVerbose) { P_(i) P(sums[i]) }
+            }
+
+            ASSERTV(taken, NUM_ELEMENTS == taken);
+            ASSERTV(total, static_cast<bsls::Types::Int64>(NUM_ELEMENTS) *
+                                       (NUM_ELEMENTS + 1) / 2 == total);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue some jobs, drain, and stop.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(4, &ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                                   bdlf::BindUtil::bind(&incrementCounter,
+                                                        &counter)));
+            }
+            mX.drain();
+            ASSERT(100 == counter);
+
+            mX.stop();
+            ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter)));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FORK/JOIN AND FLAT WORKLOADS
+        //
+        // Concerns:
+        //: 1 The work-stealing pool sustains a higher throughput than the
+        //:   pools having a single shared queue when jobs fork sub-jobs, and
+        //:   when many producers enqueue small jobs.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', measure the number of
+        //:   fork/join trees (and batches of flat jobs) completed per second
+        //:   by 'bdlmt::ThreadPool', 'bdlmt::FixedThreadPool', and
+        //:   'bdlmt::WorkStealingThreadPool' having the same number of
+        //:   threads, for an increasing number of producer threads.
+        //
+        // Usage: bdlmt_workstealingthreadpool.t.dbg_exc_mt -1 [T] [D] [N]
+        //
+        //   T: number of threads of each pool (default 4)
+        //   D: depth of each fork/join tree (default 8)
+        //   N: number of jobs in each flat batch (default 256)
+        //
+        // Testing:
+        //   PERFORMANCE: FORK/JOIN AND FLAT WORKLOADS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: FORK/JOIN AND FLAT WORKLOADS" << endl
+             << "=========================================" << endl;
+
+        const int NUM_THREADS = argc > 2 ? atoi(argv[2]) : 4;
+        const int DEPTH       = argc > 3 ? atoi(argv[3]) : 8;
+        const int BATCH       = argc > 4 ? atoi(argv[4]) : 256;
+
+        bslma::Allocator *alloc = bslma::Default::globalAllocator();
+        bslma::DefaultAllocatorGuard dag(alloc);
+
+        bslmt::ThreadAttributes attr;
+
+        bdlmt::ThreadPool      tp(attr, NUM_THREADS, NUM_THREADS, 1000,
+                                  alloc);
+        bdlmt::FixedThreadPool ftp(attr, NUM_THREADS, 1 << 16, alloc);
+        Obj                    wstp(NUM_THREADS, alloc);
+
+        ASSERT(0 == tp.start());
+        ASSERT(0 == ftp.start());
+        ASSERT(0 == wstp.start());
+
+        cout << "threads=" << NUM_THREADS << " depth=" << DEPTH
+             << " batch=" << BATCH << "  (submissions/second)\n";
+
+        for (int pass = 0; pass < 2; ++pass) {
+            const bool FORK_JOIN = 0 == pass;
+            const int  PARAM     = FORK_JOIN ? DEPTH : BATCH;
+
+            cout << (FORK_JOIN ? "fork/join" : "flat") << ":\n"
+                 << "producers       ThreadPool  FixedThreadPool"
+                 << "  WorkStealingThreadPool\n";
+
+            for (int numProducers = 1; numProducers <= 8; numProducers *= 2) {
+                double tpRate   = perf::measure(&tp,
+                                                FORK_JOIN,
+                                                numProducers,
+                                                PARAM);
+                double ftpRate  = perf::measure(&ftp,
+                                                FORK_JOIN,
+                                                numProducers,
+                                                PARAM);
+                double wstpRate = perf::measure(&wstp,
+                                                FORK_JOIN,
+                                                numProducers,
+                                                PARAM);
+
+                cout.width(9);   cout << numProducers;
+                cout.width(17);  cout << tpRate;
+                cout.width(17);  cout << ftpRate;
+                cout.width(24);  cout << wstpRate << "\n";
+            }
+        }
+
+        tp.stop();
+        ftp.stop();
+        wstp.stop();
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -15,6 +15,9 @@ BSLS_IDENT_RCSID(bdls_filesystemutil_cpp, "$Id$ $CSID$")
 #include <bdls_memoryutil.h>
 #include <bdls_pathutil.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bdlt_epochutil.h>
@@ -73,10 +76,25 @@ enum {
     k_UNKNOWN_ERROR = 127
 };
 
+enum {
+    k_MAX_IO_VECTORS = 64  // maximum number of blob buffers transferred by a
+                           // single call to 'readv' or 'writev'
+};
+
 // STATIC HELPER FUNCTIONS
 
 namespace {
 
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+struct IoVector {
+    // This 'struct' provides the members of the POSIX 'struct iovec' used by
+    // the I/O vector functions of 'bdlbb::BlobUtil'.
+
+    void        *iov_base;
+    bsl::size_t  iov_len;
+};
+#endif
+
 struct NameRec {
     // This 'struct' is for maintaining file names and whether they are
     // matched as patterns or not.  It is used only by 'visitTree'.
@@ -259,6 +277,23 @@ void pushBackWrapper(bsl::vector<bsl::string> *vector, const char *item)
     vector->push_back(item);
 }
 
+static
+void reserveBlobCapacity(bdlbb::Blob *blob, int numBytes)
+    // Grow the specified 'blob', if needed, so that at least the specified
+    // 'numBytes' bytes of capacity follow its data, without changing its
+    // length.
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= numBytes);
+
+    const int length = blob->length();
+
+    if (blob->totalSize() - length < numBytes) {
+        blob->setLength(length + numBytes);
+        blob->setLength(length);
+    }
+}
+
 #ifdef BSLS_PLATFORM_OS_WINDOWS
 static inline
 void invokeFindClose(void *handle, void *)
@@ -712,6 +747,85 @@ int FilesystemUtil::write(FileDescriptor  descriptor,
     return WriteFile(descriptor, buffer, numBytesToWrite, &n, 0) ? n : -1;
 }
 
+int FilesystemUtil::readv(FileDescriptor  descriptor,
+                          bdlbb::Blob    *blob,
+                          int             numBytes)
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= numBytes);
+
+    // Windows has no scatter read for arbitrary handles ('ReadFileScatter'
+    // requires page-sized, unbuffered I/O), so read each region in turn,
+    // stopping at the first short read.
+
+    reserveBlobCapacity(blob, numBytes);
+
+    IoVector  vectors[k_MAX_IO_VECTORS];
+    const int numVectors = bdlbb::BlobUtil::loadCapacityIovecs(
+                                                              vectors,
+                                                              k_MAX_IO_VECTORS,
+                                                              *blob,
+                                                              numBytes);
+
+    int numRead = 0;
+    for (int i = 0; i < numVectors; ++i) {
+        const int size = static_cast<int>(vectors[i].iov_len);
+
+        DWORD n;
+        if (!ReadFile(descriptor, vectors[i].iov_base, size, &n, 0)) {
+            if (0 == numRead) {
+                return -1;                                            // RETURN
+            }
+            break;
+        }
+
+        numRead += n;
+        if (static_cast<int>(n) < size) {
+            break;
+        }
+    }
+
+    blob->setLength(blob->length() + numRead);
+    return numRead;
+}
+
+int FilesystemUtil::writev(FileDescriptor      descriptor,
+                           const bdlbb::Blob&  blob,
+                           int                 offset,
+                           int                 numBytes)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(offset <= blob.length() - numBytes);
+
+    int numWritten = 0;
+    while (numWritten < numBytes) {
+        IoVector  vectors[k_MAX_IO_VECTORS];
+        const int numVectors = bdlbb::BlobUtil::loadDataIovecs(
+                                                      vectors,
+                                                      k_MAX_IO_VECTORS,
+                                                      blob,
+                                                      offset + numWritten,
+                                                      numBytes - numWritten);
+
+        for (int i = 0; i < numVectors; ++i) {
+            const int size = static_cast<int>(vectors[i].iov_len);
+
+            DWORD n;
+            if (!WriteFile(descriptor, vectors[i].iov_base, size, &n, 0)) {
+                return 0 == numWritten ? -1 : numWritten;             // RETURN
+            }
+
+            numWritten += n;
+            if (static_cast<int>(n) < size) {
+                return numWritten;                                    // RETURN
+            }
+        }
+    }
+
+    return numWritten;
+}
+
 int FilesystemUtil::map(FileDescriptor   descriptor,
                         void           **address,
                         Offset           offset,
@@ -1591,6 +1705,73 @@ int FilesystemUtil::write(FileDescriptor  descriptor,
     return static_cast<int>(::write(descriptor, buffer, numBytes));
 }
 
+int FilesystemUtil::readv(FileDescriptor  descriptor,
+                          bdlbb::Blob    *blob,
+                          int             numBytes)
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= numBytes);
+
+    reserveBlobCapacity(blob, numBytes);
+
+    struct ::iovec vectors[k_MAX_IO_VECTORS];
+    const int      numVectors = bdlbb::BlobUtil::loadCapacityIovecs(
+                                                              vectors,
+                                                              k_MAX_IO_VECTORS,
+                                                              *blob,
+                                                              numBytes);
+
+    const int rc = static_cast<int>(::readv(descriptor, vectors, numVectors));
+    if (0 < rc) {
+        blob->setLength(blob->length() + rc);
+    }
+    return rc;
+}
+
+int FilesystemUtil::writev(FileDescriptor      descriptor,
+                           const bdlbb::Blob&  blob,
+                           int                 offset,
+                           int                 numBytes)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(offset <= blob.length() - numBytes);
+
+    // A blob may have more buffers than can be passed to a single 'writev',
+    // so write at most 'k_MAX_IO_VECTORS' buffers at a time, stopping at the
+    // first short write.
+
+    int numWritten = 0;
+    while (numWritten < numBytes) {
+        struct ::iovec vectors[k_MAX_IO_VECTORS];
+        const int      numVectors = bdlbb::BlobUtil::loadDataIovecs(
+                                                      vectors,
+                                                      k_MAX_IO_VECTORS,
+                                                      blob,
+                                                      offset + numWritten,
+                                                      numBytes - numWritten);
+
+        int numRequested = 0;
+        for (int i = 0; i < numVectors; ++i) {
+            numRequested += static_cast<int>(vectors[i].iov_len);
+        }
+
+        const int rc = static_cast<int>(::writev(descriptor,
+                                                 vectors,
+                                                 numVectors));
+        if (rc < 0) {
+            return 0 == numWritten ? rc : numWritten;                 // RETURN
+        }
+
+        numWritten += rc;
+        if (rc < numRequested) {
+            break;
+        }
+    }
+
+    return numWritten;
+}
+
 int FilesystemUtil::map(FileDescriptor   descriptor,
                         void           **address,
                         Offset           offset,
@@ -2145,6 +2326,11 @@ int FilesystemUtil::createPrivateDirectory(const bslstl::StringRef& path)
     return makeDirectory(workingPath.c_str(), true);
 }
 
+int FilesystemUtil::writev(FileDescriptor descriptor, const bdlbb::Blob& blob)
+{
+    return writev(descriptor, blob, 0, blob.length());
+}
+
 int FilesystemUtil::findMatchingPaths(bsl::vector<bsl::string> *result,
                                       const char               *pattern)
 {
@@ -107,6 +107,18 @@ BSLS_IDENT("$Id: $")
 //: 'e_SEEK_FROM_END':
 //:   Seek from the end of the file.
 //
+///Scatter/Gather I/O with 'bdlbb::Blob'
+///-------------------------------------
+// The 'readv' and 'writev' methods transfer data directly between a file
+// descriptor and the buffers of a 'bdlbb::Blob', without copying the data to
+// or from a contiguous buffer.  'writev' writes a range of the data of a blob,
+// and 'readv' reads into the unused capacity following the data of a blob
+// (growing that capacity first if needed) and then increases the length of
+// the blob by the number of bytes read.  On POSIX platforms these methods use
+// the 'writev' and 'readv' system calls, and so may also be used with socket
+// descriptors; on Windows the buffers of the blob are transferred one at a
+// time.
+//
 ///Platform-Specific File Locking Caveats
 ///--------------------------------------
 // Locking has the following caveats for the following operating systems:
@@ -294,6 +306,8 @@ BSLS_IDENT("$Id: $")
 
 namespace BloombergLP {
 
+namespace bdlbb { class Blob; }
+
 namespace bdls {
                            // =====================
                            // struct FilesystemUtil
@@ -832,6 +846,22 @@ struct FilesystemUtil {
         // if there were not enough available; or a negative number on some
         // other error.
 
+    static int readv(FileDescriptor  descriptor,
+                     bdlbb::Blob    *blob,
+                     int             numBytes);
+        // Read at most the specified 'numBytes' bytes beginning at the file
+        // pointer of the file with the specified 'descriptor' directly into
+        // the buffers of the specified 'blob', following its data, and
+        // increase the length of 'blob' by the number of bytes read.  If the
+        // unused capacity of 'blob' is less than 'numBytes', first grow
+        // 'blob' using its buffer factory (without changing its length).
+        // Return the number of bytes read (which may be less than 'numBytes',
+        // and is 0 at end of file) on success, or a negative value (leaving
+        // the length of 'blob' unchanged) on error.  The behavior is undefined
+        // unless '0 <= numBytes', and 'blob' has a buffer factory if its
+        // unused capacity is less than 'numBytes'.  Note that a single read
+        // operation is performed, as with 'read'.
+
     static int remove(const bsl::string&  path, bool recursiveFlag = false);
     static int remove(const char         *path, bool recursiveFlag = false);
         // Remove the file or directory at the specified 'path'.  If the 'path'
@@ -883,6 +913,20 @@ struct FilesystemUtil {
         // success; the number of bytes written if space was exhausted; or a
         // negative value on some other error.
 
+    static int writev(FileDescriptor descriptor, const bdlbb::Blob& blob);
+    static int writev(FileDescriptor      descriptor,
+                      const bdlbb::Blob&  blob,
+                      int                 offset,
+                      int                 numBytes);
+        // Write the data of the specified 'blob', or, if the specified
+        // 'offset' and 'numBytes' are supplied, the 'numBytes' bytes of data
+        // starting at 'offset' in 'blob', directly from the buffers of 'blob'
+        // to the file with the specified 'descriptor'.  Return the number of
+        // bytes requested on success; the number of bytes written if space
+        // was exhausted; or a negative value on some other error.  The
+        // behavior is undefined unless '0 <= offset', '0 <= numBytes', and
+        // 'offset <= blob.length() - numBytes'.
+
     static int growFile(
                   FileDescriptor descriptor,
                   Offset         size,
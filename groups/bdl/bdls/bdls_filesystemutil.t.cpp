@@ -13,6 +13,8 @@
 
 #include <bdls_memoryutil.h>
 #include <bdls_pathutil.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_simpleblobbufferfactory.h>
 #include <bdlde_charconvertutf16.h>
 #include <bdlf_bind.h>
 #include <bdlt_datetime.h>
@@ -92,6 +94,9 @@ using namespace bsl;
 // [22] int visitTree(const string&, const string&, const Func&, bool);
 // [22] int visitPaths(const string&, const Func&);
 // [22] int visitPaths(const char *, const Func&);
+// [23] int readv(FileDescriptor, bdlbb::Blob *, int);
+// [23] int writev(FileDescriptor, const bdlbb::Blob&);
+// [23] int writev(FileDescriptor, const bdlbb::Blob&, int, int);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCERN: findMatchingPaths incorrect on ibm 64-bit
@@ -104,8 +109,8 @@ using namespace bsl;
 // [20] CONCERN: directory permissions
 // [21] CONCERN: error codes for 'createDirectories'
 // [21] CONCERN: error codes for 'createPrivateDirectory'
-// [23] USAGE EXAMPLE 1
-// [24] USAGE EXAMPLE 2
+// [24] USAGE EXAMPLE 1
+// [25] USAGE EXAMPLE 2
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -572,7 +577,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == Obj::setWorkingDirectory(tmpWorkingDir));
 
     switch(test) { case 0:
-      case 24: {
+      case 25: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
         //
@@ -658,7 +663,7 @@ int main(int argc, char *argv[])
         ASSERT(0 == bdls::PathUtil::popLeaf(&logPath));
         ASSERT(0 == Obj::remove(logPath.c_str(), true));
       } break;
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -774,6 +779,255 @@ int main(int argc, char *argv[])
         ASSERT(0 == bdls::PathUtil::popLeaf(&logPath));
         ASSERT(0 == Obj::remove(logPath.c_str(), true));
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING 'readv' AND 'writev'
+        //
+        // Concerns:
+        //: 1 'writev' writes the requested range of the data of a blob, in
+        //:   order, including for blobs having more buffers than can be
+        //:   passed to a single system call.
+        //:
+        //: 2 'readv' appends the data read to the data of the blob, growing
+        //:   the capacity of the blob as needed, and returns the number of
+        //:   bytes read.
+        //:
+        //: 3 'readv' returns 0 at end of file, and a negative value on error,
+        //:   leaving the length of the blob unchanged.
+        //:
+        //: 4 On POSIX platforms, 'readv' and 'writev' can be used with
+        //:   sockets.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write blobs having buffers of several sizes, and ranges of those
+        //:   blobs, to a file with 'writev', and read the file back with
+        //:   'read' to verify its contents.  (C-1)
+        //:
+        //: 2 Read the file back into blobs having some initial data with
+        //:   'readv', until end of file, and verify the blobs.  (C-2..3)
+        //:
+        //: 3 Call 'readv' on an invalid descriptor.  (C-3)
+        //:
+        //: 4 On POSIX platforms, transfer a blob through a socket pair.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-5)
+        //
+        // Testing:
+        //   int readv(FileDescriptor, bdlbb::Blob *, int);
+        //   int writev(FileDescriptor, const bdlbb::Blob&);
+        //   int writev(FileDescriptor, const bdlbb::Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'readv' AND 'writev'\n"
+                             "============================\n";
+
+        typedef Obj::FileDescriptor FD;
+
+        const char *testFile = "tmp.bdls_filesystemutil_23.txt";
+
+        bsl::string expected;
+        for (int i = 0; i < 1000; ++i) {
+            expected.push_back(static_cast<char>('a' + i % 26));
+        }
+        const int LENGTH = static_cast<int>(expected.length());
+
+        const int BUFFER_SIZES[] = { 1, 3, 64, 1000, 4096 };
+        const int NUM_BUFFER_SIZES = static_cast<int>(
+                                 sizeof BUFFER_SIZES / sizeof *BUFFER_SIZES);
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            if (veryVerbose) { T_ P(BUFFER_SIZE) }
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+
+            bdlbb::Blob source(&factory);
+            source.setLength(LENGTH);
+            for (int i = 0; i < LENGTH; ++i) {
+                source.buffer(i / BUFFER_SIZE).data()[i % BUFFER_SIZE] =
+                                                                  expected[i];
+            }
+
+            if (verbose) cout << "\tTesting 'writev'.\n";
+
+            const int RANGES[][2] = { { 0, 0 }, { 0, 1 }, { 5, 100 },
+                                      { 999, 1 }, { 1, 998 }, { 0, 1000 } };
+            const int NUM_RANGES = static_cast<int>(
+                                             sizeof RANGES / sizeof *RANGES);
+
+            for (int tj = 0; tj < NUM_RANGES; ++tj) {
+                const int OFFSET = RANGES[tj][0];
+                const int NUM    = RANGES[tj][1];
+
+                Obj::remove(testFile);
+                FD fd = Obj::open(testFile,
+                                  Obj::e_OPEN_OR_CREATE,
+                                  Obj::e_READ_WRITE);
+                ASSERT(Obj::k_INVALID_FD != fd);
+
+                ASSERTV(BUFFER_SIZE, OFFSET, NUM,
+                        NUM == Obj::writev(fd, source, OFFSET, NUM));
+                ASSERTV(BUFFER_SIZE, OFFSET, NUM,
+                        NUM == Obj::getFileSize(testFile));
+
+                ASSERT(0 == Obj::seek(fd, 0, Obj::e_SEEK_FROM_BEGINNING));
+
+                bsl::string result(LENGTH + 1, '\0');
+                const int   rc = Obj::read(fd, &result[0], LENGTH + 1);
+
+                ASSERTV(BUFFER_SIZE, OFFSET, NUM, rc, NUM == rc);
+                result.resize(0 <= rc ? rc : 0);
+                ASSERTV(BUFFER_SIZE, OFFSET, NUM,
+                        expected.substr(OFFSET, NUM) == result);
+
+                ASSERT(0 == Obj::close(fd));
+            }
+
+            Obj::remove(testFile);
+            FD fd = Obj::open(testFile,
+                              Obj::e_OPEN_OR_CREATE,
+                              Obj::e_READ_WRITE);
+            ASSERT(Obj::k_INVALID_FD != fd);
+            ASSERT(LENGTH == Obj::writev(fd, source));
+            ASSERT(LENGTH == Obj::getFileSize(testFile));
+
+            if (verbose) cout << "\tTesting 'readv'.\n";
+
+            const int READ_SIZES[] = { 0, 1, 7, 100, 5000 };
+            const int NUM_READ_SIZES = static_cast<int>(
+                                     sizeof READ_SIZES / sizeof *READ_SIZES);
+
+            for (int tj = 0; tj < NUM_READ_SIZES; ++tj) {
+                const int READ_SIZE = READ_SIZES[tj];
+
+                ASSERT(0 == Obj::seek(fd, 0, Obj::e_SEEK_FROM_BEGINNING));
+
+                bdlbb::SimpleBlobBufferFactory destFactory(BUFFER_SIZE + 2);
+                bdlbb::Blob                    dest(&destFactory);
+
+                dest.setLength(3);
+                for (int i = 0; i < 3; ++i) {
+                    dest.buffer(i / (BUFFER_SIZE + 2)).data()[
+                                                  i % (BUFFER_SIZE + 2)] = '#';
+                }
+
+                int numReads = 0;
+                int rc;
+                while (0 < (rc = Obj::readv(fd, &dest, READ_SIZE))) {
+                    ASSERTV(BUFFER_SIZE, READ_SIZE, rc, rc <= READ_SIZE);
+                    ++numReads;
+                }
+                ASSERTV(BUFFER_SIZE, READ_SIZE, rc, 0 == rc);
+
+                if (0 == READ_SIZE) {
+                    ASSERTV(BUFFER_SIZE, 3 == dest.length());
+                    continue;
+                }
+
+                ASSERTV(BUFFER_SIZE, READ_SIZE, numReads,
+                        (LENGTH + READ_SIZE - 1) / READ_SIZE <= numReads);
+                ASSERTV(BUFFER_SIZE, READ_SIZE, dest.length(),
+                        3 + LENGTH == dest.length());
+
+                bsl::string result;
+                for (int i = 0, n = dest.length(); 0 < n; ++i) {
+                    const bdlbb::BlobBuffer& buffer = dest.buffer(i);
+                    const int size = bsl::min(n, buffer.size());
+
+                    result.append(buffer.data(), size);
+                    n -= size;
+                }
+                ASSERTV(BUFFER_SIZE, READ_SIZE,
+                        "###" + expected == result);
+
+                // At end of file, the length is unchanged.
+
+                ASSERT(0 == Obj::readv(fd, &dest, READ_SIZE));
+                ASSERT(3 + LENGTH == dest.length());
+            }
+
+            ASSERT(0 == Obj::close(fd));
+        }
+        Obj::remove(testFile);
+
+        if (verbose) cout << "\tTesting an invalid descriptor.\n";
+        {
+            bdlbb::SimpleBlobBufferFactory factory(16);
+            bdlbb::Blob                    blob(&factory);
+
+            blob.setLength(5);
+
+            ASSERT(0 >  Obj::readv(Obj::k_INVALID_FD, &blob, 10));
+            ASSERT(5 == blob.length());
+            ASSERT(0 >  Obj::writev(Obj::k_INVALID_FD, blob));
+        }
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        if (verbose) cout << "\tTesting sockets.\n";
+        {
+            int fds[2];
+            ASSERT(0 == ::socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+
+            bdlbb::SimpleBlobBufferFactory factory(10);
+            bdlbb::Blob                    source(&factory);
+
+            source.setLength(95);
+            for (int i = 0; i < 95; ++i) {
+                source.buffer(i / 10).data()[i % 10] = expected[i];
+            }
+
+            ASSERT(95 == Obj::writev(fds[0], source));
+
+            bdlbb::Blob dest(&factory);
+
+            int numRead = 0;
+            while (numRead < 95) {
+                const int rc = Obj::readv(fds[1], &dest, 200);
+                ASSERTV(rc, 0 < rc);
+                if (rc <= 0) {
+                    break;
+                }
+                numRead += rc;
+            }
+            ASSERT(95 == dest.length());
+
+            bsl::string result;
+            for (int i = 0; i < 95; ++i) {
+                result.push_back(dest.buffer(i / 10).data()[i % 10]);
+            }
+            ASSERT(expected.substr(0, 95) == result);
+
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+#endif
+
+        if (verbose) cout << "\tNegative testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(16);
+            bdlbb::Blob                    blob(&factory);
+
+            blob.setLength(5);
+
+            const FD fd = Obj::k_INVALID_FD;
+
+            ASSERT_PASS(Obj::readv(fd, &blob,  0));
+            ASSERT_FAIL(Obj::readv(fd, 0,      1));
+            ASSERT_FAIL(Obj::readv(fd, &blob, -1));
+
+            ASSERT_PASS(Obj::writev(fd, blob,  0,  5));
+            ASSERT_PASS(Obj::writev(fd, blob,  5,  0));
+            ASSERT_FAIL(Obj::writev(fd, blob, -1,  1));
+            ASSERT_FAIL(Obj::writev(fd, blob,  0, -1));
+            ASSERT_FAIL(Obj::writev(fd, blob,  1,  5));
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING VISITTREE AND VISITPATHS
@@ -315,20 +315,43 @@ int Calendar::getNextBusinessDay(Date        *nextBusinessDay,
 
     enum { e_SUCCESS = 0, e_FAILURE = 1 };
 
-    int offset = date - firstDate();
-    while (nth) {
-        offset = static_cast<int>(
-                                d_nonBusinessDays.find0AtMinIndex(offset + 1));
-        if (0 > offset) {
-            return e_FAILURE;                                         // RETURN
-        }
-        --nth;
+    // Locate the business day by counting the 0 bits of the cached
+    // non-business days a word at a time, rather than a day at a time.
+
+    int offset = static_cast<int>(d_nonBusinessDays.findNth0AtMinIndex(
+                                                      nth,
+                                                      date + 1 - firstDate()));
+    if (0 > offset) {
+        return e_FAILURE;                                             // RETURN
     }
     *nextBusinessDay = firstDate() + offset;
 
     return e_SUCCESS;
 }
 
+int Calendar::getPreviousBusinessDay(Date        *previousBusinessDay,
+                                     const Date&  date,
+                                     int          nth) const
+{
+    BSLS_ASSERT(previousBusinessDay);
+    BSLS_ASSERT(Date(1, 1, 1) < date);
+    BSLS_ASSERT(isInRange(date - 1));
+    BSLS_ASSERT(0 < nth);
+
+    enum { e_SUCCESS = 0, e_FAILURE = 1 };
+
+    int offset = static_cast<int>(d_nonBusinessDays.findNth0AtMaxIndex(
+                                                          nth,
+                                                          0,
+                                                          date - firstDate()));
+    if (0 > offset) {
+        return e_FAILURE;                                             // RETURN
+    }
+    *previousBusinessDay = firstDate() + offset;
+
+    return e_SUCCESS;
+}
+
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED  // BDE3.0
 
 // DEPRECATED METHODS
@@ -7,13 +7,86 @@ BSLS_IDENT_RCSID(bdlt_calendarutil_cpp,"$Id$ $CSID$")
 #include <bdlt_date.h>
 #include <bdlt_serialdateimputil.h>
 
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+
 namespace BloombergLP {
 namespace bdlt {
 
+// STATIC HELPER FUNCTIONS
+static
+int nthBusinessDayOnOrAfter(bdlt::Date            *result,
+                            const bdlt::Calendar&  calendar,
+                            const bdlt::Date&      date,
+                            int                    nth)
+    // Load, into the specified 'result', the specified 'nth' business day,
+    // according to the specified 'calendar', that is on or after the
+    // specified 'date'.  Return 0 on success, and a non-zero value, without
+    // modifying '*result', if there is no such business day within the valid
+    // range of 'calendar'.  The behavior is undefined unless 'date' is within
+    // the valid range of 'calendar' and '0 < nth'.
+{
+    BSLS_ASSERT(calendar.isInRange(date));
+    BSLS_ASSERT(0 < nth);
+
+    if (calendar.isBusinessDay(date)) {
+        if (1 == nth) {
+            *result = date;
+            return 0;                                                 // RETURN
+        }
+        --nth;
+    }
+
+    if (calendar.lastDate() == date) {
+        return 1;                                                     // RETURN
+    }
+
+    return calendar.getNextBusinessDay(result, date, nth);
+}
+
+static
+int nthBusinessDayOnOrBefore(bdlt::Date            *result,
+                             const bdlt::Calendar&  calendar,
+                             const bdlt::Date&      date,
+                             int                    nth)
+    // Load, into the specified 'result', the specified 'nth' business day,
+    // according to the specified 'calendar', counting backward from the
+    // specified 'date' inclusive.  Return 0 on success, and a non-zero value,
+    // without modifying '*result', if there is no such business day within
+    // the valid range of 'calendar'.  The behavior is undefined unless 'date'
+    // is within the valid range of 'calendar' and '0 < nth'.
+{
+    BSLS_ASSERT(calendar.isInRange(date));
+    BSLS_ASSERT(0 < nth);
+
+    if (calendar.isBusinessDay(date)) {
+        if (1 == nth) {
+            *result = date;
+            return 0;                                                 // RETURN
+        }
+        --nth;
+    }
+
+    if (calendar.firstDate() == date) {
+        return 1;                                                     // RETURN
+    }
+
+    return calendar.getPreviousBusinessDay(result, date, nth);
+}
+
                            // ===================
                            // struct CalendarUtil
                            // ===================
 
+// CLASS METHODS
+
+// Implementation note: the business-day arithmetic below is expressed in
+// terms of 'Calendar::getNextBusinessDay' and
+// 'Calendar::getPreviousBusinessDay', which count business days a word of the
+// cached non-business-day bit array at a time, rather than stepping a
+// business-day iterator once per day.
+
 int CalendarUtil::addBusinessDaysIfValid(
                                         bdlt::Date            *result,
                                         const bdlt::Date&      original,
@@ -32,46 +105,25 @@ int CalendarUtil::addBusinessDaysIfValid(
                                ? numBusinessDays
                                : -numBusinessDays;
 
-    // declare forward and reverse iterators
-
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
-
-    if (numBusinessDays < 0) {
-        // an iterator to the business day on or before original
-
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
+    // The valid range of 'calendar' cannot contain more than 'length() - 1'
+    // business days on either side of 'original'.
 
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
-
-        if (rit == calendar.rendBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
-
-        *result = *rit;
+    if (absNumBusDays >= static_cast<unsigned int>(calendar.length())) {
+        return e_OUT_OF_RANGE;                                        // RETURN
     }
-    else {
-        // an iterator to the business day on or after 'original'
 
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
-
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
+    // Counting from 'original' inclusive, the result is the 'nth' business
+    // day, where 'original' is the first if it is a business day.
 
-        if (fit == calendar.endBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
+    const int nth = calendar.isBusinessDay(original)
+                  ? static_cast<int>(absNumBusDays) + 1
+                  : bsl::max(static_cast<int>(absNumBusDays), 1);
 
-        *result = *fit;
-    }
+    const int rc = numBusinessDays < 0
+                 ? nthBusinessDayOnOrBefore(result, calendar, original, nth)
+                 : nthBusinessDayOnOrAfter(result, calendar, original, nth);
 
-    return e_SUCCESS;
+    return rc ? e_OUT_OF_RANGE : e_SUCCESS;
 }
 
 int CalendarUtil::nthBusinessDayOfMonthOrMaxIfValid(
@@ -98,66 +150,34 @@ int CalendarUtil::nthBusinessDayOfMonthOrMaxIfValid(
         return e_OUT_OF_RANGE;                                        // RETURN
     }
 
-    bdlt::Date countStart = (n > 0 ? monthStart : monthEnd);
-
-    if (n < 0) {
-        // Create an iterator to the business day on or before 'countStart'.
-
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                       calendar.rbeginBusinessDays(countStart);
-        ++n;
+    // The 'calendar' must have at least one business day in the specified
+    // month.
 
-        // The 'calendar' must have at least one business day in the specified
-        // month and the whole month must be in the valid range if the
-        // 'calendar'.
+    const int numBusDays = calendar.numBusinessDays(monthStart, monthEnd);
 
-        if (rit == calendar.rendBusinessDays() || *rit < monthStart) {
-            return e_NOT_FOUND;                                       // RETURN
-        }
-
-        while (n < 0) {
-            ++rit;
-
-            if (rit == calendar.rendBusinessDays() || *rit < monthStart ) {
-                --rit;
-                break;
-            }
+    if (0 == numBusDays) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
 
-            ++n;
-        }
+    // Since the month has 'numBusDays' business days, the business day found
+    // below is within the month.
 
-        *result = *rit;
+    int rc;
+    if (n > 0) {
+        rc = nthBusinessDayOnOrAfter(result,
+                                     calendar,
+                                     monthStart,
+                                     bsl::min(n, numBusDays));
     }
     else {
-        // Create an iterator to the business day on or after 'countStart'.
-
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                        calendar.beginBusinessDays(countStart);
-        --n;
-
-        // The 'calendar' must have at least one business day in the specified
-        // month and the whole month must be in the valid range if the
-        // 'calendar'.
-
-        if (fit == calendar.endBusinessDays() || *fit > monthEnd) {
-            return e_NOT_FOUND;                                       // RETURN
-        }
-
-        while (n > 0) {
-            ++fit;
-
-            if (fit == calendar.endBusinessDays() || *fit > monthEnd) {
-                --fit;
-                break;
-            }
-
-            --n;
-        }
-
-        *result = *fit;
+        rc = nthBusinessDayOnOrBefore(result,
+                                      calendar,
+                                      monthEnd,
+                                      n < -numBusDays ? numBusDays : -n);
     }
+    BSLS_ASSERT(0 == rc);
 
-    return e_SUCCESS;
+    return rc;
 }
 
 int CalendarUtil::shiftIfValid(bdlt::Date            *result,
@@ -360,46 +380,25 @@ int CalendarUtil::subtractBusinessDaysIfValid(
                                ? numBusinessDays
                                : -numBusinessDays;
 
-    // declare forward and reverse iterators
-
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
-
-    if (numBusinessDays >= 0) {
-        // an iterator to the business day on or before original
-
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
-
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
-
-        if (rit == calendar.rendBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
+    // The valid range of 'calendar' cannot contain more than 'length() - 1'
+    // business days on either side of 'original'.
 
-        *result = *rit;
+    if (absNumBusDays >= static_cast<unsigned int>(calendar.length())) {
+        return e_OUT_OF_RANGE;                                        // RETURN
     }
-    else {
-        // an iterator to the business day on or after 'original'
 
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
+    // Counting from 'original' inclusive, the result is the 'nth' business
+    // day, where 'original' is the first if it is a business day.
 
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
+    const int nth = calendar.isBusinessDay(original)
+                  ? static_cast<int>(absNumBusDays) + 1
+                  : bsl::max(static_cast<int>(absNumBusDays), 1);
 
-        if (fit == calendar.endBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
-
-        *result = *fit;
-    }
+    const int rc = numBusinessDays < 0
+                 ? nthBusinessDayOnOrAfter(result, calendar, original, nth)
+                 : nthBusinessDayOnOrBefore(result, calendar, original, nth);
 
-    return e_SUCCESS;
+    return rc ? e_OUT_OF_RANGE : e_SUCCESS;
 }
 
 }  // close package namespace
@@ -14,9 +14,11 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_set.h>
 
@@ -47,6 +49,7 @@ using namespace bsl;
 // [10] USAGE EXAMPLE
 // [ 1] parseCalendar(const char *, const bdlt::Date&)
 // [ 2] getStartDate(const char *)
+// [-1] PERFORMANCE: BUSINESS-DAY ARITHMETIC
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -231,6 +234,40 @@ int getStartDate(const char *input)
     return 999;
 }
 
+int addBusinessDaysByIteration(bdlt::Date            *result,
+                               const bdlt::Date&      original,
+                               const bdlt::Calendar&  calendar,
+                               int                    numBusinessDays)
+    // Load, into the specified 'result', the date that is the specified
+    // non-negative 'numBusinessDays' after the specified 'original' date
+    // according to the specified 'calendar', as by
+    // 'CalendarUtil::addBusinessDaysIfValid', by stepping a business-day
+    // iterator once per business day.  Return 0 on success, and a non-zero
+    // value otherwise.  The behavior is undefined unless
+    // '0 <= numBusinessDays' and 'original' is within the valid range of
+    // 'calendar'.  Note that this function provides a baseline for
+    // measuring the performance of 'addBusinessDaysIfValid'.
+{
+    BSLS_ASSERT(0 <= numBusinessDays);
+
+    int count = calendar.isBusinessDay(original) ? 0 : 1;
+
+    bdlt::Calendar::BusinessDayConstIterator fit =
+                                          calendar.beginBusinessDays(original);
+
+    while (fit != calendar.endBusinessDays() && count < numBusinessDays) {
+        ++fit;
+        ++count;
+    }
+
+    if (fit == calendar.endBusinessDays()) {
+        return 1;                                                     // RETURN
+    }
+
+    *result = *fit;
+    return 0;
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -6029,6 +6066,157 @@ int main(int argc, char *argv[])
                     rval.length() == LENGTH);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BUSINESS-DAY ARITHMETIC
+        //
+        // Concerns:
+        //: 1 'addBusinessDaysIfValid' and 'Calendar::numBusinessDays' count
+        //:   business days a word at a time, and are substantially faster
+        //:   than stepping a business-day iterator once per day, increasingly
+        //:   so as the number of business days grows.
+        //
+        // Plan:
+        //: 1 Create a calendar spanning 50 years having weekends and
+        //:   holidays.  For a range of business-day counts, and for every
+        //:   date in the calendar, time 'addBusinessDaysIfValid' and
+        //:   'addBusinessDaysByIteration', and verify that they agree.
+        //:
+        //: 2 For a range of period lengths, time 'numBusinessDays' over every
+        //:   period of that length against counting with an iterator.
+        //
+        // Testing:
+        //   PERFORMANCE: BUSINESS-DAY ARITHMETIC
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: BUSINESS-DAY ARITHMETIC" << endl
+             << "====================================" << endl;
+
+        bdlt::Calendar calendar(bdlt::Date(2000, 1, 1),
+                                bdlt::Date(2049, 12, 31));
+        calendar.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+        calendar.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+
+        unsigned int seed = 12345;
+        for (bdlt::Date date = calendar.firstDate();
+             date <= calendar.lastDate();
+             ++date) {
+            seed = seed * 1103515245 + 12345;
+            if (0 == (seed >> 16) % 25) {
+                calendar.addHoliday(date);
+            }
+        }
+
+        const int NUM_DATES = calendar.length();
+
+        cout << "'addBusinessDaysIfValid', ns per call over "
+             << NUM_DATES << " dates" << endl
+             << setw(8)  << "days"
+             << setw(14) << "iterator"
+             << setw(14) << "word-level"
+             << endl;
+
+        const int NUM_DAYS[] = { 1, 5, 21, 63, 252, 1260 };
+        const int NUM_NUM_DAYS =
+                          static_cast<int>(sizeof NUM_DAYS / sizeof *NUM_DAYS);
+
+        for (int ti = 0; ti < NUM_NUM_DAYS; ++ti) {
+            const int N = NUM_DAYS[ti];
+
+            bsls::Stopwatch iterationTimer;
+            bsls::Stopwatch wordTimer;
+            int             sum = 0;
+
+            iterationTimer.start();
+            for (bdlt::Date date = calendar.firstDate();
+                 date < calendar.lastDate();
+                 ++date) {
+                bdlt::Date result;
+                if (0 == addBusinessDaysByIteration(&result,
+                                                    date,
+                                                    calendar,
+                                                    N)) {
+                    sum += result - date;
+                }
+            }
+            iterationTimer.stop();
+
+            wordTimer.start();
+            for (bdlt::Date date = calendar.firstDate();
+                 date < calendar.lastDate();
+                 ++date) {
+                bdlt::Date result;
+                if (0 == Util::addBusinessDaysIfValid(&result,
+                                                      date,
+                                                      calendar,
+                                                      N)) {
+                    sum -= result - date;
+                }
+            }
+            wordTimer.stop();
+
+            ASSERTV(N, 0 == sum);
+
+            cout << fixed << setprecision(1)
+                 << setw(8)  << N
+                 << setw(14) << iterationTimer.accumulatedWallTime() * 1e9
+                                                                  / NUM_DATES
+                 << setw(14) << wordTimer.accumulatedWallTime() * 1e9
+                                                                  / NUM_DATES
+                 << endl;
+        }
+
+        cout << "'numBusinessDays', ns per call over "
+             << NUM_DATES << " periods" << endl
+             << setw(8)  << "days"
+             << setw(14) << "iterator"
+             << setw(14) << "word-level"
+             << endl;
+
+        const int PERIODS[] = { 7, 31, 92, 365, 3650 };
+        const int NUM_PERIODS =
+                            static_cast<int>(sizeof PERIODS / sizeof *PERIODS);
+
+        for (int ti = 0; ti < NUM_PERIODS; ++ti) {
+            const int        PERIOD = PERIODS[ti];
+            const bdlt::Date LAST   = calendar.lastDate() - PERIOD + 1;
+
+            bsls::Stopwatch iterationTimer;
+            bsls::Stopwatch wordTimer;
+            int             sum = 0;
+            int             numPeriods = 0;
+
+            iterationTimer.start();
+            for (bdlt::Date date = calendar.firstDate(); date < LAST; ++date) {
+                const bdlt::Date end = date + PERIOD;
+
+                bdlt::Calendar::BusinessDayConstIterator it =
+                                              calendar.beginBusinessDays(date);
+                for (; it != calendar.endBusinessDays() && *it < end; ++it) {
+                    ++sum;
+                }
+                ++numPeriods;
+            }
+            iterationTimer.stop();
+
+            wordTimer.start();
+            for (bdlt::Date date = calendar.firstDate(); date < LAST; ++date) {
+                sum -= calendar.numBusinessDays(date, date + PERIOD - 1);
+            }
+            wordTimer.stop();
+
+            ASSERTV(PERIOD, 0 == sum);
+
+            cout << fixed << setprecision(1)
+                 << setw(8)  << PERIOD
+                 << setw(14) << iterationTimer.accumulatedWallTime() * 1e9
+                                                                 / numPeriods
+                 << setw(14) << wordTimer.accumulatedWallTime() * 1e9
+                                                                 / numPeriods
+                 << endl;
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;